@@ -36,9 +36,17 @@ void LoRaWanGateway::setup() {
 	this->rfm->setup();
 	this->wan->setup();
 
+	// keep the radio serviced while long HTTP responses are streamed
+	this->httpServer->idle = std::bind(&LoRaWanGateway::radio, this);
+
 	DEBUG.println("Starting LoRaWAN Gateway ... OK");
 }
 
+void LoRaWanGateway::radio() {
+	this->rfm->read(this->wan);
+	this->wan->emitDownlinks();
+}
+
 void LoRaWanGateway::loop() {
 	NetworkNode::loop();
 
@@ -47,17 +55,8 @@ void LoRaWanGateway::loop() {
 	this->rfm->loop();
 	this->wan->loop();
 
-	uint64_t now = clock64.mstime();
-	uint32_t diff = (uint32_t)(now - this->lping);
-	if (diff > this->iping) {
-		this->lping = now;
-		int connectedClients = this->webSocketServer->connectedClients();
-		if (connectedClients) {
-			DynamicJsonDocument pongDocument(512);
-			JsonObject pongObject = pongDocument.to<JsonObject>();
-			this->ping(pongObject);
-			this->command(pongObject);
-		}
-	} 
+	this->pingSubscribers();
+
+	scratch.reset(); // every ScratchJsonDocument of this iteration is gone by now
 }
 
@@ -5,6 +5,7 @@
 
 #include <Application.h>
 #define ARDUINOJSON_USE_DOUBLE 1
+#define ARDUINOJSON_FAST_FLOAT 1
 #include <ArduinoJson.h>
 #include <Login.h>
 #include <NetworkNode.h>
@@ -24,13 +25,11 @@ class LoRaWanGateway : public Application, public NetworkNode {
 	RFM* rfm = NULL;
 	System* system = NULL;
 
-	uint64_t lping = 0ull;
-	uint32_t iping = 15ul * 1000ul;
-
 	LoRaWanGateway();
 	virtual ~LoRaWanGateway();
 	void loop();
 	void setup();
+	void radio();
 };
 
 #endif
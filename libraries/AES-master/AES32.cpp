@@ -0,0 +1,392 @@
+#include "AES32.h"
+
+/*
+ Table driven AES on 32-bit words, following the layout of the reference
+ rijndael-alg-fst.c by Vincent Rijmen, Antoon Bosselaers and Paulo Barreto
+ (public domain). Te0/Td0 hold the combined SubBytes/MixColumns (and inverse)
+ columns, big endian, the remaining tables are rotations computed on the fly.
+*/
+
+static const uint32_t Te0[256] PROGMEM = {
+	0xc66363a5ul, 0xf87c7c84ul, 0xee777799ul, 0xf67b7b8dul, 0xfff2f20dul, 0xd66b6bbdul,
+	0xde6f6fb1ul, 0x91c5c554ul, 0x60303050ul, 0x02010103ul, 0xce6767a9ul, 0x562b2b7dul,
+	0xe7fefe19ul, 0xb5d7d762ul, 0x4dababe6ul, 0xec76769aul, 0x8fcaca45ul, 0x1f82829dul,
+	0x89c9c940ul, 0xfa7d7d87ul, 0xeffafa15ul, 0xb25959ebul, 0x8e4747c9ul, 0xfbf0f00bul,
+	0x41adadecul, 0xb3d4d467ul, 0x5fa2a2fdul, 0x45afafeaul, 0x239c9cbful, 0x53a4a4f7ul,
+	0xe4727296ul, 0x9bc0c05bul, 0x75b7b7c2ul, 0xe1fdfd1cul, 0x3d9393aeul, 0x4c26266aul,
+	0x6c36365aul, 0x7e3f3f41ul, 0xf5f7f702ul, 0x83cccc4ful, 0x6834345cul, 0x51a5a5f4ul,
+	0xd1e5e534ul, 0xf9f1f108ul, 0xe2717193ul, 0xabd8d873ul, 0x62313153ul, 0x2a15153ful,
+	0x0804040cul, 0x95c7c752ul, 0x46232365ul, 0x9dc3c35eul, 0x30181828ul, 0x379696a1ul,
+	0x0a05050ful, 0x2f9a9ab5ul, 0x0e070709ul, 0x24121236ul, 0x1b80809bul, 0xdfe2e23dul,
+	0xcdebeb26ul, 0x4e272769ul, 0x7fb2b2cdul, 0xea75759ful, 0x1209091bul, 0x1d83839eul,
+	0x582c2c74ul, 0x341a1a2eul, 0x361b1b2dul, 0xdc6e6eb2ul, 0xb45a5aeeul, 0x5ba0a0fbul,
+	0xa45252f6ul, 0x763b3b4dul, 0xb7d6d661ul, 0x7db3b3ceul, 0x5229297bul, 0xdde3e33eul,
+	0x5e2f2f71ul, 0x13848497ul, 0xa65353f5ul, 0xb9d1d168ul, 0x00000000ul, 0xc1eded2cul,
+	0x40202060ul, 0xe3fcfc1ful, 0x79b1b1c8ul, 0xb65b5bedul, 0xd46a6abeul, 0x8dcbcb46ul,
+	0x67bebed9ul, 0x7239394bul, 0x944a4adeul, 0x984c4cd4ul, 0xb05858e8ul, 0x85cfcf4aul,
+	0xbbd0d06bul, 0xc5efef2aul, 0x4faaaae5ul, 0xedfbfb16ul, 0x864343c5ul, 0x9a4d4dd7ul,
+	0x66333355ul, 0x11858594ul, 0x8a4545cful, 0xe9f9f910ul, 0x04020206ul, 0xfe7f7f81ul,
+	0xa05050f0ul, 0x783c3c44ul, 0x259f9fbaul, 0x4ba8a8e3ul, 0xa25151f3ul, 0x5da3a3feul,
+	0x804040c0ul, 0x058f8f8aul, 0x3f9292adul, 0x219d9dbcul, 0x70383848ul, 0xf1f5f504ul,
+	0x63bcbcdful, 0x77b6b6c1ul, 0xafdada75ul, 0x42212163ul, 0x20101030ul, 0xe5ffff1aul,
+	0xfdf3f30eul, 0xbfd2d26dul, 0x81cdcd4cul, 0x180c0c14ul, 0x26131335ul, 0xc3ecec2ful,
+	0xbe5f5fe1ul, 0x359797a2ul, 0x884444ccul, 0x2e171739ul, 0x93c4c457ul, 0x55a7a7f2ul,
+	0xfc7e7e82ul, 0x7a3d3d47ul, 0xc86464acul, 0xba5d5de7ul, 0x3219192bul, 0xe6737395ul,
+	0xc06060a0ul, 0x19818198ul, 0x9e4f4fd1ul, 0xa3dcdc7ful, 0x44222266ul, 0x542a2a7eul,
+	0x3b9090abul, 0x0b888883ul, 0x8c4646caul, 0xc7eeee29ul, 0x6bb8b8d3ul, 0x2814143cul,
+	0xa7dede79ul, 0xbc5e5ee2ul, 0x160b0b1dul, 0xaddbdb76ul, 0xdbe0e03bul, 0x64323256ul,
+	0x743a3a4eul, 0x140a0a1eul, 0x924949dbul, 0x0c06060aul, 0x4824246cul, 0xb85c5ce4ul,
+	0x9fc2c25dul, 0xbdd3d36eul, 0x43acaceful, 0xc46262a6ul, 0x399191a8ul, 0x319595a4ul,
+	0xd3e4e437ul, 0xf279798bul, 0xd5e7e732ul, 0x8bc8c843ul, 0x6e373759ul, 0xda6d6db7ul,
+	0x018d8d8cul, 0xb1d5d564ul, 0x9c4e4ed2ul, 0x49a9a9e0ul, 0xd86c6cb4ul, 0xac5656faul,
+	0xf3f4f407ul, 0xcfeaea25ul, 0xca6565aful, 0xf47a7a8eul, 0x47aeaee9ul, 0x10080818ul,
+	0x6fbabad5ul, 0xf0787888ul, 0x4a25256ful, 0x5c2e2e72ul, 0x381c1c24ul, 0x57a6a6f1ul,
+	0x73b4b4c7ul, 0x97c6c651ul, 0xcbe8e823ul, 0xa1dddd7cul, 0xe874749cul, 0x3e1f1f21ul,
+	0x964b4bddul, 0x61bdbddcul, 0x0d8b8b86ul, 0x0f8a8a85ul, 0xe0707090ul, 0x7c3e3e42ul,
+	0x71b5b5c4ul, 0xcc6666aaul, 0x904848d8ul, 0x06030305ul, 0xf7f6f601ul, 0x1c0e0e12ul,
+	0xc26161a3ul, 0x6a35355ful, 0xae5757f9ul, 0x69b9b9d0ul, 0x17868691ul, 0x99c1c158ul,
+	0x3a1d1d27ul, 0x279e9eb9ul, 0xd9e1e138ul, 0xebf8f813ul, 0x2b9898b3ul, 0x22111133ul,
+	0xd26969bbul, 0xa9d9d970ul, 0x078e8e89ul, 0x339494a7ul, 0x2d9b9bb6ul, 0x3c1e1e22ul,
+	0x15878792ul, 0xc9e9e920ul, 0x87cece49ul, 0xaa5555fful, 0x50282878ul, 0xa5dfdf7aul,
+	0x038c8c8ful, 0x59a1a1f8ul, 0x09898980ul, 0x1a0d0d17ul, 0x65bfbfdaul, 0xd7e6e631ul,
+	0x844242c6ul, 0xd06868b8ul, 0x824141c3ul, 0x299999b0ul, 0x5a2d2d77ul, 0x1e0f0f11ul,
+	0x7bb0b0cbul, 0xa85454fcul, 0x6dbbbbd6ul, 0x2c16163aul,
+};
+
+static const uint32_t Td0[256] PROGMEM = {
+	0x51f4a750ul, 0x7e416553ul, 0x1a17a4c3ul, 0x3a275e96ul, 0x3bab6bcbul, 0x1f9d45f1ul,
+	0xacfa58abul, 0x4be30393ul, 0x2030fa55ul, 0xad766df6ul, 0x88cc7691ul, 0xf5024c25ul,
+	0x4fe5d7fcul, 0xc52acbd7ul, 0x26354480ul, 0xb562a38ful, 0xdeb15a49ul, 0x25ba1b67ul,
+	0x45ea0e98ul, 0x5dfec0e1ul, 0xc32f7502ul, 0x814cf012ul, 0x8d4697a3ul, 0x6bd3f9c6ul,
+	0x038f5fe7ul, 0x15929c95ul, 0xbf6d7aebul, 0x955259daul, 0xd4be832dul, 0x587421d3ul,
+	0x49e06929ul, 0x8ec9c844ul, 0x75c2896aul, 0xf48e7978ul, 0x99583e6bul, 0x27b971ddul,
+	0xbee14fb6ul, 0xf088ad17ul, 0xc920ac66ul, 0x7dce3ab4ul, 0x63df4a18ul, 0xe51a3182ul,
+	0x97513360ul, 0x62537f45ul, 0xb16477e0ul, 0xbb6bae84ul, 0xfe81a01cul, 0xf9082b94ul,
+	0x70486858ul, 0x8f45fd19ul, 0x94de6c87ul, 0x527bf8b7ul, 0xab73d323ul, 0x724b02e2ul,
+	0xe31f8f57ul, 0x6655ab2aul, 0xb2eb2807ul, 0x2fb5c203ul, 0x86c57b9aul, 0xd33708a5ul,
+	0x302887f2ul, 0x23bfa5b2ul, 0x02036abaul, 0xed16825cul, 0x8acf1c2bul, 0xa779b492ul,
+	0xf307f2f0ul, 0x4e69e2a1ul, 0x65daf4cdul, 0x0605bed5ul, 0xd134621ful, 0xc4a6fe8aul,
+	0x342e539dul, 0xa2f355a0ul, 0x058ae132ul, 0xa4f6eb75ul, 0x0b83ec39ul, 0x4060efaaul,
+	0x5e719f06ul, 0xbd6e1051ul, 0x3e218af9ul, 0x96dd063dul, 0xdd3e05aeul, 0x4de6bd46ul,
+	0x91548db5ul, 0x71c45d05ul, 0x0406d46ful, 0x605015fful, 0x1998fb24ul, 0xd6bde997ul,
+	0x894043ccul, 0x67d99e77ul, 0xb0e842bdul, 0x07898b88ul, 0xe7195b38ul, 0x79c8eedbul,
+	0xa17c0a47ul, 0x7c420fe9ul, 0xf8841ec9ul, 0x00000000ul, 0x09808683ul, 0x322bed48ul,
+	0x1e1170acul, 0x6c5a724eul, 0xfd0efffbul, 0x0f853856ul, 0x3daed51eul, 0x362d3927ul,
+	0x0a0fd964ul, 0x685ca621ul, 0x9b5b54d1ul, 0x24362e3aul, 0x0c0a67b1ul, 0x9357e70ful,
+	0xb4ee96d2ul, 0x1b9b919eul, 0x80c0c54ful, 0x61dc20a2ul, 0x5a774b69ul, 0x1c121a16ul,
+	0xe293ba0aul, 0xc0a02ae5ul, 0x3c22e043ul, 0x121b171dul, 0x0e090d0bul, 0xf28bc7adul,
+	0x2db6a8b9ul, 0x141ea9c8ul, 0x57f11985ul, 0xaf75074cul, 0xee99ddbbul, 0xa37f60fdul,
+	0xf701269ful, 0x5c72f5bcul, 0x44663bc5ul, 0x5bfb7e34ul, 0x8b432976ul, 0xcb23c6dcul,
+	0xb6edfc68ul, 0xb8e4f163ul, 0xd731dccaul, 0x42638510ul, 0x13972240ul, 0x84c61120ul,
+	0x854a247dul, 0xd2bb3df8ul, 0xaef93211ul, 0xc729a16dul, 0x1d9e2f4bul, 0xdcb230f3ul,
+	0x0d8652ecul, 0x77c1e3d0ul, 0x2bb3166cul, 0xa970b999ul, 0x119448faul, 0x47e96422ul,
+	0xa8fc8cc4ul, 0xa0f03f1aul, 0x567d2cd8ul, 0x223390eful, 0x87494ec7ul, 0xd938d1c1ul,
+	0x8ccaa2feul, 0x98d40b36ul, 0xa6f581cful, 0xa57ade28ul, 0xdab78e26ul, 0x3fadbfa4ul,
+	0x2c3a9de4ul, 0x5078920dul, 0x6a5fcc9bul, 0x547e4662ul, 0xf68d13c2ul, 0x90d8b8e8ul,
+	0x2e39f75eul, 0x82c3aff5ul, 0x9f5d80beul, 0x69d0937cul, 0x6fd52da9ul, 0xcf2512b3ul,
+	0xc8ac993bul, 0x10187da7ul, 0xe89c636eul, 0xdb3bbb7bul, 0xcd267809ul, 0x6e5918f4ul,
+	0xec9ab701ul, 0x834f9aa8ul, 0xe6956e65ul, 0xaaffe67eul, 0x21bccf08ul, 0xef15e8e6ul,
+	0xbae79bd9ul, 0x4a6f36ceul, 0xea9f09d4ul, 0x29b07cd6ul, 0x31a4b2aful, 0x2a3f2331ul,
+	0xc6a59430ul, 0x35a266c0ul, 0x744ebc37ul, 0xfc82caa6ul, 0xe090d0b0ul, 0x33a7d815ul,
+	0xf104984aul, 0x41ecdaf7ul, 0x7fcd500eul, 0x1791f62ful, 0x764dd68dul, 0x43efb04dul,
+	0xccaa4d54ul, 0xe49604dful, 0x9ed1b5e3ul, 0x4c6a881bul, 0xc12c1fb8ul, 0x4665517ful,
+	0x9d5eea04ul, 0x018c355dul, 0xfa877473ul, 0xfb0b412eul, 0xb3671d5aul, 0x92dbd252ul,
+	0xe9105633ul, 0x6dd64713ul, 0x9ad7618cul, 0x37a10c7aul, 0x59f8148eul, 0xeb133c89ul,
+	0xcea927eeul, 0xb761c935ul, 0xe11ce5edul, 0x7a47b13cul, 0x9cd2df59ul, 0x55f2733ful,
+	0x1814ce79ul, 0x73c737bful, 0x53f7cdeaul, 0x5ffdaa5bul, 0xdf3d6f14ul, 0x7844db86ul,
+	0xcaaff381ul, 0xb968c43eul, 0x3824342cul, 0xc2a3405ful, 0x161dc372ul, 0xbce2250cul,
+	0x283c498bul, 0xff0d9541ul, 0x39a80171ul, 0x080cb3deul, 0xd8b4e49cul, 0x6456c190ul,
+	0x7bcb8461ul, 0xd532b670ul, 0x486c5c74ul, 0xd0b85742ul,
+};
+
+static const uint8_t S[256] PROGMEM = {
+	0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+	0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+	0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+	0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+	0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+	0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+	0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+	0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+	0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+	0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+	0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+	0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+	0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+	0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+	0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+	0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+static const uint8_t Si[256] PROGMEM = {
+	0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
+	0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87, 0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
+	0x54, 0x7b, 0x94, 0x32, 0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
+	0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2, 0x76, 0x5b, 0xa2, 0x49, 0x6d, 0x8b, 0xd1, 0x25,
+	0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92,
+	0x6c, 0x70, 0x48, 0x50, 0xfd, 0xed, 0xb9, 0xda, 0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
+	0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a, 0xf7, 0xe4, 0x58, 0x05, 0xb8, 0xb3, 0x45, 0x06,
+	0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02, 0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b,
+	0x3a, 0x91, 0x11, 0x41, 0x4f, 0x67, 0xdc, 0xea, 0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
+	0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85, 0xe2, 0xf9, 0x37, 0xe8, 0x1c, 0x75, 0xdf, 0x6e,
+	0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89, 0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b,
+	0xfc, 0x56, 0x3e, 0x4b, 0xc6, 0xd2, 0x79, 0x20, 0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
+	0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31, 0xb1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xec, 0x5f,
+	0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d, 0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef,
+	0xa0, 0xe0, 0x3b, 0x4d, 0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
+	0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d,
+};
+
+static const uint8_t rcon[10] PROGMEM = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36 } ;
+
+#define ROR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define TE0(x) pgm_read_dword (Te0 + ((x) & 0xff))
+#define TE1(x) ROR (TE0 (x), 8)
+#define TE2(x) ROR (TE0 (x), 16)
+#define TE3(x) ROR (TE0 (x), 24)
+#define TD0(x) pgm_read_dword (Td0 + ((x) & 0xff))
+#define TD1(x) ROR (TD0 (x), 8)
+#define TD2(x) ROR (TD0 (x), 16)
+#define TD3(x) ROR (TD0 (x), 24)
+#define SB(x) ((uint32_t) pgm_read_byte (S + ((x) & 0xff)))
+#define SI(x) ((uint32_t) pgm_read_byte (Si + ((x) & 0xff)))
+
+#define GETU32(p) (((uint32_t) (p)[0] << 24) ^ ((uint32_t) (p)[1] << 16) ^ ((uint32_t) (p)[2] << 8) ^ ((uint32_t) (p)[3]))
+#define PUTU32(p, v) { (p)[0] = (byte) ((v) >> 24) ; (p)[1] = (byte) ((v) >> 16) ; (p)[2] = (byte) ((v) >> 8) ; (p)[3] = (byte) (v) ; }
+
+/******************************************************************************/
+
+AES32::AES32 ()
+{
+  round = 0 ;
+  #if defined(AES32_NI)
+  __builtin_cpu_init () ;
+  ni = __builtin_cpu_supports ("aes") ;
+  #endif
+}
+
+/******************************************************************************/
+
+bool AES32::accelerated ()
+{
+  #if defined(AES32_NI)
+  return ni ;
+  #else
+  return false ;
+  #endif
+}
+
+/******************************************************************************/
+
+byte AES32::set_key (byte key [], int keylen)
+{
+  int nk ;
+  switch (keylen)
+    {
+    case 16:
+    case 128:
+      nk = 4 ; // 10 rounds
+      round = 10 ;
+      break;
+    case 24:
+    case 192:
+      nk = 6 ; // 12 rounds
+      round = 12 ;
+      break;
+    case 32:
+    case 256:
+      nk = 8 ; // 14 rounds
+      round = 14 ;
+      break;
+    default:
+      round = 0 ;
+      return FAILURE ;
+    }
+
+  int words = 4 * (round + 1) ;
+  for (int i = 0 ; i < nk ; i++)
+    ek [i] = GETU32 (key + 4 * i) ;
+  for (int i = nk ; i < words ; i++)
+    {
+      uint32_t t = ek [i - 1] ;
+      if (0 == i % nk)
+        {
+          t = (SB (t >> 16) << 24) ^ (SB (t >> 8) << 16) ^ (SB (t) << 8) ^ SB (t >> 24) ;
+          t ^= (uint32_t) pgm_read_byte (rcon + i / nk - 1) << 24 ;
+        }
+      else if (8 == nk && 4 == i % nk)
+        {
+          t = (SB (t >> 24) << 24) ^ (SB (t >> 16) << 16) ^ (SB (t >> 8) << 8) ^ SB (t) ;
+        }
+      ek [i] = ek [i - nk] ^ t ;
+    }
+
+  // decryption: round keys in reverse order, InvMixColumns on all but first and last
+  for (int r = 0 ; r <= round ; r++)
+    for (int j = 0 ; j < 4 ; j++)
+      dk [4 * r + j] = ek [4 * (round - r) + j] ;
+  for (int i = 4 ; i < 4 * round ; i++)
+    {
+      uint32_t w = dk [i] ;
+      dk [i] = TD0 (SB (w >> 24)) ^ TD1 (SB (w >> 16)) ^ TD2 (SB (w >> 8)) ^ TD3 (SB (w)) ;
+    }
+
+  #if defined(AES32_NI)
+  for (int i = 0 ; i < words ; i++)
+    {
+      PUTU32 (ekb + 4 * i, ek [i]) ;
+      PUTU32 (dkb + 4 * i, dk [i]) ;
+    }
+  #endif
+  return SUCCESS ;
+}
+
+/******************************************************************************/
+
+void AES32::clean ()
+{
+  memset (ek, 0, sizeof (ek)) ;
+  memset (dk, 0, sizeof (dk)) ;
+  #if defined(AES32_NI)
+  memset (ekb, 0, sizeof (ekb)) ;
+  memset (dkb, 0, sizeof (dkb)) ;
+  #endif
+  round = 0 ;
+}
+
+/******************************************************************************/
+
+void AES32::copy_n_bytes (byte * d, byte * s, byte nn)
+{
+  memcpy (d, s, nn) ;
+}
+
+/******************************************************************************/
+
+byte AES32::encrypt (byte plain [N_BLOCK], byte cipher [N_BLOCK])
+{
+  if (!round)
+    return FAILURE ;
+
+  #if defined(AES32_NI)
+  if (ni)
+    {
+      const __m128i * rk = (const __m128i *) ekb ;
+      __m128i s = _mm_xor_si128 (_mm_loadu_si128 ((const __m128i *) plain), _mm_loadu_si128 (rk)) ;
+      for (int r = 1 ; r < round ; r++)
+        s = _mm_aesenc_si128 (s, _mm_loadu_si128 (rk + r)) ;
+      s = _mm_aesenclast_si128 (s, _mm_loadu_si128 (rk + round)) ;
+      _mm_storeu_si128 ((__m128i *) cipher, s) ;
+      return SUCCESS ;
+    }
+  #endif
+
+  const uint32_t * rk = ek ;
+  uint32_t s0 = GETU32 (plain     ) ^ rk [0] ;
+  uint32_t s1 = GETU32 (plain +  4) ^ rk [1] ;
+  uint32_t s2 = GETU32 (plain +  8) ^ rk [2] ;
+  uint32_t s3 = GETU32 (plain + 12) ^ rk [3] ;
+  uint32_t t0, t1, t2, t3 ;
+  for (int r = 1 ; r < round ; r++)
+    {
+      rk += 4 ;
+      t0 = TE0 (s0 >> 24) ^ TE1 (s1 >> 16) ^ TE2 (s2 >> 8) ^ TE3 (s3) ^ rk [0] ;
+      t1 = TE0 (s1 >> 24) ^ TE1 (s2 >> 16) ^ TE2 (s3 >> 8) ^ TE3 (s0) ^ rk [1] ;
+      t2 = TE0 (s2 >> 24) ^ TE1 (s3 >> 16) ^ TE2 (s0 >> 8) ^ TE3 (s1) ^ rk [2] ;
+      t3 = TE0 (s3 >> 24) ^ TE1 (s0 >> 16) ^ TE2 (s1 >> 8) ^ TE3 (s2) ^ rk [3] ;
+      s0 = t0 ; s1 = t1 ; s2 = t2 ; s3 = t3 ;
+    }
+  rk += 4 ;
+  t0 = (SB (s0 >> 24) << 24) ^ (SB (s1 >> 16) << 16) ^ (SB (s2 >> 8) << 8) ^ SB (s3) ^ rk [0] ;
+  t1 = (SB (s1 >> 24) << 24) ^ (SB (s2 >> 16) << 16) ^ (SB (s3 >> 8) << 8) ^ SB (s0) ^ rk [1] ;
+  t2 = (SB (s2 >> 24) << 24) ^ (SB (s3 >> 16) << 16) ^ (SB (s0 >> 8) << 8) ^ SB (s1) ^ rk [2] ;
+  t3 = (SB (s3 >> 24) << 24) ^ (SB (s0 >> 16) << 16) ^ (SB (s1 >> 8) << 8) ^ SB (s2) ^ rk [3] ;
+  PUTU32 (cipher     , t0) ;
+  PUTU32 (cipher +  4, t1) ;
+  PUTU32 (cipher +  8, t2) ;
+  PUTU32 (cipher + 12, t3) ;
+  return SUCCESS ;
+}
+
+/******************************************************************************/
+
+byte AES32::decrypt (byte cipher [N_BLOCK], byte plain [N_BLOCK])
+{
+  if (!round)
+    return FAILURE ;
+
+  #if defined(AES32_NI)
+  if (ni)
+    {
+      const __m128i * rk = (const __m128i *) dkb ;
+      __m128i s = _mm_xor_si128 (_mm_loadu_si128 ((const __m128i *) cipher), _mm_loadu_si128 (rk)) ;
+      for (int r = 1 ; r < round ; r++)
+        s = _mm_aesdec_si128 (s, _mm_loadu_si128 (rk + r)) ;
+      s = _mm_aesdeclast_si128 (s, _mm_loadu_si128 (rk + round)) ;
+      _mm_storeu_si128 ((__m128i *) plain, s) ;
+      return SUCCESS ;
+    }
+  #endif
+
+  const uint32_t * rk = dk ;
+  uint32_t s0 = GETU32 (cipher     ) ^ rk [0] ;
+  uint32_t s1 = GETU32 (cipher +  4) ^ rk [1] ;
+  uint32_t s2 = GETU32 (cipher +  8) ^ rk [2] ;
+  uint32_t s3 = GETU32 (cipher + 12) ^ rk [3] ;
+  uint32_t t0, t1, t2, t3 ;
+  for (int r = 1 ; r < round ; r++)
+    {
+      rk += 4 ;
+      t0 = TD0 (s0 >> 24) ^ TD1 (s3 >> 16) ^ TD2 (s2 >> 8) ^ TD3 (s1) ^ rk [0] ;
+      t1 = TD0 (s1 >> 24) ^ TD1 (s0 >> 16) ^ TD2 (s3 >> 8) ^ TD3 (s2) ^ rk [1] ;
+      t2 = TD0 (s2 >> 24) ^ TD1 (s1 >> 16) ^ TD2 (s0 >> 8) ^ TD3 (s3) ^ rk [2] ;
+      t3 = TD0 (s3 >> 24) ^ TD1 (s2 >> 16) ^ TD2 (s1 >> 8) ^ TD3 (s0) ^ rk [3] ;
+      s0 = t0 ; s1 = t1 ; s2 = t2 ; s3 = t3 ;
+    }
+  rk += 4 ;
+  t0 = (SI (s0 >> 24) << 24) ^ (SI (s3 >> 16) << 16) ^ (SI (s2 >> 8) << 8) ^ SI (s1) ^ rk [0] ;
+  t1 = (SI (s1 >> 24) << 24) ^ (SI (s0 >> 16) << 16) ^ (SI (s3 >> 8) << 8) ^ SI (s2) ^ rk [1] ;
+  t2 = (SI (s2 >> 24) << 24) ^ (SI (s1 >> 16) << 16) ^ (SI (s0 >> 8) << 8) ^ SI (s3) ^ rk [2] ;
+  t3 = (SI (s3 >> 24) << 24) ^ (SI (s2 >> 16) << 16) ^ (SI (s1 >> 8) << 8) ^ SI (s0) ^ rk [3] ;
+  PUTU32 (plain     , t0) ;
+  PUTU32 (plain +  4, t1) ;
+  PUTU32 (plain +  8, t2) ;
+  PUTU32 (plain + 12, t3) ;
+  return SUCCESS ;
+}
+
+/******************************************************************************/
+
+byte AES32::cbc_encrypt (byte * plain, byte * cipher, int n_block, byte iv [N_BLOCK])
+{
+  while (n_block--)
+    {
+      for (byte i = 0 ; i < N_BLOCK ; i++)
+        iv [i] ^= plain [i] ;
+      if (encrypt (iv, iv) != SUCCESS)
+        return FAILURE ;
+      memcpy (cipher, iv, N_BLOCK) ;
+      plain  += N_BLOCK ;
+      cipher += N_BLOCK ;
+    }
+  return SUCCESS ;
+}
+
+/******************************************************************************/
+
+byte AES32::cbc_decrypt (byte * cipher, byte * plain, int n_block, byte iv [N_BLOCK])
+{
+  while (n_block--)
+    {
+      byte tmp [N_BLOCK] ;
+      memcpy (tmp, cipher, N_BLOCK) ;
+      if (decrypt (cipher, plain) != SUCCESS)
+        return FAILURE ;
+      for (byte i = 0 ; i < N_BLOCK ; i++)
+        plain [i] ^= iv [i] ;
+      memcpy (iv, tmp, N_BLOCK) ;
+      plain  += N_BLOCK ;
+      cipher += N_BLOCK ;
+    }
+  return SUCCESS ;
+}
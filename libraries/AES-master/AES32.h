@@ -0,0 +1,63 @@
+#ifndef __AES32_H__
+#define __AES32_H__
+
+#include "AES_config.h"
+
+/*
+ 32-bit T-table AES with the same calls as class AES for a precomputed key schedule
+ (set_key, encrypt, decrypt, cbc_encrypt, cbc_decrypt).
+
+ Only one 1kB table per direction is stored, the other three are byte rotations of it,
+ plus both s-boxes: 2.5kB of PROGMEM. Encryption and decryption keep their own key
+ schedule (equivalent inverse cipher) so set_key costs a bit more than AES::set_key,
+ call it once per key and reuse the object.
+
+ On x86 Linux builds compiled with -maes the block functions use AES-NI when the CPU
+ supports it, the schedules are shared with the table implementation.
+*/
+
+#if defined(AES_LINUX) && defined(__AES__)
+  #define AES32_NI
+  #include <wmmintrin.h>
+#endif
+
+#ifndef pgm_read_dword
+  #define pgm_read_dword(p) (*(p))
+#endif
+
+#define AES32_SCHEDULE_WORDS (4 * (N_MAX_ROUNDS + 1))
+
+class AES32
+{
+ public:
+
+  AES32 () ;
+
+  byte set_key (byte key [], int keylen) ;
+
+  void clean () ;  // delete key schedules after use
+
+  void copy_n_bytes (byte * d, byte * s, byte n) ;
+
+  byte encrypt (byte plain [N_BLOCK], byte cipher [N_BLOCK]) ;
+
+  byte cbc_encrypt (byte * plain, byte * cipher, int n_block, byte iv [N_BLOCK]) ;
+
+  byte decrypt (byte cipher [N_BLOCK], byte plain [N_BLOCK]) ;
+
+  byte cbc_decrypt (byte * cipher, byte * plain, int n_block, byte iv [N_BLOCK]) ;
+
+  bool accelerated () ;  // true when AES-NI is in use
+
+ private:
+  int round ;/**< number of rounds, 0 when there is no key */
+  uint32_t ek [AES32_SCHEDULE_WORDS] ;/**< encryption key schedule */
+  uint32_t dk [AES32_SCHEDULE_WORDS] ;/**< decryption key schedule, InvMixColumns applied */
+  #if defined(AES32_NI)
+  bool ni ;/**< the CPU has AES-NI */
+  byte ekb [4 * AES32_SCHEDULE_WORDS] ;/**< ek in memory byte order */
+  byte dkb [4 * AES32_SCHEDULE_WORDS] ;/**< dk in memory byte order */
+  #endif
+} ;
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ Known answer check (SP 800-38A F.2.5, CBC-AES256) and benchmark of both engines,
+ in the way the gateway uses them: AES-256-CBC on messages of a few hundred bytes.
+
+ "rekey" repeats set_key before every message (what AESM used to do through
+ do_aes_encrypt), "cached" expands the key once.
+*/
+#include <AES.h>
+#include <AES32.h>
+#include <time.h>
+
+static byte key [32] = {
+  0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+  0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4 } ;
+static byte iv0 [N_BLOCK] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f } ;
+static byte plain [64] = {
+  0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+  0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+  0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+  0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10 } ;
+static byte expected [64] = {
+  0xf5, 0x8c, 0x4c, 0x04, 0xd6, 0xe5, 0xf1, 0xba, 0x77, 0x9e, 0xab, 0xfb, 0x5f, 0x7b, 0xfb, 0xd6,
+  0x9c, 0xfc, 0x4e, 0x96, 0x7e, 0xdb, 0x80, 0x8d, 0x67, 0x9f, 0x77, 0x7b, 0xc6, 0x70, 0x2c, 0x7d,
+  0x39, 0xf2, 0x33, 0x69, 0xa9, 0xd9, 0xba, 0xcf, 0xa5, 0x30, 0xe2, 0x63, 0x04, 0x23, 0x14, 0x61,
+  0xb2, 0xeb, 0x05, 0xe2, 0xc3, 0x9b, 0xe9, 0xfc, 0xda, 0x6c, 0x19, 0x07, 0x8c, 0x6a, 0x9d, 0x1b } ;
+
+#define MESSAGE 256
+#define ROUNDS 100000
+
+static double now ()
+{
+  struct timespec ts ;
+  clock_gettime (CLOCK_MONOTONIC, &ts) ;
+  return ts.tv_sec + 1e-9 * ts.tv_nsec ;
+}
+
+template <typename T> int check (T & aes, const char * name)
+{
+  byte iv [N_BLOCK], cipher [64], back [64] ;
+  aes.set_key (key, 256) ;
+  memcpy (iv, iv0, N_BLOCK) ;
+  aes.cbc_encrypt (plain, cipher, 4, iv) ;
+  memcpy (iv, iv0, N_BLOCK) ;
+  aes.cbc_decrypt (cipher, back, 4, iv) ;
+  bool ok = !memcmp (cipher, expected, 64) && !memcmp (back, plain, 64) ;
+  printf ("%-6s CBC-AES256 known answer: %s\n", name, ok ? "OK" : "FAILED") ;
+  return ok ? 0 : 1 ;
+}
+
+template <typename T> void bench (T & aes, const char * name)
+{
+  byte message [MESSAGE], iv [N_BLOCK] ;
+  memset (message, 'x', MESSAGE) ;
+
+  double start = now () ;
+  for (int i = 0 ; i < ROUNDS ; i++)
+    {
+      memcpy (iv, iv0, N_BLOCK) ;
+      aes.set_key (key, 256) ;
+      aes.cbc_encrypt (message, message, MESSAGE / N_BLOCK, iv) ;
+    }
+  double rekey = now () - start ;
+
+  aes.set_key (key, 256) ;
+  start = now () ;
+  for (int i = 0 ; i < ROUNDS ; i++)
+    {
+      memcpy (iv, iv0, N_BLOCK) ;
+      aes.cbc_encrypt (message, message, MESSAGE / N_BLOCK, iv) ;
+    }
+  double cached = now () - start ;
+
+  start = now () ;
+  for (int i = 0 ; i < ROUNDS ; i++)
+    {
+      memcpy (iv, iv0, N_BLOCK) ;
+      aes.cbc_decrypt (message, message, MESSAGE / N_BLOCK, iv) ;
+    }
+  double decrypt = now () - start ;
+
+  printf ("%-6s %d byte messages: rekey %.2f us, cached %.2f us, decrypt %.2f us (%.1f MB/s)\n", name, MESSAGE,
+    1e6 * rekey / ROUNDS, 1e6 * cached / ROUNDS, 1e6 * decrypt / ROUNDS, MESSAGE * ROUNDS / cached / 1e6) ;
+}
+
+int main (int argc, char** argv)
+{
+  AES aes ;
+  AES32 aes32 ;
+  int failures = check (aes, "AES") + check (aes32, "AES32") ;
+  if (failures)
+    return 1 ;
+
+  bench (aes, "AES") ;
+  bench (aes32, aes32.accelerated () ? "AES-NI" : "AES32") ;
+  return 0 ;
+}
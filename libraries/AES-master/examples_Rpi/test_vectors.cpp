@@ -1,7 +1,12 @@
 #include <AES.h>
 #include "printf.h"
 
+#if defined(AES_ENGINE_32)
+#include <AES32.h>
+AES32 aes ;
+#else
 AES aes ;
+#endif
 
 byte key [2*N_BLOCK] ;
 byte plain [N_BLOCK] ;
@@ -31,7 +31,7 @@ void printf_begin(void)
   fdevopen( &serial_putc, 0 );
 }
 
-#elif defined (__arm__)
+#elif defined (__arm__) || defined (AES_LINUX)
 
 void printf_begin(void){}
 
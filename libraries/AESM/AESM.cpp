@@ -1,7 +1,7 @@
 #include <AESM.h>
 
 AESM::AESM(byte* key) {
-	memcpy(this->key, key, 32);
+	this->setKey(key);
 	// randomSeed(analogRead(0)); // RANDOM_REG32 ??
 /*
 	unsigned int b64Length = (4 * (32 + 2) / 3) + 1;
@@ -11,6 +11,11 @@ AESM::AESM(byte* key) {
 */
 }
 
+void AESM::setKey(byte* key) {
+	memcpy(this->key, key, 32);
+	this->aes.set_key(this->key, 256);
+}
+
 uint16_t AESM::calculateCipherLength(int plainLength) {
 	unsigned int padedLength = plainLength + N_BLOCK - plainLength % N_BLOCK;
 	unsigned int cipherLength = N_BLOCK + padedLength;
@@ -34,13 +39,19 @@ void AESM::encrypt(byte* plain, unsigned int plainLength, byte* cipher, unsigned
 	byte iv[N_BLOCK];
 	for (unsigned int i = 0; i < N_BLOCK; i++) iv[i] = random(256);
 	memcpy(cipher, iv, N_BLOCK);
-	this->aes.do_aes_encrypt(plain, plainLength, cipher + N_BLOCK, this->key, 256, iv);
+	// pkcs7 padding, then encrypt in place
+	byte* data = cipher + N_BLOCK;
+	unsigned int padedLength = cipherLength - N_BLOCK;
+	byte pad = padedLength - plainLength;
+	memmove(data, plain, plainLength); // plain may already be there, see encryptInPlace
+	memset(data + plainLength, pad, pad);
+	this->aes.cbc_encrypt(data, data, padedLength / N_BLOCK, iv);
 }
 
 void AESM::decrypt(byte* plain, byte* cipher, unsigned int cipherLength) {
 	byte iv[N_BLOCK];
 	memcpy(iv, cipher, N_BLOCK);
-	this->aes.do_aes_decrypt(cipher + N_BLOCK, cipherLength, plain, this->key, 256, iv);
+	this->aes.cbc_decrypt(cipher + N_BLOCK, plain, cipherLength / N_BLOCK, iv);
 }
 
 String AESM::encrypt(byte* plain, int plainLength) {
@@ -54,14 +65,39 @@ String AESM::encrypt(byte* plain, int plainLength) {
 	return String((char*)base64);
 }
 
+// buffer: N_BLOCK free bytes, plainLength bytes of plain data and N_BLOCK more for the padding
+// returns the length of iv + cipher, starting at buffer
+unsigned int AESM::encryptInPlace(byte* buffer, unsigned int plainLength) {
+	unsigned int cipherLength = AESM::calculateCipherLength(plainLength);
+	this->encrypt(buffer + N_BLOCK, plainLength, buffer, cipherLength);
+	return cipherLength;
+}
+
+// buffer: iv + cipher, the plain data is left at buffer + N_BLOCK
+// returns its length without the padding, 0 if the message is not valid
+unsigned int AESM::decryptInPlace(byte* buffer, unsigned int length) {
+	if (length < 2 * N_BLOCK || 0 != length % N_BLOCK) return 0;
+	unsigned int cipherLength = length - N_BLOCK;
+	this->decrypt(buffer + N_BLOCK, buffer, cipherLength);
+	byte pad = buffer[length - 1];
+	if (0 == pad || N_BLOCK < pad) return 0;
+	return cipherLength - pad;
+}
+
 String AESM::decrypt(byte* base64) {
-	unsigned int binary_length = Base64::decode_length(base64);
+	return this->decrypt(base64, strlen((char*) base64));
+}
+
+String AESM::decrypt(byte* base64, unsigned int length) {
+	unsigned int binary_length = Base64::decode_length(base64, length);
 	// this is because in this implementation we assume that the first 16 bytes of the message
 	// are the encryption iv followed by the encrypted data
-	if (2 * N_BLOCK <= binary_length) {
+	if (2 * N_BLOCK <= binary_length && 0 == binary_length % N_BLOCK) {
 		uint16_t cipherLength = binary_length - N_BLOCK;
 		unsigned char cipher[binary_length];
-		binary_length = Base64::decode(base64, cipher);
+		if ((int) binary_length != Base64::decode(base64, length, cipher, binary_length)) {
+			return "";
+		}
 		byte plain[cipherLength + 1];
 		plain[cipherLength] = '\0';
 		this->decrypt(plain, cipher, cipherLength);
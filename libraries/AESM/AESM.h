@@ -1,16 +1,29 @@
 #include <AES.h>
+#include <AES32.h>
 #include <Base64M.h>
 
 #ifndef __AESM__
 #define __AESM__
 
-// CBC implementation
+// 1: 32-bit T-table engine (2.5kB of flash), 0: byte oriented engine of AES-master
+#ifndef AESM_TTABLE
+#define AESM_TTABLE 1
+#endif
+
+#if AESM_TTABLE
+typedef AES32 AESEngine;
+#else
+typedef AES AESEngine;
+#endif
+
+// CBC implementation, the key schedule is expanded once per key
 class AESM {
 	public:
-	AES aes;
+	AESEngine aes;
 	byte key[32];
 
 	AESM(byte* key);
+	void setKey(byte* key);
 	static uint16_t calculateCipherLength(int plainLength);
 	static uint16_t calculatePlainLength(int cipherLength);
 	static void getRidOfPadding(byte* plain, unsigned int plainLength);
@@ -18,6 +31,10 @@ class AESM {
 	void decrypt(byte* plain, byte* cipher, unsigned int cipherLength);
 	String encrypt(byte* plain, int plainLength);
 	String decrypt(byte* base64);
+	String decrypt(byte* base64, unsigned int length);
+	// binary messages: iv followed by the cipher, both transformed inside the caller's buffer
+	unsigned int encryptInPlace(byte* buffer, unsigned int plainLength);
+	unsigned int decryptInPlace(byte* buffer, unsigned int length);
 };
 
 #endif
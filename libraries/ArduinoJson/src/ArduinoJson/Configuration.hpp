@@ -147,6 +147,13 @@
 #define ARDUINOJSON_ENABLE_INFINITY 0
 #endif
 
+// Format floats with the shortest digits that round trip (Grisu2) and parse
+// them with integer arithmetic (Eisel-Lemire), instead of the loops of
+// floating point multiplications that are slow without an FPU
+#ifndef ARDUINOJSON_FAST_FLOAT
+#define ARDUINOJSON_FAST_FLOAT 0
+#endif
+
 // Control the exponentiation threshold for big numbers
 // CAUTION: cannot be more that 1e9 !!!!
 #ifndef ARDUINOJSON_POSITIVE_EXPONENTIATION_THRESHOLD
@@ -171,3 +178,8 @@
 #ifndef ARDUINOJSON_TAB
 #define ARDUINOJSON_TAB "  "
 #endif
+
+// Default chunk size of BufferedWriter
+#ifndef ARDUINOJSON_WRITER_BUFFER_SIZE
+#define ARDUINOJSON_WRITER_BUFFER_SIZE 64
+#endif
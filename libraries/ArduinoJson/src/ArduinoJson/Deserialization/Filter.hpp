@@ -0,0 +1,106 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2019
+// MIT License
+
+#pragma once
+
+#include "../Document/JsonDocument.hpp"
+#include "../Variant/VariantRef.hpp"
+
+#include <string.h>  // for strcmp
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Describes which parts of the input deserializeJson() keeps, with a JSON
+// document shaped like the expected one:
+//   true           keep this value and everything below it
+//   {"key": ...}   keep only the listed members, "*" matches any other key
+//   [ ... ]        keep the array, its first element filters every element
+// Anything else is skipped without allocating slots or strings.
+class Filter {
+ public:
+  explicit Filter(VariantConstRef v) {
+    init(v._data);
+  }
+  explicit Filter(const JsonDocument &doc) {
+    init(doc.as<VariantConstRef>()._data);
+  }
+
+  bool allow() const {
+    return _all || _array || _object;
+  }
+
+  bool allowArray() const {
+    return _all || _array;
+  }
+
+  bool allowObject() const {
+    return _all || _object;
+  }
+
+  bool allowValue() const {
+    return _all;
+  }
+
+  // The deserializer asks once per member, so the key and the wildcard are
+  // looked up in a single pass over the slots
+  Filter operator[](const char *key) const {
+    if (_all) return *this;
+    const VariantData *wildcard = 0;
+    const CollectionData *object = _object ? _data->asObject() : 0;
+    for (const VariantSlot *slot = object ? object->head() : 0; slot;
+         slot = slot->next()) {
+      const char *name = slot->key();
+      if (name[0] == key[0] && !strcmp(name, key)) return Filter(slot->data());
+      if (name[0] == '*' && name[1] == '\0') wildcard = slot->data();
+    }
+    return Filter(wildcard);
+  }
+
+  Filter operator[](size_t) const {
+    if (_all) return *this;
+    return Filter(_array ? _data->getElement(0) : 0);
+  }
+
+ private:
+  explicit Filter(const VariantData *data) {
+    init(data);
+  }
+
+  void init(const VariantData *data) {
+    _data = data;
+    _all = data && data->isBoolean() && data->asBoolean();
+    _array = data && data->isArray();
+    _object = data && data->isObject();
+  }
+
+  const VariantData *_data;
+  bool _all;
+  bool _array;
+  bool _object;
+};
+
+// The filter of plain deserializeJson(), keeps everything
+struct AllowAllFilter {
+  bool allow() const {
+    return true;
+  }
+
+  bool allowArray() const {
+    return true;
+  }
+
+  bool allowObject() const {
+    return true;
+  }
+
+  bool allowValue() const {
+    return true;
+  }
+
+  template <typename TKey>
+  AllowAllFilter operator[](const TKey &) const {
+    return AllowAllFilter();
+  }
+};
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "../Deserialization/Filter.hpp"
 #include "../Deserialization/deserialize.hpp"
 #include "../Memory/MemoryPool.hpp"
 #include "../Numbers/parseNumber.hpp"
@@ -27,10 +28,16 @@ class JsonDeserializer {
         _stringStorage(stringStorage),
         _nestingLimit(nestingLimit),
         _loaded(false) {}
-  DeserializationError parse(VariantData &variant) {
-    DeserializationError err = parseVariant(variant);
+  template <typename TFilter>
+  DeserializationError parse(VariantData &variant, TFilter filter) {
+    DeserializationError err = skipSpacesAndComments();
+    if (err) return err;
+
+    // the variant stays null when the filter skips it, look at the input
+    bool enclosed = current() == '[' || current() == '{' || isQuote(current());
+    err = parseVariant(variant, filter);
 
-    if (!err && _current != 0 && !variant.isEnclosed()) {
+    if (!err && _current != 0 && !enclosed) {
       // We don't detect trailing characters earlier, so we need to check now
       err = DeserializationError::InvalidInput;
     }
@@ -60,27 +67,54 @@ class JsonDeserializer {
     return true;
   }
 
-  DeserializationError parseVariant(VariantData &variant) {
+  template <typename TFilter>
+  DeserializationError parseVariant(VariantData &variant, TFilter filter) {
     DeserializationError err = skipSpacesAndComments();
     if (err) return err;
 
     switch (current()) {
       case '[':
-        return parseArray(variant.toArray());
+        if (filter.allowArray()) return parseArray(variant.toArray(), filter);
+        return skipArray();
 
       case '{':
-        return parseObject(variant.toObject());
+        if (filter.allowObject())
+          return parseObject(variant.toObject(), filter);
+        return skipObject();
 
       case '\"':
       case '\'':
-        return parseStringValue(variant);
+        if (filter.allowValue()) return parseStringValue(variant);
+        return skipQuotedString();
 
       default:
-        return parseNumericValue(variant);
+        if (filter.allowValue()) return parseNumericValue(variant);
+        return skipNumericValue();
     }
   }
 
-  DeserializationError parseArray(CollectionData &array) {
+  DeserializationError skipVariant() {
+    DeserializationError err = skipSpacesAndComments();
+    if (err) return err;
+
+    switch (current()) {
+      case '[':
+        return skipArray();
+
+      case '{':
+        return skipObject();
+
+      case '\"':
+      case '\'':
+        return skipQuotedString();
+
+      default:
+        return skipNumericValue();
+    }
+  }
+
+  template <typename TFilter>
+  DeserializationError parseArray(CollectionData &array, TFilter filter) {
     if (_nestingLimit == 0) return DeserializationError::TooDeep;
 
     // Check opening braket
@@ -93,15 +127,21 @@ class JsonDeserializer {
     // Empty array?
     if (eat(']')) return DeserializationError::Ok;
 
+    TFilter elementFilter = filter[size_t(0)];
+
     // Read each value
     for (;;) {
-      // Allocate slot in array
-      VariantData *value = array.add(_pool);
-      if (!value) return DeserializationError::NoMemory;
-
-      // 1 - Parse value
       _nestingLimit--;
-      err = parseVariant(*value);
+      if (elementFilter.allow()) {
+        // Allocate slot in array
+        VariantData *value = array.add(_pool);
+        if (!value) return DeserializationError::NoMemory;
+
+        // 1 - Parse value
+        err = parseVariant(*value, elementFilter);
+      } else {
+        err = skipVariant();
+      }
       _nestingLimit++;
       if (err) return err;
 
@@ -115,7 +155,32 @@ class JsonDeserializer {
     }
   }
 
-  DeserializationError parseObject(CollectionData &object) {
+  DeserializationError skipArray() {
+    if (_nestingLimit == 0) return DeserializationError::TooDeep;
+
+    if (!eat('[')) return DeserializationError::InvalidInput;
+
+    DeserializationError err = skipSpacesAndComments();
+    if (err) return err;
+
+    if (eat(']')) return DeserializationError::Ok;
+
+    for (;;) {
+      _nestingLimit--;
+      err = skipVariant();
+      _nestingLimit++;
+      if (err) return err;
+
+      err = skipSpacesAndComments();
+      if (err) return err;
+
+      if (eat(']')) return DeserializationError::Ok;
+      if (!eat(',')) return DeserializationError::InvalidInput;
+    }
+  }
+
+  template <typename TFilter>
+  DeserializationError parseObject(CollectionData &object, TFilter filter) {
     if (_nestingLimit == 0) return DeserializationError::TooDeep;
 
     // Check opening brace
@@ -130,24 +195,32 @@ class JsonDeserializer {
 
     // Read each key value pair
     for (;;) {
-      // Allocate slot in object
-      VariantSlot *slot = object.addSlot(_pool);
-      if (!slot) return DeserializationError::NoMemory;
-
       // Parse key
       const char *key;
       err = parseKey(key);
       if (err) return err;
-      slot->setOwnedKey(make_not_null(key));
 
       // Skip spaces
       err = skipSpacesAndComments();
       if (err) return err;  // Colon
       if (!eat(':')) return DeserializationError::InvalidInput;
 
-      // Parse value
+      TFilter memberFilter = filter[key];
+
       _nestingLimit--;
-      err = parseVariant(*slot->data());
+      if (memberFilter.allow()) {
+        // Allocate slot in object
+        VariantSlot *slot = object.addSlot(_pool);
+        if (!slot) return DeserializationError::NoMemory;
+        slot->setOwnedKey(make_not_null(key));
+
+        // Parse value
+        err = parseVariant(*slot->data(), memberFilter);
+      } else {
+        // Nobody wants it: no slot, and the key goes back to the pool
+        _stringStorage.reclaim(key);
+        err = skipVariant();
+      }
       _nestingLimit++;
       if (err) return err;
 
@@ -165,6 +238,48 @@ class JsonDeserializer {
     }
   }
 
+  DeserializationError skipObject() {
+    if (_nestingLimit == 0) return DeserializationError::TooDeep;
+
+    if (!eat('{')) return DeserializationError::InvalidInput;
+
+    DeserializationError err = skipSpacesAndComments();
+    if (err) return err;
+
+    if (eat('}')) return DeserializationError::Ok;
+
+    for (;;) {
+      err = skipKey();
+      if (err) return err;
+
+      err = skipSpacesAndComments();
+      if (err) return err;
+      if (!eat(':')) return DeserializationError::InvalidInput;
+
+      _nestingLimit--;
+      err = skipVariant();
+      _nestingLimit++;
+      if (err) return err;
+
+      err = skipSpacesAndComments();
+      if (err) return err;
+
+      if (eat('}')) return DeserializationError::Ok;
+      if (!eat(',')) return DeserializationError::InvalidInput;
+
+      err = skipSpacesAndComments();
+      if (err) return err;
+    }
+  }
+
+  DeserializationError skipKey() {
+    if (isQuote(current())) {
+      return skipQuotedString();
+    } else {
+      return skipNonQuotedString();
+    }
+  }
+
   DeserializationError parseKey(const char *&key) {
     if (isQuote(current())) {
       return parseQuotedString(key);
@@ -222,6 +337,24 @@ class JsonDeserializer {
     return DeserializationError::Ok;
   }
 
+  DeserializationError skipQuotedString() {
+    const char stopChar = current();
+
+    move();
+    for (;;) {
+      char c = current();
+      move();
+      if (c == stopChar) break;
+      if (c == '\0') return DeserializationError::IncompleteInput;
+      if (c == '\\') {
+        if (current() == '\0') return DeserializationError::IncompleteInput;
+        move();
+      }
+    }
+
+    return DeserializationError::Ok;
+  }
+
   DeserializationError parseNonQuotedString(const char *&result) {
     StringBuilder builder = _stringStorage.startString();
 
@@ -243,6 +376,23 @@ class JsonDeserializer {
     return DeserializationError::Ok;
   }
 
+  DeserializationError skipNonQuotedString() {
+    char c = current();
+    if (c == '\0') return DeserializationError::IncompleteInput;
+    if (!canBeInNonQuotedString(c)) return DeserializationError::InvalidInput;
+
+    while (canBeInNonQuotedString(current())) move();
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError skipNumericValue() {
+    char c = current();
+    if (!canBeInNonQuotedString(c)) return DeserializationError::InvalidInput;
+
+    while (canBeInNonQuotedString(current())) move();
+    return DeserializationError::Ok;
+  }
+
   DeserializationError parseNumericValue(VariantData &result) {
     char buffer[64];
     uint8_t n = 0;
@@ -394,27 +544,61 @@ template <typename TInput>
 DeserializationError deserializeJson(
     JsonDocument &doc, const TInput &input,
     NestingLimit nestingLimit = NestingLimit()) {
-  return deserialize<JsonDeserializer>(doc, input, nestingLimit);
+  return deserialize<JsonDeserializer>(doc, input, nestingLimit,
+                                       AllowAllFilter());
 }
 
 template <typename TInput>
 DeserializationError deserializeJson(
     JsonDocument &doc, TInput *input,
     NestingLimit nestingLimit = NestingLimit()) {
-  return deserialize<JsonDeserializer>(doc, input, nestingLimit);
+  return deserialize<JsonDeserializer>(doc, input, nestingLimit,
+                                       AllowAllFilter());
 }
 
 template <typename TInput>
 DeserializationError deserializeJson(
     JsonDocument &doc, TInput *input, size_t inputSize,
     NestingLimit nestingLimit = NestingLimit()) {
-  return deserialize<JsonDeserializer>(doc, input, inputSize, nestingLimit);
+  return deserialize<JsonDeserializer>(doc, input, inputSize, nestingLimit,
+                                       AllowAllFilter());
 }
 
 template <typename TInput>
 DeserializationError deserializeJson(
     JsonDocument &doc, TInput &input,
     NestingLimit nestingLimit = NestingLimit()) {
-  return deserialize<JsonDeserializer>(doc, input, nestingLimit);
+  return deserialize<JsonDeserializer>(doc, input, nestingLimit,
+                                       AllowAllFilter());
+}
+
+// deserializeJson(doc, input, DeserializationOption::Filter(filter))
+template <typename TInput>
+DeserializationError deserializeJson(
+    JsonDocument &doc, const TInput &input, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<JsonDeserializer>(doc, input, nestingLimit, filter);
+}
+
+template <typename TInput>
+DeserializationError deserializeJson(
+    JsonDocument &doc, TInput *input, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<JsonDeserializer>(doc, input, nestingLimit, filter);
+}
+
+template <typename TInput>
+DeserializationError deserializeJson(
+    JsonDocument &doc, TInput *input, size_t inputSize, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<JsonDeserializer>(doc, input, inputSize, nestingLimit,
+                                       filter);
+}
+
+template <typename TInput>
+DeserializationError deserializeJson(
+    JsonDocument &doc, TInput &input, Filter filter,
+    NestingLimit nestingLimit = NestingLimit()) {
+  return deserialize<JsonDeserializer>(doc, input, nestingLimit, filter);
 }
 }  // namespace ARDUINOJSON_NAMESPACE
@@ -8,6 +8,7 @@
 #include <string.h>  // for strlen
 #include "../Numbers/FloatParts.hpp"
 #include "../Numbers/Integer.hpp"
+#include "../Numbers/ShortestFloat.hpp"
 #include "../Polyfills/attributes.hpp"
 #include "EscapeSequence.hpp"
 
@@ -70,6 +71,14 @@ class TextFormatter {
     }
 #endif
 
+#if ARDUINOJSON_FAST_FLOAT
+    if (value == 0) return writeRaw('0');
+
+    ShortestFloat<T> shortest(value);
+    bool scientific = value >= ARDUINOJSON_POSITIVE_EXPONENTIATION_THRESHOLD ||
+                      value <= ARDUINOJSON_NEGATIVE_EXPONENTIATION_THRESHOLD;
+    writeShortest(shortest, scientific);
+#else
     FloatParts<T> parts(value);
 
     writePositiveInteger(parts.integral);
@@ -84,8 +93,47 @@ class TextFormatter {
       writeRaw('e');
       writePositiveInteger(parts.exponent);
     }
+#endif
   }
 
+#if ARDUINOJSON_FAST_FLOAT
+  template <typename T>
+  void writeShortest(const ShortestFloat<T> &shortest, bool scientific) {
+    const char *digits = shortest.digits;
+    int16_t length = shortest.length;
+    int16_t point = int16_t(length + shortest.exponent);  // digits before '.'
+
+    if (scientific) {
+      writeRaw(digits, digits + 1);
+      if (length > 1) {
+        writeRaw('.');
+        writeRaw(digits + 1, digits + length);
+      }
+
+      int16_t exponent = int16_t(point - 1);
+      if (exponent < 0) {
+        writeRaw("e-");
+        writePositiveInteger(-exponent);
+      }
+      if (exponent > 0) {
+        writeRaw('e');
+        writePositiveInteger(exponent);
+      }
+    } else if (point <= 0) {
+      writeRaw("0.");
+      for (; point < 0; point++) writeRaw('0');
+      writeRaw(digits, digits + length);
+    } else if (point < length) {
+      writeRaw(digits, digits + point);
+      writeRaw('.');
+      writeRaw(digits + point, digits + length);
+    } else {
+      writeRaw(digits, digits + length);
+      for (; point > length; point--) writeRaw('0');
+    }
+  }
+#endif
+
   void writeNegativeInteger(UInt value) {
     writeRaw('-');
     writePositiveInteger(value);
@@ -67,6 +67,12 @@ class MemoryPool {
     return s;
   }
 
+  // Gives back the last string, when the deserializer finds out that the
+  // filter doesn't want it
+  void reclaimLastString(const char* s) {
+    _left = const_cast<char*>(s);
+  }
+
   void freezeString(StringSlot& s, size_t newSize) {
     _left -= (s.size - newSize);
     s.size = newSize;
@@ -19,10 +19,13 @@
                       ARDUINOJSON_CONCAT4(E, F, G, H))
 #define ARDUINOJSON_CONCAT10(A, B, C, D, E, F, G, H, I, J) \
   ARDUINOJSON_CONCAT8(A, B, C, D, E, F, G, ARDUINOJSON_CONCAT3(H, I, J))
+#define ARDUINOJSON_CONCAT11(A, B, C, D, E, F, G, H, I, J, K) \
+  ARDUINOJSON_CONCAT8(A, B, C, D, E, F, G, ARDUINOJSON_CONCAT4(H, I, J, K))
 
 #define ARDUINOJSON_NAMESPACE                                            \
-  ARDUINOJSON_CONCAT10(                                                  \
+  ARDUINOJSON_CONCAT11(                                                  \
       ArduinoJson, ARDUINOJSON_VERSION_MAJOR, ARDUINOJSON_VERSION_MINOR, \
       ARDUINOJSON_VERSION_REVISION, _, ARDUINOJSON_USE_LONG_LONG,        \
       ARDUINOJSON_USE_DOUBLE, ARDUINOJSON_DECODE_UNICODE,                \
-      ARDUINOJSON_ENABLE_NAN, ARDUINOJSON_ENABLE_INFINITY)
+      ARDUINOJSON_ENABLE_NAN, ARDUINOJSON_ENABLE_INFINITY,               \
+      ARDUINOJSON_FAST_FLOAT)
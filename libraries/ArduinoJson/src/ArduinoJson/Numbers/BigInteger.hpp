@@ -0,0 +1,79 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2019
+// MIT License
+
+#pragma once
+
+#include <stdint.h>
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Just enough of an arbitrary precision integer for makeFloat() to settle the
+// numbers that fall on a rounding boundary: 64 bits * 5^348 or * 2^n of the
+// same magnitude
+class BigInteger {
+ public:
+  explicit BigInteger(uint64_t value) : _size(0) {
+    while (value) {
+      _limbs[_size++] = uint32_t(value);
+      value >>= 32;
+    }
+  }
+
+  void multiply(uint32_t factor) {
+    uint64_t carry = 0;
+    for (uint8_t i = 0; i < _size; i++) {
+      uint64_t product = uint64_t(_limbs[i]) * factor + carry;
+      _limbs[i] = uint32_t(product);
+      carry = product >> 32;
+    }
+    if (carry) _limbs[_size++] = uint32_t(carry);
+  }
+
+  void multiplyByPowerOfFive(int n) {
+    static const uint32_t powers[] = {1,       5,        25,        125,
+                                      625,     3125,     15625,     78125,
+                                      390625,  1953125,  9765625,   48828125,
+                                      244140625};
+    while (n >= 13) {
+      multiply(1220703125);  // 5^13
+      n -= 13;
+    }
+    if (n) multiply(powers[n]);
+  }
+
+  void shiftLeft(int n) {
+    if (_size == 0) return;
+    int words = n / 32;
+    int bits = n % 32;
+    if (bits) {
+      uint32_t carry = 0;
+      for (uint8_t i = 0; i < _size; i++) {
+        uint32_t limb = _limbs[i];
+        _limbs[i] = (limb << bits) | carry;
+        carry = limb >> (32 - bits);
+      }
+      if (carry) _limbs[_size++] = carry;
+    }
+    if (words) {
+      for (int i = _size - 1; i >= 0; i--) _limbs[i + words] = _limbs[i];
+      for (int i = 0; i < words; i++) _limbs[i] = 0;
+      _size = uint8_t(_size + words);
+    }
+  }
+
+  // -1, 0 or 1
+  int compare(const BigInteger& other) const {
+    if (_size != other._size) return _size < other._size ? -1 : 1;
+    for (int i = _size - 1; i >= 0; i--) {
+      if (_limbs[i] != other._limbs[i])
+        return _limbs[i] < other._limbs[i] ? -1 : 1;
+    }
+    return 0;
+  }
+
+ private:
+  uint32_t _limbs[28];
+  uint8_t _size;
+};
+}  // namespace ARDUINOJSON_NAMESPACE
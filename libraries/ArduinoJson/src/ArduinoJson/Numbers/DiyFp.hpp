@@ -0,0 +1,179 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2019
+// MIT License
+
+#pragma once
+
+#include <stdint.h>
+#include "../Polyfills/pgmspace.hpp"
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// A floating point number made of integers: f * 2^e
+// Only uses integer arithmetic, for ShortestFloat and makeFloat()
+struct DiyFp {
+  uint64_t f;
+  int16_t e;
+
+  DiyFp() : f(0), e(0) {}
+  DiyFp(uint64_t f_, int16_t e_) : f(f_), e(e_) {}
+
+  // x - y, same exponent and x.f >= y.f
+  static DiyFp sub(const DiyFp& x, const DiyFp& y) {
+    return DiyFp(x.f - y.f, x.e);
+  }
+
+  // x * y, the 64 upper bits of the product, rounded
+  static DiyFp mul(const DiyFp& x, const DiyFp& y) {
+    uint64_t hi, lo;
+    mul128(x.f, y.f, hi, lo);
+    hi += lo >> 63;
+    return DiyFp(hi, int16_t(x.e + y.e + 64));
+  }
+
+  // the full 128 bits of a * b
+  static void mul128(uint64_t a, uint64_t b, uint64_t& hi, uint64_t& lo) {
+    uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+    uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+
+    uint64_t p0 = a_lo * b_lo;
+    uint64_t p1 = a_lo * b_hi;
+    uint64_t p2 = a_hi * b_lo;
+    uint64_t p3 = a_hi * b_hi;
+
+    uint64_t middle = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF);
+    lo = (middle << 32) | (p0 & 0xFFFFFFFF);
+    hi = p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32);
+  }
+
+  // shifts f until its highest bit is set, f must not be 0
+  static DiyFp normalize(DiyFp x) {
+    if (!(x.f >> 32)) x = DiyFp(x.f << 32, int16_t(x.e - 32));
+    if (!(x.f >> 48)) x = DiyFp(x.f << 16, int16_t(x.e - 16));
+    if (!(x.f >> 56)) x = DiyFp(x.f << 8, int16_t(x.e - 8));
+    if (!(x.f >> 60)) x = DiyFp(x.f << 4, int16_t(x.e - 4));
+    if (!(x.f >> 62)) x = DiyFp(x.f << 2, int16_t(x.e - 2));
+    if (!(x.f >> 63)) x = DiyFp(x.f << 1, int16_t(x.e - 1));
+    return x;
+  }
+
+  static DiyFp normalizeTo(const DiyFp& x, int16_t e) {
+    return DiyFp(x.f << (x.e - e), e);
+  }
+};
+
+// 10^k, for k = -348, -340 ... 324, normalized and rounded to 64 bits
+struct CachedPowers {
+  static const int16_t minExponent = -348;
+  static const int16_t maxExponent = 324;
+  static const int16_t step = 8;
+
+  static DiyFp get(uint8_t index) {
+    static const uint32_t significands[] ARDUINOJSON_PROGMEM = {
+        0xFA8FD5A0, 0x081C0288,  // 1e-348
+        0xBAAEE17F, 0xA23EBF76,  // 1e-340
+        0x8B16FB20, 0x3055AC76,  // 1e-332
+        0xCF42894A, 0x5DCE35EA,  // 1e-324
+        0x9A6BB0AA, 0x55653B2D,  // 1e-316
+        0xE61ACF03, 0x3D1A45DF,  // 1e-308
+        0xAB70FE17, 0xC79AC6CA,  // 1e-300
+        0xFF77B1FC, 0xBEBCDC4F,  // 1e-292
+        0xBE5691EF, 0x416BD60C,  // 1e-284
+        0x8DD01FAD, 0x907FFC3C,  // 1e-276
+        0xD3515C28, 0x31559A83,  // 1e-268
+        0x9D71AC8F, 0xADA6C9B5,  // 1e-260
+        0xEA9C2277, 0x23EE8BCB,  // 1e-252
+        0xAECC4991, 0x4078536D,  // 1e-244
+        0x823C1279, 0x5DB6CE57,  // 1e-236
+        0xC2109436, 0x4DFB5637,  // 1e-228
+        0x9096EA6F, 0x3848984F,  // 1e-220
+        0xD77485CB, 0x25823AC7,  // 1e-212
+        0xA086CFCD, 0x97BF97F4,  // 1e-204
+        0xEF340A98, 0x172AACE5,  // 1e-196
+        0xB23867FB, 0x2A35B28E,  // 1e-188
+        0x84C8D4DF, 0xD2C63F3B,  // 1e-180
+        0xC5DD4427, 0x1AD3CDBA,  // 1e-172
+        0x936B9FCE, 0xBB25C996,  // 1e-164
+        0xDBAC6C24, 0x7D62A584,  // 1e-156
+        0xA3AB6658, 0x0D5FDAF6,  // 1e-148
+        0xF3E2F893, 0xDEC3F126,  // 1e-140
+        0xB5B5ADA8, 0xAAFF80B8,  // 1e-132
+        0x87625F05, 0x6C7C4A8B,  // 1e-124
+        0xC9BCFF60, 0x34C13053,  // 1e-116
+        0x964E858C, 0x91BA2655,  // 1e-108
+        0xDFF97724, 0x70297EBD,  // 1e-100
+        0xA6DFBD9F, 0xB8E5B88F,  // 1e-92
+        0xF8A95FCF, 0x88747D94,  // 1e-84
+        0xB9447093, 0x8FA89BCF,  // 1e-76
+        0x8A08F0F8, 0xBF0F156B,  // 1e-68
+        0xCDB02555, 0x653131B6,  // 1e-60
+        0x993FE2C6, 0xD07B7FAC,  // 1e-52
+        0xE45C10C4, 0x2A2B3B06,  // 1e-44
+        0xAA242499, 0x697392D3,  // 1e-36
+        0xFD87B5F2, 0x8300CA0E,  // 1e-28
+        0xBCE50864, 0x92111AEB,  // 1e-20
+        0x8CBCCC09, 0x6F5088CC,  // 1e-12
+        0xD1B71758, 0xE219652C,  // 1e-4
+        0x9C400000, 0x00000000,  // 1e4
+        0xE8D4A510, 0x00000000,  // 1e12
+        0xAD78EBC5, 0xAC620000,  // 1e20
+        0x813F3978, 0xF8940984,  // 1e28
+        0xC097CE7B, 0xC90715B3,  // 1e36
+        0x8F7E32CE, 0x7BEA5C70,  // 1e44
+        0xD5D238A4, 0xABE98068,  // 1e52
+        0x9F4F2726, 0x179A2245,  // 1e60
+        0xED63A231, 0xD4C4FB27,  // 1e68
+        0xB0DE6538, 0x8CC8ADA8,  // 1e76
+        0x83C7088E, 0x1AAB65DB,  // 1e84
+        0xC45D1DF9, 0x42711D9A,  // 1e92
+        0x924D692C, 0xA61BE758,  // 1e100
+        0xDA01EE64, 0x1A708DEA,  // 1e108
+        0xA26DA399, 0x9AEF774A,  // 1e116
+        0xF209787B, 0xB47D6B85,  // 1e124
+        0xB454E4A1, 0x79DD1877,  // 1e132
+        0x865B8692, 0x5B9BC5C2,  // 1e140
+        0xC83553C5, 0xC8965D3D,  // 1e148
+        0x952AB45C, 0xFA97A0B3,  // 1e156
+        0xDE469FBD, 0x99A05FE3,  // 1e164
+        0xA59BC234, 0xDB398C25,  // 1e172
+        0xF6C69A72, 0xA3989F5C,  // 1e180
+        0xB7DCBF53, 0x54E9BECE,  // 1e188
+        0x88FCF317, 0xF22241E2,  // 1e196
+        0xCC20CE9B, 0xD35C78A5,  // 1e204
+        0x98165AF3, 0x7B2153DF,  // 1e212
+        0xE2A0B5DC, 0x971F303A,  // 1e220
+        0xA8D9D153, 0x5CE3B396,  // 1e228
+        0xFB9B7CD9, 0xA4A7443C,  // 1e236
+        0xBB764C4C, 0xA7A44410,  // 1e244
+        0x8BAB8EEF, 0xB6409C1A,  // 1e252
+        0xD01FEF10, 0xA657842C,  // 1e260
+        0x9B10A4E5, 0xE9913129,  // 1e268
+        0xE7109BFB, 0xA19C0C9D,  // 1e276
+        0xAC2820D9, 0x623BF429,  // 1e284
+        0x80444B5E, 0x7AA7CF85,  // 1e292
+        0xBF21E440, 0x03ACDD2D,  // 1e300
+        0x8E679C2F, 0x5E44FF8F,  // 1e308
+        0xD433179D, 0x9C8CB841,  // 1e316
+        0x9E19DB92, 0xB4E31BA9  // 1e324
+    };
+    static const int16_t exponents[] ARDUINOJSON_PROGMEM = {
+        -1220, -1193, -1166, -1140, -1113, -1087,
+        -1060, -1034, -1007, -980, -954, -927, -901, -874, -847, -821,
+        -794, -768, -741, -715, -688, -661, -635, -608, -582, -555,
+        -529, -502, -475, -449, -422, -396, -369, -343, -316, -289,
+        -263, -236, -210, -183, -157, -130, -103, -77, -50, -24,
+        3, 30, 56, 83, 109, 136, 162, 189, 216, 242,
+        269, 295, 322, 348, 375, 402, 428, 455, 481, 508,
+        534, 561, 588, 614, 641, 667, 694, 720, 747, 774,
+        800, 827, 853, 880, 907, 933, 960, 986, 1013
+    };
+    uint64_t msb = readFlash(significands + 2 * index);
+    uint64_t lsb = readFlash(significands + 2 * index + 1);
+    return DiyFp((msb << 32) | lsb, readFlash(exponents + index));
+  }
+
+  static int16_t decimalExponent(uint8_t index) {
+    return int16_t(minExponent + step * index);
+  }
+};
+}  // namespace ARDUINOJSON_NAMESPACE
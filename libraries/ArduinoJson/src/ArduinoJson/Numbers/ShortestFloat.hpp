@@ -0,0 +1,153 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2019
+// MIT License
+
+#pragma once
+
+#include "../Polyfills/alias_cast.hpp"
+#include "./DiyFp.hpp"
+#include "./FloatTraits.hpp"
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// The decimal digits of a positive finite float, as few as possible for the
+// number to parse back to the same value: value = digits * 10^exponent
+// Grisu2 (Florian Loitsch, 2010): integer arithmetic only, the result always
+// round trips and is the shortest one for all but a few numbers, which get
+// one more digit.
+template <typename TFloat>
+struct ShortestFloat {
+  char digits[18];
+  int8_t length;
+  int16_t exponent;
+
+  explicit ShortestFloat(TFloat value) : length(0), exponent(0) {
+    DiyFp minus, v, plus;
+    boundaries(value, minus, v, plus);
+    grisu2(minus, v, plus);
+  }
+
+ private:
+  typedef FloatTraits<TFloat> traits;
+  typedef typename traits::mantissa_type bits_type;
+
+  // the value and the middles between it and its neighbours, all with the
+  // exponent of plus
+  static void boundaries(TFloat value, DiyFp &minus, DiyFp &v, DiyFp &plus) {
+    const int mantissaBits = traits::mantissa_bits;
+    const int exponentBits = int(sizeof(TFloat) * 8) - 1 - mantissaBits;
+    const int bias = (1 << (exponentBits - 1)) - 1 + mantissaBits;
+    const uint64_t hiddenBit = uint64_t(1) << mantissaBits;
+
+    bits_type bits = alias_cast<bits_type>(value);
+    uint64_t fraction = uint64_t(bits) & (hiddenBit - 1);
+    int biased = int(bits >> mantissaBits);
+
+    if (biased == 0)
+      v = DiyFp(fraction, int16_t(1 - bias));
+    else
+      v = DiyFp(fraction + hiddenBit, int16_t(biased - bias));
+
+    // the gap below is half as wide at a power of two
+    bool closerBelow = fraction == 0 && biased > 1;
+
+    plus = DiyFp::normalize(DiyFp(2 * v.f + 1, int16_t(v.e - 1)));
+    if (closerBelow)
+      minus = DiyFp(4 * v.f - 1, int16_t(v.e - 2));
+    else
+      minus = DiyFp(2 * v.f - 1, int16_t(v.e - 1));
+    minus = DiyFp::normalizeTo(minus, plus.e);
+    v = DiyFp::normalize(v);
+  }
+
+  void grisu2(const DiyFp &minus, const DiyFp &v, const DiyFp &plus) {
+    // scale by a cached power of ten so that the exponent of plus lands in
+    // [-60, -32], the integral part then fits in 32 bits
+    const int alpha = -60;
+    int f = alpha - plus.e - 1;
+    int k = (f * 78913) / (1 << 18) + (f > 0);
+    uint8_t index = uint8_t(
+        (k - CachedPowers::minExponent + CachedPowers::step - 1) /
+        CachedPowers::step);
+    DiyFp c = CachedPowers::get(index);
+
+    DiyFp w = DiyFp::mul(v, c);
+    DiyFp low = DiyFp::mul(minus, c);
+    DiyFp high = DiyFp::mul(plus, c);
+
+    // one unit of error on each side of the scaled boundaries
+    low.f++;
+    high.f--;
+
+    exponent = int16_t(-CachedPowers::decimalExponent(index));
+    generate(low, w, high);
+  }
+
+  void generate(const DiyFp &low, const DiyFp &w, const DiyFp &high) {
+    uint64_t delta = DiyFp::sub(high, low).f;
+    uint64_t dist = DiyFp::sub(high, w).f;
+
+    const int shift = -high.e;
+    const uint64_t one = uint64_t(1) << shift;
+
+    uint32_t p1 = uint32_t(high.f >> shift);
+    uint64_t p2 = high.f & (one - 1);
+
+    // integral part, from the most significant digit
+    uint32_t pow10;
+    int n = largestPowerOfTen(p1, pow10);
+    while (n > 0) {
+      digits[length++] = char('0' + p1 / pow10);
+      p1 %= pow10;
+      n--;
+
+      uint64_t rest = (uint64_t(p1) << shift) + p2;
+      if (rest <= delta) {
+        exponent = int16_t(exponent + n);
+        roundLastDigit(dist, delta, rest, uint64_t(pow10) << shift);
+        return;
+      }
+      pow10 /= 10;
+    }
+
+    // fractional part, until the digits are inside the boundaries
+    int m = 0;
+    for (;;) {
+      p2 *= 10;
+      digits[length++] = char('0' + (p2 >> shift));
+      p2 &= one - 1;
+      m++;
+
+      delta *= 10;
+      dist *= 10;
+      if (p2 <= delta) break;
+    }
+    exponent = int16_t(exponent - m);
+    roundLastDigit(dist, delta, p2, one);
+  }
+
+  // moves the last digit towards w while it stays inside the boundaries
+  void roundLastDigit(uint64_t dist, uint64_t delta, uint64_t rest,
+                      uint64_t ten) {
+    while (rest < dist && delta - rest >= ten &&
+           (rest + ten < dist || dist - rest > rest + ten - dist)) {
+      digits[length - 1]--;
+      rest += ten;
+    }
+  }
+
+  static int largestPowerOfTen(uint32_t n, uint32_t &pow10) {
+    if (n >= 1000000000) {
+      pow10 = 1000000000;
+      return 10;
+    }
+    int count = 9;
+    pow10 = 100000000;
+    while (n < pow10 && count > 1) {
+      pow10 /= 10;
+      count--;
+    }
+    return count;
+  }
+};
+}  // namespace ARDUINOJSON_NAMESPACE
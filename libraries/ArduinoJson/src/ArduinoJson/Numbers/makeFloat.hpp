@@ -0,0 +1,110 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2019
+// MIT License
+
+#pragma once
+
+#include "../Polyfills/alias_cast.hpp"
+#include "./BigInteger.hpp"
+#include "./DiyFp.hpp"
+#include "./FloatTraits.hpp"
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// sign of mantissa * 10^exponent - (2 * bits + 1) * 2^(binaryExponent - 1)
+inline int compareToHalfway(uint64_t mantissa, int exponent, uint64_t bits,
+                            int binaryExponent) {
+  BigInteger decimal(mantissa);
+  BigInteger halfway(2 * bits + 1);
+  if (exponent >= 0)
+    decimal.multiplyByPowerOfFive(exponent);
+  else
+    halfway.multiplyByPowerOfFive(-exponent);
+
+  // what remains of 10^exponent is 2^exponent
+  int shift = binaryExponent - 1 - exponent;
+  if (shift >= 0)
+    halfway.shiftLeft(shift);
+  else
+    decimal.shiftLeft(-shift);
+  return decimal.compare(halfway);
+}
+
+inline DiyFp smallPowerOfTen(int n) {
+  static const uint32_t powers[] = {1,      10,      100,      1000,
+                                    10000,  100000,  1000000,  10000000};
+  return DiyFp::normalize(DiyFp(powers[n], 0));
+}
+
+// The float nearest to mantissa * 10^exponent, with integer arithmetic only
+// (Eisel-Lemire, with the 64-bit powers of ShortestFloat instead of a 128-bit
+// table, and an exact comparison for the few numbers close to a tie).
+// Returns false for underflows, overflows and exponents outside the cached
+// powers; the caller falls back to FloatTraits::make_float().
+template <typename TFloat>
+inline bool makeFloat(uint64_t mantissa, int exponent, TFloat &result) {
+  typedef FloatTraits<TFloat> traits;
+  typedef typename traits::mantissa_type bits_type;
+  const int precision = traits::mantissa_bits + 1;
+  const int exponentBits = int(sizeof(TFloat) * 8) - precision;
+  const int bias = (1 << (exponentBits - 1)) - 1;
+
+  if (mantissa == 0) {
+    result = alias_cast<TFloat>(bits_type(0));
+    return true;
+  }
+
+  if (exponent < CachedPowers::minExponent ||
+      exponent >= CachedPowers::maxExponent + CachedPowers::step)
+    return false;
+
+  // 10^exponent = 10^k * 10^r with 10^k cached and 10^r exact
+  uint8_t index =
+      uint8_t((exponent - CachedPowers::minExponent) / CachedPowers::step);
+  int r = exponent - CachedPowers::decimalExponent(index);
+  DiyFp power = CachedPowers::get(index);
+  if (r) power = DiyFp::normalize(DiyFp::mul(power, smallPowerOfTen(r)));
+
+  DiyFp w = DiyFp::normalize(DiyFp(mantissa, 0));
+  uint64_t hi, lo;
+  DiyFp::mul128(w.f, power.f, hi, lo);
+  int binaryExponent = w.e + power.e + 64;
+  if (!(hi >> 63)) {
+    hi = (hi << 1) | (lo >> 63);
+    binaryExponent--;
+  }
+
+  // subnormals keep fewer bits
+  int dropped = 64 - precision;
+  int biased = binaryExponent + 63 + bias;
+  if (biased <= 0) dropped += 1 - biased;
+  if (dropped > 63) return false;
+
+  // hi is within 5 units of the exact product: round it to the precision
+  // directly, unless the dropped bits are that close to one half
+  const uint64_t half = uint64_t(1) << (dropped - 1);
+  const uint64_t margin = 8;
+  uint64_t rest = hi & ((half << 1) - 1);
+  uint64_t bits = hi >> dropped;
+  binaryExponent += dropped;
+
+  if (rest + margin >= half && rest <= half + margin) {
+    int cmp = compareToHalfway(mantissa, exponent, bits, binaryExponent);
+    if (cmp > 0 || (cmp == 0 && (bits & 1))) bits++;
+  } else if (rest > half) {
+    bits++;
+  }
+  if (bits >> precision) {
+    bits >>= 1;
+    binaryExponent++;
+  }
+
+  const uint64_t hiddenBit = uint64_t(1) << (precision - 1);
+  biased = bits & hiddenBit ? binaryExponent + precision - 1 + bias : 0;
+  if (biased >= (1 << exponentBits) - 1) return false;
+
+  result = alias_cast<TFloat>(
+      bits_type((uint64_t(biased) << (precision - 1)) | (bits & ~hiddenBit)));
+  return true;
+}
+}  // namespace ARDUINOJSON_NAMESPACE
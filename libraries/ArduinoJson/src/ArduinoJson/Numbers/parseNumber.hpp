@@ -11,6 +11,7 @@
 #include "../Variant/VariantContent.hpp"
 #include "FloatTraits.hpp"
 #include "convertNumber.hpp"
+#include "makeFloat.hpp"
 
 namespace ARDUINOJSON_NAMESPACE {
 
@@ -89,15 +90,50 @@ inline ParsedNumber<TFloat, TUInt> parseNumber(const char *s) {
 
   while (isdigit(*s)) {
     uint8_t digit = uint8_t(*s - '0');
-    if (mantissa > maxUint / 10) break;
-    mantissa *= 10;
-    if (mantissa > maxUint - digit) break;
-    mantissa += digit;
+    if (mantissa > (maxUint - digit) / 10) break;
+    mantissa = mantissa * 10 + digit;
     s++;
   }
 
   if (*s == '\0') return return_type(TUInt(mantissa), is_negative);
 
+#if ARDUINOJSON_FAST_FLOAT
+  // makeFloat() rounds the whole mantissa, keep as many digits as 64 bits hold
+  uint64_t digits = mantissa;
+  const uint64_t digits_limit = uint64_t(-1) - 1;
+  bool truncated = false;
+
+  if (digits > digits_limit) {
+    truncated = digits % 10 != 0;
+    digits /= 10;
+    exponent_offset++;
+  }
+
+  while (isdigit(*s)) {
+    uint8_t digit = uint8_t(*s - '0');
+    if (digits <= (digits_limit - digit) / 10) {
+      digits = digits * 10 + digit;
+    } else {
+      exponent_offset++;
+      if (digit) truncated = true;
+    }
+    s++;
+  }
+
+  if (*s == '.') {
+    s++;
+    while (isdigit(*s)) {
+      uint8_t digit = uint8_t(*s - '0');
+      if (digits <= (digits_limit - digit) / 10) {
+        digits = digits * 10 + digit;
+        exponent_offset--;
+      } else if (digit) {
+        truncated = true;
+      }
+      s++;
+    }
+  }
+#else
   // avoid mantissa overflow
   while (mantissa > traits::mantissa_max) {
     mantissa /= 10;
@@ -120,6 +156,7 @@ inline ParsedNumber<TFloat, TUInt> parseNumber(const char *s) {
       s++;
     }
   }
+#endif
 
   int exponent = 0;
   if (*s == 'e' || *s == 'E') {
@@ -149,7 +186,17 @@ inline ParsedNumber<TFloat, TUInt> parseNumber(const char *s) {
   // we should be at the end of the string, otherwise it's an error
   if (*s != '\0') return return_type();
 
+#if ARDUINOJSON_FAST_FLOAT
+  // with dropped digits, the value is between digits and digits + 1, when
+  // they round to different floats only the approximation is left
+  TFloat result, upper;
+  if (!makeFloat(digits, exponent, result) ||
+      (truncated &&
+       (!makeFloat(digits + 1, exponent, upper) || upper != result)))
+    result = traits::make_float(static_cast<TFloat>(digits), exponent);
+#else
   TFloat result = traits::make_float(static_cast<TFloat>(mantissa), exponent);
+#endif
 
   return is_negative ? -result : result;
 }
@@ -0,0 +1,34 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2019
+// MIT License
+
+#pragma once
+
+#include <stdint.h>
+#include "../Configuration.hpp"
+
+// Constant tables that would otherwise take RAM on Harvard architectures
+#if ARDUINOJSON_ENABLE_PROGMEM
+#define ARDUINOJSON_PROGMEM PROGMEM
+#else
+#define ARDUINOJSON_PROGMEM
+#endif
+
+namespace ARDUINOJSON_NAMESPACE {
+
+inline uint32_t readFlash(const uint32_t* p) {
+#if ARDUINOJSON_ENABLE_PROGMEM
+  return pgm_read_dword(p);
+#else
+  return *p;
+#endif
+}
+
+inline int16_t readFlash(const int16_t* p) {
+#if ARDUINOJSON_ENABLE_PROGMEM
+  return static_cast<int16_t>(pgm_read_word(p));
+#else
+  return *p;
+#endif
+}
+}  // namespace ARDUINOJSON_NAMESPACE
@@ -0,0 +1,66 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2019
+// MIT License
+
+#pragma once
+
+#include "../Configuration.hpp"
+
+#include <stddef.h>  // size_t
+#include <string.h>  // memcpy
+
+namespace ARDUINOJSON_NAMESPACE {
+
+// Gathers the character by character output of the serializers and forwards
+// it to the destination in chunks of N bytes. The destination only needs
+// write(const uint8_t*, size_t): Print, Stream, WiFiUDP, WiFiClient, File...
+//
+//   BufferedWriter<WiFiClient> writer(client);
+//   serializeJson(doc, writer);
+//   writer.flush();
+//
+// The destructor flushes what is left.
+template <typename TDestination, size_t N = ARDUINOJSON_WRITER_BUFFER_SIZE>
+class BufferedWriter {
+ public:
+  explicit BufferedWriter(TDestination &destination)
+      : _destination(destination), _size(0) {}
+
+  ~BufferedWriter() {
+    flush();
+  }
+
+  size_t write(uint8_t c) {
+    if (_size == N) flush();
+    _buffer[_size++] = static_cast<char>(c);
+    return 1;
+  }
+
+  size_t write(const uint8_t *s, size_t n) {
+    // large blocks bypass the buffer, once it is emptied to keep the order
+    if (n >= N) {
+      flush();
+      return _destination.write(s, n);
+    }
+    if (_size + n > N) flush();
+    memcpy(_buffer + _size, s, n);
+    _size += n;
+    return n;
+  }
+
+  void flush() {
+    if (_size == 0) return;
+    _destination.write(reinterpret_cast<const uint8_t *>(_buffer), _size);
+    _size = 0;
+  }
+
+ private:
+  // cannot be copied, the buffer would be flushed twice
+  BufferedWriter(const BufferedWriter &);
+  BufferedWriter &operator=(const BufferedWriter &);
+
+  TDestination &_destination;
+  size_t _size;
+  char _buffer[N];
+};
+}  // namespace ARDUINOJSON_NAMESPACE
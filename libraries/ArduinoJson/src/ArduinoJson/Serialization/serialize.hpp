@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "./BufferedWriter.hpp"
 #include "./DynamicStringWriter.hpp"
 #include "./StaticStringWriter.hpp"
 
@@ -36,6 +37,13 @@ size_t serialize(const TSource &source, Print &destination) {
 }
 #endif
 
+template <template <typename> class TSerializer, typename TSource,
+          typename TDestination, size_t N>
+size_t serialize(const TSource &source,
+                 BufferedWriter<TDestination, N> &destination) {
+  return doSerialize<TSerializer>(source, destination);
+}
+
 template <template <typename> class TSerializer, typename TSource>
 size_t serialize(const TSource &source, char *buffer, size_t bufferSize) {
   StaticStringWriter writer(buffer, bufferSize);
@@ -19,6 +19,11 @@ class StringCopier {
     return StringBuilder(_pool);
   }
 
+  // s must be the last string completed
+  void reclaim(const char* s) {
+    _pool->reclaimLastString(s);
+  }
+
  private:
   MemoryPool* _pool;
 };
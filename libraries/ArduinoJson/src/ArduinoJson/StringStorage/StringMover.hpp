@@ -32,6 +32,9 @@ class StringMover {
     return StringBuilder(&_ptr);
   }
 
+  // the string stays in the input, there is nothing to give back
+  void reclaim(const char*) {}
+
  private:
   char* _ptr;
 };
@@ -340,6 +340,7 @@ class VariantConstRef : public VariantRefBase<const VariantData>,
                         public Visitable {
   typedef VariantRefBase<const VariantData> base_type;
   friend class VariantRef;
+  friend class Filter;
 
  public:
   VariantConstRef() : base_type(0) {}
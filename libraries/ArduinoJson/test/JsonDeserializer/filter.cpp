@@ -0,0 +1,246 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2019
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+#include <string>
+
+using namespace ARDUINOJSON_NAMESPACE;
+
+TEST_CASE("deserializeJson() with DeserializationOption::Filter") {
+  DynamicJsonDocument filter(256);
+  DynamicJsonDocument doc(1024);
+
+  SECTION("true keeps everything") {
+    filter.set(true);
+
+    DeserializationError err = deserializeJson(
+        doc, "{\"a\":1,\"b\":[2,3]}", DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"a\":1,\"b\":[2,3]}");
+  }
+
+  SECTION("keeps only the listed members") {
+    filter["abcdef"] = true;
+
+    deserializeJson(doc, "{\"abcdef\":\"world\"}");
+    size_t expected = doc.memoryUsage();
+
+    DeserializationError err = deserializeJson(
+        doc, "{\"abcdefg\":\"hello\",\"abcdef\":\"world\",\"abcde\":42}",
+        DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"abcdef\":\"world\"}");
+    REQUIRE(doc.memoryUsage() == expected);
+  }
+
+  SECTION("skips nested values") {
+    filter["a"] = true;
+
+    DeserializationError err = deserializeJson(
+        doc,
+        "{\"b\":{\"c\":[1,{\"d\":\"x\\\"y\"}],\"e\":null},\"a\":-1.5e3,"
+        "\"f\":[[],{}]}",
+        DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"a\":-1500}");
+  }
+
+  SECTION("nested filter") {
+    filter["txpk"]["freq"] = true;
+    filter["txpk"]["data"] = true;
+
+    DeserializationError err = deserializeJson(
+        doc,
+        "{\"txpk\":{\"imme\":false,\"freq\":868.1,\"rfch\":0,"
+        "\"data\":\"QA==\"},\"other\":1}",
+        DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() ==
+            "{\"txpk\":{\"freq\":868.1,\"data\":\"QA==\"}}");
+  }
+
+  SECTION("the wildcard matches the other keys") {
+    filter["*"]["id"] = true;
+    filter["skip"] = false;
+
+    DeserializationError err = deserializeJson(
+        doc, "{\"x\":{\"id\":1,\"n\":2},\"skip\":{\"id\":3},\"y\":{\"id\":4}}",
+        DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"x\":{\"id\":1},\"y\":{\"id\":4}}");
+  }
+
+  SECTION("the first element filters every element") {
+    filter.to<JsonArray>().createNestedObject()["a"] = true;
+
+    DeserializationError err = deserializeJson(
+        doc, "[{\"a\":1,\"b\":2},{\"b\":3},{\"a\":4}]",
+        DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[{\"a\":1},{},{\"a\":4}]");
+  }
+
+  SECTION("elements are skipped when the element filter is false") {
+    filter.to<JsonArray>().add(false);
+
+    DeserializationError err = deserializeJson(
+        doc, "[1,[2],{\"a\":3}]", DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[]");
+  }
+
+  SECTION("a value that does not match the filter is null") {
+    filter["a"] = true;
+
+    DeserializationError err = deserializeJson(
+        doc, "[1,2]", DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.isNull());
+    REQUIRE(doc.memoryUsage() == 0);
+  }
+
+  SECTION("false skips the whole input") {
+    filter.set(false);
+
+    DeserializationError err = deserializeJson(
+        doc, "{\"a\":\"hello\"}", DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.isNull());
+    REQUIRE(doc.memoryUsage() == 0);
+  }
+
+  SECTION("skipped keys are not stored") {
+    filter["a"] = true;
+
+    deserializeJson(doc, "{\"a\":1}");
+    size_t expected = doc.memoryUsage();
+
+    DeserializationError err = deserializeJson(
+        doc, "{\"loooooooooooong\":\"value\",\"a\":1,\"zzzzzzzzzz\":[1,2,3]}",
+        DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.memoryUsage() == expected);
+  }
+
+  SECTION("still detects errors in skipped values") {
+    filter["a"] = true;
+
+    SECTION("IncompleteInput in a string") {
+      DeserializationError err = deserializeJson(
+          doc, "{\"b\":\"hello", DeserializationOption::Filter(filter));
+
+      REQUIRE(err == DeserializationError::IncompleteInput);
+    }
+
+    SECTION("IncompleteInput after an escape") {
+      DeserializationError err = deserializeJson(
+          doc, "{\"b\":\"hello\\", DeserializationOption::Filter(filter));
+
+      REQUIRE(err == DeserializationError::IncompleteInput);
+    }
+
+    SECTION("IncompleteInput in an object") {
+      DeserializationError err = deserializeJson(
+          doc, "{\"b\":{\"c\":1", DeserializationOption::Filter(filter));
+
+      REQUIRE(err == DeserializationError::IncompleteInput);
+    }
+
+    SECTION("InvalidInput in an array") {
+      DeserializationError err = deserializeJson(
+          doc, "{\"b\":[1 2]}", DeserializationOption::Filter(filter));
+
+      REQUIRE(err == DeserializationError::InvalidInput);
+    }
+
+    SECTION("TooDeep") {
+      DeserializationError err =
+          deserializeJson(doc, "{\"b\":[[[1]]]}",
+                          DeserializationOption::Filter(filter),
+                          DeserializationOption::NestingLimit(2));
+
+      REQUIRE(err == DeserializationError::TooDeep);
+    }
+  }
+
+  SECTION("trailing characters after a skipped value") {
+    filter.set(false);
+
+    DeserializationError err = deserializeJson(
+        doc, "1 2", DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::InvalidInput);
+  }
+
+  SECTION("char* input is parsed in place") {
+    filter["b"] = true;
+    char input[] = "{\"a\":\"hello\",\"b\":\"world\"}";
+
+    DeserializationError err =
+        deserializeJson(doc, input, DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc["b"] == std::string("world"));
+    REQUIRE(doc.memoryUsage() == JSON_OBJECT_SIZE(1));
+  }
+
+  SECTION("char* input with size") {
+    filter["b"] = true;
+    char input[] = "{\"a\":1,\"b\":2}garbage";
+
+    DeserializationError err = deserializeJson(
+        doc, input, 13, DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"b\":2}");
+  }
+
+  SECTION("std::string input") {
+    filter["b"] = true;
+    std::string input("{\"a\":1,\"b\":2}");
+
+    DeserializationError err =
+        deserializeJson(doc, input, DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"b\":2}");
+  }
+
+  SECTION("std::istream input") {
+    filter["b"] = true;
+    std::istringstream input("{\"a\":[1,2],\"b\":2} {\"b\":3}");
+
+    DeserializationError err =
+        deserializeJson(doc, input, DeserializationOption::Filter(filter));
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"b\":2}");
+    REQUIRE(input.get() == ' ');
+  }
+
+  SECTION("fits in a document too small for the whole input") {
+    StaticJsonDocument<JSON_OBJECT_SIZE(1)> small;
+    filter["b"] = true;
+    char input[] = "{\"a\":[1,2,3],\"b\":2,\"c\":{\"d\":4}}";
+
+    REQUIRE(deserializeJson(small, "{\"a\":[1,2,3],\"b\":2,\"c\":{\"d\":4}}") ==
+            DeserializationError::NoMemory);
+    REQUIRE(deserializeJson(small, input,
+                            DeserializationOption::Filter(filter)) ==
+            DeserializationError::Ok);
+    REQUIRE(small["b"] == 2);
+  }
+}
@@ -0,0 +1,135 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2019
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <string>
+
+using namespace ARDUINOJSON_NAMESPACE;
+
+// records what reaches the destination, and in how many calls
+class SpySink {
+ public:
+  SpySink() : calls(0), largest(0) {}
+
+  size_t write(const uint8_t* s, size_t n) {
+    output.append(reinterpret_cast<const char*>(s), n);
+    calls++;
+    if (n > largest) largest = n;
+    return n;
+  }
+
+  std::string output;
+  size_t calls;
+  size_t largest;
+};
+
+static size_t print(BufferedWriter<SpySink, 8>& writer, const char* s) {
+  return writer.write(reinterpret_cast<const uint8_t*>(s), strlen(s));
+}
+
+TEST_CASE("BufferedWriter") {
+  SpySink sink;
+
+  SECTION("nothing reaches the destination before the buffer is full") {
+    BufferedWriter<SpySink, 8> writer(sink);
+
+    REQUIRE(print(writer, "ABCDEFG") == 7);
+    REQUIRE(writer.write('H') == 1);
+    REQUIRE(sink.calls == 0);
+
+    REQUIRE(writer.write('I') == 1);
+    REQUIRE(sink.calls == 1);
+    REQUIRE(sink.output == "ABCDEFGH");
+  }
+
+  SECTION("flush() empties the buffer") {
+    BufferedWriter<SpySink, 8> writer(sink);
+
+    print(writer, "ABC");
+    writer.flush();
+    writer.flush();
+
+    REQUIRE(sink.calls == 1);
+    REQUIRE(sink.output == "ABC");
+  }
+
+  SECTION("the destructor flushes") {
+    {
+      BufferedWriter<SpySink, 8> writer(sink);
+      print(writer, "ABC");
+    }
+
+    REQUIRE(sink.output == "ABC");
+  }
+
+  SECTION("large blocks are forwarded in one call, in order") {
+    BufferedWriter<SpySink, 8> writer(sink);
+
+    print(writer, "AB");
+    print(writer, "CDEFGHIJKLMN");
+    print(writer, "OP");
+    writer.flush();
+
+    REQUIRE(sink.output == "ABCDEFGHIJKLMNOP");
+    REQUIRE(sink.calls == 3);
+    REQUIRE(sink.largest == 12);
+  }
+
+  SECTION("a block that does not fit flushes first") {
+    BufferedWriter<SpySink, 8> writer(sink);
+
+    print(writer, "ABCDE");
+    print(writer, "FGHI");
+
+    REQUIRE(sink.output == "ABCDE");
+    writer.flush();
+    REQUIRE(sink.output == "ABCDEFGHI");
+  }
+}
+
+TEST_CASE("serialize to a BufferedWriter") {
+  SpySink sink;
+  DynamicJsonDocument doc(4096);
+  for (int i = 0; i < 100; i++) doc.add("hello");
+
+  std::string expected;
+
+  SECTION("serializeJson()") {
+    serializeJson(doc, expected);
+    BufferedWriter<SpySink> writer(sink);
+
+    size_t n = serializeJson(doc, writer);
+    writer.flush();
+
+    REQUIRE(n == expected.size());
+    REQUIRE(sink.output == expected);
+    REQUIRE(sink.calls == (expected.size() + ARDUINOJSON_WRITER_BUFFER_SIZE -
+                           1) / ARDUINOJSON_WRITER_BUFFER_SIZE);
+  }
+
+  SECTION("serializeJsonPretty()") {
+    serializeJsonPretty(doc, expected);
+    BufferedWriter<SpySink, 256> writer(sink);
+
+    size_t n = serializeJsonPretty(doc, writer);
+    writer.flush();
+
+    REQUIRE(n == expected.size());
+    REQUIRE(sink.output == expected);
+    REQUIRE(sink.largest <= 256);
+  }
+
+  SECTION("serializeMsgPack()") {
+    serializeMsgPack(doc, expected);
+    BufferedWriter<SpySink, 32> writer(sink);
+
+    size_t n = serializeMsgPack(doc, writer);
+    writer.flush();
+
+    REQUIRE(n == expected.size());
+    REQUIRE(sink.output == expected);
+    REQUIRE(sink.largest <= 32);
+  }
+}
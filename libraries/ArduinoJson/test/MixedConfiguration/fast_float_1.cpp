@@ -0,0 +1,15 @@
+#define ARDUINOJSON_FAST_FLOAT 1
+#define ARDUINOJSON_USE_DOUBLE 1
+#include <ArduinoJson.h>
+
+#include <catch.hpp>
+
+TEST_CASE("ARDUINOJSON_FAST_FLOAT == 1") {
+  DynamicJsonDocument doc(4096);
+  deserializeJson(doc, "{\"freq\":868.1,\"pi\":3.14159265359}");
+
+  std::string json;
+  serializeJson(doc, json);
+
+  REQUIRE(json == "{\"freq\":868.1,\"pi\":3.14159265359}");
+}
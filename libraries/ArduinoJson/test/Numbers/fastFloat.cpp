@@ -0,0 +1,154 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2019
+// MIT License
+
+// same configuration as parseFloat.cpp, these headers leave the namespace
+// undecorated
+#define ARDUINOJSON_FAST_FLOAT 1
+#define ARDUINOJSON_USE_DOUBLE 0
+#define ARDUINOJSON_ENABLE_NAN 1
+#define ARDUINOJSON_ENABLE_INFINITY 1
+
+#include <ArduinoJson/Json/TextFormatter.hpp>
+#include <ArduinoJson/Numbers/parseFloat.hpp>
+#include <ArduinoJson/Serialization/DynamicStringWriter.hpp>
+#include <catch.hpp>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+using namespace ARDUINOJSON_NAMESPACE;
+
+static uint64_t next(uint64_t& state) {  // xorshift64
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+template <typename T>
+std::string format(T value) {
+  std::string output;
+  DynamicStringWriter<std::string> sb(output);
+  TextFormatter<DynamicStringWriter<std::string> > writer(sb);
+  writer.writeFloat(value);
+  return output;
+}
+
+template <typename T>
+std::string shortest(T value) {
+  ShortestFloat<T> s(value);
+  char buffer[32];
+  sprintf(buffer, "%.*se%d", s.length, s.digits, s.exponent);
+  return buffer;
+}
+
+static void checkParse(const char* input) {
+  CAPTURE(input);
+  REQUIRE(parseFloat<double>(input) == strtod(input, 0));
+}
+
+TEST_CASE("ShortestFloat") {
+  SECTION("digits and exponent") {
+    REQUIRE(shortest(868.1) == "8681e-1");
+    REQUIRE(shortest(1e7) == "1e7");
+    REQUIRE(shortest(0.3) == "3e-1");
+    REQUIRE(shortest(5e-324) == "5e-324");
+    REQUIRE(shortest(1.7976931348623157e308) == "17976931348623157e292");
+    REQUIRE(shortest(868.1f) == "8681e-1");
+    REQUIRE(shortest(3.4028235e38f) == "34028235e31");
+  }
+
+  SECTION("random doubles round trip") {
+    uint64_t state = 88172645;
+    for (int i = 0; i < 100000; i++) {
+      uint64_t bits = next(state) >> 1;
+      double value;
+      memcpy(&value, &bits, sizeof(value));
+      if (value == 0 || value - value != 0) continue;  // zero, inf or NaN
+
+      std::string output = format(value);
+      CAPTURE(output);
+      REQUIRE(strtod(output.c_str(), 0) == value);
+      REQUIRE(parseFloat<double>(output.c_str()) == value);
+    }
+  }
+
+  SECTION("random floats round trip") {
+    uint64_t state = 2463534242u;
+    for (int i = 0; i < 100000; i++) {
+      uint32_t bits = uint32_t(next(state)) & 0x7FFFFFFF;
+      float value;
+      memcpy(&value, &bits, sizeof(value));
+      if (value == 0 || value - value != 0) continue;
+
+      std::string output = format(value);
+      CAPTURE(output);
+      REQUIRE(strtof(output.c_str(), 0) == value);
+      REQUIRE(parseFloat<float>(output.c_str()) == value);
+    }
+  }
+}
+
+TEST_CASE("TextFormatter::writeFloat() with ARDUINOJSON_FAST_FLOAT") {
+  REQUIRE(format(0.0) == "0");
+  REQUIRE(format(868.1) == "868.1");
+  REQUIRE(format(52.3702) == "52.3702");
+  REQUIRE(format(-7.25) == "-7.25");
+  REQUIRE(format(0.1) == "0.1");
+  REQUIRE(format(0.1 + 0.2) == "0.30000000000000004");
+  REQUIRE(format(3.14159265359) == "3.14159265359");
+  REQUIRE(format(123.0) == "123");
+  REQUIRE(format(9999999.0) == "9999999");
+  REQUIRE(format(0.00012) == "0.00012");
+  REQUIRE(format(1e7) == "1e7");
+  REQUIRE(format(1.5e7) == "1.5e7");
+  REQUIRE(format(1e-5) == "1e-5");
+  REQUIRE(format(1.7976931348623157e308) == "1.7976931348623157e308");
+  REQUIRE(format(2.2250738585072014e-308) == "2.2250738585072014e-308");
+  REQUIRE(format(5e-324) == "5e-324");
+  REQUIRE(format(868.1f) == "868.1");
+  REQUIRE(format(0.1f) == "0.1");
+}
+
+TEST_CASE("parseFloat() with ARDUINOJSON_FAST_FLOAT") {
+  SECTION("correctly rounded") {
+    checkParse("868.1");
+    checkParse("52.3702");
+    checkParse("0.1");
+    checkParse("1e23");
+    checkParse("8.98846567431158e307");
+    checkParse("1.7976931348623157e308");
+    checkParse("2.2250738585072011e-308");
+    checkParse("2.2250738585072014e-308");
+    checkParse("4.9406564584124654e-324");
+  }
+
+  SECTION("ties") {
+    checkParse("9007199254740993");
+    checkParse("9007199254740995");
+    checkParse("1.000000000000000111");
+    checkParse("1.000000000000000333");
+  }
+
+  SECTION("more digits than the mantissa holds") {
+    checkParse("9007199254740993.0000000000001");
+    checkParse("9007199254740992.9999999999999999");
+    checkParse("123456789012345678901234567890");
+    checkParse("0.1000000000000000055511151231257827021181583404541015625");
+    checkParse("0.1000000000000000055511151231257827021181583404541015626");
+    checkParse("18446744073709551615.5");
+  }
+
+  SECTION("random decimals") {
+    uint64_t state = 1181783497;
+    for (int i = 0; i < 100000; i++) {
+      char input[32];
+      uint64_t mantissa = next(state) >> (i % 64);
+      sprintf(input, "%u%09ue%d", unsigned(mantissa / 1000000000),
+              unsigned(mantissa % 1000000000), int(next(state) % 600) - 300);
+      checkParse(input);
+    }
+  }
+}
@@ -1,48 +1,57 @@
 #include <Base64M.h>
 
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+const unsigned char Base64::ENCODE[64] = {
+  'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+  'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+  'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+  'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/',
+};
+
+const unsigned char Base64::DECODE[256] = {
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  62, 255, 255, 255,  63,
+   52,  53,  54,  55,  56,  57,  58,  59,  60,  61, 255, 255, 255, 255, 255, 255,
+  255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
+   15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255, 255,
+  255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,
+   41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+
 unsigned char Base64::from_binary(unsigned char v) {
-  // Capital letters - 'A' is ascii 65 and base64 0
-  if(v < 26) return v + 'A';
-  // Lowercase letters - 'a' is ascii 97 and base64 26
-  if(v < 52) return v + 71;
-  // Digits - '0' is ascii 48 and base64 52
-  if(v < 62) return v - 4;
-  // '+' is ascii 43 and base64 62
-  if(v == 62) return '+';
-  // '/' is ascii 47 and base64 63
-  if(v == 63) return '/';
-  return 64;
+  return v < 64 ? Base64::ENCODE[v] : 64;
 }
 
 unsigned char Base64::to_binary(unsigned char c) {
-  // Capital letters - 'A' is ascii 65 and base64 0
-  if('A' <= c && c <= 'Z') return c - 'A';
-  // Lowercase letters - 'a' is ascii 97 and base64 26
-  if('a' <= c && c <= 'z') return c - 71;
-  // Digits - '0' is ascii 48 and base64 52
-  if('0' <= c && c <= '9') return c + 4;
-  // '+' is ascii 43 and base64 62
-  if(c == '+') return 62;
-  // '/' is ascii 47 and base64 63
-  if(c == '/') return 63;
-  return 255;
+  return Base64::DECODE[c];
 }
 
 unsigned int Base64::encode_length(unsigned int input_length) {
   return (input_length + 2)/3*4;
 }
 
-unsigned int Base64::decode_length(unsigned char input[]) {
-  unsigned char *start = input;
-  
-  while(Base64::to_binary(input[0]) < 64) {
-    ++input;
-  }
-  
-  unsigned int input_length = input - start;
-  
+unsigned int Base64::decode_length(const unsigned char input[], unsigned int input_length) {
+  // padding is optional
+  if(input_length && input[input_length - 1] == '=') --input_length;
+  if(input_length && input[input_length - 1] == '=') --input_length;
+
   unsigned int output_length = input_length/4*3;
-  
+
   switch(input_length % 4) {
     default: return output_length;
     case 2: return output_length + 1;
@@ -50,66 +59,229 @@ unsigned int Base64::decode_length(unsigned char input[]) {
   }
 }
 
-unsigned int Base64::encode(unsigned char input[], unsigned int input_length, unsigned char output[]) {
-  unsigned int full_sets = input_length/3;
-  
+unsigned int Base64::decode_length(unsigned char input[]) {
+  return Base64::decode_length(input, strlen((const char*) input));
+}
+
+#if defined(__SSSE3__)
+// 12 bytes -> 16 characters, see W. Mula, D. Lemire "Faster Base64 Encoding and Decoding using AVX2 Instructions"
+static inline __m128i encode_sse(__m128i in) {
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  const __m128i indices = _mm_or_si128(t1, t3);
+
+  __m128i offset = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  offset = _mm_or_si128(offset, _mm_and_si128(less, _mm_set1_epi8(13)));
+  const __m128i shift = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  return _mm_add_epi8(_mm_shuffle_epi8(shift, offset), indices);
+}
+
+// 16 characters -> 6-bit values, sets valid to false if any of them is outside the alphabet
+static inline __m128i classify_sse(__m128i c, bool& valid) {
+  const __m128i AZ = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('Z' + 1)));
+  const __m128i az = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('z' + 1)));
+  const __m128i d = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+  const __m128i plus = _mm_cmpeq_epi8(c, _mm_set1_epi8('+'));
+  const __m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+  __m128i shift = _mm_and_si128(AZ, _mm_set1_epi8(-65));
+  shift = _mm_or_si128(shift, _mm_and_si128(az, _mm_set1_epi8(-71)));
+  shift = _mm_or_si128(shift, _mm_and_si128(d, _mm_set1_epi8(4)));
+  shift = _mm_or_si128(shift, _mm_and_si128(plus, _mm_set1_epi8(62 - '+')));
+  shift = _mm_or_si128(shift, _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+  const __m128i any = _mm_or_si128(_mm_or_si128(AZ, az), _mm_or_si128(d, _mm_or_si128(plus, slash)));
+  valid = 0xFFFF == _mm_movemask_epi8(any);
+  return _mm_add_epi8(c, shift);
+}
+
+// 16 6-bit values -> 12 bytes at the start of the register
+static inline __m128i pack_sse(__m128i v) {
+  v = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+  v = _mm_madd_epi16(v, _mm_set1_epi32(0x00011000));
+  return _mm_shuffle_epi8(v, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+#endif
+
+#if defined(__AVX2__)
+// same as the SSE versions, one 12 bytes / 16 characters block per 128-bit lane
+static inline __m256i encode_avx2(__m256i in) {
+  in = _mm256_shuffle_epi8(in, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+    10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+  const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+  const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+  const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+  const __m256i indices = _mm256_or_si256(t1, t3);
+
+  __m256i offset = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+  const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+  offset = _mm256_or_si256(offset, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+  const __m256i shift = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  return _mm256_add_epi8(_mm256_shuffle_epi8(shift, offset), indices);
+}
+
+static inline __m256i classify_avx2(__m256i c, bool& valid) {
+  const __m256i AZ = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), c));
+  const __m256i az = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), c));
+  const __m256i d = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+  const __m256i plus = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('+'));
+  const __m256i slash = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('/'));
+  __m256i shift = _mm256_and_si256(AZ, _mm256_set1_epi8(-65));
+  shift = _mm256_or_si256(shift, _mm256_and_si256(az, _mm256_set1_epi8(-71)));
+  shift = _mm256_or_si256(shift, _mm256_and_si256(d, _mm256_set1_epi8(4)));
+  shift = _mm256_or_si256(shift, _mm256_and_si256(plus, _mm256_set1_epi8(62 - '+')));
+  shift = _mm256_or_si256(shift, _mm256_and_si256(slash, _mm256_set1_epi8(63 - '/')));
+  const __m256i any = _mm256_or_si256(_mm256_or_si256(AZ, az), _mm256_or_si256(d, _mm256_or_si256(plus, slash)));
+  valid = -1 == _mm256_movemask_epi8(any);
+  return _mm256_add_epi8(c, shift);
+}
+
+// 32 6-bit values -> 24 bytes at the start of the register
+static inline __m256i pack_avx2(__m256i v) {
+  v = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+  v = _mm256_madd_epi16(v, _mm256_set1_epi32(0x00011000));
+  v = _mm256_shuffle_epi8(v, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+}
+#endif
+
+unsigned int Base64::encode(const unsigned char input[], unsigned int input_length, unsigned char output[]) {
+  const unsigned char* end = input + input_length;
+
+#if defined(__AVX2__)
+  // 24 bytes per iteration, the second lane is loaded from input + 12
+  while(28 <= end - input) {
+    __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*) input)),
+      _mm_loadu_si128((const __m128i*) (input + 12)), 1);
+    _mm256_storeu_si256((__m256i*) output, encode_avx2(in));
+    input += 24;
+    output += 32;
+  }
+#endif
+#if defined(__SSSE3__)
+  // 12 bytes per iteration, 16 are read
+  while(16 <= end - input) {
+    _mm_storeu_si128((__m128i*) output, encode_sse(_mm_loadu_si128((const __m128i*) input)));
+    input += 12;
+    output += 16;
+  }
+#endif
+
   // While there are still full sets of 24 bits...
-  for(unsigned int i = 0; i < full_sets; ++i) {
-    output[0] = Base64::from_binary(                         input[0] >> 2);
-    output[1] = Base64::from_binary((input[0] & 0x03) << 4 | input[1] >> 4);
-    output[2] = Base64::from_binary((input[1] & 0x0F) << 2 | input[2] >> 6);
-    output[3] = Base64::from_binary( input[2] & 0x3F);
-    
+  while(3 <= end - input) {
+    const unsigned int v = input[0] << 16 | input[1] << 8 | input[2];
+    output[0] = Base64::ENCODE[v >> 18];
+    output[1] = Base64::ENCODE[v >> 12 & 0x3F];
+    output[2] = Base64::ENCODE[v >> 6 & 0x3F];
+    output[3] = Base64::ENCODE[v & 0x3F];
     input += 3;
     output += 4;
   }
-  
-  switch(input_length % 3) {
+
+  switch(end - input) {
     case 0:
       output[0] = '\0';
       break;
     case 1:
-      output[0] = Base64::from_binary(                         input[0] >> 2);
-      output[1] = Base64::from_binary((input[0] & 0x03) << 4);
+      output[0] = Base64::ENCODE[input[0] >> 2];
+      output[1] = Base64::ENCODE[(input[0] & 0x03) << 4];
       output[2] = '=';
       output[3] = '=';
       output[4] = '\0';
       break;
     case 2:
-      output[0] = Base64::from_binary(                         input[0] >> 2);
-      output[1] = Base64::from_binary((input[0] & 0x03) << 4 | input[1] >> 4);
-      output[2] = Base64::from_binary((input[1] & 0x0F) << 2);
+      output[0] = Base64::ENCODE[input[0] >> 2];
+      output[1] = Base64::ENCODE[(input[0] & 0x03) << 4 | input[1] >> 4];
+      output[2] = Base64::ENCODE[(input[1] & 0x0F) << 2];
       output[3] = '=';
       output[4] = '\0';
       break;
   }
-  
+
   return Base64::encode_length(input_length);
 }
 
-unsigned int Base64::decode(unsigned char input[], unsigned char output[]) {
-  unsigned int output_length = Base64::decode_length(input);
-  
+int Base64::decode(const unsigned char input[], unsigned int input_length, unsigned char output[], unsigned int output_size) {
+  if(input_length % 4 == 0 && input_length && input[input_length - 1] == '=') {
+    --input_length;
+    if(input[input_length - 1] == '=') --input_length;
+  }
+  if(input_length % 4 == 1) return BASE64_INVALID;
+
+  const unsigned int output_length = Base64::decode_length(input, input_length);
+  if(output_size < output_length) return BASE64_OVERFLOW;
+
+  const unsigned char* end = input + input_length;
+#if defined(__SSSE3__) // implied by __AVX2__
+  unsigned char* first = output;
+  bool valid = true;
+#endif
+
+#if defined(__AVX2__)
+  // 32 characters -> 24 bytes, the store writes 32
+  while(32 <= end - input && (unsigned int) (output - first) + 32 <= output_size) {
+    __m256i values = classify_avx2(_mm256_loadu_si256((const __m256i*) input), valid);
+    if(!valid) return BASE64_INVALID;
+    _mm256_storeu_si256((__m256i*) output, pack_avx2(values));
+    input += 32;
+    output += 24;
+  }
+#endif
+#if defined(__SSSE3__)
+  // 16 characters -> 12 bytes, the store writes 16
+  while(16 <= end - input && (unsigned int) (output - first) + 16 <= output_size) {
+    __m128i values = classify_sse(_mm_loadu_si128((const __m128i*) input), valid);
+    if(!valid) return BASE64_INVALID;
+    _mm_storeu_si128((__m128i*) output, pack_sse(values));
+    input += 16;
+    output += 12;
+  }
+#endif
+
   // While there are still full sets of 24 bits...
-  for(unsigned int i = 2; i < output_length; i += 3) {
-    output[0] = Base64::to_binary(input[0]) << 2 | Base64::to_binary(input[1]) >> 4;
-    output[1] = Base64::to_binary(input[1]) << 4 | Base64::to_binary(input[2]) >> 2;
-    output[2] = Base64::to_binary(input[2]) << 6 | Base64::to_binary(input[3]);
-    
+  while(4 <= end - input) {
+    const unsigned char a = Base64::DECODE[input[0]];
+    const unsigned char b = Base64::DECODE[input[1]];
+    const unsigned char c = Base64::DECODE[input[2]];
+    const unsigned char d = Base64::DECODE[input[3]];
+    if((a | b | c | d) & 0xC0) return BASE64_INVALID;
+    output[0] = a << 2 | b >> 4;
+    output[1] = b << 4 | c >> 2;
+    output[2] = c << 6 | d;
     input += 4;
     output += 3;
   }
-  
-  switch(output_length % 3) {
-    case 1:
-      output[0] = Base64::to_binary(input[0]) << 2 | Base64::to_binary(input[1]) >> 4;
-      break;
-    case 2:
-      output[0] = Base64::to_binary(input[0]) << 2 | Base64::to_binary(input[1]) >> 4;
-      output[1] = Base64::to_binary(input[1]) << 4 | Base64::to_binary(input[2]) >> 2;
-      break;
+
+  switch(end - input) {
+    case 2: {
+      const unsigned char a = Base64::DECODE[input[0]];
+      const unsigned char b = Base64::DECODE[input[1]];
+      if((a | b) & 0xC0) return BASE64_INVALID;
+      output[0] = a << 2 | b >> 4;
+    } break;
+    case 3: {
+      const unsigned char a = Base64::DECODE[input[0]];
+      const unsigned char b = Base64::DECODE[input[1]];
+      const unsigned char c = Base64::DECODE[input[2]];
+      if((a | b | c) & 0xC0) return BASE64_INVALID;
+      output[0] = a << 2 | b >> 4;
+      output[1] = b << 4 | c >> 2;
+    } break;
   }
-  
+
   return output_length;
 }
 
+unsigned int Base64::decode(unsigned char input[], unsigned char output[]) {
+  unsigned int input_length = strlen((const char*) input);
+  int output_length = Base64::decode(input, input_length, output, Base64::decode_length(input, input_length));
+  return output_length < 0 ? 0 : output_length;
+}
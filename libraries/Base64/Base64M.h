@@ -1,12 +1,24 @@
 /**
  * Base64 encoding and decoding of strings. Uses '+' for 62, '/' for 63, '=' for padding
+ *
+ * Table driven, every call takes explicit lengths so nothing scans for a NUL terminator.
+ * Host builds compiled with -mssse3 / -mavx2 use vectorized loops for the bulk of the data.
  */
 
+#include <stddef.h>
+#include <string.h>
+
 #ifndef __Base64__
 #define __Base64__
 
+#define BASE64_INVALID  -1 // input is not base64 (bad character, bad length or misplaced padding)
+#define BASE64_OVERFLOW -2 // output buffer is too small
+
 class Base64 {
 	public:
+	static const unsigned char ENCODE[64];
+	static const unsigned char DECODE[256]; // 0xFF for characters outside the alphabet
+
 	/* binary_to_base64:
 	 *   Description:
 	 *     Converts a single byte from a binary value to the corresponding base64 character
@@ -14,7 +26,7 @@ class Base64 {
 	 *     v - Byte to convert
 	 *   Returns:
 	 *     ascii code of base64 character. If byte is >= 64, then there is not corresponding base64 character
-	 *     and 255 is returned
+	 *     and 64 is returned
 	 */
 	static unsigned char from_binary(unsigned char v);
 
@@ -24,7 +36,7 @@ class Base64 {
 	 *   Parameters:
 	 *     c - Base64 character (as ascii code)
 	 *   Returns:
-	 *     6-bit binary value
+	 *     6-bit binary value, 255 if c is not a base64 character
 	 */
 	static unsigned char to_binary(unsigned char c);
 
@@ -40,11 +52,18 @@ class Base64 {
 
 	/* decode_base64_length:
 	 *   Description:
-	 *     Calculates number of bytes of binary data in a base64 string
+	 *     Calculates number of bytes of binary data in a base64 string, looking only at its padding
 	 *   Parameters:
-	 *     input - Base64-encoded null-terminated string
+	 *     input - Base64-encoded string, padding optional
+	 *     input_length - Number of characters in input
 	 *   Returns:
-	 *     Number of bytes of binary data in input
+	 *     Number of bytes of binary data in input, the characters themselves are not validated
+	 */
+	static unsigned int decode_length(const unsigned char input[], unsigned int input_length);
+
+	/* decode_base64_length:
+	 *   Description:
+	 *     Same as above for a null-terminated string
 	 */
 	static unsigned int decode_length(unsigned char input[]);
 
@@ -54,20 +73,58 @@ class Base64 {
 	 *   Parameters:
 	 *     input - Pointer to input data
 	 *     input_length - Number of bytes to read from input pointer
-	 *     output - Pointer to output string. Null terminator will be added automatically
+	 *     output - Pointer to output string, encode_length(input_length) + 1 bytes. Null terminator will be added automatically
 	 *   Returns:
 	 *     Length of encoded string in bytes (not including null terminator)
 	 */
-	static unsigned int encode(unsigned char input[], unsigned int input_length, unsigned char output[]);
+	static unsigned int encode(const unsigned char input[], unsigned int input_length, unsigned char output[]);
+
+	/* encode_base64:
+	 *   Description:
+	 *     Streams the base64 representation of an array of bytes to a sink, in chunks of 64 characters
+	 *   Parameters:
+	 *     input - Pointer to input data
+	 *     input_length - Number of bytes to read from input pointer
+	 *     sink - Anything with write(const uint8_t*, size_t): Print, WiFiUDP, WiFiClient, File ...
+	 *   Returns:
+	 *     Number of characters written
+	 */
+	template <typename TSink>
+	static size_t encode(const unsigned char input[], unsigned int input_length, TSink& sink) {
+		unsigned char chunk[64 + 1];
+		size_t written = 0;
+		while (input_length) {
+			unsigned int length = input_length < 48u ? input_length : 48u; // 48 bytes -> 64 characters
+			unsigned int chars = Base64::encode(input, length, chunk);
+			written += sink.write((const unsigned char*) chunk, chars);
+			input += length;
+			input_length -= length;
+		}
+		return written;
+	}
+
+	/* decode_base64:
+	 *   Description:
+	 *     Converts a base64 string to an array of bytes
+	 *   Parameters:
+	 *     input - Pointer to input string, padding optional
+	 *     input_length - Number of characters in input
+	 *     output - Pointer to output array
+	 *     output_size - Capacity of output, nothing is written past it. Output may be input itself,
+	 *                   the decoder never writes ahead of what it has read
+	 *   Returns:
+	 *     Number of bytes in the decoded binary, BASE64_INVALID or BASE64_OVERFLOW
+	 */
+	static int decode(const unsigned char input[], unsigned int input_length, unsigned char output[], unsigned int output_size);
 
 	/* decode_base64:
 	 *   Description:
-	 *     Converts a base64 null-terminated string to an array of bytes
+	 *     Converts a base64 null-terminated string to an array of bytes, the caller guarantees the output size
 	 *   Parameters:
 	 *     input - Pointer to input string
 	 *     output - Pointer to output array
 	 *   Returns:
-	 *     Number of bytes in the decoded binary
+	 *     Number of bytes in the decoded binary, 0 if the input is not valid
 	 */
 	static unsigned int decode(unsigned char input[], unsigned char output[]);
 
@@ -0,0 +1,120 @@
+/*
+ Host check and benchmark of Base64M.
+
+ The check compares encode/decode against a bit by bit reference for every length up to 300,
+ round trips, and makes sure corrupted characters and short buffers are reported.
+ The benchmark encodes/decodes a 256 byte payload (a large LoRaWAN frame) and a 4kB buffer.
+ Build with make, it produces one binary per code path: scalar, sse (SSSE3) and avx2.
+*/
+#include <Base64M.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static const char* ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static unsigned int reference(const unsigned char* in, unsigned int length, char* out) {
+	unsigned int bits = 0, n = 0;
+	unsigned int chars = 0;
+	for (unsigned int i = 0; i < length; i++) {
+		bits = (bits << 8) | in[i];
+		n += 8;
+		while (6 <= n) { n -= 6; out[chars++] = ALPHABET[(bits >> n) & 0x3F]; }
+	}
+	if (n) out[chars++] = ALPHABET[(bits << (6 - n)) & 0x3F];
+	while (chars % 4) out[chars++] = '=';
+	out[chars] = '\0';
+	return chars;
+}
+
+static int check() {
+	unsigned char in[300], back[300 + 32];
+	char expected[512], actual[512];
+	int failures = 0;
+	for (unsigned int length = 0; length <= 300; length++) {
+		for (unsigned int i = 0; i < length; i++) in[i] = (unsigned char) rand();
+		unsigned int chars = reference(in, length, expected);
+		unsigned int encoded = Base64::encode(in, length, (unsigned char*) actual);
+		if (chars != encoded || strcmp(expected, actual)) { printf("encode mismatch at length %u\n", length); failures++; }
+
+		int decoded = Base64::decode((unsigned char*) actual, chars, back, length);
+		if ((int) length != decoded || memcmp(in, back, length)) { printf("decode mismatch at length %u\n", length); failures++; }
+
+		// padding is optional
+		unsigned int unpadded = chars;
+		while (unpadded && '=' == actual[unpadded - 1]) unpadded--;
+		decoded = Base64::decode((unsigned char*) actual, unpadded, back, length);
+		if ((int) length != decoded || memcmp(in, back, length)) { printf("unpadded decode mismatch at length %u\n", length); failures++; }
+
+		if (length && BASE64_OVERFLOW != Base64::decode((unsigned char*) actual, chars, back, length - 1)) {
+			printf("overflow not reported at length %u\n", length); failures++;
+		}
+
+		for (unsigned int i = 0; i < unpadded; i++) {
+			char saved = actual[i];
+			actual[i] = (i & 1) ? '.' : (char) 0xC3;
+			if (BASE64_INVALID != Base64::decode((unsigned char*) actual, chars, back, sizeof(back))) {
+				printf("bad character not reported at %u/%u\n", i, chars); failures++;
+			}
+			actual[i] = saved;
+		}
+	}
+	return failures;
+}
+
+static double now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+class Counter {
+	public:
+	size_t total = 0;
+	size_t write(const unsigned char* buffer, size_t size) { total += size + buffer[0] * 0; return size; }
+};
+
+static void bench(unsigned int length, unsigned int rounds) {
+	unsigned char* in = new unsigned char[length];
+	unsigned char* encoded = new unsigned char[Base64::encode_length(length) + 1];
+	unsigned char* back = new unsigned char[length + 32];
+	for (unsigned int i = 0; i < length; i++) in[i] = (unsigned char) rand();
+	unsigned int chars = 0;
+	int decoded = 0;
+
+	double start = now();
+	for (unsigned int i = 0; i < rounds; i++) chars = Base64::encode(in, length, encoded);
+	double encode = now() - start;
+
+	start = now();
+	for (unsigned int i = 0; i < rounds; i++) decoded = Base64::decode(encoded, chars, back, length);
+	double decode = now() - start;
+
+	Counter counter;
+	start = now();
+	for (unsigned int i = 0; i < rounds; i++) Base64::encode(in, length, counter);
+	double stream = now() - start;
+
+	printf("%5u bytes: encode %8.1f ns (%6.0f MB/s)  decode %8.1f ns (%6.0f MB/s)  stream %8.1f ns %s\n", length,
+		1e9 * encode / rounds, length * rounds / encode / 1e6, 1e9 * decode / rounds, length * rounds / decode / 1e6,
+		1e9 * stream / rounds, (decoded == (int) length && counter.total == (size_t) chars * rounds) ? "" : "MISMATCH");
+	delete[] in;
+	delete[] encoded;
+	delete[] back;
+}
+
+int main(int argc, char** argv) {
+#if defined(__AVX2__)
+	const char* path = "avx2";
+#elif defined(__SSSE3__)
+	const char* path = "sse";
+#else
+	const char* path = "scalar";
+#endif
+	int failures = check();
+	printf("%s: check %s\n", path, failures ? "FAILED" : "OK");
+	if (failures) return 1;
+	bench(256, 1000000);
+	bench(4096, 100000);
+	return 0;
+}
@@ -30,10 +30,8 @@ namespace DS { // DS : Data Structure
 		void removeAt(uint32_t index) {
 			uint32_t newLength = this->length - 1;
 			T* newBuffer = new T[newLength];
-			for (uint32_t i = 0ul; i < this->length; i++) {
-				if (i != index) {
-					newBuffer[i] = this->buffer[i];
-				}
+			for (uint32_t i = 0ul; i < newLength; i++) {
+				newBuffer[i] = this->buffer[i < index ? i : i + 1u];
 			}
 			delete[] this->buffer;
 			this->length = newLength;
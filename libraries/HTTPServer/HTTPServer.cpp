@@ -24,6 +24,8 @@ void HTTPServer::setup(int port) {
 	this->server->on(String(F("/fwlink")), std::bind(&HTTPServer::handleRoot, this));
 	// iOS Captive Portal ????
 	this->server->on(String(F("/hotspot-detect.html")), std::bind(&HTTPServer::handleRoot, this));
+	const char* headers[] = {"If-None-Match"};
+	this->server->collectHeaders(headers, 1);
 	this->server->begin(); // Web server start
 }
 
@@ -32,15 +34,51 @@ void HTTPServer::loop() {
 }
 
 void HTTPServer::handleRoot() {
-	this->server->send_P(200, "text/html", App);
+	// the page must be revalidated, it points to the current versions of scripts and styles
+	this->asset(AppGz, sizeof(AppGz), AppType, AppETag, false);
 }
 
 void HTTPServer::scripts() {
-	this->server->send_P(200, "application/javascript", Scripts);
+	this->asset(ScriptsGz, sizeof(ScriptsGz), ScriptsType, ScriptsETag, true);
 }
 
 void HTTPServer::styles() {
-	this->server->send_P(200, "text/css", Styles);
+	this->asset(StylesGz, sizeof(StylesGz), StylesType, StylesETag, true);
+}
+
+void HTTPServer::asset(const uint8_t* data, size_t length, PGM_P type, PGM_P etag, bool immutable) {
+	String tag = FPSTR(etag);
+	this->server->sendHeader(F("ETag"), tag);
+	if (immutable) {
+		// the page requests them with ?v=<hash>, a new firmware means a new URL
+		this->server->sendHeader(F("Cache-Control"), F("public, max-age=31536000, immutable"));
+	} else {
+		this->server->sendHeader(F("Cache-Control"), F("no-cache"));
+	}
+
+	if (this->server->header(F("If-None-Match")) == tag) {
+		this->server->send(304);
+		return;
+	}
+
+	this->server->sendHeader(F("Content-Encoding"), F("gzip"));
+	this->server->setContentLength(length);
+	this->server->send(200, FPSTR(type), "");
+	for (size_t offset = 0u; offset < length; offset += HTTP_CHUNK) {
+		size_t chunk = (length - offset < HTTP_CHUNK) ? length - offset : HTTP_CHUNK;
+		this->server->sendContent_P((PGM_P) (data + offset), chunk);
+		yield();
+		if (this->idle) this->idle();
+	}
+}
+
+HTTPServer::Content::Content(ESP8266WebServer* server) : server(server) {
+
+}
+
+size_t HTTPServer::Content::write(const uint8_t* data, size_t length) {
+	this->server->sendContent_P((PGM_P) data, length); // RAM is readable as PGM on the ESP8266
+	return length;
 }
 
 void HTTPServer::handleNotFound() {
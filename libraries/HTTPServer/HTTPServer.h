@@ -3,16 +3,33 @@
 
 #include <ESP8266WebServer.h>
 #define ARDUINOJSON_USE_DOUBLE 1
+#define ARDUINOJSON_FAST_FLOAT 1
 #include <ArduinoJson.h>
 #include <AESM.h>
 
-#include <app.h>
-#include <scripts.h>
-#include <styles.h>
+#include <functional>
+// app.h, scripts.h and styles.h are the sources, tools/assets.py gzips them into assets.h
+#include <assets.h>
+
+#define HTTP_CHUNK 1460u // one TCP segment per write
+#define HTTP_BODY 256u   // stack buffer of HTTPServer::Body
 
 class HTTPServer {
 	public:
+	// the response body as a sink, the headers with the Content-Length must be sent already
+	class Content {
+		public:
+		ESP8266WebServer* server = NULL;
+
+		Content(ESP8266WebServer* server);
+		size_t write(const uint8_t* data, size_t length);
+	};
+
+	// gathers the small writes of the streaming encoders (serializeJson, Base64::encode) into the body
+	typedef BufferedWriter<Content, HTTP_BODY> Body;
+
 	ESP8266WebServer* server = NULL;
+	std::function<void()> idle = NULL; // called between chunks of long responses
 
 	HTTPServer();
 	virtual ~HTTPServer();
@@ -22,6 +39,7 @@ class HTTPServer {
 	void scripts();
 	void styles();
 	void handleNotFound();
+	void asset(const uint8_t* data, size_t length, PGM_P type, PGM_P etag, bool immutable);
 };
 
 #endif
@@ -0,0 +1,1560 @@
+// Generated by tools/assets.py from app.h, scripts.h and styles.h, DO NOT EDIT
+#ifndef __assets__
+#define __assets__
+
+#include <Arduino.h>
+
+// styles.h: 10141 bytes, 2631 gzipped
+const uint8_t StylesGz[] PROGMEM = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x1a, 0x69, 0x8f, 0xda, 0x48, 0xf6, 0xaf, 0x78, 0x84, 0x90, 0x1a, 0x09, 0x90,
+	0x0f, 0x0c, 0xb4, 0xf9, 0xb2, 0x9d, 0x4e, 0x7a, 0x67, 0xa5, 0x24, 0x13, 0xa5, 0x67, 0x27, 0xd2, 0x7e, 0x59, 0x15, 0x76, 0x01, 0x35, 0x31, 0x36,
+	0x2a, 0x9b, 0x6e, 0x18, 0x8b, 0xff, 0x3e, 0xaf, 0x2e, 0xbb, 0xec, 0x2a, 0xd3, 0x24, 0x23, 0xd2, 0xc4, 0xae, 0xe3, 0xd5, 0xbb, 0xaf, 0x22, 0x21,
+	0x2f, 0xd3, 0xc7, 0x3c, 0xdb, 0x90, 0xed, 0x91, 0xa2, 0x92, 0xe4, 0x59, 0xf5, 0x4a, 0x92, 0x72, 0x17, 0x79, 0xae, 0x3b, 0xbc, 0x24, 0x30, 0xf9,
+	0x0d, 0x91, 0x92, 0x64, 0xdb, 0xea, 0x90, 0x17, 0x84, 0xcd, 0x47, 0x68, 0x5d, 0xe4, 0xe9, 0xb1, 0xc4, 0xab, 0x32, 0x3f, 0x44, 0xee, 0x2a, 0xc5,
+	0x9b, 0x12, 0xfe, 0xa3, 0x64, 0xbb, 0x63, 0xff, 0xaf, 0xf3, 0xb2, 0xcc, 0xf7, 0xec, 0x01, 0xc5, 0xdf, 0xb7, 0x34, 0x3f, 0x66, 0x49, 0x54, 0x52,
+	0x94, 0x15, 0x07, 0x44, 0x71, 0x56, 0x72, 0x90, 0xad, 0xf3, 0x1c, 0x36, 0xf2, 0x7c, 0x2e, 0x4a, 0xbc, 0xff, 0x84, 0x8b, 0x02, 0x6d, 0x71, 0xd1,
+	0x9c, 0xb5, 0x21, 0x27, 0x9c, 0xac, 0xfe, 0x9a, 0x90, 0x2c, 0xc1, 0xa7, 0xc8, 0x97, 0x47, 0xd6, 0x67, 0x74, 0xce, 0x4e, 0x48, 0x71, 0x48, 0xd1,
+	0x39, 0xda, 0xa4, 0xf8, 0xb4, 0xfa, 0xf3, 0x58, 0x94, 0x64, 0x73, 0x9e, 0xc4, 0x79, 0x56, 0xc2, 0xc1, 0x51, 0x0c, 0x5f, 0x98, 0xae, 0x50, 0x4a,
+	0xb6, 0xd9, 0x84, 0xc0, 0x69, 0x85, 0x1c, 0xba, 0x09, 0x25, 0x3e, 0xf4, 0x0d, 0xd0, 0xc8, 0x5f, 0x1b, 0xec, 0x28, 0x4e, 0x61, 0xfd, 0x0b, 0xd6,
+	0x69, 0x4d, 0x49, 0x86, 0x11, 0x9d, 0x6c, 0x29, 0x4a, 0x08, 0x80, 0xbf, 0x1b, 0xc4, 0xf7, 0xec, 0x33, 0x1e, 0x60, 0x8c, 0xc7, 0xf2, 0x65, 0x04,
+	0x14, 0x9c, 0x26, 0xc5, 0x0e, 0x01, 0xb4, 0xc8, 0x75, 0x5c, 0xc7, 0xc3, 0x7b, 0x67, 0x10, 0x04, 0x01, 0x8c, 0xd3, 0x04, 0xd3, 0x09, 0xdb, 0x7c,
+	0x2c, 0xa2, 0xe0, 0x70, 0x5a, 0x09, 0x69, 0xdc, 0x4b, 0x61, 0xfc, 0x00, 0x9a, 0xfc, 0xf1, 0xdd, 0x11, 0x38, 0x95, 0xf5, 0xc8, 0x6e, 0xe2, 0x4e,
+	0x43, 0xbc, 0x17, 0x4c, 0x84, 0xe7, 0x39, 0x7b, 0x91, 0xc2, 0x9f, 0x02, 0x46, 0xab, 0x1d, 0xe6, 0x7c, 0x15, 0x2f, 0x7b, 0x44, 0xb7, 0x24, 0x03,
+	0x26, 0x1f, 0x50, 0x92, 0x80, 0x3e, 0x44, 0xd3, 0x19, 0x8c, 0xb6, 0xf1, 0x0d, 0xdd, 0x61, 0x97, 0xb2, 0xa9, 0xcf, 0x48, 0x9b, 0x7b, 0xec, 0x73,
+	0x3b, 0x05, 0x1f, 0xd1, 0x1a, 0xa7, 0x16, 0x3e, 0xab, 0xb3, 0x19, 0x50, 0xf6, 0xc7, 0x10, 0xcb, 0x5f, 0x30, 0xdd, 0xa4, 0xf9, 0xeb, 0xe4, 0x1c,
+	0xa1, 0x63, 0x99, 0x5f, 0xfe, 0xf5, 0x1d, 0x9f, 0x37, 0x14, 0xed, 0x01, 0xd4, 0xd7, 0xbc, 0x44, 0x25, 0x7e, 0x4c, 0xf3, 0xf8, 0x7b, 0xb5, 0xa1,
+	0xf9, 0xbe, 0xe2, 0x8a, 0xb8, 0xc9, 0xe9, 0x3e, 0xa2, 0x7c, 0xea, 0xce, 0x1d, 0x5d, 0xca, 0xdc, 0x1c, 0x0e, 0xe6, 0x6e, 0x82, 0xb7, 0xa3, 0x8b,
+	0x05, 0x18, 0x08, 0x19, 0x74, 0xe6, 0x27, 0x60, 0x4e, 0x6a, 0xa0, 0x8c, 0xc2, 0xff, 0xc4, 0xbd, 0x62, 0x89, 0x51, 0x1a, 0xdf, 0x01, 0x2b, 0x9d,
+	0x89, 0xc3, 0xe4, 0x33, 0x12, 0x02, 0x32, 0x46, 0x95, 0x74, 0x1a, 0xa1, 0x31, 0x79, 0xd4, 0x8a, 0x08, 0x7a, 0x9f, 0xe6, 0x54, 0x37, 0x3d, 0x25,
+	0x2c, 0x76, 0x06, 0x03, 0xe1, 0xc0, 0x99, 0x24, 0x71, 0x06, 0x1f, 0x3e, 0x7c, 0xa8, 0xe5, 0xc8, 0x41, 0xea, 0x93, 0xfe, 0x72, 0x89, 0x97, 0x58,
+	0xcd, 0x4b, 0xc3, 0xeb, 0xd9, 0xcd, 0xf1, 0xec, 0xdf, 0xac, 0x29, 0x49, 0x7e, 0x40, 0x31, 0x29, 0xcf, 0x91, 0xe7, 0xfc, 0x42, 0xf6, 0x87, 0x9c,
+	0x96, 0x88, 0xa3, 0x57, 0x6b, 0xce, 0x0b, 0xa2, 0x77, 0x13, 0x78, 0x81, 0x99, 0x49, 0x33, 0x3c, 0x5a, 0xa1, 0x8c, 0xec, 0xb9, 0xe2, 0x44, 0x9a,
+	0x68, 0x1d, 0xbf, 0x70, 0x84, 0xd5, 0x39, 0x04, 0x74, 0x2b, 0x03, 0xdb, 0xbe, 0x5d, 0xd3, 0x98, 0x1c, 0xea, 0x87, 0x4a, 0x39, 0x90, 0x2c, 0xcf,
+	0xb0, 0x62, 0xf0, 0xb4, 0x31, 0x0b, 0xfe, 0x78, 0x0b, 0x8b, 0x4d, 0x3e, 0x6a, 0x6c, 0xb2, 0x30, 0xb1, 0xcd, 0x28, 0x83, 0x8f, 0xda, 0xe6, 0xae,
+	0xf0, 0x7e, 0x8c, 0xc5, 0x06, 0xff, 0x34, 0x6d, 0x76, 0x3c, 0x3b, 0x1b, 0xbf, 0x00, 0xaf, 0x1e, 0x85, 0x0f, 0xe5, 0x8c, 0xfa, 0x1d, 0x9f, 0x4a,
+	0xf9, 0x5e, 0x29, 0x7b, 0x0c, 0x86, 0xcc, 0x89, 0xc1, 0xd7, 0xaa, 0x84, 0x59, 0x25, 0xc5, 0x89, 0x77, 0x38, 0x39, 0xec, 0x8f, 0x13, 0x20, 0x1d,
+	0xd9, 0x72, 0x58, 0xbb, 0x12, 0xd8, 0xb1, 0xda, 0x00, 0xa4, 0x49, 0x41, 0xfe, 0xc2, 0xd1, 0x32, 0x1c, 0x8a, 0xdd, 0xdc, 0x43, 0xeb, 0xbe, 0xb9,
+	0x8b, 0xc1, 0xe3, 0x2e, 0x27, 0x31, 0xfe, 0x0a, 0x9e, 0x18, 0x4c, 0xbf, 0x24, 0x60, 0x19, 0x72, 0xcf, 0x9e, 0x24, 0x49, 0x8a, 0x75, 0x28, 0x8c,
+	0x95, 0x6f, 0xe2, 0xc4, 0x42, 0x5d, 0xcf, 0xd1, 0xf2, 0xd8, 0xa7, 0x3c, 0x87, 0x91, 0xca, 0x20, 0x81, 0x93, 0xac, 0x98, 0xe0, 0xd5, 0x4c, 0xd0,
+	0x64, 0xc5, 0x8e, 0x12, 0xa2, 0xa2, 0xdb, 0x35, 0xba, 0xf3, 0x42, 0x77, 0xac, 0xfe, 0xdc, 0xe9, 0x72, 0xb4, 0x12, 0x2a, 0x34, 0x58, 0x2e, 0x97,
+	0xe6, 0x79, 0x0e, 0xaa, 0x9a, 0xe9, 0x7e, 0x2a, 0xf8, 0x46, 0xb1, 0xe3, 0x63, 0xbe, 0xcd, 0xb5, 0xf8, 0x5d, 0xfb, 0x08, 0xbf, 0x76, 0xe0, 0x02,
+	0xa9, 0xa1, 0xae, 0xc5, 0xb5, 0x17, 0x92, 0x11, 0x52, 0x9b, 0xe2, 0x82, 0x61, 0x01, 0x14, 0x91, 0x4c, 0x1f, 0xa7, 0xf8, 0x80, 0x51, 0x09, 0x66,
+	0x22, 0x9f, 0x74, 0xdc, 0xbf, 0x51, 0x74, 0x00, 0x5e, 0xed, 0xd1, 0x69, 0x22, 0x30, 0x59, 0xb8, 0x2f, 0x3b, 0xbe, 0xe0, 0x33, 0x2e, 0x5f, 0x73,
+	0xfa, 0xbd, 0xf8, 0x48, 0x8a, 0x52, 0x62, 0xc9, 0xbd, 0x1a, 0x30, 0x14, 0xbc, 0xda, 0xec, 0x70, 0x1a, 0x19, 0xa2, 0x53, 0x7c, 0x66, 0xbe, 0x7e,
+	0xa8, 0x03, 0x01, 0xe9, 0x17, 0x16, 0x4a, 0x05, 0x3c, 0x58, 0x3d, 0x71, 0x96, 0x0c, 0x5e, 0x27, 0x38, 0x34, 0xef, 0xa7, 0x68, 0x07, 0xca, 0x82,
+	0xb3, 0x15, 0xb7, 0x5e, 0x41, 0xbf, 0x80, 0xe1, 0x4c, 0x83, 0x62, 0x65, 0x57, 0xac, 0x1b, 0x3c, 0x94, 0xe1, 0x1d, 0xb8, 0xd8, 0x41, 0xda, 0xe2,
+	0x9f, 0x3b, 0xf5, 0x46, 0x5d, 0x32, 0x7e, 0xe5, 0x88, 0x54, 0x92, 0x02, 0xb7, 0x33, 0x6d, 0x21, 0x92, 0x49, 0x93, 0x59, 0xea, 0x44, 0x7b, 0x8f,
+	0x8f, 0xb4, 0x80, 0xd3, 0x0e, 0x39, 0xa9, 0x75, 0xb7, 0x81, 0x11, 0xed, 0x18, 0xdd, 0x95, 0x1d, 0x37, 0x3f, 0x0c, 0xc7, 0xea, 0xcf, 0x9d, 0xfa,
+	0x23, 0xeb, 0xde, 0x08, 0xc5, 0x2c, 0x00, 0xdf, 0x04, 0x62, 0xd6, 0x05, 0xc1, 0x8d, 0xf6, 0x33, 0x04, 0x51, 0x53, 0xe8, 0x3e, 0x17, 0x95, 0xcf,
+	0xe2, 0x99, 0x14, 0xf5, 0x34, 0x1c, 0x76, 0x44, 0xcd, 0xf5, 0xa5, 0x95, 0xcd, 0x48, 0x83, 0x73, 0x75, 0xd7, 0x56, 0x6f, 0x07, 0x88, 0xad, 0x61,
+	0xa5, 0x86, 0x61, 0x93, 0xd1, 0xd8, 0x18, 0x28, 0x16, 0xb1, 0x9c, 0xc6, 0x2a, 0x7b, 0x3b, 0x42, 0x75, 0xc2, 0xaa, 0xe9, 0x2d, 0xf7, 0xfd, 0x2b,
+	0x8d, 0x52, 0x26, 0x3a, 0x20, 0xd2, 0xe3, 0x5f, 0x9c, 0x5e, 0x1e, 0xbf, 0x35, 0xd3, 0x16, 0x4e, 0xb0, 0x3c, 0xa7, 0x38, 0x22, 0x25, 0x40, 0x89,
+	0xf9, 0x69, 0x0f, 0xc9, 0x0b, 0xca, 0x62, 0x9c, 0xe8, 0x1a, 0xa0, 0xd9, 0x83, 0xcb, 0xf3, 0x80, 0xd6, 0x4a, 0x3d, 0x49, 0x6d, 0x6d, 0x3a, 0x29,
+	0x4a, 0x5d, 0x5d, 0xdf, 0x9b, 0x71, 0xae, 0xf3, 0xca, 0x36, 0x94, 0x65, 0xb4, 0xce, 0x82, 0x4f, 0xdf, 0x51, 0xbf, 0x1d, 0x40, 0x7b, 0xb5, 0x33,
+	0xe0, 0xcc, 0x97, 0x9d, 0x26, 0x03, 0x73, 0xdf, 0xef, 0xa4, 0x4c, 0xb1, 0x8e, 0x61, 0x5b, 0x7b, 0x05, 0x3f, 0x5e, 0x05, 0xb4, 0x75, 0x9e, 0x26,
+	0x26, 0x83, 0xec, 0x3e, 0x9e, 0x55, 0x09, 0x19, 0x4f, 0x89, 0x7a, 0xce, 0xd4, 0x92, 0xcb, 0x1f, 0x08, 0x1d, 0xb7, 0x81, 0x7d, 0xa0, 0x14, 0xd8,
+	0xde, 0x0a, 0xe1, 0xf3, 0x26, 0x4e, 0x33, 0x31, 0xb7, 0x92, 0x03, 0xb7, 0x9b, 0x0e, 0xcc, 0xea, 0xc5, 0x7d, 0x39, 0x9b, 0x7d, 0x85, 0x26, 0xd0,
+	0x3a, 0xe7, 0xec, 0xf7, 0x61, 0x6f, 0x52, 0xf0, 0x3e, 0x7f, 0xcd, 0x8c, 0xe4, 0xf5, 0x7f, 0x77, 0xf7, 0x22, 0x77, 0xe5, 0x59, 0x14, 0x86, 0x93,
+	0x51, 0x99, 0xd3, 0xca, 0xa2, 0xe4, 0x2d, 0x4b, 0x06, 0x7c, 0x45, 0xca, 0x64, 0x8b, 0x87, 0x83, 0x87, 0x87, 0x87, 0x0e, 0x0f, 0xb4, 0xc9, 0xc7,
+	0xc7, 0xc7, 0x8b, 0xb2, 0xf7, 0x2b, 0xd5, 0x95, 0x70, 0xc3, 0x29, 0xe3, 0xa8, 0x70, 0x48, 0x23, 0x27, 0x1c, 0x8e, 0xc5, 0x68, 0x82, 0xe8, 0x77,
+	0x35, 0x38, 0x77, 0x87, 0xa3, 0x5b, 0xdc, 0xb7, 0x1e, 0x64, 0x79, 0x12, 0x68, 0xa4, 0x05, 0xa6, 0x72, 0x0a, 0x43, 0x7e, 0xdd, 0x41, 0xc2, 0xd4,
+	0x55, 0xe4, 0x63, 0x01, 0xc4, 0x15, 0x38, 0xc5, 0x71, 0x29, 0xc0, 0x09, 0x7a, 0x75, 0x42, 0x17, 0x8b, 0x45, 0x93, 0x41, 0x30, 0x53, 0xd3, 0xed,
+	0x4e, 0xcb, 0x3d, 0xbb, 0x5c, 0x16, 0x55, 0x44, 0x76, 0x38, 0x82, 0xf1, 0x76, 0xfc, 0x22, 0x67, 0xbc, 0xdb, 0x54, 0x6c, 0x32, 0x6d, 0x09, 0x87,
+	0x8a, 0xa3, 0x7d, 0x3e, 0xbd, 0x87, 0xbd, 0x3a, 0x23, 0x6b, 0xee, 0xb6, 0x78, 0xce, 0xd8, 0xcb, 0x11, 0x7a, 0x4f, 0x0a, 0xb4, 0x4e, 0x71, 0xf2,
+	0xb6, 0xe4, 0x06, 0xeb, 0x7b, 0xf6, 0x61, 0x00, 0x07, 0xf3, 0x90, 0x7d, 0xfa, 0xa0, 0xdc, 0x8c, 0xad, 0x82, 0xc3, 0x40, 0x4a, 0xe8, 0x35, 0x48,
+	0xb3, 0x18, 0x78, 0xdc, 0xa1, 0x6c, 0x8b, 0xab, 0x8e, 0xc4, 0xec, 0x3c, 0x04, 0xdf, 0xad, 0xd5, 0x5f, 0x0b, 0xa6, 0xe4, 0x5a, 0xe2, 0x0a, 0x0e,
+	0x4c, 0xfa, 0x32, 0x16, 0x3e, 0xa4, 0x5f, 0x7f, 0xff, 0xfe, 0xbd, 0xa9, 0x4d, 0x5d, 0x7d, 0x68, 0x84, 0xf8, 0xb5, 0xeb, 0xb2, 0x1b, 0x13, 0x72,
+	0x5b, 0xab, 0x9a, 0x60, 0xfa, 0xa6, 0x07, 0xd3, 0x23, 0x91, 0x0f, 0x49, 0x6b, 0x13, 0x37, 0xfd, 0x61, 0xed, 0xd0, 0x5b, 0x70, 0x85, 0x3e, 0xb1,
+	0xa7, 0x3f, 0x50, 0x7a, 0xc4, 0x55, 0xd7, 0x1d, 0x36, 0x09, 0xf0, 0x8d, 0xb0, 0x6e, 0x74, 0xb3, 0x9a, 0x8a, 0x2f, 0x84, 0x86, 0xb3, 0xbe, 0xc1,
+	0xa8, 0x0f, 0x41, 0xc2, 0x41, 0x9b, 0xa6, 0x59, 0x0b, 0x2f, 0xb0, 0xb3, 0x4d, 0xdb, 0x0d, 0x51, 0x80, 0x6e, 0x55, 0x0c, 0x02, 0xd3, 0xd0, 0x12,
+	0x05, 0x5f, 0x85, 0xd5, 0xde, 0xbd, 0xcf, 0xcc, 0x6f, 0xc8, 0xbd, 0x33, 0xd9, 0x99, 0xf9, 0x15, 0xa7, 0x87, 0xea, 0x4a, 0x21, 0x6e, 0xaf, 0xd4,
+	0x60, 0x77, 0x83, 0x35, 0xdf, 0xd7, 0x69, 0x0c, 0xb1, 0x1c, 0x3f, 0x0c, 0xc3, 0x6b, 0x4e, 0xc6, 0x5e, 0x18, 0xb0, 0x6e, 0x92, 0xbd, 0xa6, 0x69,
+	0x91, 0xc5, 0xd0, 0xee, 0x4b, 0x0f, 0x07, 0x41, 0x8c, 0xe0, 0x73, 0x4d, 0x4d, 0xcc, 0x8e, 0x5d, 0xdd, 0xca, 0x50, 0x3e, 0x9d, 0xa9, 0x73, 0xa7,
+	0x4f, 0xa7, 0x29, 0x7a, 0x63, 0x46, 0xd3, 0x45, 0x6d, 0x3c, 0x14, 0x27, 0x6f, 0xeb, 0xa6, 0x3d, 0x69, 0xea, 0xd9, 0xf2, 0x85, 0xf1, 0xca, 0x82,
+	0xa4, 0x4c, 0x0d, 0x0f, 0x27, 0x95, 0x1a, 0xb2, 0xc7, 0x4e, 0x13, 0xc6, 0x9f, 0x86, 0xac, 0x94, 0x90, 0xf4, 0xd8, 0x26, 0x8c, 0x1e, 0x98, 0xc1,
+	0xc9, 0x27, 0xd7, 0xed, 0x8a, 0x36, 0x60, 0x52, 0xf2, 0x17, 0xfe, 0x35, 0xb4, 0x45, 0xaa, 0xd2, 0x4a, 0x42, 0xdc, 0xc3, 0x49, 0x44, 0x61, 0x90,
+	0x2a, 0x4a, 0x79, 0xd7, 0x02, 0x02, 0x99, 0xd4, 0x5c, 0xe0, 0x20, 0x8b, 0x6a, 0x4d, 0x67, 0x48, 0x3e, 0xaa, 0x70, 0xc7, 0xdf, 0x46, 0x92, 0x6a,
+	0x39, 0xc8, 0x5f, 0x46, 0x1d, 0x98, 0x22, 0xdd, 0x46, 0xb4, 0x97, 0x65, 0xcc, 0xc4, 0x6c, 0xbd, 0x5e, 0x49, 0xf0, 0x96, 0xe2, 0x73, 0x4f, 0xd8,
+	0x7f, 0xf7, 0xee, 0x5d, 0xab, 0xd1, 0x61, 0x9f, 0x12, 0xaa, 0xd2, 0x89, 0x93, 0xbd, 0xd9, 0x82, 0x98, 0x34, 0x2d, 0xc7, 0xf3, 0x3c, 0x2b, 0x61,
+	0xae, 0xa7, 0xca, 0xad, 0xa9, 0x5f, 0xb7, 0x40, 0xa7, 0x2a, 0xc1, 0x33, 0x56, 0xfb, 0x95, 0xde, 0x0b, 0xaa, 0x73, 0x3b, 0xfb, 0xe2, 0xa0, 0x5e,
+	0xbc, 0xa8, 0x57, 0x7b, 0xfd, 0xb0, 0x67, 0x95, 0x26, 0x2e, 0xb9, 0x58, 0xc1, 0x36, 0x5a, 0x2f, 0x20, 0x84, 0x6b, 0x1e, 0xf5, 0x87, 0x7b, 0x1c,
+	0xdd, 0x9c, 0xff, 0x22, 0x4f, 0x91, 0x8e, 0x2c, 0x08, 0xa6, 0x41, 0x60, 0x64, 0xe7, 0xf6, 0x1a, 0x10, 0x6a, 0x5b, 0xf6, 0x81, 0x02, 0xb2, 0xe9,
+	0xd2, 0x0e, 0xa5, 0x13, 0x7e, 0xe6, 0x11, 0x0f, 0x2a, 0x99, 0x6b, 0xbd, 0x33, 0x71, 0xb6, 0xeb, 0x56, 0x1d, 0x7b, 0x02, 0x3a, 0x9a, 0xf2, 0xe3,
+	0xf9, 0x95, 0x94, 0xf1, 0x4e, 0x66, 0x17, 0x8a, 0xb2, 0x46, 0xcf, 0x83, 0xbe, 0xf2, 0xcd, 0x56, 0x1f, 0xeb, 0xb0, 0xa4, 0xbe, 0x2b, 0xec, 0x7a,
+	0x3a, 0xb3, 0xc1, 0x72, 0xa8, 0x74, 0x9e, 0x3d, 0x0a, 0x69, 0x01, 0x5f, 0xa5, 0xb2, 0x5a, 0x2d, 0x7f, 0x33, 0x67, 0x1f, 0x4b, 0x63, 0x5f, 0xd3,
+	0x57, 0x92, 0x15, 0xb8, 0xe4, 0x54, 0xce, 0x98, 0xd4, 0x98, 0x36, 0xdf, 0x82, 0xef, 0x23, 0xa1, 0x31, 0xd4, 0x51, 0x76, 0x5c, 0x65, 0xe2, 0x5d,
+	0xb7, 0x1a, 0x2d, 0x62, 0xc3, 0x89, 0x21, 0xda, 0xb7, 0xda, 0xf9, 0xa1, 0xc2, 0x4f, 0xab, 0x3a, 0x18, 0x1b, 0x9c, 0xa9, 0x5f, 0x8c, 0xa9, 0x28,
+	0x25, 0xfd, 0xe2, 0x1a, 0xba, 0xbf, 0x7d, 0xae, 0x04, 0xbb, 0xc2, 0xa1, 0xd6, 0xd8, 0x86, 0x08, 0xac, 0xfa, 0x00, 0x1a, 0x9e, 0x64, 0x0f, 0x06,
+	0x10, 0x31, 0x6c, 0x40, 0x9c, 0x75, 0x9a, 0x17, 0x73, 0x38, 0xe3, 0x33, 0x4e, 0x41, 0x71, 0xc7, 0x83, 0x8d, 0x3b, 0x4f, 0xdc, 0xf9, 0xe8, 0xea,
+	0x99, 0x4f, 0x4f, 0x15, 0x3f, 0x2b, 0x54, 0xb2, 0xfa, 0xd9, 0x43, 0x07, 0x3c, 0x22, 0xa2, 0xf1, 0x60, 0x39, 0x5b, 0xa0, 0x45, 0xd0, 0x73, 0xaa,
+	0xba, 0x32, 0xeb, 0x36, 0xee, 0x79, 0x75, 0xa4, 0x21, 0xa0, 0x8d, 0xfe, 0x34, 0x02, 0xeb, 0x3c, 0x39, 0x57, 0xc6, 0xe5, 0x8c, 0xab, 0xd2, 0x50,
+	0x96, 0x3b, 0x98, 0x4a, 0x89, 0xd7, 0x78, 0x9d, 0xa0, 0x95, 0x59, 0x01, 0x35, 0x91, 0x09, 0x5c, 0xe7, 0xaa, 0x95, 0xe5, 0xd7, 0x19, 0x8c, 0x5e,
+	0x10, 0x44, 0x03, 0xef, 0x7e, 0xb6, 0x9e, 0xad, 0x19, 0x1f, 0x2c, 0xf7, 0x35, 0xaa, 0x9f, 0x4e, 0x32, 0xde, 0x6e, 0x59, 0xb3, 0x3e, 0xf3, 0xa5,
+	0x27, 0x7b, 0xbb, 0xec, 0xbc, 0xaa, 0xc9, 0x06, 0xc2, 0x97, 0xd7, 0x9e, 0xf4, 0x65, 0x87, 0x51, 0x52, 0xf7, 0x62, 0x7b, 0xdc, 0xda, 0xb5, 0x22,
+	0xc1, 0x9b, 0x85, 0x28, 0x04, 0x06, 0x0a, 0x6a, 0x8c, 0xab, 0x38, 0x6e, 0x81, 0xbe, 0xef, 0x5f, 0xa6, 0x69, 0xbe, 0xcd, 0xff, 0xcf, 0xa8, 0x3c,
+	0x52, 0xd5, 0x87, 0x8d, 0xe3, 0xfb, 0xd0, 0x9b, 0x69, 0x68, 0x70, 0x71, 0xb3, 0x85, 0xfc, 0xa1, 0xe4, 0x7d, 0x0d, 0x8d, 0xf3, 0x0d, 0x3d, 0x1e,
+	0xb7, 0x41, 0xbd, 0x55, 0x2c, 0x26, 0x37, 0x68, 0x4f, 0xd2, 0x73, 0x84, 0x28, 0x08, 0x7b, 0x5c, 0x80, 0x4d, 0x41, 0x79, 0x40, 0xc9, 0xa6, 0x95,
+	0xef, 0xd9, 0x33, 0x1d, 0x2d, 0x38, 0x58, 0xfa, 0x6a, 0x2c, 0x31, 0xa9, 0x8b, 0x97, 0xab, 0x1c, 0x52, 0x82, 0xd4, 0x83, 0x6f, 0xed, 0x7a, 0x2d,
+	0x05, 0x2b, 0xab, 0xcc, 0xad, 0x5d, 0x79, 0xf1, 0xfc, 0x09, 0xd1, 0xb8, 0xb2, 0xaa, 0xa1, 0x26, 0x31, 0xf3, 0x1c, 0x9d, 0x19, 0x0f, 0x9c, 0x19,
+	0x90, 0x99, 0xbe, 0x60, 0xe6, 0xc9, 0xc7, 0xcf, 0x0d, 0x5b, 0xfe, 0xe9, 0x45, 0xab, 0xf2, 0x5f, 0x3d, 0x35, 0xe1, 0x37, 0xf2, 0x44, 0x9a, 0x48,
+	0xab, 0x37, 0xc0, 0xac, 0x91, 0xf2, 0x0d, 0x00, 0x4e, 0x3b, 0x9a, 0x6a, 0x26, 0xbf, 0xd4, 0xf2, 0x46, 0x33, 0x9b, 0x61, 0x51, 0x5b, 0xeb, 0xd6,
+	0x83, 0x46, 0xaa, 0x57, 0xb9, 0x96, 0x05, 0xf8, 0xdb, 0x11, 0xe8, 0x0f, 0xa9, 0x0a, 0x2c, 0xf7, 0x53, 0xb3, 0x1f, 0x82, 0xe9, 0x75, 0x60, 0x0a,
+	0xd6, 0x6a, 0x30, 0x85, 0x9b, 0x53, 0x40, 0x19, 0x88, 0xc7, 0x94, 0x34, 0xba, 0x5a, 0xff, 0xbc, 0x00, 0x8e, 0x03, 0xb2, 0x71, 0xd5, 0xba, 0xbb,
+	0x67, 0x5f, 0x93, 0x84, 0x50, 0xc8, 0x1a, 0xf8, 0xc5, 0x04, 0x84, 0xb5, 0x3d, 0x80, 0xc4, 0x20, 0x83, 0x02, 0xaf, 0xae, 0xb7, 0x9d, 0x44, 0x5f,
+	0xb4, 0xbe, 0xfa, 0x70, 0x6d, 0xa1, 0x4f, 0xd8, 0x95, 0x4d, 0x37, 0xea, 0x9b, 0x16, 0xad, 0x3a, 0xd5, 0x75, 0x73, 0x9f, 0x67, 0x39, 0x24, 0x2c,
+	0x31, 0xee, 0xdc, 0x5c, 0x75, 0x6f, 0xa1, 0x35, 0xd2, 0x44, 0x26, 0x0f, 0xda, 0xaa, 0xaa, 0xcd, 0x7b, 0xad, 0xbe, 0x57, 0xbf, 0xb1, 0x30, 0x7e,
+	0x76, 0xf1, 0xf5, 0xe9, 0x93, 0x65, 0xc8, 0xb1, 0xb7, 0x02, 0x64, 0xba, 0xb6, 0xbc, 0xb2, 0x4e, 0x94, 0xe3, 0x1a, 0xeb, 0xe6, 0xdd, 0x42, 0xfb,
+	0x1d, 0x63, 0x10, 0xa2, 0x67, 0x51, 0xe4, 0x8e, 0xf5, 0xa1, 0x9e, 0x62, 0xab, 0xde, 0x51, 0x23, 0x72, 0xc3, 0x3a, 0xb3, 0x08, 0x6f, 0x7c, 0x84,
+	0x70, 0x2c, 0x90, 0x0e, 0x39, 0x96, 0xc6, 0x48, 0xd8, 0x68, 0x8c, 0x76, 0xcf, 0x64, 0xbf, 0x56, 0x6c, 0xaa, 0x79, 0x2f, 0x50, 0xd7, 0x4f, 0xa6,
+	0x62, 0x77, 0x6c, 0xd3, 0x0f, 0x6b, 0xd7, 0xf9, 0x8f, 0x53, 0x5e, 0xcb, 0xe5, 0xf3, 0x2d, 0x49, 0xb0, 0xd9, 0x5d, 0xb4, 0x17, 0x51, 0xc6, 0x9d,
+	0x7d, 0xdb, 0x41, 0xf7, 0x15, 0x58, 0xe6, 0x2d, 0x74, 0x33, 0xd9, 0xee, 0x3a, 0x9b, 0x31, 0x71, 0x91, 0xb0, 0x4f, 0x1f, 0x27, 0xdf, 0xc8, 0xdb,
+	0x6d, 0x3b, 0xbc, 0x71, 0xdf, 0x8c, 0xdf, 0x81, 0x55, 0xb7, 0xca, 0x6c, 0x8b, 0x83, 0x3e, 0x4f, 0xd4, 0xb7, 0xa3, 0x7b, 0xf9, 0xd0, 0x73, 0xe7,
+	0xc8, 0xef, 0xb4, 0xc1, 0x40, 0x0d, 0x91, 0x70, 0xb8, 0x1f, 0xf3, 0xaf, 0xe8, 0xdb, 0xc3, 0xe7, 0x7f, 0xa3, 0x12, 0xbf, 0xa2, 0xb3, 0x9e, 0xcd,
+	0xb0, 0x9b, 0x73, 0x88, 0x5f, 0x97, 0xe6, 0x07, 0x07, 0x5d, 0x3b, 0x16, 0xa3, 0x1c, 0x99, 0xa7, 0x63, 0x9a, 0xfe, 0x01, 0x4e, 0x8d, 0xfd, 0xee,
+	0xea, 0x2d, 0x37, 0xa3, 0x7e, 0x03, 0xf4, 0xe1, 0xf9, 0xcb, 0xb3, 0xa5, 0xf5, 0x1e, 0xb4, 0x42, 0xbe, 0x76, 0x2f, 0x1d, 0x48, 0x1f, 0xcc, 0xf6,
+	0xf1, 0x43, 0xff, 0x7b, 0x60, 0x41, 0x13, 0xcb, 0x2a, 0xaa, 0xf5, 0x9b, 0x87, 0xce, 0xad, 0x91, 0x7c, 0xd5, 0x53, 0x97, 0x76, 0x63, 0x94, 0x97,
+	0xcf, 0xfa, 0x55, 0x54, 0x7d, 0x88, 0x46, 0xd9, 0xb8, 0x6f, 0xc2, 0x68, 0xe9, 0x99, 0x54, 0xcd, 0x05, 0x55, 0x0a, 0x15, 0xc9, 0xdc, 0x9e, 0xd4,
+	0xb0, 0xf7, 0x0c, 0xee, 0x9b, 0x74, 0x42, 0x2f, 0x6f, 0xa3, 0x64, 0x69, 0xc7, 0xaa, 0xd3, 0x15, 0x2f, 0x74, 0x51, 0xdf, 0x44, 0x9f, 0xfd, 0x37,
+	0x71, 0xca, 0x24, 0xcd, 0x92, 0xf8, 0x6f, 0xf4, 0xf1, 0x47, 0x8e, 0x9d, 0x27, 0x00, 0x00,
+};
+const char StylesETag[] PROGMEM = "\"2f2ee7addcff4d65\"";
+const char StylesType[] PROGMEM = "text/css";
+
+// scripts.h: 123035 bytes, 33326 gzipped
+const uint8_t ScriptsGz[] PROGMEM = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xec, 0xbd, 0xdb, 0x76, 0x1b, 0x47, 0x96, 0xfe, 0x79, 0xaf, 0xa7, 0x80, 0x56, 0x77,
+	0x09, 0x80, 0x09, 0xd1, 0x79, 0x42, 0x02, 0x20, 0x05, 0xd5, 0xb2, 0x64, 0xb9, 0xac, 0xb6, 0x75, 0x18, 0x4b, 0x2e, 0xd7, 0x0c, 0x17, 0xed, 0xca,
+	0x23, 0x09, 0x0b, 0x04, 0xd8, 0x00, 0xa8, 0x43, 0x53, 0xfc, 0xdf, 0xcc, 0x3b, 0xcc, 0xd5, 0xdc, 0xcd, 0xfb, 0xcc, 0xbc, 0xc3, 0x3c, 0xc9, 0xec,
+	0xf8, 0xbe, 0xc8, 0xcc, 0x9d, 0xc8, 0x04, 0x49, 0xd9, 0x96, 0xbb, 0xd7, 0xf4, 0xdf, 0xb5, 0x4a, 0x04, 0x32, 0x23, 0x23, 0xe3, 0xb8, 0xf7, 0x6f,
+	0x47, 0x7e, 0x91, 0xb8, 0xf3, 0xd5, 0x6a, 0x15, 0x7d, 0x78, 0x74, 0x91, 0xe7, 0xd9, 0x6a, 0xff, 0x7c, 0xb5, 0xdc, 0x2c, 0x37, 0x1f, 0xce, 0xb3,
+	0xfd, 0xcd, 0xf2, 0x51, 0x18, 0x4c, 0xf3, 0x8b, 0x45, 0xb2, 0x99, 0x2d, 0x17, 0xbd, 0x8b, 0xd5, 0x7c, 0x9a, 0x47, 0xf3, 0x75, 0xd6, 0xbf, 0x9c,
+	0x67, 0x9b, 0x4e, 0x1c, 0xad, 0xb3, 0x30, 0x78, 0x7c, 0x1a, 0xad, 0xd6, 0xd3, 0xee, 0x57, 0x8f, 0x1e, 0x7f, 0xfd, 0xe4, 0x9b, 0xbf, 0x7d, 0xfb,
+	0xf4, 0xdf, 0xbe, 0xfb, 0xfe, 0xd9, 0xf3, 0x17, 0x2f, 0xff, 0x97, 0x1f, 0x5e, 0xbd, 0xfe, 0xf1, 0xef, 0x3f, 0xfd, 0xe3, 0x7f, 0xfd, 0xdf, 0xa2,
+	0x38, 0x49, 0xb3, 0xfc, 0xe4, 0x74, 0xf6, 0xeb, 0x9b, 0xf9, 0xd9, 0x62, 0x79, 0xfe, 0xef, 0xab, 0xf5, 0xe6, 0xe2, 0xed, 0xbb, 0xf7, 0x1f, 0xfe,
+	0xc3, 0x71, 0x3d, 0x3f, 0x18, 0x86, 0xa3, 0xf1, 0xa4, 0xbb, 0x67, 0x32, 0xff, 0x6b, 0xf7, 0xfe, 0x2f, 0xdd, 0x83, 0xee, 0xde, 0x97, 0xdd, 0xfe,
+	0xa1, 0xb9, 0xc1, 0x7a, 0xb3, 0x9a, 0x76, 0xbb, 0x83, 0x8b, 0xd9, 0x78, 0xba, 0xc8, 0xde, 0x75, 0x7e, 0x9c, 0x2d, 0x36, 0x63, 0x14, 0xb4, 0xb7,
+	0x39, 0x9d, 0xad, 0xfb, 0x87, 0xf9, 0x72, 0xd5, 0x33, 0xe9, 0x66, 0x53, 0x67, 0x10, 0x4f, 0x9d, 0xc3, 0xd9, 0x03, 0x49, 0xba, 0x3f, 0xcf, 0x16,
+	0x27, 0x9b, 0xd3, 0xc3, 0xd9, 0xde, 0x1e, 0x8b, 0x79, 0x31, 0x9b, 0xca, 0xe1, 0xa3, 0xd9, 0xf1, 0x60, 0x9e, 0x4d, 0xbd, 0x2f, 0x7a, 0xb3, 0xbf,
+	0xf8, 0xfd, 0xc1, 0xf9, 0xd4, 0xdb, 0x9b, 0x67, 0x83, 0x45, 0x34, 0xed, 0x5d, 0xcc, 0x1e, 0x3e, 0x3c, 0xef, 0x1f, 0xca, 0xcd, 0xf6, 0xa6, 0xaa,
+	0x4a, 0x47, 0x8b, 0xe8, 0x63, 0x7c, 0x8c, 0x72, 0x9c, 0x7b, 0x72, 0xdd, 0x17, 0xe7, 0xf7, 0xdd, 0xc1, 0xd9, 0x7c, 0xda, 0x0b, 0xee, 0xcf, 0xb3,
+	0xfe, 0x61, 0x6c, 0x2e, 0xbc, 0x77, 0xee, 0xf5, 0x1f, 0x3c, 0x38, 0x9b, 0x1f, 0xce, 0xf2, 0x9e, 0x33, 0x9d, 0x9e, 0xcd, 0x3f, 0x7e, 0x9c, 0x4d,
+	0xcd, 0x89, 0xa2, 0x14, 0xf7, 0xdd, 0x7e, 0xff, 0xb2, 0x91, 0xb3, 0x64, 0x6b, 0x8a, 0x7b, 0x75, 0x75, 0xe7, 0xdd, 0xe9, 0x6c, 0x9e, 0xf5, 0xee,
+	0x4a, 0xdd, 0xef, 0xdd, 0xeb, 0x49, 0x3a, 0x7b, 0xd9, 0x3d, 0xbf, 0xff, 0xd0, 0xe9, 0xdf, 0xc1, 0x85, 0xdd, 0x69, 0xf7, 0x70, 0x95, 0x6d, 0x2e,
+	0x56, 0x0b, 0xd3, 0x1e, 0x87, 0x57, 0x87, 0x3b, 0xbb, 0xca, 0x0d, 0xab, 0xae, 0x62, 0xd5, 0xd9, 0x80, 0x87, 0x6c, 0x85, 0xe8, 0xfa, 0x46, 0xbc,
+	0x98, 0x75, 0x96, 0xb9, 0x49, 0x66, 0x3b, 0x57, 0x72, 0xbb, 0x98, 0x49, 0xb6, 0xaf, 0x36, 0xab, 0xd9, 0xe2, 0xa4, 0xe7, 0x86, 0x45, 0x13, 0xb9,
+	0xe1, 0xfe, 0x79, 0x94, 0xbe, 0xda, 0x44, 0xab, 0x4d, 0xcf, 0x1b, 0x74, 0x1d, 0xe9, 0xac, 0xab, 0x3b, 0xb5, 0x12, 0xf2, 0x12, 0x55, 0xb8, 0x38,
+	0x0c, 0x5e, 0x2f, 0xbf, 0x7a, 0xf4, 0x9f, 0x3b, 0x92, 0x4c, 0x75, 0xf7, 0x57, 0xd9, 0xf9, 0x3c, 0x4a, 0xb2, 0xde, 0x97, 0xd3, 0x2f, 0x4f, 0x66,
+	0x83, 0xae, 0x3d, 0xcd, 0x56, 0x9f, 0x3e, 0x8b, 0x36, 0xa7, 0xfb, 0xf9, 0x7c, 0x29, 0x2d, 0x52, 0xf5, 0xc5, 0x17, 0xe1, 0x97, 0x63, 0xa6, 0x8a,
+	0xaa, 0x86, 0x47, 0x53, 0xaa, 0x8e, 0xe8, 0x31, 0x6d, 0x7f, 0x57, 0x53, 0xab, 0x4b, 0xeb, 0xc3, 0x76, 0x3d, 0x9b, 0xde, 0x77, 0x65, 0xe0, 0x6e,
+	0x0f, 0xda, 0xb3, 0x72, 0xa4, 0x66, 0xee, 0x34, 0xbc, 0x7f, 0x36, 0x88, 0x5d, 0x33, 0x06, 0x33, 0x57, 0x52, 0xaf, 0x67, 0x7b, 0xd3, 0x3d, 0x33,
+	0xde, 0xcc, 0x79, 0xdc, 0x31, 0x99, 0x4a, 0x79, 0x8f, 0xd6, 0x32, 0xc4, 0x93, 0x99, 0xab, 0x87, 0xda, 0xfe, 0x6c, 0x91, 0x66, 0xef, 0x5f, 0xe4,
+	0xbd, 0xa4, 0x7f, 0x28, 0xc5, 0x92, 0x49, 0x30, 0xed, 0x49, 0x92, 0x7b, 0xb1, 0x2b, 0xe3, 0xb6, 0xe7, 0xed, 0x9d, 0xf1, 0xfa, 0xcc, 0x9b, 0x06,
+	0xe6, 0x1e, 0xde, 0x34, 0xf4, 0xef, 0xf7, 0xcc, 0x7d, 0x3c, 0x19, 0xb9, 0x83, 0xc4, 0x43, 0xbe, 0x7b, 0x7b, 0x92, 0xf3, 0xc7, 0x8f, 0xdd, 0xaf,
+	0xba, 0x92, 0xbd, 0xd7, 0x9e, 0xbd, 0x57, 0xe4, 0xff, 0xd1, 0xdc, 0xc0, 0xbb, 0x17, 0x7b, 0xfd, 0x87, 0x0f, 0x65, 0xaa, 0x9c, 0xa9, 0xc1, 0xa1,
+	0x1a, 0xa1, 0x75, 0x90, 0xb8, 0x61, 0x7d, 0x90, 0x54, 0x63, 0xd8, 0x54, 0x16, 0xc3, 0xd5, 0xf6, 0xc9, 0x5f, 0xbc, 0x7e, 0xff, 0xaf, 0xe6, 0xfb,
+	0x41, 0x4f, 0xc6, 0xdf, 0x1e, 0x07, 0xf2, 0x4d, 0x5d, 0x54, 0x75, 0xe9, 0x97, 0xde, 0xa7, 0x75, 0xd4, 0xaf, 0x32, 0x59, 0x7f, 0x15, 0xdb, 0x12,
+	0x15, 0xb6, 0xe5, 0xd7, 0xa2, 0x9b, 0xd6, 0xa6, 0x81, 0xf6, 0xd7, 0x17, 0xf1, 0x9a, 0xb3, 0xc4, 0xfb, 0xe2, 0xd7, 0x81, 0xfc, 0x7f, 0xcf, 0x36,
+	0xc7, 0xaf, 0xc7, 0xd3, 0x73, 0x69, 0xa6, 0xec, 0xe9, 0x62, 0xd3, 0x5b, 0x0f, 0xcc, 0x14, 0xba, 0x6d, 0x63, 0xfc, 0xdb, 0x4f, 0xdf, 0x4d, 0xa3,
+	0xf5, 0x87, 0x45, 0xd2, 0xd9, 0x6a, 0x0e, 0x49, 0x72, 0x36, 0x5b, 0x67, 0x28, 0xf7, 0x4b, 0x7e, 0xee, 0xf5, 0x56, 0xd9, 0x7a, 0x39, 0x7f, 0x9b,
+	0x0d, 0x56, 0xd9, 0xaf, 0x59, 0xb2, 0xe9, 0x4f, 0x1f, 0x22, 0xe9, 0xbb, 0xe5, 0xea, 0x8d, 0x6d, 0x87, 0x9f, 0xf0, 0xb1, 0xd7, 0x9d, 0xcf, 0xe2,
+	0x2f, 0x93, 0xd5, 0x87, 0xf3, 0xcd, 0xf2, 0xcb, 0x7f, 0x7b, 0xf7, 0xe6, 0x6f, 0xd9, 0x22, 0x5b, 0x45, 0x9b, 0xe5, 0x6a, 0xff, 0xd7, 0xf5, 0x5f,
+	0xdf, 0x4e, 0x5d, 0x99, 0x0d, 0xbc, 0x66, 0x7f, 0xb9, 0x38, 0xcb, 0xd6, 0xeb, 0xe8, 0x24, 0xab, 0x7a, 0x43, 0xa6, 0xaa, 0xbd, 0x4d, 0x2f, 0xdb,
+	0x4f, 0xa3, 0x4d, 0xd4, 0x3f, 0x44, 0x8f, 0x6c, 0xb2, 0xd5, 0xd9, 0x6c, 0x11, 0x6d, 0xb2, 0x9e, 0xd4, 0xae, 0xb8, 0xfe, 0x7c, 0xb9, 0xde, 0x3c,
+	0x63, 0x0e, 0xd6, 0xcc, 0x5c, 0xf5, 0x0b, 0x2b, 0x66, 0x6b, 0x20, 0x89, 0x9f, 0x5f, 0x9c, 0xc5, 0x35, 0x23, 0x16, 0x47, 0x1b, 0xc9, 0xee, 0xc3,
+	0xf6, 0x10, 0x88, 0x67, 0x0b, 0xff, 0xad, 0x3f, 0x75, 0x1d, 0x2f, 0x38, 0xb4, 0xdf, 0x9f, 0x45, 0xef, 0xa7, 0xfe, 0xfe, 0xe4, 0x0b, 0x9e, 0xfa,
+	0xd2, 0xdf, 0xf7, 0xcb, 0x33, 0xb3, 0x85, 0x9c, 0x19, 0x6e, 0x9f, 0x59, 0x45, 0x0b, 0xa9, 0x0d, 0xaf, 0xbc, 0xcf, 0x64, 0x3c, 0x9e, 0x45, 0xa9,
+	0xcc, 0x2c, 0x53, 0x48, 0x7d, 0xf8, 0x3c, 0x5b, 0x25, 0xd9, 0x62, 0x63, 0x5a, 0x00, 0x56, 0xe1, 0x2c, 0x7a, 0xdf, 0x73, 0x06, 0xfc, 0x38, 0x5b,
+	0xf4, 0x5c, 0xc7, 0xf9, 0xa2, 0x67, 0x2e, 0xfd, 0x12, 0xf9, 0xf6, 0x07, 0x72, 0xa0, 0x5f, 0xd5, 0xb0, 0xbc, 0x58, 0x2a, 0x69, 0x72, 0x7b, 0xf2,
+	0xea, 0xe5, 0xf4, 0xf2, 0xea, 0x50, 0xfe, 0xec, 0xbf, 0x7c, 0xfa, 0xfc, 0xd5, 0xf4, 0xe8, 0xb8, 0xfc, 0xbc, 0x7f, 0x7e, 0xb1, 0x3e, 0xed, 0x1d,
+	0x75, 0x2f, 0x16, 0x17, 0xeb, 0x2c, 0xed, 0x0e, 0xee, 0xbb, 0xc7, 0xfd, 0xc6, 0xc9, 0xbf, 0xbd, 0x7c, 0xfa, 0xc2, 0x0d, 0x3b, 0x5f, 0x3b, 0xdd,
+	0x81, 0xb3, 0xe3, 0xf4, 0xb0, 0xf3, 0xb5, 0xdb, 0x1d, 0xec, 0xba, 0x38, 0xe8, 0x7c, 0xed, 0x75, 0x07, 0xde, 0x8e, 0xb3, 0x7e, 0xe7, 0x6b, 0xbf,
+	0x3b, 0xf0, 0x77, 0x9c, 0xf5, 0x3a, 0x5f, 0x07, 0xdd, 0x41, 0xb0, 0xab, 0x58, 0x92, 0xf5, 0xb0, 0x3b, 0x18, 0xee, 0x3a, 0x2d, 0x57, 0x87, 0xdd,
+	0x41, 0xb8, 0xeb, 0xb4, 0xdc, 0x7a, 0xd4, 0x1d, 0x8c, 0x76, 0x9d, 0x96, 0x5a, 0x8d, 0xbb, 0x83, 0xf1, 0x31, 0xe7, 0xeb, 0xf3, 0x65, 0xaa, 0x06,
+	0xa4, 0xcc, 0x2c, 0x69, 0x64, 0x71, 0xe1, 0x67, 0x32, 0x34, 0x31, 0x14, 0x79, 0x64, 0xca, 0x3f, 0x1c, 0x9d, 0xe6, 0xec, 0xd4, 0xfc, 0x63, 0xbf,
+	0x4a, 0x0e, 0x6b, 0xd3, 0xfc, 0x32, 0xf8, 0xe4, 0xa3, 0x1a, 0x7a, 0x48, 0x28, 0xbe, 0x72, 0xeb, 0x70, 0x94, 0xa6, 0xf5, 0xbb, 0x9a, 0x1c, 0xec,
+	0xed, 0xa4, 0x83, 0xf7, 0xa3, 0xf3, 0xf3, 0x6c, 0x91, 0xe2, 0xa8, 0xf9, 0xde, 0x57, 0xb7, 0x61, 0x45, 0x90, 0xbe, 0x79, 0xbb, 0xe5, 0x22, 0x59,
+	0x9e, 0x9d, 0x45, 0x8b, 0xb4, 0xca, 0xd9, 0x1e, 0xe8, 0x5f, 0x16, 0x66, 0xe7, 0x4d, 0xf6, 0xa1, 0x33, 0x5b, 0x74, 0xca, 0xe3, 0x30, 0x70, 0x1b,
+	0xb1, 0x14, 0xf1, 0xc5, 0x26, 0x83, 0x3b, 0x3b, 0x92, 0x24, 0xc7, 0x06, 0x3e, 0xba, 0xcb, 0xd8, 0xcc, 0xfc, 0xee, 0x74, 0x6a, 0x72, 0x17, 0x3f,
+	0x5e, 0xa6, 0xeb, 0x5f, 0xca, 0xe9, 0xf2, 0x5b, 0x75, 0x5f, 0x66, 0x37, 0x2b, 0x4a, 0x61, 0xff, 0x32, 0xc3, 0x96, 0xe4, 0xbd, 0x22, 0xa5, 0xd4,
+	0x25, 0x13, 0xbf, 0x7d, 0x99, 0x2c, 0x17, 0x62, 0x0c, 0xb2, 0xfd, 0xf9, 0xf2, 0xa4, 0xf7, 0xcf, 0x1f, 0x17, 0xb3, 0xb3, 0xf3, 0x79, 0x76, 0x26,
+	0xcd, 0x9e, 0xa5, 0x9d, 0x7f, 0xbd, 0x94, 0x5c, 0xae, 0xd4, 0xb5, 0xc5, 0xa5, 0xff, 0x94, 0x8b, 0x71, 0x75, 0xc7, 0x14, 0xb9, 0xa8, 0x78, 0x6b,
+	0xa1, 0xe1, 0x03, 0xa5, 0x23, 0xa3, 0xb3, 0xf5, 0xae, 0xb2, 0x25, 0xd1, 0x7c, 0x0e, 0xe3, 0x32, 0xb0, 0x09, 0x77, 0x14, 0xed, 0xcd, 0x62, 0xf9,
+	0x0e, 0x56, 0x47, 0xa6, 0xe5, 0xe6, 0x83, 0x94, 0xae, 0x1c, 0x18, 0x57, 0xfb, 0x2c, 0x2a, 0xca, 0xd5, 0xe8, 0xa2, 0xdd, 0x1d, 0x04, 0x03, 0x51,
+	0x9c, 0x96, 0x79, 0x5d, 0x7c, 0x3e, 0x2a, 0x73, 0x3e, 0x2e, 0x0a, 0x7d, 0xa8, 0x06, 0x66, 0x91, 0x63, 0xef, 0xbc, 0x6a, 0xcb, 0xed, 0x9b, 0x4a,
+	0x99, 0x6b, 0x23, 0xdc, 0x54, 0xab, 0x56, 0xa1, 0xf2, 0x16, 0x7b, 0xdd, 0xce, 0x41, 0xa7, 0xbb, 0xc7, 0x34, 0x62, 0x85, 0xdf, 0x6f, 0x5a, 0xb2,
+	0x3b, 0x8d, 0xd6, 0xe2, 0xa8, 0xc5, 0x42, 0xad, 0xb7, 0x6d, 0xaa, 0x3a, 0x83, 0x2c, 0x67, 0xf6, 0x6b, 0xda, 0xab, 0xfc, 0x9e, 0x19, 0xbb, 0x06,
+	0x0a, 0xab, 0x31, 0xdd, 0xbf, 0x54, 0xd7, 0x55, 0x1f, 0x3f, 0x7e, 0xc4, 0x04, 0xa8, 0x0e, 0xf4, 0x94, 0xa7, 0xab, 0x8e, 0x36, 0xcb, 0x57, 0xde,
+	0x55, 0x17, 0xcf, 0x5e, 0x07, 0x3e, 0x6c, 0x5e, 0xb2, 0x8e, 0xde, 0x66, 0x37, 0x4f, 0x1a, 0x5d, 0xe4, 0xa2, 0x2a, 0xd3, 0xea, 0x20, 0xc7, 0xd2,
+	0x56, 0x3b, 0x34, 0xeb, 0x20, 0xc3, 0xb4, 0xfa, 0xbe, 0x63, 0xc6, 0xe0, 0xaa, 0x5a, 0x9f, 0xab, 0x43, 0x1f, 0x3f, 0xca, 0xf0, 0xc0, 0x57, 0x53,
+	0x6c, 0x3d, 0x89, 0x9a, 0xe3, 0xed, 0x6d, 0x34, 0x9f, 0x89, 0x5f, 0xcd, 0xb6, 0x7b, 0x0a, 0xc7, 0xa7, 0x9b, 0xd5, 0x45, 0x76, 0xf8, 0x5b, 0x2a,
+	0xc9, 0xcb, 0x51, 0x86, 0xe2, 0x0e, 0xbd, 0xfe, 0xbd, 0x7b, 0xf8, 0x5c, 0x75, 0x92, 0xfd, 0x7a, 0xd8, 0x15, 0x2f, 0x64, 0x90, 0x6b, 0x26, 0xc6,
+	0xe4, 0xb0, 0x57, 0x96, 0x64, 0xb5, 0x5c, 0x6e, 0xa4, 0x8d, 0xed, 0xd7, 0x4e, 0x72, 0x9a, 0x25, 0x6f, 0x0c, 0xd4, 0xc8, 0x65, 0x17, 0x59, 0xd1,
+	0x63, 0xbd, 0x92, 0x75, 0x78, 0x78, 0x3a, 0x9d, 0xf2, 0x83, 0xdc, 0xa6, 0x71, 0xe9, 0x9a, 0xa8, 0x35, 0x5b, 0x9f, 0xc2, 0x42, 0xdd, 0x2d, 0xb3,
+	0x2c, 0x0e, 0x5b, 0xd6, 0xea, 0x6f, 0x8f, 0x87, 0x3b, 0xa6, 0x11, 0xde, 0x46, 0x2b, 0x83, 0xcf, 0x02, 0xce, 0x5b, 0xc9, 0x49, 0xd0, 0xad, 0x19,
+	0x0a, 0x9c, 0xf6, 0x3f, 0x7e, 0x54, 0xdf, 0x1e, 0x38, 0xb5, 0xaf, 0x0f, 0xbd, 0xe1, 0x70, 0xfb, 0x66, 0x65, 0xfb, 0xa0, 0xf9, 0x75, 0x35, 0x96,
+	0xc6, 0xc7, 0x17, 0xcc, 0x78, 0x32, 0x48, 0x96, 0xe7, 0x1f, 0x68, 0x6a, 0x57, 0x27, 0xfb, 0x31, 0xb0, 0xee, 0xde, 0x3d, 0x1d, 0xa9, 0xcd, 0xd6,
+	0x7f, 0x9f, 0x65, 0xef, 0xcc, 0x69, 0x69, 0x7c, 0x93, 0x08, 0x0e, 0x67, 0x3a, 0xed, 0x56, 0xf0, 0xd9, 0x45, 0x06, 0xb5, 0x9c, 0xd6, 0xf3, 0x59,
+	0x22, 0xed, 0x2b, 0x1f, 0xa7, 0xe5, 0xd7, 0x5e, 0x61, 0xe7, 0xcc, 0x51, 0x5c, 0xa8, 0x67, 0x87, 0x49, 0x41, 0xd3, 0x68, 0x6e, 0xa5, 0x6a, 0x20,
+	0x5f, 0xa5, 0x02, 0x92, 0x2f, 0x2f, 0x99, 0xad, 0xcb, 0xc2, 0xf7, 0xeb, 0x0d, 0xb6, 0xb6, 0xc7, 0x36, 0xa7, 0xab, 0xe5, 0xbb, 0x8e, 0xa1, 0xc7,
+	0x27, 0xab, 0x95, 0xb4, 0x79, 0x17, 0x17, 0x48, 0xcd, 0x85, 0x6c, 0x66, 0x8b, 0xb5, 0x0c, 0x40, 0x0c, 0x9a, 0x0e, 0xfa, 0xd8, 0x98, 0x22, 0xde,
+	0xb0, 0xb8, 0x5f, 0x03, 0xac, 0x71, 0xd2, 0x54, 0xb0, 0xea, 0x98, 0x93, 0xa2, 0x93, 0xef, 0xdd, 0xdb, 0xbe, 0xfb, 0xb5, 0xb9, 0x34, 0x8a, 0x76,
+	0xb1, 0x58, 0x5f, 0x9c, 0x9f, 0x2f, 0x57, 0xc6, 0xfd, 0xa0, 0x4b, 0xef, 0xcf, 0x67, 0x6f, 0xc4, 0x76, 0xd1, 0x2b, 0xd6, 0x07, 0xa0, 0x60, 0xdb,
+	0xc6, 0xf6, 0x9c, 0xbd, 0xfb, 0x8e, 0x9b, 0x15, 0x31, 0x5d, 0xad, 0xdb, 0xcf, 0x3f, 0xf0, 0xe4, 0x7a, 0x79, 0x51, 0x0c, 0x80, 0x81, 0x84, 0xc2,
+	0x27, 0xd9, 0x46, 0x7f, 0x46, 0x74, 0x3c, 0x60, 0x1a, 0xfd, 0xf9, 0x89, 0x31, 0x55, 0xd2, 0x06, 0xea, 0xcc, 0xdd, 0xe9, 0xe2, 0x62, 0x3e, 0xff,
+	0xf8, 0xb1, 0x4c, 0xc0, 0x03, 0x2a, 0x19, 0x3b, 0xcc, 0x0e, 0x05, 0x75, 0x68, 0xda, 0x38, 0xdd, 0x6b, 0xbf, 0xa3, 0x1d, 0x2f, 0xfa, 0xd2, 0x6b,
+	0xc6, 0x8d, 0xae, 0xd9, 0xae, 0xfc, 0xa4, 0x0b, 0xaa, 0x3a, 0xef, 0xaf, 0xb3, 0x4d, 0x4b, 0x7b, 0xe0, 0x2a, 0xd3, 0x7a, 0x66, 0xb2, 0xca, 0xa8,
+	0x79, 0x2b, 0xee, 0xf7, 0xc7, 0x4d, 0x3e, 0x9e, 0xf6, 0x94, 0x81, 0x2b, 0x5b, 0x76, 0xb3, 0x7c, 0xf4, 0x61, 0x23, 0x46, 0x17, 0x8e, 0xec, 0xd2,
+	0x5c, 0x22, 0xd1, 0xc6, 0xc5, 0x7c, 0x23, 0xb0, 0x36, 0x30, 0x33, 0xdd, 0x1c, 0x9f, 0x66, 0x82, 0x14, 0x69, 0xf6, 0xe3, 0x0f, 0x4f, 0x99, 0xec,
+	0x90, 0xcb, 0x27, 0xb3, 0x07, 0xe6, 0x5b, 0x31, 0x94, 0x70, 0x6d, 0x32, 0xc5, 0xa1, 0x44, 0x82, 0xd4, 0xc7, 0x72, 0xc5, 0x57, 0x9b, 0x9e, 0xb1,
+	0x0b, 0xc6, 0x9e, 0x27, 0x32, 0xe7, 0xfc, 0x11, 0x62, 0x19, 0xc9, 0x9d, 0x8c, 0x56, 0xda, 0x2d, 0x5c, 0xc4, 0x68, 0xae, 0x37, 0x1b, 0x78, 0x7d,
+	0x13, 0xb2, 0xf5, 0xef, 0x48, 0xb8, 0xed, 0xd9, 0x26, 0xd4, 0x57, 0x25, 0xfd, 0x6a, 0x72, 0x69, 0x73, 0xc0, 0x34, 0xb5, 0x61, 0x93, 0x4b, 0xc8,
+	0xc3, 0xea, 0xc5, 0xe6, 0xdf, 0xb6, 0xfa, 0x15, 0x55, 0x41, 0x82, 0xad, 0xba, 0xe0, 0x98, 0x58, 0x28, 0x94, 0xff, 0x81, 0xeb, 0x8d, 0xeb, 0xc5,
+	0xb7, 0xc1, 0xa3, 0xb9, 0xc9, 0x63, 0x5b, 0x61, 0x29, 0x5c, 0xdf, 0x98, 0xc2, 0xc3, 0x12, 0xb7, 0x92, 0x87, 0xee, 0xc4, 0x95, 0x69, 0xf6, 0xc0,
+	0xf3, 0x82, 0x9b, 0x2f, 0xef, 0xf5, 0x92, 0x7b, 0xce, 0x7b, 0x37, 0xef, 0x3f, 0x78, 0x10, 0xf6, 0x3f, 0xf6, 0x6c, 0x01, 0xf6, 0xdc, 0x63, 0x39,
+	0xea, 0xe7, 0x7d, 0x64, 0xde, 0xda, 0x28, 0xbb, 0x33, 0x73, 0x4c, 0x66, 0xae, 0x27, 0xb9, 0x35, 0xb2, 0xab, 0xdf, 0xc4, 0xab, 0xdd, 0xc4, 0x57,
+	0x26, 0xcc, 0xde, 0xe8, 0xd7, 0xa5, 0x44, 0x60, 0x5d, 0xb5, 0xec, 0x74, 0x69, 0x07, 0xcf, 0x81, 0xfd, 0x3b, 0x28, 0xdb, 0xfb, 0xa0, 0xfc, 0x34,
+	0xb8, 0xba, 0xea, 0x8b, 0xe5, 0x54, 0x63, 0xf1, 0xdb, 0xec, 0xfd, 0x27, 0x0f, 0xc5, 0xc3, 0xba, 0xf3, 0x51, 0xe3, 0x0e, 0x0d, 0xf2, 0x29, 0xc3,
+	0xea, 0x70, 0xab, 0x5a, 0x76, 0xa2, 0x98, 0x52, 0x75, 0xab, 0xe5, 0x2c, 0x2e, 0x79, 0x75, 0x0f, 0x6f, 0x39, 0x94, 0xb6, 0xca, 0xa7, 0x07, 0x13,
+	0x3d, 0xa3, 0x39, 0xf7, 0xb6, 0x1a, 0x50, 0xba, 0xb8, 0x72, 0xe7, 0xa3, 0xde, 0x5b, 0x69, 0xfb, 0xdc, 0xe9, 0x3f, 0x7c, 0x18, 0x1c, 0xef, 0x99,
+	0x03, 0x6f, 0xd1, 0x73, 0xc7, 0x8d, 0xd2, 0xfe, 0xee, 0x4e, 0x58, 0x20, 0xf6, 0x7f, 0x91, 0xff, 0xb0, 0xbc, 0x58, 0xa4, 0xeb, 0xe9, 0xa5, 0x1b,
+	0x1e, 0xb8, 0xce, 0xc0, 0x0b, 0x0e, 0x5c, 0x6f, 0xe0, 0x7b, 0x07, 0x6e, 0xc0, 0xe6, 0x58, 0x49, 0x67, 0x4d, 0x8f, 0xa4, 0x0c, 0xee, 0x40, 0xfe,
+	0xf1, 0xcc, 0x3f, 0x81, 0xf9, 0x67, 0x2c, 0xff, 0x48, 0x7a, 0xe7, 0xbd, 0x67, 0xfe, 0x09, 0xcc, 0x3f, 0x63, 0xf3, 0x8f, 0x1b, 0xcb, 0x3f, 0x7e,
+	0x28, 0xff, 0x84, 0x89, 0xfc, 0x93, 0x9a, 0x74, 0x91, 0x39, 0x16, 0xa4, 0xf2, 0xcf, 0x24, 0x32, 0x57, 0xe4, 0xf2, 0xcf, 0x30, 0x93, 0x7f, 0x62,
+	0x93, 0x24, 0xf4, 0xe5, 0x9f, 0xc4, 0x5c, 0x31, 0x19, 0x99, 0x6b, 0x87, 0xe6, 0x98, 0x49, 0x97, 0x9a, 0x1b, 0xc5, 0xe6, 0xec, 0xc8, 0x5c, 0x9b,
+	0x9b, 0x63, 0x99, 0xb9, 0x36, 0x31, 0x49, 0x26, 0xee, 0x31, 0xea, 0xf1, 0xca, 0x94, 0x0e, 0x79, 0x8c, 0x4c, 0x6e, 0x23, 0x93, 0xc7, 0xc8, 0xdc,
+	0x30, 0x37, 0x85, 0x0d, 0xcd, 0xa7, 0xb0, 0xbc, 0xc8, 0x37, 0x45, 0x44, 0x55, 0x42, 0x93, 0xce, 0x43, 0x3a, 0x53, 0x92, 0x74, 0x54, 0x94, 0x73,
+	0x64, 0x4a, 0x92, 0x98, 0x7b, 0x8d, 0x4d, 0x06, 0xc9, 0xa4, 0x76, 0xff, 0xa1, 0xf9, 0x1a, 0x98, 0xc4, 0xb9, 0xc9, 0x2a, 0x4a, 0x8b, 0x72, 0x46,
+	0x26, 0x71, 0x64, 0x6e, 0x34, 0x31, 0xc5, 0x88, 0xcc, 0xb1, 0x11, 0x32, 0x30, 0xe9, 0x62, 0x5c, 0x81, 0x16, 0x30, 0x25, 0xf5, 0xc2, 0xa2, 0x91,
+	0x7c, 0x73, 0x45, 0x6e, 0xce, 0x26, 0xe6, 0x32, 0x1f, 0x59, 0x99, 0x92, 0x66, 0xe6, 0x9f, 0xdc, 0x94, 0x74, 0xe4, 0x16, 0xed, 0xe8, 0x9b, 0x4f,
+	0xee, 0xb0, 0xe8, 0x83, 0x04, 0x55, 0x40, 0xeb, 0x99, 0x7f, 0x5c, 0x93, 0x64, 0x62, 0x32, 0x75, 0x86, 0x45, 0x53, 0x3b, 0x26, 0x89, 0xeb, 0x15,
+	0x9d, 0x93, 0x99, 0x4f, 0x99, 0xa9, 0xa5, 0x67, 0x4e, 0xc4, 0xe6, 0xeb, 0x08, 0xf9, 0x99, 0x6a, 0x8d, 0x51, 0x34, 0x53, 0x0c, 0x37, 0x2a, 0x7a,
+	0x32, 0x34, 0x8d, 0x33, 0x34, 0x5f, 0x23, 0x93, 0xc1, 0xd0, 0x5c, 0xe1, 0x9b, 0x13, 0x69, 0x58, 0x74, 0x8e, 0x67, 0xae, 0xcd, 0xfc, 0xa2, 0x63,
+	0xc7, 0xa6, 0x68, 0x43, 0xf3, 0x35, 0xc5, 0x90, 0xc1, 0x7d, 0xd3, 0x62, 0xa0, 0xe4, 0x26, 0xfb, 0xd8, 0x9c, 0x18, 0xc6, 0x45, 0x3f, 0x27, 0xe6,
+	0x53, 0x6c, 0x6e, 0xe4, 0xa3, 0x75, 0xcd, 0xb1, 0xc0, 0xa4, 0x1b, 0x9a, 0x1a, 0x25, 0x26, 0xd3, 0xd4, 0x29, 0xfa, 0x3e, 0x32, 0x67, 0x73, 0x0c,
+	0x28, 0xbf, 0x18, 0x55, 0xbe, 0xf9, 0x34, 0x36, 0xf5, 0x08, 0xd0, 0x6a, 0x93, 0x62, 0xa8, 0x8e, 0x30, 0xd2, 0xcc, 0xb5, 0xbe, 0xc9, 0x6f, 0x82,
+	0x0c, 0x4c, 0xa6, 0x43, 0x53, 0x82, 0xc8, 0x2f, 0x47, 0x2e, 0xfa, 0xcd, 0x5c, 0x31, 0x41, 0x7e, 0x26, 0x49, 0x3e, 0x2c, 0x06, 0x68, 0x6c, 0xaa,
+	0x9a, 0x62, 0xe4, 0xba, 0xc5, 0xa8, 0xcf, 0xd1, 0x6f, 0xa8, 0x25, 0x3a, 0xd9, 0x5c, 0xe6, 0xa0, 0xe9, 0xcc, 0xb1, 0x0c, 0xa5, 0xcf, 0x8b, 0x21,
+	0x1d, 0x98, 0x26, 0x71, 0xd1, 0xc9, 0xe8, 0x5f, 0x0c, 0x51, 0xd4, 0xd7, 0x5c, 0x16, 0xa2, 0xc1, 0xcc, 0x27, 0x17, 0x63, 0xcd, 0x64, 0x10, 0xa2,
+	0x54, 0xe6, 0x6e, 0x01, 0xaa, 0x6f, 0xf2, 0xf3, 0xcc, 0x8d, 0x3c, 0x53, 0x8c, 0x09, 0xce, 0x9a, 0x42, 0x06, 0xa6, 0x68, 0x19, 0xa6, 0x12, 0x26,
+	0xa4, 0xc9, 0x2a, 0xcd, 0x8a, 0xe9, 0xe5, 0xa0, 0xa3, 0xcc, 0x3f, 0x19, 0xda, 0x00, 0x9d, 0x87, 0x61, 0x81, 0x26, 0x46, 0x33, 0x99, 0x0c, 0x3c,
+	0x94, 0xc0, 0xdc, 0x23, 0x31, 0x49, 0x52, 0x53, 0x82, 0x08, 0x53, 0x13, 0x4d, 0x62, 0x8a, 0x31, 0xc1, 0x98, 0xc4, 0xa0, 0x46, 0x77, 0xa3, 0x32,
+	0x18, 0x93, 0xe6, 0x53, 0x68, 0x4a, 0x3f, 0xc6, 0x5c, 0x40, 0x2f, 0x98, 0x9b, 0x47, 0x93, 0xc2, 0x06, 0x0c, 0xcd, 0x3d, 0x72, 0x73, 0x6d, 0x66,
+	0xee, 0x1b, 0x9a, 0x24, 0x23, 0x0c, 0xa9, 0xac, 0xb0, 0x24, 0xb1, 0xf9, 0x3a, 0x32, 0x9f, 0x3c, 0x73, 0xd6, 0x33, 0x27, 0x5c, 0xcc, 0x23, 0x0c,
+	0xb3, 0xa0, 0xb0, 0x10, 0x99, 0x49, 0x92, 0x9a, 0x1b, 0x8d, 0xd0, 0xa6, 0xa6, 0x71, 0x02, 0x0c, 0x1f, 0x94, 0xc0, 0x7c, 0x1a, 0x23, 0x2b, 0xd4,
+	0x17, 0xed, 0x02, 0x73, 0x62, 0xae, 0x0d, 0xcc, 0xb5, 0x8e, 0xa9, 0x5b, 0x8e, 0x49, 0x62, 0xce, 0x86, 0x6e, 0x61, 0x71, 0x86, 0x98, 0x10, 0x98,
+	0x06, 0x30, 0x00, 0xe8, 0x69, 0x4c, 0x58, 0x93, 0x2e, 0x33, 0x5f, 0x73, 0x4c, 0x30, 0xb4, 0x33, 0x2c, 0x88, 0x49, 0x9c, 0xe2, 0x0a, 0x93, 0x64,
+	0x62, 0x0a, 0x34, 0x31, 0x25, 0x70, 0xcd, 0xd7, 0xb1, 0xc9, 0x2f, 0x33, 0x67, 0x13, 0xf4, 0x07, 0xaa, 0x85, 0xd2, 0x63, 0x92, 0xa0, 0x6e, 0x26,
+	0x97, 0x31, 0x7a, 0xc1, 0xdc, 0x28, 0x36, 0x27, 0x32, 0x94, 0x14, 0x96, 0x0b, 0xfd, 0x8b, 0xb6, 0x37, 0x49, 0x3c, 0x8c, 0x30, 0x93, 0x24, 0xc6,
+	0x44, 0x84, 0x6d, 0xc4, 0xdd, 0x42, 0x6b, 0x07, 0x67, 0xc6, 0x10, 0x62, 0x82, 0x62, 0x36, 0xd3, 0x84, 0x96, 0x46, 0x0f, 0xd6, 0x06, 0x96, 0x05,
+	0xa3, 0x1b, 0x37, 0xc3, 0xd8, 0xc7, 0x2c, 0x40, 0x25, 0x31, 0xde, 0x38, 0xa6, 0x47, 0xc5, 0x24, 0x83, 0x4d, 0xc5, 0xe4, 0xc6, 0xdc, 0x84, 0x49,
+	0x44, 0x25, 0x31, 0xd7, 0x31, 0x0b, 0x50, 0x53, 0x18, 0x2e, 0xb4, 0x03, 0xa7, 0x65, 0x50, 0x0c, 0x76, 0x8c, 0x46, 0xb6, 0x43, 0x5c, 0x94, 0x1b,
+	0xe6, 0x19, 0xed, 0x85, 0x21, 0x89, 0x3e, 0xc6, 0xc8, 0x83, 0x31, 0xc3, 0xa4, 0xc0, 0x98, 0x86, 0x11, 0xc0, 0xc8, 0xc3, 0x48, 0x46, 0xb3, 0xc0,
+	0x0a, 0xc3, 0xde, 0x05, 0xe5, 0xe8, 0xc1, 0x70, 0x41, 0x6b, 0xa2, 0xa3, 0xd9, 0xcc, 0x93, 0x62, 0x60, 0xd3, 0xca, 0x85, 0x85, 0xc9, 0x81, 0xa1,
+	0xc6, 0xd8, 0x0f, 0xcb, 0x31, 0x03, 0x4b, 0x85, 0x91, 0x07, 0x93, 0x8d, 0x8e, 0xc6, 0x20, 0xc1, 0xdc, 0xc4, 0x80, 0x08, 0xab, 0xce, 0x0f, 0x4b,
+	0x9b, 0x5f, 0xcd, 0x9b, 0xa4, 0x98, 0xc3, 0x18, 0xdd, 0xb0, 0x18, 0xb0, 0x27, 0x98, 0x00, 0x18, 0x8d, 0x18, 0x7e, 0xb0, 0x45, 0xf0, 0x03, 0x30,
+	0x89, 0x18, 0x6f, 0xb0, 0x2c, 0x98, 0xaf, 0x30, 0xed, 0x98, 0xd2, 0x18, 0x8d, 0xb0, 0x13, 0x98, 0x55, 0xb0, 0x4a, 0x30, 0xac, 0x98, 0xfa, 0x95,
+	0x53, 0x85, 0x75, 0xc5, 0x60, 0x82, 0xa5, 0xc2, 0xcc, 0xc5, 0xe4, 0x86, 0x4b, 0xc1, 0x7c, 0x85, 0x11, 0x85, 0x47, 0x80, 0x89, 0x80, 0xc9, 0x86,
+	0x99, 0xc4, 0xd4, 0x87, 0x61, 0xa5, 0xcd, 0xcf, 0x0a, 0x43, 0x08, 0xe7, 0x07, 0xc7, 0x84, 0xf1, 0x06, 0x4b, 0x8a, 0xf9, 0x00, 0xf7, 0x86, 0x99,
+	0x86, 0x69, 0x04, 0x3f, 0x0a, 0x7b, 0x87, 0x39, 0x07, 0x57, 0x0b, 0xf3, 0x02, 0x8b, 0x81, 0x39, 0x12, 0x94, 0x26, 0x0c, 0xfe, 0x16, 0x76, 0x0c,
+	0x46, 0x00, 0x76, 0x11, 0x1e, 0x1a, 0xf6, 0x1d, 0x73, 0x04, 0x1e, 0x15, 0x73, 0x1d, 0xb3, 0x00, 0x86, 0x10, 0xfe, 0x0c, 0xb6, 0x08, 0x13, 0x1e,
+	0x36, 0x10, 0xc6, 0x07, 0x9e, 0x17, 0x33, 0x17, 0x86, 0x1f, 0x9e, 0x0d, 0x86, 0x1f, 0x06, 0x09, 0x76, 0x02, 0x06, 0x04, 0xee, 0x0d, 0x73, 0x0e,
+	0xae, 0x8c, 0xae, 0xdb, 0x2d, 0x7c, 0xdc, 0xa8, 0x9c, 0xe6, 0xf0, 0x62, 0x60, 0x04, 0xcc, 0x48, 0x20, 0x03, 0xbc, 0x36, 0x6c, 0x20, 0x8c, 0x05,
+	0x5c, 0x0f, 0xbc, 0x2c, 0x9c, 0x15, 0xfc, 0x63, 0x5e, 0x1a, 0x38, 0x58, 0x1b, 0xd8, 0x22, 0x58, 0x2a, 0xb8, 0x05, 0xd8, 0x4a, 0xf8, 0x3d, 0x78,
+	0x63, 0x98, 0x62, 0xf0, 0x00, 0x98, 0x03, 0xf6, 0x0e, 0x9e, 0x03, 0x0e, 0x36, 0x2f, 0x2d, 0x1a, 0x0c, 0x1c, 0xfc, 0x14, 0x3d, 0xdb, 0xb8, 0xf0,
+	0xe4, 0xf0, 0xf8, 0xa0, 0x00, 0xb8, 0x50, 0x38, 0x76, 0xb8, 0x23, 0x60, 0x09, 0x7c, 0x3a, 0xfd, 0x7c, 0xe9, 0x7f, 0xe0, 0x48, 0xe0, 0xed, 0xe0,
+	0x0b, 0x61, 0x94, 0xe1, 0x66, 0x60, 0x17, 0xe1, 0x6a, 0x61, 0x7c, 0x60, 0x5e, 0xb2, 0xd2, 0x32, 0xc3, 0x53, 0x02, 0x55, 0xc0, 0x3f, 0x40, 0x1a,
+	0xba, 0x5f, 0xa7, 0xf4, 0x26, 0x25, 0xd4, 0xc1, 0x8c, 0xc3, 0x31, 0xd1, 0x67, 0x3a, 0x85, 0x6f, 0x00, 0x69, 0xc0, 0x48, 0xc1, 0xfd, 0x82, 0x2f,
+	0x40, 0x06, 0xb0, 0x68, 0xb0, 0xbd, 0x6e, 0x89, 0x61, 0x40, 0x1a, 0x78, 0x45, 0x3a, 0x83, 0x51, 0x01, 0x19, 0x80, 0xa5, 0xac, 0xb4, 0xb8, 0xf0,
+	0x71, 0xe0, 0x3d, 0xda, 0x54, 0xb7, 0xf0, 0xbc, 0xa3, 0x94, 0x86, 0xf0, 0xb5, 0x6b, 0x0c, 0x61, 0x12, 0x86, 0x7e, 0xe8, 0xc3, 0xe0, 0xe5, 0xe3,
+	0x51, 0x32, 0x4a, 0x30, 0x7d, 0xb2, 0x6c, 0x24, 0xff, 0xe1, 0xf6, 0x79, 0x38, 0x8a, 0x47, 0x31, 0xa6, 0x57, 0x9e, 0xe7, 0x5e, 0xee, 0xa1, 0x1d,
+	0xd2, 0x30, 0x8c, 0xc3, 0x18, 0x63, 0x3c, 0xcd, 0xc2, 0x3c, 0xcc, 0xd1, 0xd0, 0x13, 0x37, 0x19, 0x26, 0x43, 0xd8, 0xae, 0xd0, 0xf1, 0xe5, 0x7f,
+	0x98, 0xc7, 0x8e, 0xe7, 0xb8, 0xf2, 0x3f, 0xb4, 0x52, 0x16, 0x8e, 0xc2, 0x11, 0x5a, 0x77, 0x18, 0x7a, 0xb1, 0x17, 0x83, 0x18, 0xb3, 0x51, 0x9e,
+	0xe5, 0x99, 0x6d, 0xee, 0x74, 0x94, 0x8e, 0x30, 0x96, 0x82, 0x34, 0x8a, 0xa3, 0x18, 0x43, 0x3c, 0x4b, 0xe4, 0xaa, 0x10, 0x63, 0x63, 0x9c, 0x27,
+	0x51, 0x12, 0x61, 0x62, 0xba, 0xf9, 0xd8, 0x1b, 0x7b, 0x9c, 0xf3, 0x93, 0x44, 0xfe, 0x07, 0x3b, 0x9d, 0x47, 0x92, 0x41, 0x4a, 0xb7, 0x92, 0xe7,
+	0x51, 0x1e, 0xc1, 0x5a, 0xc4, 0xde, 0x70, 0x32, 0x9c, 0xa0, 0xa1, 0xc7, 0x59, 0x30, 0x0a, 0x46, 0xe8, 0xaf, 0x3c, 0xce, 0x9d, 0xdc, 0xa1, 0xd1,
+	0x74, 0xa3, 0x34, 0x4a, 0x31, 0x20, 0x62, 0x3f, 0x0d, 0xd2, 0x00, 0x13, 0x71, 0x98, 0x47, 0x5e, 0xe4, 0xc1, 0x10, 0x05, 0x43, 0xc9, 0x2b, 0xc7,
+	0xa4, 0xf4, 0x7c, 0x73, 0x3b, 0xb8, 0x86, 0xa1, 0x1f, 0x05, 0x51, 0x60, 0xad, 0xc8, 0xc8, 0x1b, 0x79, 0x98, 0x88, 0x93, 0x38, 0x71, 0x12, 0x07,
+	0x66, 0x74, 0x34, 0x94, 0xd6, 0x1b, 0xc1, 0x6a, 0x67, 0x6e, 0x9e, 0xe6, 0x29, 0x66, 0x9b, 0x9f, 0x4e, 0xfc, 0x89, 0x1f, 0xd1, 0x78, 0x7b, 0xa1,
+	0x17, 0xc2, 0x0b, 0x85, 0x89, 0x74, 0x45, 0x88, 0x41, 0x3e, 0xca, 0xfc, 0xdc, 0xcf, 0x61, 0x16, 0xf2, 0x61, 0x3e, 0xca, 0x47, 0xb0, 0x2e, 0x63,
+	0x3f, 0x91, 0xff, 0x68, 0x27, 0xc6, 0x7e, 0x20, 0xa1, 0x17, 0x06, 0xb0, 0x1b, 0x0d, 0xa3, 0x21, 0xa6, 0x45, 0xea, 0x66, 0xc3, 0x6c, 0x08, 0x27,
+	0x93, 0x4f, 0x72, 0x37, 0x77, 0x61, 0xf7, 0x33, 0x6f, 0xe4, 0x8e, 0x5c, 0x0c, 0xd3, 0x28, 0x4e, 0xc7, 0xd2, 0x38, 0x60, 0x27, 0xcf, 0x77, 0x7d,
+	0x17, 0xe3, 0xcc, 0x93, 0x46, 0x92, 0x4f, 0xb0, 0x62, 0x63, 0x27, 0x90, 0xff, 0xd1, 0xa3, 0xc8, 0x70, 0x18, 0xc1, 0x53, 0x06, 0x92, 0xd8, 0xf3,
+	0x61, 0xb3, 0x27, 0x69, 0xe2, 0x27, 0x3e, 0xec, 0xb0, 0xef, 0xb8, 0x63, 0x77, 0xec, 0x11, 0x6f, 0x26, 0xe1, 0x24, 0x84, 0x6f, 0x71, 0x22, 0xe9,
+	0xf6, 0x21, 0x4c, 0xa2, 0x97, 0x4f, 0x22, 0x89, 0x0c, 0x61, 0x45, 0x33, 0x67, 0x24, 0xff, 0xa3, 0xb7, 0x71, 0x3d, 0x89, 0x1b, 0x43, 0xd8, 0x86,
+	0xb1, 0xdc, 0x10, 0x8e, 0x32, 0xcd, 0x33, 0x2f, 0xf3, 0xe0, 0xd4, 0x24, 0x92, 0x8c, 0xb3, 0x18, 0xe3, 0x39, 0x90, 0xb2, 0x7b, 0x23, 0x0c, 0xe8,
+	0x51, 0x2e, 0xe3, 0xc5, 0x83, 0x1d, 0xc8, 0xa2, 0xd1, 0x70, 0x34, 0xc4, 0xe4, 0x73, 0x3d, 0x67, 0xe2, 0x4c, 0x60, 0x63, 0xdc, 0x74, 0xec, 0x8f,
+	0x7d, 0xb8, 0xe8, 0xe1, 0xd8, 0x4b, 0xbc, 0x04, 0xa6, 0xd0, 0x97, 0x9e, 0x75, 0x23, 0xb8, 0x3e, 0x3f, 0x74, 0x63, 0x37, 0xc6, 0x14, 0x4e, 0x93,
+	0x30, 0x0b, 0x33, 0xb8, 0xbc, 0x58, 0x7a, 0x76, 0x18, 0xc1, 0x91, 0x0e, 0xe3, 0x48, 0x4a, 0x0f, 0x87, 0x2e, 0x43, 0xcc, 0x1b, 0x7a, 0x70, 0x6e,
+	0xa3, 0xd0, 0x8f, 0xfd, 0x18, 0x53, 0x58, 0xc6, 0x6b, 0x28, 0x43, 0x1f, 0x76, 0x22, 0x95, 0x83, 0x3e, 0xa1, 0xc5, 0xf3, 0x26, 0xde, 0x04, 0xde,
+	0x3a, 0x4d, 0x33, 0x3f, 0xf3, 0x7d, 0xa2, 0xa5, 0x4c, 0x96, 0x9c, 0x96, 0xd3, 0x1f, 0x07, 0xe3, 0x00, 0xb6, 0x3c, 0x0a, 0x87, 0xbe, 0xb4, 0x34,
+	0xc6, 0xe4, 0x24, 0x75, 0x53, 0x17, 0x0e, 0xd3, 0xb1, 0xff, 0xc1, 0x83, 0x64, 0x69, 0x96, 0xc2, 0xd5, 0x04, 0x32, 0x73, 0x3c, 0x07, 0xa6, 0x49,
+	0x86, 0x43, 0x92, 0x27, 0xb0, 0x7a, 0xa3, 0x89, 0x54, 0xc2, 0x85, 0xe1, 0x88, 0xc3, 0x61, 0x3c, 0x8c, 0x33, 0x06, 0x57, 0x61, 0x14, 0x46, 0x30,
+	0xb8, 0xe3, 0x34, 0x89, 0x93, 0x18, 0xfe, 0x51, 0xe6, 0xae, 0x34, 0x25, 0x7c, 0xfc, 0x48, 0x46, 0xad, 0x3f, 0x09, 0x88, 0x14, 0x32, 0x66, 0x23,
+	0x10, 0xc7, 0x64, 0x1c, 0x24, 0x41, 0xc2, 0x08, 0xd2, 0x19, 0x8e, 0x87, 0x63, 0x78, 0x84, 0xf1, 0x50, 0x6e, 0x96, 0xc3, 0xea, 0xc9, 0x1c, 0x77,
+	0x52, 0x07, 0x3e, 0x2b, 0x19, 0xca, 0x2c, 0xcd, 0x61, 0xc0, 0x82, 0x3c, 0x92, 0xff, 0x60, 0x07, 0xb3, 0x54, 0x66, 0x51, 0x0c, 0x67, 0x3f, 0x0e,
+	0x65, 0x48, 0xfa, 0x8c, 0x3a, 0x23, 0x99, 0x42, 0x29, 0xf8, 0x48, 0x0c, 0x8c, 0xfc, 0x07, 0x23, 0xe4, 0xba, 0x72, 0x87, 0x21, 0x88, 0x66, 0x2c,
+	0x0d, 0x2c, 0xc3, 0x17, 0x2c, 0x37, 0x91, 0xb1, 0x3a, 0x81, 0x7d, 0x76, 0x6c, 0x95, 0x61, 0xfa, 0x65, 0xd4, 0xe7, 0x60, 0x2d, 0x3b, 0xa0, 0x1c,
+	0xf8, 0x02, 0x19, 0x7c, 0x09, 0xb0, 0x49, 0x66, 0xb4, 0x5c, 0x07, 0x23, 0x18, 0xc4, 0xd1, 0x38, 0x1a, 0x03, 0xbf, 0x22, 0x4f, 0x46, 0xb2, 0x0b,
+	0x3a, 0x1b, 0xa6, 0x91, 0x1f, 0xf9, 0x70, 0x21, 0x76, 0x50, 0xe3, 0x16, 0xc3, 0x71, 0x2e, 0xff, 0xa3, 0xef, 0x96, 0x6e, 0xf3, 0xe0, 0x21, 0x3d,
+	0x77, 0x92, 0x4e, 0xd2, 0x98, 0x14, 0x22, 0xa3, 0x68, 0x0c, 0x0c, 0x91, 0x19, 0x34, 0xcc, 0x87, 0x0e, 0x2d, 0xa9, 0xb4, 0x69, 0x02, 0x07, 0x39,
+	0x1a, 0x89, 0xe9, 0x0b, 0xad, 0xa7, 0x17, 0xa3, 0x11, 0xc1, 0x77, 0x06, 0x9e, 0x0c, 0x6a, 0x17, 0x06, 0xd7, 0xda, 0x3b, 0xf4, 0xdb, 0x50, 0x8c,
+	0x66, 0x0e, 0x1f, 0x2a, 0x93, 0x5f, 0xe6, 0x34, 0x3c, 0x64, 0x9c, 0xa7, 0x5e, 0xea, 0x91, 0xab, 0xdc, 0x24, 0x95, 0xf6, 0x07, 0x59, 0x8c, 0xa5,
+	0x84, 0x09, 0xec, 0xb6, 0x17, 0xca, 0xd4, 0xf4, 0xe1, 0xb6, 0x13, 0x3f, 0x4b, 0xb2, 0x04, 0x18, 0x19, 0x4b, 0x6e, 0xc3, 0x3c, 0x23, 0x8b, 0x4f,
+	0x46, 0x93, 0x11, 0x18, 0x6d, 0x3c, 0x0e, 0xe4, 0x3f, 0x90, 0x95, 0x97, 0xc9, 0x3c, 0x1f, 0x81, 0x40, 0x27, 0xd2, 0x4a, 0x49, 0x00, 0x3e, 0x1a,
+	0x0e, 0xa3, 0x51, 0x34, 0x02, 0x44, 0xe4, 0xc9, 0x28, 0x1b, 0x65, 0xa0, 0xd3, 0x51, 0xe4, 0xa7, 0x62, 0xe8, 0x18, 0xa0, 0x84, 0x41, 0x18, 0x80,
+	0x1e, 0xe2, 0x68, 0x98, 0x0e, 0x53, 0x90, 0x83, 0x2f, 0x6d, 0xe2, 0x4e, 0xe0, 0x73, 0xc4, 0x6a, 0xfb, 0x92, 0x2d, 0x8a, 0x23, 0xe3, 0x31, 0x74,
+	0xe0, 0xde, 0xdc, 0x89, 0xcc, 0x7e, 0x17, 0xac, 0x37, 0xc9, 0x82, 0x3c, 0xc8, 0x53, 0x46, 0x8b, 0x52, 0x9f, 0x04, 0x5e, 0x34, 0x90, 0x36, 0xf1,
+	0x3c, 0xb0, 0xe6, 0x30, 0x10, 0x3b, 0x1a, 0x31, 0x98, 0x8b, 0x65, 0xc2, 0x3a, 0xc4, 0xb2, 0x78, 0x6c, 0xfe, 0x83, 0xf3, 0x4e, 0xa4, 0x08, 0x21,
+	0x90, 0x4a, 0xca, 0x28, 0xff, 0x01, 0x34, 0xc4, 0xc5, 0x8c, 0xc5, 0xf7, 0xa0, 0x51, 0xc7, 0x6e, 0xe0, 0x06, 0x70, 0x90, 0x62, 0xe1, 0x65, 0x8e,
+	0x00, 0x1a, 0x62, 0x19, 0x94, 0xc3, 0x0c, 0x54, 0xe3, 0x86, 0x4e, 0xec, 0xc4, 0x80, 0x94, 0x28, 0x4d, 0xe3, 0x34, 0x06, 0xcb, 0xa6, 0x71, 0x26,
+	0xa6, 0x07, 0x4e, 0x58, 0x46, 0xa7, 0x58, 0x31, 0x40, 0xc8, 0x28, 0x90, 0x91, 0x11, 0x81, 0x8c, 0xdd, 0x40, 0x6a, 0x13, 0x81, 0xea, 0x26, 0x5e,
+	0x30, 0x09, 0x26, 0xa0, 0x0f, 0xc7, 0xd6, 0x13, 0x40, 0xea, 0x05, 0x5e, 0x00, 0x40, 0x8d, 0x65, 0x62, 0x0c, 0x13, 0xe0, 0xe2, 0x24, 0x17, 0x03,
+	0xe3, 0x01, 0x65, 0xe3, 0x54, 0x1a, 0xd2, 0x27, 0x36, 0xf9, 0xe2, 0x9c, 0x12, 0x2e, 0xbe, 0x88, 0xcd, 0x0c, 0x3d, 0x30, 0xbb, 0x3f, 0x91, 0x86,
+	0x74, 0x09, 0x2a, 0xae, 0xb8, 0xa1, 0x21, 0x80, 0x38, 0xf5, 0xb3, 0x20, 0x0b, 0x7c, 0x02, 0x9e, 0x74, 0xe6, 0x84, 0x88, 0x3d, 0x94, 0x0e, 0x1a,
+	0x81, 0xf7, 0xc7, 0x71, 0x32, 0x16, 0x77, 0x0c, 0x5b, 0x9d, 0x49, 0xfb, 0x8f, 0x86, 0xc4, 0x60, 0xb1, 0x40, 0x29, 0x90, 0x4b, 0xcc, 0xaf, 0xb1,
+	0xe6, 0x5c, 0x2a, 0x90, 0x6e, 0x1b, 0x02, 0xc3, 0x27, 0x89, 0x64, 0x9b, 0xa5, 0xc4, 0x77, 0x31, 0xbf, 0x93, 0x8c, 0x2c, 0x1c, 0x26, 0x61, 0x02,
+	0x6a, 0x8c, 0x92, 0x61, 0x38, 0x0c, 0x11, 0x20, 0x18, 0x1f, 0x93, 0x07, 0x64, 0x26, 0xf1, 0x6d, 0x59, 0x04, 0xb8, 0x4f, 0xc4, 0x48, 0x89, 0x1b,
+	0x42, 0xe4, 0x12, 0xc8, 0xd0, 0x89, 0x18, 0xb0, 0x8c, 0xe4, 0x7c, 0x86, 0x10, 0xc5, 0x75, 0xc4, 0x6a, 0x8f, 0x81, 0x78, 0xe2, 0xf9, 0xc5, 0x4d,
+	0x23, 0x7e, 0xca, 0x9d, 0xd1, 0x78, 0x34, 0x66, 0xbc, 0x2d, 0x19, 0x49, 0x4b, 0xc3, 0x43, 0x26, 0x62, 0xd6, 0x33, 0xc4, 0x0b, 0xbe, 0x0c, 0x76,
+	0x37, 0x61, 0x14, 0x3d, 0x12, 0x6b, 0x15, 0x72, 0xdd, 0x46, 0x6c, 0x6b, 0x1c, 0x00, 0xd9, 0x26, 0x23, 0x29, 0x63, 0x08, 0x0c, 0x4b, 0xe2, 0x4c,
+	0x6c, 0x11, 0x02, 0x9d, 0xc8, 0x4d, 0xe5, 0x3f, 0x46, 0x58, 0x63, 0x71, 0xdd, 0x01, 0x30, 0xcb, 0x17, 0x77, 0xea, 0xe6, 0xc0, 0x9a, 0x49, 0x28,
+	0x19, 0xc4, 0xa0, 0x41, 0xb1, 0xf0, 0xd2, 0xf5, 0xe0, 0x67, 0x27, 0x1d, 0x9b, 0xc1, 0x83, 0x18, 0x56, 0xe6, 0xbb, 0xfc, 0x0f, 0xe6, 0x8a, 0x6e,
+	0x08, 0xb6, 0x44, 0xa6, 0x96, 0xf4, 0x01, 0x26, 0x83, 0x2b, 0x76, 0x74, 0x88, 0x40, 0x2c, 0x11, 0x22, 0x12, 0x77, 0xcc, 0xf5, 0x03, 0xb1, 0xda,
+	0x63, 0x44, 0x11, 0x8e, 0xe5, 0x19, 0x84, 0x0c, 0x82, 0x3b, 0x21, 0xa1, 0x3e, 0x91, 0xb1, 0x95, 0x01, 0x2f, 0xc5, 0x8b, 0xbb, 0xa1, 0x8b, 0x20,
+	0x31, 0x8c, 0xc4, 0xc2, 0x0f, 0x81, 0x95, 0x62, 0x22, 0xc5, 0x53, 0x81, 0xb7, 0xc3, 0x49, 0x2c, 0xff, 0x43, 0x1c, 0xe1, 0x8e, 0xc6, 0xe1, 0x38,
+	0xe4, 0x7a, 0xc1, 0x44, 0x5a, 0xc4, 0x45, 0xec, 0xe1, 0x4b, 0x3d, 0xdd, 0x14, 0x70, 0x2a, 0xc3, 0x21, 0x13, 0x58, 0x61, 0xe0, 0x9c, 0xb9, 0x99,
+	0xeb, 0x13, 0x13, 0x8d, 0xe1, 0x42, 0x20, 0xe1, 0xc5, 0x93, 0xb1, 0x8c, 0x17, 0x7c, 0xf4, 0x5c, 0xf9, 0xcf, 0xe7, 0x12, 0x8b, 0xf8, 0xe0, 0x09,
+	0x40, 0x32, 0x32, 0xe6, 0x6c, 0x82, 0x80, 0x4a, 0x7a, 0xc5, 0x34, 0x25, 0x98, 0x5f, 0x1c, 0xc0, 0x24, 0x40, 0xbc, 0xe4, 0xa5, 0xa6, 0x3c, 0x08,
+	0xc0, 0x7c, 0x71, 0x39, 0x6e, 0x86, 0x90, 0x41, 0x4a, 0x22, 0x7d, 0x38, 0xe1, 0x82, 0x9e, 0x14, 0x61, 0x02, 0x28, 0x17, 0x2e, 0x14, 0x1b, 0x84,
+	0x58, 0x30, 0x8a, 0x86, 0xf2, 0x5f, 0xce, 0xf5, 0x22, 0xa1, 0xaf, 0x31, 0xe0, 0x5c, 0x8c, 0x86, 0x58, 0x37, 0x10, 0xb1, 0x18, 0x4f, 0x33, 0x6a,
+	0x91, 0x60, 0x22, 0x8e, 0xd7, 0x45, 0x90, 0xe8, 0x98, 0xe2, 0x4e, 0xb8, 0xf0, 0x19, 0x89, 0x3f, 0x49, 0xc1, 0xb3, 0xe2, 0xbd, 0xc4, 0x77, 0x20,
+	0xae, 0x4b, 0x47, 0xe2, 0x8e, 0x43, 0x20, 0xbb, 0x98, 0x33, 0x99, 0x70, 0x0c, 0x0e, 0x1c, 0x69, 0xa7, 0x31, 0xe2, 0x31, 0x99, 0x84, 0x32, 0xff,
+	0x13, 0x2e, 0xa4, 0x99, 0xff, 0x18, 0xde, 0x47, 0x62, 0x47, 0x53, 0x30, 0xb0, 0x9b, 0x89, 0x87, 0xc8, 0x11, 0x4d, 0x8d, 0x62, 0x31, 0x04, 0x0e,
+	0xe2, 0x68, 0xe9, 0x74, 0xf1, 0x33, 0x88, 0x3e, 0x64, 0xd2, 0xc8, 0x7f, 0x44, 0xe5, 0x44, 0xfa, 0x4a, 0xa8, 0xd7, 0x82, 0xb0, 0x67, 0x40, 0x38,
+	0x1a, 0x12, 0x85, 0x51, 0x02, 0xa2, 0x30, 0xfa, 0x87, 0x28, 0x0c, 0xb7, 0x4a, 0x14, 0xc6, 0xd0, 0x22, 0x0a, 0x73, 0xf2, 0x03, 0x85, 0x39, 0x07,
+	0x81, 0xc2, 0x30, 0x77, 0x44, 0x61, 0x34, 0x13, 0x87, 0x0e, 0xda, 0x86, 0x28, 0x8c, 0xfe, 0x21, 0x0a, 0x03, 0x24, 0x88, 0xc2, 0xb0, 0xa8, 0x44,
+	0x61, 0xd0, 0x19, 0x51, 0x18, 0xd6, 0x97, 0x28, 0x0c, 0xb7, 0x4a, 0x14, 0x06, 0x8f, 0x12, 0x85, 0x81, 0x64, 0x44, 0x61, 0x20, 0x03, 0x51, 0x18,
+	0xbd, 0x46, 0x14, 0x46, 0xb7, 0x12, 0x85, 0x31, 0x88, 0x88, 0xc2, 0xe8, 0x61, 0xa2, 0x30, 0x0c, 0x31, 0x51, 0x18, 0xac, 0x4d, 0x14, 0x26, 0x3d,
+	0x00, 0x85, 0xe1, 0xbc, 0x88, 0xc2, 0x80, 0x2f, 0xa2, 0x30, 0xfc, 0x18, 0x51, 0x18, 0xb3, 0x82, 0x28, 0x8c, 0xe9, 0x48, 0x14, 0x06, 0x50, 0x11,
+	0x85, 0x31, 0x41, 0x88, 0xc2, 0x98, 0x36, 0x44, 0x61, 0x4c, 0x10, 0xa2, 0x30, 0xa6, 0x0d, 0x51, 0x18, 0xdd, 0x4a, 0x14, 0x06, 0x97, 0x13, 0x85,
+	0x11, 0x47, 0x10, 0x85, 0xc1, 0x1f, 0x44, 0x61, 0xd8, 0x17, 0xa2, 0x30, 0x8c, 0x15, 0x51, 0x18, 0xd4, 0x47, 0x14, 0x06, 0xd1, 0x12, 0x85, 0xe1,
+	0x14, 0x89, 0xc2, 0xb0, 0x3a, 0x44, 0x61, 0x30, 0x3c, 0x51, 0x18, 0x44, 0x40, 0x14, 0xa6, 0x07, 0x00, 0x35, 0x80, 0xef, 0x88, 0xc2, 0x18, 0xb2,
+	0x44, 0x61, 0xf0, 0x1d, 0x51, 0x18, 0xbe, 0x89, 0x28, 0x0c, 0x63, 0x45, 0x14, 0x86, 0xd5, 0x21, 0x0a, 0x23, 0xac, 0x21, 0x0a, 0x63, 0x2a, 0x10,
+	0x85, 0xc1, 0xa3, 0x44, 0x61, 0x44, 0x0c, 0x44, 0x61, 0xc4, 0x06, 0x44, 0x61, 0x60, 0x00, 0x51, 0x18, 0xe6, 0x83, 0x28, 0x0c, 0x3c, 0x26, 0x0a,
+	0xc3, 0x0b, 0x11, 0x85, 0x81, 0xd2, 0x44, 0x61, 0x78, 0x63, 0xa2, 0x30, 0x1c, 0x1d, 0x51, 0x18, 0x70, 0x40, 0x14, 0xc6, 0xe4, 0x27, 0x0a, 0x23,
+	0x30, 0x22, 0x0a, 0x23, 0xe8, 0x23, 0x0a, 0x23, 0x30, 0x22, 0x0a, 0x23, 0xfe, 0x23, 0x0a, 0x23, 0x22, 0x23, 0x0a, 0xd3, 0xce, 0x02, 0x85, 0x11,
+	0xd3, 0x11, 0x85, 0x31, 0xf1, 0x88, 0xc2, 0x30, 0xcf, 0x44, 0x61, 0x18, 0x57, 0xa2, 0x30, 0x0c, 0x3c, 0x51, 0x18, 0x61, 0x0d, 0x51, 0x18, 0xb1,
+	0x0c, 0x51, 0xb8, 0x0e, 0xc2, 0x5e, 0x42, 0x14, 0x46, 0x30, 0x49, 0x2e, 0x44, 0xd0, 0x47, 0x14, 0x06, 0xb6, 0x10, 0x85, 0x01, 0xa1, 0x44, 0x61,
+	0x40, 0x12, 0x51, 0x18, 0x51, 0x0b, 0x51, 0x18, 0x66, 0x94, 0x28, 0x0c, 0x58, 0x24, 0x0a, 0x23, 0x74, 0x25, 0x0a, 0x83, 0x9f, 0x89, 0xc2, 0x70,
+	0x32, 0x44, 0x61, 0xf8, 0x31, 0xa2, 0x30, 0x51, 0x04, 0x28, 0x8c, 0x70, 0x89, 0x28, 0x0c, 0xbe, 0x23, 0x0a, 0x83, 0x3f, 0x88, 0xc2, 0x20, 0x65,
+	0xa2, 0x30, 0x0c, 0x1b, 0x51, 0x18, 0x1c, 0x46, 0x14, 0x06, 0x81, 0x13, 0x85, 0xe1, 0x77, 0x89, 0xc2, 0x70, 0xab, 0x44, 0x61, 0xfa, 0x1b, 0x54,
+	0x19, 0x84, 0x48, 0x14, 0x86, 0x87, 0x25, 0x0a, 0x83, 0xad, 0x88, 0xc2, 0x60, 0x36, 0xa2, 0x30, 0xc2, 0x04, 0xa2, 0x30, 0x5c, 0x3b, 0x51, 0x18,
+	0x28, 0x4d, 0x14, 0x06, 0xbe, 0x11, 0x85, 0x41, 0xe0, 0x44, 0x61, 0xf0, 0x12, 0x51, 0x18, 0x40, 0x45, 0x14, 0x06, 0xf8, 0x10, 0x85, 0xc1, 0xe5,
+	0x44, 0x61, 0xc4, 0x69, 0x44, 0x61, 0x84, 0x2a, 0x44, 0x61, 0x84, 0xb9, 0x44, 0x61, 0x90, 0x32, 0x51, 0x18, 0x01, 0x22, 0x51, 0x18, 0x66, 0x9f,
+	0x28, 0x8c, 0x50, 0x90, 0x28, 0x4c, 0x9b, 0x0c, 0x14, 0x46, 0x1c, 0x4c, 0x14, 0x06, 0x92, 0x11, 0x85, 0xc1, 0xb9, 0x44, 0x61, 0x04, 0x93, 0x44,
+	0x61, 0x44, 0xd2, 0x44, 0x61, 0xf0, 0x3e, 0x51, 0x18, 0x9e, 0x9b, 0x28, 0x0c, 0xe2, 0x22, 0x0a, 0x83, 0x34, 0x88, 0xc2, 0xc0, 0x2c, 0xa2, 0x30,
+	0xdc, 0x09, 0x51, 0x18, 0x5c, 0x43, 0x14, 0x06, 0x19, 0x11, 0x85, 0xb1, 0x26, 0x41, 0x14, 0x86, 0xb3, 0x25, 0x0a, 0x23, 0x24, 0x26, 0x0a, 0x23,
+	0x28, 0x21, 0x22, 0x22, 0x88, 0x22, 0x0a, 0x23, 0x00, 0x27, 0x0a, 0x23, 0x5e, 0x25, 0x0a, 0x23, 0x04, 0x22, 0x0a, 0x23, 0xb0, 0x27, 0x0a, 0x23,
+	0x16, 0x27, 0x0a, 0x23, 0xb0, 0x27, 0x0a, 0x03, 0xbe, 0x88, 0xc2, 0x70, 0x74, 0x44, 0x61, 0xc0, 0x22, 0x51, 0x18, 0xee, 0x9a, 0x28, 0x8c, 0x50,
+	0x90, 0x28, 0x8c, 0x18, 0x9f, 0x28, 0x8c, 0x38, 0x98, 0x28, 0x8c, 0xd0, 0x95, 0x28, 0x0c, 0xec, 0x26, 0x0a, 0x63, 0xe9, 0x85, 0x28, 0x8c, 0xf8,
+	0x9a, 0x28, 0x0c, 0x07, 0x4a, 0x14, 0x06, 0x34, 0x13, 0x85, 0x19, 0xcd, 0xa3, 0x9e, 0x58, 0x9e, 0x20, 0x0a, 0x63, 0xad, 0x83, 0x28, 0x8c, 0x28,
+	0x8b, 0x28, 0x0c, 0x4a, 0x25, 0x0a, 0x63, 0xe9, 0x85, 0x28, 0x8c, 0x88, 0x97, 0x28, 0x0c, 0x6f, 0x4c, 0x14, 0x46, 0x7c, 0x4d, 0x14, 0xc6, 0xda,
+	0x01, 0x51, 0x18, 0xc8, 0x4b, 0x14, 0x46, 0xf8, 0x41, 0x14, 0x06, 0x55, 0x13, 0x85, 0xc1, 0x14, 0x44, 0x61, 0xc6, 0xe2, 0x40, 0x61, 0x04, 0x0f,
+	0x44, 0x61, 0x40, 0x3e, 0x51, 0x18, 0x38, 0x44, 0x14, 0x06, 0xf5, 0x11, 0x85, 0x11, 0xee, 0x13, 0x85, 0xb1, 0x54, 0x44, 0x14, 0x06, 0x24, 0x11,
+	0x85, 0x11, 0x57, 0x12, 0x85, 0x11, 0xde, 0x11, 0x85, 0xb1, 0x6a, 0x44, 0x14, 0x46, 0xbc, 0x4a, 0x14, 0x46, 0xc8, 0x46, 0x14, 0x06, 0xb8, 0x13,
+	0x85, 0x11, 0x91, 0x11, 0x85, 0x81, 0xc7, 0x44, 0x61, 0x04, 0xe0, 0x44, 0x61, 0xac, 0x80, 0x10, 0x85, 0x11, 0x62, 0x12, 0x85, 0x11, 0xf7, 0x10,
+	0x85, 0xb1, 0xa4, 0x43, 0x14, 0xc6, 0x62, 0x13, 0x51, 0x18, 0xc0, 0x4a, 0x14, 0x06, 0xe4, 0x13, 0x85, 0x11, 0xba, 0x12, 0x85, 0xb1, 0xfa, 0x40,
+	0x14, 0xe6, 0x02, 0x07, 0x50, 0x18, 0x61, 0x39, 0x51, 0x18, 0x81, 0x3d, 0x51, 0x18, 0x70, 0x4b, 0x14, 0x46, 0xe8, 0x4a, 0x14, 0x46, 0xd4, 0x42,
+	0x14, 0x06, 0xea, 0x11, 0x85, 0x11, 0x3c, 0x10, 0x85, 0x11, 0x3e, 0x93, 0x67, 0x10, 0x7e, 0x10, 0x85, 0xb1, 0x0a, 0x43, 0x14, 0x46, 0xfc, 0x47,
+	0x14, 0xc6, 0xea, 0x19, 0x51, 0x18, 0xab, 0x51, 0x44, 0x61, 0x42, 0x1d, 0x50, 0x18, 0xeb, 0x85, 0x44, 0x61, 0xac, 0xd8, 0x10, 0x85, 0x41, 0xbf,
+	0x44, 0x61, 0x2c, 0x91, 0x10, 0x85, 0x11, 0x3c, 0x10, 0x85, 0xb1, 0x9c, 0x42, 0x14, 0xc6, 0x5a, 0x1d, 0x51, 0x18, 0x70, 0x4b, 0x14, 0xe6, 0xa2,
+	0x05, 0x50, 0x18, 0xd1, 0x3c, 0x51, 0x18, 0x8b, 0x84, 0x44, 0x61, 0x44, 0x90, 0x44, 0x61, 0xac, 0xa1, 0x10, 0x85, 0x81, 0xd2, 0x44, 0x61, 0x84,
+	0x82, 0x44, 0x61, 0x44, 0xf3, 0x44, 0x61, 0xc4, 0x53, 0x44, 0x61, 0xac, 0x85, 0x12, 0x85, 0xb1, 0x26, 0x41, 0x14, 0x46, 0x50, 0x4d, 0x14, 0xc6,
+	0x42, 0x25, 0x51, 0x18, 0x0b, 0xab, 0x44, 0x61, 0x2c, 0x44, 0x10, 0x85, 0x11, 0x05, 0x10, 0x85, 0x19, 0xd3, 0x01, 0x85, 0x11, 0x20, 0x12, 0x85,
+	0xb1, 0x3e, 0x4e, 0x14, 0x46, 0xe0, 0x49, 0x14, 0xc6, 0x7a, 0x00, 0x51, 0x18, 0x2b, 0x36, 0x44, 0x61, 0xac, 0x49, 0x10, 0x85, 0xb1, 0xc8, 0x42,
+	0x14, 0x46, 0x10, 0x45, 0x14, 0x46, 0xe4, 0x4f, 0x14, 0xe6, 0xda, 0x2d, 0x50, 0x18, 0x31, 0x07, 0x51, 0xd8, 0x82, 0xb0, 0x4f, 0x8d, 0x00, 0x51,
+	0x18, 0x03, 0x8e, 0x28, 0x8c, 0x1b, 0x10, 0x85, 0xe1, 0xe5, 0x89, 0xc2, 0xb0, 0xa8, 0x44, 0x61, 0xfa, 0x47, 0xa0, 0x30, 0x63, 0x42, 0xa0, 0x30,
+	0x3c, 0x21, 0x51, 0x18, 0xce, 0x80, 0x43, 0x07, 0x23, 0x87, 0x28, 0x0c, 0xc6, 0x24, 0x0a, 0xc3, 0xce, 0x12, 0x85, 0xe1, 0xb1, 0x88, 0xc2, 0x70,
+	0xa0, 0x44, 0x61, 0x18, 0x4c, 0xa2, 0x30, 0x0c, 0x1b, 0x51, 0x18, 0x06, 0x93, 0x28, 0x0c, 0xab, 0x4e, 0x14, 0x06, 0xdc, 0x12, 0x85, 0x01, 0xd8,
+	0x44, 0x61, 0xcc, 0x78, 0xa2, 0x30, 0x2c, 0x09, 0x51, 0x18, 0x1e, 0x80, 0x28, 0x0c, 0x0f, 0x4b, 0x14, 0x86, 0x53, 0x24, 0x0a, 0x73, 0x71, 0x0d,
+	0x28, 0x0c, 0x7f, 0x43, 0x14, 0x86, 0x75, 0x20, 0x0a, 0x63, 0x3a, 0x12, 0x85, 0x61, 0xd8, 0x88, 0xc2, 0x98, 0xf1, 0x44, 0x61, 0xf8, 0x5d, 0xa2,
+	0x30, 0xec, 0x16, 0x51, 0x18, 0x54, 0x4d, 0x14, 0x06, 0x9a, 0x12, 0x85, 0x41, 0x7d, 0x44, 0x61, 0x10, 0x22, 0x51, 0x18, 0x68, 0x4a, 0x14, 0x06,
+	0x6b, 0x13, 0x85, 0xe1, 0xf3, 0x88, 0xc2, 0x40, 0x5e, 0xa2, 0x30, 0xe2, 0x31, 0xa2, 0x30, 0x00, 0x85, 0x28, 0x0c, 0x53, 0x43, 0x14, 0x06, 0x92,
+	0x11, 0x85, 0x31, 0xb7, 0x89, 0xc2, 0x18, 0x7b, 0x44, 0x61, 0x44, 0x0c, 0x44, 0x61, 0xae, 0xc9, 0x81, 0x1a, 0x60, 0xa1, 0x88, 0xc2, 0x30, 0x4b,
+	0x44, 0x61, 0x8c, 0x48, 0xa2, 0x30, 0xec, 0x21, 0x51, 0x18, 0x51, 0x00, 0x51, 0x98, 0x36, 0x03, 0xe4, 0x82, 0x00, 0x86, 0x28, 0x0c, 0x93, 0x4b,
+	0x14, 0x86, 0xf9, 0x20, 0x0a, 0x63, 0x82, 0x10, 0x85, 0xe1, 0xd2, 0x88, 0xc2, 0x88, 0x5a, 0x88, 0xc2, 0xb0, 0x0e, 0x44, 0x61, 0xb0, 0x2b, 0x51,
+	0x18, 0xfc, 0x41, 0x14, 0x06, 0x60, 0x13, 0x85, 0xe1, 0x56, 0x89, 0xc2, 0xa0, 0x49, 0xa2, 0x30, 0x50, 0x84, 0x28, 0x0c, 0x68, 0x26, 0x0a, 0xd3,
+	0x79, 0x01, 0x85, 0x11, 0x7e, 0x10, 0x85, 0xe1, 0xe5, 0x89, 0xc2, 0x88, 0x02, 0x88, 0xc2, 0xf0, 0xa5, 0x44, 0x61, 0x4e, 0x26, 0xa0, 0x30, 0x6c,
+	0x11, 0x51, 0x18, 0x9e, 0x9b, 0x28, 0x0c, 0x24, 0x23, 0x0a, 0x83, 0x60, 0x88, 0xc2, 0x08, 0x31, 0x89, 0xc2, 0x08, 0x3f, 0x88, 0xc2, 0xa0, 0x07,
+	0xa2, 0x70, 0x1d, 0x84, 0xcd, 0x6a, 0xb0, 0x41, 0x61, 0xd8, 0x22, 0x72, 0x21, 0x26, 0x34, 0x51, 0x18, 0x81, 0x27, 0x51, 0x18, 0x01, 0x17, 0x51,
+	0x18, 0xf1, 0x14, 0x51, 0x18, 0x76, 0x80, 0x28, 0x4c, 0x3c, 0x06, 0x0a, 0x03, 0x92, 0x88, 0xc2, 0xe0, 0x5c, 0xa2, 0x30, 0x38, 0x8c, 0x28, 0x0c,
+	0x9b, 0x4c, 0x14, 0x06, 0xa5, 0x12, 0x85, 0x69, 0xbf, 0x81, 0xc2, 0xf0, 0xf2, 0x44, 0x61, 0x78, 0x0b, 0xa2, 0x30, 0x82, 0x07, 0xa2, 0x30, 0x3c,
+	0x37, 0x51, 0x18, 0xc1, 0x03, 0x51, 0x18, 0x96, 0x9a, 0x28, 0x0c, 0x87, 0x44, 0x14, 0x46, 0x40, 0x4b, 0x14, 0x86, 0xb7, 0x20, 0x0a, 0xf3, 0xe1,
+	0x11, 0xaa, 0x0c, 0xa0, 0x22, 0x0a, 0x23, 0xa8, 0x26, 0x0a, 0x03, 0x87, 0x88, 0xc2, 0x88, 0x86, 0x88, 0xc2, 0x20, 0x0d, 0xa2, 0x30, 0x7c, 0x29,
+	0x51, 0x18, 0xbe, 0x89, 0x28, 0x8c, 0x40, 0x99, 0x28, 0x0c, 0x4b, 0x4d, 0x14, 0x86, 0xd9, 0x27, 0x0a, 0x23, 0xa8, 0x26, 0x0a, 0xc3, 0xf5, 0x10,
+	0x85, 0x11, 0xb5, 0x10, 0x85, 0x41, 0xca, 0x44, 0x61, 0xf8, 0x10, 0xa2, 0x30, 0x4c, 0x39, 0x51, 0x18, 0x8e, 0x99, 0x28, 0x0c, 0xb2, 0x27, 0x0a,
+	0xc3, 0x71, 0x10, 0x85, 0x81, 0xe8, 0x44, 0x61, 0x2e, 0xdd, 0x00, 0x85, 0x11, 0xde, 0x11, 0x85, 0x11, 0x83, 0x12, 0x85, 0xe1, 0xf3, 0x88, 0xc2,
+	0x88, 0xd0, 0x89, 0xc2, 0xf0, 0xb0, 0x44, 0x61, 0x84, 0x56, 0x44, 0x61, 0xc4, 0x06, 0x44, 0x61, 0x38, 0x19, 0xa2, 0x30, 0x5c, 0x3b, 0x51, 0x18,
+	0xee, 0x8f, 0x28, 0x0c, 0x1e, 0x25, 0x0a, 0x23, 0xf0, 0x24, 0x0a, 0x83, 0xa2, 0x88, 0xc2, 0xe0, 0x3b, 0xa2, 0x30, 0x96, 0x27, 0x88, 0xc2, 0x08,
+	0x9f, 0x89, 0xc2, 0x08, 0xce, 0x88, 0x88, 0x08, 0x55, 0x88, 0xc2, 0x88, 0xd0, 0x89, 0xc2, 0x40, 0x11, 0xa2, 0x30, 0x3c, 0x2c, 0x51, 0x18, 0x41,
+	0x14, 0x51, 0x18, 0x28, 0x42, 0x14, 0x06, 0x3a, 0x11, 0x85, 0x11, 0xbd, 0x11, 0x85, 0x11, 0x99, 0x12, 0x85, 0xe9, 0x09, 0x81, 0xc2, 0x08, 0x13,
+	0x88, 0xc2, 0x08, 0xe4, 0x88, 0xc2, 0x08, 0xcb, 0x89, 0xc2, 0x58, 0xd5, 0x20, 0x0a, 0x83, 0x68, 0x89, 0xc2, 0x60, 0x41, 0xa2, 0x30, 0x18, 0x93,
+	0x28, 0x0c, 0x4f, 0x48, 0x14, 0x06, 0xf2, 0x12, 0x85, 0xe1, 0xf0, 0x89, 0xc2, 0x8c, 0xc8, 0x50, 0x4f, 0xe0, 0x1b, 0x51, 0x18, 0xab, 0x0f, 0x44,
+	0x61, 0x2c, 0x70, 0x10, 0x85, 0x49, 0xeb, 0x40, 0x61, 0x84, 0x14, 0x44, 0x61, 0x2c, 0xe9, 0x10, 0x85, 0x01, 0x3e, 0x44, 0x61, 0x84, 0x14, 0x44,
+	0x61, 0x50, 0x35, 0x51, 0x18, 0x64, 0x4f, 0x14, 0x46, 0x24, 0x42, 0x14, 0x46, 0xc4, 0x4b, 0x14, 0x06, 0x34, 0x13, 0x85, 0x19, 0x44, 0x01, 0x85,
+	0xb1, 0x46, 0x45, 0x14, 0x26, 0x8f, 0x02, 0x85, 0x01, 0xf9, 0x44, 0x61, 0xac, 0x3b, 0x11, 0x85, 0x81, 0xf3, 0x44, 0x61, 0x04, 0x04, 0x44, 0x61,
+	0xac, 0xa1, 0x10, 0x85, 0xb1, 0xd0, 0x43, 0x14, 0xc6, 0xb2, 0x07, 0x51, 0x18, 0x88, 0x43, 0x14, 0xc6, 0xe2, 0x0d, 0x51, 0x18, 0x8b, 0x2c, 0x44,
+	0x61, 0x84, 0xa3, 0x44, 0x61, 0x90, 0x11, 0x51, 0x18, 0x54, 0x4d, 0x14, 0xc6, 0x42, 0x04, 0x51, 0x18, 0x2b, 0x41, 0x44, 0x61, 0x84, 0x09, 0x44,
+	0x61, 0x20, 0x3a, 0x51, 0x18, 0x0c, 0x44, 0x14, 0x46, 0x58, 0x4e, 0x14, 0x06, 0xe7, 0x12, 0x85, 0xb1, 0xc0, 0x41, 0x14, 0xc6, 0xd2, 0x00, 0x51,
+	0x18, 0x31, 0x3e, 0x51, 0x98, 0x0b, 0x74, 0x40, 0x61, 0x44, 0x17, 0x44, 0x61, 0x04, 0xbf, 0x44, 0x61, 0x10, 0x22, 0x51, 0x18, 0x8b, 0x16, 0x44,
+	0x61, 0xac, 0xd8, 0x10, 0x85, 0x11, 0xbd, 0x11, 0x85, 0x11, 0x12, 0x13, 0x85, 0xb9, 0x98, 0x07, 0x9e, 0xc1, 0x12, 0x09, 0x51, 0x18, 0xb1, 0x2d,
+	0x51, 0x18, 0x4b, 0x24, 0x44, 0x61, 0x44, 0xb1, 0x44, 0x61, 0x84, 0xa3, 0x44, 0x61, 0x3e, 0xff, 0x03, 0x0a, 0x03, 0xd1, 0x89, 0xc2, 0x08, 0xaa,
+	0x89, 0xc2, 0x08, 0xe4, 0x88, 0xc2, 0x58, 0xd2, 0x21, 0x0a, 0x23, 0xf8, 0x25, 0x0a, 0x03, 0x2c, 0x89, 0xc2, 0x88, 0x41, 0x89, 0xc2, 0x00, 0x40,
+	0xa2, 0x30, 0x17, 0x9d, 0x81, 0xc2, 0x58, 0x01, 0x21, 0x0a, 0x23, 0x96, 0x21, 0x0a, 0x63, 0x21, 0x82, 0x28, 0x8c, 0x25, 0x28, 0xa2, 0x30, 0x42,
+	0x41, 0xa2, 0x30, 0x56, 0x11, 0x89, 0xc2, 0x88, 0x7b, 0x88, 0xc2, 0x58, 0xf3, 0x21, 0x0a, 0x63, 0x55, 0x83, 0x28, 0x8c, 0x65, 0x30, 0xa2, 0x30,
+	0x56, 0x09, 0x88, 0xc2, 0x08, 0xce, 0x88, 0xc2, 0x58, 0x1c, 0x23, 0x0a, 0x03, 0xc6, 0x89, 0xc2, 0x58, 0x4d, 0x25, 0x0a, 0xf3, 0xc1, 0x18, 0x50,
+	0x18, 0xab, 0x9e, 0x44, 0x61, 0xc4, 0x27, 0x44, 0x61, 0x2e, 0x15, 0x01, 0x85, 0xb1, 0x32, 0x48, 0x14, 0xc6, 0x2a, 0x2d, 0x51, 0x18, 0x4b, 0x5b,
+	0x44, 0x61, 0xac, 0xbf, 0x11, 0x85, 0x41, 0xca, 0x44, 0x61, 0x2c, 0xcd, 0x12, 0x85, 0x19, 0x26, 0x00, 0x85, 0xb1, 0x78, 0x43, 0x14, 0xb6, 0x20,
+	0x1c, 0x10, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30,
+	0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x39, 0x74, 0x08, 0xc2, 0x70, 0x0d, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10,
+	0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2,
+	0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03,
+	0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98,
+	0x28, 0x0c, 0x10, 0x26, 0x0a, 0xf3, 0xd9, 0x28, 0x50, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80, 0x30, 0x51,
+	0x98, 0x8f, 0x62, 0x80, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x7c, 0xac, 0x0b, 0x14,
+	0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x26, 0x08, 0x83, 0x1a, 0x00, 0xc2, 0x44, 0x61, 0x80,
+	0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0xe6, 0xc2, 0x00, 0x50, 0x18, 0x20, 0x4c, 0x14, 0x26, 0x08, 0x83, 0x5c, 0x00, 0xc2, 0x44, 0x61, 0x82, 0x30,
+	0x6c, 0x10, 0xe3, 0x68, 0xa0, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28,
+	0x0c, 0x10, 0x26, 0x0a, 0x73, 0xa5, 0x19, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x57, 0x8f, 0x81, 0xc2,
+	0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10,
+	0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2,
+	0xf0, 0x36, 0x08, 0x13, 0x85, 0x01, 0xc2, 0xe4, 0x42, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61,
+	0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08,
+	0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0xa6, 0xbc, 0x08, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89,
+	0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x53, 0xc4, 0x03, 0x14, 0x26, 0x08, 0xa3, 0xca, 0x00, 0x61, 0xa2, 0x30,
+	0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84,
+	0x89, 0xc2, 0x04, 0x61, 0xa0, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x54, 0x25, 0x01, 0x85, 0x01, 0xc2, 0x44,
+	0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0xaa, 0xc9, 0x80, 0xc2, 0x7c, 0x0c, 0x0d, 0x14,
+	0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x3e, 0x8c, 0x01, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c,
+	0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x5c, 0x6d, 0x01, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10,
+	0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0x88, 0x00, 0x61, 0xa2,
+	0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x4c, 0x10, 0x06, 0x0a, 0x03,
+	0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0xcc, 0xf5, 0x72, 0xa0, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84,
+	0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x5c, 0xfb, 0x05, 0x0a, 0x03, 0x84, 0x89,
+	0xc2, 0x04, 0x61, 0xd4, 0x13, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06,
+	0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80, 0x30,
+	0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x09, 0xc2, 0x40, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85,
+	0x01, 0xc2, 0x44, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20,
+	0x4c, 0x14, 0xa6, 0x7e, 0x0e, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26,
+	0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30,
+	0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x04, 0x61, 0xa0, 0x30, 0x41, 0x18, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84,
+	0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x13, 0x84, 0xc1, 0x33, 0x00, 0x61, 0xa2, 0x30, 0xf5, 0x7e, 0x40,
+	0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0xe6,
+	0x13, 0x0d, 0xa0, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x57, 0x42, 0x81, 0xc2, 0x00,
+	0x61, 0xa2, 0x30, 0x40, 0x98, 0x28, 0x4c, 0x10, 0x06, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61, 0xa2, 0x30, 0x9f, 0x89, 0x00, 0x85, 0x01, 0xc2,
+	0x44, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80, 0x30, 0x51, 0x98, 0x20, 0x0c, 0x14,
+	0x06, 0x08, 0x13, 0x85, 0x09, 0xc2, 0x40, 0x61, 0x80, 0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x80,
+	0x30, 0x51, 0x18, 0x20, 0x4c, 0x14, 0x06, 0x08, 0x13, 0x85, 0x01, 0xc2, 0x44, 0x61, 0x3e, 0x88, 0x06, 0x0a, 0x03, 0x84, 0x89, 0xc2, 0x00, 0x61,
+	0xa2, 0x30, 0x40, 0x98, 0x28, 0x0c, 0x10, 0x26, 0x0a, 0x5b, 0x10, 0x1e, 0x62, 0xb3, 0x84, 0x2b, 0xe3, 0x75, 0x84, 0xea, 0x8c, 0xb2, 0xc0, 0x0d,
+	0x87, 0x80, 0x3a, 0xa9, 0xc2, 0x48, 0xe0, 0xcc, 0xe7, 0x32, 0xf2, 0x48, 0xc0, 0x07, 0xcb, 0x94, 0x32, 0xea, 0x43, 0x3e, 0x73, 0x75, 0xf3, 0x49,
+	0x1a, 0x0c, 0xe1, 0x22, 0xa2, 0x24, 0x8f, 0x86, 0x63, 0xee, 0x6f, 0x8b, 0x33, 0x19, 0x30, 0x5c, 0xe8, 0x94, 0x81, 0x93, 0x33, 0x74, 0x88, 0x04,
+	0x22, 0x42, 0xa2, 0xf4, 0x78, 0x9c, 0x24, 0x23, 0xaa, 0x63, 0xc4, 0xc5, 0x78, 0x41, 0x02, 0x3f, 0x16, 0x18, 0x77, 0x35, 0xe2, 0x73, 0xdf, 0xa1,
+	0xb8, 0xda, 0x18, 0x0d, 0xe2, 0x85, 0xfe, 0x30, 0x08, 0xe0, 0xbc, 0xe2, 0xa1, 0x18, 0x15, 0x1f, 0xf4, 0x9b, 0x66, 0xb1, 0x2b, 0xa6, 0x04, 0xad,
+	0x30, 0x8c, 0x23, 0x37, 0x86, 0x97, 0x0f, 0x86, 0x59, 0x24, 0xae, 0x94, 0xa6, 0x3c, 0xcf, 0x24, 0x48, 0x83, 0xce, 0xc8, 0x17, 0x14, 0x19, 0xda,
+	0x07, 0xad, 0x41, 0x92, 0x3b, 0xe4, 0x25, 0xc1, 0x5c, 0xf1, 0x22, 0x30, 0x56, 0xb1, 0x59, 0x11, 0x42, 0x14, 0x20, 0x51, 0x8c, 0x71, 0x33, 0x58,
+	0xb1, 0x1c, 0x8a, 0x87, 0x4c, 0x00, 0x80, 0x71, 0x1e, 0xa6, 0x12, 0x04, 0x63, 0xec, 0x0d, 0x65, 0x72, 0x4f, 0x28, 0x68, 0x91, 0x7a, 0x8e, 0x7d,
+	0x0c, 0x22, 0x89, 0x9e, 0x02, 0xcf, 0x85, 0x35, 0x0b, 0xc4, 0xe6, 0x84, 0x7c, 0x40, 0x3e, 0xce, 0x04, 0x95, 0xb9, 0x48, 0x33, 0x92, 0x68, 0x78,
+	0x3c, 0x09, 0x29, 0x6e, 0x1f, 0x8b, 0xfd, 0xa6, 0x13, 0x9f, 0x0c, 0xc7, 0x7e, 0x16, 0x72, 0xcd, 0x33, 0x16, 0x46, 0x4a, 0x89, 0x2d, 0x62, 0x90,
+	0x73, 0x70, 0x4d, 0xee, 0x8c, 0xc7, 0x11, 0x95, 0x34, 0x89, 0x8c, 0xc7, 0x88, 0x21, 0xea, 0x28, 0x4d, 0x32, 0xa1, 0x58, 0x6a, 0x16, 0x53, 0xe9,
+	0x38, 0x78, 0xcd, 0x6c, 0x28, 0x53, 0xd0, 0xe5, 0x18, 0x19, 0x0d, 0x65, 0x56, 0x20, 0xfc, 0x08, 0xbd, 0xa1, 0x3f, 0xca, 0x01, 0xee, 0x02, 0x2a,
+	0xe2, 0xf2, 0x30, 0xf9, 0x65, 0xf0, 0xc7, 0x51, 0xc6, 0x87, 0xf4, 0xd9, 0x58, 0x22, 0x33, 0x3e, 0xa8, 0x9a, 0x38, 0x63, 0x09, 0x30, 0x51, 0x5e,
+	0x89, 0x80, 0x43, 0x3e, 0x20, 0x1f, 0xcb, 0xd5, 0xc6, 0xbd, 0x61, 0x06, 0xa5, 0x59, 0x98, 0x70, 0x2a, 0x48, 0x81, 0xf3, 0x71, 0xcc, 0x35, 0xfb,
+	0x91, 0xf8, 0x00, 0x8f, 0x51, 0x40, 0x20, 0x63, 0x93, 0xeb, 0xb9, 0xbe, 0x0c, 0xff, 0x7c, 0x48, 0x79, 0xe8, 0x70, 0x18, 0xc5, 0x00, 0xec, 0xd8,
+	0x13, 0xf0, 0x1c, 0x63, 0x3a, 0x7a, 0xc2, 0x9a, 0x89, 0x87, 0xb9, 0x32, 0x0e, 0x93, 0xa1, 0xd4, 0x1f, 0x8d, 0xea, 0xfb, 0x23, 0x67, 0x4c, 0x81,
+	0x87, 0xc4, 0x99, 0x63, 0x8a, 0x1a, 0x3d, 0x3f, 0x96, 0x51, 0x84, 0x00, 0x46, 0xc8, 0xc2, 0x0f, 0xf9, 0x10, 0x2e, 0x33, 0x04, 0x49, 0xe3, 0x3a,
+	0x96, 0xe1, 0x27, 0xe6, 0x15, 0xb1, 0x8c, 0x04, 0x6f, 0x71, 0x00, 0x3f, 0x26, 0xc8, 0x21, 0xd7, 0xc3, 0x26, 0x07, 0x59, 0x38, 0xc9, 0x3c, 0xee,
+	0x8c, 0x19, 0xa6, 0x51, 0x1e, 0x70, 0xf5, 0x2d, 0x74, 0x0c, 0x43, 0x02, 0xf5, 0x5c, 0x3f, 0x08, 0x3d, 0xc6, 0x53, 0x81, 0x98, 0xe7, 0x8c, 0xfa,
+	0xd1, 0xc0, 0x93, 0x98, 0x02, 0xbc, 0x2f, 0xb1, 0x90, 0x58, 0xb6, 0xc8, 0x0a, 0x4c, 0x23, 0x31, 0x4c, 0x1e, 0x9f, 0x05, 0x88, 0xf7, 0xe3, 0xaa,
+	0x74, 0x2c, 0x9d, 0x99, 0x70, 0xb1, 0x55, 0x32, 0xce, 0x68, 0x28, 0x86, 0x99, 0x84, 0x1f, 0xb9, 0x43, 0xf3, 0x1c, 0x66, 0xae, 0x83, 0x50, 0x45,
+	0xe2, 0x11, 0x77, 0x1c, 0x21, 0x3e, 0x99, 0x84, 0xa9, 0x58, 0x46, 0x44, 0x43, 0x69, 0xea, 0x67, 0xce, 0x90, 0x9a, 0x71, 0x69, 0xe9, 0x38, 0x45,
+	0xcc, 0x31, 0x71, 0x87, 0x62, 0x89, 0x11, 0x15, 0x8e, 0x5c, 0xe1, 0x9a, 0xd4, 0xb1, 0x6b, 0xf6, 0xa1, 0x9c, 0xe7, 0xce, 0x86, 0xa1, 0xe3, 0x72,
+	0xbd, 0xd1, 0x9d, 0x4c, 0xc6, 0x79, 0xec, 0xf1, 0x19, 0x50, 0x2c, 0x98, 0x0b, 0x77, 0x32, 0x96, 0xf0, 0x30, 0xe0, 0x23, 0x84, 0x70, 0x94, 0x4a,
+	0x68, 0x0b, 0x7c, 0x8b, 0x1d, 0x19, 0x01, 0x1e, 0x37, 0xb1, 0x8c, 0x8c, 0x49, 0x05, 0x45, 0x99, 0xe2, 0x0e, 0x63, 0xb8, 0xa9, 0x91, 0x8c, 0xde,
+	0x2c, 0x03, 0x3d, 0x88, 0x21, 0x48, 0x9c, 0x08, 0xee, 0x6f, 0x94, 0x04, 0x9e, 0x93, 0x67, 0xb4, 0xc9, 0xe3, 0xc0, 0xcd, 0x92, 0x2d, 0x86, 0x97,
+	0x98, 0xdf, 0x91, 0xc1, 0x03, 0xab, 0xe1, 0x79, 0x06, 0xcb, 0xc7, 0xb4, 0xb3, 0xae, 0xd8, 0x64, 0x94, 0x21, 0x19, 0x46, 0x32, 0x52, 0x10, 0xde,
+	0xa5, 0xd2, 0x4e, 0x39, 0x62, 0x50, 0x47, 0xac, 0xa5, 0x3f, 0xe6, 0x06, 0x92, 0x34, 0x92, 0x4e, 0x71, 0x29, 0xe8, 0x96, 0x98, 0x85, 0xce, 0xc0,
+	0x84, 0x27, 0x66, 0xc9, 0x07, 0xa6, 0x71, 0x98, 0x44, 0x21, 0x95, 0x81, 0xc6, 0x7b, 0x31, 0xe8, 0x13, 0xef, 0x1a, 0x4a, 0xb0, 0x13, 0x91, 0x26,
+	0x23, 0x89, 0x62, 0x19, 0x6d, 0x0e, 0x85, 0x2a, 0xb8, 0x46, 0x10, 0x88, 0x0f, 0x0f, 0xe1, 0x22, 0x5c, 0xe3, 0x91, 0xc8, 0x6c, 0x10, 0x22, 0x10,
+	0xe7, 0x43, 0x37, 0x95, 0x21, 0x09, 0x7e, 0x96, 0x22, 0x8e, 0x82, 0x98, 0xfb, 0x2c, 0x12, 0x71, 0x73, 0x11, 0xd8, 0x4a, 0xd0, 0xcc, 0x8f, 0xf9,
+	0x04, 0x5d, 0xee, 0xe0, 0x78, 0x84, 0x5b, 0xf1, 0x7c, 0x9e, 0x90, 0x86, 0xcf, 0xf0, 0x2e, 0x16, 0x03, 0x9f, 0xd2, 0x3f, 0x4e, 0xc4, 0xde, 0xf3,
+	0x21, 0xda, 0x38, 0x4e, 0x46, 0x94, 0x21, 0x4b, 0xc4, 0x12, 0x31, 0xee, 0x11, 0xa3, 0x9e, 0x45, 0x13, 0x92, 0xe7, 0x48, 0xcc, 0xf7, 0x04, 0x31,
+	0x47, 0x64, 0x8c, 0xd5, 0x88, 0x32, 0x15, 0xe9, 0xbf, 0x94, 0xab, 0x17, 0x91, 0xcc, 0xe2, 0xd0, 0x01, 0x3f, 0x4b, 0x40, 0xec, 0x7a, 0xe1, 0x84,
+	0xca, 0xcb, 0x91, 0xc4, 0xc6, 0x00, 0xc0, 0x20, 0x08, 0xcd, 0x52, 0x35, 0x16, 0xa0, 0xc4, 0xb5, 0x8c, 0x18, 0xf4, 0x8d, 0xe3, 0xc0, 0x97, 0xf0,
+	0x0c, 0xa1, 0x6b, 0x2c, 0x5e, 0x2e, 0x4c, 0xb9, 0x98, 0x9d, 0xa5, 0x39, 0xc3, 0xe7, 0x78, 0x9c, 0x09, 0xe2, 0x87, 0xd4, 0xb1, 0x88, 0x0f, 0x4a,
+	0x00, 0x3e, 0x81, 0x58, 0xdd, 0xf1, 0x90, 0xaa, 0x0e, 0x7f, 0x32, 0xf2, 0x3c, 0xae, 0xa2, 0x07, 0xc2, 0x16, 0x2e, 0xf5, 0x82, 0xc3, 0x20, 0xf2,
+	0x82, 0x11, 0x71, 0x3e, 0x8e, 0xc5, 0x0a, 0x81, 0x6b, 0xb2, 0x7c, 0xe2, 0x73, 0x59, 0x4a, 0x0a, 0x36, 0x91, 0x26, 0x83, 0xbf, 0x49, 0x65, 0xe6,
+	0xe5, 0xf6, 0x91, 0xb5, 0x14, 0xc2, 0x01, 0x71, 0x39, 0xe9, 0x38, 0x1c, 0x7a, 0x19, 0x1f, 0x3c, 0x26, 0x6e, 0xe6, 0x53, 0x77, 0x23, 0x79, 0xb9,
+	0x61, 0x48, 0x7c, 0x1b, 0x39, 0x31, 0x57, 0x7c, 0xa4, 0x69, 0xc4, 0x05, 0x60, 0x55, 0x23, 0x18, 0x49, 0x0f, 0x72, 0x79, 0x39, 0x1a, 0xe7, 0xe2,
+	0x6e, 0xb9, 0xda, 0x2d, 0xfe, 0xcf, 0xa7, 0x06, 0x7b, 0x28, 0x23, 0x5c, 0x22, 0xe5, 0x31, 0x1f, 0xf6, 0xfa, 0x42, 0x3b, 0xdc, 0x99, 0x27, 0xce,
+	0x3f, 0x03, 0x55, 0xa7, 0x13, 0x21, 0x0a, 0x3e, 0x86, 0x96, 0xab, 0x23, 0x99, 0xd6, 0x54, 0xc9, 0xa7, 0x81, 0x13, 0x73, 0x6b, 0x60, 0x98, 0x0f,
+	0xc7, 0x2e, 0x58, 0x30, 0x1a, 0x4a, 0xa7, 0x65, 0xc4, 0x6e, 0x31, 0x73, 0xe3, 0x8c, 0x8f, 0xec, 0xf2, 0x48, 0xc2, 0x17, 0x44, 0xc7, 0x5e, 0xe2,
+	0x47, 0x93, 0x94, 0xbb, 0xcb, 0xcc, 0x24, 0xe2, 0xd6, 0x99, 0x30, 0x1a, 0xe6, 0x49, 0x32, 0xa1, 0x0b, 0x16, 0x7f, 0x1a, 0x62, 0x9d, 0x21, 0x97,
+	0xa8, 0xd4, 0x25, 0x24, 0x4d, 0xf0, 0xb8, 0x3e, 0xe3, 0x8e, 0x3d, 0x7f, 0x22, 0x3d, 0x8e, 0x81, 0x68, 0x72, 0xcb, 0xb1, 0xd6, 0x31, 0xc9, 0x87,
+	0xe9, 0xd8, 0x41, 0xb0, 0x13, 0x0a, 0x38, 0x4d, 0x7c, 0x80, 0x5a, 0x98, 0xa7, 0x43, 0x2f, 0x05, 0xd7, 0x24, 0x12, 0xd3, 0xb8, 0x1e, 0x96, 0x69,
+	0x12, 0x31, 0x7e, 0x93, 0x09, 0x42, 0x0a, 0x89, 0xbd, 0xc6, 0x42, 0xc7, 0x44, 0x48, 0xf1, 0x68, 0x94, 0x2c, 0x1b, 0xed, 0x56, 0x4c, 0x22, 0x48,
+	0x24, 0xf4, 0x1a, 0x8d, 0xb9, 0x2b, 0x32, 0x1b, 0x4e, 0xdc, 0x31, 0x97, 0x81, 0x93, 0x89, 0xd4, 0x0e, 0x28, 0x3d, 0xf6, 0x03, 0x41, 0x36, 0x20,
+	0x83, 0x58, 0xcc, 0xa1, 0x80, 0x09, 0x23, 0xde, 0x3c, 0xcf, 0x42, 0x2c, 0xc8, 0xc8, 0xf8, 0x4e, 0xc4, 0x87, 0x22, 0x81, 0x30, 0xac, 0xe0, 0x15,
+	0x4c, 0x5b, 0x24, 0x3e, 0x2d, 0x4e, 0xf9, 0xa0, 0x29, 0xcc, 0xfd, 0x10, 0xab, 0x5c, 0x32, 0xba, 0x73, 0x67, 0x82, 0xb0, 0xdc, 0x13, 0x68, 0x19,
+	0x25, 0x58, 0x32, 0xf3, 0xdd, 0x28, 0x10, 0x6f, 0x80, 0xb0, 0x51, 0x62, 0x54, 0xe9, 0x24, 0x0c, 0x18, 0x69, 0xb4, 0x49, 0xc0, 0x0d, 0x9a, 0xc3,
+	0x48, 0x22, 0x27, 0x44, 0x59, 0xa3, 0x20, 0xc8, 0xe2, 0x84, 0x0a, 0xea, 0x44, 0xda, 0x27, 0xc2, 0xda, 0x81, 0x9d, 0x58, 0x48, 0xeb, 0x47, 0xa3,
+	0x74, 0xec, 0xda, 0x87, 0x9f, 0xe6, 0xb1, 0x16, 0x46, 0x89, 0x58, 0x25, 0x31, 0xf2, 0x30, 0x57, 0x79, 0x92, 0x0e, 0x1d, 0x2e, 0xbd, 0x8c, 0x26,
+	0x6e, 0x1e, 0x62, 0x41, 0x66, 0x14, 0x4a, 0x84, 0xce, 0x55, 0x82, 0xc0, 0xcf, 0xf2, 0xd8, 0xc1, 0x4a, 0x9b, 0x19, 0x0e, 0x41, 0x3a, 0xa4, 0xfc,
+	0x65, 0x22, 0x91, 0x38, 0x16, 0x64, 0x26, 0xe2, 0x67, 0xe2, 0x21, 0x56, 0x1f, 0x64, 0x02, 0x44, 0xe3, 0x31, 0x56, 0x6c, 0xc4, 0x26, 0x24, 0x6e,
+	0x1e, 0xf3, 0x31, 0x86, 0x38, 0x38, 0x77, 0xc4, 0x48, 0x5a, 0x22, 0xb2, 0x88, 0xef, 0x05, 0x70, 0xc7, 0x89, 0x38, 0x0c, 0x3e, 0x93, 0x1e, 0x8b,
+	0x31, 0x01, 0xe4, 0xcb, 0xad, 0xe2, 0xc0, 0x45, 0x90, 0x2a, 0xa3, 0x4d, 0x0c, 0x05, 0xf0, 0x6d, 0x22, 0x56, 0x21, 0xa5, 0x02, 0x2f, 0x9b, 0x88,
+	0x8b, 0xe0, 0x93, 0x33, 0x71, 0x0c, 0xe2, 0xb1, 0xb1, 0x70, 0x32, 0x31, 0xf4, 0xe4, 0x22, 0x40, 0xf4, 0x47, 0x91, 0xeb, 0x24, 0x23, 0x3e, 0xe0,
+	0x16, 0x26, 0x0e, 0xb0, 0x98, 0x27, 0x3c, 0xe4, 0xfb, 0xc9, 0x98, 0xc0, 0x1a, 0x89, 0xc1, 0xe4, 0xa3, 0x14, 0xb9, 0x28, 0x99, 0x20, 0x50, 0x16,
+	0xf3, 0x9b, 0x48, 0xb8, 0x88, 0x05, 0x45, 0x31, 0xe4, 0x92, 0x1c, 0xcf, 0xd3, 0x64, 0x40, 0xa4, 0x39, 0x28, 0x55, 0xd0, 0x56, 0x00, 0x1c, 0xeb,
+	0x01, 0xae, 0xe1, 0x24, 0xaa, 0xef, 0x47, 0x7e, 0x22, 0xd1, 0x97, 0xdd, 0x08, 0x95, 0x4b, 0x0f, 0x62, 0xdd, 0x49, 0x9c, 0x4d, 0x2a, 0xc4, 0xcb,
+	0x4d, 0x3d, 0x7e, 0x2a, 0xc1, 0x0c, 0xa0, 0x41, 0x58, 0x27, 0xa5, 0x1c, 0x3b, 0x31, 0x23, 0xc6, 0x47, 0x60, 0x1f, 0x4f, 0xc2, 0x71, 0x12, 0xf8,
+	0x14, 0x78, 0x88, 0x89, 0x0e, 0x3c, 0x3e, 0x4a, 0x89, 0xfc, 0xc0, 0xc1, 0xda, 0xa2, 0x6b, 0xac, 0xae, 0x3f, 0xa2, 0x34, 0x4d, 0x58, 0x7c, 0xc8,
+	0xc0, 0x73, 0xec, 0x27, 0x01, 0x05, 0xf3, 0x79, 0xee, 0xa4, 0x93, 0x21, 0x56, 0x27, 0xfd, 0x49, 0x34, 0x76, 0x28, 0xef, 0x94, 0x30, 0x2c, 0x11,
+	0xc3, 0x83, 0x01, 0x2e, 0x66, 0x2e, 0xa3, 0x66, 0x3c, 0x0c, 0x86, 0x61, 0xe2, 0x52, 0xfc, 0x2d, 0x8c, 0x3a, 0x0e, 0x42, 0x06, 0x88, 0x12, 0x2e,
+	0x84, 0x76, 0xf3, 0xa9, 0xb8, 0x1f, 0xee, 0x1b, 0x92, 0x21, 0x34, 0x1e, 0x0a, 0xb8, 0x59, 0x10, 0x0e, 0x01, 0xc2, 0x0e, 0x51, 0x18, 0xf5, 0x25,
+	0x0a, 0x03, 0x21, 0x89, 0xc2, 0x70, 0xd7, 0x44, 0x61, 0x58, 0x54, 0xa2, 0x30, 0xc6, 0x1e, 0x51, 0x98, 0x2b, 0xb7, 0x40, 0x61, 0xb8, 0x1e, 0xa2,
+	0x30, 0x5a, 0x97, 0x28, 0x4c, 0xb9, 0x25, 0x50, 0x18, 0xae, 0x9d, 0x28, 0x0c, 0x8c, 0x25, 0x0a, 0x63, 0xa4, 0x13, 0x85, 0x61, 0x93, 0x89, 0xc2,
+	0x70, 0x53, 0x44, 0x61, 0x20, 0x19, 0x51, 0x98, 0x8f, 0xaf, 0x80, 0xc2, 0x70, 0xed, 0x44, 0x61, 0xee, 0xf9, 0x01, 0x0a, 0xa3, 0xdf, 0x89, 0xc2,
+	0x40, 0x27, 0xa2, 0x30, 0xdc, 0x14, 0x51, 0x18, 0x9e, 0x85, 0x28, 0x8c, 0x39, 0x48, 0x14, 0x06, 0x06, 0x10, 0x85, 0x81, 0xbc, 0x44, 0x61, 0x4a,
+	0x8b, 0x81, 0xc2, 0xb0, 0x87, 0x44, 0x61, 0xb8, 0x34, 0xa2, 0x30, 0xf0, 0x8d, 0x28, 0x8c, 0x19, 0x4f, 0x14, 0x86, 0x6f, 0x22, 0x0a, 0xc3, 0x34,
+	0x12, 0x85, 0x31, 0x5c, 0x88, 0xc2, 0x20, 0x70, 0xa2, 0x30, 0x18, 0x88, 0x28, 0xcc, 0xa5, 0x26, 0xa0, 0x30, 0xa6, 0x2e, 0x51, 0x18, 0x34, 0x49,
+	0x14, 0x86, 0x3f, 0x27, 0x0a, 0x63, 0xc8, 0x12, 0x85, 0x61, 0x46, 0x89, 0xc2, 0x20, 0x23, 0xa2, 0x30, 0x62, 0x03, 0xa2, 0x30, 0xcc, 0x07, 0x51,
+	0x18, 0x2e, 0x8d, 0x28, 0x0c, 0x2f, 0x4f, 0x14, 0x06, 0xe7, 0x12, 0x85, 0x49, 0xf6, 0x40, 0x61, 0x6e, 0x86, 0x01, 0x0a, 0xf3, 0x91, 0x09, 0x50,
+	0x18, 0x53, 0x8c, 0x28, 0x0c, 0x4a, 0x25, 0x0a, 0x73, 0x3f, 0x1e, 0x50, 0x18, 0xae, 0x9d, 0x28, 0x0c, 0x73, 0x47, 0x14, 0x06, 0x71, 0x11, 0x85,
+	0x11, 0x73, 0x10, 0x85, 0x31, 0xcd, 0x89, 0xc2, 0x14, 0xdc, 0x03, 0x85, 0x41, 0x0f, 0x44, 0x61, 0xf0, 0x33, 0x51, 0x18, 0x26, 0x97, 0x28, 0xcc,
+	0x47, 0x94, 0x40, 0x61, 0x38, 0x50, 0xa2, 0x30, 0x9f, 0x74, 0x03, 0x85, 0xb9, 0xd4, 0x0f, 0x14, 0x06, 0xc9, 0x11, 0x85, 0xe1, 0x0c, 0x88, 0xc2,
+	0x98, 0x20, 0x44, 0x61, 0xc4, 0x74, 0x44, 0x61, 0x52, 0x35, 0x50, 0x18, 0x86, 0x8d, 0x28, 0xcc, 0x75, 0x62, 0xa0, 0x30, 0xf8, 0x8e, 0x28, 0x4c,
+	0x79, 0x28, 0x50, 0x18, 0x93, 0x94, 0x28, 0x0c, 0xc7, 0x41, 0x14, 0x06, 0x6b, 0x13, 0x85, 0xb1, 0x4c, 0x49, 0x14, 0x46, 0xcc, 0x41, 0x14, 0xe6,
+	0x8e, 0x49, 0xa0, 0x30, 0x40, 0x82, 0x28, 0xcc, 0xa5, 0x31, 0xa0, 0x30, 0xe2, 0x3f, 0xa2, 0x30, 0x08, 0x9c, 0x28, 0x0c, 0xa7, 0x48, 0x14, 0x86,
+	0xa1, 0x20, 0x0a, 0x73, 0x07, 0x22, 0x50, 0x18, 0xd1, 0x10, 0x51, 0x98, 0xfa, 0x51, 0xa0, 0x30, 0xa0, 0x83, 0x28, 0xcc, 0x65, 0x13, 0xa0, 0x30,
+	0x22, 0x53, 0xa2, 0x30, 0x8c, 0x15, 0x51, 0x98, 0x8f, 0x96, 0x81, 0xc2, 0xdc, 0x22, 0x03, 0x14, 0x86, 0xa5, 0x26, 0x0a, 0x23, 0x38, 0x23, 0x0a,
+	0xd7, 0x41, 0x78, 0xec, 0x13, 0x85, 0x61, 0x75, 0x88, 0xc2, 0x08, 0x94, 0x89, 0xc2, 0x0c, 0x4a, 0x80, 0xc2, 0x5c, 0x48, 0x06, 0x0a, 0x83, 0x60,
+	0x88, 0xc2, 0x80, 0x66, 0xa2, 0x30, 0x25, 0x73, 0x40, 0x61, 0xd8, 0x38, 0xa2, 0x30, 0x05, 0x08, 0x40, 0x61, 0xea, 0x52, 0x81, 0xc2, 0x0c, 0xd6,
+	0x81, 0xc2, 0x08, 0xfa, 0x88, 0xc2, 0x00, 0x6c, 0xa2, 0x30, 0x99, 0x0d, 0x28, 0x4c, 0x25, 0x39, 0x50, 0x98, 0x92, 0x7b, 0xa0, 0x30, 0x82, 0x1d,
+	0xa2, 0x30, 0xf8, 0x83, 0x28, 0x4c, 0x4b, 0x0d, 0x14, 0x06, 0x8c, 0x13, 0x85, 0x11, 0x78, 0x12, 0x85, 0xe1, 0x4b, 0x89, 0xc2, 0x5c, 0xd0, 0x01,
+	0x0a, 0x73, 0x6d, 0x12, 0x1e, 0x1b, 0x8b, 0x00, 0x44, 0x61, 0x0a, 0xff, 0x80, 0xc2, 0x20, 0x18, 0xa2, 0x30, 0xc0, 0x92, 0x28, 0x0c, 0x67, 0x4b,
+	0x14, 0x46, 0xbc, 0x4a, 0x14, 0x46, 0xc4, 0x40, 0x14, 0x06, 0x24, 0x11, 0x85, 0xb9, 0x49, 0x0c, 0x28, 0x8c, 0xb5, 0x03, 0xa2, 0x30, 0xf5, 0x52,
+	0x40, 0x61, 0x38, 0x7c, 0xa2, 0x30, 0x20, 0x94, 0x28, 0xcc, 0x67, 0x8d, 0x40, 0x61, 0xee, 0xfe, 0x03, 0x0a, 0xc3, 0x79, 0x11, 0x85, 0x01, 0x54,
+	0x44, 0x61, 0xc4, 0x74, 0x44, 0x61, 0xac, 0x6a, 0x10, 0x85, 0xa9, 0x3c, 0x03, 0x0a, 0x23, 0x1a, 0x22, 0x0a, 0x03, 0x58, 0x89, 0xc2, 0x70, 0xe2,
+	0x44, 0x61, 0xac, 0x8b, 0x10, 0x85, 0x11, 0x99, 0x12, 0x85, 0x01, 0x5f, 0x44, 0x61, 0x38, 0x24, 0xa2, 0x30, 0x62, 0x24, 0xa2, 0x30, 0x56, 0x09,
+	0x88, 0xc2, 0x14, 0xb7, 0x01, 0x85, 0x01, 0xb7, 0x44, 0x61, 0xc6, 0xab, 0x40, 0x61, 0xac, 0xd8, 0x10, 0x85, 0xe1, 0x14, 0x89, 0xc2, 0x14, 0xf1,
+	0x00, 0x85, 0xc1, 0xe5, 0x44, 0x61, 0x10, 0x0c, 0x51, 0x98, 0x8b, 0x00, 0x40, 0x61, 0x04, 0x5c, 0x44, 0x61, 0x30, 0x26, 0x51, 0x18, 0xde, 0x98,
+	0x28, 0x8c, 0x05, 0x19, 0xa2, 0x30, 0x15, 0xbe, 0x40, 0x61, 0xf0, 0x12, 0x51, 0x18, 0x64, 0x4f, 0x14, 0x46, 0x70, 0x46, 0x14, 0xe6, 0x42, 0x04,
+	0x50, 0x18, 0xbe, 0x9f, 0x28, 0x4c, 0x4a, 0x05, 0x0a, 0x73, 0x33, 0x2d, 0x50, 0x18, 0x8b, 0x42, 0x44, 0x61, 0x2c, 0x86, 0x10, 0x85, 0x11, 0x78,
+	0x12, 0x85, 0x11, 0x1b, 0x10, 0x85, 0x29, 0xc9, 0x02, 0x0a, 0x63, 0x61, 0x8a, 0x28, 0x8c, 0x45, 0x00, 0xa2, 0x30, 0x38, 0x97, 0x28, 0x0c, 0x22,
+	0x20, 0x0a, 0x23, 0x48, 0x25, 0x0a, 0x63, 0x41, 0x86, 0x28, 0x0c, 0x66, 0x23, 0x0a, 0x23, 0xba, 0x20, 0x0a, 0x63, 0xc1, 0x80, 0x28, 0x8c, 0xc5,
+	0x31, 0xa2, 0x30, 0xf8, 0x83, 0x28, 0xcc, 0xf5, 0x3b, 0xa0, 0x30, 0xa2, 0x0b, 0xa2, 0x30, 0x9f, 0xa0, 0x03, 0x85, 0xb1, 0x54, 0x44, 0x14, 0x46,
+	0x58, 0x4e, 0x14, 0x46, 0xa4, 0x47, 0x14, 0x06, 0x13, 0x13, 0x85, 0xb1, 0xec, 0x41, 0x14, 0x46, 0x88, 0x49, 0x14, 0x06, 0xf5, 0x11, 0x85, 0x19,
+	0x9f, 0x00, 0x85, 0x19, 0xc2, 0x03, 0x85, 0x29, 0xe7, 0x03, 0x0a, 0x83, 0xc0, 0x89, 0xc2, 0x88, 0x15, 0x89, 0xc2, 0x08, 0x47, 0x89, 0xc2, 0x58,
+	0x7a, 0x21, 0x0a, 0x63, 0x19, 0x8c, 0x28, 0xcc, 0xa7, 0x56, 0x40, 0x61, 0x44, 0x2d, 0x44, 0x61, 0x6e, 0xda, 0x06, 0x0a, 0x63, 0x49, 0x87, 0x28,
+	0x8c, 0xf0, 0x99, 0x28, 0x8c, 0x08, 0x92, 0x28, 0x0c, 0xd6, 0x26, 0x0a, 0x63, 0x79, 0x82, 0x28, 0x8c, 0xa5, 0x38, 0xa2, 0x30, 0x68, 0x92, 0x28,
+	0x8c, 0xb8, 0x87, 0x28, 0x8c, 0x50, 0x9b, 0x28, 0xcc, 0x7d, 0x38, 0x40, 0x61, 0x90, 0x3d, 0x51, 0x18, 0x31, 0x28, 0x51, 0x18, 0x21, 0x1b, 0x51,
+	0x98, 0xdb, 0x5b, 0x81, 0xc2, 0x58, 0x69, 0x23, 0x0a, 0x63, 0xad, 0x83, 0x28, 0x8c, 0xf0, 0x99, 0x28, 0x8c, 0x90, 0x82, 0x28, 0xcc, 0x47, 0x8c,
+	0x40, 0x61, 0xc4, 0xed, 0x44, 0x61, 0xa0, 0x34, 0x51, 0x18, 0xe1, 0x1d, 0x51, 0x18, 0x2b, 0x20, 0x44, 0x61, 0xac, 0x01, 0x12, 0x85, 0x11, 0xd6,
+	0x10, 0x85, 0xf9, 0x0c, 0x12, 0x28, 0x8c, 0x68, 0x9e, 0x28, 0x8c, 0xf5, 0x2c, 0xa2, 0x30, 0x37, 0xff, 0x02, 0x85, 0xb1, 0xe6, 0x43, 0x14, 0x66,
+	0xd8, 0x08, 0x14, 0x06, 0x4a, 0x13, 0x85, 0xb1, 0x7a, 0x46, 0x14, 0xc6, 0xfa, 0x05, 0x51, 0x18, 0x21, 0x3c, 0x51, 0x18, 0x61, 0x0d, 0x51, 0x18,
+	0x2b, 0x41, 0x44, 0x61, 0xac, 0x85, 0x12, 0x85, 0x89, 0xf3, 0x40, 0x61, 0x84, 0x98, 0x44, 0x61, 0xac, 0x6a, 0x10, 0x85, 0xb1, 0xae, 0x47, 0x14,
+	0x66, 0x68, 0x05, 0x14, 0x46, 0xb8, 0x4f, 0x14, 0xb6, 0x20, 0x3c, 0xc2, 0x66, 0xb9, 0x11, 0x51, 0x18, 0xe3, 0x9f, 0x28, 0x8c, 0x19, 0x4f, 0x14,
+	0xe6, 0xe6, 0x28, 0xa0, 0x30, 0xf0, 0x8d, 0x28, 0x0c, 0xcc, 0x22, 0x0a, 0x03, 0x9d, 0x88, 0xc2, 0x40, 0x1c, 0xa2, 0x30, 0x4c, 0x18, 0x51, 0x18,
+	0xa6, 0x91, 0x28, 0x4c, 0xb1, 0x2f, 0x50, 0x98, 0x6f, 0x4b, 0x00, 0x0a, 0x83, 0x7e, 0x89, 0xc2, 0x60, 0x6d, 0xa2, 0x30, 0x69, 0x12, 0x28, 0x4c,
+	0x76, 0x05, 0x0a, 0x63, 0x10, 0x11, 0x85, 0x31, 0x38, 0x89, 0xc2, 0x18, 0xf4, 0x44, 0x61, 0x4c, 0x26, 0xa2, 0x30, 0x58, 0x85, 0x28, 0x0c, 0x32,
+	0x22, 0x0a, 0x53, 0x5e, 0x07, 0x14, 0x06, 0x95, 0x10, 0x85, 0xa9, 0xbf, 0x03, 0x0a, 0x53, 0xf9, 0x00, 0x14, 0xc6, 0xd8, 0x23, 0x0a, 0x63, 0xe4,
+	0x10, 0x85, 0xe1, 0xf0, 0x89, 0xc2, 0x70, 0xcc, 0x44, 0x61, 0x38, 0x50, 0xa2, 0x30, 0xd5, 0x5d, 0x40, 0x61, 0x8c, 0x53, 0xa2, 0x30, 0x1f, 0x80,
+	0x01, 0x85, 0x31, 0x46, 0x88, 0xc2, 0xe8, 0x61, 0xa2, 0x30, 0x1c, 0x33, 0x51, 0x18, 0x0e, 0x94, 0x28, 0x0c, 0x90, 0x20, 0x0a, 0xc3, 0xe1, 0x13,
+	0x85, 0x31, 0xf9, 0x89, 0xc2, 0x30, 0x2a, 0x44, 0x61, 0x4c, 0x26, 0xa2, 0x30, 0x27, 0x29, 0x50, 0x18, 0x0c, 0x44, 0x14, 0x06, 0x71, 0x11, 0x85,
+	0xc1, 0x77, 0x44, 0x61, 0x6e, 0x42, 0x05, 0x0a, 0x73, 0xc9, 0x0d, 0x28, 0x4c, 0x4d, 0x33, 0x50, 0x18, 0x6e, 0x8a, 0x28, 0x0c, 0xf7, 0x47, 0x14,
+	0x46, 0x14, 0x40, 0x14, 0x46, 0xcc, 0x41, 0x14, 0x46, 0xd4, 0x42, 0x14, 0x46, 0x8c, 0x44, 0x14, 0x86, 0x67, 0x21, 0x0a, 0xc3, 0x2f, 0x10, 0x85,
+	0x61, 0xa9, 0x89, 0xc2, 0xb0, 0xb3, 0x44, 0x61, 0xee, 0x77, 0x04, 0x0a, 0x03, 0x8f, 0x89, 0xc2, 0x54, 0xc1, 0x02, 0x85, 0x81, 0xfe, 0x44, 0x61,
+	0xea, 0xce, 0x80, 0xc2, 0x08, 0x13, 0x88, 0xc2, 0x14, 0xf1, 0x00, 0x85, 0x81, 0xe8, 0x44, 0x61, 0x78, 0x00, 0xa2, 0x30, 0xc5, 0xb3, 0x40, 0x61,
+	0x78, 0x2c, 0xa2, 0x30, 0xfd, 0x23, 0x50, 0x18, 0x51, 0x21, 0x51, 0x98, 0xbb, 0xee, 0x81, 0xc2, 0x54, 0x6c, 0x01, 0x85, 0x11, 0x23, 0x11, 0x85,
+	0xe1, 0xda, 0x89, 0xc2, 0x70, 0xc1, 0x44, 0x61, 0x60, 0x0b, 0x51, 0x18, 0x78, 0x41, 0x14, 0x06, 0x6b, 0x13, 0x85, 0x41, 0xca, 0x44, 0x61, 0x70,
+	0x2e, 0x51, 0x18, 0x94, 0x4a, 0x14, 0x86, 0xd1, 0x26, 0x0a, 0xd3, 0xb8, 0x02, 0x85, 0x29, 0x61, 0x07, 0x0a, 0xc3, 0x19, 0x10, 0x85, 0x01, 0x96,
+	0x44, 0x61, 0x00, 0x2b, 0x51, 0x98, 0xaa, 0x5d, 0xa0, 0x30, 0x00, 0x90, 0x28, 0x0c, 0x3b, 0x40, 0x14, 0xe6, 0xf3, 0x43, 0xa0, 0x30, 0x6c, 0x1c,
+	0x51, 0x18, 0x16, 0x95, 0x28, 0x0c, 0x00, 0x24, 0x0a, 0x03, 0x2c, 0x89, 0xc2, 0x00, 0x56, 0xa2, 0xf0, 0x16, 0x08, 0x87, 0x44, 0x61, 0x58, 0x5f,
+	0xa2, 0x30, 0xf7, 0x6d, 0x00, 0x85, 0xf9, 0xdc, 0x00, 0x28, 0x4c, 0xcd, 0x00, 0x50, 0x18, 0x04, 0x4e, 0x14, 0x46, 0x7c, 0x42, 0x14, 0xe6, 0xc6,
+	0x2f, 0xa0, 0x30, 0xb7, 0xfc, 0x01, 0x85, 0xe1, 0x14, 0x89, 0xc2, 0x70, 0x5e, 0x44, 0x61, 0x2e, 0xae, 0x01, 0x85, 0xb9, 0xd3, 0x15, 0x28, 0xcc,
+	0xd8, 0x16, 0x28, 0xcc, 0xc5, 0x77, 0xa0, 0x30, 0x9f, 0x53, 0x03, 0x85, 0x89, 0x90, 0x40, 0x61, 0xa0, 0x1e, 0x51, 0x18, 0xf8, 0x46, 0x14, 0xe6,
+	0x83, 0x31, 0xa0, 0x30, 0xc3, 0x30, 0xa0, 0x30, 0xc2, 0x3b, 0xa2, 0x30, 0x77, 0x23, 0x01, 0x85, 0x29, 0x4b, 0x00, 0x0a, 0xf3, 0xe9, 0x1f, 0x3c,
+	0x36, 0x38, 0x8c, 0x28, 0x0c, 0xd2, 0x20, 0x0a, 0x73, 0xcf, 0x30, 0x50, 0x98, 0xd1, 0x26, 0x50, 0x18, 0xb1, 0x22, 0x51, 0x18, 0xd1, 0x31, 0x51,
+	0x18, 0xb1, 0x2d, 0x51, 0x18, 0x48, 0x46, 0x14, 0x06, 0x3a, 0x11, 0x85, 0x89, 0x43, 0x40, 0x61, 0xbe, 0x6b, 0x06, 0x28, 0x4c, 0xdd, 0x3a, 0x50,
+	0x18, 0xe1, 0x3e, 0x51, 0x18, 0x4b, 0x0e, 0x44, 0x61, 0x2c, 0x65, 0x10, 0x85, 0x49, 0xca, 0x40, 0x61, 0x70, 0x39, 0x51, 0x98, 0xe4, 0x09, 0x14,
+	0x06, 0xe7, 0x12, 0x85, 0x11, 0x70, 0x11, 0x85, 0x11, 0xc8, 0x11, 0x85, 0xf9, 0x86, 0x09, 0xa0, 0x30, 0x02, 0x4f, 0xa2, 0x30, 0xf8, 0x83, 0x28,
+	0x0c, 0xda, 0x21, 0x0a, 0xc3, 0xf7, 0x13, 0x85, 0x41, 0x1a, 0x44, 0x61, 0xc4, 0x1c, 0x44, 0x61, 0x44, 0x0c, 0x44, 0x61, 0xc4, 0x53, 0x44, 0x61,
+	0x44, 0x43, 0x44, 0x61, 0xae, 0xe7, 0x02, 0x85, 0xe1, 0xc4, 0x89, 0xc2, 0x70, 0xb6, 0x44, 0x61, 0xee, 0x88, 0x02, 0x0a, 0x23, 0xf6, 0x22, 0x0a,
+	0x23, 0x72, 0x22, 0x0a, 0xf3, 0x21, 0x0f, 0x50, 0x18, 0x51, 0x0b, 0x51, 0x98, 0x4e, 0x1c, 0x28, 0x0c, 0x67, 0x4b, 0x14, 0x06, 0x74, 0x10, 0x85,
+	0x01, 0x07, 0x44, 0x61, 0x04, 0xca, 0x44, 0x61, 0x04, 0xe0, 0x44, 0x61, 0x04, 0x9e, 0x44, 0x61, 0xae, 0x16, 0x02, 0x85, 0xc1, 0x35, 0x44, 0x61,
+	0xae, 0xc3, 0x03, 0x85, 0xb9, 0xcf, 0x1a, 0x28, 0x0c, 0x42, 0x24, 0x0a, 0x63, 0xf9, 0x87, 0x28, 0x8c, 0x65, 0x25, 0xa2, 0x30, 0x96, 0x5e, 0x88,
+	0xc2, 0x58, 0xd2, 0x21, 0x0a, 0x23, 0x62, 0x20, 0x0a, 0x23, 0x3e, 0x21, 0x0a, 0x23, 0xc2, 0x21, 0x0a, 0x23, 0x9e, 0x22, 0x0a, 0x63, 0x15, 0x86,
+	0x28, 0x8c, 0x35, 0x14, 0xa2, 0x30, 0x56, 0x35, 0x88, 0xc2, 0x58, 0x93, 0x20, 0x0a, 0x53, 0x37, 0x06, 0x14, 0xe6, 0xfb, 0x42, 0x80, 0xc2, 0x08,
+	0x13, 0x88, 0xc2, 0xd4, 0x2d, 0x00, 0x85, 0x81, 0xfe, 0x44, 0x61, 0x84, 0x14, 0x44, 0x61, 0x60, 0x37, 0x51, 0x18, 0x38, 0x4f, 0x14, 0xc6, 0xaa,
+	0x06, 0x51, 0x18, 0x6b, 0x28, 0x44, 0x61, 0xac, 0xc2, 0x10, 0x85, 0xb9, 0xe6, 0x03, 0x14, 0x46, 0xa4, 0x47, 0x14, 0xe6, 0x22, 0x23, 0x50, 0x98,
+	0x4b, 0x79, 0x40, 0x61, 0xc4, 0x3d, 0x44, 0x61, 0x2e, 0x83, 0x01, 0x85, 0xb1, 0x5c, 0x45, 0x14, 0xc6, 0x42, 0x3d, 0x51, 0x18, 0x4b, 0x71, 0x44,
+	0x61, 0x70, 0x39, 0x51, 0x18, 0x54, 0x4d, 0x14, 0x06, 0x13, 0x13, 0x85, 0x41, 0xb4, 0x44, 0x61, 0x2c, 0x44, 0x10, 0x85, 0xb1, 0x60, 0x40, 0x14,
+	0xc6, 0xc2, 0x09, 0x51, 0x18, 0x0b, 0x1c, 0x44, 0x61, 0xc0, 0x22, 0x51, 0x98, 0x1a, 0x61, 0xa0, 0x30, 0xa5, 0x1c, 0x40, 0x61, 0x40, 0x1d, 0x51,
+	0x18, 0x31, 0x33, 0x51, 0x18, 0x11, 0x3a, 0x51, 0x18, 0xeb, 0x01, 0x44, 0x61, 0xac, 0x3e, 0x10, 0x85, 0x01, 0x75, 0x44, 0x61, 0xc0, 0x22, 0x51,
+	0x18, 0x10, 0x4a, 0x14, 0x06, 0xdc, 0x12, 0x85, 0xb1, 0x76, 0x40, 0x14, 0xc6, 0x4a, 0x05, 0x51, 0x98, 0x72, 0x49, 0xa0, 0x30, 0x56, 0x09, 0x88,
+	0xc2, 0xe0, 0x7d, 0xa2, 0x30, 0x68, 0x9d, 0x28, 0xcc, 0x1d, 0xe0, 0x40, 0x61, 0x44, 0x22, 0x44, 0x61, 0xbe, 0xc5, 0x09, 0x28, 0xcc, 0xb7, 0x46,
+	0x00, 0x85, 0xb1, 0x20, 0x43, 0x14, 0xc6, 0xc2, 0x09, 0x51, 0x18, 0x11, 0x2f, 0x51, 0x18, 0xf1, 0x2a, 0x51, 0x98, 0xcf, 0x57, 0x81, 0xc2, 0x88,
+	0xaf, 0x89, 0xc2, 0x58, 0x6e, 0x25, 0x0a, 0x63, 0x59, 0x94, 0x28, 0xcc, 0xad, 0x79, 0x40, 0x61, 0x2c, 0x49, 0x12, 0x85, 0x11, 0xb2, 0x11, 0x85,
+	0xf9, 0x56, 0x2f, 0xa0, 0x30, 0x97, 0xef, 0x81, 0xc2, 0x08, 0x73, 0x89, 0xc2, 0x58, 0xed, 0x23, 0x0a, 0x63, 0x6d, 0x91, 0x28, 0xcc, 0x87, 0x68,
+	0x40, 0x61, 0xac, 0xd5, 0x11, 0x85, 0x2d, 0x08, 0x8f, 0x0d, 0x08, 0x53, 0x18, 0x31, 0xe4, 0x3b, 0xfc, 0x88, 0xc2, 0xb0, 0xea, 0x44, 0x61, 0xb4,
+	0x2e, 0x51, 0x18, 0x5c, 0x43, 0x14, 0x86, 0x1d, 0x20, 0x0a, 0x13, 0x79, 0x81, 0xc2, 0x30, 0x6c, 0x44, 0x61, 0x5a, 0x3e, 0xa0, 0x30, 0xe8, 0x97,
+	0x28, 0x0c, 0x43, 0x41, 0x14, 0x06, 0x3a, 0x11, 0x85, 0xd1, 0x55, 0x44, 0x61, 0xee, 0x4c, 0x07, 0x0a, 0x63, 0x3c, 0x11, 0x85, 0xb9, 0xf1, 0x00,
+	0x28, 0x8c, 0xbe, 0x24, 0x0a, 0xc3, 0x37, 0x11, 0x85, 0x39, 0x0c, 0x81, 0xc2, 0x80, 0x19, 0xa2, 0x30, 0xb7, 0x2b, 0x01, 0x85, 0x81, 0xdd, 0x44,
+	0x61, 0x58, 0x28, 0xa2, 0x30, 0x48, 0x8e, 0x28, 0x4c, 0x7c, 0x03, 0x0a, 0x53, 0x3a, 0x08, 0x14, 0x06, 0xc3, 0x13, 0x85, 0x29, 0x1a, 0x05, 0x0a,
+	0x83, 0xa2, 0x88, 0xc2, 0x18, 0xe9, 0x44, 0x61, 0x38, 0x45, 0xa2, 0x30, 0x25, 0xcb, 0x40, 0x61, 0x50, 0x1f, 0x51, 0x18, 0x16, 0x95, 0x28, 0x8c,
+	0xe0, 0x81, 0x28, 0x0c, 0xb3, 0x4f, 0x14, 0x06, 0x66, 0x11, 0x85, 0x31, 0xf1, 0x88, 0xc2, 0xf4, 0xd1, 0x40, 0x61, 0x8c, 0x53, 0xa2, 0x30, 0x06,
+	0x32, 0x51, 0x18, 0xee, 0x9a, 0x28, 0x8c, 0x99, 0x49, 0x14, 0xe6, 0xfa, 0x3e, 0x50, 0x18, 0x3e, 0x84, 0x28, 0x8c, 0x58, 0x86, 0x28, 0x0c, 0xb3,
+	0x4f, 0x14, 0x66, 0xb0, 0x0f, 0x14, 0xe6, 0x03, 0x04, 0xa0, 0x30, 0x83, 0x1d, 0xa0, 0x30, 0x5f, 0x91, 0x07, 0x14, 0x06, 0xbb, 0x12, 0x85, 0x31,
+	0x83, 0x88, 0xc2, 0xa0, 0x07, 0xa2, 0x30, 0xdf, 0x6a, 0x07, 0x14, 0x26, 0x42, 0x02, 0x85, 0xb9, 0x01, 0x0e, 0x28, 0xcc, 0x9d, 0x09, 0x40, 0x61,
+	0xa0, 0x08, 0x51, 0x18, 0x13, 0x8f, 0x28, 0x0c, 0x68, 0x26, 0x0a, 0xd3, 0xf5, 0x00, 0x85, 0x11, 0x65, 0x11, 0x85, 0xe1, 0x35, 0x89, 0xc2, 0x30,
+	0xcf, 0x44, 0x61, 0xbe, 0x57, 0x0c, 0x28, 0xcc, 0xdd, 0xd0, 0x40, 0x61, 0xc4, 0x27, 0x44, 0x61, 0x5a, 0x49, 0xa0, 0x30, 0xc8, 0x93, 0x28, 0x8c,
+	0x49, 0x4a, 0x14, 0xe6, 0xda, 0x03, 0x50, 0x18, 0x6c, 0x45, 0x14, 0xc6, 0xdc, 0x26, 0x0a, 0x03, 0x63, 0x89, 0xc2, 0x30, 0xae, 0x44, 0x61, 0x04,
+	0x46, 0x44, 0x61, 0x60, 0x0b, 0x51, 0x98, 0x5b, 0x14, 0x81, 0xc2, 0xf0, 0x2c, 0x44, 0x61, 0x44, 0x4e, 0x44, 0x61, 0xd0, 0x0e, 0x51, 0x18, 0x81,
+	0x11, 0x51, 0x18, 0xae, 0x87, 0x28, 0x0c, 0xd4, 0x23, 0x0a, 0x73, 0xef, 0x13, 0x50, 0x18, 0xfc, 0x4c, 0x14, 0x86, 0xad, 0x27, 0x0a, 0xc3, 0x19,
+	0x10, 0x85, 0x81, 0xd2, 0x44, 0x61, 0x6a, 0x63, 0x81, 0xc2, 0xa0, 0x49, 0xa2, 0x30, 0xfc, 0x18, 0x51, 0x98, 0xe2, 0x2d, 0xa0, 0x30, 0x90, 0x8c,
+	0x28, 0x8c, 0x40, 0x8e, 0x28, 0x0c, 0x3f, 0x46, 0x14, 0x06, 0x3f, 0x13, 0x85, 0x61, 0x6a, 0x88, 0xc2, 0x5b, 0x20, 0xec, 0x10, 0x85, 0x11, 0x5a,
+	0x11, 0x85, 0x41, 0x51, 0x44, 0x61, 0xaa, 0x0e, 0x80, 0xc2, 0x7c, 0x87, 0x02, 0x50, 0x18, 0xf0, 0x45, 0x14, 0xe6, 0xca, 0x38, 0x50, 0x98, 0xaf,
+	0xf8, 0x00, 0x0a, 0x83, 0xc0, 0x89, 0xc2, 0xb0, 0x66, 0x44, 0x61, 0x2e, 0x4e, 0x00, 0x85, 0x29, 0xa3, 0x00, 0x0a, 0x03, 0xdc, 0x89, 0xc2, 0x7c,
+	0x34, 0x01, 0x14, 0xa6, 0xd4, 0x00, 0x28, 0x4c, 0x71, 0x1c, 0x50, 0x98, 0x52, 0x7e, 0xa0, 0x30, 0x58, 0x90, 0x28, 0x8c, 0xb0, 0x91, 0x28, 0x4c,
+	0xb9, 0x03, 0x50, 0x18, 0x54, 0x42, 0x14, 0x46, 0x04, 0x49, 0x14, 0x06, 0x2c, 0x12, 0x85, 0x29, 0x40, 0x07, 0x0a, 0x53, 0xb7, 0x0e, 0x8f, 0xcd,
+	0x57, 0x60, 0x01, 0x85, 0x61, 0x93, 0x89, 0xc2, 0x88, 0x23, 0x88, 0xc2, 0x7c, 0xb4, 0x06, 0x14, 0x66, 0xdc, 0x0e, 0x14, 0x06, 0xe2, 0x10, 0x85,
+	0x11, 0xd0, 0x12, 0x85, 0xe1, 0x0c, 0x88, 0xc2, 0x08, 0x29, 0x88, 0xc2, 0x7c, 0x3d, 0x1d, 0x50, 0x18, 0xd1, 0x10, 0x51, 0x18, 0x21, 0x10, 0x51,
+	0x98, 0x1b, 0xf0, 0x81, 0xc2, 0x7c, 0xd7, 0x1d, 0x50, 0x18, 0x3e, 0x84, 0x28, 0xcc, 0x2d, 0xdb, 0x40, 0x61, 0x50, 0x14, 0x51, 0x18, 0x0b, 0x06,
+	0x44, 0x61, 0xa0, 0x34, 0x51, 0x98, 0x2f, 0xc6, 0x02, 0x0a, 0x03, 0xb3, 0x88, 0xc2, 0x7c, 0xce, 0x01, 0x14, 0x06, 0x81, 0x13, 0x85, 0x11, 0x7b,
+	0x11, 0x85, 0xc1, 0x40, 0x44, 0x61, 0x84, 0x4b, 0x44, 0x61, 0xbe, 0x2a, 0x10, 0x28, 0x0c, 0xef, 0x46, 0x14, 0x46, 0xe4, 0x44, 0x14, 0xe6, 0x8b,
+	0xfe, 0x80, 0xc2, 0x08, 0xef, 0x88, 0xc2, 0x7c, 0x56, 0x0e, 0x14, 0xc6, 0x02, 0x07, 0x51, 0x18, 0x2c, 0x48, 0x14, 0xe6, 0x6b, 0xa2, 0x80, 0xc2,
+	0xd4, 0xfd, 0x02, 0x85, 0xb9, 0x01, 0x1f, 0x28, 0x4c, 0xb6, 0x02, 0x0a, 0x23, 0xae, 0x24, 0x0a, 0x73, 0x61, 0x16, 0x28, 0x8c, 0x15, 0x10, 0xa2,
+	0x30, 0x60, 0x91, 0x28, 0x8c, 0xe5, 0x09, 0xa2, 0x30, 0xd6, 0x24, 0x88, 0xc2, 0x60, 0x4c, 0xa2, 0x30, 0x97, 0xbb, 0x80, 0xc2, 0x14, 0x1a, 0x02,
+	0x85, 0x11, 0xd0, 0x12, 0x85, 0xf9, 0x2c, 0x17, 0x28, 0x8c, 0x48, 0x8f, 0x28, 0x0c, 0x22, 0x20, 0x0a, 0x23, 0xe2, 0x25, 0x0a, 0x83, 0xfa, 0x88,
+	0xc2, 0x08, 0x10, 0x89, 0xc2, 0x40, 0x06, 0xa2, 0x30, 0x96, 0x48, 0x88, 0xc2, 0x80, 0x5b, 0xa2, 0x30, 0xd6, 0x71, 0x88, 0xc2, 0x88, 0x91, 0x88,
+	0xc2, 0x08, 0xa2, 0x88, 0xc2, 0x58, 0xd2, 0x21, 0x0a, 0x73, 0x37, 0x33, 0x50, 0x18, 0xab, 0x30, 0x44, 0x61, 0xf0, 0x07, 0x51, 0x18, 0xf1, 0x2a,
+	0x51, 0x18, 0x68, 0x4a, 0x14, 0xe6, 0xeb, 0x98, 0x80, 0xc2, 0x88, 0x36, 0x89, 0xc2, 0x20, 0x23, 0xa2, 0x30, 0x17, 0x01, 0x80, 0xc2, 0xc0, 0x4d,
+	0xa2, 0x30, 0x96, 0xd7, 0x88, 0xc2, 0x7c, 0x4f, 0x11, 0x50, 0x18, 0x6b, 0x1d, 0x44, 0x61, 0x3e, 0x97, 0x01, 0x0a, 0x23, 0x80, 0x21, 0x0a, 0x53,
+	0x38, 0x02, 0x14, 0xa6, 0xb2, 0x04, 0x28, 0xcc, 0x77, 0xe8, 0x01, 0x85, 0xb9, 0x1a, 0x0b, 0x14, 0xc6, 0x9a, 0x04, 0x51, 0x18, 0xf8, 0x46, 0x14,
+	0x46, 0xf0, 0x4b, 0x14, 0xe6, 0x2e, 0x5e, 0xa0, 0x30, 0x16, 0x2d, 0x88, 0xc2, 0x7c, 0x90, 0x07, 0x14, 0x46, 0xcc, 0x4c, 0x14, 0x46, 0xe4, 0x44,
+	0x14, 0xc6, 0x2a, 0x0c, 0x51, 0x98, 0xef, 0xde, 0x02, 0x0a, 0x73, 0xe9, 0x10, 0x28, 0xcc, 0x5d, 0x9b, 0x40, 0x61, 0xc4, 0x69, 0x44, 0x61, 0x2c,
+	0xe9, 0x10, 0x85, 0x11, 0x70, 0x11, 0x85, 0x11, 0xac, 0x13, 0x85, 0xa9, 0x66, 0x07, 0x0a, 0x73, 0xb5, 0x04, 0x28, 0x0c, 0x5a, 0x27, 0x0a, 0xf3,
+	0xed, 0x01, 0x40, 0x61, 0x84, 0x98, 0x44, 0x61, 0xee, 0x9b, 0x03, 0x0a, 0x73, 0x5f, 0x2d, 0x50, 0x18, 0xf1, 0x35, 0x51, 0x18, 0xfc, 0x4c, 0x14,
+	0xe6, 0xcb, 0xaa, 0x80, 0xc2, 0x00, 0x6c, 0xa2, 0x30, 0xb7, 0x29, 0x00, 0x85, 0xf9, 0xf2, 0x3e, 0xa0, 0x30, 0x00, 0x9b, 0x28, 0x8c, 0x10, 0x9e,
+	0x28, 0x8c, 0x90, 0x8d, 0x28, 0xcc, 0xe7, 0x53, 0x40, 0x61, 0xc4, 0xc1, 0x44, 0x61, 0xac, 0x59, 0x12, 0x85, 0x19, 0xd3, 0x01, 0x85, 0xb1, 0xa6,
+	0x46, 0x14, 0xa6, 0x76, 0x0d, 0x28, 0x8c, 0x45, 0x4d, 0xa2, 0x30, 0x02, 0x02, 0xa2, 0x30, 0x96, 0xab, 0x88, 0xc2, 0xdc, 0x0f, 0x0d, 0x14, 0xc6,
+	0x8a, 0x02, 0x51, 0x18, 0xcb, 0x08, 0x44, 0x61, 0xae, 0x1e, 0x03, 0x85, 0x29, 0x79, 0x03, 0x0a, 0x23, 0x8e, 0x20, 0x0a, 0x63, 0x35, 0x95, 0x28,
+	0x8c, 0x08, 0x9d, 0x28, 0x4c, 0x5d, 0x1e, 0x50, 0x98, 0xaf, 0x41, 0x04, 0x0a, 0x13, 0x84, 0x7f, 0xc4, 0x7b, 0x84, 0xb5, 0xc4, 0xaf, 0x92, 0xb6,
+	0x29, 0x71, 0x9c, 0xd2, 0xbe, 0x29, 0xa5, 0x87, 0x52, 0xf0, 0x29, 0x81, 0x9e, 0x52, 0xfe, 0x28, 0xad, 0xa9, 0xd2, 0x1e, 0x2b, 0x91, 0xa0, 0xd2,
+	0xb0, 0x2a, 0xf5, 0x86, 0x52, 0xdd, 0x28, 0x91, 0x95, 0x92, 0xed, 0x29, 0x95, 0x90, 0x12, 0xd2, 0x29, 0x19, 0x91, 0x52, 0xe5, 0x29, 0x05, 0x89,
+	0xd2, 0x4d, 0x2a, 0x21, 0xa8, 0x12, 0xb4, 0x28, 0xf1, 0x96, 0x92, 0x06, 0x29, 0x2d, 0x99, 0xd2, 0x71, 0x69, 0x8d, 0x5a, 0x25, 0x2b, 0x53, 0x3a,
+	0x44, 0x25, 0x9c, 0x52, 0x32, 0x2d, 0xa5, 0x57, 0x51, 0x42, 0x3a, 0x25, 0x01, 0x56, 0xea, 0x5a, 0xa5, 0x82, 0x55, 0x42, 0x19, 0x25, 0x86, 0x52,
+	0xfa, 0x5c, 0xa5, 0x67, 0x53, 0xd2, 0x20, 0xa5, 0xd0, 0x51, 0x62, 0x49, 0x25, 0x65, 0x52, 0x12, 0x60, 0xa5, 0xa0, 0x56, 0x3a, 0x70, 0xa5, 0xd8,
+	0x52, 0x42, 0x66, 0xa5, 0xf9, 0x52, 0xba, 0x6a, 0x25, 0xfc, 0x53, 0xf2, 0x71, 0x2d, 0xf1, 0xab, 0xe4, 0xe3, 0x5a, 0xd0, 0x5d, 0x29, 0x24, 0x95,
+	0xec, 0x49, 0xc9, 0x93, 0xb4, 0x2a, 0xba, 0xd2, 0xc9, 0x29, 0x45, 0xa7, 0x12, 0xa0, 0x2b, 0x35, 0xa5, 0x56, 0x45, 0xb7, 0xca, 0xbc, 0x95, 0xc0,
+	0x54, 0xe9, 0x68, 0xb5, 0xa0, 0xb0, 0x52, 0xed, 0x2a, 0xf5, 0xb2, 0xd2, 0x87, 0x29, 0xad, 0x9e, 0x12, 0x69, 0x2b, 0xc5, 0x96, 0x12, 0x5e, 0x2b,
+	0x71, 0xa7, 0x92, 0x00, 0x2b, 0x8d, 0x9a, 0x52, 0xea, 0x2b, 0x15, 0x96, 0xd2, 0x97, 0x2b, 0xd9, 0x93, 0x96, 0x0e, 0x56, 0xba, 0x5f, 0xad, 0xae,
+	0xad, 0xd4, 0x73, 0x4a, 0xd7, 0xa7, 0x94, 0xd9, 0x4a, 0xe9, 0xac, 0xe4, 0xcd, 0x4a, 0x65, 0xdc, 0xae, 0xa9, 0x53, 0x4a, 0x30, 0xa5, 0x85, 0x54,
+	0xda, 0x2c, 0x25, 0xc7, 0xd6, 0x5a, 0xe9, 0x4a, 0x54, 0xae, 0x94, 0xad, 0x4a, 0xa4, 0xad, 0x34, 0x5f, 0x6a, 0x6f, 0x82, 0xd2, 0xd1, 0x2a, 0x5d,
+	0xb5, 0x96, 0x8f, 0x57, 0x42, 0x50, 0x25, 0xd8, 0x54, 0xc2, 0x6b, 0xa5, 0xfe, 0x54, 0x4a, 0x72, 0xa5, 0x77, 0x55, 0xca, 0x56, 0xa5, 0x35, 0x55,
+	0x6a, 0x76, 0xa5, 0x5c, 0x53, 0xba, 0x49, 0x25, 0xc2, 0xd4, 0x1a, 0xc0, 0x6a, 0x07, 0x80, 0xda, 0xc7, 0x50, 0xa8, 0xd1, 0xea, 0xe2, 0x38, 0x25,
+	0x49, 0x54, 0xa2, 0x46, 0xb5, 0x55, 0x42, 0x6d, 0x74, 0x50, 0x02, 0x3d, 0x25, 0xdd, 0x56, 0xea, 0x5a, 0xa5, 0x7c, 0x57, 0x7b, 0x1e, 0x94, 0x1e,
+	0x53, 0x2b, 0x5b, 0x2b, 0x9d, 0xb2, 0x56, 0xdf, 0x57, 0xda, 0x6e, 0xa5, 0x19, 0x57, 0x5b, 0x25, 0x94, 0xae, 0x5a, 0x69, 0xc6, 0x95, 0xa6, 0x59,
+	0x89, 0xe0, 0xb5, 0x00, 0xb2, 0xda, 0x09, 0xa1, 0x36, 0x2f, 0x28, 0x95, 0xb1, 0x12, 0x32, 0x2b, 0xa5, 0xbe, 0x12, 0x1f, 0x2a, 0x65, 0xab, 0xda,
+	0xf0, 0xa1, 0xd4, 0x94, 0x4a, 0xd8, 0xae, 0x36, 0x9d, 0x28, 0x3d, 0xa6, 0xd2, 0x58, 0xaa, 0x8d, 0x0e, 0x6a, 0x6f, 0x82, 0xda, 0xb6, 0xa2, 0x36,
+	0x03, 0xa8, 0x8d, 0x2f, 0x6a, 0xe7, 0x86, 0x12, 0xd7, 0x2b, 0x15, 0xac, 0x52, 0x95, 0x2a, 0x35, 0xb0, 0x92, 0xd1, 0x2b, 0x31, 0xb5, 0xd2, 0x4a,
+	0x2b, 0x45, 0xa7, 0x52, 0x9d, 0x2b, 0x19, 0xa7, 0x92, 0xc9, 0xaa, 0xcd, 0x16, 0x4a, 0x25, 0xaf, 0x04, 0xdd, 0x4a, 0xc3, 0xaa, 0xf6, 0x26, 0x28,
+	0xf5, 0xb2, 0xd2, 0xd9, 0xab, 0x4d, 0x06, 0x4a, 0xa5, 0xa9, 0xe4, 0xa1, 0x4a, 0xe0, 0xaf, 0x44, 0xf0, 0x4a, 0xd3, 0xac, 0x36, 0x00, 0x29, 0x95,
+	0xb1, 0x92, 0xd1, 0xab, 0x2d, 0x2e, 0x6a, 0x2b, 0x8a, 0xda, 0x5b, 0xa3, 0x84, 0xd7, 0x4a, 0xe9, 0xac, 0xe4, 0xc2, 0x4a, 0xc3, 0xaa, 0x74, 0xb4,
+	0x4a, 0xd5, 0xaf, 0xf6, 0xe1, 0xa8, 0xed, 0x1a, 0x4a, 0xd3, 0xac, 0x44, 0xf0, 0x4a, 0x1a, 0xaf, 0xf6, 0x10, 0xa8, 0x4d, 0x27, 0x4a, 0x62, 0xad,
+	0xb6, 0x34, 0xa8, 0x7d, 0x22, 0x6a, 0xa7, 0x94, 0xd2, 0xb0, 0xaa, 0x6d, 0x4c, 0x6a, 0x03, 0x85, 0xda, 0x2f, 0xa3, 0x36, 0x71, 0x28, 0x65, 0xb6,
+	0x52, 0xf5, 0x2b, 0x5d, 0xb5, 0xda, 0x6e, 0xa4, 0xe4, 0xee, 0x4a, 0x18, 0xac, 0x64, 0xb2, 0x4a, 0x51, 0xaf, 0x76, 0x4a, 0xa9, 0xcd, 0x16, 0x4a,
+	0xa7, 0xac, 0xb4, 0xfe, 0x4a, 0xb4, 0xaf, 0x24, 0xf7, 0x6a, 0x73, 0x93, 0xda, 0x64, 0xa0, 0x94, 0xc3, 0x4a, 0x6d, 0xad, 0xf6, 0xaa, 0xa8, 0x5d,
+	0x4a, 0x4a, 0xd3, 0xac, 0xf6, 0x1b, 0x28, 0x4d, 0xbe, 0xda, 0xa6, 0xa0, 0x76, 0x81, 0x29, 0xa9, 0xb9, 0x12, 0x32, 0xab, 0xfd, 0x3d, 0x6a, 0x23,
+	0x89, 0xda, 0x00, 0xa4, 0xf6, 0x10, 0xa8, 0x2d, 0x4f, 0x6a, 0x1f, 0x99, 0xd2, 0xd9, 0xab, 0x6d, 0x36, 0x4a, 0x04, 0x5f, 0x6c, 0x13, 0xb3, 0x20,
+	0xec, 0x6d, 0x83, 0x70, 0x25, 0x6d, 0x53, 0xe2, 0x38, 0xa5, 0x7d, 0x53, 0x4a, 0x0f, 0xa5, 0xe0, 0x53, 0x02, 0x3d, 0xa5, 0xfc, 0x51, 0x5a, 0x53,
+	0xa5, 0x3d, 0x56, 0x22, 0x41, 0xa5, 0x61, 0x55, 0xea, 0x0d, 0xa5, 0xba, 0x51, 0x22, 0x2b, 0x25, 0xdb, 0x53, 0x2a, 0x21, 0x25, 0xa4, 0x53, 0x32,
+	0x22, 0xa5, 0xca, 0xd3, 0x0a, 0x92, 0x4a, 0x37, 0xa9, 0x84, 0xa0, 0x4a, 0xd0, 0xa2, 0xc4, 0x5b, 0x4a, 0x1a, 0xa4, 0xb4, 0x64, 0x4a, 0xc7, 0xa5,
+	0x34, 0x6a, 0x4a, 0x56, 0xa6, 0x74, 0x88, 0x4a, 0x38, 0xa5, 0x64, 0x5a, 0x4a, 0xaf, 0xa2, 0x84, 0x74, 0x4a, 0x02, 0xac, 0xd4, 0xb5, 0x4a, 0x05,
+	0xab, 0x84, 0x32, 0x4a, 0x0c, 0xa5, 0xf4, 0xb9, 0x4a, 0xcf, 0xa6, 0xa4, 0x41, 0x4a, 0xa1, 0xa3, 0xc4, 0x92, 0x4a, 0xca, 0xa4, 0x24, 0xc0, 0x4a,
+	0x41, 0xad, 0x74, 0xe0, 0x4a, 0xb1, 0xa5, 0x84, 0xcc, 0x4a, 0xf3, 0xa5, 0x74, 0xd5, 0x4a, 0xf8, 0xa7, 0xe4, 0xe3, 0x4a, 0xe2, 0xa7, 0xe4, 0xe3,
+	0x4a, 0xd0, 0xad, 0x14, 0x92, 0x4a, 0xf6, 0xa4, 0xe4, 0x49, 0x4a, 0x15, 0xad, 0x74, 0x72, 0x4a, 0xd1, 0xa9, 0x04, 0xe8, 0x4a, 0x4d, 0xa9, 0x54,
+	0xd1, 0xed, 0x32, 0x6f, 0x25, 0x30, 0x55, 0x3a, 0x5a, 0x25, 0x28, 0x54, 0xaa, 0x5d, 0xa5, 0x5e, 0x56, 0xfa, 0x30, 0xa5, 0xd5, 0x53, 0x22, 0x6d,
+	0xa5, 0xd8, 0x52, 0xc2, 0x6b, 0x25, 0xee, 0x54, 0x12, 0x60, 0xad, 0x51, 0x53, 0x4a, 0xfd, 0x4a, 0x85, 0xa5, 0xf4, 0xe5, 0x5a, 0xf6, 0x54, 0x49,
+	0x07, 0x95, 0xee, 0x57, 0xa9, 0x6b, 0x95, 0x7a, 0x4e, 0xe9, 0xfa, 0x94, 0x32, 0x5b, 0x29, 0x9d, 0x95, 0xbc, 0x59, 0xa9, 0x8c, 0xdb, 0x35, 0x75,
+	0x4a, 0x09, 0xa6, 0xb4, 0x90, 0x4a, 0x9b, 0xa5, 0xe4, 0xd8, 0x4a, 0x2b, 0xad, 0x44, 0xe5, 0x4a, 0xd9, 0xaa, 0x44, 0xda, 0x4a, 0xf3, 0xa5, 0xf6,
+	0x26, 0x28, 0x1d, 0xad, 0xd2, 0x55, 0x2b, 0xf9, 0xb8, 0x12, 0x82, 0x2a, 0xc1, 0xa6, 0x12, 0x5e, 0x2b, 0xf5, 0xa7, 0x52, 0x92, 0x2b, 0xbd, 0xab,
+	0x52, 0xb6, 0x2a, 0xad, 0xa9, 0x56, 0xb3, 0x57, 0xca, 0x35, 0xa5, 0x9b, 0xd4, 0x22, 0xcc, 0x4a, 0x03, 0xa8, 0x76, 0x00, 0xa8, 0x7d, 0x0c, 0x85,
+	0x1a, 0xad, 0x2e, 0x8e, 0x53, 0x92, 0x44, 0x25, 0x6a, 0x54, 0x5b, 0x25, 0xd4, 0x46, 0x07, 0x25, 0xd0, 0x53, 0xd2, 0x6d, 0xa5, 0xae, 0x55, 0xca,
+	0x77, 0xb5, 0xe7, 0x41, 0xe9, 0x31, 0x95, 0xb2, 0x55, 0xe9, 0x94, 0x95, 0xfa, 0x5e, 0x69, 0xbb, 0x95, 0x66, 0x5c, 0x6d, 0x95, 0xd0, 0xba, 0xea,
+	0x4a, 0x33, 0xae, 0x34, 0xcd, 0x4a, 0x04, 0xaf, 0x04, 0x90, 0x6a, 0x27, 0x84, 0xda, 0xbc, 0xa0, 0x54, 0xc6, 0x4a, 0xc8, 0xac, 0x94, 0xfa, 0x4a,
+	0x7c, 0xa8, 0x94, 0xad, 0x6a, 0xc3, 0x87, 0x52, 0x53, 0x2a, 0x61, 0xbb, 0xda, 0x74, 0xa2, 0xf4, 0x98, 0x4a, 0x63, 0xa9, 0x36, 0x3a, 0xa8, 0xbd,
+	0x09, 0x6a, 0xdb, 0x8a, 0xda, 0x0c, 0xa0, 0x36, 0xbe, 0xa8, 0x9d, 0x1b, 0x4a, 0x5c, 0xaf, 0x55, 0xb0, 0x95, 0xaa, 0x54, 0xa9, 0x81, 0x95, 0x8c,
+	0x5e, 0x89, 0xa9, 0xb5, 0x56, 0xba, 0x52, 0x74, 0x2a, 0xd5, 0xb9, 0x92, 0x71, 0x2a, 0x99, 0xac, 0xda, 0x6c, 0xa1, 0x54, 0xf2, 0x4a, 0xd0, 0xad,
+	0x34, 0xac, 0x6a, 0x6f, 0x82, 0x52, 0x2f, 0x2b, 0x9d, 0xbd, 0xda, 0x64, 0xa0, 0x54, 0x9a, 0x4a, 0x1e, 0xaa, 0x04, 0xfe, 0x4a, 0x04, 0xaf, 0x34,
+	0xcd, 0x6a, 0x03, 0x90, 0x52, 0x19, 0x2b, 0x19, 0xbd, 0xda, 0xe2, 0xa2, 0xb6, 0xa2, 0xa8, 0xbd, 0x35, 0x4a, 0x78, 0xad, 0x94, 0xce, 0x4a, 0x2e,
+	0xac, 0x34, 0xac, 0x4a, 0x47, 0xab, 0x54, 0xfd, 0x6a, 0x1f, 0x8e, 0xda, 0xae, 0xa1, 0x34, 0xcd, 0x4a, 0x04, 0xaf, 0xa4, 0xf1, 0x6a, 0x0f, 0x81,
+	0xda, 0x74, 0xa2, 0x24, 0xd6, 0x6a, 0x4b, 0x83, 0xda, 0x27, 0xa2, 0x76, 0x4a, 0x29, 0x0d, 0xab, 0xda, 0xc6, 0xa4, 0x36, 0x50, 0xa8, 0xfd, 0x32,
+	0x6a, 0x13, 0x87, 0x52, 0x66, 0x2b, 0x55, 0xbf, 0xd6, 0x55, 0x57, 0xdb, 0x8d, 0x94, 0xdc, 0x5d, 0x09, 0x83, 0x95, 0x4c, 0x56, 0x29, 0xea, 0xd5,
+	0x4e, 0x29, 0xb5, 0xd9, 0x42, 0xe9, 0x94, 0x95, 0xd6, 0x5f, 0x89, 0xf6, 0x95, 0xe4, 0x5e, 0x6d, 0x6e, 0x52, 0x9b, 0x0c, 0x94, 0x72, 0x58, 0xa9,
+	0xad, 0xd5, 0x5e, 0x15, 0xb5, 0x4b, 0x49, 0x69, 0x9a, 0xd5, 0x7e, 0x03, 0xa5, 0xc9, 0x57, 0xdb, 0x14, 0xd4, 0x2e, 0x30, 0x25, 0x35, 0x57, 0x42,
+	0x66, 0xb5, 0xbf, 0x47, 0x6d, 0x24, 0x51, 0x1b, 0x80, 0xd4, 0x1e, 0x02, 0xb5, 0xe5, 0x49, 0xed, 0x23, 0x53, 0x3a, 0x7b, 0xb5, 0xcd, 0x46, 0x89,
+	0xe0, 0x8b, 0x6d, 0x62, 0x16, 0x84, 0xfd, 0x6d, 0x10, 0xae, 0xa4, 0x6d, 0x4a, 0x1c, 0xa7, 0xb4, 0x6f, 0x4a, 0xe9, 0xa1, 0x14, 0x7c, 0x4a, 0xa0,
+	0xa7, 0x94, 0x3f, 0x4a, 0x6b, 0xaa, 0xb4, 0xc7, 0x4a, 0x24, 0xa8, 0x34, 0xac, 0x5a, 0xbd, 0x51, 0xa9, 0x6e, 0x94, 0xc8, 0x4a, 0xc9, 0xf6, 0xb4,
+	0x4a, 0xa8, 0x12, 0xd2, 0x29, 0x19, 0x91, 0x52, 0xe5, 0x29, 0x05, 0x89, 0xd2, 0x4d, 0x2a, 0x21, 0xa8, 0x12, 0xb4, 0x28, 0xf1, 0x96, 0x92, 0x06,
+	0x29, 0x2d, 0x99, 0xd6, 0x71, 0x55, 0x1a, 0x35, 0x25, 0x2b, 0xd3, 0x3a, 0xc4, 0x4a, 0x38, 0xa5, 0x64, 0x5a, 0x4a, 0xaf, 0xa2, 0x84, 0x74, 0x4a,
+	0x02, 0xac, 0xd4, 0xb5, 0x4a, 0x05, 0xab, 0x84, 0x32, 0x5a, 0x0c, 0x55, 0xe9, 0x73, 0x95, 0x9e, 0x4d, 0x49, 0x83, 0x94, 0x42, 0x47, 0x89, 0x25,
+	0x95, 0x94, 0x49, 0x49, 0x80, 0x95, 0x82, 0x5a, 0xe9, 0xc0, 0x95, 0x62, 0x4b, 0x09, 0x99, 0x95, 0xe6, 0x4b, 0xe9, 0xaa, 0x95, 0xf0, 0x4f, 0xc9,
+	0xc7, 0x95, 0xc4, 0x4f, 0xc9, 0xc7, 0x95, 0xa0, 0x5b, 0x29, 0x24, 0xb5, 0xec, 0xa9, 0x92, 0x27, 0x29, 0x55, 0xb4, 0xd2, 0xc9, 0x29, 0x45, 0xa7,
+	0x12, 0xa0, 0x2b, 0x35, 0xa5, 0x52, 0x45, 0xb7, 0xcb, 0xbc, 0x95, 0xc0, 0x54, 0xe9, 0x68, 0x95, 0xa0, 0x50, 0xa9, 0x76, 0x95, 0x7a, 0x59, 0xe9,
+	0xc3, 0x94, 0x56, 0x4f, 0x8b, 0xb4, 0x95, 0x62, 0xab, 0x12, 0x5e, 0x2b, 0x71, 0xa7, 0x92, 0x00, 0x2b, 0x8d, 0x9a, 0x52, 0xea, 0x2b, 0x15, 0x96,
+	0xd2, 0x97, 0x2b, 0xd9, 0x93, 0x92, 0x0e, 0x2a, 0xdd, 0xaf, 0x52, 0xd7, 0x2a, 0xf5, 0x9c, 0xd2, 0xf5, 0x29, 0x65, 0xb6, 0x56, 0x3a, 0x57, 0xf2,
+	0x66, 0xa5, 0x32, 0x6e, 0xd7, 0xd4, 0x29, 0x25, 0x98, 0xd2, 0x42, 0x2a, 0x6d, 0x96, 0x92, 0x63, 0x2b, 0xad, 0xb4, 0x12, 0x95, 0x2b, 0x65, 0xab,
+	0x12, 0x69, 0x2b, 0xcd, 0x97, 0xda, 0x9b, 0xa0, 0x74, 0xb4, 0x4a, 0x57, 0xad, 0xe4, 0xe3, 0x4a, 0x08, 0xaa, 0x04, 0x9b, 0x5a, 0x78, 0x5d, 0xa9,
+	0x3f, 0x95, 0x92, 0x5c, 0xe9, 0x5d, 0x95, 0xb2, 0x55, 0x6b, 0x4d, 0x2b, 0x35, 0xbb, 0x52, 0xae, 0x29, 0xdd, 0xa4, 0x12, 0x61, 0x2a, 0x0d, 0xa0,
+	0xda, 0x01, 0xa0, 0xf6, 0x31, 0x14, 0x6a, 0xb4, 0xba, 0x38, 0x4e, 0x49, 0x12, 0x95, 0xa8, 0x51, 0x6f, 0x95, 0xa8, 0x36, 0x3a, 0x28, 0x81, 0x9e,
+	0x92, 0x6e, 0x2b, 0x75, 0xad, 0x52, 0xbe, 0xab, 0x3d, 0x0f, 0x4a, 0x8f, 0xa9, 0x94, 0xad, 0x5a, 0xa7, 0x5c, 0xa9, 0xef, 0x95, 0xb6, 0x5b, 0x69,
+	0xc6, 0xd5, 0x56, 0x09, 0xa5, 0xab, 0xd6, 0x9a, 0xf1, 0x4a, 0xd3, 0xac, 0x44, 0xf0, 0x4a, 0x00, 0xa9, 0x76, 0x42, 0xa8, 0xcd, 0x0b, 0x4a, 0x65,
+	0xac, 0x84, 0xcc, 0x4a, 0xa9, 0xaf, 0xc4, 0x87, 0x4a, 0xd9, 0xaa, 0x36, 0x7c, 0x28, 0x35, 0xa5, 0x12, 0xb6, 0xab, 0x4d, 0x27, 0x4a, 0x8f, 0xa9,
+	0x34, 0x96, 0x6a, 0xa3, 0x83, 0xda, 0x9b, 0xa0, 0xb6, 0xad, 0xa8, 0xcd, 0x00, 0x6a, 0xe3, 0x8b, 0xda, 0xb9, 0xa1, 0xc4, 0xf5, 0x4a, 0x05, 0xab,
+	0x54, 0xa5, 0x4a, 0x0d, 0xac, 0x64, 0xf4, 0x5a, 0x4c, 0x5d, 0x69, 0xa5, 0x95, 0xa2, 0x53, 0xa9, 0xce, 0x95, 0x8c, 0x53, 0xc9, 0x64, 0xd5, 0x66,
+	0x0b, 0xa5, 0x92, 0x57, 0x82, 0x6e, 0xa5, 0x61, 0x55, 0x7b, 0x13, 0x94, 0x7a, 0x59, 0xe9, 0xec, 0xd5, 0x26, 0x03, 0xa5, 0xd2, 0x54, 0xf2, 0x50,
+	0x25, 0xf0, 0x57, 0x22, 0x78, 0xa5, 0x69, 0x56, 0x1b, 0x80, 0x94, 0xca, 0x58, 0xc9, 0xe8, 0xf5, 0x16, 0x97, 0x6a, 0x2b, 0x8a, 0xda, 0x5b, 0xa3,
+	0x84, 0xd7, 0x4a, 0xe9, 0xac, 0xe4, 0xc2, 0x4a, 0xc3, 0xaa, 0x74, 0xb4, 0x4a, 0xd5, 0xaf, 0xf6, 0xe1, 0xe8, 0xed, 0x1a, 0x95, 0xa6, 0x59, 0x89,
+	0xe0, 0x95, 0x34, 0x5e, 0xed, 0x21, 0x50, 0x9b, 0x4e, 0x94, 0xc4, 0x5a, 0x6d, 0x69, 0xd0, 0xfb, 0x44, 0xaa, 0x9d, 0x52, 0x4a, 0xc3, 0xaa, 0xb6,
+	0x31, 0xa9, 0x0d, 0x14, 0x6a, 0xbf, 0x8c, 0xda, 0xc4, 0xa1, 0x94, 0xd9, 0x4a, 0xd5, 0xaf, 0x74, 0xd5, 0x6a, 0xbb, 0x91, 0x92, 0xbb, 0x2b, 0x61,
+	0xb0, 0x92, 0xc9, 0x2a, 0x45, 0xbd, 0xda, 0x29, 0xa5, 0x36, 0x5b, 0x28, 0x9d, 0xb2, 0xd2, 0xfa, 0x2b, 0xd1, 0xbe, 0x92, 0xdc, 0xab, 0xcd, 0x4d,
+	0x6a, 0x93, 0x81, 0x52, 0x0e, 0x2b, 0xb5, 0xb5, 0xda, 0xab, 0xa2, 0x76, 0x29, 0x29, 0x4d, 0xb3, 0xda, 0x6f, 0xa0, 0x34, 0xf9, 0x6a, 0x9b, 0x82,
+	0xda, 0x05, 0xa6, 0xa4, 0xe6, 0x4a, 0xc8, 0xac, 0xf6, 0xf7, 0xa8, 0x8d, 0x24, 0x6a, 0x03, 0x90, 0xda, 0x43, 0xa0, 0xb7, 0x3c, 0x55, 0xfb, 0xc8,
+	0x94, 0xce, 0x5e, 0x6d, 0xb3, 0x51, 0x22, 0xf8, 0x62, 0x9b, 0x98, 0x05, 0xe1, 0x60, 0x1b, 0x84, 0x2b, 0x69, 0x9b, 0x12, 0xc7, 0x29, 0xed, 0x9b,
+	0x52, 0x7a, 0x28, 0x05, 0x9f, 0x12, 0xe8, 0x29, 0xe5, 0x8f, 0xd6, 0x9a, 0x56, 0xda, 0x63, 0x25, 0x12, 0xd4, 0x1a, 0xd6, 0x4a, 0xbd, 0xa1, 0x54,
+	0x37, 0x4a, 0x64, 0xa5, 0x64, 0x7b, 0x4a, 0x25, 0xa4, 0x84, 0x74, 0x4a, 0x46, 0xa4, 0x55, 0x79, 0x95, 0x82, 0x44, 0xe9, 0x26, 0x95, 0x10, 0x54,
+	0x09, 0x5a, 0x94, 0x78, 0x4b, 0x49, 0x83, 0x94, 0x96, 0x4c, 0xe9, 0xb8, 0xb4, 0x46, 0xad, 0x92, 0x95, 0x29, 0x1d, 0xa2, 0x12, 0x4e, 0x29, 0x99,
+	0x96, 0xd2, 0xab, 0x28, 0x21, 0x9d, 0x92, 0x00, 0x2b, 0x75, 0xad, 0x52, 0xc1, 0x2a, 0xa1, 0x8c, 0x12, 0x43, 0x29, 0x7d, 0xae, 0xd2, 0xb3, 0x29,
+	0x69, 0x90, 0x52, 0xe8, 0x28, 0xb1, 0xa4, 0x92, 0x32, 0x29, 0x09, 0xb0, 0x52, 0x50, 0x2b, 0x1d, 0xb8, 0x52, 0x6c, 0x29, 0x21, 0xb3, 0xd2, 0x7c,
+	0x29, 0x5d, 0xb5, 0x12, 0xfe, 0x29, 0xf9, 0xb8, 0x96, 0xf8, 0x55, 0xf2, 0x71, 0x2d, 0xe8, 0xae, 0x14, 0x92, 0x4a, 0xf6, 0xa4, 0xe4, 0x49, 0x5a,
+	0x15, 0x5d, 0xe9, 0xe4, 0xb4, 0xa2, 0xb3, 0x12, 0xa0, 0x2b, 0x35, 0xa5, 0x56, 0x45, 0xb7, 0xca, 0xbc, 0x95, 0xc0, 0x54, 0xe9, 0x68, 0xb5, 0xa0,
+	0xb0, 0x52, 0xed, 0x6a, 0xf5, 0x72, 0xa5, 0x0f, 0x53, 0x5a, 0x3d, 0x25, 0xd2, 0x56, 0x8a, 0x2d, 0x25, 0xbc, 0x56, 0xe2, 0x4e, 0x25, 0x01, 0x56,
+	0x1a, 0x35, 0xa5, 0xd4, 0x57, 0x2a, 0x2c, 0xa5, 0x2f, 0x57, 0xb2, 0x27, 0x2d, 0x1d, 0xac, 0x74, 0xbf, 0x4a, 0x5d, 0xab, 0xd4, 0x73, 0x4a, 0xd7,
+	0xa7, 0x94, 0xd9, 0x4a, 0xe9, 0xac, 0xe4, 0xcd, 0x4a, 0x65, 0xdc, 0xae, 0xa9, 0x53, 0x4a, 0x30, 0xa5, 0x85, 0x54, 0xda, 0x2c, 0x25, 0xc7, 0xd6,
+	0x5a, 0x69, 0x25, 0x2a, 0xaf, 0x94, 0xad, 0x4a, 0xa4, 0xad, 0x34, 0x5f, 0x6a, 0x6f, 0x82, 0xd2, 0xd1, 0x2a, 0x5d, 0xb5, 0x92, 0x8f, 0x2b, 0x21,
+	0xa8, 0x12, 0x6c, 0x2a, 0xe1, 0xb5, 0x52, 0x7f, 0x2a, 0x25, 0xb9, 0xd2, 0xbb, 0x2a, 0x65, 0xab, 0xd2, 0x9a, 0x2a, 0x35, 0xbb, 0x52, 0xae, 0x29,
+	0xdd, 0xa4, 0x12, 0x61, 0x2a, 0x0d, 0xa0, 0xda, 0x01, 0xa0, 0xf7, 0x31, 0x58, 0x35, 0x5a, 0x5d, 0x1c, 0xa7, 0x24, 0x89, 0x4a, 0xd4, 0xa8, 0xb6,
+	0x4a, 0xa8, 0x8d, 0x0e, 0x4a, 0xa0, 0xa7, 0xa4, 0xdb, 0x4a, 0x5d, 0xab, 0x94, 0xef, 0x6a, 0xcf, 0x83, 0xd2, 0x63, 0x2a, 0x65, 0xab, 0xd2, 0x29,
+	0x2b, 0xf5, 0xbd, 0xd2, 0x76, 0x2b, 0xcd, 0xb8, 0xda, 0x2a, 0xa1, 0x74, 0xd5, 0x4a, 0x33, 0xae, 0x34, 0xcd, 0x4a, 0x04, 0xaf, 0x04, 0x90, 0x6a,
+	0x27, 0x84, 0xda, 0xbc, 0xa0, 0x54, 0xc6, 0x4a, 0xc8, 0xac, 0x94, 0xfa, 0x4a, 0x7c, 0xa8, 0x94, 0xad, 0x6a, 0xc3, 0x87, 0x52, 0x53, 0x2a, 0x61,
+	0xbb, 0xda, 0x74, 0xa2, 0xf4, 0x98, 0x4a, 0x63, 0xa9, 0x36, 0x3a, 0xa8, 0xbd, 0x09, 0x6a, 0xdb, 0x8a, 0xda, 0x0c, 0xa0, 0x37, 0xbe, 0x54, 0x3b,
+	0x37, 0x94, 0xb8, 0x5e, 0xa9, 0x60, 0x95, 0xaa, 0x54, 0xa9, 0x81, 0x95, 0x8c, 0x5e, 0x89, 0xa9, 0x95, 0x56, 0x5a, 0x29, 0x3a, 0x95, 0xea, 0x5c,
+	0xc9, 0x38, 0x95, 0x4c, 0x56, 0x6d, 0xb6, 0x50, 0x2a, 0x79, 0x25, 0xe8, 0x56, 0x1a, 0x56, 0xb5, 0x37, 0x41, 0xa9, 0x97, 0x95, 0xce, 0x5e, 0x6d,
+	0x32, 0x50, 0x2a, 0x4d, 0x25, 0x0f, 0x55, 0x02, 0x7f, 0x25, 0x82, 0x57, 0x9a, 0x66, 0xb5, 0x01, 0x48, 0xa9, 0x8c, 0x95, 0x8c, 0x5e, 0x6d, 0x71,
+	0x51, 0x5b, 0x51, 0xd4, 0xde, 0x1a, 0x2d, 0xbc, 0xae, 0x94, 0xce, 0x4a, 0x2e, 0xac, 0x34, 0xac, 0x4a, 0x47, 0xab, 0x54, 0xfd, 0x6a, 0x1f, 0x8e,
+	0xda, 0xae, 0xa1, 0x34, 0xcd, 0x4a, 0x04, 0xaf, 0xa4, 0xf1, 0x6a, 0x0f, 0x81, 0xde, 0x74, 0x52, 0x49, 0xac, 0xd5, 0x96, 0x06, 0xb5, 0x4f, 0x44,
+	0xed, 0x94, 0x52, 0x1a, 0x56, 0xb5, 0x8d, 0x49, 0x6d, 0xa0, 0x50, 0xfb, 0x65, 0xd4, 0x26, 0x0e, 0xa5, 0xcc, 0x56, 0xaa, 0x7e, 0xa5, 0xab, 0x56,
+	0xdb, 0x8d, 0x94, 0xdc, 0x5d, 0x09, 0x83, 0x95, 0x4c, 0x56, 0x29, 0xea, 0xd5, 0x4e, 0x29, 0xb5, 0xd9, 0x42, 0xe9, 0x94, 0x95, 0xd6, 0x5f, 0x89,
+	0xf6, 0x95, 0xe4, 0x5e, 0x6d, 0x6e, 0x52, 0x9b, 0x0c, 0x94, 0x72, 0x58, 0xa9, 0xad, 0xd5, 0x5e, 0x15, 0xb5, 0x4b, 0x49, 0x69, 0x9a, 0xd5, 0x7e,
+	0x03, 0xa5, 0xc9, 0x57, 0xdb, 0x14, 0xd4, 0x2e, 0x30, 0x25, 0x35, 0x57, 0x42, 0x66, 0xb5, 0xbf, 0x47, 0x6d, 0x24, 0x51, 0x1b, 0x80, 0xd4, 0x1e,
+	0x02, 0xb5, 0xe5, 0x49, 0xed, 0x23, 0x53, 0x3a, 0x7b, 0xb5, 0xcd, 0x46, 0x89, 0xe0, 0x8b, 0x6d, 0x62, 0xc7, 0x87, 0xf9, 0xc5, 0x22, 0xd9, 0xcc,
+	0x96, 0x8b, 0x4e, 0xb2, 0x5c, 0xbc, 0xcd, 0x56, 0x9b, 0xd7, 0xcb, 0xa7, 0x8b, 0x8d, 0xef, 0xf5, 0xe2, 0x0f, 0x9b, 0x6c, 0xdd, 0xbf, 0x34, 0x9c,
+	0xbc, 0xca, 0xd6, 0x17, 0xf3, 0xcd, 0xf4, 0x48, 0x12, 0x2f, 0x57, 0x3d, 0x73, 0x64, 0x36, 0x75, 0x0e, 0x67, 0x0f, 0x90, 0x64, 0x7f, 0x9e, 0x2d,
+	0x4e, 0x36, 0xa7, 0x87, 0xb3, 0xbd, 0x69, 0xd0, 0xbf, 0x64, 0xd2, 0xfd, 0xf3, 0x8b, 0xf5, 0x69, 0x8f, 0x59, 0x1c, 0xcd, 0x8e, 0x1f, 0x3c, 0xf0,
+	0x82, 0xfe, 0xc7, 0xe2, 0xeb, 0x9e, 0x2b, 0x07, 0xdc, 0x50, 0x1d, 0xf0, 0xe4, 0xc0, 0xb8, 0xff, 0xb1, 0xf8, 0xea, 0x1f, 0xf7, 0x0f, 0xaf, 0xee,
+	0xac, 0xb2, 0xcd, 0xc5, 0x6a, 0x61, 0xef, 0x2d, 0xdf, 0xcd, 0x6d, 0xbf, 0x7a, 0xf2, 0x6a, 0x5a, 0x94, 0xb7, 0xf7, 0x26, 0xfb, 0xd0, 0xbf, 0x9c,
+	0xe5, 0xbd, 0xbb, 0xbd, 0xcd, 0xe9, 0x6c, 0xdd, 0x99, 0x2d, 0xd6, 0x9b, 0x68, 0x91, 0x64, 0xcb, 0xdc, 0x24, 0xeb, 0xf7, 0x2f, 0x37, 0xa7, 0xab,
+	0xe5, 0xbb, 0xce, 0x93, 0xd5, 0x4a, 0xca, 0xdc, 0x95, 0x43, 0x9d, 0xb3, 0x8b, 0xf5, 0xa6, 0x13, 0x67, 0x36, 0xe5, 0x6c, 0x13, 0x6d, 0xb2, 0xb4,
+	0xf3, 0x6e, 0xb6, 0x39, 0xed, 0xfc, 0x73, 0x91, 0xbd, 0xfb, 0x67, 0xd7, 0xdc, 0xf5, 0x45, 0xfc, 0x6b, 0x96, 0x6c, 0xf6, 0xd3, 0x2c, 0x9f, 0x2d,
+	0xb2, 0x97, 0xab, 0xe5, 0xb9, 0xb4, 0xc8, 0x07, 0xdc, 0x60, 0xd0, 0x95, 0x1b, 0x76, 0x07, 0xd2, 0x20, 0xf3, 0x8b, 0xec, 0x20, 0x59, 0x66, 0xab,
+	0x24, 0xfb, 0x6a, 0xb5, 0x8a, 0x3e, 0x98, 0x82, 0x0c, 0x36, 0xab, 0x8b, 0xac, 0x7f, 0xd5, 0x3f, 0x34, 0x29, 0xf7, 0x7f, 0x39, 0x5f, 0x65, 0xe7,
+	0xd1, 0x2a, 0xeb, 0x99, 0x1c, 0xe5, 0xce, 0xfb, 0xe7, 0xab, 0xe5, 0x66, 0xb9, 0xf9, 0x70, 0x9e, 0x95, 0xa7, 0xaa, 0x6a, 0xd8, 0x26, 0x5e, 0x5e,
+	0x2c, 0xd2, 0xf5, 0x74, 0x71, 0x71, 0x16, 0x67, 0xab, 0x17, 0xf9, 0x0f, 0xf8, 0x7a, 0x84, 0xdc, 0x24, 0x7b, 0xdb, 0xc6, 0xc7, 0x87, 0x52, 0x5d,
+	0x9b, 0x52, 0x92, 0xce, 0xe7, 0x45, 0x25, 0xa5, 0xf8, 0x45, 0x45, 0x67, 0x0b, 0x29, 0xe0, 0x2c, 0xed, 0xc8, 0x55, 0x9d, 0xf5, 0xec, 0x3f, 0xb2,
+	0x4e, 0xaf, 0xa8, 0xb6, 0xd8, 0xb8, 0x8e, 0x17, 0x74, 0x96, 0xab, 0x8e, 0xef, 0x75, 0xd8, 0xbb, 0xa8, 0x32, 0x8b, 0xfc, 0x5d, 0x66, 0xfa, 0xd7,
+	0x7e, 0x4e, 0x9b, 0x7d, 0x3d, 0xe5, 0x7d, 0xa5, 0x9b, 0xf7, 0xcc, 0x5d, 0x79, 0x09, 0xfb, 0xf9, 0x48, 0x26, 0xb7, 0xf9, 0xdf, 0x71, 0xbf, 0xbc,
+	0xbe, 0x71, 0x82, 0xfd, 0x87, 0x3c, 0xbe, 0xcb, 0x3e, 0x3c, 0x96, 0xbf, 0x9b, 0xa9, 0xad, 0xca, 0x9e, 0xdb, 0xff, 0x22, 0x40, 0x3c, 0xf6, 0xdd,
+	0xe3, 0xe9, 0x56, 0x8d, 0xbf, 0xe4, 0x89, 0xcd, 0x9b, 0xe9, 0xd6, 0xe8, 0x2c, 0xd2, 0xf5, 0x71, 0x7e, 0xb6, 0x48, 0xb3, 0xf7, 0x5b, 0x05, 0xfe,
+	0xee, 0x31, 0xcb, 0x8a, 0x73, 0xd3, 0xd9, 0xc3, 0x87, 0x5e, 0x51, 0xba, 0xec, 0x08, 0xc7, 0x8e, 0x8f, 0x66, 0x7f, 0x09, 0x8e, 0xa7, 0x9b, 0x37,
+	0x32, 0x42, 0xcb, 0x82, 0x1f, 0xb1, 0x4c, 0xf7, 0x9b, 0x29, 0x6c, 0x0d, 0xa4, 0x1c, 0xe7, 0xcb, 0xd9, 0x62, 0x93, 0xad, 0xe4, 0x2e, 0x28, 0xdb,
+	0xf4, 0xbb, 0xc7, 0x83, 0xcd, 0xe6, 0xf0, 0xdd, 0xe9, 0x6c, 0x9e, 0xf5, 0x36, 0x0f, 0x6a, 0x75, 0x94, 0xa6, 0xda, 0x98, 0xeb, 0xbf, 0x7b, 0x7c,
+	0xdf, 0x95, 0x9b, 0xbc, 0x39, 0x72, 0x8e, 0x7f, 0x9e, 0xf6, 0x7a, 0xaf, 0x8e, 0x7a, 0x9b, 0xcd, 0xc3, 0x87, 0x32, 0x09, 0xee, 0x39, 0xef, 0xbf,
+	0xf9, 0x86, 0x13, 0xe4, 0xe7, 0xe2, 0xf0, 0xb8, 0x3c, 0x2a, 0x09, 0xcc, 0xd1, 0xcd, 0xa6, 0x38, 0x30, 0xee, 0xff, 0x6c, 0x13, 0xc9, 0x05, 0x3c,
+	0xf8, 0x73, 0xcf, 0x94, 0xe9, 0x48, 0x15, 0x8c, 0xd9, 0xf5, 0x0f, 0xd5, 0xa1, 0xbd, 0xa9, 0x6b, 0xc6, 0xce, 0x77, 0x8f, 0xef, 0x4e, 0xc7, 0xfd,
+	0xcb, 0xaa, 0xa1, 0x5c, 0xd5, 0x50, 0xa8, 0xe6, 0xcf, 0xa8, 0xad, 0x29, 0xec, 0xd5, 0x55, 0x36, 0x5f, 0x67, 0x5b, 0x69, 0x25, 0x87, 0x2f, 0xbd,
+	0x7e, 0x7b, 0xfa, 0x3b, 0xac, 0x2a, 0x93, 0xd8, 0xea, 0x9a, 0xcf, 0xa6, 0xc6, 0x55, 0x1d, 0x5a, 0x6a, 0x39, 0xae, 0xaa, 0xae, 0x5a, 0xc4, 0xd6,
+	0xbd, 0x5e, 0x59, 0x5b, 0xb3, 0xaa, 0x50, 0xbc, 0xdb, 0xde, 0xb5, 0xf5, 0xb8, 0x63, 0x07, 0xc5, 0x60, 0x35, 0x48, 0x6c, 0x37, 0x99, 0xd4, 0xf7,
+	0xee, 0x35, 0x3a, 0x6b, 0x35, 0x35, 0x37, 0x3b, 0x4c, 0xa6, 0x9b, 0xbf, 0x04, 0xd5, 0x68, 0x59, 0x1d, 0x1f, 0x25, 0xbb, 0xc6, 0x49, 0x75, 0x6e,
+	0x6f, 0x4f, 0xce, 0xee, 0xed, 0x99, 0xfb, 0x15, 0xc5, 0x5b, 0x49, 0x9b, 0xad, 0x1e, 0xd8, 0x89, 0xb3, 0x32, 0x65, 0x2b, 0xce, 0x24, 0x32, 0x78,
+	0x92, 0x07, 0xc1, 0x61, 0x82, 0x02, 0x6f, 0xa6, 0x55, 0xb6, 0x26, 0xbf, 0xc3, 0xfa, 0xd7, 0x69, 0xef, 0x47, 0x77, 0xbb, 0xd3, 0x7f, 0xf4, 0xb6,
+	0x1a, 0xec, 0xe7, 0x1f, 0xfd, 0x7a, 0xbb, 0xfe, 0xfc, 0x63, 0x50, 0x36, 0xba, 0xcc, 0xbf, 0xab, 0x6d, 0x4b, 0x94, 0x2d, 0x92, 0xd5, 0x87, 0xf3,
+	0x4d, 0x65, 0x88, 0xce, 0xe7, 0x91, 0x19, 0x2b, 0xef, 0x37, 0xb0, 0xaa, 0xe5, 0x37, 0x3b, 0x13, 0xef, 0x4e, 0xe5, 0x56, 0xbb, 0xcd, 0x4d, 0x99,
+	0xbc, 0x61, 0x74, 0xb4, 0xa9, 0x51, 0x96, 0xae, 0x34, 0x21, 0xcc, 0xfe, 0xbe, 0x8b, 0xc9, 0x14, 0x4d, 0x4b, 0x9b, 0x61, 0x27, 0xd7, 0xd6, 0xbc,
+	0xaf, 0x0a, 0xb9, 0x35, 0xdd, 0x03, 0xdb, 0xf9, 0xec, 0xfb, 0xa2, 0xeb, 0x9c, 0x63, 0x4e, 0xdd, 0x9b, 0x7b, 0xa4, 0x96, 0x4b, 0x24, 0x57, 0x4d,
+	0x7b, 0xaf, 0x4d, 0xab, 0xcb, 0xa7, 0xa2, 0xdd, 0xf3, 0xfc, 0xf8, 0xe7, 0xd7, 0xa6, 0xdd, 0x8f, 0x7a, 0xe2, 0xc4, 0xfa, 0x62, 0x1a, 0x8a, 0xf6,
+	0xc7, 0x19, 0xdf, 0x9e, 0xf1, 0x78, 0x66, 0x5c, 0x9e, 0x90, 0x7e, 0x30, 0xc7, 0x7d, 0x73, 0xdc, 0x1e, 0xd3, 0x63, 0x6b, 0x06, 0xf3, 0xb8, 0x99,
+	0x46, 0xfb, 0xeb, 0xf9, 0x2c, 0xa1, 0xd3, 0x50, 0x5e, 0x37, 0x59, 0x65, 0xe2, 0xa8, 0xe8, 0x69, 0xe4, 0x6e, 0xc6, 0xd4, 0xb4, 0xd7, 0x7c, 0x53,
+	0x55, 0x9b, 0x15, 0x44, 0xdd, 0x99, 0xcb, 0x51, 0xf0, 0x85, 0xa9, 0xd1, 0xab, 0x66, 0x85, 0x8a, 0x71, 0xc5, 0xef, 0x2a, 0xb9, 0xb8, 0x69, 0x7b,
+	0x41, 0x5b, 0x6d, 0x8b, 0xc1, 0xd7, 0xbc, 0xcc, 0x53, 0x97, 0x6d, 0x37, 0x85, 0x1d, 0xa0, 0xcd, 0x8b, 0x7c, 0x5c, 0xd4, 0x6c, 0xa6, 0x8d, 0x4d,
+	0xda, 0xc4, 0x81, 0xfa, 0x60, 0x4e, 0xb3, 0xad, 0xc1, 0x9c, 0xcc, 0xce, 0x4f, 0x65, 0xd8, 0x14, 0xa3, 0xb9, 0xfa, 0x7a, 0xbb, 0xe1, 0x5c, 0xa5,
+	0xff, 0xc4, 0xf1, 0x9c, 0x7e, 0xe2, 0x78, 0x56, 0xe5, 0xbc, 0xc5, 0x80, 0x4e, 0x7f, 0xe7, 0x80, 0x1e, 0xb6, 0x0c, 0xe8, 0xd0, 0xf6, 0x95, 0xdf,
+	0x18, 0xd0, 0xa3, 0x5d, 0x03, 0x7a, 0x7c, 0x54, 0x0d, 0x8a, 0xfa, 0x80, 0x4e, 0x3f, 0xcb, 0x80, 0x4e, 0x77, 0x0f, 0xe8, 0xd9, 0x27, 0x8f, 0xe8,
+	0xd9, 0xae, 0xfa, 0xde, 0x30, 0xa4, 0x67, 0xbf, 0x69, 0x4c, 0xcf, 0x5a, 0x9a, 0x6a, 0xf7, 0xa0, 0x36, 0x6d, 0xf0, 0x6c, 0x99, 0x66, 0x2f, 0xf2,
+	0x17, 0x02, 0x9e, 0x91, 0x19, 0xc9, 0x4f, 0x1e, 0x3f, 0xba, 0x0d, 0xf2, 0x36, 0xaf, 0xfa, 0xad, 0x04, 0x8c, 0x36, 0x4f, 0xb3, 0x75, 0xb2, 0x9a,
+	0x9d, 0x9b, 0xac, 0xa6, 0xdd, 0x27, 0x73, 0x41, 0xe2, 0xd5, 0x72, 0x31, 0x4b, 0x3a, 0x8f, 0xe5, 0x36, 0x9d, 0x47, 0xf3, 0x65, 0xf2, 0xa6, 0x4b,
+	0x27, 0xb5, 0x88, 0xce, 0xb2, 0x69, 0x37, 0x4b, 0x62, 0xfb, 0xfd, 0x97, 0x28, 0x13, 0x8a, 0x95, 0x09, 0x25, 0xb7, 0x43, 0x71, 0x25, 0xc7, 0x66,
+	0xd9, 0x6e, 0xe9, 0x86, 0xca, 0x8f, 0x53, 0x8d, 0xdb, 0xca, 0x05, 0x48, 0x53, 0x34, 0x1c, 0xd5, 0x5f, 0xa4, 0x0b, 0xef, 0x4e, 0xa7, 0xce, 0x6f,
+	0x70, 0x56, 0x67, 0xd2, 0x0b, 0xb3, 0xf3, 0x79, 0xd6, 0x91, 0x06, 0x6d, 0x4e, 0xf4, 0x6a, 0xaa, 0xd6, 0x86, 0xf0, 0xf6, 0xfd, 0x49, 0xa4, 0xb1,
+	0x69, 0xa3, 0xed, 0xa1, 0xbe, 0x35, 0xce, 0xb7, 0xaf, 0x34, 0x21, 0x94, 0xb1, 0x4a, 0xc9, 0xf2, 0xfc, 0xc3, 0x56, 0xde, 0x03, 0xe4, 0x27, 0x76,
+	0x64, 0x36, 0x90, 0xc1, 0x24, 0x39, 0x31, 0xff, 0xb2, 0xc9, 0x8b, 0x66, 0xec, 0xe1, 0x78, 0xff, 0xb0, 0xca, 0x82, 0x17, 0x56, 0x65, 0x1f, 0xcc,
+	0x54, 0x70, 0x55, 0x1d, 0xbe, 0xa9, 0x9b, 0xae, 0x35, 0xb0, 0xba, 0x65, 0x54, 0x47, 0x69, 0xdb, 0x66, 0x7a, 0xaa, 0x61, 0x84, 0x6f, 0xd1, 0x55,
+	0x3b, 0x0d, 0xf1, 0xf5, 0x7d, 0xa5, 0x46, 0x8e, 0xea, 0x82, 0x46, 0x01, 0x6e, 0xdf, 0x57, 0x8d, 0x4b, 0x9b, 0x9d, 0xa5, 0xda, 0xf8, 0xa6, 0xde,
+	0xb2, 0xad, 0xb9, 0xab, 0xb7, 0xaa, 0x6e, 0xd7, 0x9d, 0x55, 0x1e, 0x6d, 0x37, 0x14, 0x8f, 0x1f, 0x3d, 0xae, 0x19, 0x8a, 0xc1, 0xec, 0xed, 0xed,
+	0x6c, 0x85, 0x5c, 0xf8, 0xc7, 0xd9, 0x8a, 0xc7, 0x68, 0x04, 0x9a, 0x88, 0xce, 0xe3, 0x53, 0x29, 0xf1, 0x6c, 0x71, 0x52, 0xb3, 0x15, 0x49, 0x9c,
+	0x74, 0xcd, 0x70, 0xb8, 0x8b, 0xf2, 0xbd, 0x6d, 0xb4, 0x3b, 0xc2, 0x8e, 0x8e, 0x24, 0x98, 0xbd, 0xbd, 0x9d, 0xaf, 0x96, 0x5b, 0x6c, 0x66, 0xd1,
+	0x1c, 0x75, 0xe9, 0xbc, 0x15, 0x53, 0x25, 0x11, 0xee, 0x75, 0x4e, 0x9b, 0xdd, 0x30, 0x8f, 0xd6, 0x1b, 0x16, 0xd6, 0x76, 0xbf, 0x1a, 0xb8, 0xb3,
+	0xb7, 0x8c, 0xe7, 0x6f, 0x6d, 0xd2, 0xa4, 0x09, 0xff, 0xa7, 0x49, 0xfb, 0xbd, 0x26, 0xad, 0xc8, 0xe9, 0x57, 0xc9, 0xe9, 0x57, 0x09, 0xff, 0x0e,
+	0x7f, 0x35, 0x14, 0x80, 0x54, 0x47, 0xbf, 0x96, 0x0c, 0xb4, 0xd5, 0x6f, 0x72, 0x66, 0x67, 0x97, 0xde, 0xc2, 0x3a, 0xb6, 0x5e, 0xf8, 0x5b, 0xac,
+	0x65, 0x7d, 0x04, 0xfc, 0x4f, 0x6b, 0xf9, 0x19, 0xad, 0x65, 0xfb, 0x38, 0x29, 0xeb, 0x20, 0x91, 0xf8, 0xaf, 0xc7, 0xd3, 0x72, 0xd8, 0x5c, 0x33,
+	0x6a, 0x5a, 0x0b, 0xd3, 0x3e, 0x22, 0xaa, 0xc2, 0xdd, 0xda, 0x1c, 0x7f, 0xf3, 0x68, 0xdb, 0x1c, 0x0f, 0xd6, 0xd9, 0xc9, 0x59, 0xb6, 0xd8, 0xbc,
+	0x92, 0xae, 0xb9, 0xa5, 0x69, 0xfe, 0xe6, 0xd1, 0x1f, 0x6e, 0x9a, 0xbf, 0x31, 0x4f, 0xd0, 0xa2, 0x2d, 0x80, 0x4b, 0xf2, 0xf8, 0x3f, 0xc1, 0x28,
+	0x9b, 0x03, 0x1c, 0x85, 0xe6, 0xd6, 0xb5, 0xd6, 0x51, 0x5f, 0x24, 0xc2, 0xb1, 0xd5, 0xd1, 0x07, 0xd5, 0x67, 0x6b, 0xa6, 0xd7, 0xa7, 0xb3, 0x7c,
+	0xf3, 0x43, 0x76, 0x32, 0x5b, 0x9b, 0xc5, 0xb9, 0xdf, 0x67, 0xcf, 0xbf, 0x79, 0x74, 0xfb, 0x95, 0x92, 0xa6, 0xb9, 0xde, 0x2e, 0xac, 0x4c, 0xdb,
+	0xdf, 0x62, 0xbb, 0x55, 0x0e, 0xdb, 0x33, 0xd6, 0x16, 0x29, 0x4b, 0xdb, 0xdd, 0x88, 0xad, 0xae, 0x49, 0xf9, 0x7e, 0xb9, 0x7a, 0xc5, 0x7c, 0xb6,
+	0xe6, 0x68, 0x99, 0x85, 0x9a, 0xa2, 0x8d, 0x82, 0x5f, 0x56, 0x97, 0xb7, 0x98, 0xd3, 0x96, 0x76, 0xdf, 0x9e, 0x9e, 0xdb, 0x39, 0x72, 0xb2, 0x96,
+	0xf7, 0xc6, 0x64, 0xfd, 0x79, 0x5a, 0xdd, 0x65, 0x7b, 0x66, 0xb6, 0xdc, 0x62, 0xd0, 0x76, 0xcc, 0x19, 0x34, 0xca, 0xae, 0xcc, 0x7c, 0x79, 0xbf,
+	0xd6, 0x6b, 0xdd, 0xf0, 0xfe, 0xf6, 0xc5, 0x98, 0xee, 0xcd, 0x1c, 0xcb, 0xc9, 0x5f, 0x66, 0x78, 0xd3, 0xd8, 0xb9, 0x69, 0x61, 0xa2, 0xc5, 0xcc,
+	0x7f, 0xe2, 0xe8, 0xd9, 0x69, 0xf3, 0xaf, 0x19, 0x3e, 0xed, 0x14, 0xa2, 0xad, 0xe0, 0xcd, 0xe3, 0xa7, 0xcd, 0xd5, 0xff, 0x59, 0xe3, 0xa7, 0x6e,
+	0xec, 0x3f, 0xff, 0xf8, 0x69, 0xf8, 0x87, 0xdf, 0x3d, 0x80, 0x6e, 0xf0, 0x1e, 0x2f, 0x9a, 0xde, 0xe3, 0x76, 0x1e, 0xe3, 0xc5, 0x1f, 0xe9, 0x31,
+	0x5e, 0x5c, 0x6c, 0xce, 0x2f, 0x36, 0xed, 0x1e, 0x63, 0xf9, 0x9f, 0xe2, 0x31, 0x5a, 0x31, 0xfe, 0xe5, 0x2a, 0x63, 0x07, 0x5d, 0x67, 0xf4, 0x6b,
+	0x09, 0x9f, 0xe2, 0x99, 0x90, 0xa0, 0xc3, 0x6d, 0x1d, 0xc2, 0x8b, 0x5b, 0x3b, 0x84, 0xdb, 0x5b, 0xe7, 0x1b, 0xcd, 0xf1, 0x1e, 0xba, 0x7c, 0x67,
+	0xf1, 0xa7, 0xb6, 0x3d, 0x9b, 0xcd, 0xb0, 0x6b, 0xa6, 0xd5, 0x52, 0x5d, 0xd3, 0x30, 0x8e, 0x34, 0x80, 0x32, 0xd1, 0x35, 0xf6, 0x2e, 0x93, 0x1e,
+	0xed, 0xba, 0xdc, 0x3c, 0x08, 0xb9, 0x8d, 0xa1, 0x7c, 0xd1, 0x6a, 0x28, 0x6f, 0xd3, 0xf0, 0x30, 0x4c, 0x78, 0x64, 0x23, 0x95, 0x2d, 0x3b, 0xc1,
+	0x0e, 0xa0, 0xbf, 0x9b, 0xe7, 0xb3, 0x3b, 0x26, 0x8b, 0xbd, 0x66, 0x7b, 0x86, 0xd8, 0xc3, 0xb7, 0x9a, 0x25, 0x66, 0x44, 0xab, 0x1b, 0x19, 0x20,
+	0xbf, 0x77, 0xef, 0xee, 0xd6, 0xbd, 0xd5, 0x37, 0xd0, 0x8b, 0xe9, 0x46, 0x29, 0xff, 0xb2, 0x7e, 0x6d, 0x5f, 0xba, 0xb0, 0xcb, 0x27, 0xbe, 0xdd,
+	0xa2, 0x23, 0x13, 0x5b, 0xab, 0xed, 0xe9, 0x64, 0x4d, 0xc9, 0x06, 0x17, 0xd6, 0x73, 0xe1, 0x54, 0xbb, 0x2c, 0x52, 0x3c, 0x32, 0x53, 0x64, 0x3b,
+	0xc5, 0xd5, 0x1d, 0x5b, 0x47, 0xd5, 0x98, 0x45, 0x6e, 0x55, 0x0b, 0xbe, 0x2d, 0x9b, 0xce, 0x96, 0x96, 0x07, 0xee, 0x56, 0xc5, 0xfc, 0xf8, 0xf1,
+	0x3c, 0x5a, 0xad, 0xb3, 0xa7, 0x8b, 0x4d, 0x79, 0xce, 0x5e, 0xb4, 0xdb, 0x3f, 0xd9, 0xc6, 0x45, 0xba, 0x6a, 0x32, 0x47, 0x8b, 0x8e, 0x99, 0x0d,
+	0x27, 0xd2, 0x1b, 0x68, 0xd7, 0x72, 0x36, 0x70, 0x6a, 0x0e, 0x0f, 0xf1, 0xe1, 0xa1, 0x8c, 0xc5, 0xfb, 0x7c, 0x18, 0xbb, 0xd5, 0x42, 0xf6, 0x19,
+	0x2e, 0x6f, 0xff, 0x17, 0x6f, 0x18, 0x1e, 0xe2, 0x13, 0xbf, 0x3f, 0x7c, 0x38, 0xde, 0x59, 0x67, 0xb4, 0x4f, 0x55, 0x67, 0x2b, 0x73, 0xc0, 0x9f,
+	0xda, 0x74, 0xc5, 0x11, 0x3b, 0x55, 0xa5, 0x45, 0xb4, 0xd6, 0xe1, 0xa6, 0x87, 0x07, 0xb6, 0xc6, 0xb8, 0xe4, 0x16, 0x36, 0xac, 0xe8, 0x73, 0x9c,
+	0x38, 0xbc, 0x3a, 0x6c, 0x16, 0x7b, 0x26, 0xe3, 0x3e, 0x83, 0x13, 0x55, 0xb2, 0x01, 0xf5, 0x64, 0x56, 0x5a, 0xcb, 0xb4, 0xd4, 0xec, 0xfe, 0x7d,
+	0x65, 0x32, 0xca, 0x86, 0x3a, 0x96, 0x71, 0xe6, 0x0d, 0x87, 0x8d, 0x06, 0x3c, 0x36, 0x13, 0xbd, 0x1a, 0x3b, 0xea, 0xc4, 0xde, 0xde, 0x61, 0x2c,
+	0x03, 0xf0, 0x0d, 0x1e, 0x1b, 0xb6, 0x05, 0x37, 0xaf, 0x7f, 0xa8, 0xbb, 0x27, 0x7b, 0xe9, 0x2d, 0xa3, 0x9a, 0xd7, 0x3f, 0xfc, 0x81, 0x51, 0x0d,
+	0xef, 0x5c, 0x8f, 0x66, 0x36, 0x2b, 0xfa, 0xa6, 0x5e, 0xd1, 0x15, 0xad, 0x36, 0xa0, 0x68, 0x77, 0xd3, 0x85, 0xf6, 0x68, 0x71, 0x41, 0x7f, 0xbb,
+	0x6f, 0xec, 0x5f, 0x6b, 0x33, 0xa5, 0x33, 0xb8, 0xb2, 0x55, 0x18, 0x21, 0x23, 0xc6, 0xd8, 0x71, 0xee, 0x93, 0x7d, 0x8d, 0x34, 0xcf, 0x7f, 0xae,
+	0xaf, 0x69, 0xaf, 0x81, 0x76, 0x37, 0x8d, 0xfa, 0xef, 0xf2, 0x38, 0xb6, 0xd9, 0xca, 0x0f, 0xfd, 0x6b, 0x1b, 0xc9, 0x39, 0xac, 0x5f, 0x55, 0x0e,
+	0x7b, 0x3c, 0x42, 0x6a, 0xf3, 0x48, 0xdb, 0xf9, 0x1c, 0x5d, 0x93, 0xfd, 0x6d, 0xfd, 0x52, 0xbd, 0xfd, 0x77, 0xf8, 0xa5, 0xd6, 0x4e, 0xaa, 0xb4,
+	0x54, 0xe7, 0x6f, 0x92, 0xf5, 0xe8, 0x3c, 0x4a, 0x7b, 0x69, 0xb4, 0x89, 0xfa, 0x97, 0xe6, 0xdf, 0x5a, 0xff, 0x98, 0x03, 0x0a, 0xb2, 0x25, 0x65,
+	0x2a, 0xad, 0x28, 0x1c, 0x89, 0x33, 0x6a, 0xc1, 0xe7, 0x70, 0xc7, 0x83, 0x33, 0x95, 0x6c, 0x8f, 0x57, 0x6b, 0x5e, 0x45, 0xf6, 0xbc, 0x4a, 0xf7,
+	0xbd, 0xba, 0x48, 0x46, 0x81, 0x95, 0x6a, 0xe9, 0x21, 0x60, 0x9f, 0x5e, 0x89, 0x65, 0x60, 0x9e, 0x2d, 0x8f, 0xa8, 0xea, 0x55, 0x5c, 0x6f, 0x64,
+	0x22, 0xde, 0xa2, 0x92, 0x32, 0xb6, 0xd4, 0xcd, 0x1f, 0xb4, 0x9a, 0xcf, 0x97, 0xdf, 0x3d, 0x7e, 0xf5, 0x2f, 0xa3, 0x4e, 0x61, 0x45, 0x99, 0xb4,
+	0x0a, 0x59, 0xd8, 0x44, 0x26, 0x97, 0x23, 0x95, 0x95, 0x51, 0x78, 0x18, 0xb5, 0x02, 0xce, 0x3e, 0xbc, 0x2e, 0x5f, 0x93, 0x44, 0x46, 0x04, 0xcc,
+	0x6f, 0x67, 0x29, 0x58, 0x2b, 0xb6, 0x60, 0x15, 0x2d, 0x4e, 0xb2, 0xf2, 0x16, 0xcc, 0x51, 0xb7, 0xd2, 0x7d, 0xdb, 0x0c, 0x5b, 0x91, 0x0f, 0x0f,
+	0x16, 0x93, 0x06, 0x45, 0xb2, 0x5d, 0x31, 0x3b, 0x16, 0x67, 0x69, 0xfb, 0xe3, 0xc6, 0x1a, 0xea, 0x12, 0x75, 0xfb, 0x85, 0x50, 0xa5, 0xa5, 0xb3,
+	0x8b, 0xe5, 0xb7, 0xd6, 0x0e, 0xc6, 0xe3, 0xe5, 0x22, 0x45, 0xdb, 0x03, 0x45, 0x99, 0x95, 0xbf, 0xae, 0xa7, 0x97, 0x62, 0x70, 0x0e, 0xe4, 0xff,
+	0x03, 0x3b, 0x25, 0x0e, 0xec, 0xdf, 0xc1, 0xd6, 0xc0, 0x3e, 0xb8, 0xcc, 0x92, 0xf8, 0xa0, 0xf9, 0x2c, 0x68, 0x90, 0xc4, 0xc9, 0x41, 0x73, 0xd1,
+	0x73, 0x90, 0xe4, 0x8d, 0xd4, 0x12, 0x01, 0x0f, 0x96, 0xcd, 0xc3, 0x82, 0x72, 0x03, 0xb1, 0xcc, 0x07, 0xcd, 0x99, 0x74, 0x35, 0xb8, 0xd8, 0xcc,
+	0xe6, 0xeb, 0x83, 0xcb, 0xd3, 0xec, 0xfd, 0x81, 0x7d, 0x40, 0xfe, 0x6d, 0xf6, 0x5e, 0x8e, 0xe6, 0xe3, 0xe2, 0xfb, 0x8f, 0xf2, 0xf9, 0x6a, 0x60,
+	0x9b, 0xec, 0xe0, 0x12, 0xa3, 0x4f, 0xfe, 0x44, 0xe9, 0x41, 0x31, 0xd7, 0x06, 0x18, 0x8c, 0x07, 0xd5, 0xb8, 0xbc, 0xba, 0x1a, 0xfc, 0x12, 0x99,
+	0xe6, 0x7a, 0x9d, 0xad, 0x37, 0x07, 0x97, 0x6a, 0x68, 0x6a, 0xf9, 0xde, 0x40, 0xb5, 0xf4, 0x81, 0xfa, 0x3c, 0x28, 0x5b, 0xfb, 0xa0, 0xfc, 0x34,
+	0xb8, 0xba, 0x3a, 0x2c, 0xe9, 0xa8, 0x93, 0xbd, 0x3f, 0x5f, 0xae, 0x36, 0x6b, 0x83, 0x47, 0x17, 0x0b, 0x2a, 0x06, 0x53, 0x01, 0xb9, 0xb3, 0x65,
+	0x7a, 0x31, 0x17, 0x9b, 0xc0, 0xb3, 0x53, 0x34, 0x7f, 0x19, 0x0d, 0x59, 0xb0, 0x62, 0x6a, 0x00, 0x60, 0x31, 0xa1, 0xba, 0xf7, 0xee, 0xf1, 0xe8,
+	0x7e, 0x74, 0x96, 0xca, 0x6c, 0xc2, 0xe7, 0x1e, 0xae, 0x2e, 0x10, 0x0f, 0xea, 0xbf, 0xe5, 0x66, 0x9f, 0x07, 0x2f, 0xf1, 0x07, 0x56, 0x57, 0xfa,
+	0xb7, 0x3a, 0x61, 0x26, 0x6d, 0xf9, 0x65, 0x6a, 0x0f, 0x5d, 0xf5, 0x61, 0x91, 0xfb, 0x87, 0xf3, 0x6c, 0x63, 0x7c, 0xcf, 0xb3, 0xad, 0x87, 0xca,
+	0xb0, 0x9b, 0x62, 0xc6, 0x96, 0xa9, 0x75, 0x88, 0xaf, 0xc5, 0x79, 0x3c, 0xe1, 0xf7, 0x5e, 0xf7, 0xc7, 0xd7, 0xdf, 0xdc, 0x1f, 0x77, 0xad, 0xf1,
+	0x16, 0x8b, 0x58, 0x4b, 0xf5, 0x75, 0xb6, 0x95, 0xca, 0xdc, 0x42, 0x32, 0x7d, 0x74, 0x91, 0xe7, 0x92, 0xcc, 0x88, 0xf9, 0x62, 0x37, 0x7c, 0xbd,
+	0xfc, 0xea, 0x51, 0xcf, 0xe6, 0x20, 0x87, 0x70, 0xf5, 0x8f, 0xe2, 0xa3, 0xc6, 0xa5, 0x86, 0x92, 0xe9, 0xa5, 0xae, 0x87, 0xa6, 0x7c, 0xd7, 0xb9,
+	0xc0, 0xca, 0xfb, 0x49, 0xe0, 0xb9, 0x95, 0x91, 0xb1, 0x99, 0xef, 0x84, 0x0d, 0x97, 0xef, 0xf6, 0x71, 0xd5, 0x72, 0xff, 0x24, 0xdb, 0xfc, 0x10,
+	0xc9, 0x81, 0x33, 0xd0, 0xae, 0xa0, 0xf1, 0x5b, 0x16, 0xd1, 0xe4, 0x42, 0x18, 0x64, 0x43, 0xda, 0xb1, 0xb5, 0x8f, 0x01, 0x64, 0xbe, 0xf5, 0x74,
+	0xa3, 0xd8, 0xbf, 0xbc, 0x37, 0xcd, 0xb2, 0x5c, 0xf6, 0x38, 0x4e, 0x50, 0x00, 0xe6, 0xb0, 0x35, 0xb2, 0xf7, 0x65, 0xca, 0x94, 0x42, 0x45, 0x13,
+	0xc1, 0x1f, 0xd6, 0x1c, 0x76, 0x79, 0x6f, 0xc9, 0xa4, 0x72, 0x9b, 0x45, 0xa1, 0xb6, 0x12, 0xcb, 0x74, 0xb0, 0xc5, 0xc4, 0x54, 0xd9, 0x97, 0x99,
+	0xb2, 0x9f, 0xaf, 0x96, 0x67, 0xa4, 0xfd, 0x7a, 0x9e, 0xbc, 0x94, 0x05, 0x7b, 0x5a, 0x36, 0x4c, 0x19, 0x87, 0xef, 0xd5, 0x53, 0x97, 0x8b, 0xfb,
+	0x89, 0xa1, 0x63, 0xb4, 0x0e, 0x3f, 0xd5, 0x93, 0x0d, 0xca, 0xeb, 0xd9, 0x7a, 0x19, 0xcd, 0xfd, 0x7e, 0x8c, 0x5e, 0xdb, 0xdf, 0x2c, 0x1f, 0x85,
+	0x41, 0xaf, 0x34, 0x40, 0x38, 0xdb, 0xec, 0xc9, 0xc6, 0x6a, 0x58, 0x79, 0x8f, 0x30, 0xe8, 0x5f, 0x9a, 0x6c, 0x99, 0xdd, 0x54, 0x1d, 0xdf, 0x8f,
+	0xc3, 0xc0, 0x0e, 0x9e, 0xf6, 0x1e, 0xe7, 0x25, 0x62, 0x04, 0x4d, 0xd7, 0x57, 0x45, 0x6b, 0x4f, 0x55, 0xb8, 0xd4, 0x4f, 0xef, 0x3b, 0x93, 0xb3,
+	0x2d, 0xff, 0x56, 0xdf, 0x15, 0xcf, 0x27, 0x70, 0x5f, 0x26, 0x84, 0x0b, 0x48, 0xbf, 0x36, 0xe5, 0x68, 0x1b, 0x5c, 0xd6, 0x6d, 0x66, 0xf5, 0x5e,
+	0xc3, 0x1d, 0xcc, 0x25, 0x7a, 0x9a, 0xd9, 0xbf, 0xbd, 0x2a, 0xc7, 0xb2, 0x91, 0x6d, 0x1b, 0x77, 0x2f, 0xc4, 0xb4, 0x98, 0x1c, 0x93, 0x4d, 0x17,
+	0x75, 0x7b, 0x75, 0x1a, 0x49, 0x3c, 0x34, 0xbd, 0xbc, 0x3a, 0xe4, 0xa7, 0xfd, 0xd3, 0x68, 0x7d, 0x5a, 0xb5, 0xf9, 0xd9, 0xfa, 0x64, 0xb0, 0x04,
+	0x3d, 0x5b, 0x79, 0xb7, 0x98, 0x9a, 0x48, 0xdc, 0x85, 0xf8, 0x08, 0x39, 0xf5, 0xcd, 0x72, 0x75, 0x16, 0x6d, 0x0e, 0xba, 0x26, 0xc3, 0xc5, 0x49,
+	0x77, 0x20, 0x9e, 0xb2, 0x38, 0x24, 0x63, 0xae, 0x7b, 0x85, 0x3b, 0xc8, 0xe5, 0x53, 0xab, 0x94, 0x8e, 0xd6, 0xeb, 0xd9, 0xc9, 0xa2, 0x57, 0xe4,
+	0x51, 0xe6, 0x7c, 0xb8, 0x16, 0x74, 0x4f, 0x4e, 0x7b, 0xf2, 0x7d, 0xbf, 0xcc, 0x16, 0x66, 0xcd, 0xa4, 0x3b, 0x48, 0xa2, 0x75, 0x56, 0xdc, 0xe3,
+	0x40, 0xce, 0x4f, 0x6d, 0x51, 0x8d, 0xc9, 0xa7, 0xd9, 0x31, 0xe5, 0xec, 0xdb, 0x30, 0x04, 0xa9, 0xe5, 0xf6, 0xf7, 0x11, 0x22, 0xd5, 0x2e, 0x90,
+	0xa3, 0x68, 0xbe, 0xd7, 0xcb, 0x57, 0xc8, 0x4d, 0x5f, 0x46, 0xff, 0xf7, 0x9d, 0xd9, 0xe4, 0x19, 0x78, 0xe3, 0xc8, 0xcb, 0x27, 0xfc, 0x6d, 0x3e,
+	0x7f, 0x14, 0x04, 0x13, 0xbb, 0x23, 0xcc, 0xc9, 0x63, 0xfe, 0x0c, 0xe8, 0x24, 0x1e, 0xa6, 0x31, 0xb6, 0x10, 0xfa, 0x93, 0x61, 0x98, 0x78, 0xd8,
+	0x02, 0x30, 0x9c, 0xe4, 0xae, 0xeb, 0xe6, 0xdc, 0x52, 0xed, 0xe7, 0x63, 0x0f, 0x5b, 0x2c, 0xa2, 0xd8, 0x4d, 0x86, 0x7c, 0xf7, 0x58, 0x3a, 0x76,
+	0x46, 0x51, 0x84, 0x7c, 0x5d, 0x6f, 0xec, 0x0f, 0x63, 0x87, 0x3b, 0xdd, 0x7d, 0x77, 0xcc, 0x97, 0x7d, 0x0d, 0x87, 0x4e, 0x32, 0xb2, 0x6f, 0x1c,
+	0xf2, 0x62, 0xb3, 0xc1, 0x09, 0xbb, 0x64, 0x1c, 0xf3, 0x9a, 0x80, 0xdc, 0xbe, 0x32, 0x24, 0x71, 0x42, 0xbe, 0xb4, 0xc1, 0x9d, 0xc4, 0xb9, 0x3b,
+	0xb2, 0x2f, 0x1b, 0x8d, 0xc3, 0x09, 0xb6, 0xd9, 0x65, 0x79, 0x9c, 0x05, 0xa3, 0x31, 0x7f, 0x2a, 0x42, 0x92, 0xa4, 0xf6, 0x27, 0xbb, 0x9c, 0x24,
+	0x72, 0xb1, 0x81, 0xca, 0x4b, 0xb3, 0x89, 0x97, 0x60, 0x5b, 0x60, 0x10, 0x8d, 0x82, 0x71, 0xc0, 0xf7, 0xf1, 0x26, 0xb1, 0x13, 0x4d, 0xb0, 0xcf,
+	0x66, 0x14, 0x4a, 0xcd, 0xc7, 0x7c, 0x21, 0xf2, 0xd8, 0xcf, 0x86, 0x2e, 0xb6, 0xa2, 0x45, 0x63, 0xdf, 0x4d, 0xf8, 0x26, 0xb9, 0xd8, 0x71, 0x7c,
+	0x6f, 0x84, 0x0d, 0x28, 0x71, 0x3e, 0x9c, 0x8c, 0x72, 0xfe, 0x42, 0x50, 0x98, 0x39, 0x4e, 0x8c, 0x6d, 0x08, 0xe9, 0x30, 0x1a, 0x4d, 0x5c, 0xec,
+	0x95, 0x70, 0xc2, 0x24, 0x0a, 0xfd, 0x21, 0xdf, 0xdc, 0xe1, 0x4d, 0xbc, 0x09, 0x36, 0xdf, 0x79, 0xa3, 0x78, 0xe4, 0x44, 0xd8, 0xd2, 0xe4, 0x65,
+	0x6e, 0xec, 0xb9, 0xd8, 0x23, 0x1b, 0xa4, 0x52, 0x2e, 0xbe, 0x87, 0x68, 0xe8, 0xfb, 0x52, 0x69, 0xec, 0xc1, 0x08, 0x87, 0x4e, 0x34, 0xf2, 0xb9,
+	0xad, 0x35, 0x0c, 0x23, 0x27, 0xb2, 0x3f, 0xd8, 0x92, 0x78, 0xc9, 0x84, 0x2f, 0x73, 0xf5, 0x46, 0x9e, 0x97, 0x8c, 0xf9, 0x5b, 0xc6, 0xb1, 0xd9,
+	0xab, 0x8a, 0x4d, 0x5c, 0x63, 0x37, 0x0a, 0xc3, 0x80, 0x3f, 0x36, 0x18, 0xc4, 0xe3, 0xd8, 0xbe, 0x62, 0x3b, 0x4c, 0xcc, 0xcb, 0xe8, 0xf8, 0x8e,
+	0x3b, 0x2f, 0x1b, 0xbb, 0x7c, 0xc5, 0xfc, 0x64, 0xe2, 0x84, 0xfc, 0x65, 0xdf, 0xc0, 0xc9, 0xfc, 0x21, 0x5f, 0x1a, 0x25, 0xed, 0x1c, 0x39, 0xb8,
+	0xcc, 0x9d, 0x44, 0x41, 0xe2, 0x72, 0xdb, 0x4f, 0xe6, 0x4b, 0x1e, 0x7c, 0x5d, 0x87, 0xb4, 0xde, 0x88, 0xaf, 0xba, 0xf5, 0x83, 0xd8, 0x89, 0x93,
+	0x98, 0xe3, 0xc1, 0x4d, 0xec, 0xfb, 0xda, 0x82, 0x2c, 0x1d, 0x47, 0x11, 0x36, 0xab, 0x0c, 0xe3, 0x49, 0x92, 0x44, 0xfc, 0x69, 0xad, 0xb1, 0x97,
+	0x85, 0x7c, 0xad, 0xa2, 0x64, 0x20, 0xa3, 0x84, 0x3f, 0x6d, 0x31, 0x8e, 0x86, 0xa1, 0xcf, 0xdf, 0x14, 0x0d, 0x92, 0xf1, 0xc8, 0xfe, 0xc4, 0x69,
+	0x92, 0x8c, 0x1c, 0xcf, 0xe1, 0x7b, 0x2c, 0x62, 0xb3, 0xbb, 0x03, 0x3b, 0x80, 0x82, 0xa1, 0xb4, 0x6b, 0xc6, 0xf7, 0xd0, 0xe6, 0x93, 0x88, 0xaf,
+	0x7d, 0x48, 0xc2, 0x91, 0x3b, 0x1a, 0xe7, 0xf6, 0x37, 0xee, 0xbf, 0x35, 0xe3, 0x58, 0x9a, 0x6b, 0x92, 0x85, 0x7c, 0x9d, 0x53, 0x1c, 0x8e, 0xa2,
+	0x8c, 0x9b, 0xbe, 0xa5, 0xab, 0x72, 0xbe, 0xdf, 0x35, 0x1a, 0x06, 0x79, 0x3e, 0xc4, 0x36, 0x9d, 0xa1, 0xeb, 0x64, 0x43, 0x8f, 0x3f, 0x11, 0x10,
+	0x3b, 0xc3, 0x70, 0xcc, 0x5f, 0x19, 0xce, 0xc7, 0x7e, 0x3a, 0xc1, 0xb6, 0x59, 0x19, 0xa1, 0x4e, 0x22, 0xad, 0x76, 0x7c, 0x28, 0x93, 0x66, 0x6f,
+	0xca, 0x09, 0x04, 0xb7, 0xf2, 0xf8, 0x34, 0x5a, 0x19, 0xad, 0x57, 0xcf, 0x0c, 0x55, 0x5a, 0xcc, 0xf9, 0x54, 0x12, 0x95, 0xb2, 0xfc, 0x3d, 0x0f,
+	0x07, 0x9f, 0x4f, 0x9f, 0x45, 0x9b, 0xd3, 0xfd, 0x24, 0x9b, 0xcd, 0x7b, 0xf3, 0x2f, 0x0b, 0xe3, 0xfa, 0x8c, 0x11, 0x2e, 0xec, 0xee, 0xf3, 0xed,
+	0xe0, 0xf3, 0x39, 0xc1, 0xf9, 0x99, 0x89, 0x32, 0xaa, 0x64, 0xbb, 0x05, 0x00, 0x26, 0xe1, 0xd1, 0xaf, 0xc7, 0x53, 0x33, 0xb1, 0xf7, 0x13, 0x5b,
+	0xae, 0xaf, 0xc4, 0x51, 0x7d, 0x11, 0x06, 0x7b, 0xbf, 0x7e, 0x11, 0xf4, 0xed, 0xee, 0x92, 0x1d, 0xa7, 0xf7, 0xdc, 0xbe, 0xdd, 0x6d, 0xb2, 0x2b,
+	0x81, 0xd7, 0xc7, 0xee, 0x93, 0x9d, 0xe7, 0xfd, 0x7e, 0xc9, 0xe6, 0x52, 0xfb, 0x6f, 0x67, 0xd3, 0x5e, 0xaf, 0x6a, 0x89, 0xfb, 0x6e, 0xff, 0x8b,
+	0x71, 0xff, 0x4b, 0xb4, 0xc2, 0xf9, 0xf2, 0x5d, 0xcf, 0x1b, 0xf8, 0x9e, 0x6d, 0xaf, 0x6c, 0xf1, 0xfd, 0xb2, 0x25, 0xed, 0xc3, 0x87, 0x0f, 0x9d,
+	0xc3, 0x67, 0x47, 0xcf, 0x25, 0x72, 0x39, 0x72, 0x83, 0x63, 0x36, 0x60, 0x3e, 0x5f, 0x4a, 0xe5, 0x91, 0x7d, 0xbf, 0x3c, 0x39, 0x3c, 0x9e, 0x22,
+	0x93, 0xf6, 0x06, 0x34, 0x07, 0x7e, 0x52, 0x2d, 0x28, 0x1e, 0xb4, 0x4c, 0xb8, 0x31, 0xa1, 0xb4, 0x69, 0xc1, 0x8d, 0xa4, 0xbc, 0xf3, 0xd3, 0xd1,
+	0x46, 0x6e, 0x63, 0x9a, 0x71, 0x73, 0xac, 0x92, 0x98, 0xd3, 0x0f, 0xc2, 0x00, 0x69, 0x2e, 0x91, 0xa6, 0x67, 0x6d, 0xea, 0xff, 0xf3, 0xbf, 0xbb,
+	0x3d, 0x39, 0x70, 0xdf, 0x3b, 0xee, 0xef, 0x99, 0xbf, 0xa3, 0xe3, 0xbd, 0xf2, 0x8c, 0x83, 0x33, 0x52, 0x36, 0x9e, 0x72, 0xc3, 0x63, 0xd6, 0xc8,
+	0xc6, 0x1a, 0xd3, 0x6f, 0x8f, 0x9c, 0xe3, 0x41, 0x2c, 0x7f, 0xdc, 0xe3, 0x41, 0x22, 0x7f, 0xbc, 0xe3, 0x41, 0x2a, 0x7f, 0xfc, 0xe3, 0x41, 0x26,
+	0x7f, 0x82, 0xe3, 0x41, 0x2e, 0x7f, 0x86, 0xc7, 0x83, 0x13, 0xf9, 0x13, 0x1e, 0x0f, 0x4e, 0xe5, 0xcf, 0xe8, 0x78, 0xab, 0xe0, 0x45, 0xa1, 0xf0,
+	0x3b, 0x5e, 0xee, 0xf4, 0xb4, 0xb8, 0xfb, 0xff, 0xfd, 0x7f, 0xb9, 0xbd, 0xac, 0x5f, 0x7c, 0x7b, 0x7c, 0xda, 0xcb, 0x06, 0xf9, 0xe0, 0xa4, 0xbf,
+	0xf7, 0x9d, 0x14, 0xde, 0x94, 0xc6, 0xfe, 0xf2, 0x97, 0x37, 0x2d, 0xd3, 0x3b, 0xbd, 0xa8, 0x4c, 0xff, 0x2c, 0xfa, 0xb5, 0x17, 0x0d, 0xe2, 0x41,
+	0xd2, 0x3f, 0x3c, 0x9d, 0x9e, 0x1c, 0x9e, 0x4c, 0xf3, 0xc3, 0x7c, 0x9a, 0x1d, 0x66, 0xd3, 0x5e, 0xba, 0xf7, 0xda, 0x65, 0x2d, 0xd2, 0x69, 0x72,
+	0x98, 0x4c, 0xe3, 0xc3, 0x78, 0x1a, 0x1d, 0x46, 0x46, 0x01, 0xbe, 0xf7, 0xda, 0x2b, 0xea, 0x67, 0x6a, 0x36, 0xed, 0x99, 0x7f, 0xf7, 0x22, 0x1e,
+	0x33, 0x95, 0x34, 0x47, 0xdc, 0xe3, 0xbd, 0xb8, 0x38, 0xe2, 0xe1, 0x88, 0x77, 0xbc, 0x97, 0x14, 0x47, 0x7c, 0x1c, 0xf1, 0x8f, 0xf7, 0xd2, 0xe2,
+	0x48, 0x80, 0x23, 0xc1, 0xf1, 0x5e, 0x56, 0x1c, 0x19, 0xe2, 0xc8, 0xf0, 0x78, 0x2f, 0x2f, 0x8e, 0x84, 0x38, 0x12, 0x1e, 0xef, 0x9d, 0x14, 0x47,
+	0x46, 0x38, 0x22, 0x7d, 0x71, 0x5a, 0x94, 0xa8, 0x68, 0xb5, 0x53, 0x69, 0xb5, 0xd3, 0x07, 0xdf, 0x16, 0xa1, 0xfc, 0xa9, 0xe9, 0xf4, 0x6f, 0x8f,
+	0x4e, 0x25, 0x7d, 0xb7, 0x78, 0xb9, 0x41, 0x77, 0xcf, 0x1c, 0x10, 0x4c, 0xb3, 0x5e, 0xd2, 0xe8, 0x5c, 0xad, 0x3c, 0xf7, 0xfe, 0x98, 0x03, 0x76,
+	0x6d, 0x36, 0x26, 0x45, 0x9b, 0xe5, 0x6a, 0x6a, 0x7c, 0x76, 0xe9, 0xf7, 0x25, 0x44, 0x31, 0x9e, 0xf7, 0x5d, 0xf7, 0xaf, 0xdd, 0x4e, 0xf7, 0xa0,
+	0xdb, 0x2d, 0xe8, 0xe3, 0xdb, 0xfd, 0x5f, 0x97, 0xb3, 0x45, 0xaf, 0xbc, 0xca, 0x80, 0xbb, 0x6d, 0xe9, 0x1f, 0x5e, 0xe8, 0xf5, 0xc1, 0xc5, 0xe0,
+	0xbd, 0x59, 0x59, 0x30, 0x17, 0xf5, 0xde, 0x4b, 0xc9, 0x17, 0x32, 0xd7, 0xde, 0x3f, 0x78, 0xd0, 0xf3, 0xbd, 0xfb, 0x8b, 0xbe, 0xba, 0x4a, 0x7a,
+	0xab, 0xba, 0xa8, 0xbc, 0xa4, 0xa3, 0xf2, 0x94, 0xd9, 0xf5, 0xbe, 0xff, 0xb3, 0x3e, 0x20, 0xfe, 0x64, 0xeb, 0x88, 0x67, 0xd2, 0xe8, 0x4c, 0xdd,
+	0x9b, 0x32, 0x0d, 0x1b, 0x99, 0xba, 0x8d, 0x4c, 0x87, 0xb5, 0x4c, 0x65, 0x16, 0xdc, 0x94, 0xe9, 0xa8, 0x91, 0xe9, 0xd8, 0x1c, 0x41, 0x03, 0xf8,
+	0xb5, 0xac, 0x6e, 0x2c, 0x9f, 0xdb, 0xcc, 0x6b, 0x52, 0xe6, 0xe5, 0x3a, 0x2a, 0xb3, 0xc7, 0x8a, 0xf2, 0xde, 0x0f, 0x3e, 0x0c, 0xfe, 0xa3, 0x6a,
+	0xf7, 0x7b, 0x1f, 0xe4, 0x82, 0xff, 0xf1, 0xfe, 0xde, 0x7f, 0xa8, 0xe4, 0x32, 0x21, 0xae, 0x4f, 0x6f, 0x92, 0xff, 0xdc, 0xfb, 0x50, 0xbb, 0xa8,
+	0x02, 0xb4, 0xea, 0x5a, 0xe1, 0xb8, 0xb2, 0xe4, 0x17, 0x8b, 0x6c, 0x9d, 0x44, 0xe7, 0x59, 0x8f, 0xf1, 0xd2, 0x8f, 0x3f, 0x3c, 0x7d, 0xbc, 0x3c,
+	0x3b, 0x5f, 0x2e, 0xcc, 0x2a, 0x9e, 0x49, 0xa7, 0xb2, 0xda, 0x46, 0xb7, 0x2a, 0x43, 0x39, 0xf3, 0xca, 0xe4, 0xc9, 0xbf, 0x53, 0xfe, 0xd9, 0x5f,
+	0x65, 0xe7, 0xf3, 0x48, 0x06, 0xac, 0x8c, 0xc3, 0x41, 0xb7, 0x6b, 0x07, 0xad, 0x9c, 0x96, 0x31, 0x59, 0xb7, 0x90, 0x36, 0x7d, 0xf5, 0x5c, 0xda,
+	0xeb, 0x5f, 0x4a, 0xc2, 0x76, 0x0f, 0x57, 0x3e, 0xd0, 0xb0, 0x57, 0x71, 0x52, 0x98, 0xc7, 0xb7, 0x5e, 0xdf, 0x84, 0x0b, 0xea, 0xa1, 0xad, 0xe4,
+	0x71, 0xa8, 0x17, 0x00, 0x18, 0xe9, 0xdf, 0xd5, 0xe1, 0xff, 0xbd, 0x7b, 0xf5, 0xf0, 0xbf, 0x7f, 0x67, 0x6b, 0x39, 0x80, 0x75, 0x07, 0xeb, 0x3f,
+	0xe5, 0xf3, 0x8f, 0xbf, 0x9b, 0xc5, 0x20, 0xcc, 0x3b, 0xf5, 0x28, 0xeb, 0xfc, 0x62, 0xf3, 0xc3, 0xf2, 0xdd, 0xe0, 0x6c, 0xb6, 0x98, 0xde, 0x7f,
+	0x8e, 0x67, 0x2f, 0xfb, 0xcf, 0xbe, 0xfa, 0xc7, 0x2f, 0xaf, 0xbe, 0xfa, 0xe6, 0xc9, 0x2f, 0x4f, 0x9f, 0xbf, 0x7e, 0xf2, 0xb7, 0x27, 0x3f, 0x0c,
+	0xce, 0xa2, 0xf7, 0xd3, 0x1d, 0xe7, 0x6c, 0x40, 0x5f, 0xe4, 0x33, 0x2d, 0x3e, 0x30, 0xfe, 0x36, 0xb9, 0xca, 0xff, 0xed, 0x17, 0xc9, 0x45, 0xfe,
+	0x7f, 0x58, 0xbb, 0x80, 0x1f, 0xec, 0xbf, 0xeb, 0x4d, 0x76, 0x3e, 0x75, 0xaf, 0x49, 0x50, 0xcb, 0xaf, 0x3d, 0x85, 0xbd, 0xc9, 0xd5, 0xe1, 0x76,
+	0xa5, 0x55, 0x74, 0xf8, 0x96, 0xc7, 0x6a, 0x7b, 0x23, 0x4d, 0x3b, 0xf1, 0xc1, 0x4e, 0x3d, 0x73, 0x1c, 0xeb, 0xf5, 0x3f, 0x3a, 0xf6, 0xb1, 0x0f,
+	0xbc, 0xa8, 0xdc, 0xa1, 0x57, 0x54, 0x70, 0xc0, 0x23, 0x33, 0xfb, 0x54, 0x6b, 0x50, 0xd4, 0xb5, 0xdf, 0xdf, 0x2a, 0xa6, 0x09, 0x75, 0xdf, 0xda,
+	0xc7, 0x64, 0x37, 0x94, 0xee, 0xe2, 0x56, 0x45, 0xd3, 0xf5, 0xc6, 0xf9, 0x7d, 0x19, 0x75, 0x67, 0x28, 0xab, 0x1d, 0x47, 0x38, 0x2a, 0x77, 0x33,
+	0x39, 0x7c, 0x33, 0x5f, 0x46, 0x9b, 0xff, 0xf2, 0x43, 0xe0, 0x53, 0x7a, 0xb8, 0x5e, 0xa3, 0xdf, 0xd7, 0xbf, 0xb6, 0x77, 0x31, 0x47, 0x91, 0xaf,
+	0xed, 0xaa, 0x8f, 0x7f, 0x74, 0xc7, 0x5f, 0x57, 0xe8, 0xdf, 0xd7, 0xed, 0xbb, 0xaa, 0xd0, 0x36, 0x18, 0x9e, 0x16, 0x9d, 0x55, 0x3d, 0xed, 0x89,
+	0x56, 0x62, 0x39, 0x07, 0xf3, 0x28, 0xce, 0xe6, 0x03, 0x53, 0xa0, 0x69, 0xd7, 0x2c, 0x11, 0x75, 0x07, 0x30, 0x85, 0xa7, 0xcb, 0xb9, 0x59, 0x89,
+	0xeb, 0x76, 0x07, 0xe9, 0x6c, 0x1d, 0xc5, 0xf3, 0x2c, 0x9d, 0xe6, 0xd1, 0x7c, 0x9d, 0x99, 0x71, 0xf1, 0x3d, 0x57, 0xb3, 0xbd, 0xa1, 0x6f, 0x47,
+	0x02, 0xb3, 0x9a, 0xf2, 0x0f, 0xdb, 0x62, 0x13, 0x9d, 0x4c, 0xd3, 0x65, 0x72, 0x61, 0x9e, 0xb1, 0xec, 0x73, 0xed, 0xf3, 0xc9, 0x9c, 0x4f, 0x5c,
+	0xba, 0xe9, 0xec, 0x6d, 0xb1, 0xe2, 0x27, 0xc9, 0xf6, 0x93, 0xb9, 0x44, 0xfa, 0xcf, 0xf1, 0x78, 0xad, 0x28, 0xa5, 0x7e, 0xe6, 0x76, 0x8b, 0x5c,
+	0x4c, 0x3a, 0x9d, 0x8d, 0xf9, 0x57, 0x65, 0xb1, 0x6f, 0xea, 0xf5, 0x78, 0x29, 0x13, 0x50, 0x0a, 0x89, 0xfa, 0x56, 0x37, 0x8f, 0xce, 0xcf, 0xb3,
+	0x85, 0x5d, 0x8f, 0x33, 0x69, 0x75, 0x57, 0xda, 0x65, 0x2e, 0xdb, 0x0b, 0xf8, 0xc0, 0xfd, 0xda, 0xa6, 0xb5, 0x74, 0x33, 0x95, 0x6d, 0x54, 0xb5,
+	0x4e, 0xbf, 0xfd, 0x16, 0xec, 0x44, 0x39, 0x6a, 0xcf, 0x9f, 0x66, 0xf3, 0xf3, 0xdb, 0xd4, 0xd0, 0xa4, 0xd3, 0x35, 0xfc, 0x56, 0xbe, 0x77, 0xd5,
+	0x29, 0x5d, 0x43, 0xc1, 0xa9, 0xf6, 0x9b, 0x9b, 0x94, 0x3a, 0xbf, 0xf5, 0xe6, 0x83, 0xb8, 0x0f, 0x29, 0xbb, 0x54, 0xe5, 0xc3, 0xb4, 0xbb, 0x10,
+	0x57, 0xaa, 0xf3, 0x5c, 0x2e, 0x12, 0x71, 0x58, 0x56, 0x2e, 0x6b, 0x8e, 0x3c, 0x36, 0x5f, 0xb3, 0x74, 0x3f, 0x9e, 0xd9, 0x1c, 0x6d, 0x66, 0x6f,
+	0x4b, 0x1b, 0x53, 0x3d, 0xac, 0x5c, 0x2e, 0xde, 0x64, 0x1f, 0xd2, 0xe5, 0xbb, 0x85, 0x3a, 0x66, 0x57, 0x68, 0x8c, 0x57, 0xc5, 0x77, 0x09, 0x89,
+	0x16, 0x27, 0xc5, 0xc0, 0x82, 0x89, 0xb4, 0x4d, 0x5d, 0x7b, 0xaa, 0x6e, 0xaa, 0xaa, 0x96, 0x98, 0xb2, 0xf5, 0x3a, 0x3a, 0xc9, 0xec, 0xc0, 0x43,
+	0x39, 0xed, 0xa1, 0xa9, 0xfd, 0xbb, 0xbb, 0x82, 0xdd, 0xf6, 0x7b, 0xa8, 0xaa, 0xe9, 0xd9, 0xa8, 0x46, 0xf6, 0xfe, 0xfa, 0x74, 0xf9, 0xee, 0x19,
+	0xb3, 0xef, 0x35, 0x6e, 0xdc, 0x6f, 0xcf, 0xb6, 0x28, 0xd6, 0x8e, 0xa2, 0x5b, 0xdb, 0xc6, 0x63, 0xeb, 0x5a, 0x07, 0x16, 0x15, 0x69, 0xcd, 0xf6,
+	0x1a, 0xab, 0xd1, 0xc5, 0xa3, 0xe9, 0x7a, 0x97, 0xf4, 0x2f, 0x95, 0x45, 0x29, 0x8f, 0x96, 0x46, 0xb0, 0x7c, 0x7a, 0xd0, 0x4d, 0x4e, 0xb3, 0xe4,
+	0x4d, 0xbc, 0x7c, 0xdf, 0x9d, 0x2a, 0xeb, 0x53, 0x8c, 0x57, 0xb9, 0x71, 0x2d, 0x23, 0x7d, 0x12, 0x17, 0x9a, 0xa7, 0x9d, 0x78, 0x90, 0xb0, 0x23,
+	0x51, 0xcd, 0x6c, 0x95, 0xd4, 0x53, 0x18, 0xa8, 0xf6, 0x8e, 0x6f, 0x53, 0x8f, 0x54, 0xc5, 0xbc, 0xbb, 0xab, 0x98, 0xed, 0xf7, 0x9e, 0xda, 0x7b,
+	0x55, 0xa2, 0x84, 0x96, 0x3a, 0x4c, 0xef, 0xde, 0xb5, 0xc9, 0x5a, 0xcb, 0x24, 0xac, 0x79, 0xd2, 0x28, 0x54, 0x6d, 0x64, 0xf3, 0x6a, 0xa3, 0x0f,
+	0xd0, 0x03, 0xfc, 0xe3, 0xc7, 0xc6, 0x0d, 0x0b, 0x83, 0xc1, 0xc7, 0x7c, 0xc5, 0xfc, 0x8f, 0x24, 0xe7, 0xb7, 0xc5, 0xfc, 0x6f, 0x56, 0xd0, 0xde,
+	0xcc, 0x0e, 0x8f, 0x5e, 0xb7, 0x5b, 0x89, 0x77, 0x4a, 0x77, 0x63, 0xd5, 0x05, 0x32, 0x77, 0x79, 0xef, 0xde, 0x8e, 0xd1, 0x59, 0x26, 0x50, 0x2b,
+	0xe6, 0xd5, 0x83, 0xfa, 0x6a, 0xf8, 0xdc, 0x69, 0x0e, 0x1c, 0x78, 0xda, 0x1e, 0x17, 0x95, 0xeb, 0x83, 0x0b, 0x43, 0xaa, 0x36, 0xb5, 0x7b, 0xba,
+	0x79, 0x0a, 0x45, 0x8f, 0xb2, 0xcc, 0x98, 0xa1, 0x47, 0xdd, 0x5c, 0x46, 0xfe, 0xfd, 0x77, 0xd9, 0xec, 0xe4, 0x74, 0xd3, 0x3d, 0x9e, 0xea, 0x1c,
+	0xfe, 0xda, 0x8d, 0xc5, 0xc4, 0x22, 0x3a, 0x2c, 0x0a, 0x57, 0x14, 0xbd, 0x5f, 0xaf, 0xaa, 0xb6, 0x48, 0xba, 0x89, 0x5a, 0xab, 0x5f, 0x18, 0xa7,
+	0xb6, 0xca, 0x97, 0xa6, 0xab, 0xbc, 0x81, 0xfd, 0x2e, 0x89, 0x8a, 0xb5, 0x67, 0xe4, 0x60, 0x20, 0xbf, 0x7f, 0x69, 0x56, 0x90, 0x3b, 0xde, 0xe8,
+	0x80, 0x8f, 0x74, 0xd6, 0x49, 0xaf, 0x5c, 0x23, 0x6e, 0xbd, 0xb3, 0xa4, 0x68, 0x58, 0x19, 0xd3, 0x81, 0xba, 0xa1, 0xfa, 0x87, 0xb7, 0xeb, 0xc4,
+	0x28, 0x4d, 0x5f, 0x70, 0x51, 0xbc, 0xca, 0xb2, 0x5c, 0x7f, 0x57, 0xa3, 0xa7, 0x4a, 0x57, 0x9e, 0xde, 0x39, 0xeb, 0x6e, 0x95, 0x61, 0x95, 0xee,
+	0x86, 0x0c, 0xb3, 0x85, 0x19, 0xe6, 0xfa, 0xa9, 0x8c, 0x1d, 0xf6, 0x3b, 0x67, 0xc4, 0xf4, 0xae, 0x4d, 0xd3, 0x9e, 0x61, 0x3c, 0xbf, 0x58, 0x35,
+	0xda, 0x4f, 0xe7, 0x63, 0x12, 0xd4, 0xdb, 0x0b, 0x1f, 0x1a, 0xdc, 0xf3, 0x5f, 0x89, 0x78, 0xba, 0xb5, 0x51, 0xbb, 0xbe, 0x4d, 0x36, 0xa5, 0xe3,
+	0x50, 0x79, 0x59, 0x0f, 0xb5, 0xde, 0xca, 0xae, 0x0e, 0x07, 0x3b, 0xd8, 0xa0, 0x48, 0x0c, 0x41, 0x45, 0x77, 0x9d, 0x99, 0x8d, 0xb9, 0xc6, 0xc6,
+	0x6e, 0x99, 0xd4, 0x9d, 0x45, 0xc3, 0xd9, 0xae, 0xa6, 0x27, 0x5d, 0xb2, 0xef, 0xa3, 0xd5, 0x49, 0xc1, 0x16, 0x95, 0xad, 0x46, 0xee, 0xea, 0xe0,
+	0x51, 0x57, 0x9a, 0xda, 0x8a, 0x33, 0x8e, 0xa7, 0x65, 0xb3, 0xeb, 0xcb, 0x74, 0x4f, 0xa9, 0xcf, 0x3a, 0x49, 0x45, 0x1e, 0x32, 0x5f, 0xa7, 0x0f,
+	0x6b, 0x7e, 0x5c, 0x4d, 0xe4, 0xab, 0x86, 0x2f, 0xd8, 0x59, 0x37, 0xdb, 0x1a, 0xa5, 0x4a, 0xac, 0xb8, 0x0f, 0x67, 0x67, 0xcb, 0x6d, 0xaa, 0x89,
+	0x8b, 0x1b, 0xa9, 0x8b, 0xaa, 0x51, 0x7e, 0xb7, 0xf8, 0x78, 0x0d, 0x28, 0x36, 0x87, 0xf1, 0x6f, 0x9a, 0xab, 0xa6, 0xf4, 0x59, 0x5a, 0x13, 0x42,
+	0xd9, 0x2a, 0x30, 0xb9, 0x5d, 0xce, 0x28, 0xce, 0xdd, 0x60, 0x2d, 0xb6, 0xcb, 0x71, 0xad, 0x11, 0xca, 0xb1, 0xf6, 0xbc, 0x31, 0x8f, 0xf5, 0x8c,
+	0x2a, 0xa6, 0x3c, 0x6e, 0x8f, 0x19, 0x9d, 0x9d, 0x81, 0x6c, 0x66, 0x60, 0x2e, 0x33, 0x6b, 0xbc, 0xe6, 0x8f, 0x7b, 0xdc, 0x3f, 0x64, 0x02, 0xdd,
+	0x66, 0xe6, 0x8c, 0x77, 0x7c, 0x58, 0x37, 0x6d, 0xf6, 0x6e, 0xc6, 0xf9, 0xc1, 0x27, 0xbd, 0xda, 0x44, 0x9b, 0x8b, 0xf5, 0xce, 0x58, 0xe7, 0xbf,
+	0x41, 0xcc, 0x52, 0xb6, 0x80, 0x0a, 0x5a, 0x6e, 0x0e, 0x48, 0xae, 0x0e, 0xab, 0xeb, 0x76, 0x41, 0x8f, 0xf9, 0x06, 0x4f, 0xf9, 0xd3, 0xf7, 0xbf,
+	0x3c, 0x7e, 0xf1, 0xfc, 0xf9, 0x93, 0xc7, 0xaf, 0x9f, 0x7c, 0x3d, 0x9d, 0x9a, 0xc3, 0xe2, 0xcb, 0xcd, 0xd5, 0xb6, 0x79, 0x1b, 0x75, 0x78, 0xf5,
+	0xfa, 0xab, 0xd7, 0x3f, 0xbe, 0x3a, 0x52, 0x29, 0x6b, 0xfd, 0x88, 0x2a, 0xd6, 0x2e, 0x60, 0xca, 0xf5, 0x2c, 0xd5, 0x13, 0xb5, 0x91, 0x6d, 0x97,
+	0x79, 0x75, 0xaf, 0xcf, 0xab, 0xed, 0xe6, 0x57, 0x77, 0xac, 0x2f, 0xaf, 0x15, 0x1e, 0xde, 0xdc, 0x3f, 0xd0, 0x26, 0xc7, 0xbc, 0xe7, 0xa8, 0x00,
+	0x15, 0xb3, 0x59, 0xe1, 0x04, 0xaf, 0x8c, 0xb8, 0x9f, 0x2c, 0xe7, 0xcb, 0x95, 0xd8, 0xa9, 0xee, 0xbf, 0x38, 0xdf, 0x38, 0x5d, 0xf5, 0x38, 0xb9,
+	0xe3, 0xe2, 0x19, 0x74, 0x27, 0xe0, 0x9f, 0xf0, 0xd3, 0x32, 0xfb, 0xc6, 0x29, 0x33, 0x2b, 0x9e, 0x68, 0x7f, 0xda, 0xf5, 0x55, 0x61, 0xae, 0xda,
+	0x7b, 0x54, 0x0c, 0x07, 0x0f, 0xeb, 0x65, 0x56, 0xd5, 0x75, 0x37, 0x34, 0x62, 0xd1, 0x7e, 0xb6, 0xf5, 0xfe, 0x7f, 0xdf, 0x70, 0xad, 0xf8, 0xf0,
+	0x39, 0x31, 0x00, 0x45, 0xbd, 0x4d, 0x1e, 0xac, 0x93, 0xca, 0xe5, 0xa5, 0x39, 0xb0, 0xc3, 0xc1, 0x23, 0xb1, 0xbd, 0x10, 0x7d, 0x7b, 0x9b, 0x3b,
+	0x70, 0x10, 0xd4, 0x1c, 0xb9, 0x1c, 0xe8, 0xea, 0x93, 0xb5, 0xc9, 0x78, 0xb1, 0x78, 0xb3, 0x10, 0xff, 0x5a, 0x4b, 0x80, 0x36, 0x9f, 0x12, 0xf1,
+	0x8d, 0x62, 0xfd, 0xa0, 0x33, 0x71, 0xfe, 0x72, 0xd8, 0x79, 0x37, 0x4b, 0x37, 0xa7, 0x07, 0x1d, 0xd7, 0x91, 0x2f, 0x3b, 0x8a, 0x4c, 0x73, 0x6d,
+	0x17, 0xb0, 0x5e, 0xcd, 0x4e, 0x16, 0xd1, 0xfc, 0xbf, 0xaf, 0x49, 0x47, 0xf5, 0xf5, 0x22, 0x94, 0x6d, 0x9d, 0x5b, 0x58, 0x75, 0x5e, 0x7a, 0xbd,
+	0x49, 0x87, 0x42, 0x28, 0x9e, 0xd6, 0xec, 0xfa, 0xdd, 0x9a, 0x5d, 0xff, 0xeb, 0xfd, 0xa1, 0xe3, 0x1c, 0x58, 0xab, 0x7c, 0x58, 0x0f, 0x06, 0xbe,
+	0x8e, 0x7b, 0x69, 0xdc, 0x7a, 0x2f, 0xf3, 0x40, 0xe4, 0xd9, 0x6c, 0x3e, 0x9f, 0x29, 0x6b, 0x73, 0x86, 0xef, 0xe5, 0x3d, 0x4d, 0xbe, 0x86, 0x3a,
+	0x65, 0x28, 0x3c, 0x9c, 0x16, 0xe7, 0xcc, 0x71, 0xd7, 0xa9, 0xd6, 0x27, 0xfc, 0xed, 0x93, 0x13, 0x75, 0x72, 0xdc, 0xb8, 0xd2, 0x57, 0x67, 0x25,
+	0xfb, 0xad, 0xd3, 0x9e, 0xe3, 0xd4, 0x59, 0xae, 0xa5, 0x0a, 0x7f, 0xfa, 0xb4, 0x9f, 0x25, 0x16, 0x86, 0x74, 0x01, 0xf6, 0x9f, 0x26, 0x46, 0x95,
+	0x78, 0x8d, 0xff, 0x96, 0xf3, 0x5b, 0x1d, 0xdd, 0x02, 0x8a, 0x5f, 0xc7, 0x55, 0x4d, 0xa4, 0x96, 0x97, 0xd5, 0xa5, 0xbb, 0x6a, 0x5e, 0xbf, 0xfe,
+	0xfb, 0xec, 0x6d, 0xa6, 0xe6, 0xde, 0xdc, 0x7c, 0xdd, 0xca, 0x05, 0x49, 0xec, 0x99, 0xed, 0xbc, 0x4c, 0x25, 0x3e, 0x77, 0x53, 0xf2, 0x86, 0xe6,
+	0x4e, 0x7c, 0x66, 0x67, 0x06, 0x57, 0xfd, 0xa5, 0x4f, 0x72, 0x91, 0x51, 0x86, 0xdc, 0x9c, 0xb5, 0xa4, 0x52, 0x39, 0xff, 0xf3, 0x51, 0xb4, 0xea,
+	0x3c, 0x72, 0xfe, 0xf5, 0x72, 0xd6, 0xd9, 0xeb, 0xb8, 0x57, 0xff, 0x6c, 0xed, 0x07, 0xbe, 0x99, 0xaa, 0xa5, 0xda, 0xd7, 0xf7, 0x83, 0x29, 0x24,
+	0x9a, 0x6c, 0xea, 0x9b, 0x19, 0xb0, 0x97, 0xc6, 0x0f, 0xee, 0x07, 0x8e, 0x63, 0x4e, 0x98, 0x83, 0xf7, 0xdd, 0x6a, 0x14, 0xe3, 0x9c, 0x8c, 0xeb,
+	0xe2, 0x9c, 0xb3, 0x75, 0x6a, 0x52, 0x9e, 0xd9, 0xbe, 0x68, 0x58, 0x9e, 0xf1, 0xaa, 0xed, 0xee, 0x37, 0xf6, 0xd7, 0x6d, 0x06, 0x80, 0x29, 0x3e,
+	0x1c, 0xa8, 0xf1, 0xe5, 0x4f, 0x1c, 0x2c, 0xd1, 0xdc, 0x77, 0xa7, 0x53, 0x7b, 0xda, 0x9e, 0xea, 0x56, 0xe5, 0x71, 0xb6, 0xcf, 0xfd, 0xcb, 0x13,
+	0xe3, 0xb5, 0xcb, 0xf3, 0x6e, 0xf3, 0xfc, 0x13, 0x7d, 0xde, 0x6b, 0x9c, 0x9f, 0xe0, 0xfc, 0x9d, 0xeb, 0x7a, 0xfc, 0x1a, 0xaf, 0xdf, 0x9b, 0x3d,
+	0xb0, 0x19, 0xfe, 0x15, 0x87, 0xcc, 0x32, 0x93, 0x8d, 0x22, 0x9e, 0x67, 0x9b, 0x77, 0xcb, 0xd5, 0x9b, 0x96, 0x30, 0xe2, 0x8f, 0x1e, 0xb9, 0xd5,
+	0x9d, 0x3e, 0xa3, 0xbf, 0xd9, 0x15, 0xf7, 0x2b, 0x67, 0xb3, 0xa6, 0x87, 0xfd, 0x64, 0x13, 0xc4, 0xeb, 0xd4, 0x43, 0x0d, 0xbc, 0x64, 0xe3, 0x36,
+	0x74, 0x21, 0xe9, 0x6a, 0x70, 0x51, 0xbd, 0xfc, 0xab, 0x81, 0x02, 0x78, 0x3f, 0x47, 0x79, 0xaa, 0xf6, 0x68, 0x22, 0x69, 0x3e, 0x96, 0xb8, 0x3a,
+	0xac, 0x1a, 0x55, 0x0d, 0xe4, 0xe4, 0xfa, 0x55, 0xfe, 0x05, 0xaf, 0xb1, 0xcf, 0x02, 0xae, 0xcf, 0xca, 0x4c, 0x66, 0x23, 0xa8, 0xad, 0xa6, 0x33,
+	0x76, 0xaa, 0xb4, 0x37, 0x3e, 0xf6, 0x7d, 0x20, 0x94, 0xd1, 0x0d, 0x66, 0x4d, 0xaf, 0x39, 0xb7, 0x92, 0x93, 0x05, 0xe8, 0x54, 0xb7, 0x5b, 0xff,
+	0x79, 0x23, 0x6f, 0xad, 0x6f, 0xfb, 0xed, 0x2c, 0x4d, 0xb3, 0x02, 0xe2, 0x56, 0xa6, 0x1c, 0xc5, 0xfb, 0x7b, 0xcb, 0x85, 0x02, 0xdd, 0x2a, 0x6b,
+	0xd5, 0x2c, 0xf5, 0x26, 0xac, 0xca, 0x2f, 0xb9, 0x5c, 0xdb, 0xd6, 0xe6, 0xfc, 0xce, 0x4c, 0x57, 0x59, 0xed, 0x69, 0x80, 0xcd, 0xa8, 0xbe, 0x68,
+	0x51, 0xd6, 0xec, 0xfb, 0xd9, 0x9a, 0xab, 0x02, 0xdd, 0x66, 0x8d, 0xfa, 0xa5, 0x67, 0x58, 0x94, 0xe7, 0xcc, 0xb2, 0x44, 0x59, 0xd1, 0xfe, 0x65,
+	0x75, 0x02, 0x59, 0xb6, 0x3e, 0x22, 0xbb, 0xda, 0x55, 0x50, 0xb9, 0xad, 0x3d, 0xa1, 0x34, 0x4a, 0x3c, 0x40, 0x63, 0x59, 0xe5, 0x3e, 0x2d, 0xef,
+	0x79, 0xa4, 0x6a, 0x63, 0x36, 0x92, 0x99, 0xa7, 0x07, 0x55, 0x3a, 0x5d, 0x22, 0x4c, 0xcd, 0xea, 0xce, 0x7a, 0x4e, 0xae, 0x50, 0x10, 0xf3, 0x66,
+	0x64, 0x75, 0x69, 0x63, 0x2a, 0xd5, 0x2b, 0x67, 0xd6, 0xb3, 0xd4, 0x11, 0x3b, 0xa2, 0xcb, 0x02, 0x1f, 0x5e, 0xdf, 0x14, 0xdd, 0xb6, 0x76, 0x5f,
+	0x65, 0x67, 0xcb, 0xb7, 0x59, 0x7b, 0xd3, 0xd7, 0x46, 0x37, 0x92, 0xff, 0x49, 0xc3, 0x1b, 0xf7, 0x2a, 0xec, 0xa2, 0x9a, 0x5c, 0xf5, 0xd6, 0x5c,
+	0x5f, 0x67, 0xe2, 0xd4, 0x65, 0x68, 0xb9, 0x3b, 0x7f, 0xde, 0x7a, 0xed, 0x3a, 0x89, 0x16, 0x1d, 0x19, 0xb6, 0x32, 0x76, 0xa2, 0x55, 0xfc, 0xc1,
+	0xbc, 0x14, 0x74, 0x93, 0xad, 0xd6, 0x37, 0x2e, 0xe3, 0xd2, 0xd2, 0xc8, 0xc5, 0xf1, 0xc5, 0x66, 0x23, 0xf8, 0x75, 0x8b, 0x32, 0x56, 0xa9, 0x75,
+	0x29, 0x1f, 0xe1, 0x48, 0xb7, 0x91, 0xa4, 0x51, 0xca, 0x66, 0x92, 0x9a, 0x99, 0x36, 0xc7, 0x77, 0x3d, 0x41, 0x6e, 0xb8, 0x94, 0x32, 0x0f, 0x55,
+	0x34, 0xe8, 0xb8, 0xf0, 0xa8, 0x98, 0xd7, 0x2c, 0x37, 0xd1, 0xfc, 0x95, 0x1c, 0x17, 0x3b, 0xa3, 0x0c, 0x12, 0x07, 0xe2, 0x4e, 0xe3, 0x51, 0x7f,
+	0x08, 0xdb, 0x92, 0xed, 0x2d, 0x6a, 0x78, 0xed, 0x43, 0xdb, 0xc6, 0x78, 0x41, 0x01, 0x7a, 0xfd, 0xdd, 0x25, 0x54, 0x0d, 0xa3, 0x8d, 0x5c, 0xf9,
+	0x14, 0xd1, 0x16, 0x72, 0xab, 0xc8, 0x66, 0xf7, 0xe3, 0xcd, 0x25, 0xae, 0x5e, 0x91, 0xb7, 0x7b, 0x74, 0x99, 0x8d, 0x82, 0xfb, 0xfb, 0xfb, 0xdd,
+	0xdd, 0x45, 0xaf, 0x3d, 0x0a, 0xaf, 0x4a, 0xdb, 0xeb, 0x2b, 0x53, 0xd8, 0x56, 0x2b, 0xc9, 0xf9, 0x07, 0xee, 0x39, 0xac, 0x1c, 0x01, 0xb7, 0x8e,
+	0x5e, 0x36, 0xba, 0xd0, 0xee, 0x19, 0xc5, 0x13, 0xc2, 0x8f, 0x88, 0x07, 0x9d, 0x07, 0xdb, 0x89, 0xec, 0x65, 0xab, 0xec, 0xdf, 0x2f, 0xb2, 0xf5,
+	0xc6, 0xde, 0xb8, 0xe7, 0x5c, 0x57, 0x8c, 0x7a, 0x5a, 0x2d, 0x82, 0xc2, 0xc6, 0x7f, 0x12, 0xec, 0xd9, 0x59, 0xb4, 0x48, 0xcd, 0xae, 0x16, 0xfb,
+	0xb1, 0x68, 0x84, 0x96, 0x43, 0xfb, 0xb3, 0x29, 0x5f, 0x09, 0xaf, 0xdb, 0xc4, 0xa6, 0xe9, 0xd9, 0xbf, 0xd7, 0xf4, 0xf5, 0x72, 0xb1, 0xdb, 0x41,
+	0x14, 0x8b, 0xef, 0x45, 0xbd, 0x4a, 0x43, 0x5c, 0x3c, 0x98, 0x54, 0x2d, 0xf1, 0xb0, 0x57, 0x96, 0x07, 0x1b, 0x90, 0xdd, 0x7e, 0x7b, 0xdb, 0x6c,
+	0xa7, 0xaa, 0xbd, 0xd1, 0xe1, 0xf6, 0x83, 0x7f, 0x95, 0xe5, 0xd2, 0x3f, 0xa7, 0x37, 0x3c, 0x58, 0xda, 0xdd, 0x0b, 0xd7, 0x3a, 0xc6, 0xc6, 0xb0,
+	0x6b, 0x6b, 0x83, 0x9d, 0x59, 0xff, 0x4e, 0xe2, 0xc0, 0xa6, 0xc5, 0xf4, 0xad, 0xd9, 0xc1, 0x9f, 0xfe, 0x39, 0x8b, 0x4b, 0xc5, 0xdd, 0x0a, 0x0b,
+	0x3e, 0xdb, 0xcc, 0x33, 0x8a, 0xed, 0xed, 0x89, 0xfd, 0xd7, 0xe6, 0x50, 0xcb, 0x22, 0x8f, 0x39, 0xdc, 0xc4, 0xdf, 0xcd, 0xf2, 0xe4, 0x64, 0x9e,
+	0xfd, 0xc4, 0x8d, 0x89, 0x37, 0x19, 0xd6, 0x32, 0x0f, 0x7b, 0x9e, 0xfb, 0x19, 0xeb, 0xb7, 0x67, 0x56, 0xd7, 0xe5, 0x62, 0x77, 0x41, 0xda, 0x65,
+	0x87, 0xf2, 0xc2, 0xaa, 0x53, 0x74, 0x99, 0xd4, 0xe6, 0xca, 0xa8, 0x30, 0x62, 0x55, 0x06, 0x0a, 0x1e, 0x78, 0x51, 0xaf, 0xcb, 0xcb, 0x5e, 0x9c,
+	0x83, 0x1a, 0x54, 0xa9, 0xa3, 0xd5, 0xca, 0x6c, 0xbd, 0x6c, 0xa4, 0xff, 0xca, 0x1c, 0xff, 0xda, 0x2c, 0x3b, 0xee, 0x28, 0x8d, 0x8c, 0xa7, 0xad,
+	0xd5, 0x9c, 0xd6, 0x92, 0x14, 0x35, 0xdc, 0x59, 0x2b, 0x26, 0x68, 0xcb, 0xa5, 0xb8, 0x43, 0xe3, 0x62, 0x74, 0xe5, 0x9f, 0x33, 0xae, 0x70, 0x2b,
+	0x3b, 0xa8, 0xd0, 0x54, 0xb7, 0xc9, 0x43, 0xb5, 0xa9, 0x1d, 0x9d, 0xe6, 0xc0, 0x0e, 0xb8, 0x40, 0xe2, 0xcf, 0xbc, 0x84, 0x7c, 0xcd, 0xba, 0x68,
+	0xb9, 0x1c, 0xbc, 0x35, 0x52, 0x3f, 0x37, 0x46, 0xf2, 0x2e, 0x5d, 0x6b, 0x2c, 0x5e, 0x47, 0xf1, 0x67, 0x8f, 0xcb, 0xcc, 0x3d, 0x0a, 0x9a, 0xb2,
+	0x4f, 0x6f, 0x55, 0x9c, 0x83, 0x70, 0xec, 0xea, 0xd0, 0x24, 0xaa, 0x0f, 0x72, 0x39, 0x52, 0x1b, 0x9c, 0x56, 0xdb, 0x59, 0x66, 0x01, 0x43, 0x4f,
+	0x9f, 0xc7, 0x77, 0xe1, 0x94, 0x39, 0x16, 0x82, 0xf6, 0xea, 0x00, 0x62, 0x09, 0xda, 0x89, 0x82, 0xfd, 0x8f, 0xba, 0x16, 0xfe, 0xbb, 0xc7, 0xd3,
+	0x22, 0xcf, 0xbf, 0x76, 0xbb, 0x07, 0x4a, 0x38, 0x58, 0xbc, 0x3a, 0xe7, 0x36, 0x6b, 0x6c, 0x48, 0xb9, 0x55, 0xeb, 0xce, 0x6b, 0xa7, 0xbb, 0x47,
+	0x5f, 0xd5, 0xbb, 0x7b, 0xb7, 0xba, 0x49, 0xe7, 0x95, 0xfd, 0x68, 0x84, 0x40, 0xf5, 0x0c, 0xda, 0x07, 0x4f, 0x71, 0xf6, 0xfa, 0x85, 0x82, 0x01,
+	0x29, 0x60, 0xc7, 0x8a, 0x1e, 0x72, 0xe8, 0x37, 0x5b, 0xba, 0xb1, 0x8a, 0xa0, 0x5e, 0x22, 0x74, 0x54, 0xeb, 0xb4, 0xe3, 0x96, 0xd0, 0xa8, 0xac,
+	0x49, 0x75, 0xdb, 0xc6, 0x55, 0x8d, 0xe6, 0xd6, 0x4d, 0x5c, 0x1f, 0x16, 0xba, 0x19, 0xab, 0xd0, 0xf7, 0xb7, 0xdd, 0xa4, 0x18, 0xe2, 0x45, 0x5c,
+	0xf2, 0xd9, 0x97, 0x6c, 0x3f, 0xac, 0x37, 0xd9, 0xd9, 0x56, 0x14, 0xa4, 0x3c, 0x52, 0x71, 0x46, 0x7b, 0xa4, 0x41, 0xb7, 0x3b, 0xe8, 0xbe, 0xf8,
+	0xae, 0x7b, 0x0b, 0xcf, 0x64, 0x0f, 0x24, 0xb7, 0x0b, 0x7e, 0x90, 0xb0, 0xb6, 0x36, 0x9f, 0x94, 0x51, 0x4f, 0xf3, 0x2e, 0x49, 0x19, 0x99, 0xf0,
+	0xba, 0x4f, 0xbb, 0xcb, 0x35, 0xb7, 0x62, 0x82, 0xc6, 0xcd, 0xf6, 0x6b, 0x77, 0x2c, 0x5d, 0xd6, 0x75, 0x03, 0xc5, 0x5e, 0xb8, 0x2b, 0xc9, 0xd5,
+	0x61, 0xd9, 0xbc, 0x0a, 0xda, 0x2b, 0x9d, 0x6b, 0x23, 0x64, 0x1a, 0x9c, 0x6e, 0xce, 0xe6, 0x85, 0x0d, 0x29, 0x9b, 0xa5, 0x6d, 0x14, 0xdd, 0x5c,
+	0x4a, 0xac, 0x14, 0x9b, 0xfc, 0xea, 0x5e, 0x98, 0xee, 0x60, 0xb6, 0x58, 0x64, 0xab, 0x6f, 0x5f, 0x3f, 0xfb, 0xde, 0xa4, 0x93, 0x00, 0xe4, 0xf5,
+	0xec, 0x2c, 0x93, 0xa0, 0xb7, 0xd7, 0x2b, 0x65, 0x36, 0x3b, 0x92, 0x97, 0xba, 0xd9, 0x81, 0x53, 0x03, 0xdd, 0x5a, 0xf2, 0x56, 0xa1, 0xed, 0x9d,
+	0x5b, 0x34, 0x58, 0x2d, 0x08, 0x32, 0xda, 0x9b, 0x28, 0x99, 0x6d, 0x3e, 0xf4, 0x9c, 0x7d, 0xf3, 0x4a, 0xc2, 0xb6, 0xc6, 0x3c, 0x9d, 0xa5, 0xd9,
+	0x4f, 0xd1, 0x6c, 0x53, 0xdb, 0x7f, 0x54, 0x56, 0xf8, 0xba, 0x5b, 0x19, 0x09, 0x16, 0x3e, 0x59, 0x2d, 0xee, 0x35, 0x6d, 0x79, 0x6d, 0x57, 0x5c,
+	0x5b, 0x70, 0x17, 0x61, 0xd3, 0x8e, 0x41, 0xd0, 0x28, 0x77, 0x3d, 0x6e, 0xbe, 0xa6, 0x57, 0x3f, 0xb1, 0xe0, 0xbb, 0x1a, 0xe2, 0x86, 0xf6, 0x6e,
+	0x2d, 0xf8, 0xf2, 0xcd, 0x2e, 0x19, 0xf7, 0x1f, 0x33, 0x65, 0x7e, 0x4f, 0x4b, 0x1f, 0x6e, 0x19, 0xb3, 0x3f, 0x0b, 0x5a, 0x3e, 0xef, 0xf3, 0xfe,
+	0xeb, 0x1f, 0xdc, 0xe3, 0xf3, 0xed, 0x97, 0x9f, 0x6e, 0x58, 0x7a, 0x6a, 0x8b, 0x4b, 0xff, 0xdf, 0xff, 0xf3, 0xff, 0xa8, 0x9f, 0x2d, 0xfc, 0x7d,
+	0xaf, 0x21, 0xc9, 0x7b, 0xa3, 0x16, 0x2d, 0xda, 0x4b, 0x5d, 0x2c, 0x38, 0x59, 0xbd, 0x01, 0xe4, 0x2d, 0x2c, 0xc1, 0x67, 0x77, 0x84, 0xea, 0x5e,
+	0xdd, 0xdb, 0x3f, 0xe5, 0x60, 0xa9, 0xcb, 0xa7, 0x5a, 0xb7, 0x6a, 0xe3, 0x32, 0x75, 0xad, 0x9d, 0xcb, 0xa3, 0x3b, 0x3a, 0xb4, 0xba, 0xac, 0xd0,
+	0x77, 0xcf, 0x56, 0xc9, 0xfc, 0x56, 0x0f, 0xa9, 0x98, 0x52, 0xdf, 0xed, 0x31, 0x8e, 0x74, 0xf8, 0xe7, 0xc5, 0x37, 0xdf, 0xec, 0xb8, 0x27, 0x2f,
+	0xc4, 0xb3, 0x49, 0xd5, 0x3c, 0xd7, 0x71, 0x58, 0x56, 0x0f, 0xf8, 0x6d, 0x7c, 0x58, 0xef, 0xd0, 0xdd, 0x5b, 0xa0, 0xea, 0xaa, 0xdf, 0xff, 0x0e,
+	0x92, 0x12, 0xd5, 0xac, 0xb7, 0x94, 0x08, 0xd6, 0x36, 0x3b, 0x38, 0xed, 0xbb, 0x78, 0xca, 0x76, 0xbe, 0xd5, 0x5e, 0x98, 0xf6, 0xf4, 0xb7, 0xda,
+	0x1a, 0x57, 0xee, 0x38, 0xd8, 0xda, 0x4d, 0xd2, 0x96, 0x61, 0xdb, 0x76, 0x92, 0xba, 0xfe, 0x83, 0xaf, 0x3f, 0x2d, 0x77, 0xed, 0xb5, 0x65, 0xd2,
+	0xba, 0xff, 0xa3, 0x3d, 0x69, 0xfb, 0xf6, 0x0a, 0x0e, 0xc4, 0x9f, 0xbe, 0xff, 0xe5, 0xe9, 0xd7, 0xdf, 0x3f, 0xf9, 0x85, 0x7a, 0x3a, 0x69, 0x46,
+	0x7b, 0xb0, 0xd2, 0x53, 0xfa, 0x1c, 0xb0, 0x3c, 0x6f, 0xee, 0x40, 0xe5, 0x5d, 0xfd, 0x42, 0xf1, 0x3a, 0xb3, 0xd4, 0x44, 0xfc, 0xf6, 0xac, 0x2b,
+	0x07, 0xc4, 0x7b, 0xe5, 0xb3, 0x93, 0x8b, 0x55, 0x96, 0x76, 0x5e, 0xbd, 0x7a, 0xfa, 0x75, 0x27, 0x89, 0x16, 0x8b, 0x25, 0x5e, 0x7d, 0x29, 0x23,
+	0x2c, 0x39, 0x35, 0x8b, 0x4e, 0x36, 0xb5, 0x27, 0xa9, 0xcd, 0x52, 0xa2, 0x59, 0xfd, 0x3c, 0x97, 0xbb, 0xa9, 0x53, 0xba, 0x28, 0xcc, 0x73, 0xc1,
+	0x60, 0xa2, 0x48, 0x10, 0xc8, 0xd1, 0x73, 0x19, 0x92, 0xef, 0x96, 0xab, 0xb4, 0x83, 0xf7, 0x71, 0x26, 0xcb, 0xd5, 0xca, 0x48, 0xa4, 0x8b, 0x14,
+	0xc3, 0xea, 0x3a, 0xf3, 0x42, 0xbf, 0xf9, 0x72, 0x5d, 0x9d, 0x0b, 0xe5, 0x9c, 0xcc, 0x35, 0x95, 0x2d, 0xc2, 0xea, 0x7f, 0xbc, 0xfc, 0xe9, 0x95,
+	0x09, 0x6c, 0xf1, 0xc1, 0xfe, 0xc8, 0x67, 0xd7, 0xeb, 0xa4, 0x8f, 0xba, 0x03, 0x4f, 0xa2, 0xb0, 0xda, 0x61, 0x1f, 0x87, 0xfd, 0xed, 0xc3, 0x01,
+	0x0e, 0x07, 0xdb, 0x87, 0x87, 0x38, 0x3c, 0xdc, 0x3e, 0x1c, 0xe2, 0x70, 0xb8, 0x7d, 0x78, 0x84, 0xc3, 0xa3, 0xed, 0xc3, 0x63, 0x1c, 0x1e, 0x6f,
+	0x1f, 0x9e, 0xe0, 0xf0, 0x64, 0xfb, 0xb0, 0xeb, 0xe0, 0xb8, 0xeb, 0x34, 0x4e, 0xb8, 0x3c, 0xe1, 0x36, 0x4e, 0xb0, 0xaa, 0x6e, 0xa3, 0xae, 0x2e,
+	0x2b, 0xeb, 0x36, 0x6a, 0xeb, 0xb2, 0xba, 0x6e, 0xa3, 0xbe, 0x2e, 0x2b, 0xec, 0x36, 0x6a, 0xec, 0xb2, 0xca, 0x6e, 0xa3, 0xce, 0x2e, 0x2b, 0xed,
+	0x36, 0x6a, 0xed, 0xb2, 0xda, 0x6e, 0xa3, 0xde, 0x2e, 0x2b, 0xee, 0x36, 0x6a, 0xee, 0xb1, 0xe6, 0x9e, 0xa9, 0x39, 0x06, 0xf1, 0x37, 0x5f, 0x3d,
+	0x46, 0xbf, 0xe2, 0x83, 0x79, 0xcf, 0x85, 0xb4, 0xbc, 0x69, 0x76, 0x7b, 0xc0, 0x35, 0x07, 0x46, 0xa6, 0xc1, 0xed, 0x01, 0xcf, 0x1c, 0x18, 0x9b,
+	0xa6, 0xb6, 0x07, 0x7c, 0x73, 0x60, 0x62, 0x1a, 0xd9, 0x1e, 0x08, 0xcc, 0x01, 0xd7, 0x41, 0xf3, 0xda, 0x43, 0x43, 0x1c, 0x72, 0xd1, 0xb0, 0xf6,
+	0x50, 0x88, 0x43, 0x1e, 0x9a, 0x94, 0x25, 0x79, 0xc4, 0x01, 0x66, 0xfe, 0xb2, 0x1c, 0xa3, 0xb1, 0xe3, 0x74, 0xbe, 0xfd, 0x0f, 0xb9, 0xb9, 0x7c,
+	0xb0, 0x27, 0x5c, 0x66, 0x1e, 0xd8, 0x33, 0xf8, 0x64, 0x4f, 0xa1, 0x64, 0xee, 0x30, 0x2c, 0x4e, 0x99, 0x4f, 0xf6, 0x14, 0xca, 0xe8, 0x39, 0x45,
+	0x7e, 0xf8, 0x64, 0x4f, 0xa1, 0xb4, 0xbe, 0xeb, 0x0d, 0x79, 0x0a, 0x9f, 0xec, 0x29, 0x94, 0x3a, 0x70, 0x47, 0xf6, 0x2a, 0x7c, 0xb2, 0xa7, 0x50,
+	0xfa, 0x50, 0x92, 0xf2, 0x14, 0x3e, 0xd9, 0x53, 0x23, 0x56, 0xcc, 0xa8, 0xda, 0x58, 0x0e, 0x7c, 0xb4, 0x27, 0xc7, 0x28, 0x88, 0x39, 0x60, 0x4b,
+	0x82, 0x8f, 0x6c, 0x80, 0xc7, 0x3f, 0x7c, 0xf5, 0x1a, 0x2d, 0x80, 0x0f, 0x6c, 0x82, 0xa1, 0x99, 0x18, 0xf6, 0x80, 0x5b, 0xf5, 0x0d, 0x0f, 0x78,
+	0x55, 0xdf, 0xf0, 0x80, 0x5f, 0xf5, 0x8d, 0xc9, 0xf0, 0xfb, 0xe5, 0xc9, 0xec, 0xb3, 0xb3, 0x11, 0x6e, 0x52, 0x5b, 0x2b, 0xbf, 0x4d, 0x1e, 0x58,
+	0x30, 0xde, 0xb1, 0x38, 0x6a, 0xd7, 0xc0, 0x35, 0x47, 0x7e, 0x95, 0x9e, 0xcd, 0x16, 0xb3, 0xf5, 0x86, 0x6f, 0x68, 0x13, 0x7b, 0x25, 0xf7, 0x3c,
+	0xe8, 0x5e, 0xb3, 0x84, 0x5e, 0xee, 0xbc, 0x2b, 0x5e, 0x6c, 0x72, 0x9b, 0xc7, 0xab, 0x45, 0xe2, 0x1a, 0xfa, 0x15, 0x07, 0x77, 0xdc, 0x4d, 0xbd,
+	0x04, 0x85, 0x1b, 0xcc, 0xde, 0x4b, 0xc8, 0xb1, 0x40, 0x31, 0x6f, 0x73, 0x4f, 0x95, 0xbc, 0xd6, 0x1c, 0x55, 0xe5, 0xbb, 0xcd, 0x84, 0xd7, 0x35,
+	0x0d, 0x7e, 0xf3, 0x37, 0x8f, 0x92, 0x6c, 0x47, 0x79, 0x55, 0x3e, 0xb6, 0x08, 0x17, 0x6b, 0xfb, 0x46, 0xc7, 0x02, 0x81, 0xec, 0x3a, 0x8e, 0x39,
+	0xde, 0x1d, 0xd8, 0x1d, 0x58, 0xdd, 0xae, 0x7e, 0xa5, 0xbe, 0x39, 0xd5, 0xd8, 0xc7, 0x63, 0xe4, 0x61, 0xfe, 0x74, 0x5a, 0xed, 0xbc, 0xb3, 0xbb,
+	0xf3, 0x6e, 0x06, 0x7b, 0x64, 0x57, 0xf1, 0x4b, 0xe1, 0xba, 0xda, 0x0a, 0x65, 0xce, 0x75, 0x07, 0xa5, 0x77, 0xdb, 0x2e, 0x58, 0x71, 0xfc, 0x0f,
+	0x2c, 0x5c, 0x99, 0x65, 0x55, 0x40, 0xa2, 0xc3, 0xa3, 0x5b, 0x07, 0x4e, 0x3a, 0x7d, 0x33, 0x7c, 0x32, 0xbf, 0x95, 0xb6, 0x28, 0x77, 0x5f, 0xd5,
+	0xd2, 0xd6, 0x3a, 0x9a, 0x67, 0x3a, 0xa6, 0xb1, 0x3a, 0x5f, 0x76, 0xca, 0x16, 0x68, 0xb9, 0xcc, 0x2c, 0x10, 0x6c, 0x3d, 0x38, 0xac, 0x9d, 0x6f,
+	0x79, 0x3c, 0xf5, 0x3c, 0x7b, 0xf7, 0xa3, 0xe9, 0x85, 0x9b, 0x9e, 0x4f, 0xe9, 0x7c, 0x0a, 0x04, 0xe6, 0xa5, 0x6d, 0xbd, 0x65, 0x0e, 0x5d, 0x33,
+	0x8c, 0xec, 0x95, 0xbb, 0x85, 0x3c, 0xb5, 0x54, 0x7f, 0x5c, 0x97, 0xaa, 0xfb, 0x6e, 0x8d, 0x1b, 0xf7, 0x77, 0x8c, 0x39, 0xf7, 0x86, 0x7a, 0x54,
+	0xe9, 0xfe, 0xf8, 0xc1, 0xe9, 0xb6, 0xd4, 0xc5, 0x6b, 0xab, 0xcb, 0x2a, 0x3b, 0x97, 0x51, 0x7a, 0x8b, 0xda, 0x78, 0xb7, 0xac, 0x8d, 0xf7, 0x19,
+	0x6a, 0xe3, 0xa9, 0xda, 0x2c, 0xdf, 0xdc, 0x7e, 0x9e, 0x15, 0x69, 0x77, 0x2e, 0x51, 0x94, 0x09, 0x6a, 0x13, 0x6b, 0xae, 0x3c, 0x58, 0x99, 0xa2,
+	0x36, 0x47, 0x90, 0xe2, 0xc6, 0xb9, 0x51, 0x5c, 0x5b, 0x57, 0x14, 0x7d, 0x82, 0xf8, 0xe8, 0x7a, 0x0f, 0x50, 0x24, 0xaa, 0x95, 0xfd, 0x5d, 0x36,
+	0x97, 0x00, 0x21, 0xbb, 0x5e, 0x6d, 0x54, 0x3c, 0x4b, 0x34, 0xef, 0x9f, 0x2f, 0x5f, 0xf6, 0xf0, 0xeb, 0x7c, 0x96, 0xaa, 0xaf, 0xeb, 0x0f, 0x8b,
+	0xe4, 0xe9, 0xd7, 0x45, 0xcc, 0x98, 0x99, 0xb7, 0x56, 0xaf, 0x21, 0xdb, 0x81, 0x7f, 0xaf, 0xfd, 0x20, 0xc1, 0xac, 0xa9, 0xf5, 0x6b, 0x2d, 0x9b,
+	0xc9, 0xb2, 0xae, 0x5d, 0xb1, 0xe2, 0x87, 0x7f, 0xfb, 0xfe, 0xe9, 0xd7, 0x18, 0x05, 0xdb, 0x79, 0xd7, 0x6c, 0xd1, 0x76, 0x78, 0x69, 0xac, 0xda,
+	0x74, 0xb7, 0xb1, 0xbb, 0xbb, 0xf3, 0xd4, 0x4d, 0xc6, 0xc6, 0x24, 0xdb, 0x7a, 0x4e, 0x76, 0xed, 0xa4, 0xbe, 0x2e, 0xbd, 0x77, 0x73, 0x7a, 0xbe,
+	0xeb, 0xd6, 0x14, 0xd0, 0xf4, 0xb1, 0x3d, 0xbb, 0x7c, 0x23, 0xe7, 0x5b, 0x07, 0xa2, 0x6e, 0xd2, 0x66, 0xda, 0x1d, 0xa3, 0x16, 0x09, 0x55, 0x83,
+	0xa8, 0xb1, 0x7b, 0x70, 0xcd, 0x88, 0xde, 0xe9, 0x7c, 0x78, 0xe3, 0xc4, 0x3c, 0xd5, 0x9d, 0xcb, 0xcd, 0x77, 0xb9, 0xa2, 0x66, 0x8f, 0x4a, 0xe0,
+	0x6e, 0x7a, 0xbb, 0xea, 0x4b, 0x33, 0xec, 0xec, 0xa0, 0xc1, 0x08, 0x34, 0xff, 0xd4, 0x46, 0x60, 0x79, 0x6a, 0x7f, 0x7e, 0xff, 0x6b, 0x99, 0x2f,
+	0xfb, 0x0b, 0x31, 0x5e, 0x6d, 0x83, 0xe5, 0x64, 0x3b, 0x6b, 0x0e, 0x13, 0xe4, 0x2a, 0x31, 0x39, 0xb2, 0x88, 0x55, 0x76, 0x31, 0x0f, 0xcd, 0xa7,
+	0xea, 0x6e, 0x7b, 0xea, 0x0e, 0x76, 0x95, 0x02, 0x05, 0x6a, 0xde, 0x4d, 0x0d, 0xdd, 0x96, 0xd7, 0x03, 0x2c, 0xd2, 0x1f, 0x78, 0xbe, 0xd7, 0xfd,
+	0x72, 0x4d, 0x93, 0xca, 0x17, 0x04, 0xf0, 0xce, 0x65, 0x33, 0xb7, 0xd5, 0x83, 0x89, 0x6a, 0x0a, 0xac, 0xf3, 0xe5, 0x62, 0x6d, 0x7f, 0xc8, 0xa6,
+	0xf8, 0xc6, 0x29, 0x69, 0x6f, 0x08, 0x60, 0xe2, 0x36, 0xfc, 0x5e, 0x1b, 0xfd, 0x34, 0x4f, 0x15, 0xa3, 0x7f, 0xf7, 0x45, 0xee, 0x35, 0xe7, 0xbc,
+	0x96, 0x73, 0xb6, 0x67, 0xab, 0xe2, 0xde, 0xc6, 0x4a, 0xa9, 0x87, 0x3e, 0xad, 0x09, 0x51, 0xc9, 0x8e, 0x35, 0x1c, 0x83, 0xce, 0x66, 0xf5, 0xc1,
+	0x18, 0x90, 0xe8, 0x24, 0x9a, 0x2d, 0x68, 0x46, 0xd4, 0xe3, 0xa6, 0x6d, 0x8b, 0xa2, 0x9a, 0x79, 0xe0, 0x7d, 0xe1, 0x4a, 0x58, 0x85, 0xe7, 0x10,
+	0x8d, 0xe6, 0x7e, 0xd3, 0xae, 0xe5, 0x2b, 0x07, 0x4a, 0xf5, 0xad, 0xcd, 0x98, 0xd8, 0x1e, 0xb0, 0xaf, 0xb4, 0xa8, 0x3d, 0xc6, 0xc2, 0x9c, 0x82,
+	0xe6, 0xae, 0x79, 0xd7, 0xe2, 0xb5, 0x1c, 0x5b, 0x21, 0x19, 0x87, 0x2c, 0x08, 0xbc, 0xea, 0x58, 0xbb, 0x6c, 0x26, 0xd6, 0xf0, 0xfb, 0xe5, 0xbb,
+	0x6c, 0xf5, 0x38, 0x5a, 0x17, 0x6f, 0xf3, 0x30, 0xfd, 0x31, 0xad, 0x77, 0x75, 0xb1, 0xc6, 0x66, 0x17, 0xe0, 0x66, 0x29, 0x4c, 0x67, 0xaf, 0xdb,
+	0xbd, 0x3b, 0x35, 0x99, 0xf1, 0x84, 0xf9, 0x54, 0x3c, 0x36, 0x2c, 0x13, 0xc1, 0x24, 0x15, 0x3f, 0x48, 0x00, 0x4a, 0x53, 0x70, 0x5f, 0xbc, 0xa0,
+	0x43, 0x5d, 0xa9, 0xee, 0xf1, 0xd2, 0x94, 0x03, 0xf7, 0x30, 0xe5, 0xa8, 0xca, 0x56, 0xbb, 0x87, 0x49, 0x54, 0xbb, 0xc7, 0x16, 0xb2, 0x96, 0x55,
+	0x28, 0xee, 0xa5, 0x72, 0x28, 0x66, 0x63, 0xaf, 0x2c, 0xed, 0xbd, 0x7b, 0x65, 0xa6, 0x6d, 0x93, 0xa8, 0x68, 0xdf, 0x1d, 0xbe, 0xa3, 0x6a, 0xe1,
+	0x62, 0x22, 0x5c, 0xdf, 0xc8, 0xee, 0x74, 0x6b, 0x6e, 0xe8, 0x66, 0x36, 0x47, 0xbd, 0xe9, 0xd6, 0x04, 0xf9, 0xe3, 0xfb, 0xa1, 0x28, 0xe9, 0xcd,
+	0x5d, 0xe1, 0x56, 0x7d, 0xe1, 0x36, 0x3a, 0xc3, 0xad, 0x7a, 0xc3, 0xbd, 0x4d, 0x77, 0xb8, 0x6d, 0xfd, 0xe1, 0x6e, 0xdd, 0xd1, 0xab, 0xee, 0xe8,
+	0x35, 0xee, 0xe8, 0x55, 0x77, 0xf4, 0x6e, 0x73, 0x47, 0xaf, 0xed, 0x8e, 0xde, 0xf6, 0x70, 0xab, 0x6a, 0xa1, 0x86, 0x82, 0x67, 0x9e, 0x68, 0x56,
+	0x03, 0xe3, 0x52, 0x8d, 0x4e, 0x76, 0xe3, 0x8e, 0x22, 0xde, 0x30, 0x42, 0xd7, 0xb7, 0x69, 0x93, 0xfe, 0x2d, 0x6a, 0x01, 0x6d, 0xe8, 0x5d, 0x55,
+	0xc0, 0xad, 0x6c, 0x8d, 0x7c, 0xb7, 0x7c, 0x4d, 0x50, 0x95, 0x53, 0x71, 0xf8, 0xaa, 0x78, 0x13, 0xd3, 0xad, 0xe7, 0x81, 0x7d, 0xe5, 0x45, 0x73,
+	0x65, 0x7e, 0x96, 0xd2, 0xf4, 0xe8, 0xd7, 0x05, 0xd1, 0x1a, 0xe9, 0x41, 0x5b, 0x4c, 0x9f, 0x5a, 0x2a, 0x7b, 0xb0, 0xd7, 0x2f, 0x1b, 0x1b, 0xd7,
+	0xd9, 0x92, 0xd8, 0xb3, 0xcd, 0xf7, 0x71, 0xd9, 0x47, 0xd4, 0xbd, 0x6a, 0xe8, 0xdf, 0x68, 0xe3, 0x6e, 0x63, 0xe4, 0xf0, 0x46, 0x7b, 0xf5, 0x76,
+	0x7b, 0xcc, 0x8b, 0x3d, 0xda, 0xa1, 0x02, 0x73, 0xcf, 0x8a, 0xdf, 0x59, 0x7a, 0xd6, 0x33, 0x49, 0x78, 0xe1, 0x42, 0xd7, 0xed, 0x7a, 0x33, 0x50,
+	0xa4, 0x7f, 0xd9, 0x28, 0x4a, 0xdd, 0x12, 0x48, 0x92, 0x6f, 0xb7, 0x8b, 0x63, 0x73, 0xde, 0xb3, 0x97, 0x97, 0x09, 0xbf, 0xe3, 0x2f, 0x5f, 0x98,
+	0xf4, 0xd5, 0x8f, 0x62, 0x94, 0x3f, 0x9e, 0xc0, 0x8a, 0xaf, 0xa2, 0xb3, 0xb5, 0x61, 0x17, 0x7e, 0x2a, 0x7e, 0x2c, 0x43, 0xae, 0x54, 0x96, 0xb9,
+	0x75, 0xc8, 0xd4, 0x8f, 0x16, 0x95, 0x6b, 0x4d, 0x7a, 0xe3, 0xa0, 0xa3, 0x7f, 0xb3, 0x8a, 0xe9, 0x4b, 0x0b, 0x9a, 0x07, 0x97, 0x16, 0xfa, 0xba,
+	0x07, 0x2c, 0xdc, 0xd5, 0x55, 0x81, 0x38, 0xdf, 0x6f, 0xa1, 0x64, 0x6b, 0x37, 0xd8, 0x9a, 0xb7, 0x7a, 0xe4, 0x79, 0x9b, 0x4f, 0xbc, 0x69, 0xc8,
+	0xd6, 0x86, 0xe2, 0x1f, 0x32, 0xf8, 0x3e, 0xd7, 0xd8, 0xfb, 0xa4, 0xae, 0x6b, 0x69, 0xf7, 0xe2, 0xc3, 0xd5, 0x75, 0x4d, 0xde, 0x06, 0x3a, 0x8b,
+	0x2d, 0xd8, 0xa8, 0xc0, 0xd2, 0xbe, 0x1a, 0x62, 0x9b, 0x2d, 0xed, 0x3b, 0x1e, 0x5a, 0xf1, 0x8e, 0x68, 0xd4, 0x42, 0x08, 0x75, 0xd7, 0xd5, 0xdf,
+	0xe1, 0xdb, 0x9b, 0x3e, 0xa0, 0xdf, 0xee, 0xe5, 0x5a, 0xc6, 0xeb, 0xce, 0x53, 0x5e, 0xf3, 0xd4, 0x75, 0x54, 0x39, 0x3b, 0xc1, 0x56, 0x8a, 0xd9,
+	0x02, 0x60, 0xa9, 0xa9, 0x52, 0x8f, 0x1e, 0xa5, 0x0a, 0x2a, 0xdf, 0x14, 0x56, 0xbe, 0xaf, 0x62, 0xf5, 0xe1, 0xb2, 0xf8, 0xa9, 0x8e, 0x57, 0xaf,
+	0x7f, 0x98, 0x96, 0x7d, 0x5e, 0xfe, 0x10, 0x48, 0xd9, 0x5c, 0xd5, 0x0f, 0x82, 0x14, 0xdb, 0x17, 0xfe, 0xed, 0xd5, 0x8b, 0xe7, 0xfb, 0x78, 0x17,
+	0x68, 0xcf, 0x5e, 0x5f, 0xdf, 0xb8, 0x61, 0xfb, 0xab, 0xda, 0xa4, 0x60, 0x07, 0x04, 0x1e, 0xc3, 0xf5, 0x6e, 0x87, 0xd7, 0x49, 0x84, 0x97, 0x9f,
+	0x99, 0xed, 0xb7, 0x8b, 0xf5, 0x72, 0x6e, 0x7b, 0xb6, 0x97, 0x0d, 0xcc, 0x9b, 0xdc, 0x22, 0xb3, 0x45, 0xf3, 0xea, 0x4e, 0xf9, 0x0a, 0x8d, 0x86,
+	0xef, 0xb0, 0x05, 0x8d, 0x0c, 0x7f, 0x77, 0xf4, 0x63, 0x03, 0x99, 0xef, 0x83, 0x24, 0x9a, 0xcf, 0x8d, 0xcc, 0x60, 0xe7, 0x9e, 0x0c, 0x89, 0x61,
+	0x50, 0x44, 0x1b, 0x97, 0xf5, 0xfa, 0xe5, 0x99, 0xf3, 0x29, 0xf3, 0xd0, 0xcd, 0x61, 0x9a, 0x0f, 0x2d, 0xc2, 0x5f, 0x02, 0x99, 0xe5, 0x1f, 0xaa,
+	0x8a, 0x57, 0xbf, 0xe4, 0x52, 0x35, 0x70, 0xf1, 0x2b, 0x39, 0xd5, 0xe5, 0x65, 0x1c, 0xa2, 0x83, 0xaf, 0x8b, 0xee, 0x00, 0x57, 0x56, 0xc5, 0x6d,
+	0x71, 0x92, 0x66, 0xa4, 0x3e, 0xb6, 0x15, 0xd8, 0xaa, 0x66, 0x81, 0xf7, 0x76, 0x1a, 0xda, 0xba, 0x57, 0x53, 0x67, 0xfa, 0xf0, 0x36, 0x93, 0x87,
+	0xcb, 0x27, 0x7b, 0x53, 0x97, 0xaf, 0x4d, 0x78, 0x38, 0x55, 0x47, 0xab, 0x57, 0xca, 0xb5, 0xcd, 0xaf, 0xa2, 0xdf, 0x64, 0xd2, 0xf7, 0xba, 0xf8,
+	0xed, 0xb0, 0xce, 0x72, 0xc1, 0x40, 0xdb, 0x96, 0xa9, 0x25, 0x2a, 0xea, 0x37, 0xc2, 0x22, 0x55, 0x43, 0xa5, 0xa6, 0xb5, 0x55, 0x1c, 0xf8, 0x45,
+	0x74, 0x54, 0x8b, 0x5d, 0xcc, 0xc5, 0xd5, 0xf8, 0xf8, 0xbc, 0x43, 0xbe, 0x5c, 0x5f, 0xda, 0x7a, 0x2b, 0x57, 0x63, 0x9f, 0xce, 0xa7, 0x0c, 0xe8,
+	0x7e, 0xeb, 0xfa, 0x43, 0x39, 0x3a, 0x74, 0x57, 0x6f, 0x4e, 0x07, 0x18, 0x5f, 0x12, 0xa8, 0xd7, 0xc7, 0x35, 0x5f, 0x5d, 0xce, 0x9f, 0xef, 0x69,
+	0x79, 0x8d, 0x79, 0x55, 0x45, 0x1b, 0x78, 0xc2, 0xd8, 0xff, 0xe3, 0xd9, 0xf7, 0xdf, 0x6e, 0x36, 0xe7, 0xc5, 0x28, 0x34, 0xc1, 0x0b, 0x3e, 0xed,
+	0x2f, 0xcf, 0xb3, 0x45, 0xaf, 0xfb, 0xb7, 0x27, 0xaf, 0xbb, 0x83, 0x7f, 0xfe, 0xeb, 0xe5, 0xd3, 0x97, 0x57, 0xff, 0x7a, 0xf9, 0xed, 0xeb, 0xd7,
+	0x2f, 0x5f, 0xbe, 0xf8, 0xe1, 0xb5, 0x7c, 0x34, 0xc5, 0xb8, 0xfa, 0x6b, 0x3a, 0xfd, 0xd7, 0x4b, 0x75, 0xd7, 0xab, 0x7f, 0xaa, 0xcb, 0x17, 0x52,
+	0xb3, 0xf4, 0x83, 0x79, 0xbf, 0x47, 0x56, 0xbc, 0xcb, 0xcc, 0xae, 0xb0, 0x06, 0xd3, 0x69, 0x91, 0x0a, 0x69, 0xcc, 0xeb, 0x70, 0xb8, 0x62, 0xe0,
+	0x39, 0x4e, 0x75, 0xae, 0x7c, 0x6f, 0x90, 0xed, 0xc5, 0xa2, 0xaf, 0x74, 0xcf, 0x54, 0xf9, 0xf0, 0x9c, 0x59, 0x95, 0x92, 0x81, 0x68, 0x9b, 0x45,
+	0xc5, 0xf7, 0x55, 0x67, 0xd4, 0xb2, 0x12, 0x13, 0x50, 0x9f, 0x0b, 0xd3, 0xa0, 0x3a, 0x90, 0x44, 0x32, 0x14, 0xa7, 0x59, 0x6b, 0x76, 0x26, 0x4e,
+	0xae, 0xaa, 0xca, 0x4b, 0xb9, 0x84, 0x5c, 0x9b, 0x05, 0x76, 0x5f, 0x51, 0x07, 0x09, 0x5a, 0x47, 0xff, 0x2d, 0xe6, 0xdc, 0xf6, 0x04, 0x51, 0xe3,
+	0xa2, 0x36, 0x41, 0xec, 0xc0, 0xa8, 0x46, 0xc5, 0xf5, 0x93, 0xa5, 0xaa, 0x80, 0xc9, 0xb0, 0x75, 0x99, 0x8a, 0x89, 0x77, 0x6d, 0x69, 0x97, 0xb3,
+	0x27, 0x59, 0xfa, 0x02, 0xb9, 0x99, 0x4e, 0x62, 0xe1, 0x96, 0xc9, 0x9b, 0x0c, 0xf3, 0x61, 0xbe, 0x5c, 0xdb, 0x3e, 0xb7, 0x4b, 0xe6, 0xf6, 0x14,
+	0x4e, 0xf4, 0x6e, 0x37, 0x3f, 0xda, 0x0c, 0x3d, 0x7c, 0x4a, 0xad, 0x4c, 0xf5, 0x7b, 0x63, 0x58, 0xff, 0x94, 0xc5, 0xaf, 0xf0, 0xad, 0xf7, 0xcf,
+	0x77, 0xeb, 0x03, 0x3b, 0x7e, 0x7f, 0x7a, 0x85, 0xd1, 0xfb, 0xe5, 0x3f, 0x07, 0x47, 0xdd, 0x68, 0x95, 0x5e, 0xcc, 0x16, 0xcb, 0xee, 0x71, 0xff,
+	0xb0, 0x5e, 0x6e, 0x33, 0xee, 0xa7, 0x96, 0x55, 0xcc, 0xe7, 0xc6, 0x42, 0x63, 0x99, 0x92, 0xbd, 0x6e, 0x93, 0xe2, 0xcb, 0xee, 0xb4, 0xc5, 0x82,
+	0xba, 0x4d, 0x5d, 0xb8, 0xc2, 0x9d, 0xe9, 0xd9, 0x7a, 0xc5, 0x9b, 0x3a, 0xcd, 0x97, 0xda, 0x2b, 0x08, 0x7e, 0x53, 0xd3, 0xd9, 0xba, 0xa9, 0x96,
+	0xab, 0x8d, 0x55, 0x9e, 0xee, 0x1c, 0x1c, 0x1c, 0x74, 0xdb, 0x97, 0xfa, 0x58, 0xdf, 0x4a, 0x73, 0x64, 0x7d, 0x87, 0xce, 0x83, 0xb4, 0xb2, 0x3b,
+	0x0b, 0x56, 0x4b, 0xcb, 0x96, 0xb6, 0x8a, 0x80, 0x04, 0x36, 0x83, 0xed, 0x71, 0x6f, 0xbb, 0x5e, 0xaf, 0x95, 0x95, 0x03, 0xbc, 0xe5, 0x5e, 0x0d,
+	0x5d, 0x58, 0x56, 0xd9, 0x12, 0x33, 0x4f, 0xf8, 0x4b, 0x60, 0xda, 0x9a, 0x68, 0x37, 0xb0, 0xdb, 0x67, 0x54, 0xd7, 0xda, 0xe4, 0xba, 0x0a, 0xa5,
+	0xab, 0xf8, 0x34, 0x7a, 0xfa, 0x4d, 0xce, 0xc3, 0x6e, 0xa8, 0x78, 0xf1, 0xf5, 0x13, 0x28, 0x2f, 0xf0, 0x81, 0xca, 0x8b, 0xe2, 0x55, 0x59, 0x03,
+	0xa7, 0x38, 0x0c, 0xfd, 0xc5, 0xd8, 0xf1, 0xf6, 0x5d, 0x37, 0xee, 0x0e, 0xdc, 0xe2, 0xb0, 0x57, 0x1d, 0x3e, 0x31, 0x5a, 0x28, 0x7b, 0xd8, 0xaf,
+	0x0e, 0x2f, 0x8c, 0x16, 0x8a, 0x2a, 0xb2, 0xd9, 0x37, 0xb3, 0x86, 0xbc, 0x11, 0xe2, 0xbf, 0xcb, 0xe7, 0xe2, 0x01, 0xf6, 0x8d, 0xd9, 0x29, 0x7d,
+	0x75, 0x79, 0xee, 0xf7, 0xe9, 0x8c, 0xbf, 0x99, 0x7d, 0x6e, 0x75, 0x86, 0xdc, 0xe3, 0x69, 0xe7, 0x55, 0xb6, 0x31, 0xcc, 0xbc, 0xfe, 0xaf, 0x29,
+	0xcb, 0x38, 0x33, 0xbf, 0x5a, 0xd2, 0xf2, 0x3c, 0xd4, 0x1c, 0xef, 0x0e, 0x8a, 0x37, 0x88, 0x0e, 0xaa, 0x38, 0xc2, 0xf4, 0x86, 0x7a, 0xd1, 0x26,
+	0xfa, 0x74, 0xc7, 0x73, 0x3f, 0xa4, 0xad, 0x9e, 0x58, 0x6e, 0xcc, 0x06, 0x34, 0xfc, 0x42, 0xa6, 0x7c, 0xb8, 0x76, 0xaf, 0xa7, 0xd9, 0xb6, 0xa4,
+	0x54, 0x05, 0xf3, 0x99, 0x69, 0x4d, 0x58, 0x5e, 0xe9, 0xb4, 0xc7, 0xf8, 0x6a, 0x8b, 0xc9, 0x73, 0xe5, 0xa6, 0xc0, 0x34, 0x7d, 0x8e, 0x1f, 0xa4,
+	0xac, 0x2e, 0x53, 0xf7, 0xb6, 0x3b, 0xcd, 0xf4, 0x59, 0x73, 0x97, 0x41, 0x97, 0x39, 0xd6, 0x9e, 0xf6, 0x46, 0xe7, 0x8c, 0x56, 0x93, 0x44, 0x26,
+	0x3a, 0xde, 0x4e, 0x67, 0x6f, 0x18, 0x9d, 0x97, 0x37, 0x3b, 0xbf, 0x59, 0x52, 0x5f, 0x2b, 0x50, 0x74, 0xbe, 0xab, 0x30, 0xcc, 0x6a, 0xd0, 0xe5,
+	0xed, 0x3a, 0x7c, 0x1b, 0xde, 0x80, 0x72, 0xde, 0xc6, 0x6e, 0xba, 0xab, 0xea, 0x2d, 0x51, 0x12, 0xb2, 0x75, 0x30, 0x3d, 0x4a, 0xd3, 0xd4, 0xbf,
+	0x63, 0x9a, 0xa8, 0xfa, 0x6e, 0xde, 0x1b, 0x55, 0x4f, 0x21, 0x47, 0x0e, 0xeb, 0x69, 0x1a, 0x4f, 0x2e, 0xaf, 0xb6, 0x13, 0x00, 0xb4, 0x76, 0x44,
+	0x04, 0xe8, 0x64, 0x23, 0x30, 0xb5, 0x87, 0x71, 0xc0, 0x18, 0xcd, 0xed, 0x3c, 0xda, 0x5f, 0x16, 0xb0, 0x6b, 0x1f, 0x7b, 0xf1, 0xde, 0x82, 0x2a,
+	0x54, 0x2a, 0x3c, 0x7d, 0x61, 0xb3, 0x4c, 0x03, 0xca, 0x64, 0xfb, 0xde, 0xfc, 0x24, 0x2c, 0x14, 0xa1, 0x08, 0x62, 0x17, 0xd9, 0xc6, 0xec, 0xb5,
+	0xb6, 0x00, 0xd4, 0x28, 0xc5, 0x72, 0x81, 0x94, 0x59, 0xba, 0x63, 0x63, 0xff, 0x42, 0xef, 0xd5, 0xae, 0xbd, 0x09, 0xa0, 0x48, 0xd7, 0xcc, 0xf3,
+	0xe6, 0x8d, 0xdc, 0xe6, 0x0d, 0x3a, 0x58, 0xce, 0x30, 0x7b, 0x56, 0xb7, 0xe5, 0xcf, 0x45, 0x0f, 0x9b, 0x34, 0xf5, 0x17, 0x67, 0x6f, 0xdd, 0x27,
+	0x3d, 0x4d, 0xce, 0x1f, 0x6f, 0x8b, 0x73, 0xed, 0xcb, 0xe8, 0xe4, 0x94, 0xfd, 0x89, 0x4c, 0xf9, 0x54, 0x7f, 0xa3, 0x39, 0x9f, 0x50, 0x7d, 0xfd,
+	0xed, 0xe3, 0x97, 0xdf, 0xcc, 0xb2, 0x79, 0xba, 0xee, 0x99, 0x24, 0x2d, 0xd9, 0x6f, 0xa7, 0x53, 0x6f, 0x08, 0x32, 0x17, 0x58, 0xd5, 0xf1, 0x79,
+	0xf1, 0xc4, 0xeb, 0x2e, 0xb3, 0x29, 0x5a, 0xed, 0x2c, 0x5a, 0xbf, 0x69, 0x3b, 0x75, 0x22, 0x23, 0xe7, 0x5d, 0xf4, 0xa1, 0xed, 0x54, 0xba, 0x58,
+	0xbb, 0x3b, 0x8e, 0x7b, 0x5b, 0xc7, 0x1b, 0x85, 0xbd, 0xe6, 0x77, 0x53, 0x24, 0xdc, 0xae, 0x8f, 0xf8, 0x32, 0x71, 0xe5, 0x45, 0xe8, 0x42, 0x61,
+	0xfb, 0xaa, 0x41, 0xdc, 0x78, 0x52, 0x61, 0x7e, 0xff, 0x74, 0xda, 0x73, 0x1e, 0x70, 0x44, 0x17, 0x57, 0xd4, 0x56, 0xca, 0x4d, 0x92, 0xda, 0x4a,
+	0x39, 0xec, 0xa6, 0x32, 0x95, 0xc5, 0x42, 0x8c, 0xba, 0x52, 0xeb, 0xbe, 0x67, 0xa9, 0x5d, 0x2d, 0x36, 0x19, 0x35, 0xab, 0x39, 0x5b, 0xb7, 0x74,
+	0xb8, 0xbd, 0xba, 0xba, 0x87, 0x1d, 0x33, 0x2d, 0x73, 0x2e, 0x7a, 0xab, 0x5a, 0xa8, 0xf0, 0xff, 0x97, 0x5b, 0xcd, 0x63, 0x52, 0x29, 0x07, 0x5b,
+	0x5b, 0x6d, 0x78, 0x37, 0xcb, 0x67, 0xd3, 0x62, 0x0e, 0x22, 0xbb, 0xcb, 0xab, 0xf2, 0xb5, 0x0e, 0xfa, 0xe6, 0xfd, 0x3b, 0x26, 0xe9, 0x7e, 0x7b,
+	0x93, 0x7e, 0x74, 0xec, 0x56, 0x86, 0xca, 0x7e, 0xff, 0xf9, 0xce, 0xde, 0x5a, 0x79, 0x3b, 0xdb, 0xf8, 0x1e, 0xd9, 0xda, 0x3b, 0x87, 0xad, 0x85,
+	0xb7, 0xef, 0xe5, 0xdd, 0xf5, 0x82, 0x17, 0x9c, 0x55, 0xde, 0xa9, 0xf1, 0xf2, 0xb1, 0x22, 0x1b, 0x7c, 0xe9, 0xde, 0xf6, 0xd5, 0x63, 0x7f, 0xbe,
+	0xe7, 0xaf, 0x64, 0xee, 0xb5, 0xb7, 0x28, 0xd8, 0xe2, 0x17, 0xc1, 0x65, 0x95, 0xaa, 0xdb, 0xb8, 0xee, 0xba, 0x97, 0x43, 0x6c, 0xcb, 0xe3, 0xaa,
+	0x8b, 0x54, 0x9d, 0xd7, 0xb3, 0x56, 0x2d, 0xa3, 0xd9, 0x01, 0xd0, 0x72, 0xb7, 0xea, 0x5d, 0x05, 0xa5, 0xbd, 0xac, 0x8b, 0xbb, 0xda, 0xf2, 0x7a,
+	0xf9, 0xd5, 0xab, 0x57, 0x75, 0x55, 0xd7, 0x69, 0xf1, 0x5e, 0xa7, 0xeb, 0xf3, 0x37, 0x57, 0xa8, 0xfc, 0xb5, 0x63, 0xd0, 0x2f, 0x60, 0xc2, 0x81,
+	0x9a, 0x54, 0x64, 0x57, 0x86, 0x35, 0xd7, 0x52, 0x65, 0x1c, 0x15, 0xef, 0xf0, 0x68, 0xe9, 0x84, 0xb2, 0x51, 0xb7, 0xd2, 0x7e, 0x42, 0xc3, 0x97,
+	0x97, 0xa8, 0x9f, 0xee, 0x59, 0xae, 0x37, 0xd8, 0xc6, 0xd3, 0xd2, 0x5c, 0xc5, 0x39, 0x25, 0x4c, 0xdc, 0xbe, 0x77, 0xbd, 0x56, 0xc5, 0x05, 0x7a,
+	0x9b, 0x8d, 0x71, 0x46, 0x2d, 0x79, 0x7f, 0xfd, 0xf8, 0xdb, 0x97, 0x92, 0x61, 0xf9, 0x43, 0x28, 0x55, 0xde, 0x70, 0x5a, 0x6d, 0x3f, 0x6b, 0x52,
+	0xbd, 0x2b, 0xa8, 0x99, 0xa4, 0x6a, 0x82, 0xae, 0x4a, 0x52, 0xbe, 0xdc, 0xbe, 0x3c, 0x64, 0x2d, 0x68, 0x23, 0x1c, 0xde, 0x51, 0x21, 0xe4, 0x52,
+	0x55, 0x66, 0xd6, 0x5a, 0x95, 0xd9, 0xf9, 0x0e, 0xe5, 0xe6, 0x8e, 0x4c, 0x67, 0xe7, 0xf5, 0xa1, 0x64, 0xbc, 0x65, 0xbb, 0x2e, 0x14, 0xa7, 0x3e,
+	0x2d, 0xf3, 0xc2, 0xfb, 0x56, 0x77, 0xb0, 0x4e, 0xb7, 0xed, 0x0e, 0xf6, 0xd4, 0xa7, 0xdd, 0xa1, 0x70, 0xe2, 0xaa, 0x8f, 0xc5, 0x77, 0xb7, 0xf6,
+	0xf1, 0xf3, 0x57, 0x1d, 0xf7, 0xd3, 0x32, 0x07, 0x06, 0xd4, 0x72, 0xf6, 0x76, 0xe5, 0xec, 0x7d, 0x72, 0xce, 0x5a, 0x31, 0x79, 0x16, 0x25, 0x6d,
+	0x19, 0x3f, 0xfb, 0xea, 0xf1, 0xa7, 0x65, 0x2b, 0xf9, 0xe8, 0xe8, 0x84, 0x38, 0x8a, 0x9c, 0x1f, 0xf3, 0x73, 0xaf, 0xbf, 0xd3, 0x08, 0x82, 0x5c,
+	0xab, 0x8b, 0xf3, 0xf3, 0xf2, 0x8d, 0x58, 0xb7, 0xc0, 0x7a, 0x7a, 0xb0, 0xdb, 0xc0, 0xfd, 0x76, 0xca, 0x76, 0x71, 0xa2, 0xf1, 0xe7, 0xad, 0x2f,
+	0x3c, 0x93, 0xe3, 0xbb, 0x5e, 0x78, 0x66, 0x31, 0xf5, 0x26, 0x65, 0x6b, 0x63, 0x59, 0xb1, 0x35, 0x4b, 0xb3, 0xdd, 0xbd, 0xa0, 0x19, 0xb6, 0x41,
+	0x65, 0x7a, 0x3f, 0xf3, 0x3d, 0x5a, 0xa3, 0x08, 0xd3, 0x74, 0x1d, 0x7b, 0xa6, 0xf3, 0xd6, 0xdd, 0x77, 0xca, 0x10, 0xa2, 0xd1, 0xa0, 0x3b, 0x42,
+	0x22, 0xfc, 0x06, 0x09, 0x01, 0x42, 0x3a, 0xd1, 0x1e, 0xbd, 0xa3, 0xc9, 0x41, 0x85, 0x4a, 0xf6, 0x27, 0x4b, 0x5a, 0x92, 0xda, 0x97, 0x51, 0x6f,
+	0x27, 0x4d, 0x4c, 0xeb, 0x37, 0x53, 0x9b, 0x2e, 0xd1, 0x11, 0x18, 0x92, 0xf1, 0x8a, 0xd3, 0x45, 0x23, 0x79, 0x69, 0xb1, 0xf5, 0x25, 0xa7, 0x0b,
+	0xa6, 0x17, 0xc3, 0xb6, 0x9d, 0x5e, 0x6c, 0x97, 0x4e, 0x39, 0x3b, 0xb7, 0xc5, 0x3e, 0x6b, 0xa4, 0x2c, 0x0c, 0x91, 0x4e, 0xbe, 0x3e, 0x63, 0xf2,
+	0x93, 0x77, 0x8d, 0xe4, 0x85, 0x55, 0xd1, 0xc9, 0x4f, 0xde, 0x31, 0xb9, 0xcc, 0xb1, 0x46, 0x7a, 0x33, 0xef, 0x6a, 0x81, 0x66, 0x94, 0x30, 0xb1,
+	0xb1, 0x20, 0x8d, 0xd4, 0x30, 0x2b, 0x3a, 0xb9, 0x39, 0x50, 0xa6, 0xf7, 0xda, 0xd2, 0x7b, 0xdb, 0xe9, 0x3d, 0x9b, 0x5e, 0x5c, 0x82, 0x4a, 0x5f,
+	0x45, 0x5c, 0x77, 0xef, 0x16, 0x69, 0xe5, 0x9b, 0x72, 0x42, 0xc8, 0x86, 0x91, 0xcb, 0x6f, 0x89, 0xcc, 0xee, 0x14, 0x80, 0x0d, 0xf3, 0x60, 0x27,
+	0x2b, 0x4d, 0x05, 0x77, 0x2e, 0x6c, 0xfd, 0x8c, 0xc5, 0xdd, 0x69, 0xd1, 0xd8, 0xfa, 0xd7, 0x10, 0x34, 0x72, 0xa9, 0xb7, 0x5a, 0x51, 0x22, 0xb0,
+	0xb5, 0x95, 0xb3, 0x35, 0x83, 0x46, 0x2c, 0xac, 0xdf, 0x9e, 0x77, 0xb5, 0x6b, 0x5e, 0x7c, 0x52, 0x98, 0x6f, 0x52, 0xab, 0xc0, 0x7e, 0x6b, 0x9d,
+	0xf2, 0x76, 0xe1, 0xfe, 0xbb, 0x46, 0xbc, 0xdf, 0x5a, 0xa8, 0x3f, 0x20, 0xe6, 0x6f, 0xe4, 0xbb, 0xb8, 0xd5, 0xab, 0xe1, 0x98, 0x71, 0xf9, 0x02,
+	0x3d, 0xfd, 0x6a, 0xb8, 0xeb, 0x72, 0xfd, 0x3c, 0xeb, 0x09, 0x8d, 0xbb, 0x7d, 0x8e, 0x55, 0x85, 0xc6, 0x4d, 0xfe, 0x2b, 0xaf, 0x2d, 0x98, 0xdf,
+	0xb1, 0xab, 0x17, 0x02, 0x3f, 0x85, 0x56, 0xbf, 0x79, 0x75, 0xa8, 0xbc, 0x69, 0x75, 0x88, 0x37, 0xab, 0x7d, 0xf7, 0xec, 0xf7, 0x5d, 0xd3, 0x64,
+	0xbe, 0x3c, 0x69, 0x3a, 0x0f, 0xf3, 0x6b, 0xcd, 0x0b, 0xfb, 0x0a, 0x21, 0xa3, 0xbf, 0x36, 0x3f, 0x2c, 0xe0, 0x7c, 0x61, 0xa7, 0xe6, 0x66, 0xbd,
+	0x39, 0x2b, 0x9f, 0x1e, 0x08, 0x6e, 0x98, 0xb7, 0x82, 0x2c, 0xbf, 0x5f, 0x4a, 0xac, 0x9c, 0x99, 0xb4, 0xf6, 0x37, 0xcc, 0xbb, 0xd9, 0xe2, 0xfe,
+	0x8f, 0x12, 0xf0, 0xbc, 0x7e, 0xf5, 0xfa, 0xd9, 0xcb, 0x5f, 0x5e, 0xbc, 0x7c, 0xfd, 0xf4, 0xc5, 0xf3, 0x57, 0xbc, 0x6c, 0x2e, 0x33, 0x67, 0xda,
+	0x3d, 0xea, 0xee, 0x99, 0xeb, 0xf7, 0xba, 0xc7, 0x9d, 0xee, 0x5e, 0x91, 0xb5, 0x0c, 0x9e, 0xdd, 0x93, 0xcd, 0x5c, 0xb7, 0xb3, 0x63, 0xff, 0x90,
+	0x75, 0x18, 0x1c, 0x37, 0x41, 0x1f, 0x49, 0xa8, 0xb0, 0x7e, 0x18, 0xc1, 0xc5, 0xf2, 0x02, 0x72, 0x65, 0x9a, 0xf2, 0x9c, 0xfa, 0x41, 0x5c, 0x7b,
+	0x7d, 0xcf, 0x79, 0x60, 0xfe, 0xda, 0xb7, 0x82, 0x31, 0x77, 0x93, 0xb4, 0xb6, 0x66, 0x63, 0x52, 0x60, 0xcd, 0x86, 0x3b, 0xcd, 0x97, 0xc5, 0x4e,
+	0xf3, 0xec, 0xec, 0x7c, 0xf3, 0xa1, 0xab, 0x66, 0x4f, 0xb1, 0x76, 0xa3, 0x72, 0x30, 0xd6, 0x79, 0xf7, 0xd4, 0xf8, 0xc8, 0x2d, 0xf1, 0x33, 0x7b,
+	0x6a, 0x76, 0xde, 0x5c, 0x53, 0x7a, 0xfa, 0x72, 0x6a, 0xae, 0xf8, 0xf8, 0xf1, 0xe9, 0xcb, 0x1f, 0x9e, 0xfc, 0xed, 0xc9, 0x3f, 0xa4, 0xf1, 0x25,
+	0x7e, 0x9c, 0x9d, 0x97, 0xe1, 0x46, 0x79, 0x57, 0x9b, 0xbc, 0xb6, 0xba, 0x24, 0xfd, 0x22, 0x26, 0xc9, 0x2c, 0x4e, 0x40, 0x3c, 0x77, 0x36, 0xad,
+	0x8d, 0xd2, 0xc6, 0xcd, 0x9e, 0x3f, 0x6b, 0xbb, 0xd9, 0xe2, 0x6c, 0x6b, 0x74, 0xd7, 0xee, 0xf8, 0xfc, 0xd9, 0x35, 0x77, 0x3c, 0xb1, 0x1b, 0x4d,
+	0x8a, 0x49, 0xd0, 0xb8, 0xe3, 0xdf, 0x7e, 0x6a, 0xbb, 0xe3, 0xc9, 0xbb, 0xad, 0xc9, 0x53, 0xbb, 0xe3, 0xdf, 0x7e, 0xba, 0xe6, 0x8e, 0x08, 0x34,
+	0xaa, 0x59, 0xd6, 0xb8, 0xa1, 0x84, 0x05, 0x6e, 0xdb, 0x2d, 0xe9, 0xed, 0xab, 0x0b, 0x6b, 0x77, 0x34, 0x17, 0x5d, 0x7f, 0x4f, 0x6f, 0x5a, 0xcd,
+	0xe4, 0xb6, 0x7b, 0x7a, 0x3b, 0xee, 0xe9, 0xf5, 0x3f, 0x7e, 0xbc, 0x6b, 0xfe, 0x2a, 0x4b, 0xb0, 0x7d, 0x6b, 0xef, 0x9a, 0x5b, 0x33, 0x8d, 0x11,
+	0x59, 0xd8, 0xee, 0x2f, 0xc4, 0xa4, 0xcf, 0xec, 0x87, 0xbf, 0xfd, 0x64, 0x3f, 0x98, 0x3a, 0x54, 0x1f, 0xbd, 0xb6, 0x35, 0x45, 0x33, 0xbe, 0x8b,
+	0x24, 0x92, 0xe5, 0xae, 0x39, 0x7c, 0xe3, 0x22, 0xa3, 0x9e, 0x88, 0xf6, 0x27, 0x41, 0x81, 0xe8, 0xf5, 0x43, 0x25, 0x57, 0xd6, 0x0f, 0x63, 0x7e,
+	0x6c, 0xfd, 0x9e, 0xe8, 0xf6, 0x81, 0x62, 0x20, 0xd6, 0x8f, 0x16, 0x83, 0x65, 0x2b, 0x3f, 0xd3, 0x9b, 0x8d, 0x43, 0xde, 0xd6, 0x22, 0x68, 0x13,
+	0x01, 0x3e, 0xef, 0x52, 0xe8, 0x0d, 0x4d, 0xd4, 0xbf, 0xc4, 0xea, 0x28, 0x16, 0xbc, 0x9a, 0xf6, 0x0b, 0xe7, 0xea, 0x0a, 0xcb, 0xea, 0x77, 0x6e,
+	0xef, 0x54, 0xc7, 0x1a, 0x32, 0x49, 0x82, 0xa6, 0x39, 0x54, 0x94, 0x63, 0xbb, 0x13, 0xec, 0xb2, 0xec, 0xa9, 0x55, 0x1d, 0x94, 0xa7, 0xf5, 0x98,
+	0xde, 0xe1, 0xe6, 0x8b, 0x2c, 0x75, 0x07, 0xda, 0xec, 0x76, 0x5a, 0xbf, 0xe2, 0x1a, 0xdd, 0xc3, 0xcd, 0x5c, 0xee, 0xdd, 0xa3, 0xeb, 0xb5, 0xb9,
+	0xb5, 0x98, 0xcb, 0x22, 0x9f, 0xc6, 0xc0, 0xb8, 0x31, 0xb3, 0x5d, 0x36, 0xb1, 0xc8, 0xb1, 0x31, 0xa8, 0x6e, 0xcc, 0x71, 0x97, 0xcd, 0x2b, 0xdb,
+	0xa7, 0x36, 0x20, 0x6f, 0xcc, 0x6e, 0x87, 0x41, 0x53, 0xb9, 0x79, 0x9f, 0x96, 0x5b, 0x9b, 0xa9, 0xb2, 0xaf, 0x07, 0xae, 0x9e, 0x5e, 0xfe, 0xb9,
+	0xcb, 0xed, 0x8f, 0x4f, 0x97, 0xb3, 0x24, 0xab, 0x5e, 0x1a, 0x74, 0xed, 0x42, 0x6f, 0x63, 0xa5, 0xf1, 0xcf, 0x58, 0x62, 0x68, 0x2c, 0x8e, 0xff,
+	0x31, 0xab, 0xc9, 0x7f, 0xc6, 0xca, 0x45, 0xdb, 0xe6, 0xe0, 0xff, 0xd4, 0x07, 0x09, 0x7f, 0xfe, 0x0a, 0xf6, 0x9f, 0xfe, 0x2e, 0x89, 0xe2, 0x15,
+	0x5b, 0xc5, 0xef, 0x80, 0x76, 0x64, 0xa2, 0x74, 0x0c, 0x36, 0x46, 0x6f, 0xa3, 0xd9, 0xdc, 0x9c, 0x32, 0x6b, 0x76, 0x26, 0x8f, 0xce, 0xdb, 0x6c,
+	0xb5, 0x9e, 0x95, 0x1b, 0xab, 0x77, 0x2c, 0x21, 0x36, 0x5f, 0x36, 0xc1, 0x71, 0xd4, 0xba, 0x24, 0xcf, 0x11, 0xd6, 0xba, 0x70, 0xce, 0x73, 0x37,
+	0xac, 0x8b, 0xef, 0x5a, 0xb9, 0xe7, 0xb5, 0x55, 0xab, 0xc6, 0x59, 0x54, 0xfc, 0x92, 0xd7, 0x56, 0x11, 0x78, 0x46, 0xee, 0xbb, 0xb8, 0x38, 0x8b,
+	0xf1, 0xd6, 0x82, 0x1b, 0x9e, 0x0a, 0xf0, 0x02, 0x3d, 0x2a, 0x37, 0x11, 0x7f, 0x69, 0xb5, 0x4d, 0x6a, 0x12, 0xbd, 0x57, 0x8f, 0x99, 0xd6, 0x5b,
+	0xaa, 0x13, 0x20, 0xfc, 0x66, 0x51, 0xfc, 0x52, 0xeb, 0xd1, 0xb1, 0xfa, 0x91, 0x2c, 0xf7, 0x70, 0xf6, 0x60, 0x3a, 0xc6, 0x6f, 0x26, 0xdd, 0xa9,
+	0xd2, 0xd8, 0x37, 0xfa, 0xcc, 0x06, 0xb3, 0xe3, 0xad, 0xbb, 0x6b, 0xe1, 0x4a, 0x95, 0xfe, 0xfa, 0xaa, 0x94, 0xd7, 0xd6, 0x5f, 0x73, 0xb1, 0xc8,
+	0xe6, 0x6d, 0x75, 0xb1, 0xa7, 0x5a, 0xea, 0x90, 0x9c, 0x5e, 0x53, 0x07, 0xd7, 0x67, 0x25, 0xaa, 0x44, 0xcd, 0x4a, 0xd8, 0xac, 0x75, 0x1d, 0xaa,
+	0xe4, 0x8d, 0x3a, 0x6c, 0xbd, 0x9a, 0xc2, 0x5c, 0xf8, 0x59, 0x1f, 0x6a, 0x7c, 0xfe, 0x47, 0x0e, 0x9f, 0xff, 0xb1, 0x89, 0x1a, 0x84, 0xad, 0x7d,
+	0x5b, 0x1b, 0xa3, 0x9f, 0x70, 0x27, 0x75, 0xe1, 0xe7, 0x7c, 0x1c, 0x71, 0xc3, 0x13, 0x04, 0x45, 0x03, 0x37, 0x3d, 0x42, 0x68, 0x4d, 0xda, 0x22,
+	0x13, 0x6a, 0x4f, 0x57, 0xae, 0x09, 0x6c, 0xed, 0x97, 0xf8, 0x0d, 0x2b, 0x03, 0x3b, 0x02, 0xfe, 0x22, 0xac, 0xff, 0x3b, 0xf2, 0xba, 0x29, 0xe8,
+	0x2f, 0x53, 0xfe, 0xf6, 0xa0, 0xbf, 0x1e, 0x5c, 0x95, 0x19, 0x1e, 0xee, 0x6a, 0x82, 0xe5, 0xe2, 0x95, 0xb8, 0xf4, 0x74, 0xfb, 0xb7, 0x2a, 0x77,
+	0x6f, 0xa7, 0xb1, 0xbf, 0x74, 0x6a, 0x56, 0x9f, 0x4d, 0xca, 0x9d, 0x19, 0x5f, 0xa7, 0xc4, 0x6a, 0x3c, 0x07, 0xe0, 0x63, 0x80, 0x9a, 0x0d, 0xa8,
+	0x3d, 0x26, 0xe0, 0xb1, 0x6a, 0xe5, 0x61, 0x7b, 0x99, 0x5f, 0xbb, 0x89, 0xda, 0xc3, 0x02, 0x1c, 0xaa, 0x79, 0x8d, 0xda, 0x79, 0x1e, 0xda, 0x0a,
+	0xf9, 0xb7, 0x57, 0xf9, 0x77, 0x3e, 0x31, 0xb0, 0xc7, 0x9a, 0x73, 0xb2, 0x5e, 0x37, 0x6b, 0x96, 0xab, 0xc9, 0xd4, 0x7c, 0x36, 0xb0, 0xab, 0x11,
+	0xff, 0xa0, 0x80, 0xb7, 0x68, 0xd3, 0x1b, 0x82, 0x5b, 0xdb, 0x80, 0xf5, 0x83, 0xb6, 0xd5, 0x6e, 0x13, 0xf0, 0x6e, 0xc5, 0x40, 0xbb, 0x87, 0xc6,
+	0xef, 0x8e, 0x70, 0xa3, 0xf3, 0xdf, 0x1e, 0xdf, 0x46, 0xe7, 0xbb, 0xa2, 0x5b, 0x39, 0xf3, 0xc7, 0xc4, 0xb6, 0x5b, 0xed, 0xdd, 0xbf, 0x13, 0x9d,
+	0x97, 0xae, 0xb8, 0x96, 0xa0, 0x19, 0x8f, 0xd6, 0xfb, 0x00, 0x57, 0x5a, 0xe0, 0xd2, 0xa7, 0x9b, 0xd7, 0xd5, 0xbb, 0x09, 0xd7, 0x59, 0x4a, 0xd2,
+	0xa7, 0xaf, 0x8b, 0x7f, 0x71, 0xcd, 0x35, 0x11, 0xee, 0x56, 0x9f, 0x23, 0x79, 0xe1, 0x4b, 0xaf, 0x0d, 0x3b, 0xb7, 0x86, 0x05, 0x2e, 0x2c, 0x5c,
+	0x64, 0x6b, 0x04, 0xcc, 0x98, 0xd0, 0x3e, 0xa2, 0xfe, 0xdc, 0x2f, 0xbf, 0xb3, 0xb7, 0xe9, 0x1e, 0xb6, 0xfc, 0xe2, 0x9d, 0x59, 0x50, 0x2e, 0xb7,
+	0x38, 0x65, 0xcc, 0xcb, 0xfe, 0x34, 0x84, 0xbd, 0x6c, 0xff, 0xd9, 0x57, 0xff, 0xf8, 0xe5, 0xfb, 0xa7, 0xcf, 0x9f, 0xbc, 0x9a, 0x06, 0x4e, 0x79,
+	0x70, 0x97, 0x27, 0xe2, 0x0f, 0x18, 0x5e, 0xb5, 0xa4, 0x53, 0xcb, 0xd8, 0xea, 0xf7, 0x25, 0xcc, 0x36, 0x9e, 0xcb, 0x62, 0x45, 0xdc, 0xd6, 0x85,
+	0x2f, 0xfc, 0x91, 0xb6, 0x6d, 0x94, 0xe0, 0xa1, 0xaa, 0x41, 0xed, 0x07, 0xfc, 0xcc, 0x8e, 0x1a, 0x9d, 0xc3, 0xf5, 0x8d, 0xa4, 0x52, 0xd6, 0x5e,
+	0x12, 0x38, 0x5b, 0xb4, 0xbc, 0xa3, 0x48, 0x25, 0xee, 0xd7, 0x9b, 0x89, 0x58, 0x58, 0x3b, 0xcf, 0xfd, 0x37, 0xd5, 0x6f, 0x63, 0xf4, 0xaa, 0x46,
+	0xfe, 0x8b, 0x2e, 0x7b, 0xad, 0xb0, 0xb5, 0x4c, 0xed, 0x2f, 0x46, 0x98, 0xa5, 0x6d, 0x55, 0x4a, 0x1d, 0x00, 0xe1, 0x09, 0x81, 0x3e, 0x69, 0x55,
+	0xcf, 0x12, 0x03, 0x67, 0xe6, 0xe7, 0x48, 0xef, 0xab, 0x9b, 0x0a, 0xc7, 0x1e, 0xb6, 0x75, 0x46, 0xdb, 0x8f, 0x37, 0x5b, 0x55, 0x60, 0xb4, 0xf8,
+	0x93, 0xe5, 0x80, 0xd1, 0x67, 0x7f, 0x31, 0xe3, 0x4f, 0x5f, 0x3d, 0xff, 0x2f, 0xae, 0xfc, 0x6f, 0x5f, 0x92, 0xf9, 0x1b, 0xcd, 0x4d, 0xa7, 0xb6,
+	0x30, 0x53, 0x93, 0xa2, 0x37, 0xde, 0xb2, 0x9c, 0xde, 0x46, 0x0d, 0x99, 0xad, 0xde, 0x56, 0xbb, 0xa0, 0x6f, 0x56, 0x43, 0x8a, 0x77, 0xbf, 0xd5,
+	0xaf, 0x13, 0x22, 0xe1, 0xf5, 0x41, 0x3d, 0x93, 0x6c, 0xfd, 0x2a, 0xd8, 0xbf, 0x5f, 0xac, 0x4d, 0xd7, 0x74, 0x70, 0x52, 0xed, 0x75, 0x6e, 0x93,
+	0x7b, 0x96, 0xdb, 0x14, 0x36, 0x8b, 0xc7, 0xf6, 0x35, 0xc5, 0xd1, 0x2e, 0xd9, 0x64, 0x2d, 0x41, 0x77, 0xc7, 0x85, 0x9f, 0xb0, 0xf8, 0xd1, 0xb8,
+	0xb4, 0x2e, 0xe3, 0xdb, 0x25, 0xe1, 0xdb, 0xd9, 0x77, 0xdb, 0xd9, 0x35, 0xc5, 0x7c, 0x7a, 0x15, 0x6c, 0xb9, 0x6a, 0xbd, 0x83, 0x39, 0x5e, 0x5b,
+	0x0c, 0xe0, 0x3d, 0x06, 0x43, 0x75, 0x5d, 0x81, 0xf4, 0xcb, 0xe2, 0xfd, 0x87, 0x9b, 0xec, 0x24, 0x5b, 0xfd, 0xbd, 0x38, 0xd8, 0x2b, 0x13, 0x0e,
+	0xdc, 0x41, 0x38, 0x1c, 0xfa, 0xc3, 0xdb, 0x95, 0x10, 0x59, 0xeb, 0xc5, 0x2e, 0x33, 0xac, 0x5a, 0xa3, 0xb5, 0x67, 0xcb, 0x55, 0xd6, 0xb1, 0xe7,
+	0xab, 0xe6, 0xc8, 0x2e, 0x5c, 0xb3, 0x47, 0xf0, 0x42, 0xc6, 0xec, 0x69, 0x26, 0x09, 0x65, 0x76, 0x16, 0xcf, 0xdb, 0x0f, 0xcc, 0x5b, 0x6c, 0x07,
+	0x1d, 0x77, 0xe2, 0xed, 0xbb, 0xe1, 0x78, 0xdf, 0xdd, 0x77, 0x1d, 0x1c, 0xea, 0x5c, 0x9c, 0x17, 0x15, 0xf4, 0xcc, 0x76, 0xb0, 0xdb, 0x14, 0xd3,
+	0xde, 0xb7, 0x59, 0x52, 0xc3, 0x39, 0xdf, 0x66, 0xf3, 0xf3, 0x5e, 0xf7, 0xc7, 0xf3, 0xce, 0x66, 0xd9, 0x91, 0x3b, 0x77, 0xce, 0x4c, 0x49, 0x6d,
+	0x21, 0x8a, 0x12, 0x77, 0x32, 0xf9, 0xf7, 0x83, 0xdc, 0x5a, 0x4c, 0xea, 0x1b, 0xf3, 0xaa, 0x6a, 0x09, 0xed, 0xde, 0x45, 0x62, 0x6d, 0x53, 0xb9,
+	0x6a, 0xd0, 0x31, 0x1d, 0x75, 0x60, 0xda, 0xa2, 0x63, 0x67, 0xb5, 0x1c, 0x8f, 0x3f, 0x50, 0x61, 0xb1, 0xde, 0xef, 0x98, 0xdf, 0x14, 0x33, 0x17,
+	0xae, 0xcd, 0x6f, 0xc4, 0x46, 0x36, 0xcf, 0x8e, 0x0c, 0x2a, 0x33, 0xe4, 0xdf, 0xcd, 0x36, 0xa7, 0x92, 0x31, 0x96, 0xb0, 0x56, 0x59, 0x7e, 0xb1,
+	0x96, 0x88, 0xb2, 0x18, 0xa9, 0x33, 0x33, 0xde, 0x5b, 0xbb, 0xfc, 0xff, 0x2b, 0xef, 0x59, 0x9b, 0x9b, 0x46, 0xb2, 0xfd, 0x3e, 0xbf, 0x42, 0x5b,
+	0xcb, 0x94, 0xec, 0x89, 0x13, 0xdb, 0x81, 0x64, 0x20, 0x94, 0x67, 0x2e, 0x81, 0x64, 0x86, 0x82, 0x40, 0x2a, 0x4e, 0x96, 0xa9, 0xa5, 0xb2, 0x37,
+	0x8a, 0x2d, 0x13, 0x2d, 0xb2, 0xe5, 0x92, 0xe4, 0x24, 0x06, 0xf2, 0x47, 0xee, 0xa7, 0xfb, 0xdb, 0xee, 0x2f, 0xb9, 0xe7, 0xd1, 0xdd, 0xea, 0x6e,
+	0xb5, 0x2c, 0x19, 0x58, 0xd8, 0xa9, 0xa5, 0x6a, 0x26, 0x56, 0xf7, 0x79, 0xf4, 0xfb, 0x71, 0xce, 0xe9, 0x73, 0x30, 0x1e, 0xa3, 0x43, 0xfe, 0x43,
+	0x08, 0x8d, 0xfa, 0x9a, 0x20, 0x3b, 0xfd, 0x86, 0x0d, 0xc8, 0x74, 0x35, 0x89, 0x05, 0x7d, 0xab, 0xc6, 0xfb, 0x9d, 0xc2, 0xdf, 0xc2, 0x64, 0xee,
+	0xe0, 0x4d, 0x37, 0x0b, 0xe1, 0x14, 0x36, 0xce, 0x3a, 0x70, 0x78, 0x0f, 0x3d, 0x71, 0x5e, 0x42, 0xaf, 0x78, 0x8b, 0x78, 0xec, 0xe1, 0xf3, 0x53,
+	0x68, 0x02, 0xb4, 0x73, 0xf1, 0xe6, 0x01, 0x3e, 0x80, 0xc4, 0x66, 0x3f, 0x3d, 0x7d, 0x25, 0x5a, 0xa5, 0xa8, 0xfa, 0x1c, 0x4e, 0x00, 0xce, 0xaa,
+	0x43, 0xba, 0xb3, 0xea, 0x98, 0xd1, 0xac, 0xea, 0x08, 0xd9, 0xbc, 0xea, 0x44, 0x57, 0x17, 0xd6, 0xe0, 0xf7, 0xe7, 0x57, 0xfd, 0xf8, 0xec, 0xe5,
+	0xcb, 0xff, 0x3e, 0x7e, 0x51, 0x51, 0x7d, 0x55, 0xff, 0x71, 0x98, 0x39, 0xe5, 0x11, 0xcf, 0x20, 0x3d, 0x8d, 0x48, 0xca, 0x54, 0x16, 0xd5, 0xd7,
+	0x54, 0x05, 0x69, 0x1a, 0x12, 0x8f, 0xc8, 0xd9, 0xc2, 0xe1, 0x26, 0xe6, 0x14, 0xd4, 0xf1, 0xeb, 0xbf, 0xc2, 0xdb, 0x00, 0xfd, 0xbb, 0xa3, 0x55,
+	0x50, 0x43, 0x6e, 0x88, 0xa6, 0xaf, 0x5e, 0x71, 0x90, 0xc3, 0xac, 0x99, 0x3a, 0xe5, 0xf8, 0x22, 0xaf, 0xe0, 0x79, 0x30, 0x3c, 0x7e, 0xb8, 0xbd,
+	0xbb, 0xdb, 0x90, 0x95, 0xa4, 0xad, 0xb1, 0x4b, 0xc3, 0x77, 0x91, 0x5b, 0x7a, 0x7a, 0x42, 0x39, 0x1a, 0xab, 0xb3, 0x87, 0xbb, 0x0f, 0x1b, 0x32,
+	0x62, 0xaa, 0x25, 0x36, 0xc5, 0x70, 0x78, 0x99, 0x9c, 0x04, 0x78, 0xd6, 0xe0, 0xf4, 0x20, 0x66, 0x23, 0xb5, 0x10, 0x23, 0xed, 0xa2, 0x77, 0x04,
+	0x5c, 0x2e, 0x3c, 0x12, 0x1c, 0x7b, 0x63, 0xb9, 0x28, 0xec, 0x79, 0x54, 0x82, 0x8e, 0x77, 0x36, 0x7c, 0xd4, 0xdf, 0xe9, 0x78, 0x4f, 0xce, 0xf8,
+	0xcf, 0xf0, 0xd1, 0xf6, 0xfd, 0x8e, 0xf7, 0xfc, 0xd5, 0xc3, 0xdd, 0x1d, 0x2f, 0x49, 0xbd, 0x17, 0x27, 0x8f, 0xb6, 0x7b, 0x6a, 0x78, 0x54, 0x0b,
+	0x87, 0x9f, 0xe2, 0x66, 0xe6, 0xed, 0x7b, 0x0c, 0x91, 0xb9, 0x05, 0xd5, 0xe2, 0xa6, 0xb4, 0x5a, 0x50, 0x5d, 0xd3, 0x16, 0x25, 0xa1, 0xb2, 0x48,
+	0x50, 0x6d, 0x71, 0x30, 0x8d, 0x60, 0x33, 0xc7, 0x99, 0xc0, 0x39, 0x1c, 0x21, 0x3b, 0x14, 0x6d, 0x23, 0x96, 0xd4, 0xfe, 0xf6, 0x43, 0x8f, 0xd6,
+	0xc5, 0xdf, 0x8e, 0x87, 0x5e, 0x1e, 0x4d, 0xc3, 0x0e, 0xac, 0xbd, 0xe1, 0x98, 0xf1, 0x46, 0x18, 0xae, 0x9d, 0xdc, 0xec, 0x5d, 0xa5, 0xc9, 0x2c,
+	0xfa, 0xc0, 0xcb, 0xea, 0xab, 0xd3, 0x63, 0xd5, 0x0e, 0x93, 0x28, 0xce, 0x2b, 0x76, 0x9c, 0x43, 0xce, 0x2a, 0x3a, 0x1a, 0xee, 0x94, 0x4b, 0x5c,
+	0xb8, 0x43, 0x38, 0xde, 0x74, 0x3c, 0x38, 0xc5, 0xc2, 0xd4, 0x85, 0x75, 0x3e, 0x1a, 0x7b, 0xe8, 0xdb, 0xbc, 0x7f, 0x5f, 0x6e, 0x2b, 0x0f, 0x9a,
+	0x6e, 0x2b, 0x82, 0xb9, 0x6e, 0x40, 0x2c, 0x52, 0x54, 0x1b, 0x9c, 0x84, 0xa3, 0x30, 0xba, 0x86, 0x72, 0x4f, 0x70, 0x18, 0x60, 0xad, 0x82, 0x5c,
+	0x69, 0x2b, 0xd4, 0x26, 0xd2, 0xf1, 0x26, 0x51, 0x9a, 0xe5, 0xde, 0x14, 0x1f, 0x02, 0xe3, 0xa6, 0x90, 0x2e, 0xe2, 0x10, 0x76, 0x86, 0x19, 0x0c,
+	0x0e, 0x2a, 0xe7, 0x27, 0x2a, 0xfb, 0x38, 0xbc, 0x46, 0xf3, 0x04, 0x6f, 0x7b, 0xb7, 0xd7, 0xef, 0xef, 0xf7, 0x7a, 0xdd, 0xed, 0x07, 0x1d, 0xa3,
+	0x06, 0x1d, 0xef, 0x9f, 0x09, 0x9c, 0xf9, 0x17, 0x91, 0xf7, 0x73, 0x6f, 0xff, 0xfe, 0xb3, 0x9d, 0x9f, 0x0f, 0x9e, 0xf5, 0xf8, 0xdf, 0x66, 0x91,
+	0x70, 0x48, 0xff, 0x70, 0x48, 0x89, 0xb6, 0xf0, 0x5a, 0xa4, 0x3a, 0xf1, 0xe4, 0xd8, 0xe5, 0x5d, 0xae, 0xbd, 0xe5, 0xbd, 0xc1, 0xad, 0x89, 0xdb,
+	0x09, 0x0b, 0x24, 0xb6, 0xaf, 0xf7, 0x11, 0x39, 0xf7, 0x80, 0xee, 0x11, 0x75, 0xa2, 0x6e, 0x85, 0x6a, 0x61, 0x06, 0xd4, 0x8b, 0x0b, 0x4f, 0x55,
+	0x09, 0x59, 0x33, 0x33, 0x4e, 0x13, 0x38, 0x43, 0x15, 0xdb, 0xda, 0x28, 0x98, 0xe7, 0x8b, 0xd4, 0xf9, 0xe0, 0xe1, 0x29, 0x67, 0x15, 0x9d, 0x96,
+	0xcd, 0xa3, 0xc9, 0x24, 0x93, 0x5d, 0xf3, 0x73, 0xc3, 0x9e, 0x11, 0x1c, 0x74, 0x61, 0xb2, 0x48, 0xd1, 0x7b, 0x06, 0x3d, 0xa8, 0x89, 0x11, 0x69,
+	0xf4, 0x12, 0xd7, 0x0e, 0xef, 0xb1, 0xef, 0x50, 0x7a, 0xe5, 0x05, 0x50, 0x2f, 0x4c, 0x09, 0x61, 0x40, 0xe7, 0x5a, 0x5f, 0x42, 0x55, 0x43, 0x7c,
+	0x65, 0x8a, 0x99, 0x53, 0xde, 0xc8, 0xf3, 0x24, 0x89, 0xb3, 0x2e, 0x27, 0xef, 0x79, 0x5c, 0x78, 0xef, 0x7d, 0x18, 0xce, 0x99, 0x11, 0xcc, 0xb1,
+	0xdc, 0xdb, 0x7d, 0xe0, 0xbd, 0xd8, 0xc7, 0xdd, 0xa2, 0x2b, 0x0a, 0xd5, 0x43, 0x2d, 0x23, 0x71, 0x91, 0x29, 0x7d, 0x4c, 0x31, 0xcf, 0x15, 0x33,
+	0x2e, 0xeb, 0x94, 0x8e, 0x29, 0x1a, 0x17, 0x6f, 0x73, 0x73, 0x94, 0xc4, 0xa8, 0xdc, 0xd8, 0xf2, 0x0e, 0x50, 0x7a, 0x8a, 0x00, 0x59, 0x9e, 0xcc,
+	0x55, 0x73, 0xc7, 0xee, 0x85, 0xe2, 0x25, 0x5c, 0xf9, 0xa2, 0x7c, 0x41, 0xef, 0x8a, 0x4b, 0xbb, 0x69, 0xcc, 0x72, 0x14, 0x6d, 0x2f, 0x3d, 0x8c,
+	0x93, 0x20, 0xb7, 0x76, 0xd2, 0x58, 0x89, 0x15, 0x6b, 0xfa, 0x23, 0x36, 0x16, 0x8a, 0x75, 0x89, 0xc7, 0xee, 0x43, 0xd0, 0x4b, 0xe0, 0x54, 0x59,
+	0xfe, 0xd2, 0x31, 0xc8, 0xc9, 0x22, 0xc8, 0x2b, 0xcb, 0x6f, 0x84, 0xa1, 0xd2, 0xcf, 0x3e, 0xeb, 0x92, 0x0e, 0x62, 0x67, 0xe9, 0x9f, 0xc4, 0xd5,
+	0xa5, 0x0f, 0xe2, 0x26, 0x2c, 0x82, 0x38, 0x6f, 0xd6, 0xfa, 0x48, 0x4e, 0x7b, 0xe1, 0xb4, 0x26, 0xf1, 0xff, 0x80, 0xd8, 0x04, 0x6f, 0x82, 0x99,
+	0x37, 0xe4, 0x53, 0xb9, 0x16, 0x6d, 0x46, 0xbe, 0x3c, 0x88, 0x93, 0x77, 0x7b, 0x8d, 0xa3, 0x14, 0x7c, 0xd1, 0xfb, 0x13, 0x5c, 0x1e, 0x9e, 0x3c,
+	0x7d, 0x31, 0x28, 0xbc, 0xfd, 0x6e, 0xb6, 0xee, 0xff, 0xb4, 0xdb, 0x13, 0x9e, 0x2f, 0xb4, 0xcb, 0xf9, 0x53, 0xe1, 0xf7, 0x85, 0x05, 0x65, 0x75,
+	0x8f, 0x55, 0x82, 0x59, 0xed, 0x2b, 0x95, 0x60, 0x56, 0x2b, 0xd0, 0x33, 0x61, 0x1c, 0x4e, 0x37, 0x18, 0x90, 0x82, 0x8b, 0xe2, 0xcf, 0xad, 0xd9,
+	0x39, 0x25, 0x6d, 0xb1, 0x21, 0xb2, 0x85, 0x6d, 0x69, 0x64, 0xae, 0xd2, 0xf1, 0x4d, 0x5a, 0xab, 0x92, 0x21, 0x28, 0x01, 0x5b, 0xa2, 0x89, 0xcd,
+	0xe1, 0x56, 0xc5, 0x94, 0xdb, 0x55, 0x2e, 0x44, 0xc5, 0x83, 0x0e, 0x9b, 0x5a, 0x1e, 0x8d, 0x6c, 0x2b, 0x5a, 0x48, 0xc2, 0x1b, 0x45, 0x0a, 0xb3,
+	0x67, 0x20, 0x3a, 0xe5, 0xf1, 0x28, 0x0e, 0x83, 0xd4, 0xb4, 0x1e, 0x31, 0x3a, 0x48, 0xc9, 0xab, 0x46, 0xaa, 0xcb, 0x6c, 0x73, 0x13, 0xc8, 0xd3,
+	0xcd, 0x4c, 0x34, 0x2e, 0xd2, 0x8f, 0xdd, 0x1c, 0x95, 0x71, 0x42, 0x80, 0x53, 0x2e, 0xa9, 0x9e, 0x6d, 0x17, 0x19, 0xed, 0x97, 0xb5, 0x5a, 0x93,
+	0x7d, 0x19, 0xec, 0x49, 0x68, 0xaf, 0xbc, 0xa9, 0x37, 0x0d, 0x3f, 0xa7, 0x0e, 0x6e, 0x5f, 0xc2, 0xa9, 0x2c, 0x16, 0x71, 0xa3, 0xa6, 0xd1, 0x8c,
+	0x3f, 0x37, 0xfb, 0xf4, 0x4d, 0x61, 0xe3, 0x39, 0x45, 0x42, 0x6e, 0x4a, 0x18, 0x06, 0x80, 0x5a, 0x9d, 0xc0, 0xe6, 0x3f, 0x28, 0x20, 0xe5, 0xe0,
+	0x65, 0x03, 0x59, 0x38, 0xa2, 0xc3, 0x2a, 0x03, 0xc7, 0xb8, 0x01, 0x16, 0xa2, 0x2b, 0xe1, 0x45, 0xb1, 0xe0, 0x62, 0x13, 0xc2, 0xfe, 0x3a, 0x38,
+	0x0a, 0xf2, 0xab, 0xad, 0x49, 0x9c, 0xc0, 0x90, 0x2e, 0x30, 0x7e, 0x2a, 0x68, 0x8a, 0xb7, 0xdf, 0x21, 0xcc, 0x74, 0x8c, 0x50, 0x65, 0x95, 0x48,
+	0xd1, 0x61, 0x2b, 0x6b, 0xca, 0x24, 0x8a, 0x00, 0xd1, 0x92, 0xc5, 0xed, 0x70, 0x4a, 0x84, 0x01, 0xc4, 0x74, 0x32, 0x1d, 0x49, 0xa6, 0x6d, 0xcc,
+	0xb6, 0x22, 0xba, 0x17, 0x65, 0xb6, 0x62, 0x2e, 0x86, 0xdd, 0x11, 0x7f, 0x46, 0x2b, 0x72, 0x73, 0xde, 0x97, 0x35, 0x71, 0x4a, 0x71, 0xc5, 0x46,
+	0x13, 0x9c, 0x2b, 0x05, 0x8d, 0x65, 0x8b, 0x53, 0x5b, 0x29, 0x85, 0xf2, 0x21, 0x33, 0x49, 0x4a, 0x5e, 0x2c, 0x9b, 0x51, 0xbc, 0x9a, 0x4a, 0x95,
+	0x9a, 0x64, 0x63, 0x82, 0xd0, 0x7d, 0xd2, 0x22, 0x2f, 0xef, 0x7d, 0x66, 0x72, 0x5c, 0xe8, 0x88, 0x2a, 0x68, 0xe1, 0x1e, 0x6e, 0xa6, 0xe0, 0xae,
+	0x68, 0x69, 0x0e, 0x49, 0xc6, 0x61, 0x6b, 0x13, 0xf1, 0xf2, 0x6f, 0xa6, 0x89, 0x2b, 0x60, 0x03, 0x85, 0xa2, 0xbc, 0x1d, 0x58, 0x7a, 0x4b, 0x71,
+	0x32, 0x95, 0x25, 0x16, 0x9a, 0x4f, 0xcd, 0x80, 0xd6, 0xe8, 0xa3, 0xaf, 0x60, 0x39, 0x1b, 0xcc, 0x2a, 0x15, 0x8b, 0x9a, 0x89, 0xff, 0x0f, 0x00,
+	0xa7, 0x9c, 0x25, 0x6a, 0x0a, 0x44, 0xdd, 0xb6, 0xd5, 0x04, 0x26, 0x11, 0x68, 0x91, 0x67, 0x23, 0xe8, 0x83, 0x81, 0x11, 0x48, 0xa2, 0x69, 0xc8,
+	0x28, 0x2d, 0xc5, 0x9d, 0x35, 0x58, 0x18, 0x4b, 0x4a, 0x19, 0x0d, 0x88, 0x92, 0xe1, 0xa6, 0x36, 0xa0, 0x18, 0x8d, 0x24, 0x2a, 0x45, 0x9e, 0x8d,
+	0xa0, 0x0f, 0x2f, 0x46, 0x20, 0xf9, 0x48, 0x91, 0x57, 0xaa, 0x8e, 0x35, 0xf8, 0x44, 0x95, 0xa4, 0x98, 0xc3, 0x84, 0xb1, 0x91, 0xcd, 0x41, 0xc3,
+	0xa8, 0x42, 0x64, 0xa1, 0xe7, 0xdb, 0x68, 0xb6, 0x02, 0x14, 0xd1, 0xaa, 0x35, 0xa0, 0x0a, 0xcd, 0x1a, 0x78, 0x8c, 0x27, 0xaf, 0xce, 0x06, 0x84,
+	0x8d, 0x69, 0x0d, 0x4e, 0xc6, 0x94, 0xf7, 0x37, 0x03, 0xc2, 0xc6, 0x8c, 0xed, 0x72, 0xc6, 0xb2, 0x90, 0xb1, 0xa3, 0x84, 0xda, 0x84, 0x14, 0xd0,
+	0x81, 0x18, 0x19, 0xe2, 0xb8, 0x6d, 0x40, 0x6b, 0x93, 0x95, 0xa1, 0xf1, 0x8c, 0xad, 0x1f, 0x6e, 0x0d, 0x68, 0x63, 0x22, 0x8b, 0x61, 0x4d, 0x82,
+	0x55, 0x5a, 0x89, 0x4d, 0xb9, 0xa9, 0x89, 0xa8, 0xcf, 0x76, 0x81, 0x48, 0x62, 0x49, 0x0d, 0x51, 0x4a, 0x1d, 0x85, 0x4e, 0xd7, 0x9a, 0xab, 0xa6,
+	0x79, 0x08, 0x10, 0xe0, 0x27, 0xa9, 0xfc, 0x6a, 0x14, 0x3f, 0x7f, 0x90, 0xb3, 0x8b, 0xd4, 0xeb, 0x3c, 0xe3, 0xc4, 0x53, 0x51, 0xd4, 0x1b, 0x18,
+	0x50, 0x34, 0xa9, 0x14, 0x1c, 0x7e, 0x31, 0x24, 0xc9, 0xff, 0x0d, 0x48, 0x9a, 0x4d, 0x0a, 0x12, 0xbf, 0xc4, 0x23, 0x51, 0x21, 0x7f, 0x37, 0x80,
+	0xe5, 0x0c, 0x52, 0xf0, 0x22, 0x81, 0x51, 0xe0, 0xc0, 0x52, 0x85, 0x20, 0x4d, 0x73, 0x2e, 0x00, 0x66, 0xcf, 0xbb, 0xf7, 0x91, 0x3a, 0x02, 0xc1,
+	0x61, 0xbe, 0xcc, 0x5b, 0xc1, 0xe0, 0x97, 0xa0, 0x0b, 0x0d, 0xb5, 0xe1, 0xff, 0xe8, 0xb7, 0xb7, 0x50, 0x2e, 0xd1, 0xf2, 0x3d, 0xbf, 0x7d, 0xe7,
+	0xa5, 0x79, 0x2e, 0xa1, 0xe1, 0x67, 0xa6, 0x67, 0x4d, 0xb3, 0x0b, 0xf1, 0xc4, 0x13, 0x66, 0xa8, 0xc9, 0x94, 0xe6, 0xac, 0x2a, 0x22, 0x7e, 0xc9,
+	0x97, 0xa9, 0x51, 0x6c, 0x42, 0xd2, 0x64, 0x55, 0x90, 0xf8, 0x25, 0x9a, 0x49, 0x0a, 0x19, 0xcd, 0xa6, 0x92, 0x33, 0xb4, 0x68, 0x2e, 0x91, 0xc2,
+	0x58, 0x3c, 0x11, 0x4d, 0x1c, 0x31, 0x39, 0x15, 0x06, 0x7f, 0x33, 0xbc, 0xb0, 0xcd, 0x34, 0xe0, 0x75, 0x9b, 0x9c, 0x62, 0xc6, 0x32, 0xbc, 0x98,
+	0x78, 0x26, 0x82, 0x9c, 0x8d, 0x0a, 0x43, 0x24, 0x88, 0x91, 0x11, 0xe5, 0x15, 0xf0, 0xaa, 0x47, 0x10, 0x44, 0x36, 0x32, 0xfe, 0xd6, 0x1b, 0x79,
+	0x31, 0x63, 0xd9, 0xcc, 0x58, 0x02, 0xa8, 0x84, 0x3b, 0xd1, 0xfa, 0x62, 0x4a, 0x9b, 0x3c, 0xe4, 0x3c, 0x57, 0x65, 0x12, 0x09, 0x06, 0xca, 0xd8,
+	0x8d, 0xa3, 0xca, 0x95, 0xb2, 0xd0, 0x45, 0x72, 0x96, 0x58, 0x6f, 0x7b, 0xe7, 0x77, 0x14, 0xdc, 0xb3, 0x94, 0xd1, 0x87, 0x8c, 0x9b, 0x14, 0xc5,
+	0x2e, 0xb3, 0x52, 0xde, 0x36, 0xe4, 0x5d, 0x2e, 0xf3, 0x50, 0x0e, 0x9a, 0xd8, 0x6e, 0xf7, 0x58, 0x6f, 0xf4, 0x58, 0xb6, 0x38, 0x74, 0xaf, 0x05,
+	0x16, 0x68, 0x93, 0x85, 0xee, 0xed, 0x34, 0xf0, 0x63, 0x0b, 0x0c, 0x97, 0x16, 0x05, 0x46, 0xd7, 0x63, 0x9a, 0xca, 0x38, 0xc7, 0x25, 0x20, 0xab,
+	0xfd, 0x69, 0x6d, 0x69, 0xa9, 0x65, 0xa6, 0x4b, 0x97, 0x37, 0x38, 0xd7, 0x1d, 0x46, 0xb7, 0xe1, 0xb8, 0xb5, 0x6d, 0xa8, 0x50, 0x88, 0x20, 0xfd,
+	0x14, 0x0f, 0x8d, 0x7d, 0x5a, 0x51, 0x4c, 0x82, 0xb4, 0xe6, 0xb4, 0xd4, 0xf2, 0x53, 0x45, 0x90, 0x96, 0x22, 0x26, 0x88, 0x3f, 0x25, 0x41, 0x38,
+	0x54, 0x1a, 0xe4, 0x1c, 0x57, 0x02, 0x3c, 0x88, 0x3f, 0x93, 0xd7, 0x82, 0xd6, 0x06, 0x72, 0x82, 0x5f, 0xd6, 0xa5, 0x74, 0x43, 0xcc, 0xef, 0x0d,
+	0x09, 0xad, 0x6e, 0x36, 0x2d, 0xc1, 0x8a, 0x16, 0x0f, 0xd2, 0xd0, 0x7e, 0xac, 0x50, 0xf5, 0x5e, 0x2c, 0xe6, 0x7b, 0xdc, 0x8b, 0x9c, 0x97, 0xde,
+	0xce, 0x2e, 0xef, 0xd0, 0x05, 0x24, 0x0a, 0xb8, 0x72, 0x2b, 0x6b, 0x72, 0xc3, 0x59, 0x28, 0x29, 0x37, 0xb2, 0xc6, 0x37, 0x12, 0x4b, 0x48, 0xe4,
+	0x8c, 0xdc, 0x5c, 0xd1, 0x1c, 0x2f, 0xf2, 0xa5, 0x89, 0x08, 0x09, 0xd8, 0x7a, 0x77, 0x3f, 0x52, 0xbe, 0x10, 0x91, 0x1b, 0x20, 0x97, 0x23, 0x85,
+	0xcd, 0x52, 0x4b, 0x93, 0x00, 0xa4, 0xdd, 0x5d, 0xd0, 0x33, 0x52, 0x63, 0xa1, 0x77, 0x1b, 0x53, 0x58, 0x9b, 0xc1, 0x55, 0x72, 0x73, 0x54, 0x19,
+	0xbf, 0xd8, 0x76, 0x0c, 0x7f, 0x24, 0x1d, 0x55, 0xf1, 0x5f, 0x61, 0x78, 0xca, 0x06, 0x1a, 0x27, 0x87, 0x47, 0xdf, 0xd6, 0x40, 0x03, 0x18, 0xfe,
+	0xab, 0x0d, 0x34, 0x4e, 0x82, 0x71, 0x94, 0x78, 0x87, 0xe4, 0xa6, 0x76, 0x36, 0x5a, 0x7a, 0x47, 0xc9, 0x18, 0x6e, 0x86, 0x4d, 0x4c, 0x35, 0x98,
+	0x18, 0x87, 0xb2, 0xba, 0x89, 0xc6, 0xf9, 0xd5, 0x00, 0x56, 0xa3, 0x78, 0x84, 0xf7, 0xac, 0x1f, 0xbd, 0x4d, 0xaf, 0xbf, 0xb5, 0x1d, 0x4e, 0xdb,
+	0xfe, 0xf7, 0x92, 0x65, 0x7d, 0x45, 0xcf, 0x56, 0x9c, 0xc0, 0x57, 0x51, 0x8a, 0xd1, 0x6d, 0xb6, 0x20, 0x0a, 0x6d, 0x22, 0xbe, 0x2c, 0xfb, 0x0e,
+	0x8c, 0x39, 0xd9, 0x27, 0x0a, 0x43, 0xa1, 0x22, 0x0e, 0x3b, 0x0a, 0x8f, 0x13, 0xb4, 0x19, 0xf2, 0xff, 0xda, 0x3b, 0xec, 0x09, 0xc4, 0x09, 0x74,
+	0x83, 0x53, 0xa5, 0x52, 0x74, 0x0f, 0x06, 0x85, 0x2d, 0xa9, 0x1f, 0xad, 0x2a, 0x20, 0x19, 0x5d, 0x39, 0x82, 0x9f, 0xf5, 0x92, 0x47, 0x04, 0xd3,
+	0x31, 0x94, 0xc4, 0xfe, 0x14, 0xdf, 0x73, 0x44, 0x99, 0x50, 0x3d, 0xc8, 0x92, 0xe0, 0x97, 0x7b, 0xf0, 0x20, 0xec, 0x68, 0x91, 0xe2, 0x14, 0x88,
+	0x97, 0x5e, 0x32, 0x0f, 0xd3, 0x80, 0x3c, 0x32, 0xe7, 0x5b, 0x9a, 0xb7, 0xa9, 0xcf, 0xb0, 0x1f, 0x19, 0xd9, 0x16, 0x20, 0xeb, 0x39, 0xde, 0x72,
+	0x5a, 0x8f, 0x4c, 0xa3, 0x59, 0x55, 0xa3, 0x1f, 0x3d, 0xf9, 0xa3, 0xa8, 0x5a, 0xb9, 0xd1, 0x05, 0x66, 0x51, 0x0e, 0x72, 0x6f, 0x00, 0x77, 0xfd,
+	0x96, 0xbf, 0x8f, 0x1d, 0x1c, 0xa4, 0x4b, 0x77, 0xc1, 0x0d, 0xd7, 0xa0, 0x05, 0x11, 0x8b, 0x6c, 0x7d, 0x7f, 0x09, 0x48, 0x0b, 0x4f, 0xf6, 0xda,
+	0x05, 0x8c, 0x14, 0x94, 0x24, 0x91, 0x7a, 0x03, 0x9f, 0x96, 0xa0, 0x42, 0x88, 0x74, 0x82, 0x5c, 0xb8, 0x28, 0xcc, 0x56, 0x75, 0x21, 0x46, 0x16,
+	0xa7, 0x9e, 0xcb, 0x43, 0xec, 0x38, 0x52, 0x95, 0x43, 0xb7, 0xbe, 0x4b, 0xb0, 0x27, 0x51, 0x13, 0x12, 0xc6, 0xb1, 0xa1, 0x6c, 0x37, 0x07, 0x47,
+	0x94, 0x4b, 0xed, 0xfb, 0x22, 0x0b, 0x11, 0x1e, 0x37, 0x0c, 0xef, 0xd9, 0xeb, 0x37, 0xaf, 0x84, 0xfa, 0x3d, 0xeb, 0x78, 0xd1, 0x04, 0xc0, 0xfc,
+	0xcc, 0x4b, 0x16, 0x79, 0x16, 0x8d, 0x43, 0x7e, 0x36, 0x54, 0x94, 0xce, 0xd4, 0xe5, 0xdf, 0x44, 0xc0, 0x2f, 0x98, 0x65, 0x37, 0x61, 0x4a, 0x65,
+	0x21, 0xa5, 0x0f, 0x94, 0xd1, 0x5f, 0xcc, 0xb2, 0xc5, 0x1c, 0x4f, 0xda, 0xa4, 0x1f, 0x92, 0xfc, 0xc9, 0x91, 0xaf, 0xbf, 0x75, 0xa1, 0x34, 0xee,
+	0xb7, 0x95, 0xbd, 0xfc, 0xfc, 0xd5, 0xca, 0x5e, 0x66, 0xcc, 0x2f, 0xec, 0xe5, 0x82, 0x88, 0x45, 0xb6, 0x41, 0x2f, 0x33, 0xa4, 0x9c, 0xe9, 0xb7,
+	0xf3, 0x1b, 0x57, 0x2d, 0x4e, 0xff, 0xf0, 0xe6, 0x18, 0xaa, 0xc4, 0xe5, 0xaa, 0x16, 0x71, 0xf4, 0xd7, 0x32, 0x14, 0xee, 0xbb, 0xb6, 0xcc, 0x84,
+	0xa5, 0x39, 0xad, 0xc5, 0x4f, 0xe7, 0x8a, 0x20, 0x02, 0x01, 0x30, 0x7f, 0x4a, 0x99, 0xf2, 0x10, 0x12, 0x03, 0x20, 0x9c, 0x62, 0xd7, 0x63, 0x7f,
+	0x69, 0x7a, 0x48, 0xa7, 0xcd, 0xdd, 0xd3, 0x27, 0xcf, 0xdc, 0x5a, 0x73, 0x80, 0xaf, 0x51, 0x99, 0xdb, 0x10, 0xf2, 0xa1, 0x9a, 0xe6, 0x39, 0xad,
+	0xba, 0xaa, 0x88, 0xac, 0x2b, 0x2c, 0xc7, 0xc5, 0x24, 0x82, 0x22, 0xe1, 0xf6, 0x81, 0x3a, 0x40, 0xb8, 0x9a, 0x50, 0x24, 0xde, 0x59, 0x18, 0x7b,
+	0x4f, 0xe0, 0x08, 0x70, 0x1d, 0xe5, 0x4b, 0xef, 0x59, 0x98, 0xb3, 0xd2, 0xa2, 0x63, 0xbc, 0x7a, 0x83, 0xa3, 0x53, 0x98, 0xcd, 0x7c, 0x98, 0x04,
+	0x8b, 0x79, 0x32, 0x4f, 0xe1, 0x28, 0x99, 0x77, 0x3c, 0x6a, 0x05, 0x18, 0xc5, 0x97, 0x21, 0x3e, 0x76, 0x87, 0xe1, 0x8a, 0x93, 0xd3, 0x9b, 0x2c,
+	0xf0, 0x50, 0xed, 0xa5, 0xd0, 0x6b, 0x41, 0x16, 0xaa, 0x11, 0x9b, 0x4d, 0xdc, 0xcf, 0x62, 0x86, 0x73, 0x74, 0xe7, 0x8f, 0x93, 0xf0, 0x30, 0x18,
+	0xe1, 0x6e, 0xe8, 0xe8, 0x70, 0xc4, 0xd5, 0x3b, 0x9c, 0xe2, 0xa9, 0xd7, 0x76, 0x38, 0x61, 0x69, 0xbb, 0x1e, 0x7e, 0x3a, 0x3b, 0xdc, 0x2e, 0x42,
+	0xcd, 0x4e, 0xa0, 0x96, 0x0c, 0xb1, 0x12, 0x08, 0x9d, 0xaf, 0x5c, 0x07, 0x70, 0x19, 0xc0, 0x56, 0x46, 0xe2, 0x8b, 0x74, 0x06, 0xcd, 0xf2, 0xfa,
+	0xf0, 0xd0, 0x6b, 0xdd, 0x44, 0xa3, 0x2b, 0xfb, 0x2d, 0x21, 0xc2, 0x64, 0x39, 0x36, 0xa1, 0x36, 0xe9, 0xdb, 0x0d, 0xd6, 0xa6, 0x9b, 0x2b, 0xa4,
+	0x36, 0x3c, 0x6c, 0xb0, 0x2c, 0xa9, 0x31, 0x9a, 0x5d, 0x3a, 0x27, 0xda, 0x3e, 0x2e, 0xa7, 0x6f, 0xf0, 0xb4, 0xe3, 0x6c, 0xf9, 0x4b, 0x63, 0xa6,
+	0x61, 0x44, 0xf7, 0xfa, 0x76, 0xbf, 0xd4, 0xe7, 0x19, 0x7e, 0x39, 0x5b, 0x1d, 0x19, 0xd3, 0x29, 0xeb, 0x4f, 0xd0, 0xdc, 0x48, 0xac, 0x28, 0xaf,
+	0x51, 0xf5, 0x75, 0xba, 0x60, 0x2e, 0xec, 0xe5, 0x5d, 0x86, 0x4b, 0x30, 0x04, 0xa7, 0xf8, 0xdc, 0xf4, 0x25, 0x81, 0x94, 0xd7, 0x6d, 0x81, 0xeb,
+	0x5a, 0xb7, 0x87, 0x57, 0x28, 0xb7, 0xa9, 0xed, 0x17, 0x8d, 0x82, 0x45, 0xb3, 0x91, 0x49, 0x27, 0xc3, 0x76, 0xfa, 0x16, 0x6e, 0xa9, 0x6f, 0x61,
+	0x0f, 0x93, 0x0f, 0xda, 0xcc, 0x96, 0xea, 0xa8, 0x95, 0x95, 0xa4, 0x5c, 0xb2, 0xd5, 0xd0, 0x3a, 0xb2, 0xe3, 0x2d, 0xe1, 0x36, 0xb2, 0x4c, 0x16,
+	0xb4, 0x4d, 0x8b, 0x60, 0xab, 0xd0, 0x8a, 0xd0, 0xb7, 0x98, 0x88, 0x76, 0x3c, 0xc5, 0x38, 0xae, 0x8a, 0x94, 0x3e, 0xc4, 0x47, 0x69, 0x6f, 0xf8,
+	0xf5, 0xb6, 0xfd, 0xf2, 0x5c, 0xc6, 0x33, 0xff, 0xcc, 0xa6, 0xb3, 0xe3, 0xa1, 0xab, 0x40, 0x59, 0x5a, 0xb3, 0xed, 0x2f, 0xf3, 0xd0, 0x6a, 0x33,
+	0x02, 0x33, 0x50, 0xbe, 0x79, 0x6b, 0xcd, 0x23, 0xf1, 0xe6, 0xd1, 0x3a, 0x8f, 0x1e, 0xc3, 0x29, 0x41, 0x7f, 0xf7, 0xa8, 0x81, 0x57, 0x1d, 0x44,
+	0xbd, 0x63, 0xc8, 0xac, 0x38, 0x8d, 0x4a, 0xbc, 0xef, 0xa5, 0x77, 0x17, 0xd5, 0xd1, 0xa6, 0x65, 0x6b, 0xfd, 0xa7, 0xdd, 0xf2, 0x6e, 0x47, 0x95,
+	0x59, 0xad, 0x9c, 0xff, 0xfa, 0xd7, 0xbf, 0x12, 0xd3, 0x92, 0x43, 0xff, 0x28, 0x4b, 0xdc, 0xe7, 0xbd, 0xe1, 0x6b, 0x63, 0xe9, 0xd6, 0x9f, 0x96,
+	0x22, 0x92, 0xbe, 0x80, 0x1f, 0x0c, 0x8f, 0xb7, 0xa0, 0xad, 0x86, 0xed, 0x0a, 0xa6, 0x04, 0xaf, 0x9d, 0xea, 0x92, 0x2c, 0x72, 0xf2, 0x7c, 0x3d,
+	0x7c, 0x5e, 0xcd, 0x13, 0x90, 0xd6, 0xe2, 0x89, 0xf0, 0xda, 0xdc, 0x1a, 0x39, 0x9f, 0x02, 0x0f, 0x9f, 0xbe, 0xa8, 0xe4, 0x08, 0x28, 0xeb, 0x30,
+	0x44, 0x70, 0xed, 0xf9, 0xb1, 0xdb, 0x23, 0x04, 0x24, 0xbb, 0x36, 0x44, 0x48, 0x5e, 0x87, 0xd5, 0xcc, 0x70, 0xe1, 0x90, 0xba, 0x0d, 0xfb, 0xd3,
+	0x10, 0x96, 0x05, 0x17, 0xb3, 0x94, 0x97, 0xa9, 0xa6, 0xcc, 0x52, 0x69, 0xe4, 0x5f, 0x3c, 0x42, 0xef, 0xe1, 0x23, 0xf4, 0x1d, 0x7a, 0x83, 0xce,
+	0x9e, 0xdf, 0xa2, 0xe4, 0x96, 0xf4, 0x1b, 0x6f, 0x2f, 0xe0, 0xe7, 0xbd, 0x8f, 0xd1, 0xdd, 0xc5, 0xb9, 0xa3, 0x48, 0x2a, 0xd3, 0x68, 0xf1, 0xbf,
+	0xfc, 0x25, 0x6a, 0x3f, 0x46, 0x0a, 0x0d, 0x0b, 0x45, 0xa0, 0xfc, 0x82, 0xf9, 0x87, 0xff, 0x14, 0x03, 0xa0, 0xaa, 0xdb, 0xe7, 0xb7, 0xb4, 0x00,
+	0xaa, 0x31, 0xe2, 0x39, 0x39, 0x3c, 0xaa, 0x33, 0xe2, 0x31, 0x40, 0x9c, 0x46, 0x3c, 0xd5, 0x2e, 0x1c, 0x4f, 0xfe, 0xe8, 0xc2, 0xe5, 0xad, 0xe4,
+	0x6c, 0xd5, 0x24, 0x59, 0x8e, 0x2a, 0xb4, 0x82, 0xe0, 0xe1, 0x91, 0xdd, 0x8c, 0x48, 0x55, 0x6e, 0x5f, 0xe4, 0x83, 0xa4, 0x4c, 0xdf, 0x1d, 0x77,
+	0xa8, 0x9a, 0x8b, 0xbf, 0xc1, 0x20, 0x0e, 0x52, 0xe5, 0xf8, 0x43, 0xd5, 0x64, 0xd0, 0x68, 0x44, 0x96, 0x0b, 0xae, 0xef, 0xc9, 0x54, 0xd8, 0xe3,
+	0x77, 0xf0, 0xdc, 0x2a, 0xf6, 0x5b, 0x38, 0x65, 0xba, 0x83, 0xd8, 0x39, 0x62, 0x15, 0x6d, 0x8b, 0x48, 0x45, 0x76, 0x99, 0x2a, 0x4c, 0xa6, 0x48,
+	0x2c, 0x8f, 0x63, 0x96, 0xcd, 0xa6, 0xf4, 0x28, 0xab, 0x6c, 0x40, 0x45, 0xe1, 0x79, 0x5b, 0x08, 0x22, 0x77, 0xbf, 0xb6, 0x15, 0x4e, 0x69, 0x96,
+	0x78, 0xd3, 0x30, 0xbf, 0x4a, 0xa0, 0xf8, 0x28, 0x0f, 0xd8, 0xf3, 0xfc, 0x72, 0xb0, 0x22, 0x39, 0xa3, 0xdf, 0x22, 0xa1, 0x73, 0xcd, 0xf2, 0xc9,
+	0x2c, 0xe6, 0x9f, 0xd0, 0x8c, 0xc5, 0x1a, 0xf9, 0x59, 0x85, 0x07, 0x4d, 0xc3, 0x7e, 0x85, 0x04, 0x1f, 0x96, 0x89, 0x89, 0x10, 0x5e, 0xd9, 0x86,
+	0x27, 0xb7, 0x8e, 0x54, 0xba, 0x98, 0x5a, 0x49, 0x70, 0x69, 0xb2, 0x0d, 0x54, 0xf8, 0xb8, 0x6d, 0xc1, 0xd1, 0xa1, 0xd2, 0x66, 0x0d, 0x5b, 0xb8,
+	0x95, 0x84, 0x3b, 0xac, 0x85, 0x39, 0xb2, 0xbd, 0xb2, 0xcd, 0x4a, 0xef, 0xe0, 0xd3, 0xc2, 0x2c, 0xc3, 0xbd, 0xa5, 0xfc, 0xe0, 0xb4, 0x89, 0xd1,
+	0xb6, 0x96, 0x6a, 0x53, 0x14, 0xb3, 0x9d, 0xbf, 0xdc, 0x14, 0x25, 0x9d, 0x4c, 0x4b, 0xa6, 0x28, 0x90, 0xc6, 0x02, 0x68, 0xed, 0xf7, 0x16, 0xca,
+	0x71, 0x07, 0x34, 0xe6, 0x94, 0xea, 0x5d, 0x0a, 0xae, 0x50, 0xf3, 0x8e, 0x36, 0x23, 0x0a, 0x16, 0x7a, 0xd1, 0x02, 0xd5, 0x84, 0x99, 0x65, 0xe8,
+	0xe0, 0xd6, 0x86, 0x2e, 0x84, 0x62, 0x3a, 0x34, 0x4a, 0x8b, 0xf8, 0x57, 0x36, 0x19, 0x14, 0x43, 0xa0, 0x30, 0x5a, 0xa1, 0xac, 0x4b, 0xe1, 0x9e,
+	0x0c, 0xc7, 0x82, 0x99, 0x25, 0xaf, 0x91, 0xf6, 0x1d, 0x8e, 0x2c, 0x07, 0x08, 0x57, 0xa2, 0x1a, 0xf1, 0x7c, 0x09, 0x15, 0xaf, 0x03, 0xa2, 0x39,
+	0x68, 0xab, 0xa6, 0x53, 0x65, 0x31, 0x6e, 0x2c, 0x46, 0x04, 0x81, 0x67, 0xc0, 0x62, 0x18, 0x39, 0x20, 0x32, 0xe5, 0x5f, 0x7c, 0xf4, 0xde, 0x95,
+	0x3f, 0x93, 0x4e, 0x02, 0x66, 0x85, 0x8f, 0x00, 0x3d, 0x3f, 0x95, 0xc6, 0x3e, 0x69, 0x96, 0xbb, 0xf2, 0x61, 0x38, 0x99, 0xae, 0x75, 0xf4, 0x21,
+	0xa8, 0x43, 0xe1, 0x66, 0x66, 0x8f, 0x40, 0x3d, 0x52, 0x89, 0xbd, 0x88, 0x7e, 0xb1, 0x2f, 0x0f, 0x6b, 0x14, 0xaf, 0xf2, 0xe1, 0xb1, 0x5a, 0xe7,
+	0x62, 0xb8, 0x69, 0xfe, 0xd5, 0xd0, 0xc0, 0xec, 0xf9, 0x68, 0x83, 0xff, 0x79, 0xaa, 0x18, 0x8b, 0x2c, 0x29, 0x66, 0xf6, 0xfc, 0xbf, 0x1e, 0xf6,
+	0x74, 0xfd, 0x8c, 0xe1, 0x5f, 0x43, 0xcd, 0x91, 0xae, 0x18, 0xc9, 0x96, 0x34, 0xbe, 0x04, 0x0b, 0x19, 0x36, 0xa8, 0x18, 0xf5, 0x65, 0xd0, 0xe0,
+	0xd6, 0x02, 0x45, 0xd1, 0xa4, 0xe1, 0xb9, 0x24, 0x18, 0xeb, 0xe2, 0x59, 0x3d, 0x0b, 0x13, 0x74, 0x49, 0x9e, 0xe1, 0x33, 0x64, 0x82, 0x5e, 0x41,
+	0xd4, 0x6c, 0x31, 0xb2, 0x2e, 0x6f, 0x2c, 0x81, 0x85, 0x9e, 0x3b, 0x37, 0x5c, 0xcb, 0xdc, 0xa8, 0xf6, 0xba, 0xf9, 0xf4, 0xc9, 0xef, 0xfb, 0xfa,
+	0xc5, 0x9d, 0x9d, 0x56, 0xf4, 0x6e, 0xfd, 0x8d, 0x8b, 0x7b, 0x1f, 0x33, 0xdc, 0x95, 0xc4, 0x5e, 0xd4, 0xdf, 0x6d, 0xdf, 0x5d, 0xc0, 0x78, 0x19,
+	0x0f, 0xf3, 0x20, 0xcd, 0x5b, 0xdb, 0x1d, 0x1f, 0xce, 0x3b, 0xfa, 0xed, 0xcb, 0xe0, 0x27, 0xa7, 0x9c, 0x7e, 0x55, 0x2a, 0x03, 0x40, 0xaa, 0x76,
+	0xb3, 0x29, 0xe5, 0x67, 0xca, 0x18, 0x78, 0x96, 0x65, 0xe5, 0xec, 0x99, 0x0a, 0xce, 0x9d, 0x4a, 0x33, 0x1f, 0x3d, 0x3b, 0x45, 0x6b, 0x1f, 0x73,
+	0x2e, 0xe9, 0xd9, 0x30, 0x73, 0x84, 0x63, 0x81, 0xd5, 0xb7, 0x06, 0x72, 0xaf, 0x0c, 0xe9, 0x0a, 0x62, 0x60, 0x51, 0xc1, 0x73, 0x24, 0xdd, 0x00,
+	0xd8, 0x69, 0x7a, 0x94, 0x90, 0x77, 0x71, 0x7b, 0xca, 0x7c, 0x35, 0x55, 0xb6, 0x21, 0x7e, 0x29, 0x68, 0x45, 0xe2, 0x5e, 0xd3, 0xc1, 0xb5, 0xbc,
+	0x87, 0x56, 0xb9, 0x83, 0xed, 0x9d, 0x1d, 0xe9, 0x13, 0x5a, 0x64, 0x0e, 0xe4, 0x0f, 0x35, 0xd6, 0x07, 0xf0, 0x9f, 0x1a, 0xcd, 0x68, 0x12, 0xfc,
+	0xd8, 0x40, 0x30, 0x44, 0xf3, 0x59, 0x1e, 0xce, 0x07, 0xfd, 0x15, 0x00, 0x06, 0x3d, 0x37, 0x84, 0x60, 0x72, 0xf7, 0xd8, 0xa8, 0x46, 0x33, 0x7f,
+	0xcc, 0x0b, 0x61, 0x3f, 0xa7, 0x28, 0x17, 0x4b, 0x1e, 0xe7, 0x2a, 0xa3, 0x65, 0x59, 0xbb, 0xc2, 0x68, 0x99, 0x00, 0x3a, 0xb2, 0xa2, 0xed, 0xb6,
+	0xc0, 0xb8, 0xe8, 0xdd, 0xde, 0xfb, 0x48, 0x3f, 0x8d, 0x81, 0xae, 0x0f, 0x73, 0x0f, 0xc7, 0xf9, 0xdd, 0x85, 0x55, 0x29, 0xf4, 0xf6, 0x42, 0x78,
+	0xed, 0xd5, 0x75, 0x59, 0x34, 0xaa, 0x88, 0xde, 0x44, 0xa2, 0x34, 0x69, 0x34, 0xe5, 0xcd, 0x41, 0x39, 0x6e, 0x22, 0x07, 0x8a, 0x48, 0x41, 0xbc,
+	0x3a, 0x13, 0x8e, 0x0e, 0xca, 0x8e, 0x50, 0xdc, 0x26, 0x0d, 0xbe, 0x89, 0xe6, 0x7f, 0x91, 0x79, 0x83, 0x45, 0xeb, 0xcb, 0xc2, 0x23, 0x92, 0x5f,
+	0x5a, 0x19, 0x1c, 0x51, 0x88, 0x0a, 0x30, 0xcd, 0x19, 0x14, 0x11, 0x33, 0xaa, 0xa2, 0x10, 0x92, 0x43, 0x51, 0x8a, 0x43, 0x48, 0xb1, 0x31, 0x75,
+	0xc9, 0x09, 0x1e, 0x9b, 0x90, 0x05, 0xcc, 0x4a, 0x29, 0x8c, 0x98, 0xa8, 0x67, 0xb9, 0xb8, 0xb5, 0xae, 0x17, 0x09, 0x11, 0x30, 0xaa, 0x0a, 0x21,
+	0x88, 0x75, 0xc8, 0x04, 0xc4, 0xf0, 0x5d, 0x80, 0x56, 0xc4, 0x54, 0xcd, 0x60, 0x26, 0x6b, 0x19, 0x28, 0x15, 0x39, 0x5a, 0xcc, 0xac, 0x57, 0x06,
+	0x34, 0x4f, 0xaa, 0x6a, 0x08, 0x26, 0xd6, 0x41, 0x27, 0x1e, 0x56, 0x18, 0xc6, 0x25, 0xcc, 0x62, 0x6e, 0x8a, 0x21, 0xfd, 0x94, 0x96, 0x15, 0xf4,
+	0xe1, 0x1b, 0x50, 0x6b, 0x96, 0x87, 0x91, 0xaa, 0x8a, 0x54, 0x90, 0x44, 0x01, 0x36, 0x31, 0x33, 0x0b, 0xa6, 0x42, 0xb9, 0x34, 0x92, 0x99, 0x14,
+	0x81, 0x5f, 0xb4, 0x51, 0xb9, 0x4f, 0x29, 0x7e, 0x09, 0xc4, 0x10, 0x5c, 0xe0, 0x59, 0x48, 0x39, 0x36, 0xa9, 0x92, 0xae, 0x28, 0xdc, 0x32, 0xbf,
+	0x26, 0x81, 0x66, 0x6a, 0x04, 0x13, 0xe6, 0xec, 0xa9, 0x93, 0x51, 0x54, 0x41, 0xbb, 0x43, 0xe2, 0xb0, 0x43, 0x62, 0xc8, 0x69, 0x69, 0x03, 0x4b,
+	0xff, 0xc6, 0xf1, 0xa9, 0x7f, 0x8b, 0x8e, 0x11, 0x49, 0x77, 0xd5, 0xec, 0x56, 0x6d, 0x61, 0x9d, 0xab, 0x7c, 0x1a, 0x73, 0x6c, 0x8f, 0xfa, 0xdd,
+	0x0c, 0x61, 0x6b, 0x39, 0x89, 0xd3, 0x68, 0x55, 0x74, 0x6d, 0x0d, 0x64, 0x75, 0xa9, 0xb5, 0x93, 0x6d, 0x15, 0x2d, 0xf3, 0xf0, 0xbb, 0x82, 0xd6,
+	0x22, 0x0b, 0xd3, 0xa7, 0x22, 0x06, 0x48, 0x11, 0x31, 0x03, 0x86, 0x5e, 0x87, 0x8f, 0x04, 0x5a, 0xc4, 0x79, 0x9d, 0xbe, 0x86, 0xe6, 0x86, 0x5e,
+	0xc5, 0x73, 0x64, 0xf3, 0x53, 0x97, 0xc6, 0x2a, 0x16, 0x45, 0x94, 0xe4, 0x6a, 0xaa, 0x2a, 0x38, 0xb9, 0xe9, 0x0e, 0xb1, 0xba, 0x47, 0x8a, 0x71,
+	0x6e, 0xef, 0x67, 0x57, 0x81, 0x90, 0x1d, 0x88, 0xbb, 0x4f, 0xf1, 0xcd, 0x76, 0xe1, 0xc5, 0xb7, 0xee, 0x3e, 0x91, 0x40, 0xe5, 0x5e, 0xcf, 0x80,
+	0xf4, 0x25, 0x6f, 0x11, 0x46, 0xf7, 0x5a, 0xb1, 0x57, 0xd4, 0xcc, 0xb3, 0x02, 0xad, 0xac, 0x6c, 0x0b, 0x11, 0x0f, 0x9a, 0x97, 0x9e, 0x6f, 0x6b,
+	0x0b, 0x28, 0x96, 0xbb, 0x7f, 0xb1, 0x39, 0xa0, 0xc9, 0xe5, 0xdf, 0xca, 0x51, 0xd3, 0xc2, 0xe9, 0xad, 0xf5, 0xec, 0x98, 0xac, 0x68, 0x2b, 0x7c,
+	0x85, 0xda, 0x34, 0x17, 0xba, 0xaf, 0x56, 0xa1, 0xc7, 0x72, 0x51, 0x95, 0xde, 0x8b, 0x9b, 0x51, 0x15, 0xd0, 0xdf, 0xd5, 0xfb, 0xf4, 0x2c, 0xe7,
+	0xe6, 0x79, 0x75, 0x7a, 0x2c, 0x55, 0x32, 0xf9, 0xdc, 0x79, 0xf6, 0x81, 0xf4, 0xef, 0xf7, 0xc2, 0x38, 0x9b, 0xf3, 0xe1, 0xee, 0x60, 0x78, 0x3c,
+	0x94, 0x6e, 0x4f, 0x32, 0x77, 0x39, 0x11, 0xb6, 0x76, 0x13, 0xe4, 0xf1, 0x5a, 0xb7, 0xf9, 0xd9, 0x50, 0x0e, 0x1f, 0xae, 0x25, 0x90, 0x55, 0xe2,
+	0x09, 0xd9, 0xe1, 0xfa, 0x6d, 0x51, 0x6a, 0x45, 0x69, 0x81, 0x80, 0xb1, 0xfa, 0x5b, 0x98, 0x9f, 0xcd, 0x51, 0x5e, 0x2d, 0x2e, 0x04, 0x52, 0xb0,
+	0xba, 0x98, 0x77, 0xb5, 0x57, 0xc5, 0x0b, 0xe1, 0x6e, 0x74, 0x41, 0x6f, 0x75, 0x4b, 0x85, 0x58, 0xcc, 0xdf, 0xa5, 0xc1, 0x38, 0x6c, 0x16, 0x29,
+	0x5a, 0x00, 0xbb, 0x82, 0x45, 0x3b, 0x16, 0x35, 0x79, 0x58, 0x93, 0x82, 0x41, 0xbe, 0xd6, 0x24, 0xb3, 0x33, 0xa6, 0xa2, 0x9f, 0x44, 0xcc, 0x95,
+	0xd1, 0xde, 0x34, 0x4b, 0x85, 0x2e, 0x68, 0x94, 0x9b, 0x4f, 0x17, 0x8d, 0x17, 0x72, 0xf0, 0x12, 0x09, 0x52, 0x08, 0x65, 0xf9, 0xdf, 0xc4, 0x0c,
+	0xb5, 0xaa, 0x2f, 0x72, 0x69, 0x20, 0xfd, 0x71, 0xf4, 0xf2, 0xf7, 0x3c, 0x9f, 0x9f, 0x70, 0x12, 0xca, 0xed, 0xf8, 0xd7, 0x16, 0x6a, 0x4c, 0x5a,
+	0xfe, 0x6f, 0x07, 0xa7, 0xe8, 0x9d, 0x1e, 0x20, 0xb2, 0xbd, 0x6e, 0x77, 0xbe, 0x88, 0x33, 0xb8, 0x8f, 0xa1, 0x4f, 0x93, 0x11, 0xee, 0x89, 0xdd,
+	0x49, 0x94, 0x4e, 0x6f, 0xa0, 0x5a, 0xdd, 0x38, 0x49, 0x03, 0x38, 0xe3, 0x74, 0x55, 0xcf, 0x5e, 0xe1, 0xa0, 0x54, 0xb4, 0x66, 0x68, 0xf2, 0xb4,
+	0xa4, 0x21, 0x21, 0xe2, 0x6a, 0xb6, 0x84, 0x4b, 0xfb, 0x07, 0x83, 0x81, 0x84, 0x22, 0x18, 0x34, 0x36, 0x0e, 0xe9, 0xb5, 0xd1, 0x76, 0xaf, 0x57,
+	0xe4, 0x19, 0x11, 0xc5, 0x92, 0x99, 0xa8, 0x58, 0xab, 0x40, 0xcd, 0x60, 0x18, 0x64, 0x21, 0x0a, 0xd8, 0x79, 0x9b, 0x29, 0x58, 0xb3, 0x6a, 0x86,
+	0x7d, 0xe8, 0x1b, 0xaa, 0x87, 0x13, 0xa3, 0x91, 0xf6, 0x64, 0x28, 0x56, 0x36, 0x7e, 0xec, 0x78, 0x79, 0xba, 0x24, 0xb3, 0xdb, 0x77, 0x01, 0xcc,
+	0x1b, 0xb7, 0x06, 0xc5, 0x6c, 0x66, 0x5d, 0x91, 0xa2, 0xde, 0xbe, 0x17, 0x25, 0x41, 0x57, 0x18, 0x55, 0x1d, 0x5e, 0xea, 0x28, 0x35, 0x5d, 0xd2,
+	0x25, 0x75, 0x59, 0x30, 0xca, 0x17, 0x81, 0x78, 0xd5, 0x27, 0xdb, 0xd8, 0x8c, 0x16, 0x24, 0x57, 0x63, 0xc6, 0xe4, 0xb7, 0x88, 0x22, 0xed, 0x17,
+	0xc6, 0x16, 0xad, 0x87, 0xeb, 0x82, 0x9c, 0x18, 0x7c, 0x56, 0x17, 0x91, 0xac, 0x74, 0x6b, 0x3f, 0x07, 0x90, 0xf1, 0x1e, 0xe2, 0xff, 0xfe, 0xe7,
+	0x7f, 0x3d, 0x7e, 0xbf, 0x8d, 0x36, 0x48, 0xd2, 0xe2, 0x09, 0x6e, 0xf1, 0xfc, 0x4b, 0xde, 0xd4, 0x1d, 0x64, 0x0a, 0x93, 0x98, 0x34, 0x9c, 0x26,
+	0x70, 0x7c, 0xf0, 0x9f, 0x09, 0xd3, 0x09, 0x71, 0x71, 0x90, 0xae, 0x28, 0xeb, 0x0a, 0xcb, 0x31, 0xec, 0x1a, 0x95, 0x96, 0xa7, 0x2a, 0x1a, 0xc0,
+	0x2c, 0xc8, 0x5d, 0x1a, 0x96, 0xbb, 0x49, 0x09, 0xc9, 0x68, 0xa7, 0x5c, 0xbc, 0xbb, 0x11, 0xbe, 0x3b, 0x42, 0xcd, 0x9c, 0x1c, 0x4f, 0x34, 0x64,
+	0x5a, 0x61, 0x87, 0x96, 0x3d, 0x3a, 0x4b, 0xf2, 0x41, 0x07, 0x76, 0x93, 0x6f, 0x7b, 0xca, 0x01, 0x86, 0xbe, 0xda, 0xd0, 0x6a, 0xdd, 0x0c, 0xca,
+	0x11, 0x8f, 0x83, 0xda, 0x3b, 0xc6, 0xf1, 0x38, 0x4a, 0x62, 0xaf, 0x05, 0x44, 0xda, 0x7e, 0xdb, 0x4d, 0x66, 0x0d, 0x9b, 0xf1, 0x12, 0xea, 0xda,
+	0x4e, 0x07, 0xab, 0xca, 0xa0, 0x73, 0xb1, 0x9c, 0x0d, 0xe6, 0x1f, 0x60, 0xc6, 0xbb, 0x48, 0xe3, 0x29, 0x07, 0xf3, 0x9c, 0x26, 0xbe, 0x98, 0xa1,
+	0x9b, 0x19, 0xa0, 0xab, 0xa6, 0xd3, 0xe7, 0x47, 0x07, 0x7f, 0x7f, 0xfd, 0xea, 0x60, 0xd8, 0xa4, 0x14, 0x4c, 0x41, 0x33, 0xf3, 0x48, 0x6e, 0xdc,
+	0xbe, 0x6b, 0xa0, 0xcb, 0x57, 0x1d, 0xb8, 0x56, 0x32, 0x21, 0xfd, 0x64, 0x51, 0x53, 0xcd, 0x35, 0x43, 0x13, 0x6f, 0x1a, 0x58, 0xa7, 0x9a, 0x7d,
+	0xde, 0xa8, 0xb6, 0xa9, 0x04, 0xd9, 0xec, 0xeb, 0x11, 0x06, 0x3e, 0x1a, 0x90, 0x46, 0x90, 0x81, 0x3b, 0x93, 0x91, 0xe3, 0xa8, 0x60, 0xe6, 0xaf,
+	0x88, 0x80, 0x2a, 0x9f, 0x92, 0x96, 0xe2, 0x8e, 0x9a, 0x6e, 0xc4, 0xd5, 0x83, 0xd2, 0xfc, 0x43, 0x09, 0x9a, 0xfb, 0xc5, 0x90, 0xec, 0x7f, 0x60,
+	0x60, 0xf1, 0xbc, 0x4c, 0x0f, 0xc6, 0x69, 0xbd, 0x30, 0x53, 0x6d, 0x9e, 0xa1, 0x10, 0x12, 0xb5, 0xc3, 0x5a, 0x12, 0xa9, 0xd9, 0xa5, 0x10, 0x5a,
+	0x65, 0x89, 0x47, 0x65, 0x76, 0x1d, 0x2d, 0x9f, 0x1c, 0x65, 0xdf, 0x1b, 0x5a, 0x5f, 0xae, 0xef, 0x78, 0x83, 0x37, 0x9a, 0x8a, 0x27, 0x72, 0x61,
+	0x1c, 0xcc, 0x33, 0x0c, 0xaa, 0x22, 0x1d, 0x67, 0xa8, 0x0a, 0x49, 0x8c, 0xbf, 0x91, 0x28, 0xb4, 0x78, 0x1a, 0x5c, 0x54, 0x6f, 0x43, 0x20, 0x6b,
+	0x1a, 0x72, 0xa9, 0x45, 0x97, 0x78, 0xcc, 0x04, 0x9f, 0x9d, 0xa2, 0xf3, 0x48, 0xcc, 0x1a, 0x90, 0x03, 0xfe, 0x55, 0x6a, 0xf4, 0xe7, 0x4f, 0x0b,
+	0x25, 0xba, 0xe2, 0x48, 0x5d, 0xa4, 0xd3, 0xc1, 0x9d, 0xd2, 0x1a, 0x49, 0x75, 0xfe, 0xd6, 0x1d, 0x8e, 0x1c, 0xb8, 0xff, 0x0b, 0x45, 0xb0, 0x35,
+	0xf6, 0xbe, 0x58, 0x11, 0x8c, 0xd7, 0x86, 0x2a, 0x9f, 0x04, 0xa6, 0xa3, 0x01, 0x80, 0xac, 0x73, 0x34, 0x60, 0x14, 0x96, 0x31, 0xf2, 0x0f, 0x03,
+	0x2d, 0x4b, 0xd7, 0x2e, 0x22, 0x77, 0xbc, 0x05, 0x7c, 0xdb, 0xfd, 0x05, 0x39, 0xfa, 0x6a, 0xe7, 0x44, 0x57, 0x87, 0xae, 0x7d, 0x45, 0x78, 0x41,
+	0x14, 0xf7, 0x7c, 0xbf, 0x6d, 0x20, 0xac, 0xb1, 0x83, 0x48, 0x8c, 0x62, 0xd1, 0x33, 0x76, 0xea, 0x26, 0xe5, 0x77, 0x6c, 0xed, 0xba, 0x98, 0xd2,
+	0x3b, 0xd3, 0xf3, 0x3d, 0x6b, 0xaf, 0x77, 0x91, 0x30, 0xae, 0xfb, 0xf4, 0xd8, 0x02, 0x4f, 0x89, 0xf2, 0x04, 0x54, 0xb8, 0x00, 0x36, 0xb1, 0x0c,
+	0x79, 0xa5, 0xc8, 0x2a, 0x05, 0xc5, 0x6e, 0x72, 0xce, 0xa1, 0xf6, 0x30, 0xaf, 0xe4, 0x1a, 0x92, 0x7c, 0x7f, 0x06, 0xdb, 0xc1, 0x75, 0x93, 0xd6,
+	0x21, 0x40, 0xfb, 0xc0, 0x73, 0x08, 0x89, 0xe2, 0x40, 0x6a, 0x77, 0x9d, 0xf1, 0x4a, 0x0e, 0x71, 0x57, 0x3a, 0x81, 0x8e, 0xc6, 0x15, 0xbb, 0x9c,
+	0x8b, 0x9c, 0xe1, 0xff, 0x79, 0x34, 0x5f, 0x4c, 0x9c, 0x4f, 0x5c, 0x8e, 0xcf, 0xd6, 0x20, 0x89, 0x54, 0xf4, 0x43, 0x47, 0x18, 0x38, 0x45, 0x20,
+	0x98, 0x5e, 0x41, 0x15, 0xb3, 0x48, 0xcb, 0xd4, 0x5b, 0xc1, 0x86, 0x80, 0x4c, 0x36, 0x13, 0xf7, 0x2b, 0xc4, 0xe0, 0x1d, 0xf6, 0x40, 0x90, 0x57,
+	0x8b, 0x46, 0x08, 0xb9, 0x11, 0x47, 0xbd, 0x66, 0xa3, 0x2c, 0xfa, 0xe0, 0x76, 0x4b, 0x78, 0x15, 0xcd, 0xbd, 0x21, 0x64, 0x56, 0xb0, 0x23, 0xc4,
+	0x5a, 0x76, 0x0c, 0xa5, 0x49, 0x67, 0xaa, 0xd8, 0x0d, 0xdf, 0x87, 0x39, 0xbe, 0x14, 0xa9, 0x66, 0x98, 0x35, 0x62, 0x98, 0xd9, 0x0c, 0x27, 0x69,
+	0x18, 0x56, 0x3c, 0xec, 0xc4, 0x07, 0x35, 0xc1, 0xa8, 0x92, 0x1f, 0x62, 0xd6, 0xf3, 0x23, 0x28, 0xed, 0xc5, 0x67, 0x55, 0x05, 0x0f, 0x61, 0xa6,
+	0xac, 0xac, 0xdf, 0xa4, 0x51, 0xfd, 0x26, 0x56, 0xfd, 0x26, 0xb1, 0x7b, 0x02, 0x31, 0xbb, 0xb5, 0xa6, 0x11, 0x92, 0xd2, 0x29, 0x5f, 0xaf, 0xa2,
+	0x7c, 0x0d, 0x68, 0xf4, 0x06, 0xaa, 0x31, 0xf5, 0x6b, 0x83, 0xfa, 0x74, 0xbc, 0xe3, 0xb4, 0xd7, 0x7e, 0xb6, 0x53, 0x41, 0x13, 0x10, 0x6a, 0x1b,
+	0x07, 0x61, 0x34, 0xe7, 0xac, 0x49, 0x92, 0x5f, 0x3b, 0x83, 0x89, 0x41, 0x86, 0xb7, 0x5a, 0xce, 0xe8, 0xa2, 0x4e, 0xf4, 0x2c, 0xfa, 0xd3, 0x4a,
+	0xfa, 0xd3, 0x64, 0x1c, 0xae, 0x49, 0x7c, 0xda, 0xc8, 0x2a, 0x16, 0xf7, 0xd1, 0xba, 0xd3, 0xb8, 0x09, 0xe3, 0x38, 0x48, 0x5b, 0x00, 0xd6, 0x63,
+	0x7e, 0x71, 0xb0, 0x2d, 0x81, 0xad, 0x38, 0x70, 0xb3, 0x7f, 0x17, 0xe3, 0x00, 0x6d, 0xc5, 0x02, 0x92, 0x5e, 0x5e, 0x68, 0xf1, 0x2f, 0x01, 0xf3,
+	0x76, 0xe2, 0xb0, 0x34, 0xa2, 0x0c, 0xf6, 0x33, 0x82, 0xed, 0x5f, 0x42, 0xe4, 0x5e, 0x31, 0x82, 0xff, 0x60, 0x4a, 0x5b, 0xa1, 0x4c, 0x9d, 0x28,
+	0xd3, 0x12, 0x8a, 0xf0, 0x7e, 0x82, 0x2b, 0x7f, 0x09, 0x83, 0xb6, 0x03, 0xc3, 0xfe, 0x07, 0x12, 0x36, 0x7c, 0xef, 0xe8, 0xea, 0x83, 0x2f, 0x6a,
+	0x15, 0x3b, 0x5a, 0x80, 0x66, 0x94, 0x61, 0x5d, 0x14, 0xab, 0x56, 0xb8, 0x76, 0xc1, 0x5f, 0xdb, 0xf0, 0xd7, 0x12, 0x9e, 0x16, 0xd2, 0x72, 0xb9,
+	0x68, 0x35, 0x30, 0x0a, 0x86, 0x29, 0x50, 0xb2, 0x4d, 0xcf, 0xdf, 0x18, 0x3e, 0xff, 0xfb, 0x81, 0x91, 0xde, 0x16, 0xbc, 0x9d, 0xb4, 0x26, 0x25,
+	0x5a, 0x93, 0x0a, 0x5a, 0x13, 0x8d, 0x56, 0xe6, 0xa4, 0x95, 0x95, 0x68, 0x65, 0x15, 0xb4, 0x32, 0x8d, 0x16, 0x4c, 0xdf, 0x12, 0x25, 0x9c, 0xd2,
+	0x46, 0x58, 0xa5, 0xf1, 0x8e, 0x60, 0x8c, 0x0b, 0x6f, 0x99, 0x31, 0x2d, 0xc7, 0xa6, 0xc9, 0x15, 0xa4, 0xb8, 0x18, 0x63, 0xba, 0x60, 0x4c, 0xdb,
+	0x78, 0xe9, 0xb6, 0x88, 0x7b, 0xb3, 0x71, 0x5b, 0x84, 0x04, 0x07, 0x21, 0x4c, 0xd6, 0xe8, 0x4c, 0x9c, 0x84, 0x26, 0x25, 0x4a, 0x13, 0xf2, 0x12,
+	0xf4, 0xb8, 0x34, 0xc7, 0x1c, 0x72, 0x67, 0x79, 0xc8, 0x77, 0x1e, 0xf2, 0x2c, 0x3d, 0x22, 0x83, 0xb4, 0x94, 0x18, 0x09, 0x4b, 0xaa, 0x45, 0x9e,
+	0x41, 0x8f, 0x82, 0x6c, 0xd9, 0x4c, 0xfb, 0x94, 0xdf, 0xdb, 0xea, 0xf5, 0xbc, 0x7d, 0x9f, 0xee, 0x11, 0x98, 0xf7, 0x4b, 0x8f, 0x73, 0x0d, 0x97,
+	0x84, 0xf4, 0x13, 0xe5, 0x9e, 0x8c, 0xde, 0x55, 0xdf, 0xfd, 0xde, 0xf6, 0x03, 0xa8, 0x3a, 0x91, 0xe2, 0x4c, 0xce, 0x9b, 0xc3, 0x52, 0x88, 0x79,
+	0x1d, 0x68, 0x60, 0xcd, 0x69, 0x0b, 0x34, 0xde, 0x8b, 0xa3, 0xdf, 0x4e, 0x8f, 0x7d, 0xbc, 0xa8, 0xa4, 0x4f, 0xf2, 0x56, 0x08, 0x49, 0x97, 0x3e,
+	0xdc, 0xfb, 0xc5, 0x55, 0x0c, 0x09, 0x89, 0xfb, 0x89, 0x25, 0xc3, 0xd7, 0xcc, 0xc7, 0xb9, 0x80, 0x29, 0x5e, 0x97, 0xa8, 0x1e, 0x83, 0x8f, 0x4b,
+	0xb8, 0x13, 0x67, 0x7b, 0xf7, 0xfb, 0x3b, 0xf7, 0x77, 0xe1, 0x2a, 0xda, 0x99, 0xc2, 0x02, 0x72, 0x95, 0xed, 0x6d, 0xef, 0x3c, 0x42, 0x9b, 0xf4,
+	0xce, 0x38, 0x58, 0x66, 0x7b, 0x0f, 0x77, 0x1f, 0xc0, 0xcf, 0xab, 0x64, 0x81, 0x80, 0xbb, 0x08, 0x14, 0xcd, 0x16, 0x79, 0x98, 0xed, 0xed, 0xf6,
+	0x3a, 0xc2, 0x83, 0xfd, 0x5e, 0xff, 0xee, 0xf1, 0xeb, 0xcb, 0x7f, 0xa2, 0x59, 0xfb, 0xfb, 0x70, 0x99, 0xb5, 0xb2, 0xf6, 0x16, 0xac, 0xc3, 0x07,
+	0xc1, 0xe8, 0xaa, 0xa5, 0x98, 0x43, 0x06, 0xdc, 0x1b, 0xdf, 0xc2, 0x9f, 0x73, 0xbd, 0x81, 0xc6, 0xdd, 0x8c, 0xd2, 0xda, 0x8f, 0xc7, 0x9b, 0x03,
+	0xce, 0xfe, 0x89, 0x53, 0x1e, 0xdf, 0xb5, 0xa9, 0x94, 0x8b, 0x39, 0x4a, 0x6e, 0x30, 0x50, 0x5c, 0xba, 0x45, 0xc5, 0x6d, 0xff, 0xda, 0x12, 0xbf,
+	0x36, 0xfc, 0xa5, 0xe7, 0xb7, 0xf7, 0x7c, 0xff, 0x31, 0x03, 0x6d, 0x30, 0x14, 0xd7, 0x82, 0xc0, 0xf8, 0xe7, 0x86, 0x3f, 0x75, 0xc1, 0x61, 0xf5,
+	0x08, 0x0a, 0x7f, 0x6c, 0xf8, 0x63, 0x17, 0x0c, 0xd5, 0x9b, 0x80, 0xe8, 0xd7, 0x86, 0x7f, 0x55, 0x86, 0x1a, 0xa4, 0x5b, 0xa2, 0x4d, 0x98, 0x27,
+	0xff, 0x06, 0xa6, 0x0c, 0x29, 0x7a, 0x88, 0x11, 0x44, 0x1f, 0x89, 0xd0, 0xe3, 0x83, 0xee, 0x3f, 0x5a, 0xdb, 0x3b, 0x6f, 0x7b, 0x9b, 0x3b, 0xe7,
+	0x9f, 0xb6, 0xe1, 0xcf, 0x83, 0x73, 0xf8, 0xdf, 0xa3, 0xf3, 0x4f, 0x6f, 0x7b, 0xfd, 0xf3, 0x5f, 0xe9, 0x27, 0xfd, 0xef, 0xd7, 0xf6, 0xd6, 0xf7,
+	0x00, 0xbb, 0xd7, 0xa5, 0xb2, 0x1a, 0x16, 0xf8, 0x3c, 0x64, 0xf6, 0xd0, 0x0b, 0x71, 0x98, 0x46, 0x23, 0x9f, 0x87, 0x8c, 0xf6, 0x0d, 0x6d, 0xa9,
+	0x7d, 0x61, 0xa3, 0xe9, 0xc0, 0xd4, 0x34, 0x5a, 0x02, 0x0f, 0xa0, 0x22, 0x81, 0x5b, 0x47, 0x13, 0x56, 0x7c, 0x5d, 0x7e, 0xb2, 0xf1, 0x07, 0x17,
+	0xdd, 0xee, 0xbd, 0x8f, 0x71, 0x32, 0x62, 0x71, 0x9f, 0x8c, 0xac, 0x7d, 0x77, 0x41, 0xf9, 0xbf, 0x9f, 0x9e, 0x1e, 0x1f, 0xbf, 0x3e, 0x39, 0xc5,
+	0x87, 0xfa, 0x14, 0xe2, 0x68, 0xc8, 0x5f, 0x7b, 0xf7, 0x1f, 0x3c, 0x7a, 0xc8, 0x49, 0x4f, 0xe6, 0x96, 0x9c, 0xd7, 0xb6, 0xaf, 0xf8, 0xec, 0xc8,
+	0x5b, 0x9a, 0x07, 0x11, 0xe5, 0x76, 0x36, 0x62, 0x39, 0xf2, 0x4b, 0xfc, 0xb5, 0xca, 0xb8, 0x8c, 0x40, 0x75, 0xe7, 0xcd, 0xf3, 0x39, 0xdc, 0x7f,
+	0x0b, 0x41, 0xb4, 0x69, 0xe3, 0xa0, 0x53, 0xd2, 0x20, 0xeb, 0x4d, 0x9f, 0x4a, 0x41, 0x7e, 0x4d, 0x64, 0x79, 0xea, 0x64, 0x93, 0x17, 0xd6, 0x9c,
+	0x0a, 0x3b, 0x18, 0xc3, 0x34, 0x4e, 0x02, 0xac, 0xcf, 0x50, 0xc7, 0xa4, 0x48, 0x81, 0x56, 0x6f, 0xd4, 0x19, 0x0a, 0x71, 0x3b, 0xe9, 0x96, 0x40,
+	0x7a, 0x15, 0x94, 0x39, 0xd0, 0x0a, 0xb2, 0xc9, 0x8c, 0x3a, 0xa3, 0xca, 0x34, 0x45, 0x75, 0x44, 0x8d, 0x0d, 0x59, 0x6d, 0xab, 0xfb, 0x75, 0xc5,
+	0xa8, 0xb1, 0x91, 0x71, 0x18, 0xb7, 0xeb, 0x4c, 0x15, 0xbe, 0x6e, 0x39, 0xb3, 0x82, 0x5f, 0x61, 0x3b, 0x53, 0x0a, 0x0f, 0xda, 0x84, 0x9d, 0x42,
+	0xd7, 0x5c, 0x2a, 0x47, 0xd5, 0x55, 0x5f, 0x6b, 0x64, 0xae, 0x2c, 0xf7, 0x7a, 0xf6, 0x5b, 0x6a, 0x78, 0xad, 0xb2, 0xe0, 0xaa, 0xe1, 0x56, 0x65,
+	0x77, 0x65, 0xd0, 0xd6, 0x15, 0xd2, 0x2b, 0xe8, 0xad, 0xb2, 0xe3, 0x52, 0xf4, 0x6c, 0x4b, 0xae, 0x55, 0xe5, 0x0b, 0xf3, 0xd7, 0x70, 0x7b, 0x8f,
+	0x72, 0xcd, 0x80, 0x36, 0xe1, 0x84, 0xaa, 0xf1, 0x2b, 0xb2, 0xa1, 0xb9, 0xc5, 0xaf, 0x95, 0x9d, 0x53, 0x86, 0xae, 0x19, 0xc5, 0x2b, 0x9c, 0x83,
+	0x5b, 0xe3, 0x55, 0x3a, 0x07, 0x14, 0x2f, 0xd4, 0x56, 0x91, 0x75, 0x9a, 0xac, 0x99, 0x9e, 0xbe, 0xa9, 0x9a, 0xba, 0x7d, 0x41, 0xa1, 0xdd, 0xbf,
+	0x89, 0xe0, 0x96, 0x7e, 0x03, 0x1c, 0xe3, 0x24, 0x18, 0xb3, 0xe2, 0x9c, 0x8d, 0x18, 0x90, 0x59, 0xb1, 0xb4, 0xbf, 0x0b, 0x73, 0xb1, 0xae, 0xef,
+	0x2f, 0x9f, 0x8f, 0x5b, 0x3e, 0xe7, 0xcb, 0xb0, 0xd1, 0x65, 0x55, 0xa0, 0x55, 0xdc, 0x16, 0xbd, 0xbb, 0x83, 0x6f, 0xb9, 0xbe, 0x39, 0x5c, 0x3e,
+	0x99, 0x49, 0x6a, 0x75, 0xfa, 0x7f, 0xeb, 0xa2, 0x5f, 0xb6, 0x9b, 0xe0, 0x01, 0x00,
+};
+const char ScriptsETag[] PROGMEM = "\"796c9f0d1678f292\"";
+const char ScriptsType[] PROGMEM = "application/javascript";
+
+// app.h: 1657 bytes, 855 gzipped
+const uint8_t AppGz[] PROGMEM = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x55, 0xfd, 0x6e, 0xdb, 0x36, 0x10, 0x7f, 0x15, 0x0e, 0xc5, 0xc0, 0x04, 0xd0,
+	0x07, 0xa5, 0x44, 0x89, 0x2c, 0x4b, 0xda, 0x3a, 0x77, 0x69, 0x02, 0x34, 0x71, 0x90, 0x39, 0x1e, 0xfa, 0x27, 0x4d, 0xd1, 0x12, 0x5b, 0x4a, 0x14,
+	0x28, 0x5a, 0xb2, 0xfb, 0x46, 0x7b, 0x8d, 0x3e, 0x59, 0x4f, 0x1f, 0x5e, 0xe2, 0x2d, 0xfb, 0x77, 0x80, 0x8f, 0xe2, 0xdd, 0xfd, 0xee, 0x93, 0x47,
+	0x3a, 0xfe, 0xe9, 0xc3, 0x72, 0xb1, 0xfa, 0xfc, 0xf8, 0x3b, 0x2a, 0x4c, 0x29, 0xd3, 0xb8, 0x5f, 0x91, 0xa4, 0x55, 0x9e, 0x60, 0x5e, 0x61, 0xe0,
+	0x39, 0xcd, 0xd2, 0xb8, 0xe4, 0x86, 0x22, 0x56, 0x50, 0xdd, 0x70, 0x93, 0xe0, 0xe7, 0xd5, 0x8d, 0x1d, 0xe2, 0x49, 0x5a, 0xd1, 0x92, 0x27, 0xb8,
+	0x15, 0xbc, 0xab, 0x95, 0x36, 0x18, 0x31, 0x55, 0x19, 0x5e, 0x01, 0xaa, 0x13, 0x99, 0x29, 0x92, 0x8c, 0xb7, 0x82, 0x71, 0x7b, 0x60, 0x2c, 0x24,
+	0x2a, 0x61, 0x04, 0x95, 0x76, 0xc3, 0xa8, 0xe4, 0x89, 0x67, 0xa1, 0x5d, 0xc3, 0xf5, 0xc0, 0xd1, 0x0d, 0x08, 0x2a, 0x85, 0xdd, 0x34, 0x36, 0xc2,
+	0x48, 0x9e, 0x2e, 0x54, 0xb5, 0x15, 0xf9, 0x4e, 0x53, 0x23, 0x54, 0x15, 0xbb, 0xa3, 0x30, 0x96, 0xa2, 0xfa, 0x8a, 0x34, 0x97, 0x09, 0x6e, 0x0a,
+	0x08, 0xc7, 0x76, 0x06, 0x09, 0x88, 0x88, 0x51, 0xa1, 0xf9, 0x36, 0xc1, 0x90, 0x54, 0xc3, 0xb4, 0xa8, 0x0d, 0x6a, 0x34, 0x03, 0xcc, 0xb0, 0x6f,
+	0x9c, 0x2f, 0xcd, 0x2f, 0x6d, 0x72, 0x3d, 0xbb, 0x62, 0xb3, 0x2d, 0xc9, 0xbc, 0xab, 0xeb, 0x70, 0xeb, 0xcf, 0x7c, 0x8c, 0xcc, 0xa1, 0x86, 0xd4,
+	0x0d, 0xdf, 0x1b, 0xf7, 0x0b, 0x6d, 0xe9, 0x88, 0x06, 0x17, 0xee, 0xb8, 0x9b, 0xa2, 0x8d, 0x9e, 0x1b, 0x73, 0x90, 0xbc, 0x71, 0x58, 0xd3, 0xbb,
+	0xf2, 0xb7, 0x3e, 0xe7, 0xd7, 0x34, 0xcb, 0xd8, 0x76, 0x7b, 0x99, 0x5d, 0x05, 0x78, 0x4a, 0x69, 0xc0, 0x14, 0x9c, 0x9b, 0x13, 0xdf, 0x60, 0x83,
+	0x11, 0xd4, 0xe5, 0x8e, 0xbd, 0xdc, 0xa8, 0xec, 0x90, 0xc6, 0x99, 0x68, 0x11, 0x93, 0xb4, 0x69, 0x12, 0xdc, 0x8b, 0xb9, 0xc6, 0x27, 0x32, 0xa9,
+	0x72, 0x75, 0x2a, 0x19, 0x1a, 0x80, 0xd3, 0x8f, 0xd4, 0xf0, 0x8e, 0x1e, 0xd0, 0x62, 0xf9, 0x70, 0x73, 0xf7, 0xf1, 0xf9, 0xe9, 0xfd, 0xea, 0x6e,
+	0xf9, 0x10, 0xbb, 0x00, 0x4c, 0x4f, 0xd6, 0x57, 0x96, 0x8f, 0x34, 0xe7, 0x8b, 0xf1, 0x54, 0x4e, 0x5d, 0x4e, 0xc2, 0x7b, 0xaa, 0xd9, 0x9b, 0x8a,
+	0x3f, 0x35, 0xad, 0x21, 0x31, 0x24, 0xb2, 0x04, 0xb3, 0xe1, 0x38, 0xf0, 0x1b, 0xee, 0x17, 0x85, 0x82, 0x13, 0x7e, 0x52, 0x1d, 0x46, 0x43, 0x03,
+	0x12, 0xbc, 0x51, 0x1a, 0x0a, 0xb2, 0x8d, 0xaa, 0x23, 0xe4, 0xd5, 0x7b, 0xd4, 0x28, 0x29, 0x32, 0xa4, 0xf3, 0x0d, 0x3d, 0xf3, 0x02, 0x62, 0xa1,
+	0x97, 0x85, 0x38, 0xe1, 0xf9, 0xfc, 0x34, 0xf6, 0x0a, 0x5a, 0x76, 0xcc, 0xf6, 0xe8, 0xb0, 0x6f, 0xa3, 0x4d, 0xa5, 0xc8, 0xab, 0x08, 0x31, 0x50,
+	0x70, 0x3d, 0x47, 0x5b, 0xc0, 0xd8, 0x83, 0x3e, 0x42, 0xc2, 0x80, 0x92, 0xcd, 0x61, 0xf6, 0xa4, 0xd2, 0x11, 0x7a, 0x17, 0x86, 0x21, 0x78, 0x7d,
+	0x7c, 0xfe, 0xf4, 0xc7, 0xfb, 0xa7, 0xd5, 0xd3, 0xf2, 0xe1, 0x6e, 0xe1, 0x2c, 0x96, 0xf7, 0xff, 0x4e, 0xfd, 0x46, 0x29, 0xf0, 0xf5, 0x69, 0xec,
+	0x75, 0xd3, 0xe6, 0xa8, 0xe5, 0xba, 0x81, 0x71, 0x4b, 0xb0, 0xe7, 0x78, 0x18, 0xed, 0x4b, 0x59, 0xf5, 0xe7, 0x63, 0x4c, 0x1d, 0xb9, 0x6e, 0xd7,
+	0x75, 0x4e, 0x77, 0xe1, 0x28, 0x9d, 0xbb, 0x3e, 0x21, 0xc4, 0x05, 0x3c, 0x1e, 0x10, 0xd1, 0xbe, 0x9f, 0x93, 0xb7, 0x70, 0xde, 0x6c, 0x36, 0x73,
+	0x07, 0x2d, 0xde, 0x27, 0x98, 0xd4, 0x7b, 0x7c, 0x18, 0x3f, 0xe3, 0xdd, 0xc0, 0x1e, 0x21, 0x3f, 0xc3, 0xf1, 0x8b, 0xbc, 0x30, 0x13, 0xd3, 0xdf,
+	0xa3, 0xdf, 0x54, 0x0f, 0x46, 0x04, 0x5d, 0x06, 0xb3, 0x9e, 0xf0, 0xd4, 0x05, 0x5e, 0xf5, 0x97, 0xc4, 0xde, 0x50, 0xf6, 0x35, 0xd7, 0x6a, 0x57,
+	0x65, 0x51, 0xc5, 0x3b, 0xf4, 0x0a, 0x38, 0xef, 0xf3, 0x89, 0x9a, 0x9a, 0x32, 0x40, 0xd7, 0x9a, 0xc3, 0xdd, 0x6a, 0x61, 0x64, 0xe2, 0x1c, 0x7e,
+	0xc3, 0x21, 0x96, 0xbc, 0x54, 0xfa, 0x00, 0x92, 0x9a, 0x9a, 0xe2, 0xd8, 0xdc, 0xad, 0x90, 0x32, 0x7a, 0xe7, 0x87, 0x21, 0x0f, 0xf9, 0x1c, 0x03,
+	0xea, 0xfe, 0x82, 0x5c, 0x59, 0x5e, 0x70, 0x71, 0x0b, 0xd4, 0x02, 0x15, 0x40, 0x6b, 0xa0, 0x6f, 0xe8, 0xde, 0x0f, 0x02, 0x0b, 0xa8, 0xb0, 0x03,
+	0xaf, 0x05, 0x2a, 0x02, 0x6f, 0x0d, 0x2c, 0x28, 0x20, 0xba, 0xe5, 0x93, 0xcb, 0x41, 0x38, 0x29, 0x19, 0xb1, 0xfd, 0xd0, 0x21, 0x81, 0xed, 0xfb,
+	0xce, 0x2c, 0x00, 0xc1, 0xf8, 0xeb, 0xd5, 0x6b, 0x32, 0x80, 0x5e, 0x33, 0x68, 0xe2, 0xd8, 0x68, 0x64, 0x11, 0xd8, 0x5b, 0x47, 0x4b, 0x6b, 0x00,
+	0xdf, 0x92, 0x76, 0x08, 0x79, 0xba, 0x65, 0xc4, 0x1a, 0x2d, 0x06, 0xb0, 0x35, 0x80, 0xad, 0xa3, 0xb2, 0xf8, 0x3b, 0xcf, 0x13, 0x06, 0xb1, 0x29,
+	0x08, 0x00, 0xed, 0xa3, 0xdd, 0x4b, 0x4d, 0xaf, 0xab, 0xb8, 0x85, 0xca, 0xa0, 0xbe, 0x8b, 0xe0, 0xda, 0x02, 0xba, 0xf5, 0x88, 0xbf, 0x06, 0x2a,
+	0xa0, 0xea, 0x35, 0xf0, 0xdf, 0xfa, 0xf7, 0xca, 0xcd, 0x47, 0xfa, 0xdf, 0x3e, 0xfd, 0xe8, 0xfd, 0xe7, 0x6d, 0x9f, 0xee, 0xce, 0x38, 0xda, 0x38,
+	0x65, 0xaa, 0x3e, 0xe8, 0x7e, 0xc0, 0xd0, 0xf7, 0xbf, 0x50, 0xbd, 0x93, 0x0d, 0xd5, 0x46, 0xab, 0x4a, 0x30, 0x87, 0xa9, 0x12, 0x4d, 0xaf, 0x65,
+	0x9a, 0x29, 0xb6, 0x2b, 0xc1, 0xca, 0xe9, 0xb4, 0x30, 0xfc, 0xec, 0xac, 0x1f, 0xac, 0x0f, 0xf0, 0xd2, 0x9c, 0x9d, 0x9f, 0x3b, 0x39, 0x37, 0x37,
+	0x3b, 0x29, 0x3f, 0x73, 0xaa, 0x81, 0x7d, 0x79, 0x1c, 0x37, 0xda, 0x1d, 0x17, 0x9a, 0x95, 0xa2, 0xfa, 0xf5, 0x9f, 0xbe, 0xdf, 0x78, 0x93, 0xdc,
+	0xf1, 0xe9, 0x73, 0x87, 0x7f, 0x9a, 0x1f, 0x3b, 0x93, 0xd2, 0x4a, 0x79, 0x06, 0x00, 0x00,
+};
+const char AppETag[] PROGMEM = "\"aedffe57856cf615\"";
+const char AppType[] PROGMEM = "text/html";
+
+#endif
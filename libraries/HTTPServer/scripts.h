@@ -178,14 +178,19 @@ const char Scripts[] PROGMEM = ""
 "\nap.ip=this.ip.value();if(this.gateway.changed)"
 "\nap.gateway=this.gateway.value();if(this.netmask.changed)"
 "\nap.netmask=this.netmask.value();};let Console=function(parent){this.parent=parent;this.tag=document.createElement('div');this.tag.className='Console';this.length=0;this.lines=0;this.elements=[];};Console.MAX_LINES=40;Console.prototype.init=function(data){};Console.prototype.addTextLine=function(text){let lineElement=null;if(Console.MAX_LINES>this.length){this.length+=1;lineElement=document.createElement('div');lineElement.className='Line';this.tag.append(lineElement);this.elements.push(lineElement);}else{let index=(this.lines%this.length);lineElement=this.elements[index];}"
-"\nlineElement.textContent=text;lineElement.style['order']=-(this.lines++);};Console.prototype.pong=function(pong){};let Wan=function(parent,name){Node.call(this,parent,name);this.tag=document.createElement('div');this.tag.className='Wan';this.title=document.createElement('div');this.title.className='Title';this.title.textContent='WAN Settings:';this.tag.append(this.title);this.separator=document.createElement('div');this.separator.className='Separator';this.tag.append(this.separator);this.id=new InputRow(this,'Gateway ID','text','',false);this.tag.append(this.id.tag);this.signal=new Signal(this,'server');this.tag.append(this.signal.tag);this.stats=document.createElement('div');this.stats.className='TextContent';this.stats.textContent='requsting stats ...';this.tag.append(this.stats);this.ttnConfiguration=new Advanced(this,'Configuration');this.ttnConfiguration.className='Advanced';this.tag.append(this.ttnConfiguration.tag);this.host=new InputRow(this,'host','text','',false);this.ttnConfiguration.addInput(this.host.tag);this.port=new InputRow(this,'port','number','',false,5);this.port.validator=new IntegerValidator(this.port,1,65535);this.ttnConfiguration.addInput(this.port.tag);this.istat=new InputRow(this,'ping','number','');this.istat.validator=new IntegerValidator(this.istat,10);this.ttnConfiguration.addInput(this.istat.tag);this.istat.setHelp('How often, in seconds, the gateway should send a STAT packet to TTN server.');this.ipull=new InputRow(this,'pull','number','');this.ipull.validator=new IntegerValidator(this.ipull,10);this.ttnConfiguration.addInput(this.ipull.tag);this.ipull.setHelp('How often, in seconds, the gateway should send a PULL_PKT packet to TTN server..');this.desc=new InputRow(this,'Description','text','');this.ttnConfiguration.addInput(this.desc.tag);this.mail=new InputRow(this,'e-mail','text','mail@example.com');this.ttnConfiguration.addInput(this.mail.tag);this.platform=new InputRow(this,'Platform','text','ESP8266');this.ttnConfiguration.addInput(this.platform.tag);this.lon=new InputRow(this,'Longitude','number','');this.lon.validator=new FloatValidator(this.lon);this.ttnConfiguration.addInput(this.lon.tag);this.lon.validator=new FloatValidator(this.lon);this.lat=new InputRow(this,'Latitude','number','');this.lat.validator=new FloatValidator(this.lat);this.ttnConfiguration.append(this.lat.tag);this.lat.validator=new FloatValidator(this.lat);this.alt=new InputRow(this,'Altitude','number','');this.alt.validator=new FloatValidator(this.alt);this.ttnConfiguration.addInput(this.alt.tag);this.alt.validator=new FloatValidator(this.alt);this.separator=document.createElement('div');this.separator.className='Separator';this.tag.append(this.separator);this.explanation=document.createElement('div');this.explanation.className='TextContent';this.explanation.textContent='Wan Server connection console log:';this.tag.append(this.explanation);this.console=new Console();this.tag.append(this.console.tag);this.lastACK=Date.now()-(3*60*1000);this.signalCallback=null;};for(let i in Node.prototype)"
-"\nWan.prototype[i]=Node.prototype[i];Wan.prototype.init=function(data){};Wan.prototype.onmessage=function(data){this[data.n](data.p);};Wan.prototype.onSaved=function(hrdwr){this.parent.hideWaiting();this.hrdwr(hrdwr);};Wan.prototype.ack=function(params){this.lastACK=Date.now();this.log(params);};Wan.prototype.tic=function(){let ticInterval=60*1000;clearTimeout(this.signalCallback);this.ticCallback=setTimeout(this.tic.bind(this),ticInterval);this.updateSignal();};Wan.prototype.updateSignal=function(){let now=Date.now();let diff=now-this.lastACK;let maxLevel=3;let minLevel=-1;let totalLevel=maxLevel-minLevel;let timeRule=totalLevel*60*1000;let normalized=diff/timeRule;let discrette=Math.floor(normalized*totalLevel);let meassuredLevel=maxLevel-discrette;let level=Math.max(minLevel,Math.min(meassuredLevel,maxLevel));this.signal.input.setLevel(level);};Wan.prototype.log=function(params){var now=new Date(1000*params.tstm);let date=now.toLocaleDateString('en-US',TSTMP_OPTIONS);let line='['+date+'] '+params.text;this.console.addTextLine(line);};Wan.prototype.isChanged=function(command){let changed=this.id.changed||this.host.changed||this.port.changed||this.desc.changed;changed=changed||this.mail.changed||this.platform.changed||this.lon.changed;changed=changed||this.lat.changed||this.alt.changed||this.istat.changed||this.ipull.changed;return changed;};Wan.prototype.save=function(command){Node.prototype.save.call(this,command);let wan=command.save={};if(this.id.changed)"
+"\nlineElement.textContent=text;lineElement.style['order']=-(this.lines++);};Console.prototype.pong=function(pong){};let Wan=function(parent,name){Node.call(this,parent,name);this.tag=document.createElement('div');this.tag.className='Wan';this.title=document.createElement('div');this.title.className='Title';this.title.textContent='WAN Settings:';this.tag.append(this.title);this.separator=document.createElement('div');this.separator.className='Separator';this.tag.append(this.separator);this.id=new InputRow(this,'Gateway ID','text','',false);this.tag.append(this.id.tag);this.signal=new Signal(this,'server');this.tag.append(this.signal.tag);this.stats=document.createElement('div');this.stats.className='TextContent';this.stats.textContent='requsting stats ...';this.tag.append(this.stats);this.ttnConfiguration=new Advanced(this,'Configuration');this.ttnConfiguration.className='Advanced';this.tag.append(this.ttnConfiguration.tag);this.host=new InputRow(this,'host','text','',false);this.ttnConfiguration.addInput(this.host.tag);this.port=new InputRow(this,'port','number','',false,5);this.port.validator=new IntegerValidator(this.port,1,65535);this.ttnConfiguration.addInput(this.port.tag);this.servers=new InputRow(this,'More servers','text','eu1.cloud.thethings.network:1700, 192.168.1.10:1700 up',false,200);this.ttnConfiguration.addInput(this.servers.tag);this.servers.setHelp('Up to two more network servers every uplink is forwarded to, host:port separated by commas. Downlinks of a server ending with up are refused.');this.istat=new InputRow(this,'ping','number','');this.istat.validator=new IntegerValidator(this.istat,10);this.ttnConfiguration.addInput(this.istat.tag);this.istat.setHelp('How often, in seconds, the gateway should send a STAT packet to TTN server.');this.ipull=new InputRow(this,'pull','number','');this.ipull.validator=new IntegerValidator(this.ipull,10);this.ttnConfiguration.addInput(this.ipull.tag);this.ipull.setHelp('How often, in seconds, the gateway should send a PULL_PKT packet to TTN server..');this.desc=new InputRow(this,'Description','text','');this.ttnConfiguration.addInput(this.desc.tag);this.mail=new InputRow(this,'e-mail','text','mail@example.com');this.ttnConfiguration.addInput(this.mail.tag);this.platform=new InputRow(this,'Platform','text','ESP8266');this.ttnConfiguration.addInput(this.platform.tag);this.region=new InputRow(this,'Region','text','EU868');this.ttnConfiguration.addInput(this.region.tag);this.region.setHelp('LoRaWAN regional parameters used to check downlinks: EU868, US915, AU915, AS923, IN865 or KR920.');this.beacon=new InputRow(this,'Class B beacons','checkbox','');this.beacon.input.input.className='';this.ttnConfiguration.addInput(this.beacon.tag);this.beacon.setHelp('Emits the beacon of the region every 128 s of GPS time, needs the clock synchronized by NTP.');this.filters=new InputRow(this,'Filters','text','deny foreign, allow netid 000013',false,400);this.ttnConfiguration.addInput(this.filters.tag);this.filters.setHelp('Received frames that are not forwarded, first matching rule wins: allow|deny devaddr 26011B00/24, netid 000013, joineui 70B3D57ED0000000-70B3D57ED0FFFFFF or foreign (not a LoRaWAN uplink). With allow rules of a kind, the frames of that kind no rule matches are dropped.');this.capture=new InputRow(this,'Capture','text','spiffs',false,70);this.ttnConfiguration.addInput(this.capture.tag);this.capture.setHelp('Records the received frames, the datagrams and the emitted frames to replay them with tools/replay: spiffs keeps the last 64 KB in /capture0.bin and /capture1.bin, host:port sends them to tools/replay --collect. Empty to stop.');this.lon=new InputRow(this,'Longitude','number','');this.lon.validator=new FloatValidator(this.lon);this.ttnConfiguration.addInput(this.lon.tag);this.lon.validator=new FloatValidator(this.lon);this.lat=new InputRow(this,'Latitude','number','');this.lat.validator=new FloatValidator(this.lat);this.ttnConfiguration.append(this.lat.tag);this.lat.validator=new FloatValidator(this.lat);this.alt=new InputRow(this,'Altitude','number','');this.alt.validator=new FloatValidator(this.alt);this.ttnConfiguration.addInput(this.alt.tag);this.alt.validator=new FloatValidator(this.alt);this.separator=document.createElement('div');this.separator.className='Separator';this.tag.append(this.separator);this.explanation=document.createElement('div');this.explanation.className='TextContent';this.explanation.textContent='Wan Server connection console log:';this.tag.append(this.explanation);this.console=new Console();this.tag.append(this.console.tag);this.lastACK=Date.now()-(3*60*1000);this.signalCallback=null;};for(let i in Node.prototype)"
+"\nWan.prototype[i]=Node.prototype[i];Wan.prototype.init=function(data){};Wan.prototype.onmessage=function(data){this[data.n](data.p);};Wan.prototype.onSaved=function(hrdwr){this.parent.hideWaiting();this.hrdwr(hrdwr);};Wan.prototype.ack=function(params){this.lastACK=Date.now();this.log(params);};Wan.prototype.tic=function(){let ticInterval=60*1000;clearTimeout(this.signalCallback);this.ticCallback=setTimeout(this.tic.bind(this),ticInterval);this.updateSignal();};Wan.prototype.updateSignal=function(){let now=Date.now();let diff=now-this.lastACK;let maxLevel=3;let minLevel=-1;let totalLevel=maxLevel-minLevel;let timeRule=totalLevel*60*1000;let normalized=diff/timeRule;let discrette=Math.floor(normalized*totalLevel);let meassuredLevel=maxLevel-discrette;let level=Math.max(minLevel,Math.min(meassuredLevel,maxLevel));this.signal.input.setLevel(level);};Wan.prototype.log=function(params){var now=new Date(1000*params.tstm);let date=now.toLocaleDateString('en-US',TSTMP_OPTIONS);let line='['+date+'] '+params.text;this.console.addTextLine(line);};Wan.prototype.isChanged=function(command){let changed=this.id.changed||this.host.changed||this.port.changed||this.servers.changed||this.desc.changed;changed=changed||this.mail.changed||this.platform.changed||this.lon.changed;changed=changed||this.lat.changed||this.alt.changed||this.istat.changed||this.ipull.changed||this.region.changed||this.beacon.changed||this.filters.changed||this.capture.changed;return changed;};Wan.prototype.save=function(command){Node.prototype.save.call(this,command);let wan=command.save={};if(this.id.changed)"
 "\nwan.id=this.id.value();if(this.host.changed)"
 "\nwan.host=this.host.value();if(this.port.changed)"
-"\nwan.port=this.port.value()|0;if(this.desc.changed)"
+"\nwan.port=this.port.value()|0;if(this.servers.changed)"
+"\nwan.servers=this.servers.value();if(this.desc.changed)"
 "\nwan.desc=this.desc.value();if(this.mail.changed)"
 "\nwan.mail=this.mail.value();if(this.platform.changed)"
-"\nwan.platform=this.platform.value();if(this.lon.changed)"
+"\nwan.platform=this.platform.value();if(this.region.changed)"
+"\nwan.region=this.region.value();if(this.beacon.changed)"
+"\nwan.beacon=this.beacon.value();if(this.filters.changed)"
+"\nwan.filters=this.filters.value();if(this.capture.changed)"
+"\nwan.capture=this.capture.value();if(this.lon.changed)"
 "\nwan.lon=this.lon.value();if(this.lat.changed)"
 "\nwan.lat=this.lat.value();if(this.alt.changed)"
 "\nwan.alt=this.alt.value();if(this.istat.changed)"
@@ -193,16 +198,24 @@ const char Scripts[] PROGMEM = ""
 "\nwan.ipull=1000*this.ipull.value();};Wan.prototype.state=function(wan){if('id'in wan)"
 "\nthis.id.pong(wan.id);if('host'in wan)"
 "\nthis.host.pong(wan.host);if('port'in wan)"
-"\nthis.port.pong(wan.port);if('desc'in wan)"
+"\nthis.port.pong(wan.port);if('servers'in wan)"
+"\nthis.servers.pong(wan.servers);if('ackrs'in wan)"
+"\nthis.servers.message(`ack: ${wan.ackrs.map(a=>a/100+'%').join(' ')} rtt: ${wan.rtts.join(' ')} ms`);if('desc'in wan)"
 "\nthis.desc.pong(wan.desc);if('mail'in wan)"
 "\nthis.mail.pong(wan.mail);if('platform'in wan)"
-"\nthis.platform.pong(wan.platform);if('lon'in wan)"
+"\nthis.platform.pong(wan.platform);if('region'in wan)"
+"\nthis.region.pong(wan.region);if('beacon'in wan)"
+"\nthis.beacon.pong(wan.beacon);if('filters'in wan)"
+"\nthis.filters.pong(wan.filters);if('hits'in wan)"
+"\nthis.filters.message(`hits: ${wan.hits.join(' ')} unmatched: ${wan.unmatched}`);if('capture'in wan)"
+"\nthis.capture.pong(wan.capture);if('captured'in wan)"
+"\nthis.capture.message(`records: ${wan.captured[0]} lost: ${wan.captured[1]} written: ${wan.captured[2]} bytes`);if('lon'in wan)"
 "\nthis.lon.pong(wan.lon);if('lat'in wan)"
 "\nthis.lat.pong(wan.lat);if('alt'in wan)"
 "\nthis.alt.pong(wan.alt);if('istat'in wan){let istat=(wan.istat/1000).toFixed(2);this.istat.pong(istat);}"
 "\nif('ipull'in wan){let ipull=(wan.ipull/1000).toFixed(2);this.ipull.pong(ipull);}"
 "\nif('now'in wan){let now=Date.now();let timeDiff=now-(+wan.now);this.lastACK=+wan.ack+timeDiff;this.tic();}"
-"\nif(wan.stats){this.stats.textContent=`up:${wan.stats.rxnb} ::: sent:${wan.stats.rxfw} ::: down:${wan.stats.dwnb} ::: emitted:${wan.stats.txnb}`;}};Wan.prototype.pong=function(pong){};Wan.prototype.showMessage=function(message){this.parent.showMessage(message,true);};let RFM=function(parent,name){Node.call(this,parent,name);this.tag=document.createElement('div');this.tag.className='RFM';this.title=document.createElement('div');this.title.className='Title';this.title.textContent='Radio Frequency Module:';this.tag.append(this.title);this.title.style.width='calc(100% - 1.2em)';this.separator=document.createElement('div');this.separator.className='Separator';this.tag.append(this.separator);this.status=new StatusRow(this,'status');this.tag.append(this.status.tag);this.status.input.label.textContent='initialized';this.status.input.point.style['background-color']='#0F0';this.freq=new InputRow(this,'Frequency MHz','text','');this.tag.append(this.freq.tag);this.freq.validator=new FloatValidator(this.freq);this.freq.setHelp('This is the frequency the Radio Frequency Module is currently operaing at.');this.configuration=new Advanced(this,'Configuration');this.configuration.tag.className='Advanced';this.tag.append(this.configuration.tag);this.minfreq=new InputRow(this,'MAX Frequency','text','');this.minfreq.tag.classList.add('Boundary');this.configuration.append(this.minfreq.tag);this.minfreq.validator=new FloatValidator(this.minfreq);this.minfreq.setHelp(`MHz min and max are the boundaries the Radio Frequency Module can operate at. TTN is going to tell the gateway the frequency it should use to emit DOWN packets, if it's outside this boundaries, the gateway will answer TTN with an 'unsupported frequency error'.`);this.maxfreq=new InputRow(this,'MIN Frequency','text','');this.maxfreq.tag.classList.add('Boundary');this.configuration.append(this.maxfreq.tag);this.maxfreq.validator=new FloatValidator(this.maxfreq);this.txpw=new InputRow(this,'TX power','select','');this.txpw.addOptions(TXPWS);this.configuration.append(this.txpw.tag);this.txpw.setHelp('This is the default power the module should emmit with.');this.cad=new InputRow(this,'CAD','checkbox','');this.cad.input.input.className='';this.cad.input.input.disabled=true;this.configuration.append(this.cad.tag);this.cad.setHelp(`CAD Stands for Channel Activity Detection, this version doesn't supoprt it, it will be added in a future release.`);this.sfac=new InputRow(this,'Spreading Factor','select','');this.sfac.addOptions(SFACS);this.configuration.append(this.sfac.tag);this.sfac.setHelp('This is the Spreading Factor the Radio Frequency Module is going to use to receive packets if CAD is turned OFF (wich in this version is still unsupported). TTN is going to tell the gateway which SF it should use to emit DOWN packets.');this.sbw=new InputRow(this,'Band Width','select','');this.sbw.addOptions(SBWS);this.configuration.append(this.sbw.tag);this.sbw.setHelp('This is the Bandwidth the Radio Frequency Module is going to use to receive packets if CAD is turned OFF (wich in this version is still unsupported). TTN is going to tell the gateway wich Bandwidth configuration it should use to emit DOWN packets.');this.plength=new InputRow(this,'Preamble Length','text','');this.plength.tag.classList.add('Short');this.configuration.append(this.plength.tag);this.plength.validator=new IntegerValidator(this.plength,1);this.plength.setHelp('This is an advanced configuration, default value should work, yet you can change it if you need.');this.sword=new InputRow(this,'Sync Word','text','');this.sword.tag.classList.add('Short');this.configuration.append(this.sword.tag);this.sword.validator=new ByteValidator(this.sword);this.sword.setHelp('This is an advanced configuration, default value should work, yet you can change it if you need.');this.pins=new Advanced(this,'PIN connections');this.pins.tag.className='Advanced Pins';this.tag.append(this.pins.tag);this.explanation=document.createElement('div');this.explanation.className='TextContent';this.explanation.textContent='PIN configuration (disabled options are not available in this version)';this.pins.append(this.explanation);this.separator=document.createElement('div');this.separator.className='Separator';this.pins.append(this.separator);this.miso=new InputRow(this,'MISO','select','',true);this.miso.addOptions(ESP.PINS);this.pins.append(this.miso.tag);this.mosi=new InputRow(this,'MOSI','select','',true);this.mosi.addOptions(ESP.PINS);this.pins.append(this.mosi.tag);this.sck=new InputRow(this,'SCK','select','',true);this.sck.addOptions(ESP.PINS);this.pins.append(this.sck.tag);this.nss=new InputRow(this,'nss','select','');this.nss.addOptions(ESP.PINS);this.pins.append(this.nss.tag);this.rst=new InputRow(this,'reset','select','');this.rst.addOptions(ESP.PINS);this.pins.append(this.rst.tag);for(let i=0;i<=5;i++){let diox=this[`dio${i}`]=new InputRow(this,`dio${i}`,'select','',!!i);diox.addOptions(ESP.PINS);this.pins.append(diox.tag);}"
+"\nif(wan.stats){this.stats.textContent=`up:${wan.stats.rxnb} ::: sent:${wan.stats.rxfw} ::: down:${wan.stats.dwnb} ::: emitted:${wan.stats.txnb} ::: duty:${wan.stats.duty/100}% ::: beacons:${wan.stats.bcnb} ::: dropped:${wan.stats.drop}`;}};Wan.prototype.pong=function(pong){};Wan.prototype.showMessage=function(message){this.parent.showMessage(message,true);};let RFM=function(parent,name){Node.call(this,parent,name);this.tag=document.createElement('div');this.tag.className='RFM';this.title=document.createElement('div');this.title.className='Title';this.title.textContent='Radio Frequency Module:';this.tag.append(this.title);this.title.style.width='calc(100% - 1.2em)';this.separator=document.createElement('div');this.separator.className='Separator';this.tag.append(this.separator);this.status=new StatusRow(this,'status');this.tag.append(this.status.tag);this.status.input.label.textContent='initialized';this.status.input.point.style['background-color']='#0F0';this.freq=new InputRow(this,'Frequency MHz','text','');this.tag.append(this.freq.tag);this.freq.validator=new FloatValidator(this.freq);this.freq.setHelp('This is the frequency the Radio Frequency Module is currently operaing at.');this.configuration=new Advanced(this,'Configuration');this.configuration.tag.className='Advanced';this.tag.append(this.configuration.tag);this.minfreq=new InputRow(this,'MAX Frequency','text','');this.minfreq.tag.classList.add('Boundary');this.configuration.append(this.minfreq.tag);this.minfreq.validator=new FloatValidator(this.minfreq);this.minfreq.setHelp(`MHz min and max are the boundaries the Radio Frequency Module can operate at. TTN is going to tell the gateway the frequency it should use to emit DOWN packets, if it's outside this boundaries, the gateway will answer TTN with an 'unsupported frequency error'.`);this.maxfreq=new InputRow(this,'MIN Frequency','text','');this.maxfreq.tag.classList.add('Boundary');this.configuration.append(this.maxfreq.tag);this.maxfreq.validator=new FloatValidator(this.maxfreq);this.txpw=new InputRow(this,'TX power','select','');this.txpw.addOptions(TXPWS);this.configuration.append(this.txpw.tag);this.txpw.setHelp('This is the default power the module should emmit with.');this.cad=new InputRow(this,'CAD','checkbox','');this.cad.input.input.className='';this.cad.input.input.disabled=true;this.configuration.append(this.cad.tag);this.cad.setHelp(`CAD Stands for Channel Activity Detection, this version doesn't supoprt it, it will be added in a future release.`);this.sfac=new InputRow(this,'Spreading Factor','select','');this.sfac.addOptions(SFACS);this.configuration.append(this.sfac.tag);this.sfac.setHelp('This is the Spreading Factor the Radio Frequency Module is going to use to receive packets if CAD is turned OFF (wich in this version is still unsupported). TTN is going to tell the gateway which SF it should use to emit DOWN packets.');this.sbw=new InputRow(this,'Band Width','select','');this.sbw.addOptions(SBWS);this.configuration.append(this.sbw.tag);this.sbw.setHelp('This is the Bandwidth the Radio Frequency Module is going to use to receive packets if CAD is turned OFF (wich in this version is still unsupported). TTN is going to tell the gateway wich Bandwidth configuration it should use to emit DOWN packets.');this.plength=new InputRow(this,'Preamble Length','text','');this.plength.tag.classList.add('Short');this.configuration.append(this.plength.tag);this.plength.validator=new IntegerValidator(this.plength,1);this.plength.setHelp('This is an advanced configuration, default value should work, yet you can change it if you need.');this.sword=new InputRow(this,'Sync Word','text','');this.sword.tag.classList.add('Short');this.configuration.append(this.sword.tag);this.sword.validator=new ByteValidator(this.sword);this.sword.setHelp('This is an advanced configuration, default value should work, yet you can change it if you need.');this.pins=new Advanced(this,'PIN connections');this.pins.tag.className='Advanced Pins';this.tag.append(this.pins.tag);this.explanation=document.createElement('div');this.explanation.className='TextContent';this.explanation.textContent='PIN configuration (disabled options are not available in this version)';this.pins.append(this.explanation);this.separator=document.createElement('div');this.separator.className='Separator';this.pins.append(this.separator);this.miso=new InputRow(this,'MISO','select','',true);this.miso.addOptions(ESP.PINS);this.pins.append(this.miso.tag);this.mosi=new InputRow(this,'MOSI','select','',true);this.mosi.addOptions(ESP.PINS);this.pins.append(this.mosi.tag);this.sck=new InputRow(this,'SCK','select','',true);this.sck.addOptions(ESP.PINS);this.pins.append(this.sck.tag);this.nss=new InputRow(this,'nss','select','');this.nss.addOptions(ESP.PINS);this.pins.append(this.nss.tag);this.rst=new InputRow(this,'reset','select','');this.rst.addOptions(ESP.PINS);this.pins.append(this.rst.tag);for(let i=0;i<=5;i++){let diox=this[`dio${i}`]=new InputRow(this,`dio${i}`,'select','',!!i);diox.addOptions(ESP.PINS);this.pins.append(diox.tag);}"
 "\nthis.separator=document.createElement('div');this.separator.className='Separator';this.tag.append(this.separator);this.explanation=document.createElement('div');this.explanation.className='TextContent';this.explanation.textContent='Radio Frequency Module console log:';this.tag.append(this.explanation);this.console=new Console();this.tag.append(this.console.tag);};for(let i in Node.prototype)"
 "\nRFM.prototype[i]=Node.prototype[i];RFM.prototype.init=function(data){this.console.addTextLine('RX/TX console v1.0');};RFM.prototype.onopen=function(){this.console.addTextLine('RFM Module console v1.0 connected');};RFM.prototype.onerror=function(error){this.console.addTextLine(''+error);};RFM.prototype.onclose=function(e){this.console.addTextLine('disconnected from server, reconnecting ...');setTimeout(this.connect.bind(this),2000);};RFM.prototype.onmessage=function(data){let name=data.n;let params=data.p;if(!(name in this)){console.log('no method found: ');console.log(data);}"
 "\nthis[name](params);};RFM.prototype.log=function(params){var now=new Date(1000*params.tstm);let date=now.toLocaleDateString('en-US',TSTMP_OPTIONS);let line='['+date+'] '+params.text;this.console.addTextLine(line);};RFM.prototype.isChanged=function(){let changed=this.freq.changed||this.minfreq.changed||this.maxfreq.changed||this.sfac.changed||this.sbw.changed||this.plength.changed||this.sword.changed||this.miso.changed||this.mosi.changed||this.sck.changed||this.nss.changed||this.rst.changed;for(let i=0;i<=5;i++)"
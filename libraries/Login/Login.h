@@ -69,13 +69,21 @@ class Login : public Node {
 		this->JLID(response);
 	}
 
-	void user(String& edata, JsonObject& response, JsonObject& broadcast) {
+	// edata is consumed: base64 decoded and decrypted inside its own buffer, then parsed in place from there
+	// true when the command ran and response holds its plain result, false when response holds the LID error
+	bool user(String& edata, JsonObject& response, JsonObject& broadcast) {
 		this->LID(); // don't forget to lid
-		String data = this->aesm->decrypt((byte*) edata.c_str());
-		// DEBUG.println(data);
+		byte* buffer = (byte*) edata.begin();
+		int size = Base64::decode(buffer, edata.length(), buffer, edata.length());
+		unsigned int length = (0 < size) ? this->aesm->decryptInPlace(buffer, size) : 0u;
+		if (0u == length) {
+			DEBUG.println("ERROR: undecryptable command");
+			this->LIDError(response);
+			return false;
+		}
 
-		DynamicJsonDocument requestDocument(1024);
-		DeserializationError error = deserializeJson(requestDocument, data);
+		ScratchJsonDocument requestDocument(SCRATCH_COMMAND);
+		DeserializationError error = deserializeJson(requestDocument, (char*) buffer + N_BLOCK, length);
 		if (!error) {
 			JsonObject command = requestDocument.as<JsonObject>();
 			JsonObject id = command["id"];
@@ -84,17 +92,8 @@ class Login : public Node {
 			if (this->bid == b && this->lid < l) {
 				this->lid = l;
 				JsonObject params = command["p"];
-
-				DynamicJsonDocument responseDocument(1024);
-				JsonObject dresponse = responseDocument.to<JsonObject>();
-
-				this->parent->oncommand(params, dresponse, broadcast);
-
-				String data = "";
-				serializeJson(dresponse, data);
-				//DEBUG.println("decrypted: " + data);
-				String edata = this->aesm->encrypt((byte*) data.c_str(), data.length());
-				response["data"] = edata;
+				this->parent->oncommand(params, response, broadcast);
+				return true;
 			} else {
 				DEBUG.println("this->bid == b && this->lid < l");
 				this->LIDError(response);
@@ -103,6 +102,7 @@ class Login : public Node {
 			DEBUG.println("ERROR: DeserializationError");
 			this->LIDError(response);
 		}
+		return false;
 	}
 
 	void LIDError(JsonObject& response) {
@@ -115,9 +115,9 @@ class Login : public Node {
 		if (params.containsKey("key")) {
 			String keySTR = params["key"];
 			byte* base64 = (byte*) keySTR.c_str();
-			unsigned int binary_length = Base64::decode_length(base64);
-			if (32 == binary_length) {
-				Base64::decode(base64, this->key);
+			byte key[32];
+			if (32 == Base64::decode(base64, keySTR.length(), key, 32)) {
+				memcpy(this->key, key, 32);
 			}
 		}
 	}
@@ -136,8 +136,7 @@ class Login : public Node {
 
 	void change(JsonObject& params, JsonObject& response, JsonObject& broadcast) {
 		this->fromJSON(params);
-		delete this->aesm;
-		this->aesm = new AESM(this->key);
+		this->aesm->setKey(this->key); // the only place the key schedule is rebuilt
 		this->saveFile();
 		this->login(params, response, broadcast);
 	}
@@ -0,0 +1,69 @@
+#include <Metrics.h>
+
+Metrics::~Metrics() {
+	delete[] this->metrics;
+}
+
+uint8_t Metrics::add(const char* key, Metric::Type type, const char* group) {
+	// nodes register their metrics once, from their constructors
+	Metric* metrics = new Metric[this->length + 1];
+	for (uint8_t i = 0u; i < this->length; i++) {
+		metrics[i] = this->metrics[i];
+	}
+	metrics[this->length].key = key;
+	metrics[this->length].type = type;
+	metrics[this->length].group = group;
+	delete[] this->metrics;
+	this->metrics = metrics;
+	this->length += 1u;
+	return this->length - 1u;
+}
+
+void Metrics::set(uint8_t id, uint64_t value) {
+	Metric& metric = this->metrics[id];
+	if (0ul == metric.changed || metric.value != value) {
+		metric.value = value;
+		metric.changed = this->tick;
+	}
+}
+
+void Metrics::setText(uint8_t id, const String& text) {
+	Metric& metric = this->metrics[id];
+	if (0ul == metric.changed || metric.text != text) {
+		metric.text = text;
+		metric.changed = this->tick;
+	}
+}
+
+// true when write(state, since) has something to write
+bool Metrics::since(uint32_t since) {
+	for (uint8_t i = 0u; i < this->length; i++) {
+		Metric& metric = this->metrics[i];
+		if (Metric::CLOCK == metric.type) {
+			if (0ul == since && 0ul != metric.changed) return true;
+		} else if (since < metric.changed) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// everything changed after the tick "since", a keyframe when since is 0
+void Metrics::write(JsonObject& state, uint32_t since) {
+	for (uint8_t i = 0u; i < this->length; i++) {
+		Metric& metric = this->metrics[i];
+		bool changed = (Metric::CLOCK == metric.type) ? (0ul == since && 0ul != metric.changed) : (since < metric.changed);
+		if (!changed) continue;
+
+		JsonObject object = state;
+		if (NULL != metric.group) {
+			object = state.containsKey(metric.group) ? state[metric.group].as<JsonObject>() : state.createNestedObject(metric.group);
+		}
+
+		switch (metric.type) {
+			case Metric::INT: object[metric.key] = (int64_t) metric.value; break;
+			case Metric::TEXT: object[metric.key] = metric.text; break;
+			default: object[metric.key] = metric.value; break;
+		}
+	}
+}
@@ -0,0 +1,41 @@
+#include <Arduino.h>
+#define ARDUINOJSON_USE_DOUBLE 1
+#define ARDUINOJSON_FAST_FLOAT 1
+#include <ArduinoJson.h>
+
+#ifndef __Metrics__
+#define __Metrics__
+
+class Metric {
+	public:
+	enum Type : uint8_t {
+		UINT,  // counters, sizes
+		INT,   // signed values, RSSI
+		TEXT,  // short strings, SSID
+		CLOCK  // always moving, only sent on keyframes, the dashboard keeps counting by itself
+	};
+
+	const char* group = NULL; // nested object inside "state", NULL for the state itself
+	const char* key = NULL;
+	Type type = UINT;
+	uint64_t value = 0ull;    // INT keeps the two's complement bits
+	String text = "";
+	uint32_t changed = 0ul;   // sample tick of the last change, 0 if it was never sampled
+};
+
+class Metrics {
+	public:
+	uint32_t tick = 0ul; // current sample tick, set by Node::sample
+	uint8_t length = 0u;
+	Metric* metrics = NULL;
+
+	virtual ~Metrics();
+
+	uint8_t add(const char* key, Metric::Type type = Metric::UINT, const char* group = NULL);
+	void set(uint8_t id, uint64_t value);
+	void setText(uint8_t id, const String& text);
+	bool since(uint32_t since);
+	void write(JsonObject& state, uint32_t since);
+};
+
+#endif
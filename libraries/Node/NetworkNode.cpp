@@ -3,9 +3,26 @@
 NetworkNode::NetworkNode(Node* parent, const char* name) : Node(parent, name) {
 	this->login = new Login(this, "login");
 	this->nodes->set(this->login->name, this->login);
+
+	// every broadcast is encoded once, "last" is what it copied instead of payload * clients
+	this->metrics.add("bcst", Metric::UINT, "ws");
+	this->metrics.add("fback", Metric::UINT, "ws");
+	this->metrics.add("copied", Metric::UINT, "ws");
+	this->metrics.add("last", Metric::UINT, "ws");
+	this->metrics.add("sent", Metric::UINT, "ws");
+	// time the main loop spent on WebSocket I/O and how far behind the slowest browser is
+	this->metrics.add("us", Metric::UINT, "ws");
+	this->metrics.add("maxus", Metric::UINT, "ws");
+	this->metrics.add("depth", Metric::UINT, "ws");
+	this->metrics.add("queued", Metric::UINT, "ws");
+	this->metrics.add("drops", Metric::UINT, "ws");
+	this->metrics.add("kicks", Metric::UINT, "ws");
+	this->metrics.add("stack", Metric::UINT, "u");
+	this->metrics.add("heap", Metric::UINT, "u");
 }
 
 NetworkNode::~NetworkNode() {
+	this->clearSnapshot();
 	delete this->login;
 	delete this->webSocketServer;
 	delete this->httpServer;
@@ -36,72 +53,310 @@ void NetworkNode::loop() {
 
 void NetworkNode::session() {
 	this->sendHeaders();
-	DynamicJsonDocument responseDocument(256);
+	ScratchJsonDocument responseDocument(256);
 	JsonObject responseObject = responseDocument.to<JsonObject>();
 	this->login->session(responseObject);
 	this->httpResponse(responseObject);
 }
 
+// the only copy of the command is the argument itself, Login::user decodes, decrypts and parses it in
+// place and the response is encrypted in one scratch buffer and base64 streamed into the TCP send buffer
 void NetworkNode::user() {
+	ESP.resetFreeContStack();
+	uint32_t freeStack = ESP.getFreeContStack();
+	this->usage.before = ESP.getFreeHeap();
+	this->usage.lowest = this->usage.before;
+
 	this->sendHeaders();
 	String edata = this->httpServer->server->arg("d");
-	DynamicJsonDocument responseDocument(1024);
+	ScratchJsonDocument responseDocument(SCRATCH_COMMAND);
 	JsonObject responseObject = responseDocument.to<JsonObject>();
-	DynamicJsonDocument broadcastDocument(1024);
+	ScratchJsonDocument broadcastDocument(SCRATCH_COMMAND);
 	JsonObject broadcast = broadcastDocument.to<JsonObject>();
 
-	this->login->user(edata, responseObject, broadcast);
-	this->httpResponse(responseObject);
+	bool executed = this->login->user(edata, responseObject, broadcast);
+	this->lowestHeap();
+	if (executed) {
+		this->httpEncryptedResponse(responseObject);
+	} else {
+		this->httpResponse(responseObject);
+	}
 	this->command(broadcast);
+
+	this->usage.stack = freeStack - ESP.getFreeContStack();
+	this->usage.heap = this->usage.before - this->usage.lowest;
+}
+
+void NetworkNode::lowestHeap() {
+	uint32_t freeHeap = ESP.getFreeHeap();
+	if (freeHeap < this->usage.lowest) this->usage.lowest = freeHeap;
 }
 
 void NetworkNode::onEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
-	// TODO:: handle client messages
 	switch(type) {
 		case WStype_DISCONNECTED: {
 			// Serial.printf("[%u] Disconnected!\n", num);
+			this->subscribers[num].connected = false;
+			if (0 == this->webSocketServer->connectedClients()) {
+				this->clearSnapshot(); // nobody to send it to, give the heap back
+			}
 		} break;
 		case WStype_CONNECTED: {
 			// IPAddress ip = this->webSocketServer->remoteIP(num);
-			for (uint16_t i = 0; i < this->nodes->length; i++) {
-				KeyValue<Node>* keyValue = this->nodes->keyValues[i];
-				DynamicJsonDocument rootDocument(256);
-				JsonObject command = rootDocument.to<JsonObject>();
-				JsonObject node = command.createNestedObject(keyValue->key);
-				node.createNestedObject("state");
+			// the others already have it, from here on they all get the same broadcasts
+			this->sendSnapshot(num);
 
-				DynamicJsonDocument responseDocument(1024);
-				JsonObject response = responseDocument.to<JsonObject>();
-
-				DynamicJsonDocument broadcastDocument(1024);
-				JsonObject broadcast = broadcastDocument.to<JsonObject>();
-
-				this->oncommand(command, response, broadcast);
-				this->command(response);
-			}
+			Subscriber& subscriber = this->subscribers[num];
+			subscriber = Subscriber();
+			subscriber.connected = true;
+			subscriber.iping = this->iping;
+			subscriber.lping = clock64.mstime();
 		} break;
 		case WStype_TEXT: {
 			if (0 < length) {
 				// Serial.printf("[%u] get Text: %s\n", num, payload);
-				// this->command(num, payload, length);
+				this->subscribe(num, payload, length, false);
+			}
+		} break;
+		case WStype_BIN: {
+			if (0 < length) {
+				this->subscribe(num, payload, length, true);
 			}
 		} break;
 	}
 }
 
+void NetworkNode::sendSnapshot(uint8_t num) {
+	uint32_t age = millis() - this->snapshot.time;
+	if (this->snapshot.version != this->stateVersion || this->isnap < age) {
+		this->buildSnapshot();
+	}
+	for (uint16_t i = 0; i < this->snapshot.length; i++) {
+		this->webSocketServer->sendTXT(num, this->snapshot.messages[i]);
+	}
+}
+
+void NetworkNode::buildSnapshot() {
+	this->clearSnapshot();
+	this->snapshot.length = this->nodes->length;
+	this->snapshot.messages = new String[this->snapshot.length];
+	for (uint16_t i = 0; i < this->nodes->length; i++) {
+		KeyValue<Node>* keyValue = this->nodes->keyValues[i];
+		ScratchJsonDocument rootDocument(256);
+		JsonObject command = rootDocument.to<JsonObject>();
+		JsonObject node = command.createNestedObject(keyValue->key);
+		node.createNestedObject("state");
+
+		ScratchJsonDocument responseDocument(1024);
+		JsonObject response = responseDocument.to<JsonObject>();
+
+		ScratchJsonDocument broadcastDocument(1024);
+		JsonObject broadcast = broadcastDocument.to<JsonObject>();
+
+		this->oncommand(command, response, broadcast);
+		this->snapshot.messages[i] = this->message(response); // encrypted once, sent to every dashboard that connects
+		yield();
+	}
+	this->snapshot.version = this->stateVersion;
+	this->snapshot.time = millis();
+}
+
+void NetworkNode::clearSnapshot() {
+	delete[] this->snapshot.messages;
+	this->snapshot.messages = NULL;
+	this->snapshot.length = 0u;
+	this->snapshot.version = 0ul;
+}
+
+void NetworkNode::invalidate() {
+	this->stateVersion += 1ul;
+}
+
+void NetworkNode::command(JsonObject& command) {
+	uint8_t texts = 0u;
+	uint8_t packets = 0u;
+	for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+		Subscriber& subscriber = this->subscribers[i];
+		if (subscriber.connected) {
+			if (subscriber.binary) packets += 1u; else texts += 1u;
+		}
+	}
+
+	// each encoding is built once, and only when someone speaks it
+	if (0u < texts) {
+		String responseSTR = this->message(command);
+		if (0u == packets) {
+			this->webSocketServer->broadcastTXT(responseSTR);
+		} else {
+			for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+				Subscriber& subscriber = this->subscribers[i];
+				if (subscriber.connected && !subscriber.binary) this->webSocketServer->sendTXT(i, responseSTR);
+			}
+		}
+	}
+	if (0u < packets) {
+		size_t length = 0u;
+		uint8_t* buffer = this->packet(command, length);
+		if (0u == texts) {
+			Packet::broadcast(this->webSocketServer, buffer, length);
+		} else {
+			for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+				Subscriber& subscriber = this->subscribers[i];
+				if (subscriber.connected && subscriber.binary) Packet::send(this->webSocketServer, i, buffer, length);
+			}
+		}
+		scratch.deallocate(buffer);
+	}
+	yield();
+}
+
+void NetworkNode::pingSubscribers() {
+	uint64_t now = clock64.mstime();
+	bool due[WEBSOCKETS_SERVER_CLIENT_MAX];
+	bool anyone = false;
+	for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+		Subscriber& subscriber = this->subscribers[i];
+		due[i] = subscriber.connected && (subscriber.iping <= (uint32_t)(now - subscriber.lping));
+		anyone = anyone || due[i];
+	}
+	if (!anyone) return;
+
+	this->tick += 1ul;
+	this->sample(this->tick);
+
+	// subscribers pinged in the same round, in the same mode and since the same tick get the same message, encrypted once
+	for (uint8_t mode = 0u; mode < 2u; mode++) {
+		bool binary = (1u == mode);
+		String message = "";
+		uint8_t* buffer = NULL;
+		size_t length = 0u;
+		uint32_t msince = 0ul;
+		bool built = false;
+		for (uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+			Subscriber& subscriber = this->subscribers[i];
+			if (!due[i] || binary != subscriber.binary) continue;
+			uint32_t since = (0u == subscriber.pings % this->ikey) ? 0ul : subscriber.since;
+			if (!built || since != msince) {
+				scratch.deallocate(buffer);
+				buffer = NULL;
+				length = 0u;
+				ScratchJsonDocument pongDocument(1024);
+				JsonObject pongObject = pongDocument.to<JsonObject>();
+				this->ping(pongObject, since);
+				if (0u < pongObject.size()) { // nothing changed, nothing to send
+					if (binary) {
+						buffer = this->packet(pongObject, length);
+					} else {
+						message = this->message(pongObject);
+					}
+				} else {
+					message = "";
+				}
+				msince = since;
+				built = true;
+			}
+			if (binary && NULL != buffer) {
+				Packet::send(this->webSocketServer, i, buffer, length);
+			} else if (!binary && 0u < message.length()) {
+				this->webSocketServer->sendTXT(i, message);
+			}
+			subscriber.since = this->tick;
+			subscriber.pings += 1u;
+			subscriber.lping = now;
+		}
+		scratch.deallocate(buffer);
+	}
+}
+
+// {"data": encrypted {"iping": milliseconds, "bin": 1}} in a text frame, or iv + AES-CBC(MessagePack) of
+// the same object in a binary frame, sets the ping interval and the protocol of that dashboard only
+void NetworkNode::subscribe(uint8_t num, uint8_t* payload, size_t length, bool binary) {
+	ScratchJsonDocument commandDocument(256);
+	DeserializationError error;
+	String data = "";
+	if (binary) {
+		unsigned int plainLength = this->login->aesm->decryptInPlace(payload, length);
+		if (0u == plainLength) return;
+		error = deserializeMsgPack(commandDocument, (char*) payload + N_BLOCK, plainLength);
+	} else {
+		ScratchJsonDocument messageDocument(256);
+		error = deserializeJson(messageDocument, (char*) payload, length);
+		const char* edata = messageDocument["data"];
+		if (error || NULL == edata) return;
+		data = this->login->aesm->decrypt((byte*) edata, strlen(edata));
+		error = deserializeJson(commandDocument, data);
+	}
+	if (error) return;
+
+	Subscriber& subscriber = this->subscribers[num];
+	JsonObject command = commandDocument.as<JsonObject>();
+	if (command.containsKey("iping")) {
+		uint32_t iping = command["iping"];
+		subscriber.iping = constrain(iping, 1000ul, 60ul * 60ul * 1000ul);
+	}
+	if (command.containsKey("bin")) {
+		subscriber.binary = command["bin"];
+	}
+}
+
+void NetworkNode::measure() {
+	const WebSocketsServer::WSbroadcastStats_t& stats = this->webSocketServer->getBroadcastStats();
+	this->metrics.set(NetworkNode::Ping::BCST, stats.broadcasts);
+	this->metrics.set(NetworkNode::Ping::FBACK, stats.fallbacks);
+	this->metrics.set(NetworkNode::Ping::COPIED, stats.copied);
+	this->metrics.set(NetworkNode::Ping::LAST, stats.lastCopied);
+	this->metrics.set(NetworkNode::Ping::SENT, stats.lastSent);
+
+	const WebSocketsServer::WSioStats_t& io = this->webSocketServer->getIOStats();
+	this->metrics.set(NetworkNode::Ping::US, io.lastMicros);
+	this->metrics.set(NetworkNode::Ping::MAXUS, io.maxMicros);
+	this->metrics.set(NetworkNode::Ping::DEPTH, io.depth);
+	this->metrics.set(NetworkNode::Ping::QUEUED, io.queued);
+	this->metrics.set(NetworkNode::Ping::DROPS, io.drops);
+	this->metrics.set(NetworkNode::Ping::KICKS, io.kicks);
+
+	this->metrics.set(NetworkNode::Ping::USTACK, this->usage.stack);
+	this->metrics.set(NetworkNode::Ping::UHEAP, this->usage.heap);
+}
+
 void NetworkNode::sendHeaders() {
 	this->httpServer->server->sendHeader(F("Access-Control-Allow-Origin"), F("*"));
 	this->httpServer->server->sendHeader(F("Access-Control-Allow-Headers"), F("Origin, X-Requested-With, Content-Type, Accept"));
 }
 
 void NetworkNode::httpResponse(JsonObject& responseObject) {
-	String response = "";
-	serializeJson(responseObject, response);
-	this->httpServer->server->sendHeader(F("Content-Length"), String(response.length()));
-	this->httpServer->server->send(200, F("text/plain"), response);
+	ESP8266WebServer* server = this->httpServer->server;
+	server->setContentLength(measureJson(responseObject));
+	server->send(200, F("text/plain"), "");
+	{
+		HTTPServer::Content content(server);
+		HTTPServer::Body body(content);
+		serializeJson(responseObject, body);
+	}
 	yield();
 }
 
+// {"data": base64(iv + AES-CBC(response))}, the same bytes httpResponse would send for it, without the Strings
+void NetworkNode::httpEncryptedResponse(JsonObject& responseObject) {
+	static const char head[] = "{\"data\":\"";
+	static const char tail[] = "\"}";
+	size_t plainLength = measureJson(responseObject);
+	unsigned int cipherLength = AESM::calculateCipherLength(plainLength);
+	uint8_t* buffer = (uint8_t*) scratch.allocate(cipherLength);
+	serializeJson(responseObject, (char*) buffer + N_BLOCK, plainLength + 1); // + 1, the writer terminates it
+	this->login->aesm->encryptInPlace(buffer, plainLength);
 
-
-
+	ESP8266WebServer* server = this->httpServer->server;
+	server->setContentLength(sizeof(head) - 1 + Base64::encode_length(cipherLength) + sizeof(tail) - 1);
+	server->send(200, F("text/plain"), "");
+	{
+		HTTPServer::Content content(server);
+		HTTPServer::Body body(content);
+		body.write((const uint8_t*) head, sizeof(head) - 1);
+		Base64::encode(buffer, cipherLength, body);
+		body.write((const uint8_t*) tail, sizeof(tail) - 1);
+		this->lowestHeap();
+	}
+	scratch.deallocate(buffer);
+	yield();
+}
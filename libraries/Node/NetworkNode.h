@@ -2,6 +2,7 @@
 #include <HTTPServer.h>
 #include <WebSocketsServer.h>
 #include <Login.h>
+#include <Packet.h>
 
 #ifndef __NetworkNode__
 #define __NetworkNode__
@@ -15,10 +16,53 @@ class NetworkNode : public Node {
 		int wsPort = 3498;
 	};
 
+	// encrypted state of every child node, what a dashboard needs when it connects
+	class Snapshot {
+		public:
+		uint32_t version = 0ul; // stateVersion it was built from
+		uint32_t time = 0ul;    // millis when it was built
+		uint16_t length = 0u;
+		String* messages = NULL;
+	};
+
+	// a connected dashboard, pinged at its own pace with what changed since its last ping
+	class Subscriber {
+		public:
+		bool connected = false;
+		bool binary = false;            // negotiated MessagePack mode, JSON until it asks for it
+		uint32_t iping = 15ul * 1000ul; // ping interval in milliseconds
+		uint64_t lping = 0ull;
+		uint32_t since = 0ul;           // sample tick of the last ping it got
+		uint16_t pings = 0u;
+	};
+
+	// what the last /u request cost: stack from the repainted stack of the loop, heap from the lowest free heap seen
+	class Usage {
+		public:
+		uint32_t stack = 0ul;
+		uint32_t heap = 0ul;
+		uint32_t before = 0ul; // free heap when the request came in
+		uint32_t lowest = 0ul;
+	};
+
+	// metrics in registration order
+	class Ping {
+		public:
+		enum { BCST, FBACK, COPIED, LAST, SENT, US, MAXUS, DEPTH, QUEUED, DROPS, KICKS, USTACK, UHEAP };
+	};
+
 	HTTPServer* httpServer = NULL;
 	WebSocketsServer* webSocketServer = NULL;
 	Login* login = NULL;
 	Settings settings;
+	Snapshot snapshot;
+	Usage usage;
+	uint32_t stateVersion = 1ul;
+	uint32_t isnap = 60ul * 1000ul; // rebuilt after this long even without a save, for the values nobody saves
+	Subscriber subscribers[WEBSOCKETS_SERVER_CLIENT_MAX];
+	uint32_t iping = 15ul * 1000ul; // ping interval of new subscribers
+	uint16_t ikey = 20u;            // every ikey-th ping of a subscriber is a full keyframe
+	uint32_t tick = 0ul;
 
 	NetworkNode(Node* parent, const char* name);
 	virtual ~NetworkNode();
@@ -29,25 +73,50 @@ class NetworkNode : public Node {
 	void session();
 	void user();
 	void onEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
+	void sendSnapshot(uint8_t num);
+	void buildSnapshot();
+	void clearSnapshot();
+	virtual void invalidate();
+	void pingSubscribers();
+	void subscribe(uint8_t num, uint8_t* payload, size_t length, bool binary);
+
+	virtual void measure();
 
 	void sendHeaders(); // -->>
 	void httpResponse(JsonObject& responseObject); // -->>
+	void httpEncryptedResponse(JsonObject& responseObject); // -->>
+	void lowestHeap();
 
 	virtual JsonObject rootIT(JsonObject& root) {
 		return root;
 	}
 
-	virtual void command(JsonObject& command) {
-		String commandSTR = "";
-		serializeJson(command, commandSTR);
-		DynamicJsonDocument responseDocument(1024);
-		JsonObject response = responseDocument.to<JsonObject>();
-		String edata = this->login->aesm->encrypt((byte*) commandSTR.c_str(), commandSTR.length());
-		response["data"] = edata;
-		String responseSTR = "";
-		serializeJson(response, responseSTR);
-		this->webSocketServer->broadcastTXT(responseSTR);
-		yield();
+	virtual void command(JsonObject& command);
+
+	// {"data": base64(iv + AES-CBC(command))}, assembled in scratch and copied once into the String
+	String message(JsonObject& command) {
+		static const char head[] = "{\"data\":\"";
+		static const char tail[] = "\"}";
+		size_t plainLength = measureJson(command);
+		unsigned int cipherLength = AESM::calculateCipherLength(plainLength);
+		unsigned int textLength = sizeof(head) - 1 + Base64::encode_length(cipherLength) + sizeof(tail) - 1;
+		uint8_t* buffer = (uint8_t*) scratch.allocate(cipherLength + textLength + 1);
+		serializeJson(command, (char*) buffer + N_BLOCK, plainLength + 1); // + 1, the writer terminates it
+		this->login->aesm->encryptInPlace(buffer, plainLength);
+
+		char* text = (char*) buffer + cipherLength;
+		unsigned int length = sizeof(head) - 1;
+		memcpy(text, head, length);
+		length += Base64::encode(buffer, cipherLength, (unsigned char*) text + length);
+		memcpy(text + length, tail, sizeof(tail)); // with its terminator
+		String messageSTR = text;
+		scratch.deallocate(buffer);
+		return messageSTR;
+	}
+
+	// binary mode, see Packet: the buffer goes as is to sendBIN and broadcastBIN, release it with scratch.deallocate
+	uint8_t* packet(JsonObject& command, size_t& length) {
+		return Packet::build(this->login->aesm, command, length);
 	}
 };
 
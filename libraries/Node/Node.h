@@ -1,8 +1,11 @@
 #include <DebugM.h>
 #include <Arduino.h>
 #define ARDUINOJSON_USE_DOUBLE 1
+#define ARDUINOJSON_FAST_FLOAT 1
 #include <ArduinoJson.h>
 #include <KeyValueMap.h>
+#include <Metrics.h>
+#include <Scratch.h>
 #include <functional>
 #include <FS.h>
 #include <sntp.h>
@@ -22,6 +25,7 @@ class Node {
 	String name = "";
 	KeyValueMap<Node>* nodes = NULL;
 	KeyValueMap<Method>* methods = NULL;
+	Metrics metrics;
 
 	Node(Node* parent, const char* name);
 	virtual ~Node();
@@ -42,15 +46,24 @@ class Node {
 	}
 
 	void saveFile() {
-		DynamicJsonDocument jsonDocument = DynamicJsonDocument(1024);
+		ScratchJsonDocument jsonDocument(SCRATCH_COMMAND);
 		JsonObject json = jsonDocument.to<JsonObject>();
 		this->JSON(json);
-		String jsonSTR = "";
-		serializeJson(jsonDocument, jsonSTR);
 		String filename = this->filename();
 		File file = SPIFFS.open(filename, "w");
-		file.println(jsonSTR);
+		BufferedWriter<File> writer(file);
+		serializeJson(jsonDocument, writer);
+		writer.write('\n'); // readFile reads one line
+		writer.flush();
 		file.close();
+		this->invalidate();
+	}
+
+	// saved settings changed the state, cached copies of it are stale
+	virtual void invalidate() {
+		if (NULL != this->parent) {
+			this->parent->invalidate();
+		}
 	}
 
 	void readFile() {
@@ -59,7 +72,7 @@ class Node {
 			File file = SPIFFS.open(filename, "r");
 			String jsonSTR = file.readStringUntil('\n');
 			file.close();
-			DynamicJsonDocument jsonDocument(1024); // TODO:: unharcode
+			ScratchJsonDocument jsonDocument(SCRATCH_COMMAND);
 			DeserializationError error = deserializeJson(jsonDocument, jsonSTR);
 
 			String log = filename + " : " + jsonSTR;
@@ -89,9 +102,6 @@ class Node {
 
 	// -->>
 	virtual void oncommand(JsonObject& params, JsonObject& response, JsonObject& broadcast) {
-		String paramsSTR = "";
-		serializeJson(params, paramsSTR);
-		// Serial1.println(paramsSTR);
 		for (JsonPair kv : params) {
 			const char* ckey = kv.key().c_str();
 			JsonObject iparams = kv.value().as<JsonObject>();
@@ -138,7 +148,7 @@ class Node {
 	}
 
 	virtual void log(String& text) {
-		DynamicJsonDocument rootDocument(512);
+		ScratchJsonDocument rootDocument(SCRATCH_LOG);
 		JsonObject command = rootDocument.to<JsonObject>();
 		JsonObject object = this->rootIT(command);
 		JsonObject log = object.createNestedObject("log");
@@ -151,17 +161,33 @@ class Node {
 		
 	}
 
-	virtual void ping(JsonObject& response) {
-		this->getPing(response);
+	// refreshes the metrics of the whole tree, tick numbers this round of samples
+	void sample(uint32_t tick) {
+		this->metrics.tick = tick;
+		this->measure();
 		for (uint16_t i = 0; i < this->nodes->length; i++) {
 			KeyValue<Node>* keyValue = this->nodes->keyValues[i];
 			Node* node = keyValue->value;
-			node->ping(response);
+			node->sample(tick);
 		}
 	}
 
-	virtual void getPing(JsonObject& response) {
+	virtual void measure() {
+
+	}
 
+	// only the metrics changed after the tick "since", all of them when since is 0
+	virtual void ping(JsonObject& response, uint32_t since) {
+		if (this->metrics.since(since)) {
+			JsonObject object = this->rootIT(response);
+			JsonObject mparams = object.createNestedObject("state");
+			this->metrics.write(mparams, since);
+		}
+		for (uint16_t i = 0; i < this->nodes->length; i++) {
+			KeyValue<Node>* keyValue = this->nodes->keyValues[i];
+			Node* node = keyValue->value;
+			node->ping(response, since);
+		}
 	}
 };
 
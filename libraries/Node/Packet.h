@@ -0,0 +1,37 @@
+/**
+ * Binary mode of the WebSocket control messages: iv + AES-CBC(MessagePack) of a JsonObject in a binary frame.
+ * The message is built after WEBSOCKETS_MAX_HEADER_SIZE free bytes where the WebSocket server writes the
+ * frame header without copying it: sendBIN and broadcastBIN take the buffer, not the message.
+ */
+
+#include <Scratch.h>
+#include <AESM.h>
+#include <WebSocketsServer.h>
+
+#ifndef __Packet__
+#define __Packet__
+
+class Packet {
+	public:
+
+	// the buffer, from the scratch arena, release it with scratch.deallocate; length is the one of the message
+	static uint8_t* build(AESM* aesm, JsonObject& command, size_t& length) {
+		size_t plainLength = measureMsgPack(command);
+		length = AESM::calculateCipherLength(plainLength);
+		uint8_t* buffer = (uint8_t*) scratch.allocate(WEBSOCKETS_MAX_HEADER_SIZE + length);
+		uint8_t* message = buffer + WEBSOCKETS_MAX_HEADER_SIZE;
+		serializeMsgPack(command, (char*) message + N_BLOCK, plainLength + 1); // + 1, the writer terminates it
+		aesm->encryptInPlace(message, plainLength);
+		return buffer;
+	}
+
+	static bool send(WebSocketsServer* server, uint8_t num, uint8_t* buffer, size_t length) {
+		return server->sendBIN(num, buffer, length, true);
+	}
+
+	static bool broadcast(WebSocketsServer* server, uint8_t* buffer, size_t length) {
+		return server->broadcastBIN(buffer, length, true);
+	}
+};
+
+#endif
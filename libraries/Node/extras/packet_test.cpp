@@ -0,0 +1,149 @@
+/*
+ Host test of the binary control messages of NetworkNode (Packet) through the WebSocket server, on the
+ Arduino core and in-memory sockets of arduinoWebSockets-master/extras/host
+
+   ping       Packet::send of a ping to one dashboard
+   command    Packet::broadcast of a log line to two dashboards
+
+ On the wire each gets a binary frame, header + iv + ciphertext, the message Packet::build left after its
+ WEBSOCKETS_MAX_HEADER_SIZE free bytes, that decrypts back to the object. Returns 1 on the first failure.
+*/
+#include <Packet.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+#define CHECK(condition, ...) if (!(condition)) { printf("FAIL " __VA_ARGS__); printf("\n"); return 1; }
+
+static byte key[32] = {
+	0xd8, 0x24, 0x94, 0xf0, 0x5d, 0x69, 0x17, 0xba, 0x02, 0xf7, 0xaa, 0xa2, 0x96, 0x89, 0xcc, 0xb4,
+	0x44, 0xbb, 0x73, 0xf2, 0x03, 0x80, 0x87, 0x6c, 0xb0, 0x5d, 0x1f, 0x37, 0x53, 0x7b, 0x78, 0x92};
+
+static const char* REQUEST =
+	"GET /ws HTTP/1.1\r\n"
+	"Host: gateway\r\n"
+	"Upgrade: websocket\r\n"
+	"Connection: Upgrade\r\n"
+	"Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+	"Sec-WebSocket-Version: 13\r\n"
+	"\r\n";
+
+class Server : public WebSocketsServer {
+	public:
+	Server() : WebSocketsServer(81) { this->begin(); }
+
+	// a dashboard through the handshake and the ping after it, its socket is left at the next frame
+	bool open(const std::shared_ptr<Socket>& socket) {
+		this->_server->pending.push_back(socket);
+		socket->rx += REQUEST;
+		for (int i = 0; i < 16; i++) {
+			this->loop();
+		}
+		size_t end = socket->tx.find("\r\n\r\n");
+		if (std::string::npos == end || socket->tx.size() != end + 6u) {
+			return false;
+		}
+		socket->tx.clear();
+		return true;
+	}
+};
+
+// the binary frame the dashboard received: header and payload, false if it is not exactly one
+static bool frame(const std::shared_ptr<Socket>& socket, std::string* header, std::string* payload) {
+	const std::string& stream = socket->tx;
+	if (stream.size() < 2u || 0x82 != (uint8_t) stream[0] || (stream[1] & 0x80)) {
+		return false;
+	}
+	size_t size = 2u;
+	size_t length = stream[1] & 0x7F;
+	if (126u == length) {
+		size = 4u;
+		length = stream.size() < 4u ? 0u : ((uint8_t) stream[2] << 8) | (uint8_t) stream[3];
+	}
+	if (stream.size() != size + length) {
+		return false;
+	}
+	header->assign(stream, 0u, size);
+	payload->assign(stream, size, length);
+	socket->tx.clear();
+	return true;
+}
+
+// the message decrypted and unpacked, back to JSON
+static std::string open(AESM& aesm, const std::string& payload) {
+	uint8_t buffer[512];
+	memcpy(buffer, payload.data(), payload.size());
+	unsigned int plainLength = aesm.decryptInPlace(buffer, payload.size());
+	DynamicJsonDocument document(1024);
+	std::string json;
+	if (0u < plainLength && DeserializationError::Ok == deserializeMsgPack(document, buffer + N_BLOCK, plainLength)) {
+		serializeJson(document, json);
+	}
+	return json;
+}
+
+static int ping(AESM& aesm) {
+	Server server;
+	std::shared_ptr<Socket> dashboard = std::make_shared<Socket>();
+	CHECK(server.open(dashboard), "open");
+
+	DynamicJsonDocument document(1024);
+	JsonObject object = document.to<JsonObject>();
+	object["system"]["esps"]["state"]["heap"] = 21104;
+	object["wan"]["state"]["stats"]["rxnb"] = 1236;
+	std::string json;
+	serializeJson(object, json);
+
+	size_t length = 0u;
+	uint8_t* buffer = Packet::build(&aesm, object, length);
+	std::string message((const char*) buffer + WEBSOCKETS_MAX_HEADER_SIZE, length);
+	CHECK(Packet::send(&server, 0u, buffer, length), "send");
+	scratch.deallocate(buffer);
+	CHECK(0u == scratch.live, "%u documents left in the arena", scratch.live);
+
+	std::string header;
+	std::string payload;
+	CHECK(frame(dashboard, &header, &payload), "one binary frame of %u bytes", (unsigned) dashboard->tx.size());
+	CHECK(length < 126u && 2u == header.size() && length == (uint8_t) header[1], "header of %u bytes for %u", (unsigned) header.size(), (unsigned) length);
+	CHECK(message == payload, "iv + ciphertext of %u bytes", (unsigned) length);
+	CHECK(json == open(aesm, payload), "decrypted %s", open(aesm, payload).c_str());
+	printf("ping      ok, %u bytes: header 2 + iv 16 + ciphertext %u\n", (unsigned) (2u + length), (unsigned) (length - N_BLOCK));
+	return 0;
+}
+
+static int command(AESM& aesm) {
+	Server server;
+	std::shared_ptr<Socket> dashboards[2] = {std::make_shared<Socket>(), std::make_shared<Socket>()};
+	CHECK(server.open(dashboards[0]) && server.open(dashboards[1]), "open");
+
+	DynamicJsonDocument document(1024);
+	JsonObject object = document.to<JsonObject>();
+	object["wan"]["log"]["text"] = "RX 868.100 MHz SF7BW125 4/5 RSSI -87 dBm SNR 7.5 dB 23 bytes, forwarded to 3 servers";
+	object["wan"]["log"]["tstm"] = 1700000000ul;
+	std::string json;
+	serializeJson(object, json);
+
+	size_t length = 0u;
+	uint8_t* buffer = Packet::build(&aesm, object, length);
+	std::string message((const char*) buffer + WEBSOCKETS_MAX_HEADER_SIZE, length);
+	CHECK(Packet::broadcast(&server, buffer, length), "broadcast");
+	scratch.deallocate(buffer);
+
+	for (int i = 0; i < 2; i++) {
+		std::string header;
+		std::string payload;
+		CHECK(frame(dashboards[i], &header, &payload), "one binary frame to %d", i);
+		CHECK(length >= 126u && 4u == header.size() && length == (((uint8_t) header[2] << 8) | (uint8_t) header[3]),
+			"header of %u bytes for %u", (unsigned) header.size(), (unsigned) length);
+		CHECK(message == payload, "iv + ciphertext of %u bytes to %d", (unsigned) length, i);
+		CHECK(json == open(aesm, payload), "decrypted %s", open(aesm, payload).c_str());
+	}
+	printf("command   ok, %u bytes to 2 dashboards: header 4 + iv 16 + ciphertext %u\n", (unsigned) (4u + length), (unsigned) (length - N_BLOCK));
+	return 0;
+}
+
+int main() {
+	AESM aesm(key);
+	return ping(aesm) || command(aesm);
+}
@@ -0,0 +1,140 @@
+/*
+ Size and CPU comparison of the two encodings of the WebSocket control messages:
+
+   json    NetworkNode::message, serializeJson -> AES-CBC -> Base64 -> {"data": "..."} -> serializeJson
+   binary  NetworkNode::packet, serializeMsgPack -> AES-CBC in place, sent as a binary frame
+
+ for the messages a dashboard receives: ping keyframe, ping delta, log line and WAN state.
+ Both pipelines round trip every message once before being timed.
+*/
+#define ARDUINOJSON_USE_DOUBLE 1
+#include <ArduinoJson.h>
+#include <AES32.h>
+#include <Base64M.h>
+#include <string>
+#include <time.h>
+
+static byte key[32] = {
+	0xd8, 0x24, 0x94, 0xf0, 0x5d, 0x69, 0x17, 0xba, 0x02, 0xf7, 0xaa, 0xa2, 0x96, 0x89, 0xcc, 0xb4,
+	0x44, 0xbb, 0x73, 0xf2, 0x03, 0x80, 0x87, 0x6c, 0xb0, 0x5d, 0x1f, 0x37, 0x53, 0x7b, 0x78, 0x92};
+
+static const char* MESSAGES[][2] = {
+	{"ping keyframe", "{\"state\":{\"ws\":{\"bcst\":1532,\"fback\":0,\"copied\":418230,\"last\":304,\"sent\":912,\"us\":212,\"maxus\":4210,\"depth\":0,\"queued\":0,\"drops\":0,\"kicks\":0}},"
+		"\"system\":{\"ntp\":{\"state\":{\"now\":1700000000}},\"esps\":{\"state\":{\"heap\":21344,\"heapf\":12,\"scratch\":{\"size\":4096,\"peak\":3120,\"allocs\":98211,\"ovf\":0,\"leaks\":0}}}},"
+		"\"wifi\":{\"client\":{\"state\":{\"status\":3,\"ssid\":\"gateway-net\",\"cssid\":\"gateway-net\",\"ss\":-67}}},"
+		"\"wan\":{\"state\":{\"now\":86400000,\"ack\":86391000,\"stats\":{\"rxnb\":1234,\"rxok\":1200,\"rxfw\":1200,\"ackr\":100.0,\"dwnb\":18,\"txnb\":18}}}}"},
+	{"ping delta", "{\"system\":{\"esps\":{\"state\":{\"heap\":21104,\"heapf\":14}}},\"wan\":{\"state\":{\"stats\":{\"rxnb\":1236,\"rxok\":1202,\"rxfw\":1202}}}}"},
+	{"log", "{\"wan\":{\"log\":{\"text\":\"RX 868.100 MHz SF7BW125 4/5 RSSI -87 dBm SNR 7.5 dB 23 bytes\",\"tstm\":1700000000}}}"},
+	{"state", "{\"wan\":{\"state\":{\"id\":\"A4CF12FFFF3B4C5D\",\"host\":\"router.eu.thethings.network\",\"port\":1700,\"desc\":\"rooftop gateway\","
+		"\"mail\":\"admin@example.com\",\"platform\":\"ESP8266 SX1276\",\"lon\":4.8951,\"lat\":52.3702,\"alt\":12,\"istat\":180000,\"ipull\":57000}}}"}
+};
+
+#define ROUNDS 20000
+
+static double now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void iv(byte* out) {
+	for (int i = 0; i < N_BLOCK; i++) out[i] = rand() & 0xFF;
+}
+
+// AESM::encrypt + AESM::decrypt on a String, without the Arduino runtime
+static std::string json(AES32& aes, JsonDocument& command) {
+	std::string commandSTR;
+	serializeJson(command, commandSTR);
+	unsigned int plainLength = commandSTR.length();
+	unsigned int padedLength = plainLength + N_BLOCK - plainLength % N_BLOCK;
+	unsigned int length = N_BLOCK + padedLength;
+	byte cipher[length];
+	byte v[N_BLOCK];
+	iv(v);
+	memcpy(cipher, v, N_BLOCK);
+	memcpy(cipher + N_BLOCK, commandSTR.data(), plainLength);
+	memset(cipher + N_BLOCK + plainLength, padedLength - plainLength, padedLength - plainLength);
+	aes.cbc_encrypt(cipher + N_BLOCK, cipher + N_BLOCK, padedLength / N_BLOCK, v);
+	unsigned char base64[Base64::encode_length(length) + 1];
+	Base64::encode(cipher, length, base64);
+
+	DynamicJsonDocument responseDocument(1024);
+	responseDocument["data"] = (const char*) base64;
+	std::string responseSTR;
+	serializeJson(responseDocument, responseSTR);
+	return responseSTR;
+}
+
+static bool unjson(AES32& aes, std::string& message, JsonDocument& command) {
+	DynamicJsonDocument responseDocument(1024);
+	if (deserializeJson(responseDocument, message)) return false;
+	const char* edata = responseDocument["data"];
+	unsigned int length = strlen(edata);
+	unsigned char binary[Base64::decode_length((const unsigned char*) edata, length)];
+	int size = Base64::decode((const unsigned char*) edata, length, binary, sizeof(binary));
+	if (size < 2 * N_BLOCK) return false;
+	aes.cbc_decrypt(binary + N_BLOCK, binary + N_BLOCK, (size - N_BLOCK) / N_BLOCK, binary);
+	return !deserializeJson(command, (const char*) binary + N_BLOCK, size - N_BLOCK - binary[size - 1]);
+}
+
+// NetworkNode::packet, the frame header room in front is left out
+static size_t binary(AES32& aes, JsonDocument& command, byte* buffer) {
+	size_t plainLength = measureMsgPack(command);
+	size_t padedLength = plainLength + N_BLOCK - plainLength % N_BLOCK;
+	serializeMsgPack(command, (char*) buffer + N_BLOCK, plainLength + 1);
+	memset(buffer + N_BLOCK + plainLength, padedLength - plainLength, padedLength - plainLength);
+	byte v[N_BLOCK];
+	iv(v);
+	memcpy(buffer, v, N_BLOCK);
+	aes.cbc_encrypt(buffer + N_BLOCK, buffer + N_BLOCK, padedLength / N_BLOCK, v);
+	return N_BLOCK + padedLength;
+}
+
+static bool unbinary(AES32& aes, byte* buffer, size_t length, JsonDocument& command) {
+	byte v[N_BLOCK];
+	memcpy(v, buffer, N_BLOCK);
+	aes.cbc_decrypt(buffer + N_BLOCK, buffer + N_BLOCK, (length - N_BLOCK) / N_BLOCK, v);
+	return !deserializeMsgPack(command, (const char*) buffer + N_BLOCK, length - N_BLOCK - buffer[length - 1]);
+}
+
+int main() {
+	AES32 aes;
+	aes.set_key(key, 256);
+	int failures = 0;
+
+	printf("%-14s %8s %8s %8s %6s %10s %10s\n", "message", "plain", "json", "binary", "saved", "json us", "binary us");
+	for (unsigned int m = 0; m < sizeof(MESSAGES) / sizeof(MESSAGES[0]); m++) {
+		DynamicJsonDocument command(2048);
+		deserializeJson(command, MESSAGES[m][1]);
+		std::string plain;
+		serializeJson(command, plain);
+
+		std::string message = json(aes, command);
+		byte buffer[2048];
+		size_t length = binary(aes, command, buffer);
+
+		DynamicJsonDocument back(2048);
+		std::string backSTR;
+		if (!unjson(aes, message, back)) failures++;
+		serializeJson(back, backSTR);
+		if (backSTR != plain) failures++;
+		if (!unbinary(aes, buffer, length, back)) failures++;
+		backSTR = "";
+		serializeJson(back, backSTR);
+		if (backSTR != plain) failures++;
+
+		size_t sink = 0;
+		double start = now();
+		for (int i = 0; i < ROUNDS; i++) sink += json(aes, command).length();
+		double jsonTime = (now() - start) / ROUNDS;
+		start = now();
+		for (int i = 0; i < ROUNDS; i++) sink += binary(aes, command, buffer);
+		double binaryTime = (now() - start) / ROUNDS;
+		if (0 == sink) failures++;
+
+		printf("%-14s %8zu %8zu %8zu %5.0f%% %10.2f %10.2f\n", MESSAGES[m][0], plain.length(), message.length(), length,
+			100.0 * (1.0 - (double) length / message.length()), 1e6 * jsonTime, 1e6 * binaryTime);
+	}
+	printf(failures ? "round trip FAILED\n" : "round trip OK\n");
+	return failures ? 1 : 0;
+}
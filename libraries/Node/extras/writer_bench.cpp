@@ -0,0 +1,106 @@
+/*
+ write() calls reaching the sink and memory used to serialize the gateway documents, three ways:
+
+   string    serializeJson into an Arduino String, then one write of it (what WAN::send, httpResponse,
+             saveFile and message did). The String grows to the exact size on every write of the
+             serializer, peak counts the old and the new buffer of the largest realloc.
+   print     serializeJson straight into the sink, every token of the serializer is a write()
+   buffered  serializeJson into a BufferedWriter<sink, 64>, the buffer lives on the stack
+*/
+#define ARDUINOJSON_USE_DOUBLE 1
+#include <ArduinoJson.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char* DOCUMENTS[][2] = {
+	{"rxpk", "{\"rxpk\":[{\"time\":\"2019-06-21T09:12:43.000000Z\",\"tmst\":3512348514,\"chan\":0,\"rfch\":0,\"freq\":868.1,"
+		"\"stat\":1,\"modu\":\"LORA\",\"datr\":\"SF7BW125\",\"codr\":\"4/5\",\"lsnr\":7.5,\"rssi\":-87,\"size\":23,"
+		"\"data\":\"QK0oASaAAQAB2W6Kb2M+RzZ6pPWRbK0=\"}]}"},
+	{"stat", "{\"stat\":{\"time\":\"2019-06-21 09:12:43 GMT\",\"lati\":52.3702,\"long\":4.8951,\"alti\":12,\"rxnb\":1234,"
+		"\"rxok\":1200,\"rxfw\":1200,\"ackr\":100.0,\"dwnb\":18,\"txnb\":18,\"pfrm\":\"ESP8266\",\"mail\":\"admin@example.com\","
+		"\"desc\":\"rooftop gateway\"}}"},
+	{"http state", "{\"wan\":{\"state\":{\"id\":\"A4CF12FFFF3B4C5D\",\"host\":\"router.eu.thethings.network\",\"port\":1700,"
+		"\"desc\":\"rooftop gateway\",\"mail\":\"admin@example.com\",\"platform\":\"ESP8266 SX1276\",\"lon\":4.8951,"
+		"\"lat\":52.3702,\"alt\":12,\"istat\":180000,\"ipull\":57000}},\"rfm\":{\"state\":{\"freq\":{\"curr\":868100000,"
+		"\"min\":863000000,\"max\":870000000},\"sfac\":7,\"sbw\":125000,\"crat\":5,\"txpw\":14,\"plength\":8,\"sw\":52}}}"},
+	{"settings file", "{\"id\":\"A4CF12FFFF3B4C5D\",\"host\":\"router.eu.thethings.network\",\"port\":1700,\"desc\":\"rooftop gateway\","
+		"\"mail\":\"admin@example.com\",\"platform\":\"ESP8266 SX1276\",\"lon\":4.8951,\"lat\":52.3702,\"alt\":12}"}
+};
+
+// WiFiUDP, WiFiClient, File: only counts
+class Sink {
+	public:
+	size_t calls = 0;
+	size_t bytes = 0;
+
+	size_t write(uint8_t) {
+		calls++;
+		bytes++;
+		return 1;
+	}
+
+	size_t write(const uint8_t*, size_t n) {
+		calls++;
+		bytes += n;
+		return n;
+	}
+};
+
+// the ESP8266 String behind DynamicStringWriter<String>: reserve() reallocates to the exact size
+class ArduinoString {
+	public:
+	size_t length = 0;
+	size_t capacity = 0;
+	size_t reallocs = 0;
+	size_t peak = 0;
+
+	void reserve(size_t size) {
+		if (size <= capacity) return;
+		if (peak < capacity + 1 + size + 1) peak = capacity + 1 + size + 1;
+		capacity = size;
+		reallocs++;
+	}
+
+	size_t write(uint8_t) {
+		reserve(length + 1);
+		length++;
+		return 1;
+	}
+
+	size_t write(const uint8_t*, size_t n) {
+		reserve(length + n);
+		length += n;
+		return n;
+	}
+};
+
+int main() {
+	printf("%-14s %6s | %8s %6s %6s | %6s | %6s %6s\n", "document", "bytes", "reallocs", "peak", "writes", "writes", "writes", "stack");
+	printf("%-14s %6s | %22s | %6s | %13s\n", "", "", "string", "print", "buffered");
+	for (unsigned int d = 0; d < sizeof(DOCUMENTS) / sizeof(DOCUMENTS[0]); d++) {
+		DynamicJsonDocument doc(2048);
+		deserializeJson(doc, DOCUMENTS[d][1]);
+
+		ArduinoString string;
+		ARDUINOJSON_NAMESPACE::doSerialize<ARDUINOJSON_NAMESPACE::JsonSerializer>(doc, string);
+		Sink stringSink;
+		stringSink.write((const uint8_t*) NULL, string.length);
+
+		Sink printSink;
+		ARDUINOJSON_NAMESPACE::doSerialize<ARDUINOJSON_NAMESPACE::JsonSerializer>(doc, printSink);
+
+		Sink bufferedSink;
+		{
+			BufferedWriter<Sink> writer(bufferedSink);
+			serializeJson(doc, writer);
+		}
+
+		if (string.length != printSink.bytes || string.length != bufferedSink.bytes) {
+			printf("%s: length mismatch\n", DOCUMENTS[d][0]);
+			return 1;
+		}
+		printf("%-14s %6zu | %8zu %6zu %6zu | %6zu | %6zu %6d\n", DOCUMENTS[d][0], string.length, string.reallocs, string.peak,
+			stringSink.calls, printSink.calls, bufferedSink.calls, ARDUINOJSON_WRITER_BUFFER_SIZE);
+	}
+	return 0;
+}
@@ -0,0 +1,159 @@
+#include <FrameView.h>
+
+static uint32_t little(const uint8_t* p, uint8_t length) {
+	uint32_t value = 0ul;
+	for (uint8_t i = length; i > 0u; i--) {
+		value = (value << 8) | p[i - 1u];
+	}
+	return value;
+}
+
+static uint64_t eui(const uint8_t* p) {
+	return ((uint64_t) little(p + 4, 4u) << 32) | little(p, 4u);
+}
+
+FrameView::FrameView(const uint8_t* buffer, uint16_t size) : buffer(buffer), size(size) {
+	if (NULL == buffer || 0u == size) {
+		return;
+	}
+	this->mtype = (MType) (buffer[0] >> 5);
+	if (0u != (buffer[0] & 0x03u)) { // Major: LoRaWAN R1 only
+		return;
+	}
+
+	switch (this->mtype) {
+		case UNCONFIRMED_UP:
+		case UNCONFIRMED_DOWN:
+		case CONFIRMED_UP:
+		case CONFIRMED_DOWN: {
+			// MHDR | DevAddr | FCtrl | FCnt | FOpts | MIC
+			if (size < 8u + FRAME_MIC) {
+				return;
+			}
+			uint16_t header = 8u + (buffer[5] & 0x0Fu);
+			if (size < header + FRAME_MIC) {
+				return;
+			}
+			this->devAddr = little(buffer + 1, 4u);
+			this->fctrl = buffer[5];
+			this->fcnt = (uint16_t) little(buffer + 6, 2u);
+			if (header + FRAME_MIC < size) {
+				this->fport = buffer[header];
+				this->payloadLength = (uint16_t) (size - header - 1u - FRAME_MIC);
+			}
+			this->valid = true;
+		} break;
+		case JOIN_REQUEST: {
+			if (23u != size) {
+				return;
+			}
+			this->joinEui = eui(buffer + 1);
+			this->devEui = eui(buffer + 9);
+			this->devNonce = (uint16_t) little(buffer + 17, 2u);
+			this->valid = true;
+		} break;
+		case JOIN_ACCEPT: {
+			this->valid = 17u == size || 33u == size;
+		} break;
+		case REJOIN_REQUEST: {
+			this->valid = 19u == size || 24u == size;
+		} break;
+		default: {
+			this->valid = FRAME_MIC < size;
+		} break;
+	}
+}
+
+bool FrameView::data() const {
+	return this->valid && UNCONFIRMED_UP <= this->mtype && this->mtype <= CONFIRMED_DOWN;
+}
+
+bool FrameView::join() const {
+	return this->valid && JOIN_REQUEST == this->mtype;
+}
+
+bool FrameView::uplink() const {
+	switch (this->mtype) {
+		case JOIN_REQUEST:
+		case UNCONFIRMED_UP:
+		case CONFIRMED_UP:
+		case REJOIN_REQUEST:
+			return true;
+		default:
+			return false;
+	}
+}
+
+uint8_t FrameView::foptsLength() const {
+	return this->data() ? (uint8_t) (this->fctrl & 0x0Fu) : 0u;
+}
+
+const uint8_t* FrameView::fopts() const {
+	return this->data() ? this->buffer + 8 : NULL;
+}
+
+const uint8_t* FrameView::payload() const {
+	return this->data() && 0 <= this->fport ? this->buffer + 9 + this->foptsLength() : NULL;
+}
+
+uint8_t FrameView::nwkId() const {
+	return (uint8_t) (this->devAddr >> 25);
+}
+
+const char* FrameView::name(MType mtype) {
+	static const char* const NAMES[] = {
+		"JoinRequest", "JoinAccept", "UnconfirmedDataUp", "UnconfirmedDataDown",
+		"ConfirmedDataUp", "ConfirmedDataDown", "RejoinRequest", "Proprietary"
+	};
+	return NAMES[mtype & 0x07u];
+}
+
+static char* text(char* p, const char* value) {
+	while (*value) {
+		*p++ = *value++;
+	}
+	return p;
+}
+
+static char* hex(char* p, uint64_t value, uint8_t digits) {
+	for (uint8_t i = digits; i > 0u; i--) {
+		p[i - 1u] = "0123456789ABCDEF"[value & 0x0Fu];
+		value >>= 4;
+	}
+	return p + digits;
+}
+
+static char* decimal(char* p, uint32_t value) {
+	char digits[10];
+	uint8_t length = 0u;
+	do {
+		digits[length++] = (char) ('0' + value % 10u);
+		value /= 10u;
+	} while (value);
+	while (length) {
+		*p++ = digits[--length];
+	}
+	return p;
+}
+
+uint8_t FrameView::print(char* buffer) const {
+	char* p = buffer;
+	if (!this->valid) {
+		p = text(p, "Invalid");
+	} else {
+		p = text(p, FrameView::name(this->mtype));
+		if (this->data()) {
+			p = hex(text(p, " dev:"), this->devAddr, 8u);
+			p = decimal(text(p, " fcnt:"), this->fcnt);
+			if (0 <= this->fport) {
+				p = decimal(text(p, " port:"), (uint32_t) this->fport);
+			}
+		} else if (this->join()) {
+			p = hex(text(p, " joineui:"), this->joinEui, 16u);
+			p = hex(text(p, " deveui:"), this->devEui, 16u);
+		}
+	}
+	p = decimal(text(p, " size:"), this->size);
+	*p = '\0';
+	return (uint8_t) (p - buffer);
+}
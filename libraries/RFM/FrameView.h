@@ -0,0 +1,70 @@
+/**
+ * LoRaWAN MAC header of a PHYPayload, decoded in place: the view keeps a pointer to the buffer of the
+ * packet, nothing is copied or allocated. RFM::read decodes a received packet once and every consumer
+ * (logs, WAN filters and statistics) reads the same view.
+ *
+ *   PHYPayload   MHDR | MACPayload | MIC (4)
+ *   data         DevAddr (4) | FCtrl | FCnt (2) | FOpts (0..15) | [FPort | FRMPayload]
+ *   JoinRequest  JoinEUI (8) | DevEUI (8) | DevNonce (2)
+ *
+ * All fields are little endian, the encrypted JoinAccept and FRMPayload are left as they are.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef __FrameView__
+#define __FrameView__
+
+#define FRAME_MIC 4u
+#define FRAME_TEXT_LENGTH 72 // the JoinRequest line and the trailing 0
+
+class FrameView {
+	public:
+	enum MType : uint8_t {
+		JOIN_REQUEST, JOIN_ACCEPT, UNCONFIRMED_UP, UNCONFIRMED_DOWN,
+		CONFIRMED_UP, CONFIRMED_DOWN, REJOIN_REQUEST, PROPRIETARY
+	};
+
+	const uint8_t* buffer = NULL;
+	uint16_t size = 0u;
+	bool valid = false; // LoRaWAN R1 and long enough for its message type
+	MType mtype = PROPRIETARY;
+
+	// data frames
+	uint32_t devAddr = 0ul;
+	uint8_t fctrl = 0u;
+	uint16_t fcnt = 0u;
+	int16_t fport = -1; // -1 without FPort
+	uint16_t payloadLength = 0u; // FRMPayload bytes
+
+	// JoinRequest
+	uint64_t joinEui = 0ull;
+	uint64_t devEui = 0ull;
+	uint16_t devNonce = 0u;
+
+	FrameView(const uint8_t* buffer, uint16_t size);
+
+	bool data() const; // valid data frame, devAddr, fctrl, fcnt and fport are set
+	bool join() const; // valid JoinRequest, joinEui, devEui and devNonce are set
+	bool uplink() const;
+	uint8_t foptsLength() const;
+	const uint8_t* fopts() const;
+	const uint8_t* payload() const; // FRMPayload, NULL without FPort
+	uint8_t nwkId() const; // 7 most significant bits of DevAddr, the NetID of type 0 and 1 networks
+
+	/* print:
+	 *   Description:
+	 *     One line for the logs: "UnconfirmedDataUp dev:26011BDA fcnt:12 port:1 size:23",
+	 *     "JoinRequest joineui:70B3D57ED0000000 deveui:0004A30B001C0530 size:23" or "Proprietary size:12"
+	 *   Parameters:
+	 *     buffer - FRAME_TEXT_LENGTH bytes, null terminated
+	 *   Returns:
+	 *     Number of characters written, not including the null terminator
+	 */
+	uint8_t print(char* buffer) const;
+
+	static const char* name(MType mtype);
+};
+
+#endif
@@ -64,11 +64,11 @@ void RFM::apply(RFM::Settings* settings) {
 	yield();
 }
 
-int RFM::send(Data::Packet* packet) {
+int RFM::send(Data::Packet* packet, int ih) {
 	int sent = 0;
 	if (this->active) {
 		// TODO:: make more checks against transmission
-		sent = LoRa.beginPacket();
+		sent = LoRa.beginPacket(ih);
 		if (sent) {
 			LoRa.write(packet->buffer, packet->size);
 			yield();
@@ -76,13 +76,10 @@ int RFM::send(Data::Packet* packet) {
 			// if the RFM is not working properly, here it locks
 			sent = LoRa.endPacket();
 			if (sent) {
+				char frame[FRAME_TEXT_LENGTH];
+				FrameView(packet->buffer, packet->size).print(frame);
 				String logMessage = "TX: freq:" + String(this->settings.freq.curr);	
-				logMessage += ", sf:" + String(this->settings.sfac) + ", rssi:" + String(LoRa.packetRssi()) + ", dev:";
-				logMessage += ((packet->buffer[4] < 0x10) ? "0" : "") + String(packet->buffer[4], HEX);
-				logMessage += ((packet->buffer[3] < 0x10) ? "0" : "") + String(packet->buffer[3], HEX);
-				logMessage += ((packet->buffer[2] < 0x10) ? "0" : "") + String(packet->buffer[2], HEX);
-				logMessage += ((packet->buffer[1] < 0x10) ? "0" : "") + String(packet->buffer[1], HEX);
-				logMessage += ", len:" + String(packet->size);
+				logMessage += ", sf:" + String(this->settings.sfac) + ", rssi:" + String(LoRa.packetRssi()) + ", " + frame;
 				this->log(logMessage);
 			} else {
 				String logMessage = "ERROR: RFM failed to transmit " + String(packet->size) + " bytes !";
@@ -108,18 +105,15 @@ void RFM::read(RFM::Handler* handler) {
 			packet->buffer[i++] = LoRa.read();
 			available = LoRa.available();
 		}
-		handler->onRFMPacket(packet);
-
+		// decoded once, the log and the handler share it
+		FrameView frame(packet->buffer, packet->size);
+		char text[FRAME_TEXT_LENGTH];
+		frame.print(text);
 		String logMessage = "RX: freq:" + String(this->settings.freq.curr);	
-		logMessage += ", sf:" + String(this->settings.sfac) + ", rssi:" + String(LoRa.packetRssi()) + ", dev:";
-		logMessage += ((packet->buffer[4] < 0x10) ? "0" : "") + String(packet->buffer[4], HEX);
-		logMessage += ((packet->buffer[3] < 0x10) ? "0" : "") + String(packet->buffer[3], HEX);
-		logMessage += ((packet->buffer[2] < 0x10) ? "0" : "") + String(packet->buffer[2], HEX);
-		logMessage += ((packet->buffer[1] < 0x10) ? "0" : "") + String(packet->buffer[1], HEX);
-		logMessage += ", len:" + String(packet->size);
+		logMessage += ", sf:" + String(this->settings.sfac) + ", rssi:" + String(LoRa.packetRssi()) + ", " + text;
 		this->log(logMessage);
 
-		delete packet;
+		handler->onRFMPacket(packet, frame); // owns the packet from here
 	}
 }
 
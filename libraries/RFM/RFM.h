@@ -1,21 +1,26 @@
 #include <DebugM.h>
 
 #define ARDUINOJSON_USE_DOUBLE 1
+#define ARDUINOJSON_FAST_FLOAT 1
 #include <ArduinoJson.h>
 #include <Node.h>
 #include <SPI.h>
 #include <LoRa.h>
+#include <FrameView.h>
 #include <System.h>
 
 #ifndef __RFM__
 #define __RFM__
 
+#define RFM_TXPW_MIN 2  // dBm, PA_BOOST
+#define RFM_TXPW_MAX 20 // dBm
+
 class RFM : public Node {
 	public:
 
 	class Handler {
 		public:
-		virtual void onRFMPacket(Data::Packet* packet) = 0;
+		virtual void onRFMPacket(Data::Packet* packet, const FrameView& frame) = 0; // deletes the packet, now or later
 	};
 
 	class Pins {
@@ -49,6 +54,7 @@ class RFM : public Node {
 		int cad      = 0;
 		int crc      = 1;
 		int iiq      = 0;     // InvertIQ
+		int ih       = 0;     // implicit header, beacons
 	};
 
 	RFM::Settings settings;
@@ -60,7 +66,7 @@ class RFM : public Node {
 	void setup();
 	void loop();
 	void apply(RFM::Settings* settings);
-	int send(Data::Packet* packet);
+	int send(Data::Packet* packet, int ih = 0); // ih: implicit header, the next parsePacket goes back to explicit
 	void read(RFM::Handler* handler);
 	virtual void getState(JsonObject& state);
 	virtual void fromJSON(JsonObject& params);
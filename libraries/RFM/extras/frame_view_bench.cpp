@@ -0,0 +1,75 @@
+/*
+ CPU time and heap allocations of the RX/TX log lines, two ways:
+
+   string     what RFM::read and RFM::send did: four String(byte, HEX) and their "0" padding
+              concatenated into the log message. std::string stands for the Arduino String, its
+              small string optimization hides the allocations of the short temporaries, the ESP8266
+              String of the core in use allocates each of them
+   frameview  FrameView decode of the packet and print into a stack buffer, then one append
+*/
+#include <FrameView.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <new>
+#include <string>
+
+static size_t allocations = 0u;
+void* operator new(size_t size) {
+	allocations++;
+	void* p = malloc(size);
+	if (!p) throw std::bad_alloc();
+	return p;
+}
+void operator delete(void* p) noexcept {
+	free(p);
+}
+void operator delete(void* p, size_t) noexcept {
+	free(p);
+}
+
+static std::string hex(uint8_t value) {
+	char buffer[3];
+	snprintf(buffer, sizeof(buffer), "%x", value);
+	return std::string(buffer);
+}
+
+#define ROUNDS 1000000
+
+int main() {
+	static const uint8_t up[] = {0x40, 0xDA, 0x1B, 0x01, 0x26, 0x81, 0x0C, 0x00, 0x02, 0x01, 0xA1, 0xA2, 0xA3, 0x11, 0x22, 0x33, 0x44};
+	size_t sink = 0u;
+
+	allocations = 0u;
+	clock_t begin = clock();
+	for (int i = 0; i < ROUNDS; i++) {
+		std::string logMessage = "RX: freq:868100000, sf:7, rssi:-87, dev:";
+		logMessage += std::string((up[4] < 0x10) ? "0" : "") + hex(up[4]);
+		logMessage += std::string((up[3] < 0x10) ? "0" : "") + hex(up[3]);
+		logMessage += std::string((up[2] < 0x10) ? "0" : "") + hex(up[2]);
+		logMessage += std::string((up[1] < 0x10) ? "0" : "") + hex(up[1]);
+		logMessage += ", len:" + std::to_string(sizeof(up));
+		sink += logMessage.size();
+	}
+	double string = (double) (clock() - begin) / CLOCKS_PER_SEC;
+	size_t stringAllocations = allocations;
+
+	allocations = 0u;
+	begin = clock();
+	for (int i = 0; i < ROUNDS; i++) {
+		char text[FRAME_TEXT_LENGTH];
+		FrameView frame(up, sizeof(up));
+		frame.print(text);
+		std::string logMessage = "RX: freq:868100000, sf:7, rssi:-87, ";
+		logMessage += text;
+		sink += logMessage.size();
+	}
+	double view = (double) (clock() - begin) / CLOCKS_PER_SEC;
+	size_t viewAllocations = allocations;
+
+	printf("%-10s %7.1f ns %5.2f allocations per packet\n", "string", string * 1e9 / ROUNDS, (double) stringAllocations / ROUNDS);
+	printf("%-10s %7.1f ns %5.2f allocations per packet (whole decode and fcnt, port, size)\n", "frameview", view * 1e9 / ROUNDS, (double) viewAllocations / ROUNDS);
+	return sink ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+/*
+ Host test of FrameView
+
+   frames   known frames of each message type: every field, payload and the log line
+   encode   1000000 random data frames and JoinRequests built field by field, decoded back
+   fuzz     10000000 random buffers of 0 to 300 bytes, built with -fsanitize=address,undefined by
+            make fuzz: nothing is read outside the buffer and valid views are consistent
+
+ Returns 1 on the first failure.
+*/
+#include <FrameView.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+static uint64_t state = 88172645463325252ull;
+static uint64_t next() {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+#define CHECK(condition, ...) if (!(condition)) { printf("FAIL " __VA_ARGS__); printf("\n"); return 1; }
+
+static int frames() {
+	// UnconfirmedDataUp, DevAddr 26011BDA, ADR, FCnt 12, one byte of FOpts, FPort 1, 3 bytes of FRMPayload
+	static const uint8_t up[] = {0x40, 0xDA, 0x1B, 0x01, 0x26, 0x81, 0x0C, 0x00, 0x02, 0x01, 0xA1, 0xA2, 0xA3, 0x11, 0x22, 0x33, 0x44};
+	FrameView data(up, sizeof(up));
+	CHECK(data.data() && data.uplink() && FrameView::UNCONFIRMED_UP == data.mtype, "data frame type");
+	CHECK(0x26011BDAul == data.devAddr && 0x81u == data.fctrl && 12u == data.fcnt, "data frame header");
+	CHECK(1u == data.foptsLength() && up + 8 == data.fopts() && 0x02u == *data.fopts(), "FOpts");
+	CHECK(1 == data.fport && 3u == data.payloadLength && up + 10 == data.payload(), "FPort and FRMPayload");
+	CHECK(0x13u == data.nwkId(), "NwkID");
+	char text[FRAME_TEXT_LENGTH];
+	data.print(text);
+	CHECK(!strcmp(text, "UnconfirmedDataUp dev:26011BDA fcnt:12 port:1 size:17"), "print %s", text);
+
+	// ConfirmedDataDown without FPort: MAC commands in FOpts only
+	static const uint8_t down[] = {0xA0, 0x01, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x11, 0x22, 0x33, 0x44};
+	FrameView ack(down, sizeof(down));
+	CHECK(ack.data() && !ack.uplink() && -1 == ack.fport && NULL == ack.payload() && 65535u == ack.fcnt, "frame without FPort");
+	ack.print(text);
+	CHECK(!strcmp(text, "ConfirmedDataDown dev:00000001 fcnt:65535 size:12"), "print %s", text);
+
+	// JoinRequest, JoinEUI 70B3D57ED0000000, DevEUI 0004A30B001C0530, DevNonce 0x1234
+	static const uint8_t request[] = {0x00,
+		0x00, 0x00, 0x00, 0xD0, 0x7E, 0xD5, 0xB3, 0x70,
+		0x30, 0x05, 0x1C, 0x00, 0x0B, 0xA3, 0x04, 0x00,
+		0x34, 0x12, 0x11, 0x22, 0x33, 0x44};
+	FrameView join(request, sizeof(request));
+	CHECK(join.join() && 0x70B3D57ED0000000ull == join.joinEui && 0x0004A30B001C0530ull == join.devEui && 0x1234u == join.devNonce, "JoinRequest");
+	join.print(text);
+	CHECK(!strcmp(text, "JoinRequest joineui:70B3D57ED0000000 deveui:0004A30B001C0530 size:23"), "print %s", text);
+	CHECK(strlen(text) < FRAME_TEXT_LENGTH, "FRAME_TEXT_LENGTH");
+
+	// LoRaWAN R2 (Major 1), too short, a neighbour sharing the sync word
+	static const uint8_t major[] = {0x41, 0xDA, 0x1B, 0x01, 0x26, 0x00, 0x0C, 0x00, 0x11, 0x22, 0x33, 0x44};
+	CHECK(!FrameView(major, sizeof(major)).valid, "Major 1");
+	CHECK(!FrameView(up, 11u).valid, "11 bytes data frame");
+	CHECK(!FrameView(up, 0u).valid && !FrameView(NULL, 5u).valid, "empty");
+	FrameView(up, 0u).print(text);
+	CHECK(!strcmp(text, "Invalid size:0"), "print %s", text);
+	printf("frames   ok\n");
+	return 0;
+}
+
+static int encode() {
+	uint8_t buffer[255];
+	for (int i = 0; i < 1000000; i++) {
+		if (next() % 4u) {
+			uint8_t mtype = (uint8_t) (2u + next() % 4u);
+			uint32_t devAddr = (uint32_t) next();
+			uint8_t fctrl = (uint8_t) next();
+			uint16_t fcnt = (uint16_t) next();
+			uint8_t fopts = fctrl & 0x0Fu;
+			bool port = next() & 1u;
+			uint8_t length = port ? (uint8_t) (next() % (255u - 13u - fopts)) : 0u;
+			uint16_t size = 8u + fopts + (port ? 1u + length : 0u) + FRAME_MIC;
+			buffer[0] = (uint8_t) (mtype << 5);
+			for (int b = 0; b < 4; b++) buffer[1 + b] = (uint8_t) (devAddr >> (8 * b));
+			buffer[5] = fctrl;
+			buffer[6] = (uint8_t) fcnt;
+			buffer[7] = (uint8_t) (fcnt >> 8);
+			if (port) buffer[8 + fopts] = (uint8_t) i;
+
+			FrameView view(buffer, size);
+			CHECK(view.data() && mtype == view.mtype && devAddr == view.devAddr && fctrl == view.fctrl && fcnt == view.fcnt, "data frame %d", i);
+			CHECK(fopts == view.foptsLength() && (port ? (int16_t) (uint8_t) i : -1) == view.fport && length == view.payloadLength, "data frame %d body", i);
+		} else {
+			uint64_t joinEui = next(), devEui = next();
+			uint16_t devNonce = (uint16_t) next();
+			buffer[0] = 0x00u;
+			for (int b = 0; b < 8; b++) {
+				buffer[1 + b] = (uint8_t) (joinEui >> (8 * b));
+				buffer[9 + b] = (uint8_t) (devEui >> (8 * b));
+			}
+			buffer[17] = (uint8_t) devNonce;
+			buffer[18] = (uint8_t) (devNonce >> 8);
+			FrameView view(buffer, 23u);
+			CHECK(view.join() && joinEui == view.joinEui && devEui == view.devEui && devNonce == view.devNonce, "JoinRequest %d", i);
+		}
+	}
+	printf("encode   ok\n");
+	return 0;
+}
+
+static int fuzz() {
+	uint8_t buffer[300];
+	char text[FRAME_TEXT_LENGTH];
+	uint32_t valid = 0ul;
+	for (int i = 0; i < 10000000; i++) {
+		uint16_t size = (uint16_t) (next() % 301u);
+		for (uint16_t b = 0u; b < size; b += 8u) {
+			uint64_t random = next();
+			memcpy(buffer + b, &random, (uint16_t) (size - b) < 8u ? (uint16_t) (size - b) : 8u);
+		}
+		// a heap copy of exactly size bytes, the sanitizer catches any read past it
+		uint8_t* exact = new uint8_t[size ? size : 1u];
+		memcpy(exact, buffer, size);
+		FrameView view(exact, size);
+		uint8_t length = view.print(text);
+		CHECK(length < FRAME_TEXT_LENGTH && strlen(text) == length, "print of %u bytes", size);
+		if (view.data()) {
+			const uint8_t* end = view.payload() ? view.payload() + view.payloadLength : view.fopts() + view.foptsLength();
+			CHECK(end + FRAME_MIC == exact + size, "data frame of %u bytes does not end with its MIC", size);
+		}
+		valid += view.valid ? 1u : 0u;
+		delete[] exact;
+	}
+	printf("fuzz     10000000 buffers, %u valid\n", valid);
+	return 0;
+}
+
+int main() {
+	return frames() || encode() || fuzz();
+}
@@ -0,0 +1,73 @@
+#include <Scratch.h>
+
+Scratch::Scratch(uint32_t size) : size(size) {
+	this->buffer = new uint8_t[size];
+}
+
+Scratch::~Scratch() {
+	delete[] this->buffer;
+}
+
+bool Scratch::owns(void* p) {
+	uint8_t* bp = (uint8_t*) p;
+	return (this->buffer <= bp) && (bp < this->buffer + this->size);
+}
+
+void* Scratch::allocate(size_t n) {
+	uint32_t header = (sizeof(Block) + 7ul) & ~7ul;
+	uint32_t length = (n + 7ul) & ~7ul;
+	if (this->size < this->offset + header + length) {
+		this->statistics.overflows += 1u;
+		char logMessage[80]; // not a String: the heap is what the arena spares
+		snprintf(logMessage, sizeof(logMessage), "Scratch overflow: %u bytes requested, %u free, using heap", (unsigned) n, (unsigned) (this->size - this->offset));
+		DEBUG.println(logMessage);
+		return malloc(n);
+	}
+
+	Block* block = (Block*) (this->buffer + this->offset);
+	block->prev = this->top;
+	block->freed = 0ul;
+	this->top = this->offset;
+	this->offset += header + length;
+	this->live += 1u;
+	this->statistics.allocs += 1u;
+	if (this->statistics.peak < this->offset) {
+		this->statistics.peak = this->offset;
+	}
+	return (uint8_t*) block + header;
+}
+
+void Scratch::deallocate(void* p) {
+	if (!this->owns(p)) {
+		free(p); // heap fallback or NULL
+		return;
+	}
+
+	uint32_t header = (sizeof(Block) + 7ul) & ~7ul;
+	Block* block = (Block*) ((uint8_t*) p - header);
+	block->freed = 1ul;
+	this->live -= 1u;
+
+	// pop every freed block on top, documents released out of order are reclaimed later
+	while (SCRATCH_NONE != this->top) {
+		Block* last = (Block*) (this->buffer + this->top);
+		if (!last->freed) break;
+		this->offset = this->top;
+		this->top = last->prev;
+	}
+}
+
+void Scratch::reset() {
+	if (0u < this->live) {
+		// rewinding now would corrupt those documents, they will be reclaimed when released
+		this->statistics.leaks += 1u;
+		char logMessage[80];
+		snprintf(logMessage, sizeof(logMessage), "Scratch reset with %u live documents, %u bytes in use", (unsigned) this->live, (unsigned) this->offset);
+		DEBUG.println(logMessage);
+		return;
+	}
+	this->offset = 0ul;
+	this->top = SCRATCH_NONE;
+}
+
+Scratch scratch(SCRATCH_SIZE);
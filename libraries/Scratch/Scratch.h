@@ -0,0 +1,79 @@
+/**
+ * Scratch memory for the short lived JsonDocuments of the control plane.
+ * Documents are bump allocated from a single buffer reserved at boot, they are released in LIFO
+ * order when they go out of scope (so nested documents can coexist) and the arena is rewound at
+ * the end of every LoRaWanGateway::loop. Whatever does not fit falls back to the heap and is reported.
+ */
+
+#include <Arduino.h>
+#include <DebugM.h>
+#define ARDUINOJSON_USE_DOUBLE 1
+#define ARDUINOJSON_FAST_FLOAT 1
+#include <ArduinoJson.h>
+
+#ifndef __Scratch__
+#define __Scratch__
+
+#define SCRATCH_COMMAND 1024ul // documents of a command: request, response, broadcast, a settings file
+#define SCRATCH_LOG 512ul      // Node::log
+#define SCRATCH_BLOCK(n) (8ul + (((n) + 7ul) & ~7ul)) // Block header and n rounded to 8
+#define SCRATCH_CIPHER(n) ((n) + 32ul) // iv and padding of AES-CBC
+#define SCRATCH_MESSAGE(n) (SCRATCH_CIPHER(n) + 12ul + 4ul * ((SCRATCH_CIPHER(n) + 2ul) / 3ul)) // NetworkNode::message
+#define SCRATCH_MAX(a, b) ((a) < (b) ? (b) : (a))
+
+/*
+ * The deepest path is a settings command on /u: the response and broadcast of NetworkNode::user and the
+ * request of Login::user, then either Node::saveFile or a Node::log and its encrypted message (the
+ * serialized log is its document and the keys, not in its pool). 5056 bytes, the peak is in the ping.
+ */
+#ifndef SCRATCH_SIZE
+#define SCRATCH_SIZE (3ul * SCRATCH_BLOCK(SCRATCH_COMMAND) + SCRATCH_MAX(SCRATCH_BLOCK(SCRATCH_COMMAND), \
+	SCRATCH_BLOCK(SCRATCH_LOG) + SCRATCH_BLOCK(SCRATCH_MESSAGE(SCRATCH_LOG + 64ul))))
+#endif
+
+#define SCRATCH_NONE 0xFFFFFFFFul
+
+class Scratch {
+	public:
+
+	class Block {
+		public:
+		uint32_t prev = SCRATCH_NONE; // offset of the previous block
+		uint32_t freed = 0ul;
+	};
+
+	class Statistics {
+		public:
+		uint32_t allocs = 0ul;    // documents served from the arena
+		uint32_t overflows = 0ul; // documents that did not fit and were served from the heap
+		uint32_t peak = 0ul;      // highest offset reached since boot, in bytes
+		uint32_t leaks = 0ul;     // loops that ended with live documents in the arena
+	};
+
+	uint8_t* buffer = NULL;
+	uint32_t size = 0ul;
+	uint32_t offset = 0ul;
+	uint32_t top = SCRATCH_NONE;
+	uint16_t live = 0u;
+	Statistics statistics;
+
+	Scratch(uint32_t size);
+	virtual ~Scratch();
+	void* allocate(size_t n);
+	void deallocate(void* p);
+	bool owns(void* p);
+	void reset();
+};
+
+extern Scratch scratch;
+
+class ScratchAllocator {
+	public:
+	void* allocate(size_t n) { return scratch.allocate(n); }
+	void deallocate(void* p) { scratch.deallocate(p); }
+};
+
+// Use it as a drop-in replacement of DynamicJsonDocument for documents that live inside a function
+typedef BasicJsonDocument<ScratchAllocator> ScratchJsonDocument;
+
+#endif
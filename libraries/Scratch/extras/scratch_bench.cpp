@@ -0,0 +1,210 @@
+/*
+ Heap of the control plane documents, served by the heap (DynamicJsonDocument) and by the scratch arena
+
+ Replays the allocations of the gateway loop on a model of the ESP8266 heap (first fit, 8 byte header,
+ blocks rounded to 8, HEAP_SIZE free after boot) for LOOPS loops:
+   every loop       an uplink that lives UPLINK_LIFE loops, the ping of a dashboard: its document and the
+                    String of its encrypted message
+   every 10 loops   a PULL_RESP, the document of WAN::resp
+   every 20 loops   a settings command on the deepest path: response, broadcast, request, a log and its message
+
+ The arena is reserved once at boot and counted as used. Prints the heap allocations per loop, the lowest
+ largest free block and the highest fragmentation (the formula of ESP.getHeapFragmentation) at the end of
+ the loops and at their peak.
+*/
+#include <Scratch.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <map>
+
+#define HEAP_SIZE 32768u
+#define LOOPS 10000
+#define UPLINK_LIFE 4
+
+static const char* PING = "{\"state\":{\"ws\":{\"bcst\":1532,\"fback\":0,\"copied\":418230,\"last\":304,\"sent\":912,\"us\":212,\"maxus\":4210,\"depth\":0,\"queued\":0,\"drops\":0,\"kicks\":0}},"
+	"\"system\":{\"ntp\":{\"state\":{\"now\":1700000000}},\"esps\":{\"state\":{\"heap\":21344,\"heapf\":12,\"scratch\":{\"size\":4096,\"peak\":3120,\"allocs\":98211,\"ovf\":0,\"leaks\":0}}}},"
+	"\"wan\":{\"state\":{\"now\":86400000,\"ack\":86391000,\"stats\":{\"rxnb\":1234,\"rxok\":1200,\"rxfw\":1200,\"ackr\":100.0,\"dwnb\":18,\"txnb\":18}}}}";
+static const char* SETTINGS = "{\"wan\":{\"settings\":{\"host\":\"router.eu.thethings.network\",\"port\":1700,\"servers\":\"eu1.cloud.thethings.network:1700\","
+	"\"desc\":\"rooftop gateway\",\"mail\":\"admin@example.com\",\"istat\":180,\"ipull\":57,\"lon\":4.8951,\"lat\":52.3702,\"alt\":12}}}";
+static const char* LOG = "{\"wan\":{\"log\":{\"text\":\"settings saved, 2 network servers\",\"tstm\":1700000000}}}";
+static const char* TXPK = "{\"txpk\":{\"imme\":false,\"tmst\":176681117,\"freq\":868.3,\"rfch\":0,\"powe\":14,\"modu\":\"LORA\","
+	"\"datr\":\"SF7BW125\",\"codr\":\"4/5\",\"ipol\":true,\"size\":29,\"ncrc\":true,\"data\":\"YEUqASYAAgABTcboOsOjmOFBwTfPlbBp1jxnXSU=\"}}";
+
+class Heap {
+	public:
+	uint8_t memory[HEAP_SIZE];
+	std::map<uint32_t, uint32_t> free; // offset, size of the free blocks
+	std::map<uint32_t, uint32_t> used;
+	uint32_t allocations = 0ul;
+
+	Heap() { this->free[0u] = HEAP_SIZE; }
+
+	void* allocate(size_t n) {
+		uint32_t size = 8u + ((n + 7u) & ~7u);
+		for (std::map<uint32_t, uint32_t>::iterator block = this->free.begin(); block != this->free.end(); block++) {
+			if (size <= block->second) {
+				uint32_t offset = block->first;
+				uint32_t left = block->second - size;
+				this->free.erase(block);
+				if (0u < left) {
+					this->free[offset + size] = left;
+				}
+				this->used[offset] = size;
+				this->allocations++;
+				return this->memory + offset + 8u;
+			}
+		}
+		return NULL;
+	}
+
+	void deallocate(void* p) {
+		if (NULL == p) {
+			return;
+		}
+		uint32_t offset = (uint8_t*) p - this->memory - 8u;
+		uint32_t size = this->used[offset];
+		this->used.erase(offset);
+		std::map<uint32_t, uint32_t>::iterator next = this->free.find(offset + size);
+		if (this->free.end() != next) {
+			size += next->second;
+			this->free.erase(next);
+		}
+		std::map<uint32_t, uint32_t>::iterator block = this->free.insert(std::make_pair(offset, size)).first;
+		if (this->free.begin() != block) {
+			std::map<uint32_t, uint32_t>::iterator previous = block;
+			previous--;
+			if (previous->first + previous->second == offset) {
+				previous->second += size;
+				this->free.erase(block);
+			}
+		}
+	}
+
+	uint32_t largest() const {
+		uint32_t largest = 0u;
+		for (std::map<uint32_t, uint32_t>::const_iterator block = this->free.begin(); block != this->free.end(); block++) {
+			largest = largest < block->second ? block->second : largest;
+		}
+		return largest;
+	}
+
+	// ESP.getHeapFragmentation: 100 - 100 * sqrt(sum of the squares of the free blocks) / free bytes
+	uint32_t fragmentation() const {
+		double total = 0.0;
+		double squares = 0.0;
+		for (std::map<uint32_t, uint32_t>::const_iterator block = this->free.begin(); block != this->free.end(); block++) {
+			total += block->second;
+			squares += (double) block->second * block->second;
+		}
+		return 0.0 < total ? (uint32_t) (100.0 - 100.0 * sqrt(squares) / total) : 100u;
+	}
+};
+
+static Heap* heap = NULL;
+
+class HeapAllocator {
+	public:
+	void* allocate(size_t n) { return heap->allocate(n); }
+	void deallocate(void* p) { heap->deallocate(p); }
+};
+
+class Result {
+	public:
+	uint32_t allocations = 0ul;
+	uint32_t largest = HEAP_SIZE; // lowest largest free block
+	uint32_t fragmentation = 0u;  // highest fragmentation
+	uint32_t peakLargest = HEAP_SIZE;
+	uint32_t peakFragmentation = 0u;
+
+	void peak() {
+		this->peakLargest = std::min(this->peakLargest, heap->largest());
+		this->peakFragmentation = std::max(this->peakFragmentation, heap->fragmentation());
+	}
+
+	void end() {
+		this->largest = std::min(this->largest, heap->largest());
+		this->fragmentation = std::max(this->fragmentation, heap->fragmentation());
+	}
+};
+
+// NetworkNode::message: iv, padding, Base64 and {"data":"..."} around the serialized document
+static void* message(JsonDocument& document) {
+	return heap->allocate(SCRATCH_MESSAGE(measureJson(document)));
+}
+
+template <typename Document> static void ping(Result& result) {
+	Document pongDocument(1024);
+	deserializeJson(pongDocument, PING);
+	void* pong = message(pongDocument);
+	result.peak();
+	heap->deallocate(pong);
+}
+
+template <typename Document> static void resp() {
+	Document doc(JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(13) + 160);
+	deserializeJson(doc, TXPK);
+}
+
+template <typename Document> static void command(Result& result) {
+	Document responseDocument(SCRATCH_COMMAND);
+	Document broadcastDocument(SCRATCH_COMMAND);
+	Document requestDocument(SCRATCH_COMMAND);
+	deserializeJson(requestDocument, SETTINGS);
+	responseDocument.set(requestDocument);
+	broadcastDocument.set(requestDocument);
+	Document rootDocument(SCRATCH_LOG);
+	deserializeJson(rootDocument, LOG);
+	void* log = message(rootDocument);
+	result.peak();
+	heap->deallocate(log);
+	void* response = message(responseDocument);
+	void* broadcast = message(broadcastDocument);
+	heap->deallocate(broadcast);
+	heap->deallocate(response);
+}
+
+template <typename Document> static Result run(bool arena) {
+	Heap model;
+	heap = &model;
+	Result result;
+	void* arenaBlock = arena ? heap->allocate(SCRATCH_SIZE) : NULL;
+	void* uplinks[UPLINK_LIFE] = {NULL};
+	uint32_t boot = heap->allocations;
+	for (int i = 0; i < LOOPS; i++) {
+		heap->deallocate(uplinks[i % UPLINK_LIFE]);
+		uplinks[i % UPLINK_LIFE] = heap->allocate(200u + 16u * (i % 7)); // WAN::Message::Up and its rxpk
+		ping<Document>(result);
+		if (0 == i % 10) {
+			resp<Document>();
+		}
+		if (0 == i % 20) {
+			command<Document>(result);
+		}
+		scratch.reset();
+		result.end();
+	}
+	result.allocations = heap->allocations - boot;
+	for (int i = 0; i < UPLINK_LIFE; i++) {
+		heap->deallocate(uplinks[i]);
+	}
+	heap->deallocate(arenaBlock);
+	return result;
+}
+
+static void print(const char* name, const Result& result) {
+	printf("%-8s %6.2f allocations per loop, largest free block %5u B (%5u B at the peak), fragmentation %2u %% (%2u %% at the peak)\n",
+		name, (double) result.allocations / LOOPS, result.largest, result.peakLargest, result.fragmentation, result.peakFragmentation);
+}
+
+int main() {
+	Result before = run<BasicJsonDocument<HeapAllocator> >(false);
+	Result after = run<ScratchJsonDocument>(true);
+	printf("%u B of heap, %d loops, %u B of arena\n", HEAP_SIZE, LOOPS, (unsigned) SCRATCH_SIZE);
+	print("heap", before);
+	print("arena", after);
+	printf("arena    %u documents, peak %u B, %u overflows, %u leaks\n", scratch.statistics.allocs, scratch.statistics.peak,
+		scratch.statistics.overflows, scratch.statistics.leaks);
+	return 0;
+}
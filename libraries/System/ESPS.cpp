@@ -1,7 +1,14 @@
 #include <System.h>
 
 System::ESPS::ESPS(Node* parent, const char* name) : Node(parent, name) {
-
+	this->metrics.add("heap");
+	this->metrics.add("heapf");
+	// compare against heap/heapf to measure what the scratch arena saves
+	this->metrics.add("size", Metric::UINT, "scratch");
+	this->metrics.add("peak", Metric::UINT, "scratch");
+	this->metrics.add("allocs", Metric::UINT, "scratch");
+	this->metrics.add("ovf", Metric::UINT, "scratch");
+	this->metrics.add("leaks", Metric::UINT, "scratch");
 }
 
 System::ESPS::~ESPS() {
@@ -58,14 +65,14 @@ void System::ESPS::getState(JsonObject& esps) {
 	esps["heapf"] = heapFramentation;
 }
 
-void System::ESPS::getPing(JsonObject& response) {
-	JsonObject object = this->rootIT(response);
-	JsonObject mparams = object.createNestedObject("state");
-
-	uint32_t freeHeap = ESP.getFreeHeap();
-	uint32_t heapFramentation = ESP.getHeapFragmentation();
-	mparams["heap"] = freeHeap;
-	mparams["heapf"] = heapFramentation;
+void System::ESPS::measure() {
+	this->metrics.set(System::ESPS::Ping::HEAP, ESP.getFreeHeap());
+	this->metrics.set(System::ESPS::Ping::HEAPF, ESP.getHeapFragmentation());
+	this->metrics.set(System::ESPS::Ping::SIZE, scratch.size);
+	this->metrics.set(System::ESPS::Ping::PEAK, scratch.statistics.peak);
+	this->metrics.set(System::ESPS::Ping::ALLOCS, scratch.statistics.allocs);
+	this->metrics.set(System::ESPS::Ping::OVF, scratch.statistics.overflows);
+	this->metrics.set(System::ESPS::Ping::LEAKS, scratch.statistics.leaks);
 }
 
 String System::ESPS::upgrade() {
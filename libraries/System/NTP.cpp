@@ -1,19 +1,28 @@
 #include <System.h>
 
 System::NTP::NTP(Node* parent, const char* name) : Node(parent, name) {
-	
+	this->metrics.add("now", Metric::CLOCK);
 }
 
 void System::NTP::setup() {
 	this->readFile();
 	sntp_stop();
 	sntp_setservername(0, (char*)this->settings.host.c_str());
-	// sntp_set_timezone(this->settings.tz);
+	sntp_set_timezone(0); // UTC, for clock64.discipline
 	sntp_init();
 }
 
 void System::NTP::loop() {
-	
+	// the timestamp has a 1 s resolution, its edges are sampled when two loops are less than 2 ms apart
+	uint64_t now = clock64.ustime();
+	uint32_t seconds = sntp_get_current_timestamp();
+	if (seconds != this->seconds) {
+		if (this->seconds && 1500000000ul < seconds && now - this->poll < 2000ull) {
+			clock64.discipline.add((this->poll + now) / 2ull, 1000000ull * seconds);
+		}
+		this->seconds = seconds;
+	}
+	this->poll = now;
 }
 
 void System::NTP::getState(JsonObject& state) {
@@ -23,10 +32,8 @@ void System::NTP::getState(JsonObject& state) {
 	state["now"] = sntp_get_current_timestamp();
 }
 
-void System::NTP::getPing(JsonObject& response) {
-	JsonObject object = this->rootIT(response);
-	JsonObject mparams = object.createNestedObject("state");
-	mparams["now"] = sntp_get_current_timestamp();
+void System::NTP::measure() {
+	this->metrics.set(System::NTP::Ping::NOW, sntp_get_current_timestamp());
 }
 
 void System::NTP::save(JsonObject& params, JsonObject& response, JsonObject& broadcast) {
@@ -43,13 +43,20 @@ class System : public Node {
 			int8_t tz = (int8_t) 0;
 		};
 
+		class Ping {
+			public:
+			enum { NOW };
+		};
+
 		Settings settings;
+		uint32_t seconds = 0ul; // last sntp timestamp, its changes are the second edges
+		uint64_t poll = 0ull;   // ustime of the last loop
 
 		NTP(Node* parent, const char* name);
 		void setup();
 		void loop();
 
-		virtual void getPing(JsonObject& response);
+		virtual void measure();
 		virtual void getState(JsonObject& state);
 		virtual void fromJSON(JsonObject& params);
 		virtual void JSON(JsonObject& params);
@@ -58,12 +65,18 @@ class System : public Node {
 
 	class ESPS : public Node {
 		public:
+		// metrics in registration order
+		class Ping {
+			public:
+			enum { HEAP, HEAPF, SIZE, PEAK, ALLOCS, OVF, LEAKS };
+		};
+
 		ESPS(Node* parent, const char* name);
 		virtual ~ESPS();
 		void setup();
 		void loop();
 		String upgrade();
-		virtual void getPing(JsonObject& response);
+		virtual void measure();
 		virtual void getState(JsonObject& state);
 	};
 
@@ -0,0 +1,142 @@
+#include <Discipline.h>
+
+void Discipline::reset() {
+	this->length = 0u;
+	this->base = 0ull;
+	this->offset = 0ll;
+	this->drift = 0l;
+}
+
+bool Discipline::synced() const {
+	return 0u < this->length;
+}
+
+void Discipline::add(uint64_t local, uint64_t utc) {
+	int64_t offset = (int64_t) (utc - local);
+	if (this->length) {
+		if (local < this->samples[this->last].local + this->interval) {
+			return;
+		}
+		int64_t error = offset - (int64_t) (this->utc(local) - local);
+		if (error < -DISCIPLINE_STEP || DISCIPLINE_STEP < error) {
+			this->reset();
+		}
+	}
+
+	this->last = this->length ? (uint8_t) ((this->last + 1u) % DISCIPLINE_SAMPLES) : 0u;
+	this->samples[this->last].local = local;
+	this->samples[this->last].offset = offset;
+	if (this->length < DISCIPLINE_SAMPLES) {
+		this->length++;
+	}
+	this->fit();
+}
+
+void Discipline::fit() {
+	// milliseconds from the newest sample keep the sums in 64 bits for hours of samples
+	const Sample& newest = this->samples[this->last];
+	int64_t sx = 0ll, sy = 0ll;
+	for (uint8_t i = 0u; i < this->length; i++) {
+		sx += (int64_t) (this->samples[i].local - newest.local) / 1000ll;
+		sy += this->samples[i].offset - newest.offset;
+	}
+	int64_t mx = sx / this->length;
+	int64_t my = sy / this->length;
+
+	int64_t cov = 0ll, var = 0ll;
+	for (uint8_t i = 0u; i < this->length; i++) {
+		int64_t dx = (int64_t) (this->samples[i].local - newest.local) / 1000ll - mx;
+		int64_t dy = this->samples[i].offset - newest.offset - my;
+		cov += dx * dy;
+		var += dx * dx;
+	}
+
+	// us per ms * 10^6 = ppb
+	int64_t scaled = var / 1000ll;
+	this->drift = 0ll < scaled ? (int32_t) (cov * 1000ll / scaled) : 0l;
+	this->base = newest.local + (uint64_t) (mx * 1000ll);
+	this->offset = newest.offset + my;
+}
+
+uint64_t Discipline::utc(uint64_t local) const {
+	int64_t elapsed = (int64_t) (local - this->base);
+	return local + (uint64_t) (this->offset + elapsed * this->drift / 1000000000ll);
+}
+
+uint64_t Discipline::local(uint64_t utc) const {
+	// first order inverse, then one correction step for the rounding of both directions
+	uint64_t local = utc - (uint64_t) this->offset;
+	int64_t elapsed = (int64_t) (local - this->base);
+	local -= (uint64_t) (elapsed * this->drift / 1000000000ll);
+	return local + (utc - this->utc(local));
+}
+
+uint64_t Discipline::unwrap(uint32_t low, uint64_t near) {
+	uint64_t value = (near & 0xFFFFFFFF00000000ull) | low;
+	int64_t diff = (int64_t) (value - near);
+	if (diff > 0x7FFFFFFFll && value >= 0x100000000ull) {
+		value -= 0x100000000ull;
+	} else if (diff < -0x80000000ll) {
+		value += 0x100000000ull;
+	}
+	return value;
+}
+
+uint64_t Discipline::tmms(uint64_t utc) {
+	return utc / 1000ull - (GPS_EPOCH - GPS_LEAP) * 1000ull;
+}
+
+uint64_t Discipline::fromTmms(uint64_t tmms) {
+	return (tmms + (GPS_EPOCH - GPS_LEAP) * 1000ull) * 1000ull;
+}
+
+static char* digits(char* p, uint32_t value, uint8_t length) {
+	for (uint8_t i = length; i > 0u; i--) {
+		p[i - 1u] = (char) ('0' + value % 10u);
+		value /= 10u;
+	}
+	return p + length;
+}
+
+uint8_t Discipline::iso8601(char* buffer, uint64_t utc, bool compact) {
+	uint64_t seconds = utc / 1000000ull;
+	uint32_t micros = (uint32_t) (utc % 1000000ull);
+	uint32_t days = (uint32_t) (seconds / 86400ull);
+	uint32_t daytime = (uint32_t) (seconds % 86400ull);
+
+	// civil from days, http://howardhinnant.github.io/date_algorithms.html
+	uint32_t z = days + 719468ul;
+	uint32_t era = z / 146097ul;
+	uint32_t doe = z - era * 146097ul;
+	uint32_t yoe = (doe - doe / 1460ul + doe / 36524ul - doe / 146096ul) / 365ul;
+	uint32_t doy = doe - (365ul * yoe + yoe / 4ul - yoe / 100ul);
+	uint32_t mp = (5ul * doy + 2ul) / 153ul;
+	uint32_t day = doy - (153ul * mp + 2ul) / 5ul + 1ul;
+	uint32_t month = mp < 10ul ? mp + 3ul : mp - 9ul;
+	uint32_t year = yoe + era * 400ul + (month <= 2ul ? 1ul : 0ul);
+
+	char* p = buffer;
+	p = digits(p, year, 4u);
+	*p++ = '-';
+	p = digits(p, month, 2u);
+	*p++ = '-';
+	p = digits(p, day, 2u);
+	*p++ = compact ? 'T' : ' ';
+	p = digits(p, daytime / 3600ul, 2u);
+	*p++ = ':';
+	p = digits(p, daytime / 60ul % 60ul, 2u);
+	*p++ = ':';
+	p = digits(p, daytime % 60ul, 2u);
+	if (compact) {
+		*p++ = '.';
+		p = digits(p, micros, 6u);
+		*p++ = 'Z';
+	} else {
+		*p++ = ' ';
+		*p++ = 'G';
+		*p++ = 'M';
+		*p++ = 'T';
+	}
+	*p = '\0';
+	return (uint8_t) (p - buffer);
+}
@@ -0,0 +1,65 @@
+/**
+ * Maps the local microsecond clock (micros() extended to 64 bits) to UTC.
+ *
+ * Samples are (local, UTC) pairs, at least interval apart, the last DISCIPLINE_SAMPLES of them are
+ * fitted by least squares to utc = local + offset + (local - base) * drift. A sample more than
+ * DISCIPLINE_STEP away from the fit (first NTP answer, NTP step) restarts the fit.
+ * Integers only, the conversions run in the packet path.
+ */
+
+#include <stdint.h>
+
+#ifndef __Discipline__
+#define __Discipline__
+
+#define DISCIPLINE_SAMPLES 16
+#define DISCIPLINE_STEP 100000ll // us
+#define GPS_EPOCH 315964800ull   // 1980-01-06T00:00:00Z in seconds since 1970
+#define GPS_LEAP 18ull           // GPS - UTC seconds, since 2017
+
+class Discipline {
+	public:
+	class Sample {
+		public:
+		uint64_t local = 0ull; // us
+		int64_t offset = 0ll;  // utc - local in us
+	};
+
+	Sample samples[DISCIPLINE_SAMPLES];
+	uint8_t length = 0u;
+	uint8_t last = 0u;            // index of the newest sample
+	uint32_t interval = 60000000ul; // us between samples
+	uint64_t base = 0ull;         // local us the fit is centered on
+	int64_t offset = 0ll;         // utc - local at base, us
+	int32_t drift = 0l;           // ppb
+
+	void add(uint64_t local, uint64_t utc); // both in us
+	void reset();
+	bool synced() const;
+	uint64_t utc(uint64_t local) const;
+	uint64_t local(uint64_t utc) const;
+
+	/* unwrap:
+	 *   Description:
+	 *     The 64 bits value whose low 32 bits are low and that is the closest to near,
+	 *     tmst of the packet forwarder protocol to the local clock
+	 */
+	static uint64_t unwrap(uint32_t low, uint64_t near);
+
+	static uint64_t tmms(uint64_t utc); // GPS milliseconds since 1980-01-06 of a UTC us
+	static uint64_t fromTmms(uint64_t tmms); // UTC us of a GPS ms
+
+	/* iso8601:
+	 *   Description:
+	 *     Writes a UTC us as "2013-03-31T16:21:17.528002Z" (compact) or "2014-01-12 08:59:28 GMT"
+	 *   Parameters:
+	 *     buffer - 28 bytes
+	 *   Returns:
+	 *     Number of characters written, not including the null terminator
+	 */
+	static uint8_t iso8601(char* buffer, uint64_t utc, bool compact);
+
+	void fit();
+};
+
+#endif
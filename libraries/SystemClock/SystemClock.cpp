@@ -15,6 +15,15 @@ uint64_t SystemClock::mstime() {
 	return this->h + msnow;
 }
 
+uint64_t SystemClock::ustime() {
+	this->us = Discipline::unwrap(micros(), this->us);
+	return this->us;
+}
+
+uint64_t SystemClock::local(uint32_t tmst) {
+	return Discipline::unwrap(tmst, this->ustime());
+}
+
 uint32_t SystemClock::high() {
 	uint64_t ms = mstime();
 	uint32_t h = (uint32_t) (ms >> 4 * 8);
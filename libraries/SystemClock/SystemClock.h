@@ -2,15 +2,20 @@
 #define __SystemClock__
 
 #include <Arduino.h>
+#include <Discipline.h>
 
 class SystemClock {
 	public:
 	uint32_t low = 0ul;
 	uint64_t h = 0ull;
+	uint64_t us = 0ull; // last ustime
+	Discipline discipline; // local us to UTC, fed by System::NTP
 
 	virtual ~SystemClock() {}
 	SystemClock();
 	uint64_t mstime();
+	uint64_t ustime(); // micros() in 64 bits, call it at least every 35 minutes
+	uint64_t local(uint32_t tmst); // the ustime of a micros() value of the last 35 minutes or the next
 	uint32_t high();
 };
 
@@ -0,0 +1,104 @@
+/*
+ Host test of Discipline
+
+   unwrap   micros() around its 32 bits wrap, forwards and backwards
+   drift    a local clock 47 ppm fast with a 1.5 s offset, sampled like System::NTP does (second
+            edges of a 1 s resolution timestamp, up to 2 ms late), an NTP step in the middle;
+            utc() must stay within 3 ms of the truth once 5 samples are in (apart from the minute
+            between the step and the next sample) and local(utc()) must come back within 1 us
+   formats  tmms and iso8601 of known instants
+
+ Returns 1 on the first failure.
+*/
+#include <Discipline.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+static uint64_t state = 88172645463325252ull;
+static uint64_t next() {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+#define CHECK(condition, ...) if (!(condition)) { printf("FAIL " __VA_ARGS__); printf("\n"); return 1; }
+
+static int unwrap() {
+	// a clock read every 0 to 20 minutes through 3 wraps
+	uint64_t truth = 0xFFFF0000ull, last = truth;
+	for (int i = 0; i < 10000; i++) {
+		truth += next() % 1200000000ull;
+		last = Discipline::unwrap((uint32_t) truth, last);
+		CHECK(last == truth, "unwrap %llu != %llu", (unsigned long long) last, (unsigned long long) truth);
+	}
+	// tmst of a packet received just before or scheduled just after the wrap
+	CHECK(Discipline::unwrap(0xFFFFFF00ul, 0x200000010ull) == 0x1FFFFFF00ull, "unwrap backwards");
+	CHECK(Discipline::unwrap(0x00000010ul, 0x1FFFFFF00ull) == 0x200000010ull, "unwrap forwards");
+	CHECK(Discipline::unwrap(0x00000010ul, 0x00000100ull) == 0x000000010ull, "unwrap at 0");
+	printf("unwrap   ok\n");
+	return 0;
+}
+
+static int drift() {
+	const int64_t ppb = 47000ll;
+	int64_t offset = 1500000000000000ll; // UTC us at local 0
+	Discipline discipline;
+	uint64_t poll = 0ull;
+	uint32_t seconds = 0ul;
+	int64_t worst = 0ll;
+	int samples = 0;
+	bool stepped = false; // until the discipline restarts on the stepped samples
+
+	// 6 hours, polled every 0.1 to 2 ms like the gateway loop
+	for (uint64_t local = 1000ull; local < 6ull * 3600ull * 1000000ull; local += 100ull + next() % 1900ull) {
+		if (3ull * 3600ull * 1000000ull <= local && local < 3ull * 3600ull * 1000000ull + 2000ull) {
+			offset += 250000ll; // NTP step
+			stepped = true;
+		}
+		uint64_t utc = (uint64_t) (offset + (int64_t) local + (int64_t) local * ppb / 1000000000ll);
+		uint32_t now = (uint32_t) (utc / 1000000ull);
+		if (now != seconds) {
+			if (seconds && local - poll < 2000ull) {
+				uint64_t edge = (poll + local) / 2ull;
+				discipline.add(edge, (uint64_t) now * 1000000ull);
+				if (discipline.samples[discipline.last].local == edge) samples++;
+				if (1u == discipline.length) stepped = false;
+			}
+			seconds = now;
+		}
+		poll = local;
+
+		if (!stepped && 5u <= discipline.length) {
+			int64_t error = (int64_t) (discipline.utc(local) - utc);
+			if (error < 0) error = -error;
+			if (error > worst) worst = error;
+			CHECK(error <= 3000ll, "utc off by %lld us at %llu us, drift %d ppb", (long long) error, (unsigned long long) local, (int) discipline.drift);
+			int64_t back = (int64_t) (discipline.local(discipline.utc(local)) - local);
+			CHECK(-1ll <= back && back <= 1ll, "local(utc()) off by %lld us", (long long) back);
+		}
+	}
+	printf("drift    %d samples, fitted %d ppb for %lld, worst %lld us\n", samples, (int) discipline.drift, (long long) ppb, (long long) worst);
+	return 0;
+}
+
+static int formats() {
+	char buffer[28];
+	Discipline::iso8601(buffer, 1364746877528002ull, true);
+	CHECK(!strcmp(buffer, "2013-03-31T16:21:17.528002Z"), "%s", buffer);
+	Discipline::iso8601(buffer, 1389517168000000ull, false);
+	CHECK(!strcmp(buffer, "2014-01-12 08:59:28 GMT"), "%s", buffer);
+	Discipline::iso8601(buffer, 951782400000000ull, true);
+	CHECK(!strcmp(buffer, "2000-02-29T00:00:00.000000Z"), "%s", buffer);
+
+	// 2020-01-01T00:00:00Z is 1261872018 GPS seconds
+	CHECK(Discipline::tmms(1577836800000000ull) == 1261872018000ull, "tmms %llu", (unsigned long long) Discipline::tmms(1577836800000000ull));
+	CHECK(Discipline::fromTmms(1261872018000ull) == 1577836800000000ull, "fromTmms");
+	printf("formats  ok\n");
+	return 0;
+}
+
+int main() {
+	return unwrap() || drift() || formats();
+}
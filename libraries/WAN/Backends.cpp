@@ -0,0 +1,144 @@
+#include <Backends.h>
+#include <string.h>
+
+void Backend::set(const char* host, uint16_t port, bool down) {
+	strncpy(this->host, host, BACKEND_HOST_LENGTH - 1);
+	this->host[BACKEND_HOST_LENGTH - 1] = '\0';
+	this->port = port;
+	this->down = down;
+}
+
+void Backend::push(uint8_t identifier, uint16_t token, uint32_t now) {
+	if (PUSH_DATA == identifier) {
+		this->upnb++;
+	}
+	if (PUSH_DATA == identifier || PULL_DATA == identifier) {
+		this->token = token;
+		this->sent = now;
+		this->waiting = true;
+	}
+}
+
+bool Backend::ack(uint8_t identifier, uint16_t token, uint32_t now) {
+	if (PUSH_ACK == identifier) {
+		this->acnb++;
+	}
+	if (!this->waiting || token != this->token) {
+		return false; // late, or the ACK of a datagram sent before the last one
+	}
+	this->waiting = false;
+	uint32_t sample = now - this->sent;
+	this->rtt = this->rtt ? (7ul * this->rtt + sample) / 8ul : sample;
+	return true;
+}
+
+void Backend::stat() {
+	// the PUSH_ACK of the last PUSH_DATA may arrive in the next interval
+	uint32_t acnb = this->acnb < this->upnb ? this->acnb : this->upnb;
+	this->ackr = this->upnb ? (uint16_t) (10000ull * acnb / this->upnb) : 0u;
+	this->upnb = 0ul;
+	this->acnb = 0ul;
+}
+
+uint16_t Backends::ackr() const {
+	uint16_t ackr = 10000u;
+	for (uint8_t i = 0u; i < this->length; i++) {
+		ackr = this->backends[i].ackr < ackr ? this->backends[i].ackr : ackr;
+	}
+	return ackr;
+}
+
+static const char* spaces(const char* p) {
+	while (' ' == *p) {
+		p++;
+	}
+	return p;
+}
+
+bool Backends::parse(const char* text) {
+	Backend parsed[BACKENDS];
+	uint8_t length = 1u;
+	const char* p = spaces(text);
+	while (*p) {
+		if (BACKENDS <= length) {
+			return false;
+		}
+		const char* colon = p;
+		while (*colon && ':' != *colon && ',' != *colon && ' ' != *colon) {
+			colon++;
+		}
+		size_t size = (size_t) (colon - p);
+		if (':' != *colon || !size || BACKEND_HOST_LENGTH <= size) {
+			return false;
+		}
+		const char* end = colon + 1;
+		uint32_t port = 0ul;
+		for (; '0' <= *end && *end <= '9' && port <= 65535ul; end++) {
+			port = port * 10ul + (uint32_t) (*end - '0');
+		}
+		if (end == colon + 1 || !port || 65535ul < port) {
+			return false;
+		}
+
+		Backend& backend = parsed[length++];
+		memcpy(backend.host, p, size);
+		backend.host[size] = '\0';
+		backend.port = (uint16_t) port;
+		p = spaces(end);
+		if (!strncmp(p, "up", 2u) && (!p[2] || ',' == p[2] || ' ' == p[2])) {
+			backend.down = false;
+			p = spaces(p + 2);
+		}
+
+		if (',' == *p) {
+			p = spaces(p + 1);
+		} else if (*p) {
+			return false;
+		}
+	}
+
+	for (uint8_t i = 1u; i < length; i++) {
+		for (uint8_t j = 1u; j < this->length; j++) {
+			const Backend& old = this->backends[j];
+			if (old.port == parsed[i].port && !strcmp(old.host, parsed[i].host)) {
+				bool down = parsed[i].down;
+				parsed[i] = old;
+				parsed[i].down = down;
+			}
+		}
+	}
+	for (uint8_t i = 1u; i < BACKENDS; i++) {
+		this->backends[i] = parsed[i];
+	}
+	this->length = length;
+	return true;
+}
+
+uint16_t Backends::print(char* buffer) const {
+	char* p = buffer;
+	for (uint8_t i = 1u; i < this->length; i++) {
+		const Backend& backend = this->backends[i];
+		if (1u < i) {
+			*p++ = ',';
+			*p++ = ' ';
+		}
+		size_t size = strlen(backend.host);
+		memcpy(p, backend.host, size);
+		p += size;
+		*p++ = ':';
+		char digits[5];
+		uint8_t count = 0u;
+		for (uint16_t port = backend.port; port || !count; port /= 10u) {
+			digits[count++] = (char) ('0' + port % 10u);
+		}
+		while (count) {
+			*p++ = digits[--count];
+		}
+		if (!backend.down) {
+			memcpy(p, " up", 3u);
+			p += 3;
+		}
+	}
+	*p = '\0';
+	return (uint16_t) (p - buffer);
+}
@@ -0,0 +1,82 @@
+/**
+ * Network servers the gateway forwards to, Semtech UDP each on its own socket. The first one is
+ * settings.host:port, the others come from a comma separated list:
+ *
+ *   "eu1.cloud.thethings.network:1700, 192.168.1.10:1700 up"
+ *
+ * Every uplink goes to all of them. Downlinks are admitted from the servers without "up": those get
+ * the PULL_DATA keepalive and their PULL_RESP feed the one downlink queue of the gateway, where the
+ * collision and duty cycle checks apply whatever the server.
+ *
+ * Per server, the acknowledgement ratio of its PUSH_DATA over the stat interval and the round trip of
+ * the acknowledged PUSH_DATA and PULL_DATA, smoothed like the TCP SRTT (RFC 6298).
+ */
+
+#include <stdint.h>
+
+#ifndef __Backends__
+#define __Backends__
+
+// Semtech UDP, PROTOCOL.TXT
+#define PROTOCOL_VERSION 0x02
+#define PUSH_DATA 0x00
+#define PUSH_ACK  0x01
+#define PULL_DATA 0x02
+#define PULL_RESP 0x03
+#define PULL_ACK  0x04
+#define TX_ACK    0x05
+
+#define BACKENDS 3 // settings.host and two more, a socket each
+#define BACKEND_HOST_LENGTH 64
+#define BACKEND_TEXT_LENGTH 74 // host (63), ":65535", " up", ", "
+#define BACKENDS_TEXT_LENGTH ((BACKENDS - 1) * BACKEND_TEXT_LENGTH + 1) // the list and its 0
+
+class Backend {
+	public:
+	char host[BACKEND_HOST_LENGTH] = {0};
+	uint16_t port = 1700u;
+	bool down = true; // PULL_RESP admitted
+
+	uint32_t upnb = 0ul;  // PUSH_DATA sent since the last stat
+	uint32_t acnb = 0ul;  // PUSH_ACK received since the last stat
+	uint16_t ackr = 0u;   // of the last stat interval, in 0.01 %
+	uint32_t rtt = 0ul;   // ms, smoothed
+	uint32_t dwnb = 0ul;  // PULL_RESP received
+	uint32_t refused = 0ul; // PULL_RESP of an uplink only server
+
+	uint16_t token = 0u;  // of the last datagram waiting for its ACK
+	uint32_t sent = 0ul;  // ms
+	bool waiting = false;
+
+	void set(const char* host, uint16_t port, bool down);
+	void push(uint8_t identifier, uint16_t token, uint32_t now); // a PUSH_DATA or PULL_DATA went out
+	bool ack(uint8_t identifier, uint16_t token, uint32_t now); // false if it acknowledges nothing sent
+	void stat(); // closes the interval of ackr
+};
+
+class Backends {
+	public:
+	Backend backends[BACKENDS];
+	uint8_t length = 1u;
+
+	/* parse:
+	 *   Description:
+	 *     Replaces the servers after the first one by a comma separated list of host:port, an " up"
+	 *     suffix refuses the downlinks of the server, the statistics of unchanged servers are kept
+	 *   Returns:
+	 *     false and the servers untouched on a syntax error or more than BACKENDS - 1 servers
+	 */
+	bool parse(const char* text);
+
+	/* print:
+	 *   Description:
+	 *     The list as parse reads it, without the first server
+	 *   Parameters:
+	 *     buffer - BACKENDS_TEXT_LENGTH bytes, null terminated
+	 */
+	uint16_t print(char* buffer) const;
+
+	uint16_t ackr() const; // the lowest of the servers, in 0.01 %
+};
+
+#endif
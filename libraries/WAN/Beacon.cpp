@@ -0,0 +1,84 @@
+#include <Beacon.h>
+
+uint64_t Beacon::due(uint64_t gps) {
+	uint64_t beacon = Beacon::after(gps);
+	if (this->last < beacon && beacon - gps <= this->lead) {
+		this->last = beacon;
+		return beacon;
+	}
+	return 0ull;
+}
+
+uint64_t Beacon::gps(uint64_t utc) {
+	return utc - (GPS_EPOCH - GPS_LEAP) * 1000000ull;
+}
+
+uint64_t Beacon::utc(uint64_t gps) {
+	return gps + (GPS_EPOCH - GPS_LEAP) * 1000000ull;
+}
+
+uint64_t Beacon::after(uint64_t gps) {
+	return (gps + BEACON_PERIOD - 1ull) / BEACON_PERIOD * BEACON_PERIOD;
+}
+
+bool Beacon::collides(uint64_t gps, uint32_t airtime) {
+	uint64_t previous = gps - gps % BEACON_PERIOD;
+	uint64_t next = previous + BEACON_PERIOD;
+	return gps < previous + BEACON_RESERVED || next - BEACON_GUARD < gps + airtime;
+}
+
+int16_t Beacon::slot(uint64_t gps) {
+	uint32_t offset = (uint32_t) (gps % BEACON_PERIOD);
+	if (offset < BEACON_RESERVED || (offset - BEACON_RESERVED) % PING_SLOT) {
+		return -1;
+	}
+	uint32_t slot = (offset - BEACON_RESERVED) / PING_SLOT;
+	return slot < PING_SLOTS ? (int16_t) slot : -1;
+}
+
+uint32_t Beacon::frequency(const Beacon::Parameters& parameters, uint64_t beacon) {
+	if (parameters.count < 2u) {
+		return parameters.first;
+	}
+	return parameters.first + parameters.step * (uint32_t) (beacon / BEACON_PERIOD % parameters.count);
+}
+
+int32_t Beacon::coordinate(int32_t micro, int32_t range) {
+	int32_t value = (int32_t) ((int64_t) micro * 0x800000ll / ((int64_t) range * 1000000ll));
+	return value < -0x800000l ? -0x800000l : (0x7FFFFFl < value ? 0x7FFFFFl : value);
+}
+
+static uint8_t* little(uint8_t* p, uint32_t value, uint8_t length) {
+	for (uint8_t i = 0u; i < length; i++) {
+		*p++ = (uint8_t) (value >> (8u * i));
+	}
+	return p;
+}
+
+uint8_t Beacon::frame(uint8_t* buffer, const Beacon::Parameters& parameters, uint64_t beacon, int32_t lat, int32_t lon) {
+	uint8_t* p = buffer;
+	memset(p, 0, parameters.rfu1);
+	p += parameters.rfu1;
+	p = little(p, (uint32_t) (beacon / 1000000ull), 4u);
+	p = little(p, Beacon::crc16(buffer, (uint8_t) (p - buffer)), 2u);
+
+	uint8_t* gwspecific = p;
+	*p++ = 0u; // InfoDesc: GPS coordinates of the antenna
+	p = little(p, (uint32_t) Beacon::coordinate(lat, 90l), 3u);
+	p = little(p, (uint32_t) Beacon::coordinate(lon, 180l), 3u);
+	memset(p, 0, parameters.rfu2);
+	p += parameters.rfu2;
+	p = little(p, Beacon::crc16(gwspecific, (uint8_t) (p - gwspecific)), 2u);
+	return (uint8_t) (p - buffer);
+}
+
+uint16_t Beacon::crc16(const uint8_t* buffer, uint8_t length) {
+	uint16_t crc = 0u;
+	for (uint8_t i = 0u; i < length; i++) {
+		crc ^= (uint16_t) buffer[i] << 8;
+		for (uint8_t bit = 0u; bit < 8u; bit++) {
+			crc = (crc & 0x8000u) ? (uint16_t) ((crc << 1) ^ 0x1021u) : (uint16_t) (crc << 1);
+		}
+	}
+	return crc;
+}
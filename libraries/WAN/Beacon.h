@@ -0,0 +1,91 @@
+/**
+ * Class B timing of LoRaWAN 1.0.3 (chapter 15): a beacon every 128 s of GPS time, at GPS seconds
+ * multiple of 128, then 2.12 s reserved for it and 4096 ping slots of 30 ms. Downlinks must also keep
+ * out of the 3 s guard before each beacon, the end devices do not listen to ping slots there.
+ *
+ * Times are GPS microseconds since 1980-01-06, Discipline maps them to the local clock.
+ * The ping slot offsets (AES of the beacon time and DevAddr) are computed by the network server, a
+ * ping slot downlink reaches the gateway as a txpk with tmms.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <Discipline.h>
+
+#ifndef __Beacon__
+#define __Beacon__
+
+#define BEACON_PERIOD 128000000ull // us
+#define BEACON_RESERVED 2120000ul  // us after the start of a beacon
+#define BEACON_GUARD 3000000ul     // us before it
+#define BEACON_PREAMBLE 10u        // symbols
+#define BEACON_LENGTH 23           // largest frame, US915
+#define PING_SLOT 30000ul          // us
+#define PING_SLOTS 4096u
+
+class Beacon {
+	public:
+	// regional parameters of the beacon, a row of WAN::Region
+	class Parameters {
+		public:
+		uint32_t first; // Hz, 0 if the region has no beacon
+		uint32_t step;  // Hz between the hopping channels
+		uint8_t count;  // channels, the beacon hops over them every period
+		uint8_t dr;     // data rate of the region
+		uint8_t rfu1;   // bytes before Time
+		uint8_t rfu2;   // bytes between GwSpecific and the second CRC
+	};
+
+	uint32_t lead = 1000000ul; // us, a beacon is queued this long before it starts
+	uint64_t last = 0ull;      // GPS us of the last queued beacon
+
+	/* due:
+	 *   Description:
+	 *     The start of the next beacon once it is less than lead away from gps, then 0 until the one after
+	 */
+	uint64_t due(uint64_t gps);
+
+	static uint64_t gps(uint64_t utc); // GPS us of a UTC us
+	static uint64_t utc(uint64_t gps); // UTC us of a GPS us
+	static uint64_t after(uint64_t gps); // start of the first beacon at or after gps
+
+	/* collides:
+	 *   Description:
+	 *     Whether a transmission from gps for airtime us ends in the guard of a beacon or starts
+	 *     before the end of its reserved time
+	 */
+	static bool collides(uint64_t gps, uint32_t airtime);
+
+	/* slot:
+	 *   Description:
+	 *     Ping slot that starts at gps, -1 if gps is not the start of a ping slot
+	 */
+	static int16_t slot(uint64_t gps);
+
+	static uint32_t frequency(const Parameters& parameters, uint64_t beacon); // Hz of the beacon that starts at beacon
+
+	/* coordinate:
+	 *   Description:
+	 *     GwSpecific latitude or longitude, 24 bits two's complement of degrees / range * 2^23
+	 *   Parameters:
+	 *     micro - micro degrees
+	 *     range - 90 for a latitude, 180 for a longitude
+	 */
+	static int32_t coordinate(int32_t micro, int32_t range);
+
+	/* frame:
+	 *   Description:
+	 *     Beacon payload: RFU | Time | CRC | InfoDesc 0 | Lat | Lng | RFU | CRC, all little endian
+	 *   Parameters:
+	 *     buffer - BEACON_LENGTH bytes
+	 *     beacon - GPS us of the beacon start
+	 *     lat, lon - micro degrees of the antenna
+	 *   Returns:
+	 *     Length of the frame
+	 */
+	static uint8_t frame(uint8_t* buffer, const Parameters& parameters, uint64_t beacon, int32_t lat, int32_t lon);
+
+	static uint16_t crc16(const uint8_t* buffer, uint8_t length); // CRC-16/XMODEM, as the packet forwarder
+};
+
+#endif
@@ -0,0 +1,171 @@
+#include <Capture.h>
+#include <string.h>
+#include <stdio.h>
+
+static uint8_t* put(uint8_t* p, uint64_t value, uint8_t bytes) {
+	for (uint8_t i = 0u; i < bytes; i++) {
+		*p++ = (uint8_t) (value >> (8u * i));
+	}
+	return p;
+}
+
+static uint64_t get(const uint8_t* p, uint8_t bytes) {
+	uint64_t value = 0ull;
+	for (uint8_t i = 0u; i < bytes; i++) {
+		value |= (uint64_t) p[i] << (8u * i);
+	}
+	return value;
+}
+
+uint16_t Capture::Record::length() const {
+	return CAPTURE_RECORD + (RF == this->kind || TX == this->kind ? CAPTURE_RADIO : 0u) + this->size;
+}
+
+bool Capture::parse(const char* text) {
+	while (' ' == *text) {
+		text++;
+	}
+	size_t length = strlen(text);
+	while (length && ' ' == text[length - 1u]) {
+		length--;
+	}
+
+	if (!length) {
+		this->mode = OFF;
+		return true;
+	}
+	if (6u == length && !strncmp(text, "spiffs", 6u)) {
+		this->mode = SPIFFS_RING;
+		return true;
+	}
+
+	const char* colon = (const char*) memchr(text, ':', length);
+	if (NULL == colon || colon == text || BACKEND_HOST_LENGTH <= (size_t) (colon - text)) {
+		return false;
+	}
+	uint32_t port = 0ul;
+	const char* p = colon + 1;
+	for (; p < text + length && '0' <= *p && *p <= '9' && port <= 65535ul; p++) {
+		port = port * 10ul + (uint32_t) (*p - '0');
+	}
+	if (p != text + length || p == colon + 1 || !port || 65535ul < port) {
+		return false;
+	}
+	memcpy(this->host, text, colon - text);
+	this->host[colon - text] = '\0';
+	this->port = (uint16_t) port;
+	this->mode = UDP;
+	return true;
+}
+
+uint16_t Capture::print(char* buffer) const {
+	switch (this->mode) {
+		case SPIFFS_RING:
+			return (uint16_t) sprintf(buffer, "spiffs");
+		case UDP:
+			return (uint16_t) sprintf(buffer, "%s:%u", this->host, this->port);
+		default:
+			buffer[0] = '\0';
+			return 0u;
+	}
+}
+
+bool Capture::add(const Record& record, uint32_t now) {
+	if (CAPTURE_BUFFER - this->used < record.length()) {
+		return false;
+	}
+	if (!this->used) {
+		this->since = now;
+	}
+	this->used += Capture::encode(record, this->buffer + this->used);
+	this->waiting += 1u;
+	this->records += 1u;
+	return true;
+}
+
+bool Capture::due(uint32_t now) const {
+	return this->used && CAPTURE_FLUSH <= now - this->since;
+}
+
+bool Capture::rotate(uint32_t size) {
+	if (this->written && CAPTURE_SEGMENT < this->written + size) {
+		this->segment ^= 1u;
+		this->sequence += 1u;
+		this->written = 0ul;
+		return true;
+	}
+	return false;
+}
+
+void Capture::clear(bool written) {
+	if (written) {
+		this->bytes += this->used;
+	} else {
+		this->dropped += this->waiting;
+	}
+	this->used = 0u;
+	this->waiting = 0u;
+}
+
+uint16_t Capture::encode(const Record& record, uint8_t* buffer) {
+	uint8_t* p = buffer;
+	*p++ = record.kind;
+	*p++ = record.backend;
+	p = put(p, record.size, 2u);
+	p = put(p, record.us, 8u);
+	if (RF == record.kind || TX == record.kind) {
+		p = put(p, record.freq, 4u);
+		p = put(p, (uint16_t) record.rssi, 2u);
+		p = put(p, (uint16_t) record.snr, 2u);
+		p = put(p, record.sbw, 2u);
+		*p++ = record.sfac;
+		*p++ = record.crat;
+	}
+	memcpy(p, record.data, record.size);
+	return (uint16_t) (p - buffer) + record.size;
+}
+
+uint16_t Capture::decode(const uint8_t* buffer, size_t size, Record* record) {
+	if (size < CAPTURE_RECORD || buffer[0] < RF || TX < buffer[0]) {
+		return 0u;
+	}
+	record->kind = (Kind) buffer[0];
+	record->backend = buffer[1];
+	record->size = (uint16_t) get(buffer + 2, 2u);
+	record->us = get(buffer + 4, 8u);
+	if (size < record->length()) {
+		return 0u;
+	}
+	const uint8_t* p = buffer + CAPTURE_RECORD;
+	if (RF == record->kind || TX == record->kind) {
+		record->freq = (uint32_t) get(p, 4u);
+		record->rssi = (int16_t) get(p + 4, 2u);
+		record->snr = (int16_t) get(p + 6, 2u);
+		record->sbw = (uint16_t) get(p + 8, 2u);
+		record->sfac = p[10];
+		record->crat = p[11];
+		p += CAPTURE_RADIO;
+	}
+	record->data = p;
+	return record->length();
+}
+
+void Capture::header(uint8_t* buffer, uint32_t sequence, uint8_t backends, const uint8_t* eui) {
+	memcpy(buffer, "LWGC", 4u);
+	buffer[4] = CAPTURE_VERSION;
+	buffer[5] = backends;
+	buffer[6] = 0u;
+	buffer[7] = 0u;
+	put(buffer + 8, sequence, 4u);
+	memcpy(buffer + 12, eui, 8u);
+}
+
+bool Capture::header(const uint8_t* buffer, size_t size, uint32_t* sequence, uint8_t* backends, uint8_t* eui) {
+	if (size < CAPTURE_HEADER || memcmp(buffer, "LWGC", 4u) || CAPTURE_VERSION != buffer[4]) {
+		return false;
+	}
+	*backends = buffer[5];
+	*sequence = (uint32_t) get(buffer + 8, 4u);
+	memcpy(eui, buffer + 12, 8u);
+	return true;
+}
@@ -0,0 +1,104 @@
+/**
+ * Capture of what goes through the gateway, to replay it on the host (tools/replay): the frames handed to
+ * WAN::onRFMPacket, the datagrams of WAN::send and WAN::read, the frames emitted by emitDownlinks.
+ *
+ * A record is 12 bytes, 12 more of radio settings for a frame received or emitted, then the raw bytes;
+ * little endian:
+ *
+ *   kind u8 | backend u8 | size u16 | ustime u64 | [freq u32 | rssi i16 | snr i16 | sbw u16 | sfac u8 | crat u8] | bytes
+ *
+ * rssi of an emitted frame is its power in dBm.
+ *
+ * Records are gathered in RAM and written CAPTURE_BUFFER bytes at a time, or after CAPTURE_FLUSH ms,
+ * behind a 20 bytes header:
+ *
+ *   "LWGC" | version u8 | backends u8 | 0 u16 | sequence u32 | EUI of the gateway
+ *
+ * "spiffs" keeps the last two segments of CAPTURE_SEGMENT bytes, /capture0.bin and /capture1.bin, the
+ * one with the highest sequence is the newest. "host:port" sends every flush as a datagram (tools/replay
+ * --collect), a sequence each, a missing one is a lost datagram.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <Backends.h>
+
+#ifndef __Capture__
+#define __Capture__
+
+#define CAPTURE_VERSION 1
+#define CAPTURE_HEADER 20
+#define CAPTURE_RECORD 12 // without the radio settings
+#define CAPTURE_RADIO 12
+#define CAPTURE_BUFFER 1024     // bytes written at once, a datagram to the collector
+#define CAPTURE_FLUSH 1000ul    // ms a record waits at most in RAM
+#define CAPTURE_SEGMENT 32768ul // bytes of a SPIFFS segment, header included
+#define CAPTURE_TEXT_LENGTH 71  // "spiffs" or host:port
+
+class Capture {
+	public:
+	enum Mode : uint8_t { OFF, SPIFFS_RING, UDP };
+	enum Kind : uint8_t { RF = 1u, UP = 2u, DOWN = 3u, TX = 4u };
+
+	class Record {
+		public:
+		Kind kind = RF;
+		uint8_t backend = 0u;   // network server of UP and DOWN
+		uint16_t size = 0u;
+		uint64_t us = 0ull;     // ustime
+		// RF and TX, the RFM settings and the signal of the frame
+		uint32_t freq = 0ul;    // Hz
+		int16_t rssi = 0;       // TX: power in dBm
+		int16_t snr = 0;        // in 0.01 dB
+		uint16_t sbw = 125u;    // kHz
+		uint8_t sfac = 7u;
+		uint8_t crat = 5u;
+		const uint8_t* data = NULL;
+
+		uint16_t length() const; // encoded, bytes included
+	};
+
+	Mode mode = OFF;
+	char host[BACKEND_HOST_LENGTH] = {0};
+	uint16_t port = 0u;
+
+	uint8_t buffer[CAPTURE_BUFFER];
+	uint16_t used = 0u;      // bytes of buffer waiting
+	uint16_t waiting = 0u;   // records in them
+	uint32_t since = 0ul;    // ms of the first record waiting
+
+	uint8_t segment = 0u;    // SPIFFS segment written
+	uint32_t written = 0ul;  // bytes in it, 0 before its header
+	uint32_t sequence = 0ul; // of the segment or of the next datagram
+
+	uint32_t records = 0ul;
+	uint32_t dropped = 0ul;  // records lost: too large, output failed
+	uint32_t bytes = 0ul;    // written out
+
+	/* parse:
+	 *   Description:
+	 *     "" turns the capture off, "spiffs" records to the SPIFFS ring, host:port streams to a collector
+	 *   Returns:
+	 *     false and the settings untouched on a syntax error
+	 */
+	bool parse(const char* text);
+	uint16_t print(char* buffer) const; // CAPTURE_TEXT_LENGTH bytes
+
+	/* add:
+	 *   Description:
+	 *     Appends a record to buffer
+	 *   Returns:
+	 *     false when it does not fit: flush first, and a record longer than CAPTURE_BUFFER never fits
+	 */
+	bool add(const Record& record, uint32_t now);
+	bool due(uint32_t now) const; // buffer has waited CAPTURE_FLUSH ms
+	bool rotate(uint32_t size);   // size more bytes overflow the segment: the next one starts, true
+	void clear(bool written);     // buffer written out or lost
+
+	static uint16_t encode(const Record& record, uint8_t* buffer);
+	static uint16_t decode(const uint8_t* buffer, size_t size, Record* record); // 0 if truncated or no record
+	static void header(uint8_t* buffer, uint32_t sequence, uint8_t backends, const uint8_t* eui);
+	static bool header(const uint8_t* buffer, size_t size, uint32_t* sequence, uint8_t* backends, uint8_t* eui);
+};
+
+#endif
@@ -0,0 +1,34 @@
+#include <WAN.h>
+
+const uint32_t WAN::Datarate::HZ[WAN::Datarate::BW_UNKNOWN] = {125000ul, 250000ul, 500000ul};
+
+WAN::Datarate::Datarate() {
+
+}
+
+WAN::Datarate::Datarate(uint8_t sfac, uint32_t hz) : sfac(sfac), sbw(BW_UNKNOWN) {
+	for (uint8_t bw = BW125; bw < BW_UNKNOWN; bw++) {
+		if (HZ[bw] == hz) {
+			this->sbw = (Bandwidth) bw;
+		}
+	}
+}
+
+WAN::Datarate::Datarate(uint8_t sfac, Bandwidth sbw) : sfac(sfac), sbw(sbw) {
+
+}
+
+uint8_t WAN::Datarate::print(char* buffer) const {
+	static const char* BANDWIDTH[BW_UNKNOWN + 1] = {"125", "250", "500", "?"}; // like the packet forwarder
+	char* p = buffer;
+	*p++ = 'S';
+	*p++ = 'F';
+	if (10u <= this->sfac) {
+		*p++ = '1';
+	}
+	*p++ = (char) ('0' + this->sfac % 10u);
+	*p++ = 'B';
+	*p++ = 'W';
+	strcpy(p, BANDWIDTH[this->sbw]);
+	return (uint8_t) (p - buffer + strlen(p));
+}
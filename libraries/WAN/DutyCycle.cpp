@@ -0,0 +1,72 @@
+#include <DutyCycle.h>
+
+uint32_t DutyCycle::airtime(uint8_t sfac, uint32_t sbw, uint8_t crat, uint16_t plength, bool crc, uint16_t size) {
+	// low data rate optimization when a symbol lasts more than 16 ms, SF11 and SF12 at 125 kHz, SF12 at 250 kHz
+	uint32_t de = (1000000ull << sfac) / sbw > 16000ull ? 1ul : 0ul;
+	int32_t bits = 8l * size - 4l * sfac + 28l + (crc ? 16l : 0l);
+	int32_t bitsPerBlock = 4l * (sfac - 2l * de);
+	uint32_t blocks = 0 < bits ? (bits + bitsPerBlock - 1) / bitsPerBlock : 0ul;
+	uint32_t payload = 8ul + blocks * crat;
+
+	// (preamble + 4.25 + payload) symbols of 2^SF / BW seconds, in quarters of a symbol
+	uint64_t quarters = 4ull * (plength + payload) + 17ull;
+	return (uint32_t) ((quarters << sfac) * 1000000ull / (4ull * sbw));
+}
+
+DutyCycle::DutyCycle(uint32_t window) : window(window), bucket(window / DUTY_BUCKETS) {
+	this->reset();
+}
+
+void DutyCycle::reset() {
+	memset(this->buckets, 0, sizeof(this->buckets));
+	memset(this->sums, 0, sizeof(this->sums));
+}
+
+void DutyCycle::advance(uint64_t now) {
+	uint64_t current = now / this->bucket;
+	if (current <= this->head) {
+		return;
+	}
+	if (DUTY_BUCKETS < current - this->head) {
+		this->reset();
+	} else {
+		for (uint64_t b = this->head + 1ull; b <= current; b++) {
+			uint8_t slot = (uint8_t) (b % (DUTY_BUCKETS + 1u));
+			for (uint8_t band = 0u; band < DUTY_BANDS; band++) {
+				this->sums[band] -= this->buckets[band][slot];
+				this->buckets[band][slot] = 0u;
+			}
+		}
+	}
+	this->head = current;
+}
+
+uint32_t DutyCycle::used(uint8_t band, uint64_t now) {
+	this->advance(now);
+	return this->sums[band];
+}
+
+bool DutyCycle::allows(uint8_t band, uint64_t now, uint32_t airtime, uint16_t duty) {
+	if (0u == duty) {
+		return true;
+	}
+	uint32_t budget = (uint32_t) ((uint64_t) this->window * duty / 10000ull);
+	return this->used(band, now) + (airtime + 999ul) / 1000ul <= budget;
+}
+
+void DutyCycle::add(uint8_t band, uint64_t now, uint32_t airtime) {
+	this->advance(now);
+	uint8_t slot = (uint8_t) (this->head % (DUTY_BUCKETS + 1u));
+	uint32_t ms = (airtime + 999ul) / 1000ul;
+	this->buckets[band][slot] += ms;
+	this->sums[band] += ms;
+}
+
+uint16_t DutyCycle::utilization(uint8_t band, uint64_t now, uint16_t duty) {
+	if (0u == duty) {
+		return 0u;
+	}
+	uint32_t budget = (uint32_t) ((uint64_t) this->window * duty / 10000ull);
+	uint64_t utilization = 10000ull * this->used(band, now) / budget;
+	return utilization < 0xFFFFull ? (uint16_t) utilization : 0xFFFFu;
+}
@@ -0,0 +1,48 @@
+/**
+ * Air-time ledger of the downlinks: time on air of a LoRa frame and, per sub-band, the TX time of the
+ * last hour (ETSI EN 300 220 measures the duty cycle over one hour).
+ *
+ * The window is a ring of DUTY_BUCKETS buckets plus the current one, each bucket holds the milliseconds
+ * of the transmissions that started in it. Queries are O(1) once the ring is advanced, a TX counts for
+ * up to one bucket longer than the window, never shorter.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef __DutyCycle__
+#define __DutyCycle__
+
+#define DUTY_BANDS 6     // sub-bands of a region
+#define DUTY_BUCKETS 30  // 2 minutes each for one hour
+
+class DutyCycle {
+	public:
+	uint32_t window = 3600000ul; // ms
+	uint32_t bucket = 120000ul;  // ms, window / DUTY_BUCKETS
+	uint64_t head = 0ull;        // number of the current bucket since 0 ms
+	uint32_t buckets[DUTY_BANDS][DUTY_BUCKETS + 1]; // ms, a 10 % band fills 12 s of a bucket, a continuous TX all of it
+	uint32_t sums[DUTY_BANDS];
+
+	/* airtime:
+	 *   Description:
+	 *     Time on air of a LoRa frame with an explicit header, SX1276 datasheet 4.1.1.7
+	 *   Parameters:
+	 *     sbw - bandwidth in Hz
+	 *     crat - coding rate denominator, 5 to 8
+	 *     size - PHYPayload length in bytes
+	 *   Returns:
+	 *     Microseconds
+	 */
+	static uint32_t airtime(uint8_t sfac, uint32_t sbw, uint8_t crat, uint16_t plength, bool crc, uint16_t size);
+
+	DutyCycle(uint32_t window = 3600000ul);
+	void reset();
+	uint32_t used(uint8_t band, uint64_t now); // ms of TX in the window
+	bool allows(uint8_t band, uint64_t now, uint32_t airtime, uint16_t duty); // airtime in us, duty in 0.01 %, 0 for none
+	void add(uint8_t band, uint64_t now, uint32_t airtime); // airtime in us
+	uint16_t utilization(uint8_t band, uint64_t now, uint16_t duty); // used budget in 0.01 %
+	void advance(uint64_t now); // drops the buckets that left the window
+};
+
+#endif
@@ -0,0 +1,239 @@
+#include <Filters.h>
+#include <string.h>
+
+static const uint8_t NWKID_BITS[8] = {6u, 6u, 9u, 11u, 12u, 13u, 15u, 17u};
+
+uint8_t Filters::netid(uint32_t netid, uint32_t* prefix) {
+	uint8_t type = (uint8_t) ((netid >> 21) & 0x07u);
+	uint8_t bits = NWKID_BITS[type];
+	uint32_t nwkid = netid & ((1ul << bits) - 1ul);
+	// type prefix: type ones then a zero
+	uint32_t value = (((1ul << type) - 1ul) << 1) << bits | nwkid;
+	uint8_t length = (uint8_t) (type + 1u + bits);
+	*prefix = value << (32u - length);
+	return length;
+}
+
+bool Filters::matches(const Filters::Rule& rule, const FrameView& frame) {
+	switch (rule.kind) {
+		case DEVADDR: {
+			return frame.data() && frame.uplink() && rule.low <= frame.devAddr && frame.devAddr <= rule.high;
+		}
+		case NETID: {
+			uint32_t prefix = 0ul;
+			uint8_t bits = Filters::netid((uint32_t) rule.low, &prefix);
+			return frame.data() && frame.uplink() && 0ul == ((frame.devAddr ^ prefix) >> (32u - bits));
+		}
+		case JOINEUI: {
+			return frame.join() && rule.low <= frame.joinEui && frame.joinEui <= rule.high;
+		}
+		default: {
+			return !frame.valid || !frame.uplink();
+		}
+	}
+}
+
+bool Filters::forward(const FrameView& frame) {
+	bool allowData = false, allowJoin = false;
+	for (uint8_t i = 0u; i < this->length; i++) {
+		Rule& rule = this->rules[i];
+		if (Filters::matches(rule, frame)) {
+			rule.hits++;
+			return rule.allow;
+		}
+		if (rule.allow) {
+			allowData = allowData || DEVADDR == rule.kind || NETID == rule.kind;
+			allowJoin = allowJoin || JOINEUI == rule.kind;
+		}
+	}
+	if ((allowData && frame.data()) || (allowJoin && frame.join())) {
+		this->unmatched++;
+		return false;
+	}
+	return true;
+}
+
+uint32_t Filters::dropped() const {
+	uint32_t dropped = this->unmatched;
+	for (uint8_t i = 0u; i < this->length; i++) {
+		if (!this->rules[i].allow) {
+			dropped += this->rules[i].hits;
+		}
+	}
+	return dropped;
+}
+
+static const char* spaces(const char* p) {
+	while (' ' == *p) {
+		p++;
+	}
+	return p;
+}
+
+static const char* word(const char* p, const char* word) {
+	size_t length = strlen(word);
+	return strncmp(p, word, length) ? NULL : p + length;
+}
+
+// up to digits hexadecimal digits, NULL without any
+static const char* hex(const char* p, uint8_t digits, uint64_t* value) {
+	*value = 0ull;
+	uint8_t i = 0u;
+	for (; i < digits; i++, p++) {
+		char c = *p;
+		uint8_t nibble = 0u;
+		if ('0' <= c && c <= '9') {
+			nibble = (uint8_t) (c - '0');
+		} else if ('a' <= c && c <= 'f') {
+			nibble = (uint8_t) (c - 'a' + 10);
+		} else if ('A' <= c && c <= 'F') {
+			nibble = (uint8_t) (c - 'A' + 10);
+		} else {
+			break;
+		}
+		*value = (*value << 4) | nibble;
+	}
+	return i ? p : NULL;
+}
+
+static const char* parseRule(const char* p, Filters::Rule* rule) {
+	const char* next = NULL;
+	if (NULL != (next = word(p, "allow "))) {
+		rule->allow = true;
+	} else if (NULL != (next = word(p, "deny "))) {
+		rule->allow = false;
+	} else {
+		return NULL;
+	}
+	p = spaces(next);
+
+	if (NULL != (next = word(p, "devaddr "))) {
+		rule->kind = Filters::DEVADDR;
+		uint64_t bits = 32ull;
+		if (NULL == (p = hex(spaces(next), 8u, &rule->low))) {
+			return NULL;
+		}
+		if ('/' == *p) {
+			p = word(p, "/");
+			const char* end = p;
+			for (bits = 0ull; '0' <= *end && *end <= '9'; end++) {
+				bits = bits * 10ull + (uint64_t) (*end - '0');
+			}
+			if (end == p || 32ull < bits) {
+				return NULL;
+			}
+			p = end;
+		}
+		uint64_t host = bits < 32ull ? (0xFFFFFFFFull >> bits) : 0ull;
+		rule->low &= ~host & 0xFFFFFFFFull;
+		rule->high = rule->low | host;
+	} else if (NULL != (next = word(p, "netid "))) {
+		rule->kind = Filters::NETID;
+		if (NULL == (p = hex(spaces(next), 6u, &rule->low))) {
+			return NULL;
+		}
+		rule->high = rule->low;
+	} else if (NULL != (next = word(p, "joineui "))) {
+		rule->kind = Filters::JOINEUI;
+		if (NULL == (p = hex(spaces(next), 16u, &rule->low))) {
+			return NULL;
+		}
+		rule->high = rule->low;
+		if ('-' == *p && (NULL == (p = hex(p + 1, 16u, &rule->high)) || rule->high < rule->low)) {
+			return NULL;
+		}
+	} else if (NULL != (next = word(p, "foreign"))) {
+		rule->kind = Filters::FOREIGN;
+		rule->low = rule->high = 0ull;
+		p = next;
+	} else {
+		return NULL;
+	}
+	return spaces(p);
+}
+
+bool Filters::parse(const char* text) {
+	Rule parsed[FILTER_RULES];
+	uint8_t length = 0u;
+	const char* p = spaces(text);
+	while (*p) {
+		if (FILTER_RULES <= length || NULL == (p = parseRule(p, &parsed[length]))) {
+			return false;
+		}
+		length++;
+		if (',' == *p) {
+			p = spaces(p + 1);
+		} else if (*p) {
+			return false;
+		}
+	}
+
+	for (uint8_t i = 0u; i < length; i++) {
+		for (uint8_t j = 0u; j < this->length; j++) {
+			const Rule& old = this->rules[j];
+			if (old.kind == parsed[i].kind && old.allow == parsed[i].allow && old.low == parsed[i].low && old.high == parsed[i].high) {
+				parsed[i].hits = old.hits;
+			}
+		}
+	}
+	memcpy(this->rules, parsed, sizeof(parsed));
+	this->length = length;
+	return true;
+}
+
+static char* text(char* p, const char* value) {
+	while (*value) {
+		*p++ = *value++;
+	}
+	return p;
+}
+
+static char* hex(char* p, uint64_t value, uint8_t digits) {
+	for (uint8_t i = digits; i > 0u; i--) {
+		p[i - 1u] = "0123456789ABCDEF"[value & 0x0Fu];
+		value >>= 4;
+	}
+	return p + digits;
+}
+
+uint16_t Filters::print(char* buffer) const {
+	char* p = buffer;
+	for (uint8_t i = 0u; i < this->length; i++) {
+		const Rule& rule = this->rules[i];
+		if (i) {
+			p = text(p, ", ");
+		}
+		p = text(p, rule.allow ? "allow " : "deny ");
+		switch (rule.kind) {
+			case DEVADDR: {
+				uint8_t bits = 32u;
+				while (bits && ((rule.high - rule.low) >> (32u - bits))) {
+					bits--;
+				}
+				p = hex(text(p, "devaddr "), rule.low, 8u);
+				if (bits < 32u) {
+					*p++ = '/';
+					if (bits >= 10u) {
+						*p++ = (char) ('0' + bits / 10u);
+					}
+					*p++ = (char) ('0' + bits % 10u);
+				}
+			} break;
+			case NETID: {
+				p = hex(text(p, "netid "), rule.low, 6u);
+			} break;
+			case JOINEUI: {
+				p = hex(text(p, "joineui "), rule.low, 16u);
+				if (rule.high != rule.low) {
+					*p++ = '-';
+					p = hex(p, rule.high, 16u);
+				}
+			} break;
+			default: {
+				p = text(p, "foreign");
+			} break;
+		}
+	}
+	*p = '\0';
+	return (uint16_t) (p - buffer);
+}
@@ -0,0 +1,72 @@
+/**
+ * Forwarding filters of the received frames, checked on the FrameView before anything is allocated or
+ * serialized for the network server.
+ *
+ * A rule is a range of DevAddr or JoinEUI, the NetID rules are the DevAddr prefix of the NetID
+ * (LoRaWAN Backend Interfaces 1.0, 13). Rules are checked in order, the first one that matches the
+ * frame decides and counts a hit. A frame no rule matches is forwarded, unless the list has allow
+ * rules for its kind (DevAddr and NetID for data frames, JoinEUI for JoinRequests).
+ *
+ *   "deny foreign, allow netid 000013, allow devaddr 26011B00/24, allow joineui 70B3D57ED0000000-70B3D57ED0FFFFFF"
+ *
+ * foreign is every frame that is not a LoRaWAN R1 uplink: other modulations sharing the sync word,
+ * downlinks of neighbour gateways, proprietary frames.
+ */
+
+#include <stdint.h>
+#include <FrameView.h>
+
+#ifndef __Filters__
+#define __Filters__
+
+#define FILTER_RULES 8
+#define FILTER_TEXT_LENGTH 50 // "allow joineui 70B3D57ED0000000-70B3D57ED0FFFFFF, "
+
+class Filters {
+	public:
+	enum Kind : uint8_t { DEVADDR, NETID, JOINEUI, FOREIGN };
+
+	class Rule {
+		public:
+		uint64_t low = 0ull;  // DevAddr, NetID or JoinEUI
+		uint64_t high = 0ull; // last DevAddr or JoinEUI of the range
+		uint32_t hits = 0ul;
+		Kind kind = FOREIGN;
+		bool allow = false;
+	};
+
+	Rule rules[FILTER_RULES];
+	uint8_t length = 0u;
+	uint32_t unmatched = 0ul; // frames dropped because no allow rule of their kind matched
+
+	/* parse:
+	 *   Description:
+	 *     Replaces the rules by a comma separated list, hit counters of unchanged rules are kept
+	 *   Returns:
+	 *     false and the rules untouched on a syntax error or more than FILTER_RULES rules
+	 */
+	bool parse(const char* text);
+
+	/* print:
+	 *   Description:
+	 *     The list as parse reads it
+	 *   Parameters:
+	 *     buffer - FILTER_RULES * FILTER_TEXT_LENGTH bytes, null terminated
+	 */
+	uint16_t print(char* buffer) const;
+
+	bool forward(const FrameView& frame); // counts the hits
+	uint32_t dropped() const; // frames dropped since the start
+
+	static bool matches(const Rule& rule, const FrameView& frame);
+
+	/* netid:
+	 *   Description:
+	 *     DevAddr prefix of the devices of a NetID, type (3 MSB) then NwkID (LSB of the ID)
+	 *   Returns:
+	 *     Number of prefix bits, 7 to 25, the prefix is in the most significant bits of prefix
+	 */
+	static uint8_t netid(uint32_t netid, uint32_t* prefix);
+};
+
+#endif
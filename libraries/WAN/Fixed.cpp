@@ -0,0 +1,99 @@
+#include <Fixed.h>
+
+static const uint32_t POWERS_OF_TEN[10] = {1ul, 10ul, 100ul, 1000ul, 10000ul, 100000ul, 1000000ul, 10000000ul, 100000000ul, 1000000000ul};
+static const uint32_t POWERS_OF_FIVE[10] = {1ul, 5ul, 25ul, 125ul, 625ul, 3125ul, 15625ul, 78125ul, 390625ul, 1953125ul};
+
+uint8_t Fixed::format(char* buffer, int32_t value, uint8_t decimals) {
+	char* p = buffer;
+	uint32_t magnitude = (uint32_t) value;
+	if (value < 0) {
+		*p++ = '-';
+		magnitude = 0ul - magnitude;
+	}
+
+	// least significant first, at least one digit before the point
+	char digits[10];
+	uint8_t length = 0u;
+	do {
+		digits[length++] = (char) ('0' + magnitude % 10u);
+		magnitude /= 10u;
+	} while (magnitude);
+	while (length <= decimals) {
+		digits[length++] = '0';
+	}
+
+	uint8_t zeros = 0u;
+	while (zeros < decimals && '0' == digits[zeros]) {
+		zeros++;
+	}
+
+	for (uint8_t i = length; i > decimals; i--) {
+		*p++ = digits[i - 1u];
+	}
+	if (zeros < decimals) {
+		*p++ = '.';
+		for (uint8_t i = decimals; i > zeros; i--) {
+			*p++ = digits[i - 1u];
+		}
+	}
+	*p = '\0';
+	return (uint8_t) (p - buffer);
+}
+
+uint8_t Fixed::format(char* buffer, uint64_t value) {
+	char digits[20];
+	uint8_t length = 0u;
+	do {
+		digits[length++] = (char) ('0' + value % 10u);
+		value /= 10u;
+	} while (value);
+	for (uint8_t i = 0u; i < length; i++) {
+		buffer[i] = digits[length - 1u - i];
+	}
+	buffer[length] = '\0';
+	return length;
+}
+
+int32_t Fixed::scale(double value, uint8_t decimals) {
+	uint64_t bits = 0ull;
+	memcpy(&bits, &value, sizeof(bits));
+	bool negative = bits >> 63;
+	int exponent = (int) ((bits >> 52) & 0x7FFu);
+	if (0 == exponent || 0x7FF == exponent) {
+		return 0l; // zero, subnormal, infinity or NaN
+	}
+
+	// value = mantissa * 2^exponent, with 42 of the 53 bits so that mantissa * 5^9 fits in 64
+	uint64_t mantissa = ((bits & 0xFFFFFFFFFFFFFull) | 0x10000000000000ull) >> 11;
+	exponent -= 1075 - 11;
+
+	// value * 10^decimals = mantissa * 5^decimals * 2^(exponent + decimals)
+	uint64_t product = mantissa * POWERS_OF_FIVE[decimals];
+	int shift = exponent + decimals;
+	uint64_t magnitude = 0ull;
+	if (0 <= shift) {
+		if (32 <= shift) {
+			return 0l;
+		}
+		magnitude = product << shift;
+		if ((magnitude >> shift) != product) {
+			return 0l;
+		}
+	} else if (-64 < shift) {
+		shift = -shift;
+		magnitude = (product + (1ull << (shift - 1))) >> shift;
+	}
+
+	if (0x7FFFFFFFull < magnitude) {
+		return 0l;
+	}
+	return negative ? -(int32_t) magnitude : (int32_t) magnitude;
+}
+
+int32_t Fixed::fromJSON(JsonVariantConst value, uint8_t decimals) {
+	if (value.is<long>()) {
+		int64_t scaled = (int64_t) value.as<long>() * POWERS_OF_TEN[decimals];
+		return (-0x7FFFFFFFll <= scaled && scaled <= 0x7FFFFFFFll) ? (int32_t) scaled : 0l;
+	}
+	return Fixed::scale(value.as<double>(), decimals);
+}
@@ -0,0 +1,61 @@
+/**
+ * Fixed point numbers of the packet path: integers with an implied number of decimals.
+ * 868100000 with 6 decimals is 868.1 MHz, -1150 with 2 decimals is -11.5 dB.
+ *
+ * No floating point operation in here, the ESP8266 has no FPU and each of them is a libgcc call.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#define ARDUINOJSON_USE_DOUBLE 1
+#define ARDUINOJSON_FAST_FLOAT 1
+#include <ArduinoJson.h>
+
+#ifndef __Fixed__
+#define __Fixed__
+
+#define FIXED_LENGTH 13 // "-2147.483648" and the trailing 0
+#define FIXED_LENGTH_64 21 // "18446744073709551615" and the trailing 0
+
+class Fixed {
+	public:
+	/* format:
+	 *   Description:
+	 *     Writes value / 10^decimals in decimal, without the trailing zeros of the fraction
+	 *     (868100000, 6) -> "868.1", (-1125, 2) -> "-11.25", (10000, 2) -> "100"
+	 *   Parameters:
+	 *     buffer - FIXED_LENGTH bytes, null terminated
+	 *     decimals - 0 to 9
+	 *   Returns:
+	 *     Number of characters written, not including the null terminator
+	 */
+	static uint8_t format(char* buffer, int32_t value, uint8_t decimals);
+
+	/* format:
+	 *   Description:
+	 *     Writes a 64 bits integer in decimal, JSON integers of ArduinoJson are 32 bits here (tmms)
+	 *   Parameters:
+	 *     buffer - FIXED_LENGTH_64 bytes, null terminated
+	 *   Returns:
+	 *     Number of characters written, not including the null terminator
+	 */
+	static uint8_t format(char* buffer, uint64_t value);
+
+	/* scale:
+	 *   Description:
+	 *     value * 10^decimals rounded to the nearest integer, computed from the bits of the double
+	 *   Parameters:
+	 *     decimals - 0 to 9
+	 *   Returns:
+	 *     The fixed point value, 0 if it does not fit in 32 bits or value is not a number
+	 */
+	static int32_t scale(double value, uint8_t decimals);
+
+	/* fromJSON:
+	 *   Description:
+	 *     scale of a JSON number, ArduinoJson keeps integers as integers and the others as doubles
+	 */
+	static int32_t fromJSON(JsonVariantConst value, uint8_t decimals);
+};
+
+#endif
@@ -22,13 +22,15 @@ WAN::Message::Up::~Up() {
 
 // //////////////////////////////////////////////////////////////////////////////////////
 // Stat Message
-WAN::Message::Stat::Stat(WAN* wan) : WAN::Message::Up(wan, 512u) {
+WAN::Message::Stat::Stat(WAN* wan, uint16_t ackr) : WAN::Message::Up(wan, 512u) {
 	this->header[3]  = PUSH_DATA;
 	JsonObject stat = this->json->createNestedObject("stat");
 	// time | string | UTC 'system' time of the gateway, ISO 8601 'expanded' format
-	// char timestamp[32] = {0};
-	// TODO:: sprintf(timestamp, "%04d-%02d-%02d %02d:%02d:%02d CET", year(), month(), day(), hour(), minute(), second());
-	// stat["time"] = String(timestamp);
+	if (clock64.discipline.synced()) {
+		char time[28];
+		Discipline::iso8601(time, clock64.discipline.utc(clock64.ustime()), false);
+		stat["time"] = time; // char*, copied
+	}
 	// lati | number | GPS latitude of the gateway in degree (float, N is +)
 	stat["lati"] = wan->settings.lat;
 	// long | number | GPS latitude of the gateway in degree (float, E is +)
@@ -42,7 +44,8 @@ WAN::Message::Stat::Stat(WAN* wan) : WAN::Message::Up(wan, 512u) {
 	// rxfw | number | Number of radio packets forwarded (unsigned integer)
 	stat["rxfw"] = wan->statistics.rxfw;
 	// ackr | number | Percentage of upstream datagrams that were acknowledged
-	stat["ackr"] = wan->statistics.ackr;
+	char text[FIXED_LENGTH];
+	stat["ackr"] = serialized(text, Fixed::format(text, ackr, 2u));
 	// dwnb | number | Number of downlink datagrams received (unsigned integer)
 	stat["dwnb"] = wan->statistics.dwnb;
 	// txnb | number | Number of packets emitted (unsigned integer)
@@ -51,7 +54,7 @@ WAN::Message::Stat::Stat(WAN* wan) : WAN::Message::Up(wan, 512u) {
 
 // //////////////////////////////////////////////////////////////////////////////////////
 // RxPk Message
-WAN::Message::RxPk::RxPk(WAN* wan) : WAN::Message::Up(wan, 768u) {
+WAN::Message::RxPk::RxPk(WAN* wan, uint8_t count) : WAN::Message::Up(wan, 768u * count) {
 	this->header[3] = PUSH_DATA;
 	this->json->createNestedArray("rxpk");
 }
@@ -59,18 +62,22 @@ WAN::Message::RxPk::RxPk(WAN* wan) : WAN::Message::Up(wan, 768u) {
 void WAN::Message::RxPk::add(WAN::RFData* data) {
 	JsonArray rxpk = (*this->json)["rxpk"];
 	JsonObject pkdata = rxpk.createNestedObject();
-	// tmms | number | GPS time of pkt RX, number of milliseconds since 06.Jan.1980
-	// char timestamp[32] = {0};
-	// sprintf(timestamp, "%04d-%02d-%02dT%02d:%02d:%02d.000000Z", year(), month(), day(), hour(), minute(), second());
-	// time | string | UTC time of pkt RX, us precision, ISO 8601 'compact' format
-	// pkdata["time"] = String(timestamp);
-	// TODO:: ???
+	uint64_t local = data->local;
+	if (clock64.discipline.synced()) {
+		uint64_t utc = clock64.discipline.utc(local);
+		// tmms | number | GPS time of pkt RX, number of milliseconds since 06.Jan.1980
+		char tmms[FIXED_LENGTH_64];
+		pkdata["tmms"] = serialized(tmms, Fixed::format(tmms, Discipline::tmms(utc)));
+		// time | string | UTC time of pkt RX, us precision, ISO 8601 'compact' format
+		char time[28];
+		Discipline::iso8601(time, utc, true);
+		pkdata["time"] = time; // char*, copied
+	}
 	// tmst | number | Internal timestamp of "RX finished" event (32b unsigned)
-	pkdata["tmst"] = micros();
+	pkdata["tmst"] = (uint32_t) local; // the low 32 bits are micros()
 	// freq | number | RX central frequency in MHz (unsigned float, Hz precision)
-	// char cfreq[12] = {0};
-	// ftoa((double)freq / 1000000, cfreq, 6);
-	pkdata["freq"] = (double) data->settings.freq.curr / 1000000.0;
+	char freq[FIXED_LENGTH];
+	pkdata["freq"] = serialized(freq, Fixed::format(freq, data->settings.freq.curr, 6u));
 	// chan | number | Concentrator "IF" channel used for RX (unsigned integer)
 	pkdata["chan"] = 0;
 	// rfch | number | Concentrator "RF chain" used for RX (unsigned integer)
@@ -81,13 +88,17 @@ void WAN::Message::RxPk::add(WAN::RFData* data) {
 	pkdata["modu"] = "LORA";
 	// datr | string | LoRa datarate identifier (eg. SF12BW500)
 	// datr | number | FSK datarate (unsigned, in bits per second)
-	pkdata["datr"] = "SF" + String(data->settings.sfac) + "BW" + String(data->settings.sbw / 1000); // TODO:: find a better way ?
+	char datr[DATARATE_LENGTH];
+	WAN::Datarate(data->settings.sfac, data->settings.sbw).print(datr);
+	pkdata["datr"] = datr; // char*, copied
 	// codr | string | LoRa ECC coding rate identifier
-	pkdata["codr"] = "4/" + String(data->settings.crat);
+	char codr[4] = {'4', '/', (char) ('0' + data->settings.crat), '\0'};
+	pkdata["codr"] = codr;
 	// rssi | number | RSSI in dBm (signed integer, 1 dB precision)
 	pkdata["rssi"] = data->rssi;
 	// lsnr | number | Lora SNR ratio in dB (signed float, 0.1 dB precision)
-	pkdata["lsnr"] = data->snr;
+	char lsnr[FIXED_LENGTH];
+	pkdata["lsnr"] = serialized(lsnr, Fixed::format(lsnr, data->snr, 2u));
 	// size | number | RF packet payload size in bytes (unsigned integer)
 	pkdata["size"] = data->packet->size;
 	// data | string | Base64 encoded RF packet payload, padded
@@ -116,6 +127,7 @@ WAN::Message::TxAck::TxAck(WAN* wan, String error) : WAN::Message::Up(wan, 512u)
 	// TX_FREQ           | Rejected because requested frequency is not supported by TX RF chain
 	// TX_POWER          | Rejected because requested power is not supported by gateway
 	// GPS_UNLOCKED      | Rejected because GPS is unlocked, so GPS timestamp cannot be used
+	// TX_DUTY_CYCLE     | Rejected because the air time budget of the sub-band is exhausted (not in PROTOCOL.TXT)
 	txpk_ack["error"] = error;
 }
 
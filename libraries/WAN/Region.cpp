@@ -0,0 +1,164 @@
+#include <WAN.h>
+
+/**
+ * LoRaWAN 1.0.3 Regional Parameters (rev A), what a gateway needs to check a downlink:
+ * default channels, RX2, max EIRP and duty cycle of the sub-bands and SF/BW/max MACPayload of each
+ * data rate, and the channel and frame layout of the Class B beacon.
+ * AS923 with the dwell time limitation off and the 1 % of most of its countries, IN865 defaults are
+ * not evenly spaced (865.0625, 865.4025, 865.985 MHz) so they are left to the band.
+ * PROGMEM: only the region picked by load is ever in RAM.
+ */
+
+#define LORA(SF, BW, MAXPL) { SF, WAN::Datarate::BW, MAXPL }
+#define RFU { 0u, WAN::Datarate::BW_UNKNOWN, 0u }
+
+static constexpr WAN::Region REGIONS[] PROGMEM = {
+	{
+		"EU868", { 868100000ul, 200000ul, 3u }, { 0ul, 0ul, 0u }, 869525000ul, 0u,
+		{
+			{ 863000000ul, 865000000ul, 14, 10u },
+			{ 865000000ul, 868000000ul, 14, 100u },
+			{ 868000000ul, 868600000ul, 14, 100u },
+			{ 868700000ul, 869200000ul, 14, 10u },
+			{ 869400000ul, 869650000ul, 27, 1000u },
+			{ 869700000ul, 870000000ul, 14, 100u },
+		},
+		{
+			LORA(12u, BW125, 59u), LORA(11u, BW125, 59u), LORA(10u, BW125, 59u), LORA(9u, BW125, 123u),
+			LORA(8u, BW125, 230u), LORA(7u, BW125, 230u), LORA(7u, BW250, 230u), RFU, // DR7 FSK
+			RFU, RFU, RFU, RFU, RFU, RFU, RFU, RFU,
+		},
+		{ 869525000ul, 0ul, 1u, 3u, 2u, 0u },
+	},
+	{
+		"US915", { 902300000ul, 200000ul, 64u }, { 923300000ul, 600000ul, 8u }, 923300000ul, 8u,
+		{
+			{ 902000000ul, 928000000ul, 30, 0u },
+		},
+		{
+			LORA(10u, BW125, 19u), LORA(9u, BW125, 61u), LORA(8u, BW125, 133u), LORA(7u, BW125, 250u),
+			LORA(8u, BW500, 250u), RFU, RFU, RFU,
+			LORA(12u, BW500, 61u), LORA(11u, BW500, 137u), LORA(10u, BW500, 250u), LORA(9u, BW500, 250u),
+			LORA(8u, BW500, 250u), LORA(7u, BW500, 250u), RFU, RFU,
+		},
+		{ 923300000ul, 600000ul, 8u, 8u, 5u, 3u },
+	},
+	{
+		"AU915", { 915200000ul, 200000ul, 64u }, { 923300000ul, 600000ul, 8u }, 923300000ul, 8u,
+		{
+			{ 915000000ul, 928000000ul, 30, 0u },
+		},
+		{
+			LORA(12u, BW125, 59u), LORA(11u, BW125, 59u), LORA(10u, BW125, 59u), LORA(9u, BW125, 123u),
+			LORA(8u, BW125, 230u), LORA(7u, BW125, 230u), LORA(8u, BW500, 230u), RFU,
+			LORA(12u, BW500, 41u), LORA(11u, BW500, 117u), LORA(10u, BW500, 230u), LORA(9u, BW500, 230u),
+			LORA(8u, BW500, 230u), LORA(7u, BW500, 230u), RFU, RFU,
+		},
+		{ 923300000ul, 600000ul, 8u, 8u, 5u, 3u },
+	},
+	{
+		"AS923", { 923200000ul, 200000ul, 2u }, { 0ul, 0ul, 0u }, 923200000ul, 2u,
+		{
+			{ 915000000ul, 928000000ul, 16, 100u },
+		},
+		{
+			LORA(12u, BW125, 59u), LORA(11u, BW125, 59u), LORA(10u, BW125, 59u), LORA(9u, BW125, 123u),
+			LORA(8u, BW125, 230u), LORA(7u, BW125, 230u), LORA(7u, BW250, 230u), RFU, // DR7 FSK
+			RFU, RFU, RFU, RFU, RFU, RFU, RFU, RFU,
+		},
+		{ 923400000ul, 0ul, 1u, 3u, 2u, 0u },
+	},
+	{
+		"IN865", { 0ul, 0ul, 0u }, { 0ul, 0ul, 0u }, 866550000ul, 2u,
+		{
+			{ 865000000ul, 867000000ul, 30, 0u },
+		},
+		{
+			LORA(12u, BW125, 59u), LORA(11u, BW125, 59u), LORA(10u, BW125, 59u), LORA(9u, BW125, 123u),
+			LORA(8u, BW125, 230u), LORA(7u, BW125, 230u), RFU, RFU, // DR7 FSK
+			RFU, RFU, RFU, RFU, RFU, RFU, RFU, RFU,
+		},
+		{ 866550000ul, 0ul, 1u, 4u, 1u, 3u },
+	},
+	{
+		"KR920", { 922100000ul, 200000ul, 3u }, { 0ul, 0ul, 0u }, 921900000ul, 0u,
+		{
+			{ 920900000ul, 923300000ul, 23, 0u },
+		},
+		{
+			LORA(12u, BW125, 59u), LORA(11u, BW125, 59u), LORA(10u, BW125, 59u), LORA(9u, BW125, 123u),
+			LORA(8u, BW125, 230u), LORA(7u, BW125, 230u), RFU, RFU,
+			RFU, RFU, RFU, RFU, RFU, RFU, RFU, RFU,
+		},
+		{ 923100000ul, 0ul, 1u, 3u, 2u, 0u },
+	},
+};
+
+#define REGIONS_LENGTH (sizeof(REGIONS) / sizeof(REGIONS[0]))
+
+bool WAN::Region::load(const char* name, WAN::Region* region) {
+	for (uint8_t i = 0u; i < REGIONS_LENGTH; i++) {
+		if (!strcmp_P(name, REGIONS[i].name)) {
+			memcpy_P(region, &REGIONS[i], sizeof(WAN::Region));
+			return true;
+		}
+	}
+	return false;
+}
+
+String WAN::Region::names() {
+	String names = "";
+	for (uint8_t i = 0u; i < REGIONS_LENGTH; i++) {
+		if (i) {
+			names += " ";
+		}
+		names += FPSTR(REGIONS[i].name);
+	}
+	return names;
+}
+
+int8_t WAN::Region::dr(const char* datr) const {
+	if (NULL == datr) {
+		return -1;
+	}
+	char buffer[DATARATE_LENGTH];
+	for (uint8_t i = 0u; i < REGION_DRS; i++) {
+		if (this->drs[i].sfac) {
+			WAN::Datarate(this->drs[i].sfac, this->drs[i].sbw).print(buffer);
+			if (!strcmp(buffer, datr)) {
+				return (int8_t) i;
+			}
+		}
+	}
+	return -1;
+}
+
+int8_t WAN::Region::band(uint32_t hz) const {
+	for (uint8_t i = 0u; i < REGION_BANDS; i++) {
+		const WAN::Region::Band& band = this->bands[i];
+		if (band.max && band.min <= hz && hz <= band.max) {
+			return (int8_t) i;
+		}
+	}
+	return -1;
+}
+
+int8_t WAN::Region::eirp(uint32_t hz) const {
+	int8_t band = this->band(hz);
+	return 0 <= band ? this->bands[band].eirp : INT8_MIN;
+}
+
+static bool onChannel(const WAN::Region::Channels& channels, uint32_t hz) {
+	return channels.first <= hz && 0ul == (hz - channels.first) % channels.step && (hz - channels.first) / channels.step < channels.count;
+}
+
+bool WAN::Region::uplink(uint32_t hz) const {
+	return this->up.count ? onChannel(this->up, hz) : INT8_MIN != this->eirp(hz);
+}
+
+bool WAN::Region::downlink(uint32_t hz) const {
+	if (this->rx2 == hz) {
+		return true;
+	}
+	return this->down.count ? onChannel(this->down, hz) : INT8_MIN != this->eirp(hz);
+}
@@ -1,9 +1,14 @@
 #include <WAN.h>
 
-WAN::Scheduled::Scheduled(RFData* rfData, uint32_t tmst) : rfData(rfData), tmst(tmst) {
+WAN::Scheduled::Scheduled(RFData* rfData, uint32_t tmst, uint32_t airtime) : rfData(rfData), tmst(tmst), airtime(airtime) {
 
 }
 
+bool WAN::Scheduled::overlaps(uint32_t tmst, uint32_t airtime) const {
+	int32_t diff = (int32_t) (tmst - this->tmst);
+	return 0l <= diff ? (uint32_t) diff < this->airtime : (uint32_t) -diff < airtime;
+}
+
 WAN::Scheduled::~Scheduled() {
 	delete this->rfData->packet;
 	delete this->rfData;
@@ -0,0 +1,136 @@
+/**
+ * Received frames waiting for the backhaul, one queue per class drained in class order: a JoinRequest
+ * or a confirmed uplink needs its downlink in the receive windows of the end device, the network server
+ * can only answer once it has the uplink.
+ *
+ * A class queue holds UPLINK_DEPTH frames, a frame arriving on a full one drops its oldest, the one the
+ * least likely to be answered in time. A JoinRequest or a confirmed uplink still waiting when the last
+ * receive window of its end device opens can no longer be answered: pop drops it rather than send it
+ * ahead of fresh frames after a backhaul stall. Latency is from push to pop, in ms.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <FrameView.h>
+
+#ifndef __Uplinks__
+#define __Uplinks__
+
+#define UPLINK_CLASSES 4
+#define UPLINK_DEPTH 4 // frames per class
+#define UPLINK_BATCH 3 // frames per PUSH_DATA when several are waiting
+#define UPLINK_JOIN_DEADLINE 6000ul      // ms after RX, JOIN_ACCEPT_DELAY2 of the JoinAccept in RX2
+#define UPLINK_CONFIRMED_DEADLINE 2000ul // ms after RX, RECEIVE_DELAY2 of the ACK in RX2
+
+template <typename T> class Uplinks {
+	public:
+	enum Class : uint8_t { JOIN, CONFIRMED, UNCONFIRMED, OTHER };
+
+	class Statistics {
+		public:
+		uint32_t sent = 0ul;
+		uint32_t dropped = 0ul;
+		uint32_t latency = 0ul; // ms, average of the sent ones
+		uint32_t worst = 0ul;   // ms
+		uint64_t total = 0ull;  // ms
+	};
+
+	class Entry {
+		public:
+		T* item = NULL;
+		uint32_t arrival = 0ul; // ms
+		uint32_t deadline = 0ul; // ms after arrival, 0 for none
+	};
+
+	Entry entries[UPLINK_CLASSES][UPLINK_DEPTH];
+	uint8_t heads[UPLINK_CLASSES] = {0u};
+	uint8_t lengths[UPLINK_CLASSES] = {0u};
+	Statistics statistics[UPLINK_CLASSES];
+
+	static Class classify(const FrameView& frame) {
+		if (!frame.valid) {
+			return OTHER;
+		}
+		switch (frame.mtype) {
+			case FrameView::JOIN_REQUEST:
+			case FrameView::REJOIN_REQUEST:
+				return JOIN;
+			case FrameView::CONFIRMED_UP:
+				return CONFIRMED;
+			case FrameView::UNCONFIRMED_UP:
+				return UNCONFIRMED;
+			default:
+				return OTHER;
+		}
+	}
+
+	static uint32_t deadline(Class type) {
+		switch (type) {
+			case JOIN:
+				return UPLINK_JOIN_DEADLINE;
+			case CONFIRMED:
+				return UPLINK_CONFIRMED_DEADLINE;
+			default:
+				return 0ul;
+		}
+	}
+
+	/* push:
+	 *   Returns:
+	 *     The item dropped to make room, NULL if there was room
+	 */
+	T* push(T* item, Class type, uint32_t now) {
+		T* dropped = NULL;
+		if (UPLINK_DEPTH <= this->lengths[type]) {
+			dropped = this->entries[type][this->heads[type]].item;
+			this->heads[type] = (uint8_t) ((this->heads[type] + 1u) % UPLINK_DEPTH);
+			this->lengths[type]--;
+			this->statistics[type].dropped++;
+		}
+		Entry& entry = this->entries[type][(this->heads[type] + this->lengths[type]) % UPLINK_DEPTH];
+		entry.item = item;
+		entry.arrival = now;
+		entry.deadline = Uplinks::deadline(type);
+		this->lengths[type]++;
+		return dropped;
+	}
+
+	/* pop:
+	 *   Description:
+	 *     The oldest frame of the first class that has one, NULL if all are empty. A frame past its
+	 *     deadline comes out first, with expired set and counted dropped: free it, do not send it
+	 */
+	T* pop(uint32_t now, bool* expired) {
+		for (uint8_t type = 0u; type < UPLINK_CLASSES; type++) {
+			if (this->lengths[type]) {
+				Entry& entry = this->entries[type][this->heads[type]];
+				this->heads[type] = (uint8_t) ((this->heads[type] + 1u) % UPLINK_DEPTH);
+				this->lengths[type]--;
+
+				Statistics& statistics = this->statistics[type];
+				uint32_t latency = now - entry.arrival;
+				*expired = entry.deadline && entry.deadline < latency;
+				if (*expired) {
+					statistics.dropped++;
+					return entry.item;
+				}
+				statistics.sent++;
+				statistics.total += latency;
+				statistics.latency = (uint32_t) (statistics.total / statistics.sent);
+				statistics.worst = latency > statistics.worst ? latency : statistics.worst;
+				return entry.item;
+			}
+		}
+		return NULL;
+	}
+
+	uint8_t length() const {
+		uint8_t length = 0u;
+		for (uint8_t type = 0u; type < UPLINK_CLASSES; type++) {
+			length += this->lengths[type];
+		}
+		return length;
+	}
+};
+
+#endif
@@ -1,12 +1,38 @@
 #include <WAN.h>
 
 WAN::WAN(Node* parent, const char* name) : Node(parent, name) {
-	this->udp = new WiFiUDP();
+	for (uint8_t i = 0u; i < BACKENDS; i++) {
+		this->udps[i] = new WiFiUDP();
+	}
+	this->collector = new WiFiUDP();
 	this->schedules = new DS::List<Scheduled*>();
+
+	this->metrics.add("now", Metric::CLOCK);
+	this->metrics.add("ack");
+	this->metrics.add("rxnb", Metric::UINT, "stats");
+	this->metrics.add("rxok", Metric::UINT, "stats");
+	this->metrics.add("rxfw", Metric::UINT, "stats");
+	this->metrics.add("ackr", Metric::UINT, "stats");
+	this->metrics.add("dwnb", Metric::UINT, "stats");
+	this->metrics.add("txnb", Metric::UINT, "stats");
+	this->metrics.add("duty", Metric::UINT, "stats");
+	this->metrics.add("bcnb", Metric::UINT, "stats");
+	this->metrics.add("drop", Metric::UINT, "stats");
+
+	WAN::Region::load(this->settings.region.c_str(), &this->region);
+
+	JsonObject txpk = this->txpkFilter.createNestedObject("txpk");
+	const char* keys[] = {"imme", "tmst", "tmms", "freq", "powe", "modu", "datr", "codr", "ipol", "prea", "size", "data", "ncrc"};
+	for (uint8_t i = 0u; i < sizeof(keys) / sizeof(keys[0]); i++) {
+		txpk[keys[i]] = true;
+	}
 }
 
 WAN::~WAN() {
-	delete this->udp;
+	for (uint8_t i = 0u; i < BACKENDS; i++) {
+		delete this->udps[i];
+	}
+	delete this->collector;
 }
 
 void WAN::setup() {
@@ -23,8 +49,26 @@ void WAN::setup() {
 	this->settings.id[7] = MAC_array[5];
 
 	this->readFile();
+	this->backends.backends[0].set(this->settings.host.c_str(), this->settings.port, true);
 	// TODO:: use bound somewhere ... should we check if it is already bound ???
-	uint8_t bound = this->udp->begin(this->settings.port);
+	for (uint8_t i = 0u; i < BACKENDS; i++) {
+		if (i < this->backends.length) {
+			this->udps[i]->begin(this->settings.port + i); // a local port per server
+		} else {
+			this->udps[i]->stop();
+		}
+	}
+
+	if (Capture::UDP == this->capture.mode) {
+		this->collector->begin(this->settings.port + BACKENDS);
+	} else {
+		this->collector->stop();
+	}
+	this->startCapture();
+
+	if (!this->region.uplink(this->rfm->settings.freq.curr)) {
+		DEBUG.println("WAN :: RFM frequency is not an uplink channel of " + this->settings.region);
+	}
 
 	DEBUG.println("Starting WAN system ... OK");
 }
@@ -46,12 +90,22 @@ void WAN::loop() {
 			this->pull();
 		}
 
-		this->read();
+		for (uint8_t i = 0u; i < this->backends.length; i++) {
+			this->read(i);
+		}
 	}
 
 	this->rfm->read(this);
+	if (connected) {
+		this->forward();
+	}
 
+	this->queueBeacon();
 	this->emitDownlinks();
+
+	if (this->capture.due((uint32_t) clock64.mstime())) {
+		this->flushCapture();
+	}
 }
 
 void WAN::emitDownlinks() {
@@ -59,18 +113,27 @@ void WAN::emitDownlinks() {
 
 	for (uint32_t i = 0ul; i < this->schedules->length; i++) {
 		Scheduled* scheduled = this->schedules->get(i);
-		uint32_t now = micros();
-		if (now >= scheduled->tmst) {
+		if ((int32_t) (scheduled->tmst - micros()) <= EMIT_ADVANCE) { // across the micros() wrap
 			indices->add(i);
 			this->rfm->apply(&scheduled->rfData->settings);
-			this->rfm->send(scheduled->rfData->packet);
+			while (0l < (int32_t) (scheduled->tmst - micros())) {
+				// spins the last microseconds, beacons and receive windows are timed by the end devices
+			}
+			this->rfm->send(scheduled->rfData->packet, scheduled->rfData->settings.ih);
 			this->rfm->apply(&this->rfm->settings);
-			this->statistics.txnb += 1u;
+			if (this->capture.mode) {
+				this->record(scheduled->rfData->packet, scheduled->rfData->settings, clock64.local(scheduled->tmst));
+			}
+			if (scheduled->beacon) {
+				this->statistics.bcnb += 1u;
+			} else {
+				this->statistics.txnb += 1u;
+			}
 		}
 	}
 
-	for (uint32_t i = 0ul; i < indices->length; i++) {
-		uint32_t index = indices->get(i);
+	for (uint32_t i = indices->length; 0ul < i; i--) { // the last first, the indices before it stay valid
+		uint32_t index = indices->get(i - 1ul);
 		Scheduled* scheduled = this->schedules->get(index);
 		this->schedules->removeAt(index);
 		delete scheduled;
@@ -84,38 +147,103 @@ void WAN::emitDownlinks() {
 	delete indices;
 }
 
-void WAN::read() {
-	int size = this->udp->parsePacket();
+/**
+ * Queues the beacon of the region lead us before its GPS time, once the clock is disciplined.
+ * The downlinks overlapping its guard and reserved time are refused by resp (COLLISION_BEACON).
+ */
+void WAN::queueBeacon() {
+	const Beacon::Parameters& parameters = this->region.beacon;
+	if (!this->settings.beacon || !parameters.first || !clock64.discipline.synced()) {
+		return;
+	}
+
+	uint64_t start = this->beacon.due(Beacon::gps(clock64.discipline.utc(clock64.ustime())));
+	if (!start) {
+		return;
+	}
+
+	uint8_t frame[BEACON_LENGTH];
+	uint8_t length = Beacon::frame(frame, parameters, start, Fixed::scale(this->settings.lat, 6u), Fixed::scale(this->settings.lon, 6u));
+
+	uint32_t HZ = Beacon::frequency(parameters, start);
+	int8_t band = this->region.band(HZ);
+	const WAN::Region::DR& dr = this->region.drs[parameters.dr];
+	uint32_t sbw = WAN::Datarate::HZ[dr.sbw];
+	// explicit header formula, the implicit header of the beacon is 20 bits shorter
+	uint32_t airtime = DutyCycle::airtime(dr.sfac, sbw, 5u, BEACON_PREAMBLE, false, length);
+	uint64_t mstime = clock64.mstime();
+	uint32_t tmst = (uint32_t) clock64.discipline.local(Beacon::utc(start));
+
+	String beaconLog = "BEACON -> freq:" + String(HZ) + " time:" + String((uint32_t) (start / 1000000ull)) + " tmst:" + String(tmst);
+	if (0 <= band && this->ledger.allows(band, mstime, airtime, this->region.bands[band].duty)) {
+		WAN::RFData* rfdata = new WAN::RFData();
+		rfdata->settings.freq.curr = HZ;
+		rfdata->settings.txpw = min((int) this->region.bands[band].eirp, RFM_TXPW_MAX);
+		rfdata->settings.sfac = dr.sfac;
+		rfdata->settings.sbw = sbw;
+		rfdata->settings.crat = 5;
+		rfdata->settings.plength = BEACON_PREAMBLE;
+		rfdata->settings.sw = this->rfm->settings.sw;
+		rfdata->settings.crc = 0;
+		rfdata->settings.iiq = 0;
+		rfdata->settings.ih = 1;
+
+		rfdata->packet = new Data::Packet(length);
+		memcpy(rfdata->packet->buffer, frame, length);
+
+		this->ledger.add(band, mstime, airtime);
+		Scheduled* scheduled = new Scheduled(rfdata, tmst, airtime);
+		scheduled->beacon = true;
+		this->schedules->add(scheduled);
+	} else {
+		beaconLog += " error:TX_DUTY_CYCLE";
+	}
+	this->log(beaconLog);
+}
+
+void WAN::read(uint8_t backend) {
+	WiFiUDP* udp = this->udps[backend];
+	Backend& server = this->backends.backends[backend];
+	int size = udp->parsePacket();
 	yield();
 	if (4 <= size) { // 4 bytes: minimum packet size
 		// Remote Address should be known
-		// IPAddress remoteIpNo = this->udp->remoteIP();
-		// uint16_t remotePortNo = this->udp->remotePort();
+		// IPAddress remoteIpNo = udp->remoteIP();
+		// uint16_t remotePortNo = udp->remotePort();
 		uint8_t buffer[size + 1]; buffer[size] = '\0'; // add triling 0 to later treat it as a char array
-		int readSize = this->udp->read(buffer, size);
+		int readSize = udp->read(buffer, size);
 		yield();
 
 		if (size == readSize) {
-			uint8_t protocol = buffer[0];
+			if (this->capture.mode) {
+				this->record(Capture::DOWN, backend, buffer, size);
+			}
 			uint16_t token = buffer[2] * 256 + buffer[1];
 			uint8_t identifier = buffer[3];
 			switch (identifier) {
-				case PUSH_ACK: {
-					//Serial.println("PUSH_ACK");
-					this->lastACK = clock64.mstime();
-					// TODO:: wan->statistics->ackr
-				} break;
+				case PUSH_ACK:
 				case PULL_ACK: {
-					//Serial.println("PULL_ACK");
 					this->lastACK = clock64.mstime();
+					server.ack(identifier, token, (uint32_t) this->lastACK);
 				} break;
 				case PULL_RESP: {
 					//Serial.println("PULL_RESP");
-					this->resp(buffer, size);
+					server.dwnb += 1u;
+					if (server.down) {
+						this->resp(buffer, size, backend);
+					} else {
+						// an uplink only server gets no PULL_DATA, it should not send any
+						server.refused += 1u;
+						WAN::Message::TxAck* txAckMessage = new WAN::Message::TxAck(this, "TX_FREQ");
+						txAckMessage->header[1] = buffer[1];
+						txAckMessage->header[2] = buffer[2];
+						this->send(txAckMessage, backend);
+						delete txAckMessage;
+					}
 					this->lastACK = clock64.mstime();
 				} break;
 				default: {
-					String pullAckLog = "ERROR readUdp :: identifier not recognized " + String(identifier, HEX);
+					String pullAckLog = "ERROR readUdp :: identifier not recognized " + String(identifier, HEX) + " from " + String(server.host);
 					this->log(pullAckLog);
 				} break;
 			}
@@ -127,67 +255,162 @@ void WAN::read() {
 }
 
 void WAN::stat() {
-	WAN::Message::Stat* statMessage = new WAN::Message::Stat(this);
-	this->send(statMessage);
-	delete statMessage;
+	// a stat per server, each with the acknowledged PUSH_DATA of that server since the last stat
+	for (uint8_t i = 0u; i < this->backends.length; i++) {
+		Backend& server = this->backends.backends[i];
+		server.stat();
+		WAN::Message::Stat* statMessage = new WAN::Message::Stat(this, server.ackr);
+		this->send(statMessage, i);
+		delete statMessage;
+	}
+	this->statistics.ackr = this->backends.ackr();
 }
 
 void WAN::pull() {
+	// the downlink route, to the servers downlinks are admitted from
 	WAN::Message::Pull* pullMessage = new WAN::Message::Pull(this);
-	this->send(pullMessage);
+	for (uint8_t i = 0u; i < this->backends.length; i++) {
+		if (this->backends.backends[i].down) {
+			this->send(pullMessage, i);
+		}
+	}
 	delete pullMessage;
 }
 
 /**
  * This is called from LoRaModule when a radio packet is received
  */
-void WAN::onRFMPacket(Data::Packet* packet) {
+void WAN::onRFMPacket(Data::Packet* packet, const FrameView& frame) {
+	uint64_t local = clock64.ustime();
+	if (this->capture.mode) {
+		Capture::Record record;
+		record.kind = Capture::RF;
+		record.size = packet->size;
+		record.us = local;
+		record.freq = this->rfm->settings.freq.curr;
+		record.rssi = LoRa.packetRssi();
+		record.snr = 25 * LoRa.packetSnrRaw();
+		record.sbw = this->rfm->settings.sbw / 1000l;
+		record.sfac = this->rfm->settings.sfac;
+		record.crat = this->rfm->settings.crat;
+		record.data = packet->buffer;
+		this->record(record);
+	}
+
 	this->statistics.rxnb += 1u;
 	this->statistics.rxok += 1u; // TODO:: check CRC ????
 
+	if (!this->filters.forward(frame)) {
+		delete packet; // counted by the filters, nothing allocated nor sent
+		return;
+	}
+
 	WAN::RFData* data = new WAN::RFData();
 	data->packet = packet;
 	data->settings = this->rfm->settings;
+	data->local = local;
 	data->rssi = LoRa.packetRssi();
-	data->snr = LoRa.packetSnr();
-
-	WAN::Message::RxPk* rxpkMessage = new WAN::Message::RxPk(this);
-	rxpkMessage->add(data);
-	this->send(rxpkMessage);
+	data->snr = 25 * LoRa.packetSnrRaw(); // 0.25 dB steps
 
-	bool connected = (WL_CONNECTED == WiFi.status());
-	if (connected) {
-		this->statistics.rxfw += 1u;
+	WAN::RFData* dropped = this->uplinks.push(data, Uplinks<WAN::RFData>::classify(frame), (uint32_t) clock64.mstime());
+	if (NULL != dropped) {
+		delete dropped->packet;
+		delete dropped;
 	}
 
-	String logMessage = "UPLINK :: received:" + String(this->statistics.rxnb) + " forwarded:" + String(this->statistics.rxfw);
+	String logMessage = "UPLINK :: received:" + String(this->statistics.rxnb) + " forwarded:" + String(this->statistics.rxfw) + " queued:" + String(this->uplinks.length());
 	this->log(logMessage);
+}
+
+/**
+ * One PUSH_DATA of the waiting uplinks, by class then arrival, up to UPLINK_BATCH of them when the loop
+ * or the backhaul is behind. Those past the receive windows of their end device are dropped
+ */
+void WAN::forward() {
+	uint32_t now = (uint32_t) clock64.mstime();
+	WAN::RFData* datas[UPLINK_BATCH];
+	uint8_t count = 0u;
+	bool expired = false;
+	while (count < UPLINK_BATCH) {
+		WAN::RFData* data = this->uplinks.pop(now, &expired);
+		if (NULL == data) {
+			break;
+		}
+		if (expired) {
+			delete data->packet;
+			delete data;
+			continue;
+		}
+		datas[count++] = data;
+	}
+	if (!count) {
+		return;
+	}
 
+	WAN::Message::RxPk* rxpkMessage = new WAN::Message::RxPk(this, count);
+	for (uint8_t i = 0u; i < count; i++) {
+		rxpkMessage->add(datas[i]);
+		delete datas[i]->packet;
+		delete datas[i];
+	}
+	this->send(rxpkMessage);
+	this->statistics.rxfw += count;
 	delete rxpkMessage;
-	delete data;
 }
 
-void WAN::send(WAN::Message::Up* up) {
+void WAN::send(WAN::Message::Up* up, int8_t backend) {
 	bool connected = (WL_CONNECTED == WiFi.status());
 	if (connected) {
-		const char* host = this->settings.host.c_str();
-		int begin = this->udp->beginPacket(host, this->settings.port);
-		yield();
+		uint8_t first = 0 <= backend ? (uint8_t) backend : 0u;
+		uint8_t last = 0 <= backend ? (uint8_t) (backend + 1) : this->backends.length;
+
+		// serialized once when it goes to several servers or to the capture, streamed to the socket otherwise
+		uint8_t* payload = NULL;
+		size_t length = 0u;
+		if (NULL != up->json && (first + 1u < last || this->capture.mode)) {
+			length = HEADER_LENGTH + measureJson(*up->json);
+			payload = new uint8_t[length + 1u];
+			memcpy(payload, up->header, HEADER_LENGTH);
+			serializeJson(*up->json, (char*) payload + HEADER_LENGTH, length + 1u - HEADER_LENGTH);
+		}
 
-		size_t write = this->udp->write(up->header, HEADER_LENGTH);
-		yield();
+		uint16_t token = up->header[2] * 256 + up->header[1];
+		for (uint8_t i = first; i < last; i++) {
+			WiFiUDP* udp = this->udps[i];
+			Backend& server = this->backends.backends[i];
+			int begin = udp->beginPacket(server.host, server.port);
+			yield();
+			if (!begin) {
+				continue; // host not resolved, nothing went out: not pushed, as a failed endPacket
+			}
 
-		if (NULL != up->json) {
-			String jsonstr = "";
-			serializeJson(*up->json, jsonstr);
-			uint16_t jsonlength = jsonstr.length();
-			const char* jsonchar = jsonstr.c_str();
-			write += this->udp->write(jsonchar, jsonlength);
+			size_t write = 0u;
+			if (NULL != payload) {
+				write = udp->write(payload, length);
+				yield();
+			} else {
+				write = udp->write(up->header, HEADER_LENGTH);
+				yield();
+
+				if (NULL != up->json) {
+					BufferedWriter<WiFiUDP> writer(*udp);
+					write += serializeJson(*up->json, writer);
+					writer.flush();
+					yield();
+				}
+			}
+
+			int end = udp->endPacket();
 			yield();
-		}
 
-		int end = this->udp->endPacket();
-		yield();
+			if (end) {
+				server.push(up->header[3], token, (uint32_t) clock64.mstime());
+			}
+			if (this->capture.mode) {
+				this->record(Capture::UP, i, NULL != payload ? payload : up->header, NULL != payload ? length : HEADER_LENGTH);
+			}
+		}
+		delete[] payload;
 	}
 }
 
@@ -227,11 +450,12 @@ Example:
 	data | string | Base64 encoded RF packet payload, padding optional
 	ncrc | bool   | If true, disable the CRC of the physical layer (optional)
 */
-void WAN::resp(uint8_t* buffer, uint16_t bsize) {
+void WAN::resp(uint8_t* buffer, uint16_t bsize, uint8_t backend) {
 	uint8_t* chardata = (uint8_t*) (buffer + 4);
 
-	DynamicJsonDocument doc(512);
-	DeserializationError error = deserializeJson(doc, chardata);
+	// parsed in place, only the slots of the filtered members are allocated
+	ScratchJsonDocument doc(JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(13));
+	DeserializationError error = deserializeJson(doc, chardata, DeserializationOption::Filter(this->txpkFilter));
 	if (!error) {
 		this->statistics.dwnb += 1u;
 
@@ -240,8 +464,8 @@ void WAN::resp(uint8_t* buffer, uint16_t bsize) {
 
 		bool        imme    = !txpk.containsKey("imme") ? false      : txpk["imme"];
 		uint32_t    tmst    = !txpk.containsKey("tmst") ? micros()   : txpk["tmst"].as<uint32_t>();
-		// uint32_t    tmms    = !txpk.containsKey("tmms") ? 0ul        : txpk["tmms"].as<uint32_t>();
-		double      freq    = !txpk.containsKey("freq") ? 0.0        : txpk["freq"].as<double>();
+		uint64_t    tmms    = !txpk.containsKey("tmms") ? 0ull       : txpk["tmms"].as<uint64_t>();
+		uint32_t    freq    = !txpk.containsKey("freq") ? 0ul        : Fixed::fromJSON(txpk["freq"], 6u); // Hz
 		uint16_t    powe    = !txpk.containsKey("powe") ? 0u         : txpk["powe"].as<uint16_t>();
 		String      modu    = !txpk.containsKey("modu") ? "LORA"     : txpk["modu"].as<String>();
 		const char* datr    = !txpk.containsKey("datr") ? "SF7BW125" : txpk["datr"].as<const char*>();
@@ -252,10 +476,21 @@ void WAN::resp(uint8_t* buffer, uint16_t bsize) {
 		const char* data    = !txpk.containsKey("data") ? ""         : txpk["data"].as<const char*>();
 		bool        ncrc    = !txpk.containsKey("ncrc") ? false      : txpk["ncrc"];
 
+		// GPS time to the micros() of the emission, only tmst when both are there
+		bool unlocked = false;
+		if (!imme && !txpk.containsKey("tmst") && txpk.containsKey("tmms")) {
+			unlocked = !clock64.discipline.synced();
+			if (!unlocked) {
+				tmst = (uint32_t) clock64.discipline.local(Discipline::fromTmms(tmms));
+			}
+		}
+
 		String error = "NONE";
 		uint32_t now = micros();
 		bool tooearly = false; // TODO:: unhardcode it
-		if (!tooearly) {
+		if (unlocked) {
+			error = "GPS_UNLOCKED";
+		} else if (!tooearly) {
 			// TODO:: i've seen that TTN takes too long to send a DOWNLINK to a gateway resulting
 			// in a TOO_LATE error almost a 100% of the times ... i decided to emit them no matter what
 			// it is up to you if you want to prevent this behaviour
@@ -263,18 +498,40 @@ void WAN::resp(uint8_t* buffer, uint16_t bsize) {
 			if (!toolate) {
 				bool loraModulation = modu.equals("LORA");
 				if (loraModulation) {
-					// TODO:: find a better way to do it because of float artifacts
-					uint32_t HZ = (uint32_t) (1000000u * freq);
+					uint32_t HZ = freq;
 					uint32_t min = this->rfm->settings.freq.min;
 					uint32_t max = this->rfm->settings.freq.max;
-					if (min <= HZ && HZ <= max) {
-						if (2u <= powe && powe <= 20u) { // TODO:: unhardcode it
-							uint16_t sfac = atoi(datr + 2);
-							if (6u <= sfac && sfac <= 12u) { // TODO:: unhardcode it
-								uint32_t sbw = 125u * 1000u; // TODO:: unhardcode it
-								uint16_t crat = atoi(codr + 2);
-								if (5u <= crat && crat <= 8u) { // TODO:: unhardcode it
-									// TODO:: check sbw
+					if (min <= HZ && HZ <= max && this->region.downlink(HZ)) {
+						if (RFM_TXPW_MIN <= powe && powe <= RFM_TXPW_MAX && (int) powe <= this->region.eirp(HZ)) {
+							int8_t dr = this->region.dr(datr);
+							if (0 <= dr) {
+								uint8_t sfac = this->region.drs[dr].sfac;
+								uint32_t sbw = WAN::Datarate::HZ[this->region.drs[dr].sbw];
+								uint8_t crat = (NULL != codr && 3u == strlen(codr) && 0 == strncmp(codr, "4/", 2)) ? codr[2] - '0' : 0u;
+								unsigned int dlength = strlen(data);
+								int8_t band = this->region.band(HZ); // the EIRP check above makes it a band of the region
+								uint32_t airtime = DutyCycle::airtime(sfac, sbw, crat, plength, !ncrc, size);
+								uint64_t mstime = clock64.mstime();
+								uint32_t start = imme ? now : tmst;
+								bool beacon = this->settings.beacon && clock64.discipline.synced()
+									&& Beacon::collides(Beacon::gps(clock64.discipline.utc(clock64.local(start))), airtime);
+								bool collision = false;
+								for (uint32_t i = 0ul; i < this->schedules->length && !collision; i++) {
+									collision = this->schedules->get(i)->overlaps(start, airtime);
+								}
+								if (size != Base64::decode_length((const unsigned char*) data, dlength)) {
+									error = "TOO_LATE"; // payload does not match size
+								} else if (size > this->region.drs[dr].maxpl + MAC_OVERHEAD) {
+									error = "TOO_LATE"; // too long for the data rate
+								} else if (crat < 5u || 8u < crat) { // 4/5 to 4/8 in every region
+									error = "TOO_LATE"; // bad coding rate
+								} else if (beacon) {
+									error = "COLLISION_BEACON";
+								} else if (collision) {
+									error = "COLLISION_PACKET";
+								} else if (!this->ledger.allows(band, mstime, airtime, this->region.bands[band].duty)) {
+									error = "TX_DUTY_CYCLE";
+								} else {
 									// TODO:: check plength
 
 									WAN::RFData* rfdata = new WAN::RFData();
@@ -290,25 +547,31 @@ void WAN::resp(uint8_t* buffer, uint16_t bsize) {
 
 									Data::Packet* packet = new Data::Packet(size);
 									rfdata->packet = packet;
-									// TODO:: check packet size
-									Base64::decode((unsigned char*) data, (unsigned char*) packet->buffer);
+									int decoded = Base64::decode((const unsigned char*) data, dlength, packet->buffer, packet->size);
 
-									if (imme) {
+									if (decoded != size) {
+										error = "TOO_LATE"; // not base64
+										delete rfdata->packet;
+										delete rfdata;
+									} else if (imme) {
+										this->ledger.add(band, mstime, airtime);
 										this->rfm->apply(&rfdata->settings);
 										this->rfm->send(rfdata->packet);
 										this->rfm->apply(&this->rfm->settings);
+										if (this->capture.mode) {
+											this->record(rfdata->packet, rfdata->settings, clock64.local(now));
+										}
 										this->statistics.txnb += 1u;
 										delete rfdata->packet;
 										delete rfdata;
 									} else {
-										Scheduled* scheduled = new Scheduled(rfdata, tmst);
+										this->ledger.add(band, mstime, airtime);
+										Scheduled* scheduled = new Scheduled(rfdata, tmst, airtime);
 										this->schedules->add(scheduled);
 									}
-								} else {
-									error = "TOO_LATE"; // bad coding rate
 								}
 							} else {
-								error = "TOO_LATE"; // bad SF
+								error = "TOO_LATE"; // not a data rate of the region
 							}
 						} else {
 							error = "TX_POWER";
@@ -333,36 +596,191 @@ void WAN::resp(uint8_t* buffer, uint16_t bsize) {
 		logMessage += " prea:" + String(plength);
 		logMessage += " ipol:" + String(ipol);
 		logMessage += " imme:" + String(imme);
-		// logMessage += " tmms:" + String(tmms);
+		char tmmsText[FIXED_LENGTH_64];
+		Fixed::format(tmmsText, tmms);
+		logMessage += " tmms:" + String(tmmsText);
+		if (tmms) {
+			logMessage += " slot:" + String(Beacon::slot(tmms * 1000ull)); // -1 outside the ping slots
+		}
 		logMessage += " tmst:" + String(tmst);
 		logMessage += " now:" + String(now);
 		logMessage += " error:" + error;
+		if (backend) {
+			logMessage += " from:" + String(this->backends.backends[backend].host);
+		}
 		this->log(logMessage);
 
+		// to the server of the PULL_RESP, with its token
 		WAN::Message::TxAck* txAckMessage = new WAN::Message::TxAck(this, error);
-		this->send(txAckMessage);
+		txAckMessage->header[1] = buffer[1];
+		txAckMessage->header[2] = buffer[2];
+		this->send(txAckMessage, backend);
 		delete txAckMessage;	
 	}
 }
 
+/**
+ * A "spiffs" capture goes on in the segment that is not the newest one, the last session stays
+ */
+void WAN::startCapture() {
+	if (Capture::SPIFFS_RING != this->capture.mode || this->capture.written) {
+		return;
+	}
+	bool found = false;
+	for (uint8_t i = 0u; i < 2u; i++) {
+		String path = "/capture" + String(i) + ".bin";
+		if (!SPIFFS.exists(path)) {
+			continue;
+		}
+		File file = SPIFFS.open(path, "r");
+		uint8_t header[CAPTURE_HEADER];
+		size_t size = file ? file.read(header, CAPTURE_HEADER) : 0u;
+		file.close();
+		uint32_t sequence = 0ul;
+		uint8_t backends = 0u;
+		uint8_t eui[8];
+		if (Capture::header(header, size, &sequence, &backends, eui) && (!found || this->capture.sequence <= sequence)) {
+			found = true;
+			this->capture.segment = i ^ 1u;
+			this->capture.sequence = sequence + 1u;
+		}
+	}
+}
+
+void WAN::record(const Capture::Record& record) {
+	uint32_t now = (uint32_t) clock64.mstime();
+	if (this->capture.add(record, now)) {
+		return;
+	}
+	this->flushCapture();
+	if (this->capture.add(record, now)) {
+		return;
+	}
+	// longer than the buffer, alone
+	uint16_t length = record.length();
+	uint8_t* buffer = new uint8_t[length];
+	Capture::encode(record, buffer);
+	this->capture.records += 1u;
+	if (this->writeCapture(buffer, length)) {
+		this->capture.bytes += length;
+	} else {
+		this->capture.dropped += 1u;
+	}
+	delete[] buffer;
+}
+
+void WAN::record(Capture::Kind kind, uint8_t backend, const uint8_t* data, uint16_t size) {
+	Capture::Record record;
+	record.kind = kind;
+	record.backend = backend;
+	record.size = size;
+	record.us = clock64.ustime();
+	record.data = data;
+	this->record(record);
+}
+
+void WAN::record(Data::Packet* packet, const RFM::Settings& settings, uint64_t us) {
+	Capture::Record record;
+	record.kind = Capture::TX;
+	record.size = packet->size;
+	record.us = us;
+	record.freq = settings.freq.curr;
+	record.rssi = settings.txpw;
+	record.sbw = settings.sbw / 1000l;
+	record.sfac = settings.sfac;
+	record.crat = settings.crat;
+	record.data = packet->buffer;
+	this->record(record);
+}
+
+void WAN::flushCapture() {
+	if (this->capture.used) {
+		this->capture.clear(this->writeCapture(this->capture.buffer, this->capture.used));
+	}
+}
+
+bool WAN::writeCapture(const uint8_t* records, uint16_t length) {
+	uint8_t header[CAPTURE_HEADER];
+	if (Capture::UDP == this->capture.mode) {
+		// a datagram per flush, the collector tells the lost ones by their sequence
+		Capture::header(header, this->capture.sequence++, this->backends.length, this->settings.id);
+		int begin = this->collector->beginPacket(this->capture.host, this->capture.port);
+		yield();
+		this->collector->write(header, CAPTURE_HEADER);
+		this->collector->write(records, length);
+		int end = this->collector->endPacket();
+		yield();
+		return begin && end;
+	}
+	if (Capture::SPIFFS_RING != this->capture.mode) {
+		return false;
+	}
+
+	this->capture.rotate(length);
+	String path = "/capture" + String(this->capture.segment) + ".bin";
+	File file = SPIFFS.open(path, this->capture.written ? "a" : "w");
+	if (!file) {
+		return false;
+	}
+	if (!this->capture.written) {
+		Capture::header(header, this->capture.sequence, this->backends.length, this->settings.id);
+		this->capture.written += file.write(header, CAPTURE_HEADER);
+	}
+	size_t write = file.write(records, length);
+	this->capture.written += write;
+	file.close();
+	yield();
+	return write == length;
+}
+
 void WAN::getState(JsonObject& wan) {
 	this->JSON(wan);
+	JsonArray hits = wan.createNestedArray("hits");
+	for (uint8_t i = 0u; i < this->filters.length; i++) {
+		hits.add(this->filters.rules[i].hits);
+	}
+	wan["unmatched"] = this->filters.unmatched;
+	// per class: JoinRequest, confirmed, unconfirmed, other
+	JsonArray uplat = wan.createNestedArray("uplat");
+	JsonArray updrop = wan.createNestedArray("updrop");
+	for (uint8_t i = 0u; i < UPLINK_CLASSES; i++) {
+		uplat.add(this->uplinks.statistics[i].latency);
+		updrop.add(this->uplinks.statistics[i].dropped);
+	}
+	// per server, settings.host first
+	JsonArray ackrs = wan.createNestedArray("ackrs");
+	JsonArray rtts = wan.createNestedArray("rtts");
+	for (uint8_t i = 0u; i < this->backends.length; i++) {
+		ackrs.add(this->backends.backends[i].ackr);
+		rtts.add(this->backends.backends[i].rtt);
+	}
+	// records, lost ones, bytes written
+	JsonArray captured = wan.createNestedArray("captured");
+	captured.add(this->capture.records);
+	captured.add(this->capture.dropped);
+	captured.add(this->capture.bytes);
 	//rfm["status"] = this->active; // TODO::
 }
 
-void WAN::getPing(JsonObject& response) {
-	JsonObject object = this->rootIT(response);
-	JsonObject mparams = object.createNestedObject("state");
-	mparams["now"] = clock64.mstime();
-	mparams["ack"] = this->lastACK;
-
-	JsonObject stats = mparams.createNestedObject("stats");
-	stats["rxnb"] = this->statistics.rxnb;
-	stats["rxok"] = this->statistics.rxok;
-	stats["rxfw"] = this->statistics.rxfw;
-	stats["ackr"] = this->statistics.ackr;
-	stats["dwnb"] = this->statistics.dwnb;
-	stats["txnb"] = this->statistics.txnb;
+void WAN::measure() {
+	this->metrics.set(WAN::Ping::NOW, clock64.mstime());
+	this->metrics.set(WAN::Ping::ACK, this->lastACK);
+	this->metrics.set(WAN::Ping::RXNB, this->statistics.rxnb);
+	this->metrics.set(WAN::Ping::RXOK, this->statistics.rxok);
+	this->metrics.set(WAN::Ping::RXFW, this->statistics.rxfw);
+	this->metrics.set(WAN::Ping::ACKR, this->statistics.ackr / 100u);
+	this->metrics.set(WAN::Ping::DWNB, this->statistics.dwnb);
+	this->metrics.set(WAN::Ping::TXNB, this->statistics.txnb);
+
+	// the busiest band, in 0.01 % of its budget
+	uint64_t mstime = clock64.mstime();
+	uint16_t duty = 0u;
+	for (uint8_t band = 0u; band < REGION_BANDS; band++) {
+		duty = max(duty, this->ledger.utilization(band, mstime, this->region.bands[band].duty));
+	}
+	this->metrics.set(WAN::Ping::DUTY, duty);
+	this->metrics.set(WAN::Ping::BCNB, this->statistics.bcnb);
+	this->metrics.set(WAN::Ping::DROP, this->filters.dropped());
 }
 
 void WAN::JSON(JsonObject& wan) {
@@ -374,9 +792,20 @@ void WAN::JSON(JsonObject& wan) {
 	wan["id"] = String(id_char);
 	wan["host"] = this->settings.host;
 	wan["port"] = this->settings.port;
+	char servers[BACKENDS_TEXT_LENGTH];
+	this->backends.print(servers);
+	wan["servers"] = servers; // copied
 	wan["desc"] = this->settings.desc;
 	wan["mail"] = this->settings.mail;
 	wan["platform"] = this->settings.platform;
+	wan["region"] = this->settings.region;
+	wan["beacon"] = this->settings.beacon;
+	char filters[FILTER_RULES * FILTER_TEXT_LENGTH];
+	this->filters.print(filters);
+	wan["filters"] = filters; // copied
+	char capture[CAPTURE_TEXT_LENGTH];
+	this->capture.print(capture);
+	wan["capture"] = capture; // copied
 	wan["lon"] = this->settings.lon;
 	wan["lat"] = this->settings.lat;
 	wan["alt"] = this->settings.alt;
@@ -415,9 +844,48 @@ void WAN::fromJSON(JsonObject& params) {
 
 	if (params.containsKey("host")) { this->settings.host = params["host"].as<String>(); }
 	if (params.containsKey("port")) { this->settings.port = params["port"]; }
+	if (params.containsKey("servers")) {
+		const char* servers = params["servers"];
+		if (NULL == servers || !this->backends.parse(servers)) {
+			String serversLog = "Bad servers, the previous ones are kept: " + params["servers"].as<String>();
+			this->log(serversLog);
+		}
+	}
 	if (params.containsKey("desc")) { this->settings.desc = params["desc"].as<String>(); }
 	if (params.containsKey("mail")) { this->settings.mail = params["mail"].as<String>(); }
 	if (params.containsKey("platform")) { this->settings.platform = params["platform"].as<String>(); }
+	if (params.containsKey("region")) {
+		String region = params["region"].as<String>();
+		region.toUpperCase();
+		if (WAN::Region::load(region.c_str(), &this->region)) {
+			if (this->settings.region != region) {
+				this->ledger.reset(); // other bands
+			}
+			this->settings.region = region;
+		} else {
+			String regionLog = "Unknown region " + region + ", one of: " + WAN::Region::names();
+			this->log(regionLog);
+		}
+	}
+	if (params.containsKey("beacon")) { this->settings.beacon = params["beacon"]; }
+	if (params.containsKey("filters")) {
+		const char* filters = params["filters"];
+		if (NULL == filters || !this->filters.parse(filters)) {
+			String filtersLog = "Bad filters, the previous ones are kept: " + params["filters"].as<String>();
+			this->log(filtersLog);
+		}
+	}
+	if (params.containsKey("capture")) {
+		const char* capture = params["capture"];
+		Capture::Mode mode = this->capture.mode;
+		this->flushCapture(); // where it was going
+		if (NULL == capture || !this->capture.parse(capture)) {
+			String captureLog = "Bad capture, the previous one is kept: " + params["capture"].as<String>();
+			this->log(captureLog);
+		} else if (mode != this->capture.mode) {
+			this->capture.written = 0ul; // a new segment, see startCapture
+		}
+	}
 	if (params.containsKey("lon")) { this->settings.lon = params["lon"].as<double>(); }
 	if (params.containsKey("lat")) { this->settings.lat = params["lat"].as<double>(); }
 	if (params.containsKey("alt")) { this->settings.alt = params["alt"].as<double>(); }
@@ -5,6 +5,7 @@
  */
 
 #define ARDUINOJSON_USE_DOUBLE 1
+#define ARDUINOJSON_FAST_FLOAT 1
 
 #include <SystemClock.h>
 #include <ESP8266WiFi.h>
@@ -13,6 +14,13 @@
 #include <RFM.h>
 #include <ArduinoJson.h>
 #include <Base64M.h>
+#include <Fixed.h>
+#include <DutyCycle.h>
+#include <Beacon.h>
+#include <Filters.h>
+#include <Uplinks.h>
+#include <Backends.h>
+#include <Capture.h>
 #include <Node.h>
 #include <DS.h>
 
@@ -22,13 +30,12 @@
 // Every packet sent to TTN has a header of 12 bytes
 #define HEADER_LENGTH 12
 
-#define PROTOCOL_VERSION 0x02
-#define PUSH_DATA 0x00
-#define PUSH_ACK  0x01
-#define PULL_DATA 0x02
-#define PULL_RESP 0x03
-#define PULL_ACK  0x04
-#define TX_ACK    0x05
+#define DATARATE_LENGTH 10 // "SF12BW500" and the trailing 0
+
+#define REGION_BANDS DUTY_BANDS // sub-bands with their own max EIRP and duty cycle
+#define REGION_DRS 16   // DR0 ... DR15
+#define MAC_OVERHEAD 5u // MHDR and MIC, PHYPayload = MHDR | MACPayload | MIC
+#define EMIT_ADVANCE 2000l // us, emitDownlinks waits the last ones in a loop instead of a loop() later
 
 class WAN : public RFM::Handler, public Node {
 	public:
@@ -41,6 +48,8 @@ class WAN : public RFM::Handler, public Node {
 		String desc = "no description"; // Name of the gateway, used for free form description 
 		String mail = ""; // Owner, used for contact email
 		String platform = "ESP8266"; // platform definition
+		String region = "EU868"; // LoRaWAN regional parameters, see WAN::Region
+		bool beacon = false; // Class B beacons, needs the clock disciplined
 		double lon = 0.0;
 		double lat = 0.0;
 		float alt = 25.0f; // Altitude
@@ -51,25 +60,90 @@ class WAN : public RFM::Handler, public Node {
 		uint32_t rxnb = 0ul; // Number of radio packets received
 		uint32_t rxok = 0ul; // Number of radio packets received with a valid PHY CRC
 		uint32_t rxfw = 0ul; // Number of radio packets forwarded
-		float ackr    = 0ul; // Percentage of upstream datagrams that were acknowledged
+		uint16_t ackr = 0u;  // Percentage of upstream datagrams that were acknowledged, in 0.01 %, the lowest of the servers
 		uint32_t dwnb = 0ul; // Number of downlink datagrams received
 		uint32_t txnb = 0ul; // Number of packets emitted	
+		uint32_t bcnb = 0ul; // Number of beacons emitted
+	};
+
+	// LoRa datarate identifier, SF6BW125 ... SF12BW500
+	class Datarate {
+		public:
+		enum Bandwidth : uint8_t { BW125, BW250, BW500, BW_UNKNOWN };
+		static const uint32_t HZ[BW_UNKNOWN];
+
+		uint8_t sfac = 7u;
+		Bandwidth sbw = BW125;
+
+		Datarate();
+		Datarate(uint8_t sfac, uint32_t hz);
+		Datarate(uint8_t sfac, Bandwidth sbw);
+		uint8_t print(char* buffer) const; // DATARATE_LENGTH bytes, returns the number of characters
+	};
+
+	// LoRaWAN regional parameters, the tables of every region are constexpr in flash (Region.cpp),
+	// load copies the selected one to RAM
+	class Region {
+		public:
+		class Channels {
+			public:
+			uint32_t first; // Hz
+			uint32_t step;  // Hz
+			uint8_t count;  // 0 if the network defines them, any frequency of the bands
+		};
+
+		class Band {
+			public:
+			uint32_t min; // Hz
+			uint32_t max; // Hz
+			int8_t eirp;  // max EIRP in dBm
+			uint16_t duty; // max duty cycle in 0.01 %, 0 for none
+		};
+
+		class DR {
+			public:
+			uint8_t sfac;            // 0 for FSK and RFU
+			Datarate::Bandwidth sbw;
+			uint8_t maxpl;           // max MACPayload in bytes
+		};
+
+		char name[8];
+		Channels up;
+		Channels down;           // count 0: downlinks are sent on the uplink channels
+		uint32_t rx2;            // RX2 frequency in Hz
+		uint8_t rx2dr;
+		Band bands[REGION_BANDS];
+		DR drs[REGION_DRS];
+		Beacon::Parameters beacon;
+
+		static bool load(const char* name, Region* region); // false if there is no such region
+		static String names(); // "EU868 US915 ..."
+
+		int8_t dr(const char* datr) const; // data rate of a datr, -1 if the region has no such LoRa datarate
+		int8_t band(uint32_t hz) const; // index of the band, -1 outside the region
+		int8_t eirp(uint32_t hz) const; // max EIRP of the band, INT8_MIN outside the region
+		bool uplink(uint32_t hz) const;
+		bool downlink(uint32_t hz) const;
 	};
 
 	class RFData {
 		public:
 		Data::Packet* packet = NULL;
 		RFM::Settings settings;
+		uint64_t local = 0ull; // ustime of the reception
 		int rssi = 0;
-		float snr = 0.0;
+		int16_t snr = 0; // in 0.01 dB
 	};
 
 	class Scheduled {
 		public:
 		RFData* rfData = NULL;
 		uint32_t tmst = 0ul;
+		uint32_t airtime = 0ul; // us
+		bool beacon = false;
 
-		Scheduled(RFData* rfData, uint32_t tmst);
+		Scheduled(RFData* rfData, uint32_t tmst, uint32_t airtime);
+		bool overlaps(uint32_t tmst, uint32_t airtime) const; // across the micros() wrap
 		virtual ~Scheduled();
 	};
 
@@ -86,12 +160,12 @@ class WAN : public RFM::Handler, public Node {
 
 		class Stat : public Up {
 			public:
-			Stat(WAN* wan);
+			Stat(WAN* wan, uint16_t ackr); // ackr of the server it is sent to
 		};
 
 		class RxPk : public Up {
 			public:
-			RxPk(WAN* wan);
+			RxPk(WAN* wan, uint8_t count = 1u);
 			void add(WAN::RFData* data);
 		};
 
@@ -107,10 +181,24 @@ class WAN : public RFM::Handler, public Node {
 	};
 
 
-	WiFiUDP* udp = NULL;
+	// metrics in registration order
+	class Ping {
+		public:
+		enum { NOW, ACK, RXNB, RXOK, RXFW, ACKR, DWNB, TXNB, DUTY, BCNB, DROP };
+	};
+
+	WiFiUDP* udps[BACKENDS] = {NULL}; // a socket per network server
 	RFM* rfm = NULL;
 	Statistics statistics;
 	Settings settings;
+	Region region;
+	DutyCycle ledger; // downlink air time of the last hour per band of the region
+	Beacon beacon;
+	Filters filters; // of the received frames, before anything is forwarded
+	Uplinks<RFData> uplinks; // received frames waiting for the backhaul
+	Backends backends; // the first one is settings.host:port
+	Capture capture; // of the frames and datagrams, for tools/replay
+	WiFiUDP* collector = NULL; // socket of a "host:port" capture
 
 	DS::List<Scheduled*>* schedules = NULL;
 
@@ -122,21 +210,32 @@ class WAN : public RFM::Handler, public Node {
 
 	uint64_t lastACK = 0ull;
 
+	// members of a PULL_RESP that resp reads, everything else is skipped while parsing
+	StaticJsonDocument<JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(13)> txpkFilter;
+
 	WAN(Node* parent, const char* name);
 	virtual ~WAN();
 	void setup();
 	void loop();
-	void read();
+	void read(uint8_t backend);
 	void stat();
 	void pull();
-	void send(WAN::Message::Up* up); // UPLINKS
+	void send(WAN::Message::Up* up, int8_t backend = -1); // UPLINKS, -1 to every network server
+	void forward(); // of the queued uplinks, most urgent first
 	void emitDownlinks(); // DOWNLINKS
+	void queueBeacon();
+	void startCapture(); // the SPIFFS segment after the newest one kept
+	void record(const Capture::Record& record);
+	void record(Capture::Kind kind, uint8_t backend, const uint8_t* data, uint16_t size);
+	void record(Data::Packet* packet, const RFM::Settings& settings, uint64_t us); // TX
+	void flushCapture();
+	bool writeCapture(const uint8_t* records, uint16_t length); // false if lost
 
-	virtual void onRFMPacket(Data::Packet* packet);
-	void resp(uint8_t* buffer, uint16_t size);
+	virtual void onRFMPacket(Data::Packet* packet, const FrameView& frame);
+	void resp(uint8_t* buffer, uint16_t size, uint8_t backend);
 
 	virtual void getState(JsonObject& state);
-	virtual void getPing(JsonObject& response);
+	virtual void measure();
 	virtual void fromJSON(JsonObject& params);
 	virtual void JSON(JsonObject& params);
 	virtual void save(JsonObject& params, JsonObject& response, JsonObject& broadcast);
@@ -0,0 +1,143 @@
+/*
+ Host test of the network servers of the gateway (Backends)
+
+   parse    host:port lists printed back as parsed, " up" servers, syntax errors leave the list untouched,
+            statistics of the servers still there survive a reparse, the longest list fits BACKENDS_TEXT_LENGTH
+   ack      acknowledgement ratio of an interval, round trip of matching tokens only
+   fanout   CPU time of a PUSH_DATA of 3 rxpk for 3 servers: serialized once and copied against
+            serialized for each server
+
+ Returns 1 on the first failure.
+*/
+#define ARDUINOJSON_USE_DOUBLE 1
+#include <ArduinoJson.h>
+#include <Backends.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define CHECK(condition, ...) if (!(condition)) { printf("FAIL " __VA_ARGS__); printf("\n"); return 1; }
+
+static int parse() {
+	Backends backends;
+	backends.backends[0].set("router.eu.thethings.network", 1700u, true);
+	char text[BACKENDS_TEXT_LENGTH];
+
+	const char* list = "eu1.cloud.thethings.network:1700, 192.168.1.10:1701 up";
+	CHECK(backends.parse(list), "parse %s", list);
+	CHECK(3u == backends.length && !backends.backends[2].down && backends.backends[1].down, "servers of %s", list);
+	backends.print(text);
+	CHECK(!strcmp(text, list), "print %s", text);
+
+	CHECK(backends.parse("  10.0.0.1:1700 up ,lns:65535 "), "spaces");
+	backends.print(text);
+	CHECK(!strcmp(text, "10.0.0.1:1700 up, lns:65535"), "print %s", text);
+
+	const char* bad[] = {"a:1, b:2, c:3", "lns", "lns:", "lns:0", "lns:65536", ":1700", "lns:1700 down", "lns:1700,, x:1"};
+	for (size_t i = 0u; i < sizeof(bad) / sizeof(bad[0]); i++) {
+		CHECK(!backends.parse(bad[i]), "parsed %s", bad[i]);
+	}
+	backends.print(text);
+	CHECK(!strcmp(text, "10.0.0.1:1700 up, lns:65535"), "kept %s", text);
+
+	backends.backends[2].rtt = 42ul;
+	CHECK(backends.parse("lns:65535"), "reparse");
+	CHECK(2u == backends.length && 42ul == backends.backends[1].rtt, "statistics of lns:65535 kept");
+	CHECK(backends.parse(""), "no more servers");
+	CHECK(1u == backends.length && !strcmp(backends.backends[0].host, "router.eu.thethings.network"), "first server untouched");
+
+	char longest[2 * BACKEND_HOST_LENGTH + 32];
+	char host[BACKEND_HOST_LENGTH];
+	memset(host, 'h', BACKEND_HOST_LENGTH - 1u);
+	host[BACKEND_HOST_LENGTH - 1u] = '\0';
+	snprintf(longest, sizeof(longest), "%s:65535 up, %s:65534 up", host, host);
+	CHECK(backends.parse(longest), "parse the longest list");
+	char printed[BACKENDS_TEXT_LENGTH + 16];
+	memset(printed, 'x', sizeof(printed));
+	backends.print(printed);
+	CHECK(!strcmp(printed, longest) && strlen(printed) < BACKENDS_TEXT_LENGTH, "print the longest list");
+	for (size_t i = BACKENDS_TEXT_LENGTH; i < sizeof(printed); i++) {
+		CHECK('x' == printed[i], "written beyond BACKENDS_TEXT_LENGTH at %u", (unsigned) i);
+	}
+	printf("parse    ok\n");
+	return 0;
+}
+
+static int ack() {
+	Backend backend;
+	for (uint16_t i = 0u; i < 10u; i++) {
+		backend.push(PUSH_DATA, i, 1000ul * i);
+		if (i % 5u) {
+			backend.ack(PUSH_ACK, i, 1000ul * i + 40ul);
+		}
+	}
+	backend.stat();
+	CHECK(8000u == backend.ackr && 40ul == backend.rtt, "ackr %u rtt %u", backend.ackr, backend.rtt);
+
+	backend.push(PULL_DATA, 77u, 20000ul);
+	CHECK(!backend.ack(PULL_ACK, 76u, 20010ul), "an other token");
+	CHECK(backend.ack(PULL_ACK, 77u, 20120ul), "the token of the PULL_DATA");
+	CHECK(!backend.ack(PULL_ACK, 77u, 20130ul), "acknowledged twice");
+	CHECK(50ul == backend.rtt, "rtt %u, (7 * 40 + 120) / 8", backend.rtt);
+
+	backend.push(PUSH_DATA, 1u, 0ul);
+	backend.stat();
+	CHECK(0u == backend.ackr, "nothing acknowledged");
+	backend.stat();
+	CHECK(0u == backend.ackr && 0ul == backend.upnb, "nothing sent");
+	printf("ack      ok\n");
+	return 0;
+}
+
+static int fanout() {
+	DynamicJsonDocument doc(768u * 3u);
+	JsonArray rxpk = doc.createNestedArray("rxpk");
+	for (int i = 0; i < 3; i++) {
+		JsonObject pkdata = rxpk.createNestedObject();
+		pkdata["tmst"] = 3512348611ul;
+		pkdata["time"] = "2026-10-19T08:12:31.000212Z";
+		pkdata["freq"] = serialized("868.100000");
+		pkdata["chan"] = 0;
+		pkdata["rfch"] = 0;
+		pkdata["stat"] = 1;
+		pkdata["modu"] = "LORA";
+		pkdata["datr"] = "SF7BW125";
+		pkdata["codr"] = "4/5";
+		pkdata["rssi"] = -35;
+		pkdata["lsnr"] = serialized("5.25");
+		pkdata["size"] = 23;
+		pkdata["data"] = "QNobASaAAQABv3Lw5G4f7wYtPqM=";
+	}
+
+	const int ROUNDS = 20000;
+	static char datagrams[BACKENDS][1024];
+	clock_t start = clock();
+	for (int r = 0; r < ROUNDS; r++) {
+		for (int b = 0; b < BACKENDS; b++) {
+			serializeJson(doc, datagrams[b], sizeof(datagrams[b]));
+		}
+	}
+	double each = (double) (clock() - start) / CLOCKS_PER_SEC * 1e6 / ROUNDS;
+
+	start = clock();
+	size_t length = 0u;
+	for (int r = 0; r < ROUNDS; r++) {
+		length = measureJson(doc);
+		char* payload = new char[length + 1u];
+		serializeJson(doc, payload, length + 1u);
+		for (int b = 0; b < BACKENDS; b++) {
+			memcpy(datagrams[b], payload, length);
+		}
+		delete[] payload;
+	}
+	double once = (double) (clock() - start) / CLOCKS_PER_SEC * 1e6 / ROUNDS;
+	CHECK(length == strlen(datagrams[0]) && !memcmp(datagrams[0], datagrams[2], length), "same datagram for every server");
+	printf("fanout   %u bytes to %d servers: %.2f us serialized for each, %.2f us measured, serialized once and copied\n",
+		(unsigned) length, BACKENDS, each, once);
+	return 0;
+}
+
+int main() {
+	return parse() || ack() || fanout();
+}
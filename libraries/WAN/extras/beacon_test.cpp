@@ -0,0 +1,155 @@
+/*
+ Host test of the Class B beacon timing
+
+   frames     CRC-16 check value, frame lengths of the regions, Time and both CRCs, coordinates
+   windows    collides and slot against a brute force walk of the beacon periods
+   schedule   6 hours of the gateway loop on a simulated clock 47 ppm fast that starts just before
+              the micros() wrap: NTP samples feed Discipline, queueBeacon and emitDownlinks are
+              replayed (Beacon::due, Discipline::local, EMIT_ADVANCE spin); every beacon after the
+              first sync is emitted once, within 3 ms of its GPS time
+
+ Returns 1 on the first failure.
+*/
+#include <Beacon.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#define EMIT_ADVANCE 2000l // us, as WAN.h
+
+static uint64_t state = 88172645463325252ull;
+static uint64_t next() {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+#define CHECK(condition, ...) if (!(condition)) { printf("FAIL " __VA_ARGS__); printf("\n"); return 1; }
+
+static uint32_t little(const uint8_t* p, uint8_t length) {
+	uint32_t value = 0ul;
+	for (uint8_t i = 0u; i < length; i++) {
+		value |= (uint32_t) p[i] << (8u * i);
+	}
+	return value;
+}
+
+static int frames() {
+	CHECK(0x31C3u == Beacon::crc16((const uint8_t*) "123456789", 9u), "crc16 check value %04X", Beacon::crc16((const uint8_t*) "123456789", 9u));
+
+	// EU868 and US915 rows of WAN::Region
+	static const Beacon::Parameters eu = { 869525000ul, 0ul, 1u, 3u, 2u, 0u };
+	static const Beacon::Parameters us = { 923300000ul, 600000ul, 8u, 8u, 5u, 3u };
+	const Beacon::Parameters* regions[] = { &eu, &us };
+	const uint8_t lengths[] = { 17u, 23u };
+	uint64_t beacon = 1234567ull * BEACON_PERIOD;
+	for (int r = 0; r < 2; r++) {
+		const Beacon::Parameters& parameters = *regions[r];
+		uint8_t frame[BEACON_LENGTH];
+		uint8_t length = Beacon::frame(frame, parameters, beacon, 48856614l, 2352222l);
+		CHECK(length == lengths[r], "frame length %u, expected %u", length, lengths[r]);
+		uint8_t time = parameters.rfu1;
+		uint8_t gwspecific = time + 6u;
+		CHECK(little(frame + time, 4u) == (uint32_t) (beacon / 1000000ull), "Time field");
+		CHECK(little(frame + time + 4u, 2u) == Beacon::crc16(frame, time + 4u), "first CRC");
+		CHECK(0u == frame[gwspecific], "InfoDesc");
+		CHECK(little(frame + gwspecific + 1u, 3u) == (uint32_t) Beacon::coordinate(48856614l, 90l), "latitude");
+		CHECK(little(frame + gwspecific + 4u, 3u) == (uint32_t) Beacon::coordinate(2352222l, 180l) , "longitude");
+		CHECK(little(frame + length - 2u, 2u) == Beacon::crc16(frame + gwspecific, length - 2u - gwspecific), "second CRC");
+	}
+
+	CHECK(0x400000l == Beacon::coordinate(45000000l, 90l), "45 degrees");
+	CHECK(0x7FFFFFl == Beacon::coordinate(90000000l, 90l), "90 degrees is clamped");
+	CHECK(-0x800000l == Beacon::coordinate(-180000000l, 180l), "-180 degrees");
+	CHECK(923300000ul == Beacon::frequency(us, 8ull * BEACON_PERIOD), "US915 channel 0");
+	CHECK(925100000ul == Beacon::frequency(us, 11ull * BEACON_PERIOD), "US915 channel 3");
+	CHECK(869525000ul == Beacon::frequency(eu, 11ull * BEACON_PERIOD), "EU868 single channel");
+	printf("frames   ok\n");
+	return 0;
+}
+
+static int windows() {
+	uint64_t base = 10000000ull * BEACON_PERIOD;
+	CHECK(0 == Beacon::slot(base + BEACON_RESERVED), "first ping slot");
+	CHECK(4095 == Beacon::slot(base + BEACON_RESERVED + 4095ull * PING_SLOT), "last ping slot");
+	CHECK(-1 == Beacon::slot(base + BEACON_RESERVED + 4096ull * PING_SLOT), "guard is not a ping slot");
+	CHECK(-1 == Beacon::slot(base + BEACON_RESERVED + 1ull), "between ping slots");
+	CHECK(-1 == Beacon::slot(base), "beacon is not a ping slot");
+
+	int collisions = 0, checked = 0;
+	for (; checked < 1000000; checked++) {
+		uint64_t gps = base + next() % (4ull * BEACON_PERIOD);
+		uint32_t airtime = (uint32_t) (next() % 3000000ull);
+		bool expected = false;
+		for (uint64_t beacon = base; beacon <= base + 5ull * BEACON_PERIOD; beacon += BEACON_PERIOD) {
+			// [gps, gps + airtime) against [beacon - guard, beacon + reserved)
+			expected = expected || (gps < beacon + BEACON_RESERVED && beacon - BEACON_GUARD < gps + airtime);
+		}
+		CHECK(expected == Beacon::collides(gps, airtime), "collides at %llu us for %u us", (unsigned long long) (gps - base), airtime);
+		collisions += expected ? 1 : 0;
+	}
+	printf("windows  %d random downlinks, %d on a beacon\n", checked, collisions);
+	return 0;
+}
+
+static int schedule() {
+	const int64_t ppb = 47000ll;
+	const uint64_t hours = 6ull * 3600ull * 1000000ull;
+	const uint64_t origin = 0xFFFFFFFFull - 5000000ull; // micros() wraps 5 s in
+	int64_t offset = 1500000000000000ll; // UTC us at local 0
+	Discipline discipline;
+	Beacon beacon;
+	uint64_t poll = 0ull, first = 0ull, start = 0ull;
+	uint32_t seconds = 0ul, tmst = 0ul;
+	int emitted = 0;
+	int64_t worst = 0ll;
+
+	// polled every 0.1 to 2 ms like the gateway loop
+	for (uint64_t local = origin; local < origin + hours; local += 100ull + next() % 1900ull) {
+		uint64_t utc = (uint64_t) (offset + (int64_t) local + (int64_t) local * ppb / 1000000000ll);
+
+		// System::NTP
+		uint32_t now = (uint32_t) (utc / 1000000ull);
+		if (now != seconds) {
+			if (seconds && local - poll < 2000ull) {
+				discipline.add((poll + local) / 2ull, (uint64_t) now * 1000000ull);
+			}
+			seconds = now;
+		}
+		poll = local;
+
+		// WAN::queueBeacon
+		if (discipline.synced() && !start) {
+			uint64_t due = beacon.due(Beacon::gps(discipline.utc(local)));
+			if (due) {
+				start = due;
+				tmst = (uint32_t) discipline.local(Beacon::utc(due));
+				if (!first) first = due;
+			}
+		}
+
+		// WAN::emitDownlinks
+		if (start && (int32_t) (tmst - (uint32_t) local) <= EMIT_ADVANCE) {
+			uint64_t at = Discipline::unwrap(tmst, local);
+			if (at < local) at = local; // the loop came too late to spin
+			uint64_t truth = (uint64_t) (offset + (int64_t) at + (int64_t) at * ppb / 1000000000ll);
+			int64_t error = (int64_t) (Beacon::gps(truth) - start);
+			CHECK(start == first + (uint64_t) emitted * BEACON_PERIOD, "beacon %d missed", emitted);
+			CHECK(-3000ll <= error && error <= 3000ll, "beacon %d off by %lld us", emitted, (long long) error);
+			if (error < 0ll) error = -error;
+			if (error > worst) worst = error;
+			emitted++;
+			start = 0ull;
+		}
+	}
+	int64_t end = (int64_t) (origin + hours);
+	int expected = (int) ((Beacon::gps((uint64_t) (offset + end + end * ppb / 1000000000ll)) - first) / BEACON_PERIOD);
+	CHECK(emitted >= expected, "%d beacons emitted, %d expected", emitted, expected);
+	printf("schedule %d beacons, worst %lld us from the GPS time, drift fitted %d ppb\n", emitted, (long long) worst, (int) discipline.drift);
+	return 0;
+}
+
+int main() {
+	return frames() || windows() || schedule();
+}
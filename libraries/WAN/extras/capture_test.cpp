@@ -0,0 +1,137 @@
+/*
+ Host test of the capture format of the gateway (Capture)
+
+   parse    "", "spiffs" and host:port printed back as parsed, syntax errors leave the setting untouched
+   records  a received frame and a datagram encoded and decoded back, truncated buffers rejected
+   buffer   records gathered until CAPTURE_BUFFER, flushed after CAPTURE_FLUSH ms, counted written or
+            lost; segments of the SPIFFS ring rotated on CAPTURE_SEGMENT; block headers
+
+ Returns 1 on the first failure.
+*/
+#include <Capture.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#define CHECK(condition, ...) if (!(condition)) { printf("FAIL " __VA_ARGS__); printf("\n"); return 1; }
+
+static int parse() {
+	Capture capture;
+	char text[CAPTURE_TEXT_LENGTH];
+
+	CHECK(capture.parse("spiffs") && Capture::SPIFFS_RING == capture.mode, "spiffs");
+	capture.print(text);
+	CHECK(!strcmp(text, "spiffs"), "print %s", text);
+
+	CHECK(capture.parse(" 192.168.1.10:1790 ") && Capture::UDP == capture.mode, "host:port");
+	capture.print(text);
+	CHECK(!strcmp(text, "192.168.1.10:1790"), "print %s", text);
+
+	const char* bad[] = {"spiffs2", "collector", "collector:", ":1790", "collector:0", "collector:65536", "collector:17x"};
+	for (size_t i = 0u; i < sizeof(bad) / sizeof(bad[0]); i++) {
+		CHECK(!capture.parse(bad[i]), "parsed %s", bad[i]);
+	}
+	capture.print(text);
+	CHECK(!strcmp(text, "192.168.1.10:1790"), "kept %s", text);
+
+	CHECK(capture.parse("  ") && Capture::OFF == capture.mode, "off");
+	CHECK(0u == capture.print(text) && !text[0], "print off");
+	printf("parse    ok\n");
+	return 0;
+}
+
+static int records() {
+	const uint8_t frame[] = {0x40, 0x11, 0x22, 0x33, 0x44, 0x80, 0x01, 0x00, 0x01, 0xA5, 0x5A, 0x01, 0x02, 0x03, 0x04};
+	Capture::Record rf;
+	rf.kind = Capture::RF;
+	rf.us = 0x0123456789ABCDEFull;
+	rf.freq = 868100000ul;
+	rf.rssi = -117;
+	rf.snr = -1250;
+	rf.sbw = 125u;
+	rf.sfac = 12u;
+	rf.crat = 5u;
+	rf.size = sizeof(frame);
+	rf.data = frame;
+
+	uint8_t buffer[64];
+	uint16_t length = Capture::encode(rf, buffer);
+	CHECK(CAPTURE_RECORD + CAPTURE_RADIO + sizeof(frame) == length && rf.length() == length, "length of RF %u", length);
+	Capture::Record back;
+	CHECK(length == Capture::decode(buffer, length, &back), "decode RF");
+	CHECK(Capture::RF == back.kind && rf.us == back.us && 868100000ul == back.freq && -117 == back.rssi && -1250 == back.snr
+		&& 125u == back.sbw && 12u == back.sfac && 5u == back.crat, "settings of RF");
+	CHECK(sizeof(frame) == back.size && !memcmp(frame, back.data, sizeof(frame)), "bytes of RF");
+	CHECK(0u == Capture::decode(buffer, length - 1u, &back), "truncated RF");
+
+	const char* datagram = "\x02\x12\x34\x00{\"rxpk\":[]}";
+	Capture::Record up;
+	up.kind = Capture::UP;
+	up.backend = 2u;
+	up.us = 3600000000ull;
+	up.size = (uint16_t) (4u + strlen(datagram + 4));
+	up.data = (const uint8_t*) datagram;
+	length = Capture::encode(up, buffer);
+	CHECK(CAPTURE_RECORD + up.size == length, "length of UP %u", length);
+	CHECK(length == Capture::decode(buffer, sizeof(buffer), &back), "decode UP");
+	CHECK(Capture::UP == back.kind && 2u == back.backend && up.us == back.us && !memcmp(datagram, back.data, up.size), "UP");
+	CHECK(0u == Capture::decode(buffer, CAPTURE_RECORD - 1u, &back), "truncated header");
+
+	buffer[0] = 0u;
+	CHECK(0u == Capture::decode(buffer, length, &back), "kind 0");
+	buffer[0] = Capture::TX + 1u;
+	CHECK(0u == Capture::decode(buffer, length, &back), "kind %u", buffer[0]);
+	printf("records  ok\n");
+	return 0;
+}
+
+static int buffer() {
+	Capture capture;
+	uint8_t bytes[100] = {0};
+	Capture::Record record;
+	record.kind = Capture::DOWN;
+	record.size = sizeof(bytes);
+	record.data = bytes;
+
+	uint16_t fits = CAPTURE_BUFFER / record.length();
+	for (uint16_t i = 0u; i < fits; i++) {
+		CHECK(capture.add(record, 5000ul + i), "record %u", i);
+	}
+	CHECK(!capture.add(record, 5100ul), "record beyond CAPTURE_BUFFER");
+	CHECK(fits * record.length() == capture.used && fits == capture.waiting && fits == capture.records, "%u records", fits);
+	CHECK(!capture.due(5000ul + CAPTURE_FLUSH - 1ul) && capture.due(5000ul + CAPTURE_FLUSH), "flush after CAPTURE_FLUSH ms");
+
+	capture.clear(true);
+	CHECK(0u == capture.used && 0u == capture.waiting && fits * record.length() == capture.bytes, "written");
+	CHECK(!capture.due(UINT32_MAX), "nothing to flush");
+	CHECK(capture.add(record, UINT32_MAX - 10ul) && capture.due(CAPTURE_FLUSH - 11ul), "flush across the wrap of millis");
+	capture.clear(false);
+	CHECK(1ul == capture.dropped && fits * record.length() == capture.bytes, "lost");
+
+	record.size = CAPTURE_BUFFER;
+	CHECK(!capture.add(record, 0ul), "record longer than CAPTURE_BUFFER");
+
+	CHECK(!capture.rotate(CAPTURE_SEGMENT) && 0u == capture.segment, "first block of a segment always fits");
+	capture.written = CAPTURE_SEGMENT - 100ul;
+	CHECK(!capture.rotate(100ul) && 0u == capture.segment, "segment full");
+	CHECK(capture.rotate(101ul) && 1u == capture.segment && 1ul == capture.sequence && 0ul == capture.written, "rotated");
+	capture.written = CAPTURE_SEGMENT;
+	CHECK(capture.rotate(1ul) && 0u == capture.segment && 2ul == capture.sequence, "rotated back");
+
+	const uint8_t eui[8] = {0xB8, 0x27, 0xEB, 0xFF, 0xFE, 0x12, 0x34, 0x56};
+	uint8_t header[CAPTURE_HEADER];
+	Capture::header(header, 0xDEADBEEFul, 3u, eui);
+	uint32_t sequence = 0ul;
+	uint8_t backends = 0u, id[8] = {0};
+	CHECK(Capture::header(header, sizeof(header), &sequence, &backends, id), "header");
+	CHECK(0xDEADBEEFul == sequence && 3u == backends && !memcmp(eui, id, 8u), "fields of the header");
+	CHECK(!Capture::header(header, sizeof(header) - 1u, &sequence, &backends, id), "truncated header");
+	header[4] = CAPTURE_VERSION + 1u;
+	CHECK(!Capture::header(header, sizeof(header), &sequence, &backends, id), "version %u", header[4]);
+	printf("buffer   ok\n");
+	return 0;
+}
+
+int main() {
+	return parse() || records() || buffer();
+}
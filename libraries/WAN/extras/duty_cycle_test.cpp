@@ -0,0 +1,141 @@
+/*
+ Host test of the DutyCycle ledger
+
+   airtime  every SF, bandwidth, coding rate, CRC and size against the datasheet formula in doubles
+   replay   a day of synthetic EU868 downlinks, accepted only when the ledger allows them; every
+            accepted TX is then checked against the exact one hour sliding window of its sub-band
+   g3       back to back SF12 downlinks in the 10 % RX2 band: more than 65.535 s of TX in a bucket, the
+            ledger counts all of it and stops at the 360 s budget of the hour
+
+ Returns 1 on the first failure, prints the acceptance and the CPU time of the replay otherwise.
+*/
+#include <DutyCycle.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <vector>
+
+#define DAY (24ull * 3600ull * 1000ull)
+
+static uint64_t state = 88172645463325252ull;
+static uint64_t next() {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+static double reference(int sf, double bw, int cr, int preamble, bool crc, int size) {
+	double tsym = pow(2.0, sf) / bw;
+	int de = tsym > 0.016 ? 1 : 0;
+	double blocks = ceil((8.0 * size - 4.0 * sf + 28.0 + (crc ? 16.0 : 0.0)) / (4.0 * (sf - 2 * de)));
+	double payload = 8.0 + (blocks > 0.0 ? blocks : 0.0) * cr;
+	return (preamble + 4.25 + payload) * tsym * 1000000.0;
+}
+
+static int airtimes() {
+	static const uint32_t bandwidths[] = {125000ul, 250000ul, 500000ul};
+	int checked = 0;
+	for (int sf = 7; sf <= 12; sf++) {
+		for (int b = 0; b < 3; b++) {
+			for (int cr = 5; cr <= 8; cr++) {
+				for (int crc = 0; crc < 2; crc++) {
+					for (int size = 0; size < 256; size++, checked++) {
+						uint32_t us = DutyCycle::airtime(sf, bandwidths[b], cr, 8u, crc, size);
+						double expected = reference(sf, bandwidths[b], cr, 8, crc, size);
+						if (fabs(us - expected) > 1.0) {
+							printf("FAIL airtime SF%dBW%u 4/%d crc:%d size:%d  %u us, expected %.1f\n", sf, bandwidths[b] / 1000u, cr, crc, size, us, expected);
+							return 1;
+						}
+					}
+				}
+			}
+		}
+	}
+	printf("airtime  %d frames within 1 us, SF7BW125 13 bytes: %u us\n", checked, DutyCycle::airtime(7u, 125000ul, 5u, 8u, true, 13u));
+	return 0;
+}
+
+class Tx {
+	public:
+	uint64_t start;
+	uint32_t ms;
+};
+
+static int replay() {
+	// EU868 sub-bands of WAN::Region, the RX2 band g3 gets most of the traffic
+	static const uint16_t duty[DUTY_BANDS] = {10u, 100u, 100u, 10u, 1000u, 100u};
+	static const int weight[DUTY_BANDS] = {5, 20, 25, 5, 40, 5};
+	DutyCycle ledger;
+	std::vector<Tx> accepted[DUTY_BANDS];
+	uint32_t requests = 0ul, rejected = 0ul;
+
+	clock_t begin = clock();
+	for (uint64_t now = 0ull; now < DAY; now += 200ull + next() % 1800ull) {
+		int pick = (int) (next() % 100u), band = 0;
+		while (pick >= weight[band]) pick -= weight[band++];
+		uint8_t sf = (uint8_t) (7u + next() % 6u);
+		uint16_t size = (uint16_t) (13u + next() % 52u);
+		uint32_t airtime = DutyCycle::airtime(sf, 125000ul, 5u, 8u, false, size);
+
+		requests++;
+		if (ledger.allows(band, now, airtime, duty[band])) {
+			ledger.add(band, now, airtime);
+			Tx tx = {now, (uint32_t) ((airtime + 999ul) / 1000ul)};
+			accepted[band].push_back(tx);
+		} else {
+			rejected++;
+		}
+	}
+	double seconds = (double) (clock() - begin) / CLOCKS_PER_SEC;
+
+	for (int band = 0; band < DUTY_BANDS; band++) {
+		uint32_t budget = (uint32_t) ((uint64_t) ledger.window * duty[band] / 10000ull);
+		uint32_t sum = 0ul, peak = 0ul;
+		size_t first = 0u;
+		std::vector<Tx>& txs = accepted[band];
+		for (size_t i = 0u; i < txs.size(); i++) {
+			sum += txs[i].ms;
+			while (txs[first].start + ledger.window <= txs[i].start) sum -= txs[first++].ms;
+			if (sum > budget) {
+				printf("FAIL band %d: %u ms in the hour before %llu ms, budget %u ms\n", band, sum, (unsigned long long) txs[i].start, budget);
+				return 1;
+			}
+			if (sum > peak) peak = sum;
+		}
+		printf("band %d   duty %5.1f %%  %5zu TX  peak hour %6u / %6u ms\n", band, duty[band] / 100.0, txs.size(), peak, budget);
+	}
+	printf("replay   %u downlinks in a day, %u rejected, %.3f s\n", requests, rejected, seconds);
+	return 0;
+}
+
+static int g3() {
+	DutyCycle ledger;
+	uint32_t airtime = DutyCycle::airtime(12u, 125000ul, 5u, 8u, false, 255u);
+	uint32_t ms = (airtime + 999ul) / 1000ul;
+	uint64_t sum = 0ull;
+	uint32_t txs = 0ul;
+	for (uint64_t now = 0ull; now < 3600000ull; now += ms) {
+		if (ledger.allows(4u, now, airtime, 1000u)) {
+			ledger.add(4u, now, airtime);
+			sum += ms;
+			txs++;
+		}
+		if (now < ledger.bucket && ledger.used(4u, now) != sum) {
+			printf("FAIL g3: %u ms in the ledger after %llu ms of TX\n", ledger.used(4u, now), (unsigned long long) sum);
+			return 1;
+		}
+	}
+	if (sum > 360000ull || ledger.buckets[4][0] <= 0xFFFFul) {
+		printf("FAIL g3: %llu ms of TX in the hour, budget 360000 ms, %u ms in the first bucket\n", (unsigned long long) sum,
+			ledger.buckets[4][0]);
+		return 1;
+	}
+	printf("g3       %u TX of %u ms back to back, %llu / 360000 ms in the hour\n", txs, ms, (unsigned long long) sum);
+	return 0;
+}
+
+int main() {
+	return airtimes() || replay() || g3();
+}
@@ -0,0 +1,124 @@
+/*
+ Host test of the forwarding Filters
+
+   netid    DevAddr prefix of a NetID of every type
+   parse    rules printed back as parsed, syntax errors leave the rules untouched, hits survive a reparse
+   forward  first match, deny foreign, default drop of the kinds with allow rules, hit counters
+   cpu      forward() of a mix of frames against 8 rules, the cost added to every received frame
+
+ Returns 1 on the first failure.
+*/
+#include <Filters.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define CHECK(condition, ...) if (!(condition)) { printf("FAIL " __VA_ARGS__); printf("\n"); return 1; }
+
+static uint8_t DATA[12] = {0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x22, 0x33, 0x44};
+static uint8_t JOIN[23] = {0x00};
+
+static const uint8_t* data(uint32_t devAddr) {
+	for (int b = 0; b < 4; b++) DATA[1 + b] = (uint8_t) (devAddr >> (8 * b));
+	return DATA;
+}
+
+static const uint8_t* join(uint64_t joinEui) {
+	for (int b = 0; b < 8; b++) JOIN[1 + b] = (uint8_t) (joinEui >> (8 * b));
+	return JOIN;
+}
+
+static int netid() {
+	// NetID, prefix, bits: TTN (type 0), a type 3 and a type 6 NetID
+	static const uint32_t cases[][3] = {
+		{0x000013ul, 0x26000000ul, 7u},
+		{0x000000ul, 0x00000000ul, 7u},
+		{0x200005ul, 0x85000000ul, 8u},
+		{0x60002Aul, 0xE0540000ul, 15u},
+		{0xC00053ul, 0xFC014C00ul, 22u},
+		{0xE0FFFFul, 0xFE7FFF80ul, 25u},
+	};
+	for (size_t i = 0u; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		uint32_t prefix = 0ul;
+		uint8_t bits = Filters::netid(cases[i][0], &prefix);
+		CHECK(prefix == cases[i][1] && bits == cases[i][2], "NetID %06X: %08X/%u, expected %08X/%u", cases[i][0], prefix, bits, cases[i][1], cases[i][2]);
+	}
+	printf("netid    ok\n");
+	return 0;
+}
+
+static int parse() {
+	Filters filters;
+	char text[FILTER_RULES * FILTER_TEXT_LENGTH];
+	const char* list = "deny foreign, allow netid 000013, deny devaddr 26011B00/24, allow devaddr 01020304, allow joineui 70B3D57ED0000000-70B3D57ED0FFFFFF, deny joineui 0000000000000001";
+	CHECK(filters.parse(list), "parse %s", list);
+	filters.print(text);
+	CHECK(!strcmp(text, list), "print %s", text);
+	CHECK(filters.parse(" allow  devaddr 26011bda/20 ,deny foreign "), "spaces and lower case");
+	filters.print(text);
+	CHECK(!strcmp(text, "allow devaddr 26011000/20, deny foreign"), "print %s", text);
+
+	static const char* errors[] = {
+		"allow", "allow devaddr", "allow devaddr 26011B00/33", "allow devaddr 26011B00/", "maybe foreign",
+		"allow joineui 70B3D57ED0FFFFFF-70B3D57ED0000000", "allow netid 000013 deny foreign", "allowforeign",
+		"deny foreign, deny foreign, deny foreign, deny foreign, deny foreign, deny foreign, deny foreign, deny foreign, deny foreign",
+	};
+	for (size_t i = 0u; i < sizeof(errors) / sizeof(errors[0]); i++) {
+		CHECK(!filters.parse(errors[i]), "parsed %s", errors[i]);
+		CHECK(2u == filters.length, "rules changed by %s", errors[i]);
+	}
+	CHECK(filters.parse("") && 0u == filters.length, "empty list");
+
+	filters.parse("deny foreign, allow netid 000013");
+	filters.rules[1].hits = 7ul;
+	filters.parse("allow netid 000013, deny devaddr 00000000/8");
+	CHECK(7ul == filters.rules[0].hits && 0ul == filters.rules[1].hits, "hits after a reparse");
+	printf("parse    ok\n");
+	return 0;
+}
+
+static int forward() {
+	Filters filters;
+	CHECK(filters.forward(FrameView(data(0x01020304ul), 12u)), "no rules");
+
+	filters.parse("deny foreign, deny devaddr 26011B00/24, allow netid 000013, allow joineui 70B3D57ED0000000-70B3D57ED0FFFFFF");
+	CHECK(!filters.forward(FrameView(data(0x26011B42ul), 12u)), "denied DevAddr before its NetID");
+	CHECK(filters.forward(FrameView(data(0x27FFFFFFul), 12u)), "TTN DevAddr");
+	CHECK(!filters.forward(FrameView(data(0x01020304ul), 12u)), "other NetID, dropped by the allow rule");
+	CHECK(filters.forward(FrameView(join(0x70B3D57ED0000042ull), 23u)), "allowed JoinEUI");
+	CHECK(!filters.forward(FrameView(join(0x0000000000000001ull), 23u)), "other JoinEUI");
+	uint8_t noise[7] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE};
+	CHECK(!filters.forward(FrameView(noise, sizeof(noise))), "foreign frame");
+	DATA[0] = 0x60; // UnconfirmedDataDown of a neighbour gateway
+	CHECK(!filters.forward(FrameView(data(0x26000001ul), 12u)), "downlink");
+	DATA[0] = 0x40;
+
+	CHECK(2ul == filters.rules[0].hits && 1ul == filters.rules[1].hits && 1ul == filters.rules[2].hits && 1ul == filters.rules[3].hits, "hits");
+	CHECK(2ul == filters.unmatched && 5ul == filters.dropped(), "unmatched %u dropped %u", filters.unmatched, filters.dropped());
+
+	filters.parse("deny devaddr 26011B00/24");
+	CHECK(filters.forward(FrameView(join(0x1ull), 23u)) && filters.forward(FrameView(noise, sizeof(noise))), "deny only list forwards the rest");
+	printf("forward  ok\n");
+	return 0;
+}
+
+static int cpu() {
+	Filters filters;
+	filters.parse("deny foreign, deny devaddr 26011B00/24, deny devaddr 26022000/20, deny netid 600001, allow netid 000013, allow netid 000000, allow joineui 70B3D57ED0000000-70B3D57ED0FFFFFF, allow joineui 0004A30B00000000-0004A30BFFFFFFFF");
+	uint32_t forwarded = 0ul;
+	const int rounds = 10000000;
+	clock_t begin = clock();
+	for (int i = 0; i < rounds; i++) {
+		uint32_t devAddr = (uint32_t) i * 2654435761ul;
+		FrameView frame(i % 8 ? data(devAddr) : join(0x70B3D57ED0000000ull + (uint64_t) i), i % 8 ? 12u : 23u);
+		forwarded += filters.forward(frame) ? 1u : 0u;
+	}
+	double seconds = (double) (clock() - begin) / CLOCKS_PER_SEC;
+	printf("cpu      %.1f ns per frame with %u rules of %u bytes, %u of %d forwarded\n", seconds * 1e9 / rounds, filters.length, (unsigned) sizeof(Filters::Rule), forwarded, rounds);
+	return 0;
+}
+
+int main() {
+	return netid() || parse() || forward() || cpu();
+}
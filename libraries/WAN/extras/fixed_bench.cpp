@@ -0,0 +1,138 @@
+/*
+ Fixed point frequencies and SNR of the packet path against the doubles they replace
+
+   rxpk  freq  (double) hz / 1000000.0 written by serializeJson   vs  Fixed::format(hz, 6)
+   rxpk  lsnr  LoRa.packetSnr(), raw * 0.25                         vs  Fixed::format(25 * raw, 2)
+   txpk  freq  (uint32_t) (1000000u * freq) of the parsed double    vs  Fixed::fromJSON(freq, 6)
+
+ It checks that every channel of the EU868 and US915 plans comes back as the same Hz through
+ serializeJson + deserializeJson, that both lsnr write the same text, and counts cycles per value.
+ Host cycles are only a ratio: on the ESP8266 each double operation of the old path is a libgcc call.
+*/
+#include <Fixed.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define ROUNDS 200
+
+static uint64_t cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ull + ts.tv_nsec; // nanoseconds
+#endif
+}
+
+// every 25 kHz of the EU868 band, the 64 + 8 US915 uplinks and the 8 US915 downlinks
+static int channels(uint32_t* hz) {
+	int length = 0;
+	for (uint32_t f = 863000000ul; f <= 870000000ul; f += 25000ul) hz[length++] = f;
+	for (uint32_t i = 0; i < 64; i++) hz[length++] = 902300000ul + 200000ul * i;
+	for (uint32_t i = 0; i < 8; i++) hz[length++] = 903000000ul + 1600000ul * i;
+	for (uint32_t i = 0; i < 8; i++) hz[length++] = 923300000ul + 600000ul * i;
+	return length;
+}
+
+static uint32_t oldScale(JsonVariantConst freq) {
+	return (uint32_t) (1000000u * freq.as<double>());
+}
+
+static void frequencies() {
+	static uint32_t hz[512];
+	int length = channels(hz);
+	char json[64];
+
+	int oldLost = 0, newLost = 0;
+	for (int i = 0; i < length; i++) {
+		StaticJsonDocument<JSON_OBJECT_SIZE(1) + FIXED_LENGTH> out, in; // serialized(char*) is copied
+		out["freq"] = (double) hz[i] / 1000000.0;
+		serializeJson(out, json);
+		deserializeJson(in, json);
+		if (oldScale(in["freq"]) != hz[i]) {
+			if (oldLost++ < 3) printf("  old %s -> %u\n", json, oldScale(in["freq"]));
+		}
+
+		char freq[FIXED_LENGTH];
+		out["freq"] = serialized(freq, Fixed::format(freq, hz[i], 6u));
+		serializeJson(out, json);
+		deserializeJson(in, json);
+		if ((uint32_t) Fixed::fromJSON(in["freq"], 6u) != hz[i]) {
+			if (newLost++ < 3) printf("  new %s -> %d\n", json, Fixed::fromJSON(in["freq"], 6u));
+		}
+	}
+	printf("freq round trip  old lost %3d/%d  fixed lost %3d/%d\n", oldLost, length, newLost, length);
+
+	static char text[512][32];
+	uint64_t oldWrite = ~0ull, newWrite = ~0ull;
+	for (int r = 0; r < ROUNDS; r++) {
+		uint64_t start = cycles();
+		for (int i = 0; i < length; i++) {
+			StaticJsonDocument<JSON_OBJECT_SIZE(1) + FIXED_LENGTH> out;
+			out["freq"] = (double) hz[i] / 1000000.0;
+			serializeJson(out, text[i]);
+		}
+		uint64_t elapsed = cycles() - start;
+		if (elapsed < oldWrite) oldWrite = elapsed;
+
+		start = cycles();
+		for (int i = 0; i < length; i++) {
+			StaticJsonDocument<JSON_OBJECT_SIZE(1) + FIXED_LENGTH> out;
+			char freq[FIXED_LENGTH];
+			out["freq"] = serialized(freq, Fixed::format(freq, hz[i], 6u));
+			serializeJson(out, text[i]);
+		}
+		elapsed = cycles() - start;
+		if (elapsed < newWrite) newWrite = elapsed;
+	}
+
+	static StaticJsonDocument<JSON_OBJECT_SIZE(1)> parsed[512];
+	for (int i = 0; i < length; i++) deserializeJson(parsed[i], text[i]);
+	volatile uint32_t sink = 0;
+	uint64_t oldRead = ~0ull, newRead = ~0ull;
+	for (int r = 0; r < ROUNDS; r++) {
+		uint64_t start = cycles();
+		for (int i = 0; i < length; i++) sink = sink + oldScale(parsed[i]["freq"]);
+		uint64_t elapsed = cycles() - start;
+		if (elapsed < oldRead) oldRead = elapsed;
+
+		start = cycles();
+		for (int i = 0; i < length; i++) sink = sink + Fixed::fromJSON(parsed[i]["freq"], 6u);
+		elapsed = cycles() - start;
+		if (elapsed < newRead) newRead = elapsed;
+	}
+
+	printf("freq write       old %7.1f  fixed %7.1f  cycles per rxpk member\n", (double) oldWrite / length, (double) newWrite / length);
+	printf("freq read        old %7.1f  fixed %7.1f  cycles per txpk member\n", (double) oldRead / length, (double) newRead / length);
+}
+
+static void snr() {
+	int differ = 0, length = 0;
+	for (int raw = -128; raw < 128; raw++, length++) {
+		char old[32], fixed[32];
+		StaticJsonDocument<JSON_OBJECT_SIZE(1) + FIXED_LENGTH> doc;
+		doc["lsnr"] = raw * 0.25;
+		serializeJson(doc, old);
+
+		char lsnr[FIXED_LENGTH];
+		doc["lsnr"] = serialized(lsnr, Fixed::format(lsnr, 25 * raw, 2u));
+		serializeJson(doc, fixed);
+		if (strcmp(old, fixed)) {
+			if (differ++ < 3) printf("  %s != %s\n", old, fixed);
+		}
+	}
+	printf("lsnr text        %d/%d differ\n", differ, length);
+}
+
+int main() {
+	printf("best of %d rounds\n", ROUNDS);
+	frequencies();
+	snr();
+	return 0;
+}
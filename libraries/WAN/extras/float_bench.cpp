@@ -0,0 +1,108 @@
+/*
+ Cycles per float of the ArduinoJson number codec, built twice by the Makefile:
+
+   float_bench_9digits  ARDUINOJSON_FAST_FLOAT 0  9 significant digits out, strtod-like make_float in
+   float_bench_fast     ARDUINOJSON_FAST_FLOAT 1  shortest round trip out, correctly rounded in
+
+ Values are what the gateway writes in rxpk/stat and reads from txpk (frequencies, snr, coordinates)
+ and random doubles. Besides the cycles, it counts the values that do not survive serializeJson +
+ deserializeJson.
+ Host cycles are only a ratio: the ESP8266 has no FPU, which is where the fast path gains the most.
+*/
+#define ARDUINOJSON_USE_DOUBLE 1
+#include <ArduinoJson.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace ARDUINOJSON_NAMESPACE;
+
+#define ROUNDS 200
+#define VALUES 1000
+
+static uint64_t cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ull + ts.tv_nsec; // nanoseconds
+#endif
+}
+
+static uint64_t state = 88172645463325252ull;
+static uint64_t next() {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+static void fill(const char* name, double* values) {
+	for (int i = 0; i < VALUES; i++) {
+		if (!strcmp(name, "frequencies")) {
+			values[i] = (863000000.0 + 100000.0 * (next() % 70)) / 1000000.0;
+		} else if (!strcmp(name, "snr")) {
+			values[i] = ((int) (next() % 160) - 80) * 0.25;
+		} else if (!strcmp(name, "coordinates")) {
+			values[i] = ((int) (next() % 3600000) - 1800000) / 10000.0;
+		} else {
+			uint64_t bits = next() >> 2; // positive, finite
+			memcpy(&values[i], &bits, sizeof(double));
+		}
+	}
+}
+
+static void run(const char* name) {
+	static double values[VALUES];
+	static char text[VALUES][32];
+	fill(name, values);
+
+	uint64_t best = ~0ull;
+	for (int r = 0; r < ROUNDS; r++) {
+		uint64_t start = cycles();
+		for (int i = 0; i < VALUES; i++) {
+			StaticStringWriter writer(text[i], sizeof(text[i]) - 1);
+			TextFormatter<StaticStringWriter> formatter(writer);
+			formatter.writeFloat(values[i]);
+			text[i][formatter.bytesWritten()] = '\0';
+		}
+		uint64_t elapsed = cycles() - start;
+		if (elapsed < best) best = elapsed;
+	}
+	double write = (double) best / VALUES;
+
+	volatile double sink = 0;
+	int lost = 0;
+	best = ~0ull;
+	for (int r = 0; r < ROUNDS; r++) {
+		uint64_t start = cycles();
+		for (int i = 0; i < VALUES; i++) {
+			sink = sink + parseFloat<double>(text[i]);
+		}
+		uint64_t elapsed = cycles() - start;
+		if (elapsed < best) best = elapsed;
+	}
+	double read = (double) best / VALUES;
+	for (int i = 0; i < VALUES; i++) {
+		// through a document, parseFloat() returns integers as unsigned
+		StaticJsonDocument<JSON_OBJECT_SIZE(1)> doc;
+		deserializeJson(doc, text[i]);
+		if (doc.as<double>() != values[i]) lost++;
+	}
+
+	printf("%-12s write %7.1f  parse %7.1f  lost %4d/%d  e.g. %s\n", name, write, read, lost, VALUES, text[VALUES / 2]);
+}
+
+int main() {
+	printf("ARDUINOJSON_FAST_FLOAT %d, best of %d rounds, cycles per value\n", ARDUINOJSON_FAST_FLOAT, ROUNDS);
+	run("frequencies");
+	run("snr");
+	run("coordinates");
+	run("random");
+	return 0;
+}
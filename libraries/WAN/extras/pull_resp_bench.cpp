@@ -0,0 +1,77 @@
+/*
+ CPU time and memory of WAN::resp parsing a PULL_RESP with and without the txpk filter.
+
+   full      deserializeJson(doc, chardata)
+   filtered  deserializeJson(doc, chardata, DeserializationOption::Filter(txpkFilter))
+
+ Both parse in place, like resp does on the UDP buffer. Payloads are the PROTOCOL.TXT examples
+ and what TTN and a packet forwarder with the v2 extensions send. memoryUsage is host sized,
+ slots are smaller on the ESP8266 but the ratio holds.
+*/
+#define ARDUINOJSON_USE_DOUBLE 1
+#include <ArduinoJson.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+static const char* PAYLOADS[][2] = {
+	{"PROTOCOL.TXT LoRa", "{\"txpk\":{\"imme\":true,\"freq\":864.123456,\"rfch\":0,\"powe\":14,\"modu\":\"LORA\",\"datr\":\"SF11BW125\",\"codr\":\"4/6\","
+		"\"ipol\":false,\"size\":32,\"data\":\"H3P3N2i9qc4yt7rK7ldqoeCVJGBybzPY5h1Dd7P7p8v\"}}"},
+	{"PROTOCOL.TXT FSK", "{\"txpk\":{\"imme\":true,\"freq\":861.3,\"rfch\":0,\"powe\":12,\"modu\":\"FSK\",\"datr\":50000,\"fdev\":3000,\"size\":32,"
+		"\"data\":\"H3P3N2i9qc4yt7rK7ldqoeCVJGBybzPY5h1Dd7P7p8v\"}}"},
+	{"TTN join accept", "{\"txpk\":{\"imme\":false,\"tmst\":3512348514,\"freq\":869.525,\"rfch\":0,\"powe\":27,\"modu\":\"LORA\",\"datr\":\"SF9BW125\","
+		"\"codr\":\"4/5\",\"ipol\":true,\"size\":33,\"ncrc\":true,\"data\":\"IIE/R/UI/6JnC24j4B+EueJdnEEV8C7qCz3T4gs+ypLa\"}}"},
+	{"v2 with extensions", "{\"txpk\":{\"imme\":false,\"tmst\":3512348514,\"tmms\":1225039480000,\"freq\":868.1,\"rfch\":0,\"powe\":14,"
+		"\"ant\":0,\"brd\":0,\"modu\":\"LORA\",\"datr\":\"SF7BW125\",\"codr\":\"4/5\",\"fdev\":0,\"ipol\":true,\"prea\":8,\"size\":17,"
+		"\"ncrc\":true,\"data\":\"YKcVASaAAQACS1NUUkxbg8Q=\"},\"meta\":{\"gateway\":\"eui-a4cf12ffff3b4c5d\",\"network\":\"ttn\"}}"}
+};
+
+#define ROUNDS 100000
+
+static double now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+// WAN::WAN
+static void build(JsonDocument& filter) {
+	JsonObject txpk = filter.createNestedObject("txpk");
+	const char* keys[] = {"imme", "tmst", "freq", "powe", "modu", "datr", "codr", "ipol", "prea", "size", "data", "ncrc"};
+	for (unsigned i = 0u; i < sizeof(keys) / sizeof(keys[0]); i++) {
+		txpk[keys[i]] = true;
+	}
+}
+
+static double parse(const char* payload, JsonDocument& doc, JsonDocument* filter, size_t& usage) {
+	size_t length = strlen(payload);
+	char chardata[length + 1];
+	double start = now();
+	for (int i = 0; i < ROUNDS; i++) {
+		memcpy(chardata, payload, length + 1);
+		DeserializationError error = filter
+			? deserializeJson(doc, chardata, DeserializationOption::Filter(*filter))
+			: deserializeJson(doc, chardata);
+		if (error || doc["txpk"]["data"].isNull()) {
+			printf("parse failed: %s\n", error.c_str());
+			return 0.0;
+		}
+	}
+	usage = doc.memoryUsage();
+	return (now() - start) / ROUNDS * 1e9;
+}
+
+int main() {
+	StaticJsonDocument<JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(12)> filter;
+	build(filter);
+	DynamicJsonDocument doc(2048);
+
+	printf("%-20s %6s %10s %10s %8s %8s\n", "payload", "bytes", "full ns", "filter ns", "full B", "filter B");
+	for (unsigned i = 0u; i < sizeof(PAYLOADS) / sizeof(PAYLOADS[0]); i++) {
+		size_t full = 0u, filtered = 0u;
+		double tfull = parse(PAYLOADS[i][1], doc, NULL, full);
+		double tfiltered = parse(PAYLOADS[i][1], doc, &filter, filtered);
+		printf("%-20s %6zu %10.0f %10.0f %8zu %8zu\n", PAYLOADS[i][0], strlen(PAYLOADS[i][1]), tfull, tfiltered, full, filtered);
+	}
+	return 0;
+}
@@ -0,0 +1,215 @@
+/*
+ Host simulation of the uplink path of WAN::loop on a slow backhaul, the Uplinks priority queues against
+ the arrival order they replace (a FIFO of the same 16 frames)
+
+   radio     a frame every 300 ms on average: 10 % JoinRequest, 20 % confirmed, 60 % unconfirmed,
+             10 % foreign; the SX1276 keeps the last frame only, those that arrive while the loop is
+             blocked in a send are lost before any queue
+   backhaul  a PUSH_DATA blocks the loop 5 ms plus 2 ms a frame, 150 to 900 ms in the slow minute of
+             every 5, and the WiFi is down 30 s every 10 minutes: nothing is sent, the queue fills up
+   in time   a JoinRequest must reach the network server within 4 s (JoinAccept in RX1 at 5 s), a
+             confirmed uplink within 800 ms (ACK in RX1 at 1 s)
+
+ The priority queues drop the JoinRequests and confirmed uplinks past their last receive window
+ (UPLINK_JOIN_DEADLINE, UPLINK_CONFIRMED_DEADLINE) instead of sending them, the FIFO sends everything.
+
+ Returns 1 when a frame is lost in the accounting or the priority queues deliver fewer JoinRequests or
+ confirmed uplinks in time than the FIFO, in number or in ratio of the sent ones.
+*/
+#include <Uplinks.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <deque>
+
+#define HOUR 3600000ul
+
+// xorshift64, one generator for the radio and one for the backhaul: both queues see the same frames
+static uint64_t next(uint64_t& state) {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+class Frame {
+	public:
+	uint8_t type;
+	uint32_t arrival;
+};
+
+class Result {
+	public:
+	uint32_t received[UPLINK_CLASSES] = {0};
+	uint32_t lost[UPLINK_CLASSES] = {0};    // by the radio
+	uint32_t dropped[UPLINK_CLASSES] = {0}; // by the queue
+	uint32_t sent[UPLINK_CLASSES] = {0};
+	uint32_t intime[UPLINK_CLASSES] = {0};
+	uint32_t worst[UPLINK_CLASSES] = {0};
+	uint32_t queued = 0ul;
+};
+
+static const uint32_t DEADLINES[UPLINK_CLASSES] = {4000ul, 800ul, 0xFFFFFFFFul, 0xFFFFFFFFul};
+
+// the queue under test behind the same interface: push returns the dropped frame, pop the next one or
+// one to drop, expired
+class Fifo {
+	public:
+	std::deque<Frame*> frames;
+	uint32_t now = 0ul;
+	Frame* push(Frame* frame) {
+		frames.push_back(frame);
+		if (frames.size() > UPLINK_CLASSES * UPLINK_DEPTH) {
+			Frame* dropped = frames.front();
+			frames.pop_front();
+			return dropped;
+		}
+		return NULL;
+	}
+	Frame* pop(bool* expired) {
+		*expired = false;
+		if (frames.empty()) return NULL;
+		Frame* frame = frames.front();
+		frames.pop_front();
+		return frame;
+	}
+	uint8_t length() const { return (uint8_t) frames.size(); }
+};
+
+class Priority {
+	public:
+	Uplinks<Frame> uplinks;
+	uint32_t now = 0ul;
+	Frame* push(Frame* frame) { return uplinks.push(frame, (Uplinks<Frame>::Class) frame->type, frame->arrival); }
+	Frame* pop(bool* expired) { return uplinks.pop(now, expired); }
+	uint8_t length() const { return uplinks.length(); }
+};
+
+template <typename Q> static Result simulate(Q& queue, uint64_t seed) {
+	uint64_t air = seed, backhaul = ~seed;
+	Result result;
+	uint32_t now = 0ul, arrival = 0ul;
+	Frame* radio = NULL; // the FIFO of the SX1276
+
+	while (now < HOUR) {
+		// frames received up to now, the last one wins the radio FIFO
+		while (arrival <= now) {
+			uint32_t pick = (uint32_t) (next(air) % 100u);
+			uint8_t type = pick < 10u ? 0u : (pick < 30u ? 1u : (pick < 90u ? 2u : 3u));
+			result.received[type]++;
+			if (NULL != radio) {
+				result.lost[radio->type]++;
+				delete radio;
+			}
+			radio = new Frame();
+			radio->type = type;
+			radio->arrival = arrival;
+			arrival += 1u + (uint32_t) (next(air) % 600u);
+		}
+
+		// RFM::read and WAN::onRFMPacket
+		if (NULL != radio) {
+			Frame* dropped = queue.push(radio);
+			radio = NULL;
+			if (NULL != dropped) {
+				result.dropped[dropped->type]++;
+				delete dropped;
+			}
+		}
+
+		// WAN::forward
+		bool connected = now % 600000ul >= 30000ul;
+		Frame* batch[UPLINK_BATCH];
+		uint8_t count = 0u;
+		bool expired = false;
+		queue.now = now;
+		while (connected && count < UPLINK_BATCH) {
+			Frame* frame = queue.pop(&expired);
+			if (NULL == frame) {
+				break;
+			}
+			if (expired) {
+				result.dropped[frame->type]++;
+				delete frame;
+				continue;
+			}
+			batch[count++] = frame;
+		}
+		if (count) {
+			bool slow = now % 300000ul < 60000ul;
+			uint32_t busy = slow ? 150ul + (uint32_t) (next(backhaul) % 750u) : 5ul + 2ul * count;
+			for (uint8_t i = 0u; i < count; i++) {
+				Frame* frame = batch[i];
+				uint32_t latency = now + busy - frame->arrival; // at the network server once the send is over
+				result.sent[frame->type]++;
+				result.intime[frame->type] += latency <= DEADLINES[frame->type] ? 1u : 0u;
+				result.worst[frame->type] = latency > result.worst[frame->type] ? latency : result.worst[frame->type];
+				delete frame;
+			}
+			now += busy;
+		} else {
+			now += 1ul; // a loop without a send
+		}
+	}
+	if (NULL != radio) {
+		result.lost[radio->type]++;
+		delete radio;
+	}
+	bool expired = false;
+	while (Frame* frame = queue.pop(&expired)) {
+		if (expired) {
+			result.dropped[frame->type]++;
+		} else {
+			result.queued++;
+		}
+		delete frame;
+	}
+	return result;
+}
+
+static void print(const char* name, const Result& result) {
+	static const char* classes[UPLINK_CLASSES] = {"join", "confirmed", "unconfirmed", "other"};
+	printf("%s\n", name);
+	for (int c = 0; c < UPLINK_CLASSES; c++) {
+		printf("  %-12s received %5u  radio lost %4u  queue dropped %4u  sent %5u  in time %5.1f %%  worst %6u ms\n",
+			classes[c], result.received[c], result.lost[c], result.dropped[c], result.sent[c],
+			result.sent[c] ? 100.0 * result.intime[c] / result.sent[c] : 0.0, result.worst[c]);
+	}
+}
+
+int main() {
+	Fifo fifo;
+	Priority priority;
+	Result f = simulate(fifo, 88172645463325252ull);
+	Result p = simulate(priority, 88172645463325252ull);
+	print("fifo", f);
+	print("priority", p);
+
+	uint32_t accounted = p.queued;
+	uint32_t received = 0ul;
+	for (int c = 0; c < UPLINK_CLASSES; c++) {
+		accounted += p.lost[c] + p.dropped[c] + p.sent[c];
+		received += p.received[c];
+		if (p.dropped[c] != priority.uplinks.statistics[c].dropped || p.sent[c] != priority.uplinks.statistics[c].sent) {
+			printf("FAIL Uplinks::statistics of class %d\n", c);
+			return 1;
+		}
+	}
+	if (accounted != received) {
+		printf("FAIL %u frames received, %u accounted\n", received, accounted);
+		return 1;
+	}
+	for (int c = 0; c < 2; c++) {
+		if (p.intime[c] < f.intime[c]) {
+			printf("FAIL class %d: %u in time against %u for the FIFO\n", c, p.intime[c], f.intime[c]);
+			return 1;
+		}
+		if ((uint64_t) p.intime[c] * f.sent[c] < (uint64_t) f.intime[c] * p.sent[c]) {
+			printf("FAIL class %d: %u of %u sent in time against %u of %u for the FIFO\n", c, p.intime[c], p.sent[c],
+				f.intime[c], f.sent[c]);
+			return 1;
+		}
+	}
+	printf("latency  join %u ms, confirmed %u ms, unconfirmed %u ms on average (Uplinks::statistics)\n",
+		priority.uplinks.statistics[0].latency, priority.uplinks.statistics[1].latency, priority.uplinks.statistics[2].latency);
+	return 0;
+}
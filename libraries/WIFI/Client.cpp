@@ -6,6 +6,11 @@ WIFI::Client::Client(Node* parent, const char* name) : Node(parent, name) {
 
 	Method* network = new Method(std::bind(&WIFI::Client::network, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
 	this->methods->set("network", network);
+
+	this->metrics.add("status");
+	this->metrics.add("ssid", Metric::TEXT);
+	this->metrics.add("cssid", Metric::TEXT);
+	this->metrics.add("ss", Metric::INT);
 }
 
 WIFI::Client::~Client() {
@@ -73,7 +78,7 @@ void WIFI::Client::loop() {
 				WiFi.begin(this->settings.ssid.c_str(), this->settings.pass.c_str());
 			}
 
-			DynamicJsonDocument commandDocument(512);
+			ScratchJsonDocument commandDocument(512);
 			JsonObject command = commandDocument.to<JsonObject>();
 			JsonObject object = this->rootIT(command);
 			JsonObject mparams = object.createNestedObject("state");
@@ -142,13 +147,11 @@ void WIFI::Client::getState(JsonObject& state) {
 	state["dhcp"] = dhcp;
 }
 
-void WIFI::Client::getPing(JsonObject& response) {
-	JsonObject object = this->rootIT(response);
-	JsonObject mparams = object.createNestedObject("state");
-	mparams["status"] = (int) WiFi.status();
-	mparams["ssid"] = WiFi.SSID();
-	mparams["cssid"] = this->settings.ssid;
-	mparams["ss"] = WiFi.RSSI();
+void WIFI::Client::measure() {
+	this->metrics.set(WIFI::Client::Ping::STATUS, (int) WiFi.status());
+	this->metrics.setText(WIFI::Client::Ping::SSID, WiFi.SSID());
+	this->metrics.setText(WIFI::Client::Ping::CSSID, this->settings.ssid);
+	this->metrics.set(WIFI::Client::Ping::SS, (int64_t) WiFi.RSSI());
 }
 
 void WIFI::Client::fromJSON(JsonObject& params) {
@@ -30,6 +30,12 @@ class WIFI : public Node {
 		};
 
 		public:
+		// metrics in registration order
+		class Ping {
+			public:
+			enum { STATUS, SSID, CSSID, SS };
+		};
+
 		Settings settings;
 
 		uint32_t iphase = 1ul * 60ul * 1000ul; // 1 minute TODO:: 
@@ -51,7 +57,7 @@ class WIFI : public Node {
 		void scan(JsonObject& params, JsonObject& response, JsonObject& broadcast);
 		void network(JsonObject& params, JsonObject& response, JsonObject& broadcast);
 
-		virtual void getPing(JsonObject& state);
+		virtual void measure();
 		virtual void getState(JsonObject& state);
 		virtual void fromJSON(JsonObject& params);
 		virtual void JSON(JsonObject& params);
@@ -0,0 +1,55 @@
+/**
+ * The part of the Arduino core of the ESP8266 the WebSockets server uses, on Linux.
+ *
+ * millis() and micros() are hostMillis, moved by the test between two loops. ESP.getFreeHeap() is
+ * ESP.freeHeap, set by the test. The String buffers come from new, the frames of the server from malloc.
+ * Serial prints to stderr.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <WString.h>
+
+#ifndef __Arduino__
+#define __Arduino__
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define F(text) (text)
+#define bit(b) (1UL << (b))
+#define RANDOM_REG32 ((uint32_t) rand())
+
+extern unsigned long hostMillis;
+
+inline unsigned long millis() { return hostMillis; }
+inline unsigned long micros() { return hostMillis * 1000ul; }
+inline void delay(unsigned long ms) {}
+inline void yield() {}
+inline void randomSeed(unsigned long seed) { srand(seed); }
+inline long random(long howbig) { return howbig > 0 ? rand() % howbig : 0; }
+
+class EspClass {
+	public:
+	uint32_t freeHeap = 40000u;
+
+	uint32_t getFreeHeap() { return this->freeHeap; }
+};
+
+extern EspClass ESP;
+
+class HardwareSerial {
+	public:
+	void begin(unsigned long baud) {}
+	void print(const char* text) { fputs(text, stderr); }
+	void print(const String& text) { this->print(text.c_str()); }
+	void println(const char* text) { fprintf(stderr, "%s\n", text); }
+	void println(const String& text) { this->println(text.c_str()); }
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * WiFiClient and WiFiServer of the ESP8266 core in memory, one Socket per connection.
+ *
+ * The test plays the browser: what it sends waits in rx until the server reads it, what the server writes
+ * goes to tx. availableForWrite() is room, the free TCP send buffer, the test sets it before each loop.
+ */
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <deque>
+#include <memory>
+#include <string>
+
+#ifndef __ESP8266WiFi__
+#define __ESP8266WiFi__
+
+struct Socket {
+	std::string rx;
+	std::string tx;
+	size_t room = 1460u;
+	bool open = true;
+	unsigned int writes = 0u;
+};
+
+class WiFiClient {
+	public:
+	std::shared_ptr<Socket> socket;
+
+	WiFiClient() {}
+	WiFiClient(const std::shared_ptr<Socket>& socket) : socket(socket) {}
+	virtual ~WiFiClient() {}
+
+	uint8_t connected() { return this->socket && this->socket->open; }
+	int available() { return this->connected() ? (int) this->socket->rx.size() : 0; }
+
+	int read() {
+		if (this->available() <= 0) {
+			return -1;
+		}
+		int c = (uint8_t) this->socket->rx[0];
+		this->socket->rx.erase(0u, 1u);
+		return c;
+	}
+
+	int read(uint8_t* buffer, size_t size) {
+		size = size < (size_t) this->available() ? size : (size_t) this->available();
+		memcpy(buffer, this->socket->rx.data(), size);
+		this->socket->rx.erase(0u, size);
+		return (int) size;
+	}
+
+	size_t availableForWrite() { return this->connected() ? this->socket->room : 0u; }
+
+	size_t write(const uint8_t* buffer, size_t size) {
+		if (!this->connected()) {
+			return 0u;
+		}
+		this->socket->tx.append((const char*) buffer, size);
+		this->socket->room -= size < this->socket->room ? size : this->socket->room;
+		this->socket->writes++;
+		return size;
+	}
+	size_t write(const char* text) { return this->write((const uint8_t*) text, strlen(text)); }
+
+	void flush() {}
+	void stop() { if (this->socket) this->socket->open = false; }
+	void setNoDelay(bool nodelay) {}
+	void setTimeout(unsigned long timeout) {}
+	IPAddress remoteIP() { return IPAddress(192u, 168u, 1u, 2u); }
+};
+
+class WiFiClientSecure : public WiFiClient {};
+
+class WiFiServer {
+	public:
+	std::deque<std::shared_ptr<Socket> > pending; // connections the test opened, accepted by the next loop
+
+	WiFiServer(uint16_t port) {}
+
+	void begin() {}
+	void close() {}
+	bool hasClient() { return !this->pending.empty(); }
+
+	WiFiClient available() {
+		if (this->pending.empty()) {
+			return WiFiClient();
+		}
+		WiFiClient client(this->pending.front());
+		this->pending.pop_front();
+		return client;
+	}
+};
+
+#endif
@@ -0,0 +1,8 @@
+#include <Arduino.h>
+
+#ifndef __Hash__
+#define __Hash__
+
+void sha1(const String& data, uint8_t hash[20]); // libsha1 of the library
+
+#endif
@@ -0,0 +1,21 @@
+/**
+ * What the headers of host/ declare. Built without ESP8266, libsha1 is only there for the other cores.
+ */
+
+#include <Arduino.h>
+#include <Hash.h>
+
+extern "C" {
+#include <libsha1/libsha1.h>
+}
+
+unsigned long hostMillis = 0ul;
+EspClass ESP;
+HardwareSerial Serial;
+
+void sha1(const String& data, uint8_t hash[20]) {
+	SHA1_CTX context;
+	SHA1Init(&context);
+	SHA1Update(&context, (const unsigned char*) data.c_str(), data.length());
+	SHA1Final(hash, &context);
+}
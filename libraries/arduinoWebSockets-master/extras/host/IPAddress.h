@@ -0,0 +1,14 @@
+#include <stdint.h>
+
+#ifndef __IPAddress__
+#define __IPAddress__
+
+class IPAddress {
+	public:
+	uint8_t bytes[4];
+
+	IPAddress(uint8_t a = 0u, uint8_t b = 0u, uint8_t c = 0u, uint8_t d = 0u) : bytes{a, b, c, d} {}
+	uint8_t operator[](int index) const { return this->bytes[index]; }
+};
+
+#endif
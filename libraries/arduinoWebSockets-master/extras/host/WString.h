@@ -0,0 +1,111 @@
+/**
+ * The String of the Arduino core, what the WebSockets server uses of it.
+ * Same layout as the core, a NULL buffer is the empty String: WebSocketsServer memsets its clients.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+#ifndef __WString__
+#define __WString__
+
+class String {
+	public:
+	char* buffer;
+	unsigned int len;
+
+	String(const char* text = "") : buffer(NULL), len(0u) { this->assign(text, NULL != text ? strlen(text) : 0u); }
+	String(const String& text) : buffer(NULL), len(0u) { this->assign(text.buffer, text.len); }
+	~String() { delete[] this->buffer; }
+
+	String& operator=(const String& text) { this->assign(text.buffer, text.len); return *this; }
+	String& operator=(const char* text) { this->assign(text, NULL != text ? strlen(text) : 0u); return *this; }
+
+	const char* c_str() const { return NULL != this->buffer ? this->buffer : ""; }
+	unsigned int length() const { return this->len; }
+	char operator[](unsigned int index) const { return index < this->len ? this->buffer[index] : '\0'; }
+
+	String& operator+=(const String& text) { this->append(text.c_str(), text.len); return *this; }
+	String& operator+=(const char* text) { this->append(text, strlen(text)); return *this; }
+	String& operator+=(char c) { this->append(&c, 1u); return *this; }
+
+	bool operator==(const String& text) const { return this->len == text.len && !memcmp(this->c_str(), text.c_str(), this->len); }
+	bool operator!=(const String& text) const { return !(*this == text); }
+	bool equalsIgnoreCase(const String& text) const { return this->len == text.len && !strcasecmp(this->c_str(), text.c_str()); }
+	bool startsWith(const String& text) const { return text.len <= this->len && !strncmp(this->c_str(), text.c_str(), text.len); }
+
+	int indexOf(char c, unsigned int from = 0u) const {
+		const char* found = from < this->len ? strchr(this->buffer + from, c) : NULL;
+		return NULL != found ? (int) (found - this->buffer) : -1;
+	}
+	int indexOf(const String& text, unsigned int from = 0u) const {
+		const char* found = from <= this->len ? strstr(this->c_str() + from, text.c_str()) : NULL;
+		return NULL != found ? (int) (found - this->c_str()) : -1;
+	}
+
+	String substring(unsigned int from, unsigned int to = 0xFFFFFFFFu) const {
+		String text;
+		to = to < this->len ? to : this->len;
+		if (from < to) {
+			text.assign(this->buffer + from, to - from);
+		}
+		return text;
+	}
+
+	void remove(unsigned int index, unsigned int count) {
+		if (index < this->len) {
+			count = count < this->len - index ? count : this->len - index;
+			memmove(this->buffer + index, this->buffer + index + count, this->len - index - count + 1u);
+			this->len -= count;
+		}
+	}
+
+	void toLowerCase() {
+		for (unsigned int i = 0u; i < this->len; i++) {
+			this->buffer[i] = tolower((unsigned char) this->buffer[i]);
+		}
+	}
+
+	void trim() {
+		unsigned int first = 0u;
+		while (first < this->len && isspace((unsigned char) this->buffer[first])) first++;
+		unsigned int last = this->len;
+		while (last > first && isspace((unsigned char) this->buffer[last - 1u])) last--;
+		String text = this->substring(first, last);
+		this->assign(text.buffer, text.len);
+	}
+
+	long toInt() const { return atol(this->c_str()); }
+
+	private:
+	void assign(const char* text, unsigned int length) {
+		char* copy = NULL;
+		if (length > 0u) {
+			copy = new char[length + 1u];
+			memcpy(copy, text, length);
+			copy[length] = '\0';
+		}
+		delete[] this->buffer;
+		this->buffer = copy;
+		this->len = length;
+	}
+
+	void append(const char* text, unsigned int length) {
+		char* copy = new char[this->len + length + 1u];
+		memcpy(copy, this->c_str(), this->len);
+		memcpy(copy + this->len, text, length);
+		copy[this->len + length] = '\0';
+		delete[] this->buffer;
+		this->buffer = copy;
+		this->len += length;
+	}
+};
+
+inline String operator+(const String& a, const String& b) { String text(a); text += b; return text; }
+inline String operator+(const String& a, const char* b) { String text(a); text += b; return text; }
+
+#endif
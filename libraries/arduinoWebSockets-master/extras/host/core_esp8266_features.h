@@ -0,0 +1 @@
+// libb64 and WebSockets.cpp include it on the ESP8266, nothing of it is used
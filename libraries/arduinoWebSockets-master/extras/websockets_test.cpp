@@ -0,0 +1,360 @@
+/*
+ Host test of the non-blocking WebSocket I/O of the server, on the in-memory sockets of host/
+
+   handshake  a handshake trickled 7 bytes per loop completes once, with the Sec-WebSocket-Accept of RFC 6455
+   frame      a masked frame fed one byte per loop is delivered once, when its last byte arrives
+   slow       50 broadcasts of 200 bytes to a browser taking 10 bytes per loop: the queue stays within
+              WEBSOCKETS_TX_QUEUE_MAX frames and WEBSOCKETS_TX_QUEUE_BYTES, the stream stays whole frames
+   timeout    a browser taking nothing and one stopping in the middle of a frame are dropped after
+              WEBSOCKETS_TCP_TIMEOUT, not before
+   broadcast  300 bytes to 3 browsers: one frame of 304 bytes, the payload copied once, the same bytes to
+              each in one write, a frame queued on the 3 freed by the last one taking it, nothing copied
+              under low heap nor with the header built in the payload, as getBroadcastStats reports
+
+ The clock only moves between two loops, a read or a write that waited for it would never return.
+ Returns 1 on the first failure.
+*/
+#include <WebSocketsServer.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+#define CHECK(condition, ...) if (!(condition)) { printf("FAIL " __VA_ARGS__); printf("\n"); return 1; }
+
+// the frames and payloads of the server come from malloc (linked with --wrap), the Strings and sockets from new
+static struct {
+	unsigned long allocations;
+	unsigned long frees;
+	size_t bytes;
+} heap;
+
+extern "C" {
+void* __real_malloc(size_t size);
+void __real_free(void* pointer);
+
+void* __wrap_malloc(size_t size) {
+	heap.allocations++;
+	heap.bytes += size;
+	return __real_malloc(size);
+}
+
+void __wrap_free(void* pointer) {
+	if (NULL != pointer) {
+		heap.frees++;
+	}
+	__real_free(pointer);
+}
+}
+
+static const char* REQUEST =
+	"GET /ws HTTP/1.1\r\n"
+	"Host: gateway\r\n"
+	"Upgrade: websocket\r\n"
+	"Connection: Upgrade\r\n"
+	"Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+	"Sec-WebSocket-Version: 13\r\n"
+	"\r\n";
+
+static struct {
+	int connected;
+	int disconnected;
+	int texts;
+	std::string text;
+} events;
+
+static void event(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
+	if (WStype_CONNECTED == type) {
+		events.connected++;
+	} else if (WStype_DISCONNECTED == type) {
+		events.disconnected++;
+	} else if (WStype_TEXT == type) {
+		events.texts++;
+		events.text.assign((const char*) payload, length);
+	}
+}
+
+class Server : public WebSocketsServer {
+	public:
+	Server() : WebSocketsServer(81) {
+		events = {};
+		this->onEvent(event);
+		this->begin();
+	}
+
+	void accept(const std::shared_ptr<Socket>& socket) { this->_server->pending.push_back(socket); }
+	WSclient_t* client(uint8_t num) { return &this->_clients[num]; }
+};
+
+struct Browser {
+	std::shared_ptr<Socket> socket = std::make_shared<Socket>();
+	size_t offset = 0u; // of the next frame in socket->tx
+};
+
+static void loop(Server& server, unsigned long ms) {
+	hostMillis += ms;
+	server.loop();
+}
+
+// next whole frame of the server from *offset, false if the stream ends before it or it is masked
+static bool frame(const std::string& stream, size_t* offset, uint8_t* header, std::string* payload) {
+	size_t at = *offset + 2u;
+	if (stream.size() < at || (stream[*offset + 1u] & 0x80)) {
+		return false;
+	}
+	size_t length = stream[*offset + 1u] & 0x7F;
+	if (126u == length) {
+		if (stream.size() < at + 2u) {
+			return false;
+		}
+		length = ((uint8_t) stream[at] << 8) | (uint8_t) stream[at + 1u];
+		at += 2u;
+	}
+	if (stream.size() < at + length) {
+		return false;
+	}
+	*header = stream[*offset];
+	payload->assign(stream, at, length);
+	*offset = at + length;
+	return true;
+}
+
+// handshake at once, the browser is left after the ping that follows it
+static bool open(Server& server, Browser& browser) {
+	int connected = events.connected;
+	server.accept(browser.socket);
+	browser.socket->rx += REQUEST;
+	for (int i = 0; i < 16 && connected == events.connected; i++) {
+		loop(server, 1ul);
+	}
+	size_t end = browser.socket->tx.find("\r\n\r\n");
+	if (connected == events.connected || std::string::npos == end) {
+		return false;
+	}
+	uint8_t header;
+	std::string payload;
+	browser.offset = end + 4u;
+	return frame(browser.socket->tx, &browser.offset, &header, &payload) && 0x89 == header;
+}
+
+static std::string message(int index) {
+	char text[201];
+	memset(text, 'a' + index % 26, 200u);
+	snprintf(text, sizeof(text), "%04d", index);
+	text[4] = ' ';
+	return std::string(text, 200u);
+}
+
+static int handshake() {
+	Server server;
+	Browser browser;
+	server.accept(browser.socket);
+	const std::string request = REQUEST;
+	for (size_t i = 0u; i < request.size(); i += 7u) {
+		CHECK(0 == events.connected, "connected after %u bytes", (unsigned) i);
+		browser.socket->rx.append(request, i, 7u);
+		loop(server, 10ul);
+	}
+	for (int i = 0; i < 8; i++) {
+		loop(server, 10ul); // the lines that came with the last bytes
+	}
+	CHECK(1 == events.connected && WSC_CONNECTED == server.client(0)->status, "connected %d", events.connected);
+
+	const std::string& response = browser.socket->tx;
+	CHECK(0u == response.find("HTTP/1.1 101 Switching Protocols\r\n"), "response %s", response.c_str());
+	CHECK(std::string::npos != response.find("Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n"), "accept key %s", response.c_str());
+	size_t offset = response.find("\r\n\r\n") + 4u;
+	uint8_t header;
+	std::string payload;
+	CHECK(frame(response, &offset, &header, &payload) && 0x89 == header && offset == response.size(), "one ping after the handshake");
+	printf("handshake ok, %u bytes 7 per loop\n", (unsigned) request.size());
+	return 0;
+}
+
+static int masked() {
+	Server server;
+	Browser browser;
+	CHECK(open(server, browser), "open");
+
+	const std::string text = "{\"rxpk\":[{\"freq\":868.1,\"datr\":\"SF7BW125\"}]}";
+	const uint8_t key[4] = {0x37, 0xFA, 0x21, 0x3D};
+	std::string bytes;
+	bytes += (char) 0x81;
+	bytes += (char) (0x80 | text.size());
+	bytes.append((const char*) key, 4u);
+	for (size_t i = 0u; i < text.size(); i++) {
+		bytes += (char) (text[i] ^ key[i % 4u]);
+	}
+	for (size_t i = 0u; i < bytes.size(); i++) {
+		CHECK(0 == events.texts, "delivered after %u of %u bytes", (unsigned) i, (unsigned) bytes.size());
+		browser.socket->rx += bytes[i];
+		loop(server, 10ul);
+	}
+	for (int i = 0; i < 4; i++) {
+		loop(server, 10ul);
+	}
+	CHECK(1 == events.texts && text == events.text, "%d texts: %s", events.texts, events.text.c_str());
+	CHECK(0 == events.disconnected, "disconnected");
+	printf("frame     ok, %u bytes 1 per loop\n", (unsigned) bytes.size());
+	return 0;
+}
+
+static int slow() {
+	Server server;
+	Browser browser;
+	CHECK(open(server, browser), "open");
+	WSclient_t* client = server.client(0);
+
+	for (int i = 0; i < 50; i++) {
+		browser.socket->room = 10u;
+		const std::string text = message(i);
+		server.broadcastTXT(text.c_str(), text.size());
+		loop(server, 10ul);
+		CHECK(WSC_CONNECTED == client->status, "dropped at %d", i);
+		CHECK(client->txCount <= WEBSOCKETS_TX_QUEUE_MAX && server.getIOStats().depth <= WEBSOCKETS_TX_QUEUE_MAX,
+			"%u frames queued at %d", client->txCount, i);
+		CHECK(client->txBytes <= WEBSOCKETS_TX_QUEUE_BYTES && server.getIOStats().queued == client->txBytes,
+			"%u bytes queued at %d", (unsigned) client->txBytes, i);
+	}
+	int loops = 0;
+	for (; client->txCount > 0u && loops < 1000; loops++) {
+		browser.socket->room = 10u;
+		loop(server, 10ul);
+	}
+	CHECK(0u == client->txCount && WSC_CONNECTED == client->status, "%u frames left", client->txCount);
+
+	const std::string& stream = browser.socket->tx;
+	uint8_t header;
+	std::string payload;
+	int received = 0;
+	int last = -1;
+	while (frame(stream, &browser.offset, &header, &payload)) {
+		CHECK(0x81 == header && 200u == payload.size(), "frame %02x of %u bytes", header, (unsigned) payload.size());
+		int index = atoi(payload.c_str());
+		CHECK(index > last && payload == message(index), "message %d after %d", index, last);
+		last = index;
+		received++;
+	}
+	CHECK(browser.offset == stream.size(), "%u bytes after the last whole frame", (unsigned) (stream.size() - browser.offset));
+	uint32_t drops = server.getIOStats().drops;
+	CHECK(49 == last && drops > 0u && 50u == received + drops, "%d received, %u dropped", received, drops);
+	printf("slow      ok, 50 x 200 bytes at 10 bytes per loop: %d received whole, %u dropped, drained in %d loops\n",
+		received, drops, loops);
+	return 0;
+}
+
+static int timeout() {
+	Server server;
+	Browser stuck;
+	Browser partial;
+	CHECK(open(server, stuck) && open(server, partial), "open");
+
+	stuck.socket->room = 0u;
+	const std::string text = message(0);
+	server.broadcastTXT(text.c_str(), text.size());
+	partial.socket->rx += std::string("\x81\xFE\x01", 3u); // 2 bytes of a 126 bytes length to come
+	unsigned long start = hostMillis;
+	while (hostMillis - start <= WEBSOCKETS_TCP_TIMEOUT) {
+		CHECK(0 == events.disconnected, "dropped after %lu ms", hostMillis - start);
+		loop(server, 100ul);
+	}
+	loop(server, 100ul);
+	CHECK(2 == events.disconnected && !stuck.socket->open && !partial.socket->open, "%d dropped", events.disconnected);
+	CHECK(1u == server.getIOStats().kicks, "%u kicked", server.getIOStats().kicks);
+	uint8_t header;
+	std::string payload;
+	CHECK(frame(partial.socket->tx, &partial.offset, &header, &payload) && text == payload, "broadcast to the partial frame");
+	CHECK(frame(partial.socket->tx, &partial.offset, &header, &payload) && 0x88 == header && "\x03\xEA" == payload,
+		"close 1002 to the partial frame");
+	printf("timeout   ok, after %lu ms\n", hostMillis - start);
+	return 0;
+}
+
+// what the server wrote to the browser since the last call
+static std::string received(Browser& browser) {
+	std::string bytes = browser.socket->tx.substr(browser.offset);
+	browser.offset = browser.socket->tx.size();
+	return bytes;
+}
+
+static int broadcast() {
+	Server server;
+	Browser browsers[3];
+	for (int i = 0; i < 3; i++) {
+		CHECK(open(server, browsers[i]), "open %d", i);
+	}
+	const WebSocketsServer::WSbroadcastStats_t& stats = server.getBroadcastStats();
+	const std::string text = std::string(300u, 'p');
+	unsigned int writes[3];
+
+	for (int i = 0; i < 3; i++) {
+		writes[i] = browsers[i].socket->writes;
+	}
+	heap = {};
+	server.broadcastTXT(text.c_str(), text.size());
+	CHECK(1u == heap.allocations && 1u == heap.frees, "%lu allocations, %lu freed", heap.allocations, heap.frees);
+	CHECK(1u == stats.broadcasts && 300u == stats.copied && 300u == stats.lastCopied && 3u * 304u == stats.lastSent,
+		"copied %u, last %u, sent %u", stats.copied, stats.lastCopied, stats.lastSent);
+	const std::string frame = received(browsers[0]);
+	CHECK(304u == frame.size() && 0x81 == (uint8_t) frame[0] && 0 == frame.compare(4u, 300u, text), "frame of %u bytes", (unsigned) frame.size());
+	for (int i = 0; i < 3; i++) {
+		CHECK((0 == i || frame == received(browsers[i])) && writes[i] + 1u == browsers[i].socket->writes, "frame to %d", i);
+	}
+
+	// nobody has room: the frame is queued on the 3, each drained client drops its reference
+	for (int i = 0; i < 3; i++) {
+		browsers[i].socket->room = 0u;
+	}
+	heap = {};
+	server.broadcastTXT(text.c_str(), text.size());
+	WSframe_t* shared = server.client(0)->txQueue[0];
+	CHECK(1u == heap.allocations && 0u == heap.frees, "%lu allocations, %lu freed", heap.allocations, heap.frees);
+	for (int i = 0; i < 3; i++) {
+		CHECK(1u == server.client(i)->txCount && shared == server.client(i)->txQueue[0], "frame queued on %d", i);
+	}
+	CHECK(3u == shared->refs && 600u == stats.copied && 300u == stats.lastCopied, "%u references", shared->refs);
+	for (int i = 0; i < 3; i++) {
+		browsers[i].socket->room = 1460u;
+		loop(server, 10ul);
+		CHECK(0u == server.client(i)->txCount && frame == received(browsers[i]), "queued frame to %d", i);
+		if (i < 2) {
+			CHECK(2u - i == shared->refs && 0u == heap.frees, "%u references after %d", shared->refs, i);
+		}
+	}
+	CHECK(1u == heap.frees, "frame freed by the last client, %lu freed", heap.frees);
+
+	// low heap: header and payload to each, nothing allocated nor copied
+	for (int i = 0; i < 3; i++) {
+		browsers[i].socket->room = 1460u;
+		writes[i] = browsers[i].socket->writes;
+	}
+	ESP.freeHeap = 1000u;
+	heap = {};
+	server.broadcastTXT(text.c_str(), text.size());
+	ESP.freeHeap = 40000u;
+	CHECK(0u == heap.allocations, "%lu allocations under low heap", heap.allocations);
+	CHECK(1u == stats.fallbacks && 0u == stats.lastCopied && 600u == stats.copied && 3u * 304u == stats.lastSent,
+		"fallbacks %u, copied %u, last %u, sent %u", stats.fallbacks, stats.copied, stats.lastCopied, stats.lastSent);
+	for (int i = 0; i < 3; i++) {
+		CHECK(frame == received(browsers[i]) && writes[i] + 2u == browsers[i].socket->writes, "low heap frame to %d", i);
+	}
+
+	// header built in the payload: only the frame itself is allocated
+	uint8_t payload[WEBSOCKETS_MAX_HEADER_SIZE + 300u];
+	memcpy(payload + WEBSOCKETS_MAX_HEADER_SIZE, text.data(), text.size());
+	heap = {};
+	server.broadcastTXT(payload, text.size(), true);
+	CHECK(1u == heap.allocations && sizeof(WSframe_t) == heap.bytes && 1u == heap.frees, "%lu allocations of %u bytes",
+		heap.allocations, (unsigned) heap.bytes);
+	CHECK(4u == stats.broadcasts && 0u == stats.lastCopied && 600u == stats.copied, "copied %u, last %u", stats.copied, stats.lastCopied);
+	for (int i = 0; i < 3; i++) {
+		CHECK(frame == received(browsers[i]), "in place frame to %d", i);
+	}
+	printf("broadcast ok, 300 bytes to 3 clients: one frame of 304 bytes, %u bytes copied by 4 broadcasts, %u fallback\n",
+		stats.copied, stats.fallbacks);
+	return 0;
+}
+
+int main() {
+	return handshake() || masked() || slow() || timeout() || broadcast();
+}
@@ -197,6 +197,21 @@ bool WebSockets::sendFrame(WSclient_t * client, WSopcode_t opcode, uint8_t * pay
         return false;
     }
 
+#if(WEBSOCKETS_NETWORK_TYPE != NETWORK_ESP8266_ASYNC)
+    if(client->txCount > 0) {
+        // the client is behind, queue the whole frame so it can be dropped if it falls further behind
+        WSframe_t * frame = createFrame(opcode, payload, length, fin, headerToPayload, NULL, client->cIsClient);
+        if(!frame) {
+            client->txDrops++;
+            _txDrops++;
+            return false;
+        }
+        bool queued = queueFrame(client, frame, 0, false);
+        releaseFrame(frame);
+        return queued;
+    }
+#endif
+
     DEBUG_WEBSOCKETS("[WS][%d][sendFrame] ------- send message frame -------\n", client->num);
     DEBUG_WEBSOCKETS("[WS][%d][sendFrame] fin: %u opCode: %u mask: %u length: %u headerToPayload: %u\n", client->num, fin, opcode, client->cIsClient, length, headerToPayload);
 
@@ -309,6 +324,279 @@ bool WebSockets::sendFrame(WSclient_t * client, WSopcode_t opcode, uint8_t * pay
     return ret;
 }
 
+/**
+ * encode a frame once so it can be written to many clients, or queued, without copying it again
+ * @param opcode WSopcode_t
+ * @param payload uint8_t *     ptr to the payload
+ * @param length size_t         length of the payload
+ * @param fin bool              can be used to send data in more then one frame (set fin on the last frame)
+ * @param headerToPayload bool  payload has reserved 14 Byte at the beginning, the frame is built in place
+ * @param copied size_t *       incremented by the payload bytes copied into the frame
+ * @param mask bool             add a mask (client frames), the payload is only masked when it is copied
+ * @return the frame with one reference or NULL if there is not enough heap (send header and payload separately then)
+ */
+WSframe_t * WebSockets::createFrame(WSopcode_t opcode, uint8_t * payload, size_t length, bool fin, bool headerToPayload, size_t * copied, bool mask) {
+    uint8_t maskKey[4]                         = { 0x00, 0x00, 0x00, 0x00 };
+    uint8_t header[WEBSOCKETS_MAX_HEADER_SIZE] = { 0 };
+
+    if(mask && !headerToPayload) {
+        for(uint8_t x = 0; x < sizeof(maskKey); x++) {
+            maskKey[x] = random(0xFF);
+        }
+    }
+
+    uint8_t headerSize = createHeader(&header[0], opcode, length, mask, maskKey, fin);
+
+    WSframe_t * frame;
+    if(headerToPayload) {
+        frame = (WSframe_t *)malloc(sizeof(WSframe_t));
+        if(!frame) {
+            return NULL;
+        }
+        frame->data = payload + (WEBSOCKETS_MAX_HEADER_SIZE - headerSize);
+        memcpy(frame->data, &header[0], headerSize);
+        frame->length = headerSize + length;
+        frame->refs   = 1;
+    } else {
+#ifdef WEBSOCKETS_USE_BIG_MEM
+        if(GET_FREE_HEAP < (sizeof(WSframe_t) + headerSize + length + WEBSOCKETS_SHARED_FRAME_MIN_HEAP)) {
+            return NULL;
+        }
+        frame = allocFrame(headerSize + length);
+        if(!frame) {
+            return NULL;
+        }
+        memcpy(frame->data, &header[0], headerSize);
+        if(payload && length > 0) {
+            uint8_t * dataPtr = frame->data + headerSize;
+            memcpy(dataPtr, payload, length);
+            if(mask) {
+                for(size_t x = 0; x < length; x++) {
+                    dataPtr[x] = (dataPtr[x] ^ maskKey[x % 4]);
+                }
+            }
+            if(copied) {
+                *copied += length;
+            }
+        }
+#else
+        // not enough RAM to hold a second copy of the payload
+        return NULL;
+#endif
+    }
+    return frame;
+}
+
+/**
+ * allocate a frame and its data in one block
+ * @param length size_t  bytes of data
+ * @return the frame with one reference or NULL
+ */
+WSframe_t * WebSockets::allocFrame(size_t length) {
+    WSframe_t * frame = (WSframe_t *)malloc(sizeof(WSframe_t) + length);
+    if(!frame) {
+        return NULL;
+    }
+    frame->data   = (uint8_t *)(frame + 1);
+    frame->length = length;
+    frame->refs   = 1;
+    return frame;
+}
+
+/**
+ * take a reference to a frame, it stays valid until the matching releaseFrame
+ * @param frame WSframe_t *
+ */
+void WebSockets::retainFrame(WSframe_t * frame) {
+    frame->refs++;
+}
+
+/**
+ * drop a reference to a frame, the last one frees it
+ * @param frame WSframe_t *
+ */
+void WebSockets::releaseFrame(WSframe_t * frame) {
+    if(frame == NULL) {
+        return;
+    }
+    if(--frame->refs == 0) {
+        free(frame);    // header and payload live in the same allocation (or in the caller payload)
+    }
+}
+
+/**
+ * write a frame made by createFrame to one client, what does not fit in the TCP send buffer is queued
+ * @param client WSclient_t *   ptr to the client struct
+ * @param frame WSframe_t *
+ * @return true if ok
+ */
+bool WebSockets::sendFrame(WSclient_t * client, WSframe_t * frame) {
+    if(client->tcp && !client->tcp->connected()) {
+        DEBUG_WEBSOCKETS("[WS][%d][sendFrame] not Connected!?\n", client->num);
+        return false;
+    }
+
+    if(client->status != WSC_CONNECTED) {
+        DEBUG_WEBSOCKETS("[WS][%d][sendFrame] not in WSC_CONNECTED state!?\n", client->num);
+        return false;
+    }
+
+#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
+    return (write(client, frame->data, frame->length) == frame->length);
+#else
+    if(client->txCount > 0) {
+        // behind other frames, it can be dropped as a whole if the client falls too far behind
+        return queueFrame(client, frame, 0, false);
+    }
+    size_t sent = writeNow(client, frame->data, frame->length);
+    if(sent == frame->length) {
+        return true;
+    }
+    return queueFrame(client, frame, sent, true);
+#endif
+}
+
+/**
+ * queue a frame (a reference is taken) until the client has room for it
+ * when the queue is full the frames nobody started yet are dropped, newer data replaces older,
+ * a client that can not even take the rest of a started frame is disconnected
+ * @param client WSclient_t *
+ * @param frame WSframe_t *
+ * @param offset size_t     bytes of the frame already written
+ * @param pinned bool       rest of a started frame, dropping it would corrupt the stream
+ * @return true if queued
+ */
+bool WebSockets::queueFrame(WSclient_t * client, WSframe_t * frame, size_t offset, bool pinned) {
+    if(!client->tcp) {
+        return false;
+    }
+
+    WSframe_t * copy = NULL;
+    if(frame->data != (uint8_t *)(frame + 1)) {
+        // built inside the caller payload, keep a copy of what is left
+        copy = allocFrame(frame->length - offset);
+        if(copy) {
+            memcpy(copy->data, frame->data + offset, copy->length);
+            offset = 0;
+        }
+        frame = copy;
+    }
+
+    size_t length = frame ? (frame->length - offset) : 0;
+    if(frame && client->txCount == 0) {
+        // always room for one, whatever its size
+        client->txOffset = offset;
+        client->txLast   = millis();
+    } else if(!frame || client->txCount == WEBSOCKETS_TX_QUEUE_MAX || (client->txBytes + length) > WEBSOCKETS_TX_QUEUE_BYTES) {
+        uint8_t kept = 1;
+        for(uint8_t i = 1; i < client->txCount; i++) {
+            if(client->txPinned & (1u << i)) {
+                client->txQueue[kept] = client->txQueue[i];
+                client->txPinned      = (client->txPinned & ~(1u << i)) | (1u << kept);
+                kept++;
+            } else {
+                client->txBytes -= client->txQueue[i]->length;
+                releaseFrame(client->txQueue[i]);
+                client->txDrops++;
+                _txDrops++;
+            }
+        }
+        if(client->txCount > 0) {
+            client->txCount = kept;
+        }
+
+        if(!frame || client->txCount == WEBSOCKETS_TX_QUEUE_MAX || (client->txBytes + length) > WEBSOCKETS_TX_QUEUE_BYTES) {
+            releaseFrame(copy);
+            if(!pinned) {
+                client->txDrops++;
+                _txDrops++;
+                return false;
+            }
+            DEBUG_WEBSOCKETS("[WS][%d][queueFrame] client too slow, disconnect\n", client->num);
+            _txKicks++;
+            clientDisconnect(client);
+            return false;
+        }
+    }
+
+    retainFrame(frame);
+    if(pinned) {
+        client->txPinned |= (1u << client->txCount);
+    }
+    client->txQueue[client->txCount] = frame;
+    client->txCount++;
+    client->txBytes += length;
+    releaseFrame(copy);
+    return true;
+}
+
+/**
+ * write as much of the queued frames as the client takes without waiting,
+ * a client that takes nothing for WEBSOCKETS_TCP_TIMEOUT is disconnected
+ * @param client WSclient_t *
+ */
+void WebSockets::handleTX(WSclient_t * client) {
+    while(client->txCount > 0) {
+        WSframe_t * frame = client->txQueue[0];
+        size_t left       = frame->length - client->txOffset;
+        size_t len        = writeNow(client, frame->data + client->txOffset, left);
+        if(len == 0) {
+            if((millis() - client->txLast) > WEBSOCKETS_TCP_TIMEOUT) {
+                DEBUG_WEBSOCKETS("[WS][%d][handleTX] write TIMEOUT!\n", client->num);
+                _txKicks++;
+                clientDisconnect(client);
+            }
+            return;
+        }
+        client->txLast = millis();
+        client->txBytes -= len;
+        if(len < left) {
+            client->txOffset += len;
+            return;
+        }
+
+        releaseFrame(frame);
+        client->txCount--;
+        memmove(&client->txQueue[0], &client->txQueue[1], client->txCount * sizeof(WSframe_t *));
+        client->txPinned >>= 1;
+        client->txOffset = 0;
+    }
+}
+
+/**
+ * disconnect a client that started a handshake or a frame and stopped sending it
+ * @param client WSclient_t *
+ */
+void WebSockets::handleRXTimeout(WSclient_t * client) {
+    bool partial = (client->status == WSC_HEADER) || (client->cWsRXsize > 0) || client->cWsPayload;
+    if(partial && (millis() - client->cWsRXlast) > WEBSOCKETS_TCP_TIMEOUT) {
+        DEBUG_WEBSOCKETS("[WS][%d][handleRXTimeout] receive TIMEOUT!\n", client->num);
+        clientDisconnect(client, 1002);
+    }
+}
+
+/**
+ * release the queued frames and the partial input of a client
+ * @param client WSclient_t *
+ */
+void WebSockets::clearBuffers(WSclient_t * client) {
+    for(uint8_t i = 0; i < client->txCount; i++) {
+        releaseFrame(client->txQueue[i]);
+    }
+    client->txCount  = 0;
+    client->txPinned = 0;
+    client->txOffset = 0;
+    client->txBytes  = 0;
+
+    if(client->cWsPayload) {
+        free(client->cWsPayload);
+        client->cWsPayload = NULL;
+    }
+    client->cWsPayloadRX = 0;
+    client->cWsRXsize    = 0;
+    client->cHttpLine    = "";
+}
+
 /**
  * callen when HTTP header is done
  * @param client WSclient_t *  ptr to the client struct
@@ -328,9 +616,14 @@ void WebSockets::headerDone(WSclient_t * client) {
  * @param client WSclient_t *  ptr to the client struct
  */
 void WebSockets::handleWebsocket(WSclient_t * client) {
+#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
     if(client->cWsRXsize == 0) {
         handleWebsocketCb(client);
     }
+#else
+    // resumes the frame where the previous call left it
+    handleWebsocketCb(client);
+#endif
 }
 
 /**
@@ -353,6 +646,22 @@ bool WebSockets::handleWebsocketWaitFor(WSclient_t * client, size_t size) {
     }
 
     DEBUG_WEBSOCKETS("[WS][%d][handleWebsocketWaitFor] size: %d cWsRXsize: %d\n", client->num, size, client->cWsRXsize);
+#if(WEBSOCKETS_NETWORK_TYPE != NETWORK_ESP8266_ASYNC)
+    // take what is there, the rest comes with a later call
+    int available = client->tcp->available();
+    if(available > 0) {
+        size_t n = size - client->cWsRXsize;
+        if((size_t)available < n) {
+            n = available;
+        }
+        int len = client->tcp->read(&client->cWsHeader[client->cWsRXsize], n);
+        if(len > 0) {
+            client->cWsRXsize += len;
+            client->cWsRXlast = millis();
+        }
+    }
+    return (client->cWsRXsize >= size);
+#else
     readCb(client, &client->cWsHeader[client->cWsRXsize], (size - client->cWsRXsize), std::bind([](WebSockets * server, size_t size, WSclient_t * client, bool ok) {
         DEBUG_WEBSOCKETS("[WS][%d][handleWebsocketWaitFor][readCb] size: %d ok: %d\n", client->num, size, ok);
         if(ok) {
@@ -367,6 +676,7 @@ bool WebSockets::handleWebsocketWaitFor(WSclient_t * client, size_t size) {
     },
                                                                                           this, size, std::placeholders::_1, std::placeholders::_2));
     return false;
+#endif
 }
 
 void WebSockets::handleWebsocketCb(WSclient_t * client) {
@@ -440,6 +750,40 @@ void WebSockets::handleWebsocketCb(WSclient_t * client) {
     }
 
     if(header->payloadLen > 0) {
+#if(WEBSOCKETS_NETWORK_TYPE != NETWORK_ESP8266_ASYNC)
+        if(!client->cWsPayload) {
+            // if text data we need one more
+            client->cWsPayload = (uint8_t *)malloc(header->payloadLen + 1);
+            client->cWsPayloadRX = 0;
+
+            if(!client->cWsPayload) {
+                DEBUG_WEBSOCKETS("[WS][%d][handleWebsocket] to less memory to handle payload %d!\n", client->num, header->payloadLen);
+                clientDisconnect(client, 1011);
+                return;
+            }
+        }
+
+        int available = client->tcp->available();
+        if(available > 0) {
+            size_t n = header->payloadLen - client->cWsPayloadRX;
+            if((size_t)available < n) {
+                n = available;
+            }
+            int len = client->tcp->read(client->cWsPayload + client->cWsPayloadRX, n);
+            if(len > 0) {
+                client->cWsPayloadRX += len;
+                client->cWsRXlast = millis();
+            }
+        }
+        if(client->cWsPayloadRX < header->payloadLen) {
+            return;
+        }
+
+        payload              = client->cWsPayload;
+        client->cWsPayload   = NULL;
+        client->cWsPayloadRX = 0;
+        handleWebsocketPayloadCb(client, true, payload);
+#else
         // if text data we need one more
         payload = (uint8_t *)malloc(header->payloadLen + 1);
 
@@ -449,6 +793,7 @@ void WebSockets::handleWebsocketCb(WSclient_t * client) {
             return;
         }
         readCb(client, payload, header->payloadLen, std::bind(&WebSockets::handleWebsocketPayloadCb, this, std::placeholders::_1, std::placeholders::_2, payload));
+#endif
     } else {
         handleWebsocketPayloadCb(client, true, NULL);
     }
@@ -650,17 +995,18 @@ bool WebSockets::readCb(WSclient_t * client, uint8_t * out, size_t n, WSreadWait
 }
 
 /**
- * write x byte to tcp or get timeout
+ * write x byte to tcp, what does not fit in the TCP send buffer is queued (the async client buffers it itself)
  * @param client WSclient_t *
  * @param out  uint8_t * data buffer
  * @param n size_t byte count
- * @return bytes send
+ * @return bytes send or queued
  */
 size_t WebSockets::write(WSclient_t * client, uint8_t * out, size_t n) {
     if(out == NULL)
         return 0;
     if(client == NULL)
         return 0;
+#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
     unsigned long t = millis();
     size_t len      = 0;
     size_t total    = 0;
@@ -687,15 +1033,76 @@ size_t WebSockets::write(WSclient_t * client, uint8_t * out, size_t n) {
             out += len;
             n -= len;
             total += len;
-            //DEBUG_WEBSOCKETS("write %d left %d!\n", len, n);
-        } else {
-            //DEBUG_WEBSOCKETS("write %d failed left %d!\n", len, n);
         }
-#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266)
-        delay(0);
-#endif
     }
     return total;
+#else
+    size_t total = 0;
+    if(client->txCount == 0) {
+        total = writeNow(client, out, n);
+    }
+    if(total < n) {
+        // part of a frame, it has to go out no matter what
+        WSframe_t * frame = allocFrame(n - total);
+        if(!frame) {
+            return total;
+        }
+        memcpy(frame->data, out + total, frame->length);
+        bool queued = queueFrame(client, frame, 0, true);
+        releaseFrame(frame);
+        if(!queued) {
+            return total;
+        }
+    }
+    return n;
+#endif
+}
+
+/**
+ * write what the TCP send buffer takes right now, never waits
+ * @param client WSclient_t *
+ * @param out  uint8_t * data buffer
+ * @param n size_t byte count
+ * @return bytes send
+ */
+size_t WebSockets::writeNow(WSclient_t * client, uint8_t * out, size_t n) {
+    if(client->tcp == NULL || !client->tcp->connected()) {
+        return 0;
+    }
+#ifdef WEBSOCKETS_TCP_AVAILABLE_FOR_WRITE
+    size_t room = client->tcp->availableForWrite();
+    if(n > room) {
+        n = room;
+    }
+    if(n == 0) {
+        return 0;
+    }
+#endif
+    return client->tcp->write((const uint8_t *)out, n);
+}
+
+/**
+ * collect a HTTP header line as its bytes arrive, never waits
+ * @param client WSclient_t *
+ * @param line String *  the line without the '\n' once complete
+ * @return true if a line is complete
+ */
+bool WebSockets::readLine(WSclient_t * client, String * line) {
+    int len = client->tcp->available();
+    while(len-- > 0) {
+        int c = client->tcp->read();
+        if(c < 0) {
+            break;
+        }
+        client->cWsRXlast = millis();
+        if(c == '\n') {
+            *line             = client->cHttpLine;
+            client->cHttpLine = "";
+            return true;
+        }
+        client->cHttpLine += (char)c;
+    }
+    return false;
 }
 
 size_t WebSockets::write(WSclient_t * client, const char * out) {
@@ -78,6 +78,14 @@
 
 #define WEBSOCKETS_TCP_TIMEOUT (2000)
 
+#ifndef WEBSOCKETS_TX_QUEUE_MAX
+#define WEBSOCKETS_TX_QUEUE_MAX (8)    ///< frames waiting per client for room in the TCP send buffer (max 16)
+#endif
+
+#ifndef WEBSOCKETS_TX_QUEUE_BYTES
+#define WEBSOCKETS_TX_QUEUE_BYTES (4096)    ///< bytes waiting per client, older frames are dropped past it
+#endif
+
 #define NETWORK_ESP8266_ASYNC (0)
 #define NETWORK_ESP8266 (1)
 #define NETWORK_W5100 (2)
@@ -182,6 +190,11 @@
 #define HAS_SSL
 #endif
 
+// write() never waits for the TCP send buffer, only what fits is written and the rest is queued
+#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266) && !defined(WEBSOCKETS_TCP_NO_AVAILABLE_FOR_WRITE)
+#define WEBSOCKETS_TCP_AVAILABLE_FOR_WRITE
+#endif
+
 // moves all Header strings to Flash (~300 Byte)
 #ifdef WEBSOCKETS_SAVE_RAM
 #define WEBSOCKETS_STRING(var) F(var)
@@ -234,6 +247,20 @@ typedef struct {
     uint8_t * maskKey;
 } WSMessageHeader_t;
 
+/**
+ * frame (header + payload) encoded once, written to several clients or queued until a client
+ * has room for it, freed when the last reference is released
+ */
+typedef struct {
+    uint8_t * data;     ///< first byte of the header
+    size_t length;      ///< header + payload
+    uint8_t refs;
+} WSframe_t;
+
+#ifndef WEBSOCKETS_SHARED_FRAME_MIN_HEAP
+#define WEBSOCKETS_SHARED_FRAME_MIN_HEAP (6000)    ///< free heap to keep after allocating a shared frame
+#endif
+
 typedef struct {
     uint8_t num;    ///< connection number
 
@@ -265,6 +292,17 @@ typedef struct {
     uint8_t cWsRXsize;                                ///< State of the RX
     uint8_t cWsHeader[WEBSOCKETS_MAX_HEADER_SIZE];    ///< RX WS Message buffer
     WSMessageHeader_t cWsHeaderDecode;
+    uint8_t * cWsPayload = NULL;    ///< payload of the frame being received
+    size_t cWsPayloadRX  = 0;       ///< bytes of cWsPayload received so far
+    uint32_t cWsRXlast   = 0;       ///< millis of the last byte of a partial frame
+
+    WSframe_t * txQueue[WEBSOCKETS_TX_QUEUE_MAX];    ///< frames waiting to be written, [0] may be partially written
+    uint8_t txCount   = 0;
+    uint16_t txPinned = 0;    ///< bit per txQueue entry that can not be dropped (rest of a frame already started)
+    size_t txOffset   = 0;    ///< bytes of txQueue[0] already written
+    size_t txBytes    = 0;    ///< bytes queued and not written yet
+    uint32_t txLast   = 0;    ///< millis of the last progress of txQueue[0]
+    uint32_t txDrops  = 0;    ///< frames dropped because the queue was full
 
     String base64Authorization;    ///< Base64 encoded Auth request
     String plainAuthorization;     ///< Base64 encoded Auth request
@@ -281,9 +319,7 @@ typedef struct {
     uint8_t disconnectTimeoutCount;    // after how many subsequent pong timeouts discconnect will happen, 0 means "do not disconnect"
     uint8_t pongTimeoutCount;          // current pong timeout count
 
-#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
     String cHttpLine;    ///< HTTP header lines
-#endif
 
 } WSclient_t;
 
@@ -306,6 +342,22 @@ class WebSockets {
     bool sendFrameHeader(WSclient_t * client, WSopcode_t opcode, size_t length = 0, bool fin = true);
     bool sendFrame(WSclient_t * client, WSopcode_t opcode, uint8_t * payload = NULL, size_t length = 0, bool fin = true, bool headerToPayload = false);
 
+    WSframe_t * createFrame(WSopcode_t opcode, uint8_t * payload, size_t length, bool fin, bool headerToPayload, size_t * copied, bool mask = false);
+    WSframe_t * allocFrame(size_t length);
+    void retainFrame(WSframe_t * frame);
+    void releaseFrame(WSframe_t * frame);
+    bool sendFrame(WSclient_t * client, WSframe_t * frame);
+
+    bool queueFrame(WSclient_t * client, WSframe_t * frame, size_t offset, bool pinned);
+    void handleTX(WSclient_t * client);
+    void handleRXTimeout(WSclient_t * client);
+    void clearBuffers(WSclient_t * client);
+    size_t writeNow(WSclient_t * client, uint8_t * out, size_t n);
+    bool readLine(WSclient_t * client, String * line);
+
+    uint32_t _txDrops = 0;    ///< frames dropped by full client queues
+    uint32_t _txKicks = 0;    ///< clients disconnected because they could not keep up
+
     void headerDone(WSclient_t * client);
 
     void handleWebsocket(WSclient_t * client);
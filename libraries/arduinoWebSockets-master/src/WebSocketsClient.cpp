@@ -440,6 +440,8 @@ void WebSocketsClient::clientDisconnect(WSclient_t * client) {
     client->cIsWebsocket = false;
     client->cSessionId   = "";
 
+    clearBuffers(client);
+
     client->status = WSC_NOT_CONNECTED;
 
     DEBUG_WEBSOCKETS("[WS-Client] client disconnected.\n");
@@ -483,12 +485,18 @@ bool WebSocketsClient::clientIsConnected(WSclient_t * client) {
  * Handel incomming data from Client
  */
 void WebSocketsClient::handleClientData(void) {
+    handleTX(&_client);
+    if(!clientIsConnected(&_client)) {
+        return;
+    }
     int len = _client.tcp->available();
     if(len > 0) {
         switch(_client.status) {
             case WSC_HEADER: {
-                String headerLine = _client.tcp->readStringUntil('\n');
-                handleHeader(&_client, &headerLine);
+                String headerLine;
+                if(readLine(&_client, &headerLine)) {
+                    handleHeader(&_client, &headerLine);
+                }
             } break;
             case WSC_CONNECTED:
                 WebSockets::handleWebsocket(&_client);
@@ -497,6 +505,8 @@ void WebSocketsClient::handleClientData(void) {
                 WebSockets::clientDisconnect(&_client, 1002);
                 break;
         }
+    } else {
+        handleRXTimeout(&_client);
     }
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP32)
     delay(0);
@@ -743,7 +753,8 @@ void WebSocketsClient::connectedCb() {
         this, std::placeholders::_1, &_client));
 #endif
 
-    _client.status = WSC_HEADER;
+    _client.status    = WSC_HEADER;
+    _client.cWsRXlast = millis();
 
 #if(WEBSOCKETS_NETWORK_TYPE != NETWORK_ESP8266_ASYNC)
     // set Timeout for readBytesUntil and readStringUntil
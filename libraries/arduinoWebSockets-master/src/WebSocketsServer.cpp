@@ -47,6 +47,9 @@ WebSocketsServer::WebSocketsServer(uint16_t port, String origin, String protocol
     _mandatoryHttpHeaderCount = 0;
 
     memset(&_clients[0], 0x00, (sizeof(WSclient_t) * WEBSOCKETS_SERVER_CLIENT_MAX));
+    memset(&_broadcastStats, 0x00, sizeof(WSbroadcastStats_t));
+    memset(&_ioStats, 0x00, sizeof(WSioStats_t));
+    _ioMicros = 0;
 }
 
 WebSocketsServer::~WebSocketsServer() {
@@ -127,9 +130,17 @@ void WebSocketsServer::close(void) {
  * called in arduino loop
  */
 void WebSocketsServer::loop(void) {
+    _ioStats.lastMicros = _ioMicros;
+    if(_ioStats.maxMicros < _ioMicros) {
+        _ioStats.maxMicros = _ioMicros;
+    }
+    _ioMicros = 0;
+
     if(_runnning) {
+        unsigned long start = micros();
         handleNewClients();
         handleClientData();
+        _ioMicros += (micros() - start);
     }
 }
 #endif
@@ -182,7 +193,10 @@ bool WebSocketsServer::sendTXT(uint8_t num, uint8_t * payload, size_t length, bo
     }
     WSclient_t * client = &_clients[num];
     if(clientIsConnected(client)) {
-        return sendFrame(client, WSop_text, payload, length, true, headerToPayload);
+        unsigned long start = micros();
+        bool ret            = sendFrame(client, WSop_text, payload, length, true, headerToPayload);
+        _ioMicros += (micros() - start);
+        return ret;
     }
     return false;
 }
@@ -211,24 +225,10 @@ bool WebSocketsServer::sendTXT(uint8_t num, String & payload) {
  * @return true if ok
  */
 bool WebSocketsServer::broadcastTXT(uint8_t * payload, size_t length, bool headerToPayload) {
-    WSclient_t * client;
-    bool ret = true;
     if(length == 0) {
         length = strlen((const char *)payload);
     }
-
-    for(uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
-        client = &_clients[i];
-        if(clientIsConnected(client)) {
-            if(!sendFrame(client, WSop_text, payload, length, true, headerToPayload)) {
-                ret = false;
-            }
-        }
-#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266)
-        delay(0);
-#endif
-    }
-    return ret;
+    return broadcastFrame(WSop_text, payload, length, headerToPayload);
 }
 
 bool WebSocketsServer::broadcastTXT(const uint8_t * payload, size_t length) {
@@ -247,6 +247,65 @@ bool WebSocketsServer::broadcastTXT(String & payload) {
     return broadcastTXT((uint8_t *)payload.c_str(), payload.length());
 }
 
+/**
+ * encode the frame once and write the same buffer to every connected client,
+ * under low heap header and payload are written separately to each client instead
+ * @param opcode WSopcode_t
+ * @param payload uint8_t *
+ * @param length size_t
+ * @param headerToPayload bool  (see sendFrame for more details)
+ * @return true if ok
+ */
+bool WebSocketsServer::broadcastFrame(WSopcode_t opcode, uint8_t * payload, size_t length, bool headerToPayload) {
+    WSclient_t * client;
+    bool ret          = true;
+    bool encoded      = false;
+    WSframe_t * frame = NULL;
+    size_t copied     = 0;
+    size_t sent       = 0;
+    uint8_t * data    = headerToPayload ? (payload + WEBSOCKETS_MAX_HEADER_SIZE) : payload;
+    size_t headerSize = (length < 126) ? 2 : ((length < 0xFFFF) ? 4 : 10);
+    unsigned long start = micros();
+
+    for(uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
+        client = &_clients[i];
+        if(clientIsConnected(client)) {
+            if(!encoded) {
+                // first client, encode it now so nothing is allocated when nobody listens
+                encoded = true;
+                frame   = createFrame(opcode, payload, length, true, headerToPayload, &copied);
+                _broadcastStats.broadcasts++;
+                if(frame == NULL) {
+                    _broadcastStats.fallbacks++;
+                }
+            }
+            if(frame) {
+                if(sendFrame(client, frame)) {
+                    sent += frame->length;
+                } else {
+                    ret = false;
+                }
+            } else {
+                if(sendFrameHeader(client, opcode, length) && (length == 0 || write(client, data, length) == length)) {
+                    sent += headerSize + length;
+                } else {
+                    ret = false;
+                }
+            }
+        }
+#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266)
+        delay(0);
+#endif
+    }
+
+    releaseFrame(frame);
+    _ioMicros += (micros() - start);
+    _broadcastStats.copied += copied;
+    _broadcastStats.lastCopied = copied;
+    _broadcastStats.lastSent   = sent;
+    return ret;
+}
+
 /**
  * send binary data to client
  * @param num uint8_t client id
@@ -261,7 +320,10 @@ bool WebSocketsServer::sendBIN(uint8_t num, uint8_t * payload, size_t length, bo
     }
     WSclient_t * client = &_clients[num];
     if(clientIsConnected(client)) {
-        return sendFrame(client, WSop_binary, payload, length, true, headerToPayload);
+        unsigned long start = micros();
+        bool ret            = sendFrame(client, WSop_binary, payload, length, true, headerToPayload);
+        _ioMicros += (micros() - start);
+        return ret;
     }
     return false;
 }
@@ -278,20 +340,7 @@ bool WebSocketsServer::sendBIN(uint8_t num, const uint8_t * payload, size_t leng
  * @return true if ok
  */
 bool WebSocketsServer::broadcastBIN(uint8_t * payload, size_t length, bool headerToPayload) {
-    WSclient_t * client;
-    bool ret = true;
-    for(uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
-        client = &_clients[i];
-        if(clientIsConnected(client)) {
-            if(!sendFrame(client, WSop_binary, payload, length, true, headerToPayload)) {
-                ret = false;
-            }
-        }
-#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266)
-        delay(0);
-#endif
-    }
-    return ret;
+    return broadcastFrame(WSop_binary, payload, length, headerToPayload);
 }
 
 bool WebSocketsServer::broadcastBIN(const uint8_t * payload, size_t length) {
@@ -416,6 +465,24 @@ int WebSocketsServer::connectedClients(bool ping) {
     return count;
 }
 
+/**
+ * counters of the shared frame broadcast path
+ * @return WSbroadcastStats_t
+ */
+const WebSocketsServer::WSbroadcastStats_t & WebSocketsServer::getBroadcastStats(void) {
+    return _broadcastStats;
+}
+
+/**
+ * counters of the non blocking I/O, queue depth and time spent per loop
+ * @return WSioStats_t
+ */
+const WebSocketsServer::WSioStats_t & WebSocketsServer::getIOStats(void) {
+    _ioStats.drops = _txDrops;
+    _ioStats.kicks = _txKicks;
+    return _ioStats;
+}
+
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP32)
 /**
  * get an IP for a client
@@ -460,7 +527,8 @@ bool WebSocketsServer::newClient(WEBSOCKETS_NETWORK_CLASS * TCPclient) {
             // set Timeout for readBytesUntil and readStringUntil
             client->tcp->setTimeout(WEBSOCKETS_TCP_TIMEOUT);
 #endif
-            client->status = WSC_HEADER;
+            client->status    = WSC_HEADER;
+            client->cWsRXlast = millis();
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP32)
 #ifndef NODEBUG_WEBSOCKETS
             IPAddress ip = client->tcp->remoteIP();
@@ -566,11 +634,7 @@ void WebSocketsServer::clientDisconnect(WSclient_t * client) {
     client->cIsUpgrade   = false;
     client->cIsWebsocket = false;
 
-    client->cWsRXsize = 0;
-
-#if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC)
-    client->cHttpLine = "";
-#endif
+    clearBuffers(client);
 
     client->status = WSC_NOT_CONNECTED;
 
@@ -658,16 +722,23 @@ void WebSocketsServer::handleNewClients(void) {
  */
 void WebSocketsServer::handleClientData(void) {
     WSclient_t * client;
+    uint8_t depth = 0;
+    size_t queued = 0;
     for(uint8_t i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX; i++) {
         client = &_clients[i];
+        if(clientIsConnected(client)) {
+            handleTX(client);
+        }
         if(clientIsConnected(client)) {
             int len = client->tcp->available();
             if(len > 0) {
                 //DEBUG_WEBSOCKETS("[WS-Server][%d][handleClientData] len: %d\n", client->num, len);
                 switch(client->status) {
                     case WSC_HEADER: {
-                        String headerLine = client->tcp->readStringUntil('\n');
-                        handleHeader(client, &headerLine);
+                        String headerLine;
+                        if(readLine(client, &headerLine)) {
+                            handleHeader(client, &headerLine);
+                        }
                     } break;
                     case WSC_CONNECTED:
                         WebSockets::handleWebsocket(client);
@@ -676,12 +747,20 @@ void WebSocketsServer::handleClientData(void) {
                         WebSockets::clientDisconnect(client, 1002);
                         break;
                 }
+            } else {
+                handleRXTimeout(client);
             }
         }
+        if(depth < client->txCount) {
+            depth = client->txCount;
+        }
+        queued += client->txBytes;
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266)
         delay(0);
 #endif
     }
+    _ioStats.depth  = depth;
+    _ioStats.queued = queued;
 }
 #endif
 
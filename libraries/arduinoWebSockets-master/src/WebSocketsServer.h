@@ -42,6 +42,23 @@ class WebSocketsServer : protected WebSockets {
     typedef std::function<bool(String headerName, String headerValue)> WebSocketServerHttpHeaderValFunc;
 #endif
 
+    typedef struct {
+        uint32_t broadcasts;    ///< broadcastTXT / broadcastBIN calls with at least one client
+        uint32_t fallbacks;     ///< broadcasts sent as header + payload per client (low heap)
+        uint32_t copied;        ///< payload bytes copied by all broadcasts
+        uint32_t lastCopied;    ///< payload bytes copied by the last broadcast
+        uint32_t lastSent;      ///< bytes written to all clients by the last broadcast
+    } WSbroadcastStats_t;
+
+    typedef struct {
+        uint32_t lastMicros;    ///< time in WebSocket I/O (loop, sends and broadcasts) between the last two loop calls
+        uint32_t maxMicros;     ///< highest lastMicros since boot
+        uint8_t depth;          ///< frames in the deepest client queue after the last loop
+        uint32_t queued;        ///< bytes queued for all clients after the last loop
+        uint32_t drops;         ///< frames dropped by full client queues
+        uint32_t kicks;         ///< clients disconnected because they could not keep up
+    } WSioStats_t;
+
     WebSocketsServer(uint16_t port, String origin = "", String protocol = "arduino");
     virtual ~WebSocketsServer(void);
 
@@ -94,6 +111,9 @@ class WebSocketsServer : protected WebSockets {
 
     int connectedClients(bool ping = false);
 
+    const WSbroadcastStats_t & getBroadcastStats(void);
+    const WSioStats_t & getIOStats(void);
+
 #if(WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP8266_ASYNC) || (WEBSOCKETS_NETWORK_TYPE == NETWORK_ESP32)
     IPAddress remoteIP(uint8_t num);
 #endif
@@ -115,6 +135,12 @@ class WebSocketsServer : protected WebSockets {
 
     bool _runnning;
 
+    WSbroadcastStats_t _broadcastStats;
+    WSioStats_t _ioStats;
+    uint32_t _ioMicros;    ///< time in WebSocket I/O since loop was last called
+
+    bool broadcastFrame(WSopcode_t opcode, uint8_t * payload, size_t length, bool headerToPayload);
+
     bool newClient(WEBSOCKETS_NETWORK_CLASS * TCPclient);
 
     void messageReceived(WSclient_t * client, WSopcode_t opcode, uint8_t * payload, size_t length, bool fin);
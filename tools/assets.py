@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""
+Pre-compresses the web interface into PROGMEM.
+
+Reads the string literals of libraries/HTTPServer/{app,scripts,styles}.h, gzips them and writes
+libraries/HTTPServer/assets.h with the compressed bytes and a strong ETag (content hash) for each.
+The script and style references in the page are versioned with their hash so browsers can keep
+them forever. Run it again every time one of those headers changes:
+
+    python3 tools/assets.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "libraries", "HTTPServer")
+
+# (source header, C name, content type)
+ASSETS = [
+	("styles.h", "Styles", "text/css"),
+	("scripts.h", "Scripts", "application/javascript"),
+	("app.h", "App", "text/html"),
+]
+
+ESCAPES = {b"n": b"\n", b"t": b"\t", b"r": b"\r", b"\"": b"\"", b"'": b"'", b"\\": b"\\"}
+
+
+def literal(path):
+	with open(path, "rb") as f:
+		source = f.read()
+	body = source[source.index(b"=") + 1:]
+	chunks = re.findall(rb'"((?:[^"\\]|\\.)*)"', body, re.S)
+	text = b"".join(chunks)
+	return re.sub(rb"\\(.)", lambda m: ESCAPES[m.group(1)], text)
+
+
+def etag(data):
+	return hashlib.sha256(data).hexdigest()[:16]
+
+
+def array(name, data):
+	lines = []
+	for i in range(0, len(data), 24):
+		lines.append("\t" + ", ".join("0x%02x" % b for b in data[i:i + 24]) + ",")
+	return "const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (name, "\n".join(lines))
+
+
+def main():
+	hashes = {}
+	out = [
+		"// Generated by tools/assets.py from app.h, scripts.h and styles.h, DO NOT EDIT\n",
+		"#ifndef __assets__\n#define __assets__\n\n#include <Arduino.h>\n",
+	]
+	for header, name, ctype in ASSETS:
+		plain = literal(os.path.join(ROOT, header))
+		if "App" == name:
+			plain = plain.replace(b"src='scripts.js'", b"src='scripts.js?v=" + hashes["Scripts"].encode() + b"'")
+			plain = plain.replace(b"href='styles.css'", b"href='styles.css?v=" + hashes["Styles"].encode() + b"'")
+		hashes[name] = etag(plain)
+		packed = gzip.compress(plain, 9, mtime=0) # mtime=0 keeps the output reproducible
+		out.append("\n// %s: %d bytes, %d gzipped\n" % (header, len(plain), len(packed)))
+		out.append(array(name + "Gz", packed))
+		out.append("const char %sETag[] PROGMEM = \"\\\"%s\\\"\";\n" % (name, hashes[name]))
+		out.append("const char %sType[] PROGMEM = \"%s\";\n" % (name, ctype))
+	out.append("\n#endif\n")
+	with open(os.path.join(ROOT, "assets.h"), "w") as f:
+		f.write("".join(out))
+
+
+if __name__ == "__main__":
+	main()
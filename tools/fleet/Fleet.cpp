@@ -0,0 +1,309 @@
+#include <Fleet.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// Gateway
+Gateway::Gateway(uint32_t index) : index(index) {
+	// locally administered, "FL" and the index: EUI 02464CFFFFxxxxxx
+	this->context.mac[1] = 'F';
+	this->context.mac[2] = 'L';
+	this->context.mac[3] = (uint8_t) (index >> 16);
+	this->context.mac[4] = (uint8_t) (index >> 8);
+	this->context.mac[5] = (uint8_t) index;
+
+	this->rfm = new RFM(&this->root, "rfm");
+	this->wan = new WAN(&this->root, "wan");
+	this->wan->rfm = this->rfm;
+}
+
+Gateway::~Gateway() {
+	delete this->wan;
+	delete this->rfm;
+}
+
+void Gateway::eui(char* text) const {
+	const uint8_t* id = this->wan->settings.id;
+	sprintf(text, "%02X%02X%02X%02X%02X%02X%02X%02X", id[0], id[1], id[2], id[3], id[4], id[5], id[6], id[7]);
+}
+
+void Gateway::sent(uint8_t server, const uint8_t* buffer, size_t size, uint64_t now) {
+	uint8_t identifier = buffer[3];
+	if (PUSH_DATA == identifier) {
+		this->pushes += 1u;
+	} else if (PULL_DATA == identifier) {
+		this->pulls += 1u;
+	} else {
+		return;
+	}
+	Pending& pending = this->pending[this->next];
+	if (pending.waiting) {
+		this->unacked += 1u;
+	}
+	pending.token = buffer[2] * 256 + buffer[1];
+	pending.identifier = identifier;
+	pending.server = server;
+	pending.sent = now;
+	pending.waiting = true;
+	this->next = (this->next + 1u) % FLEET_PENDING;
+}
+
+void Gateway::received(uint8_t server, const uint8_t* buffer, size_t size, uint64_t now) {
+	uint8_t identifier = buffer[3];
+	if (PUSH_ACK != identifier && PULL_ACK != identifier) {
+		return;
+	}
+	uint8_t request = PUSH_ACK == identifier ? PUSH_DATA : PULL_DATA;
+	uint16_t token = buffer[2] * 256 + buffer[1];
+	for (uint8_t i = 0u; i < FLEET_PENDING; i++) {
+		Pending& pending = this->pending[i];
+		if (pending.waiting && pending.token == token && pending.identifier == request && pending.server == server) {
+			pending.waiting = false;
+			(PUSH_DATA == request ? this->push : this->pull).add(now - pending.sent);
+			return;
+		}
+	}
+	this->duplicates += 1u;
+}
+
+uint64_t Gateway::unanswered(uint64_t before) const {
+	uint64_t unanswered = this->unacked;
+	for (uint8_t i = 0u; i < FLEET_PENDING; i++) {
+		if (this->pending[i].waiting && this->pending[i].sent < before) {
+			unanswered += 1u;
+		}
+	}
+	return unanswered;
+}
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// Fleet
+Fleet::Fleet() {
+}
+
+Fleet::~Fleet() {
+	WiFiUDP::sent = nullptr;
+	WiFiUDP::received = nullptr;
+	for (size_t i = 0u; i < this->gateways.size(); i++) {
+		delete this->gateways[i];
+	}
+	if (0 <= this->epoll) {
+		close(this->epoll);
+	}
+	if (0 <= this->timer) {
+		close(this->timer);
+	}
+}
+
+static int8_t serverOf(Gateway* gateway, WiFiUDP& udp) {
+	for (uint8_t i = 0u; i < BACKENDS; i++) {
+		if (gateway->wan->udps[i] == &udp) {
+			return (int8_t) i;
+		}
+	}
+	return -1;
+}
+
+bool Fleet::setup() {
+	this->random.seed(this->settings.seed);
+	srand(this->settings.seed); // the tokens of WAN::Message::Up
+
+	WiFiUDP::sent = [](WiFiUDP& udp, const uint8_t* buffer, size_t size) {
+		Gateway* gateway = (Gateway*) udp.owner;
+		int8_t server = serverOf(gateway, udp);
+		if (NULL != gateway && 4u <= size && 0 <= server) {
+			gateway->sent((uint8_t) server, buffer, size, Host::now());
+		}
+	};
+	WiFiUDP::received = [](WiFiUDP& udp, const uint8_t* buffer, size_t size) {
+		Gateway* gateway = (Gateway*) udp.owner;
+		int8_t server = serverOf(gateway, udp);
+		if (NULL != gateway && 4u <= size && 0 <= server) {
+			gateway->received((uint8_t) server, buffer, size, Host::now());
+		}
+	};
+
+	// the wake ups of the heap, epoll_wait alone waits whole milliseconds
+	this->epoll = epoll_create1(EPOLL_CLOEXEC);
+	this->timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	epoll_event tick;
+	tick.events = EPOLLIN;
+	tick.data.u64 = UINT64_MAX;
+	if (0 > this->epoll || 0 > this->timer || 0 != epoll_ctl(this->epoll, EPOLL_CTL_ADD, this->timer, &tick)) {
+		return false;
+	}
+
+	std::uniform_int_distribution<uint64_t> uptime(60000000ull, 40ull * 24ull * 3600ull * 1000000ull);
+	for (uint32_t i = 0ul; i < this->settings.gateways; i++) {
+		Gateway* gateway = new Gateway(i);
+		this->gateways.push_back(gateway);
+		gateway->context.boot(uptime(this->random));
+
+		Host::enter(&gateway->context);
+		gateway->rfm->setup();
+		WAN* wan = gateway->wan;
+		wan->settings.host = this->settings.host;
+		wan->settings.port = this->settings.port;
+		if (this->settings.servers.length() && !wan->backends.parse(this->settings.servers.c_str())) {
+			Host::leave();
+			return false;
+		}
+		wan->setup();
+
+		// stat spread over its interval, PULL_DATA over the first second: the downlink route is open early
+		uint64_t mstime = clock64.mstime();
+		wan->lstat = mstime - this->random() % wan->istat;
+		wan->lpull = mstime - wan->ipull + this->random() % 1000u;
+		Host::leave();
+
+		for (uint8_t j = 0u; j < wan->backends.length; j++) {
+			WiFiUDP* udp = wan->udps[j];
+			udp->owner = gateway;
+			epoll_event event;
+			event.events = EPOLLIN;
+			event.data.u64 = i;
+			if (0 > udp->fd || 0 != epoll_ctl(this->epoll, EPOLL_CTL_ADD, udp->fd, &event)) {
+				return false;
+			}
+		}
+
+		uint64_t now = Host::now();
+		gateway->frame = now + this->interval();
+		gateway->wake = UINT64_MAX;
+		this->schedule(gateway, now);
+	}
+	return true;
+}
+
+void Fleet::run(volatile bool& running) {
+	const int EVENTS = 256;
+	epoll_event events[EVENTS];
+	uint64_t end = Host::now() + this->settings.seconds * 1000000ull;
+
+	while (running) {
+		uint64_t now = Host::now();
+		if (end <= now) {
+			break;
+		}
+
+		uint64_t until = std::min(end, now + (uint64_t) 100000u);
+		while (!this->heap.empty() && this->heap.top().at != this->gateways[this->heap.top().gateway]->wake) {
+			this->heap.pop();
+		}
+		if (!this->heap.empty()) {
+			until = std::min(until, this->heap.top().at);
+		}
+		int n = 0;
+		if (now < until) {
+			uint64_t us = (uint64_t) ((until - now) / Host::speed) + 1u;
+			itimerspec timeout = {{0, 0}, {(time_t) (us / 1000000u), (long) (us % 1000000u) * 1000l}};
+			timerfd_settime(this->timer, 0, &timeout, NULL);
+			n = epoll_wait(this->epoll, events, EVENTS, -1);
+		} else {
+			n = epoll_wait(this->epoll, events, EVENTS, 0);
+		}
+		for (int i = 0; i < n; i++) {
+			if (UINT64_MAX == events[i].data.u64) {
+				uint64_t expirations;
+				ssize_t read = ::read(this->timer, &expirations, sizeof(expirations));
+				(void) read;
+				continue;
+			}
+			this->datagrams += 1u;
+			this->loop(this->gateways[events[i].data.u64], Host::now());
+		}
+
+		now = Host::now();
+		while (!this->heap.empty() && this->heap.top().at <= now) {
+			Wake wake = this->heap.top();
+			this->heap.pop();
+			Gateway* gateway = this->gateways[wake.gateway];
+			if (wake.at != gateway->wake) {
+				continue; // stale
+			}
+			gateway->wake = UINT64_MAX;
+			this->wakes += 1u;
+			this->loop(gateway, now);
+			now = Host::now();
+		}
+	}
+}
+
+void Fleet::loop(Gateway* gateway, uint64_t now) {
+	if (gateway->frame <= now) {
+		this->radio(gateway);
+		this->lag.add(now - gateway->frame);
+		gateway->frame += this->interval();
+	}
+
+	Host::enter(&gateway->context);
+	gateway->wan->loop();
+	Host::leave();
+	this->loops += 1u;
+
+	this->schedule(gateway, Host::now());
+}
+
+// the earliest of the next frame, stat, pull and downlink, now if uplinks are still queued
+void Fleet::schedule(Gateway* gateway, uint64_t now) {
+	WAN* wan = gateway->wan;
+	uint64_t offset = gateway->context.offset;
+	uint64_t at = gateway->frame;
+	at = std::min(at, (uint64_t) ((wan->lstat + wan->istat) * 1000ull - offset));
+	at = std::min(at, (uint64_t) ((wan->lpull + wan->ipull) * 1000ull - offset));
+	for (uint32_t i = 0ul; i < wan->schedules->length; i++) {
+		uint64_t local = Discipline::unwrap(wan->schedules->get(i)->tmst, gateway->context.clock.us);
+		at = std::min(at, local - offset - EMIT_ADVANCE);
+	}
+	if (wan->uplinks.length()) {
+		at = now;
+	}
+
+	if (at != gateway->wake) {
+		gateway->wake = at;
+		this->heap.push({at, gateway->index});
+	}
+}
+
+uint64_t Fleet::interval() {
+	if (0.0 >= this->settings.rate) {
+		return UINT64_MAX / 2u;
+	}
+	std::exponential_distribution<double> seconds(this->settings.rate);
+	return (uint64_t) (seconds(this->random) * 1e6) + 1u;
+}
+
+// a JoinRequest, a confirmed or an unconfirmed uplink of one of the 64 devices around the gateway
+void Fleet::radio(Gateway* gateway) {
+	uint8_t frame[32];
+	uint16_t size = 0u;
+	uint64_t r = this->random();
+	uint32_t kind = r % 100u;
+	uint32_t device = (uint32_t) (r >> 8) % 64u;
+	if (kind < 5u) {
+		frame[size++] = 0x00; // JoinRequest: JoinEUI, DevEUI, DevNonce, MIC
+		for (uint8_t i = 0u; i < 22u; i++) {
+			frame[size++] = (uint8_t) (this->random() >> 24);
+		}
+	} else {
+		frame[size++] = kind < 20u ? 0x80 : 0x40; // confirmed, unconfirmed data up
+		uint32_t devaddr = 0x26000000ul | ((gateway->index * 64ul + device) & 0x01FFFFFFul); // NetID 0x13
+		for (uint8_t i = 0u; i < 4u; i++) {
+			frame[size++] = (uint8_t) (devaddr >> (8u * i));
+		}
+		frame[size++] = 0x00; // FCtrl
+		frame[size++] = (uint8_t) gateway->fcnt;
+		frame[size++] = (uint8_t) (gateway->fcnt >> 8);
+		gateway->fcnt += 1u;
+		frame[size++] = 1u; // FPort
+		uint64_t payload = this->random();
+		for (uint8_t i = 0u; i < 16u; i++) { // 12 bytes of payload, 4 of MIC
+			frame[size++] = (uint8_t) (payload >> (4u * i));
+		}
+	}
+	int rssi = -120 + (int) (this->random() % 80u);
+	int8_t snr = (int8_t) (-40 + (int) (this->random() % 80u));
+	gateway->context.radio.receive(frame, size, rssi, snr);
+	gateway->frames += 1u;
+}
@@ -0,0 +1,126 @@
+/**
+ * Fleet of simulated gateways for the load tests of a network server, in one Linux process.
+ *
+ * Every gateway is the WAN and RFM of the firmware built for the host (tools/host): its own EUI (from
+ * its MAC address), its own micros() (booted at a random time), its own UDP sockets and a simulated
+ * radio receiving frames at random (Poisson) times. One thread runs them all, as the ESP8266 runs one:
+ *
+ *   [ epoll on the sockets of every gateway ]  --datagram-->  Host::enter, WAN::loop, Host::leave
+ *   [ heap of the next wake up of every gateway ]  --due-->   radio frame, stat, pull, downlink to emit
+ *
+ * A gateway only loops when something is due for it, thousands of idle ones cost nothing. The round
+ * trips of PUSH_DATA and PULL_DATA are measured on the sockets (WiFiUDP::sent and received) and kept
+ * per gateway in histograms; lag is how late the frames were handed to the radio, the simulation is
+ * only as faithful as it is small.
+ */
+
+#include <Host.h>
+#include <Histogram.h>
+#include <WAN.h>
+#include <RFM.h>
+#include <Node.h>
+#include <random>
+#include <vector>
+#include <queue>
+
+#ifndef __Fleet__
+#define __Fleet__
+
+#define FLEET_PENDING 16 // PUSH_DATA and PULL_DATA of a gateway waiting for their ACK
+// the tree of a gateway, logs and commands go nowhere
+class Root : public Node {
+	public:
+	uint64_t logs = 0ull;
+
+	Root() : Node(NULL, "root") {}
+	virtual JsonObject rootIT(JsonObject& root) { return root; }
+	virtual void command(JsonObject& command) { this->logs += 1u; }
+};
+
+class Gateway {
+	public:
+
+	class Pending {
+		public:
+		uint16_t token = 0u;
+		uint8_t identifier = 0u; // PUSH_DATA or PULL_DATA
+		uint8_t server = 0u;
+		uint64_t sent = 0ull;    // host us
+		bool waiting = false;    // no ACK yet
+	};
+
+	uint32_t index = 0ul;
+	Host::Context context;
+	Root root;
+	RFM* rfm = NULL;
+	WAN* wan = NULL;
+
+	uint64_t frame = 0ull;   // host us of the next radio frame
+	uint64_t wake = 0ull;    // host us of the next loop, in the heap of the fleet
+	uint16_t fcnt = 0u;
+
+	Pending pending[FLEET_PENDING];
+	uint8_t next = 0u;       // oldest of pending, overwritten first
+
+	Histogram push;          // PUSH_DATA to PUSH_ACK
+	Histogram pull;          // PULL_DATA to PULL_ACK
+	uint64_t frames = 0ull;  // handed to the radio
+	uint64_t pushes = 0ull;  // PUSH_DATA sent, rxpk and stat
+	uint64_t pulls = 0ull;
+	uint64_t unacked = 0ull; // PUSH_DATA and PULL_DATA overwritten without their ACK, see unanswered
+	uint64_t duplicates = 0ull; // ACK of no pending token
+
+	Gateway(uint32_t index);
+	virtual ~Gateway();
+	void eui(char* text) const; // 17 bytes
+	void sent(uint8_t server, const uint8_t* buffer, size_t size, uint64_t now);
+	void received(uint8_t server, const uint8_t* buffer, size_t size, uint64_t now);
+	uint64_t unanswered(uint64_t before) const; // unacked and the ones still waiting, sent before that host us
+};
+
+class Fleet {
+	public:
+
+	class Settings {
+		public:
+		uint32_t gateways = 100ul;
+		double rate = 0.2;          // frames per second per gateway
+		uint32_t seconds = 60ul;
+		String host = "127.0.0.1";
+		uint16_t port = 1700u;
+		String servers = "";        // more network servers, as the "servers" of WAN
+		uint32_t seed = 1ul;
+	};
+
+	Settings settings;
+	std::vector<Gateway*> gateways;
+	Histogram lag;                  // frame due to frame handed to the radio, us
+	uint64_t loops = 0ull;
+	uint64_t wakes = 0ull;          // by the heap
+	uint64_t datagrams = 0ull;      // epoll events
+	int epoll = -1;
+	int timer = -1;                 // timerfd of the next wake up
+
+	Fleet();
+	virtual ~Fleet();
+	bool setup(); // false when the sockets cannot be opened, see RLIMIT_NOFILE
+	void run(volatile bool& running);
+
+	protected:
+	class Wake {
+		public:
+		uint64_t at;
+		uint32_t gateway;
+		bool operator>(const Wake& other) const { return this->at > other.at; }
+	};
+
+	std::priority_queue<Wake, std::vector<Wake>, std::greater<Wake>> heap; // stale entries are skipped, see Gateway::wake
+	std::mt19937_64 random;
+
+	void loop(Gateway* gateway, uint64_t now);
+	void schedule(Gateway* gateway, uint64_t now);
+	void radio(Gateway* gateway); // the next frame in the FIFO of the gateway
+	uint64_t interval();          // us to the next frame of a gateway
+};
+
+#endif
@@ -0,0 +1,297 @@
+/*
+ Fleet of simulated gateways, see Fleet.h
+
+   fleet [--gateways 100] [--rate 0.2] [--seconds 60] [--server host:port] [--servers "host:port, ..."]
+         [--downlinks 0.1] [--csv file] [--seed 1] [--verbose]
+
+     --gateways   how many, each has 1 socket per network server: mind ulimit -n
+     --rate       radio frames per second of each gateway, Poisson
+     --seconds    how long
+     --server     the network server under test, its first one; a local one that acknowledges everything
+                  by default
+     --servers    more network servers, as the "servers" setting of the gateway ("host:port[ up], ...")
+     --downlinks  the local network server answers that fraction of the rxpk with a PULL_RESP for RX1
+     --csv        a line per gateway: EUI, frames, PUSH_DATA, PULL_DATA, unacknowledged, PUSH_ACK and
+                  PULL_ACK round trip percentiles in us
+     --seed       of the frames, the clocks of the gateways and the tokens
+     --verbose    what the gateways print on Serial
+
+ Prints the round trips of the whole fleet, the 10 gateways with the worst p99 and the lag of the
+ simulation itself: when it is a good part of the round trips, run fewer gateways per process.
+*/
+#include <Fleet.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/resource.h>
+#include <sys/prctl.h>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <algorithm>
+
+static volatile bool running = true;
+
+static void stop(int) {
+	running = false;
+}
+
+static void usage() {
+	printf("fleet [--gateways 100] [--rate 0.2] [--seconds 60] [--server host:port] [--servers \"host:port, ...\"]\n");
+	printf("      [--downlinks 0.1] [--csv file] [--seed 1] [--verbose]\n");
+}
+
+// a network server on 127.0.0.1 that acknowledges everything and answers some uplinks in RX1
+class Server {
+	public:
+	int fd = -1;
+	uint16_t port = 0u;
+	double downlinks = 0.0;
+	volatile bool running = true;
+	std::atomic<uint64_t> push{0ull};
+	std::atomic<uint64_t> pull{0ull};
+	std::atomic<uint64_t> resp{0ull};
+	std::atomic<uint64_t> txack{0ull};
+	std::atomic<uint64_t> refused{0ull}; // TX_ACK with an error
+
+	Server(double downlinks) : downlinks(downlinks) {
+		this->fd = socket(AF_INET, SOCK_DGRAM, 0);
+		sockaddr_in address;
+		memset(&address, 0, sizeof(address));
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		bind(this->fd, (sockaddr*) &address, sizeof(address));
+		socklen_t length = sizeof(address);
+		getsockname(this->fd, (sockaddr*) &address, &length);
+		this->port = ntohs(address.sin_port);
+		timeval timeout = {0, 100000};
+		setsockopt(this->fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		int size = 4 << 20;
+		setsockopt(this->fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+	}
+
+	~Server() {
+		close(this->fd);
+	}
+
+	void run() {
+		std::unordered_map<uint64_t, sockaddr_in> routes; // EUI to the address of its PULL_DATA
+		std::mt19937 random(7u);
+		std::uniform_real_distribution<double> draw(0.0, 1.0);
+		uint8_t buffer[UDP_DATAGRAM + 1];
+		uint16_t token = 0u;
+		while (this->running) {
+			sockaddr_in from;
+			socklen_t length = sizeof(from);
+			ssize_t n = recvfrom(this->fd, buffer, UDP_DATAGRAM, 0, (sockaddr*) &from, &length);
+			if (4 > n) {
+				continue;
+			}
+			buffer[n] = '\0';
+			uint8_t identifier = buffer[3];
+			uint64_t eui = 0ull;
+			for (uint8_t i = 4u; i < 12u && i < n; i++) {
+				eui = (eui << 8) | buffer[i];
+			}
+			uint8_t ack[4] = {PROTOCOL_VERSION, buffer[1], buffer[2], PUSH_ACK};
+			if (PUSH_DATA == identifier) {
+				this->push += 1u;
+				sendto(this->fd, ack, sizeof(ack), 0, (sockaddr*) &from, length);
+				const char* tmst = strstr((const char*) buffer + HEADER_LENGTH, "\"tmst\":");
+				auto route = routes.find(eui);
+				if (NULL != tmst && routes.end() != route && draw(random) < this->downlinks) {
+					// RX1 of EU868 on the channel of the simulated radio, 12 bytes of unconfirmed data down
+					uint32_t rx1 = (uint32_t) strtoul(tmst + 7, NULL, 10) + 1000000ul;
+					char json[512];
+					token += 1u;
+					json[0] = PROTOCOL_VERSION;
+					json[1] = (char) token;
+					json[2] = (char) (token >> 8);
+					json[3] = PULL_RESP;
+					int size = snprintf(json + 4, sizeof(json) - 4u, "{\"txpk\":{\"imme\":false,\"tmst\":%u,\"freq\":868.3,"
+						"\"rfch\":0,\"powe\":14,\"modu\":\"LORA\",\"datr\":\"SF7BW125\",\"codr\":\"4/5\",\"ipol\":true,"
+						"\"size\":12,\"data\":\"YAEAACYAAQABAgME\"}}", rx1);
+					sendto(this->fd, json, 4 + size, 0, (sockaddr*) &route->second, sizeof(route->second));
+					this->resp += 1u;
+				}
+			} else if (PULL_DATA == identifier) {
+				this->pull += 1u;
+				routes[eui] = from;
+				ack[3] = PULL_ACK;
+				sendto(this->fd, ack, sizeof(ack), 0, (sockaddr*) &from, length);
+			} else if (TX_ACK == identifier) {
+				this->txack += 1u;
+				if (NULL == strstr((const char*) buffer + HEADER_LENGTH, "\"NONE\"")) {
+					this->refused += 1u;
+				}
+			}
+		}
+	}
+};
+
+static void line(const char* name, const Histogram& histogram) {
+	printf("%-20s %9llu  p50 %8llu  p90 %8llu  p99 %8llu  max %8llu us\n", name, (unsigned long long) histogram.count,
+		(unsigned long long) histogram.percentile(50.0), (unsigned long long) histogram.percentile(90.0),
+		(unsigned long long) histogram.percentile(99.0), (unsigned long long) histogram.max);
+}
+
+int main(int argc, char** argv) {
+	Fleet fleet;
+	double downlinks = 0.0;
+	const char* csv = NULL;
+	bool local = true;
+	Serial.quiet = true;
+	for (int i = 1; i < argc; i++) {
+		const char* option = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+		if (!strcmp(option, "--verbose")) {
+			Serial.quiet = false;
+			continue;
+		}
+		if (NULL == value) {
+			usage();
+			return 1;
+		}
+		i++;
+		if (!strcmp(option, "--gateways")) {
+			fleet.settings.gateways = strtoul(value, NULL, 10);
+		} else if (!strcmp(option, "--rate")) {
+			fleet.settings.rate = strtod(value, NULL);
+		} else if (!strcmp(option, "--seconds")) {
+			fleet.settings.seconds = strtoul(value, NULL, 10);
+		} else if (!strcmp(option, "--server")) {
+			const char* colon = strrchr(value, ':');
+			if (NULL == colon) {
+				usage();
+				return 1;
+			}
+			fleet.settings.host = String(std::string(value, colon - value));
+			fleet.settings.port = (uint16_t) strtoul(colon + 1, NULL, 10);
+			local = false;
+		} else if (!strcmp(option, "--servers")) {
+			fleet.settings.servers = value;
+		} else if (!strcmp(option, "--downlinks")) {
+			downlinks = strtod(value, NULL);
+		} else if (!strcmp(option, "--csv")) {
+			csv = value;
+		} else if (!strcmp(option, "--seed")) {
+			fleet.settings.seed = strtoul(value, NULL, 10);
+		} else {
+			usage();
+			return 1;
+		}
+	}
+
+	// a socket per gateway and network server
+	rlimit files;
+	getrlimit(RLIMIT_NOFILE, &files);
+	files.rlim_cur = files.rlim_max;
+	setrlimit(RLIMIT_NOFILE, &files);
+
+	prctl(PR_SET_TIMERSLACK, 1ul); // the wake ups to the microsecond, 50 us late by default
+	signal(SIGINT, stop);
+	signal(SIGTERM, stop);
+
+	Server* server = NULL;
+	std::thread* thread = NULL;
+	if (local) {
+		server = new Server(downlinks);
+		fleet.settings.host = "127.0.0.1";
+		fleet.settings.port = server->port;
+		thread = new std::thread(&Server::run, server);
+	}
+
+	printf("%u gateways, %.3f frames/s each, %u s, network server %s:%u%s\n", fleet.settings.gateways,
+		fleet.settings.rate, fleet.settings.seconds, fleet.settings.host.c_str(), fleet.settings.port, local ? " (local)" : "");
+	fflush(stdout);
+
+	rusage before;
+	bool ready = fleet.setup();
+	getrusage(RUSAGE_SELF, &before);
+	if (ready) {
+		fleet.run(running);
+	} else {
+		printf("setup failed after %u gateways: sockets (ulimit -n %llu) or --servers\n",
+			(unsigned) fleet.gateways.size(), (unsigned long long) files.rlim_cur);
+	}
+	rusage after;
+	getrusage(RUSAGE_SELF, &after);
+
+	if (NULL != server) {
+		usleep(200000); // the last ACKs
+		server->running = false;
+		thread->join();
+	}
+
+	uint64_t answered = Host::now() - 1000000ull; // the ACKs of the last second may still come
+	Histogram push, pull;
+	uint64_t frames = 0ull, pushes = 0ull, pulls = 0ull, unacked = 0ull, overwritten = 0ull, rxfw = 0ull, txnb = 0ull;
+	for (Gateway* gateway : fleet.gateways) {
+		push.add(gateway->push);
+		pull.add(gateway->pull);
+		frames += gateway->frames;
+		pushes += gateway->pushes;
+		pulls += gateway->pulls;
+		unacked += gateway->unanswered(answered);
+		overwritten += gateway->context.radio.overwritten;
+		rxfw += gateway->wan->statistics.rxfw;
+		txnb += gateway->wan->statistics.txnb;
+	}
+	double cpu = (after.ru_utime.tv_sec - before.ru_utime.tv_sec) + (after.ru_stime.tv_sec - before.ru_stime.tv_sec)
+		+ ((after.ru_utime.tv_usec - before.ru_utime.tv_usec) + (after.ru_stime.tv_usec - before.ru_stime.tv_usec)) / 1e6;
+
+	printf("frames %llu (overwritten in the FIFO %llu), forwarded %llu, PUSH_DATA %llu, PULL_DATA %llu, unacknowledged %llu\n",
+		(unsigned long long) frames, (unsigned long long) overwritten, (unsigned long long) rxfw,
+		(unsigned long long) pushes, (unsigned long long) pulls, (unsigned long long) unacked);
+	if (NULL != server) {
+		printf("local network server: PUSH_DATA %llu, PULL_DATA %llu, PULL_RESP %llu, TX_ACK %llu (refused %llu), emitted %llu\n",
+			(unsigned long long) server->push, (unsigned long long) server->pull, (unsigned long long) server->resp,
+			(unsigned long long) server->txack, (unsigned long long) server->refused, (unsigned long long) txnb);
+	}
+	line("PUSH_ACK round trip", push);
+	line("PULL_ACK round trip", pull);
+	line("lag of the frames", fleet.lag);
+	printf("loops %llu (%llu on datagrams, %llu timed), CPU %.2f s, %.1f us per loop\n", (unsigned long long) fleet.loops,
+		(unsigned long long) fleet.datagrams, (unsigned long long) fleet.wakes, cpu, fleet.loops ? cpu * 1e6 / fleet.loops : 0.0);
+
+	std::vector<Gateway*> worst(fleet.gateways);
+	std::sort(worst.begin(), worst.end(), [](Gateway* a, Gateway* b) {
+		return a->push.percentile(99.0) > b->push.percentile(99.0);
+	});
+	printf("worst p99 of PUSH_ACK:\n");
+	for (size_t i = 0u; i < worst.size() && i < 10u; i++) {
+		char eui[17];
+		worst[i]->eui(eui);
+		line(eui, worst[i]->push);
+	}
+
+	if (NULL != csv) {
+		FILE* file = fopen(csv, "w");
+		if (NULL == file) {
+			printf("cannot write %s\n", csv);
+		} else {
+			fprintf(file, "eui,frames,push_data,pull_data,unacked,push_ack_n,push_p50,push_p90,push_p99,push_max,pull_ack_n,pull_p50,pull_p99,pull_max\n");
+			for (Gateway* gateway : fleet.gateways) {
+				char eui[17];
+				gateway->eui(eui);
+				const Histogram& p = gateway->push;
+				const Histogram& q = gateway->pull;
+				fprintf(file, "%s,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu\n", eui,
+					(unsigned long long) gateway->frames, (unsigned long long) gateway->pushes, (unsigned long long) gateway->pulls,
+					(unsigned long long) gateway->unanswered(answered), (unsigned long long) p.count, (unsigned long long) p.percentile(50.0),
+					(unsigned long long) p.percentile(90.0), (unsigned long long) p.percentile(99.0), (unsigned long long) p.max,
+					(unsigned long long) q.count, (unsigned long long) q.percentile(50.0), (unsigned long long) q.percentile(99.0),
+					(unsigned long long) q.max);
+			}
+			fclose(file);
+		}
+	}
+
+	delete thread;
+	delete server;
+	return ready ? 0 : 1;
+}
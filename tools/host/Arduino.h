@@ -0,0 +1,62 @@
+/**
+ * The part of the Arduino core of the ESP8266 the gateway libraries use, on Linux.
+ *
+ * millis() and micros() are the clock of the gateway running (Host::ustime), Serial prints to stderr
+ * unless Serial.quiet, PROGMEM is plain memory.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <WString.h>
+
+#ifndef __Arduino__
+#define __Arduino__
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define PSTR(text) (text)
+#define F(text) (text)
+#define FPSTR(text) ((const char*) (text))
+#define strcmp_P strcmp
+#define memcpy_P memcpy
+
+// NodeMCU pins to GPIO
+#define D0 16
+#define D1 5
+#define D2 4
+#define D3 0
+#define D4 2
+#define D5 14
+#define D6 12
+#define D7 13
+#define D8 15
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+class HardwareSerial {
+	public:
+	bool quiet = false;
+
+	void begin(unsigned long baud) {}
+	void print(const char* text) { if (!this->quiet) fputs(text, stderr); }
+	void print(const String& text) { this->print(text.c_str()); }
+	void println(const char* text) { if (!this->quiet) fprintf(stderr, "%s\n", text); }
+	void println(const String& text) { this->println(text.c_str()); }
+};
+
+extern HardwareSerial Serial;
+
+#endif
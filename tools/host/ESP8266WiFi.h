@@ -0,0 +1,16 @@
+#include <Arduino.h>
+
+#ifndef __ESP8266WiFi__
+#define __ESP8266WiFi__
+
+typedef enum { WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL = 1, WL_CONNECTED = 3, WL_CONNECTION_LOST = 5, WL_DISCONNECTED = 6 } wl_status_t;
+
+class ESP8266WiFiClass {
+	public:
+	wl_status_t status(); // Host::connected
+	uint8_t* macAddress(uint8_t* mac); // of the gateway running
+};
+
+extern ESP8266WiFiClass WiFi;
+
+#endif
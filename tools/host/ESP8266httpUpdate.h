@@ -0,0 +1 @@
+// System.h includes it for System::upgrade, which the host does not build
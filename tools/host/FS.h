@@ -0,0 +1,48 @@
+/**
+ * SPIFFS of the ESP8266 on the files of a host directory (Host::files), the path "/x.json" is
+ * directory/x.json. No directory set: nothing exists and what is written is dropped, a fresh gateway.
+ */
+
+#include <Arduino.h>
+#include <stdio.h>
+
+#ifndef __FS__
+#define __FS__
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File {
+	public:
+	FILE* file = NULL;
+	bool sink = false; // opened for writing with no directory
+
+	File() {}
+	File(FILE* file) : file(file) {}
+	operator bool() const { return NULL != this->file || this->sink; }
+
+	size_t write(uint8_t byte);
+	size_t write(const uint8_t* buffer, size_t size);
+	int read();
+	size_t read(uint8_t* buffer, size_t size);
+	int available();
+	String readStringUntil(char terminator);
+	bool seek(uint32_t position, SeekMode mode = SeekSet);
+	size_t position();
+	size_t size();
+	void flush();
+	void close();
+};
+
+class FS {
+	public:
+	String directory = "";
+
+	bool begin() { return true; }
+	bool exists(const String& path);
+	bool remove(const String& path);
+	File open(const String& path, const char* mode);
+};
+
+extern FS SPIFFS;
+
+#endif
@@ -0,0 +1,50 @@
+#include <Histogram.h>
+#include <algorithm>
+
+uint16_t Histogram::bucket(uint64_t us) {
+	if (us < HISTOGRAM_LINEAR) {
+		return (uint16_t) us;
+	}
+	uint8_t power = 63u - __builtin_clzll(us); // 5 and more
+	uint16_t bucket = HISTOGRAM_LINEAR + (power - 5u) * HISTOGRAM_STEPS + (uint16_t) ((us >> (power - 4u)) - HISTOGRAM_STEPS);
+	return std::min(bucket, (uint16_t) (HISTOGRAM_BUCKETS - 1u));
+}
+
+uint64_t Histogram::value(uint16_t bucket) {
+	if (bucket < HISTOGRAM_LINEAR) {
+		return bucket;
+	}
+	uint8_t power = (bucket - HISTOGRAM_LINEAR) / HISTOGRAM_STEPS + 5u;
+	uint64_t step = (bucket - HISTOGRAM_LINEAR) % HISTOGRAM_STEPS;
+	uint64_t width = 1ull << (power - 4u);
+	return (HISTOGRAM_STEPS + step) * width + width / 2u;
+}
+
+void Histogram::add(uint64_t us) {
+	this->counts[Histogram::bucket(us)] += 1u;
+	this->count += 1u;
+	this->max = std::max(this->max, us);
+}
+
+void Histogram::add(const Histogram& histogram) {
+	for (uint16_t i = 0u; i < HISTOGRAM_BUCKETS; i++) {
+		this->counts[i] += histogram.counts[i];
+	}
+	this->count += histogram.count;
+	this->max = std::max(this->max, histogram.max);
+}
+
+uint64_t Histogram::percentile(double p) const {
+	if (!this->count) {
+		return 0ull;
+	}
+	uint64_t rank = (uint64_t) (p / 100.0 * (double) (this->count - 1u));
+	uint64_t seen = 0ull;
+	for (uint16_t i = 0u; i < HISTOGRAM_BUCKETS; i++) {
+		seen += this->counts[i];
+		if (rank < seen) {
+			return std::min(Histogram::value(i), this->max);
+		}
+	}
+	return this->max;
+}
@@ -0,0 +1,29 @@
+/**
+ * Latencies in us of the host tools, log-linear: exact up to HISTOGRAM_LINEAR us, 6 % wide buckets up to
+ * 2^37 us. A percentile is the middle of its bucket, never more than the max seen.
+ */
+
+#include <stdint.h>
+
+#ifndef __Histogram__
+#define __Histogram__
+
+#define HISTOGRAM_LINEAR 32u // us, exact up to there
+#define HISTOGRAM_STEPS 16u  // then 16 buckets per power of 2, 6 % wide
+#define HISTOGRAM_BUCKETS (HISTOGRAM_LINEAR + 32u * HISTOGRAM_STEPS) // up to 2^37 us
+
+class Histogram {
+	public:
+	uint32_t counts[HISTOGRAM_BUCKETS] = {0};
+	uint64_t count = 0ull;
+	uint64_t max = 0ull;
+
+	void add(uint64_t us);
+	void add(const Histogram& histogram);
+	uint64_t percentile(double p) const; // us, the middle of the bucket, 0 when empty
+
+	static uint16_t bucket(uint64_t us);
+	static uint64_t value(uint16_t bucket);
+};
+
+#endif
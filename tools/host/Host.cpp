@@ -0,0 +1,602 @@
+#include <Host.h>
+#include <System.h>
+#include <ESP8266WiFi.h>
+#include <WiFiUdp.h>
+#include <FS.h>
+#include <sntp.h>
+#include <Scratch.h>
+#include <ctype.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <map>
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// Host
+Host::Context* Host::context = NULL;
+double Host::speed = 1.0;
+bool Host::manual = false;
+bool Host::connected = true;
+
+static uint64_t start = Host::monotonic();
+static uint64_t manualNow = 0ull;
+static Host::Context none; // millis() and micros() outside of any gateway
+
+uint64_t Host::monotonic() {
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * 1000000ull + (uint64_t) now.tv_nsec / 1000ull;
+}
+
+uint64_t Host::now() {
+	if (Host::manual) {
+		return manualNow;
+	}
+	return (uint64_t) ((double) (Host::monotonic() - start) * Host::speed);
+}
+
+void Host::set(uint64_t us) {
+	manualNow = us;
+}
+
+uint64_t Host::ustime() {
+	Context* context = NULL != Host::context ? Host::context : &none;
+	return Host::now() + context->offset;
+}
+
+void Host::Context::boot(uint64_t uptime) {
+	this->offset = uptime - Host::now();
+	uint64_t ms = uptime / 1000ull;
+	this->clock.us = uptime;
+	this->clock.h = ms & 0xFFFFFFFF00000000ull;
+	this->clock.low = (uint32_t) ms;
+}
+
+void Host::enter(Context* context) {
+	Host::context = context;
+	clock64 = context->clock;
+}
+
+void Host::leave() {
+	Host::context->clock = clock64;
+	Host::context = NULL;
+	scratch.reset();
+}
+
+bool Host::files(const char* directory) {
+	struct stat info;
+	if (0 != stat(directory, &info) || !S_ISDIR(info.st_mode)) {
+		return false;
+	}
+	SPIFFS.directory = directory;
+	return true;
+}
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// Arduino core
+HardwareSerial Serial;
+SPIClass SPI;
+
+unsigned long millis() {
+	return (unsigned long) (uint32_t) (Host::ustime() / 1000ull);
+}
+
+unsigned long micros() {
+	return (unsigned long) (uint32_t) Host::ustime();
+}
+
+void delay(unsigned long ms) {
+	if (!Host::manual) {
+		usleep((useconds_t) (ms * 1000ul / Host::speed));
+	}
+}
+
+void yield() {
+}
+
+uint32_t sntp_get_current_timestamp() {
+	return (uint32_t) time(NULL);
+}
+
+// what System.cpp defines on the ESP8266
+int System::Pins::length = 9;
+int System::Pins::VALUE[] = {D0, D1, D2, D3, D4, D5, D6, D7, D8};
+
+Data::Packet::Packet(uint16_t size) {
+	this->size = size;
+	this->buffer = new uint8_t[size];
+}
+
+Data::Packet::~Packet() {
+	delete[] this->buffer;
+}
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// String
+bool String::equalsIgnoreCase(const String& text) const {
+	if (this->value.length() != text.value.length()) {
+		return false;
+	}
+	for (size_t i = 0u; i < this->value.length(); i++) {
+		if (tolower((unsigned char) this->value[i]) != tolower((unsigned char) text.value[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool String::endsWith(const String& text) const {
+	size_t length = text.value.length();
+	return length <= this->value.length() && 0 == this->value.compare(this->value.length() - length, length, text.value);
+}
+
+int String::indexOf(char c, unsigned int from) const {
+	size_t index = this->value.find(c, from);
+	return std::string::npos == index ? -1 : (int) index;
+}
+
+int String::indexOf(const String& text, unsigned int from) const {
+	size_t index = this->value.find(text.value, from);
+	return std::string::npos == index ? -1 : (int) index;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+	if (to < from) {
+		std::swap(from, to);
+	}
+	if (this->value.length() < from) {
+		return String();
+	}
+	return String(this->value.substr(from, to - from));
+}
+
+void String::toUpperCase() {
+	for (size_t i = 0u; i < this->value.length(); i++) {
+		this->value[i] = toupper((unsigned char) this->value[i]);
+	}
+}
+
+void String::toLowerCase() {
+	for (size_t i = 0u; i < this->value.length(); i++) {
+		this->value[i] = tolower((unsigned char) this->value[i]);
+	}
+}
+
+void String::trim() {
+	size_t first = this->value.find_first_not_of(" \t\r\n");
+	if (std::string::npos == first) {
+		this->value.clear();
+		return;
+	}
+	size_t last = this->value.find_last_not_of(" \t\r\n");
+	this->value = this->value.substr(first, last - first + 1u);
+}
+
+long String::toInt() const {
+	return strtol(this->value.c_str(), NULL, 10);
+}
+
+double String::toDouble() const {
+	return strtod(this->value.c_str(), NULL);
+}
+
+void String::number(long long number, unsigned char base) {
+	if (DEC == base && number < 0) {
+		this->number((unsigned long long) -number, base);
+		this->value.insert(0u, 1u, '-');
+	} else {
+		this->number((unsigned long long) number, base);
+	}
+}
+
+void String::number(unsigned long long number, unsigned char base) {
+	// as the core, in capitals, two's complement in the other bases
+	char digits[66];
+	char* digit = digits + sizeof(digits) - 1u;
+	*digit = '\0';
+	do {
+		unsigned int d = number % base;
+		*--digit = d < 10u ? '0' + d : 'A' + d - 10u;
+		number /= base;
+	} while (number);
+	this->value = digit;
+}
+
+void String::decimal(double number, unsigned char decimals) {
+	char text[64];
+	snprintf(text, sizeof(text), "%.*f", decimals, number);
+	this->value = text;
+}
+
+StringSumHelper operator+(const String& left, const String& right) {
+	StringSumHelper sum(left);
+	sum += right;
+	return sum;
+}
+
+StringSumHelper operator+(const String& left, const char* right) {
+	StringSumHelper sum(left);
+	sum += right;
+	return sum;
+}
+
+StringSumHelper operator+(const char* left, const String& right) {
+	StringSumHelper sum(left);
+	sum += right;
+	return sum;
+}
+
+StringSumHelper operator+(const String& left, char right) {
+	StringSumHelper sum(left);
+	sum += right;
+	return sum;
+}
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// WiFi
+ESP8266WiFiClass WiFi;
+
+wl_status_t ESP8266WiFiClass::status() {
+	return Host::connected ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+uint8_t* ESP8266WiFiClass::macAddress(uint8_t* mac) {
+	Host::Context* context = NULL != Host::context ? Host::context : &none;
+	memcpy(mac, context->mac, 6u);
+	return mac;
+}
+
+std::function<void(WiFiUDP&, const uint8_t*, size_t)> WiFiUDP::sent;
+std::function<void(WiFiUDP&, const uint8_t*, size_t)> WiFiUDP::received;
+
+// host:port to its address, getaddrinfo once for the whole fleet
+static bool resolve(const char* host, uint16_t port, sockaddr_storage* address, socklen_t* length) {
+	static std::map<std::string, std::pair<sockaddr_storage, socklen_t>> cache;
+	char key[300];
+	snprintf(key, sizeof(key), "%s:%u", host, port);
+	auto found = cache.find(key);
+	if (cache.end() == found) {
+		char service[8];
+		snprintf(service, sizeof(service), "%u", port);
+		addrinfo hints;
+		memset(&hints, 0, sizeof(hints));
+		hints.ai_family = AF_INET;
+		hints.ai_socktype = SOCK_DGRAM;
+		addrinfo* result = NULL;
+		sockaddr_storage resolved;
+		memset(&resolved, 0, sizeof(resolved));
+		socklen_t resolvedLength = 0u;
+		if (0 == getaddrinfo(host, service, &hints, &result) && NULL != result) {
+			memcpy(&resolved, result->ai_addr, result->ai_addrlen);
+			resolvedLength = result->ai_addrlen;
+			freeaddrinfo(result);
+		}
+		found = cache.insert(std::make_pair(std::string(key), std::make_pair(resolved, resolvedLength))).first; // the failures too
+	}
+	*address = found->second.first;
+	*length = found->second.second;
+	return 0u < *length;
+}
+
+WiFiUDP::~WiFiUDP() {
+	this->stop();
+}
+
+uint8_t WiFiUDP::begin(uint16_t port) {
+	this->stop();
+	this->fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (0 > this->fd) {
+		return 0u;
+	}
+	sockaddr_in local;
+	memset(&local, 0, sizeof(local));
+	local.sin_family = AF_INET;
+	local.sin_addr.s_addr = htonl(INADDR_ANY);
+	local.sin_port = 0u; // ephemeral, see WiFiUdp.h
+	if (0 != bind(this->fd, (sockaddr*) &local, sizeof(local))) {
+		this->stop();
+		return 0u;
+	}
+	return 1u;
+}
+
+void WiFiUDP::stop() {
+	if (0 <= this->fd) {
+		close(this->fd);
+		this->fd = -1;
+	}
+	this->inSize = 0u;
+	this->inPosition = 0u;
+}
+
+uint16_t WiFiUDP::localPort() {
+	sockaddr_in local;
+	socklen_t length = sizeof(local);
+	if (0 > this->fd || 0 != getsockname(this->fd, (sockaddr*) &local, &length)) {
+		return 0u;
+	}
+	return ntohs(local.sin_port);
+}
+
+int WiFiUDP::beginPacket(const char* host, uint16_t port) {
+	this->outSize = 0u;
+	if (this->offline) {
+		this->resolved = true;
+		return 1;
+	}
+	sockaddr_storage address;
+	socklen_t length = 0u;
+	this->resolved = resolve(host, port, &address, &length) && length <= sizeof(this->address);
+	if (this->resolved) {
+		memcpy(this->address, &address, length);
+		this->addressLength = length;
+	}
+	return this->resolved ? 1 : 0;
+}
+
+size_t WiFiUDP::write(uint8_t byte) {
+	return this->write(&byte, 1u);
+}
+
+size_t WiFiUDP::write(const uint8_t* buffer, size_t size) {
+	size_t n = min(size, sizeof(this->out) - this->outSize);
+	memcpy(this->out + this->outSize, buffer, n);
+	this->outSize += n;
+	return n;
+}
+
+int WiFiUDP::endPacket() {
+	bool sent = this->offline;
+	if (!this->offline && 0 <= this->fd && this->resolved) {
+		ssize_t n = sendto(this->fd, this->out, this->outSize, 0, (sockaddr*) this->address, this->addressLength);
+		sent = (ssize_t) this->outSize == n;
+	}
+	if (sent) {
+		this->datagrams += 1u;
+		if (WiFiUDP::sent) {
+			WiFiUDP::sent(*this, this->out, this->outSize);
+		}
+	} else {
+		this->failed += 1u;
+	}
+	this->outSize = 0u;
+	return sent ? 1 : 0;
+}
+
+int WiFiUDP::parsePacket() {
+	this->inSize = 0u;
+	this->inPosition = 0u;
+	ssize_t n = 0;
+	if (!this->inbox.empty()) {
+		n = (ssize_t) min(this->inbox.front().size(), sizeof(this->in));
+		memcpy(this->in, this->inbox.front().data(), n);
+		this->inbox.pop_front();
+	} else if (!this->offline && 0 <= this->fd) {
+		n = recv(this->fd, this->in, sizeof(this->in), MSG_DONTWAIT);
+	}
+	if (0 >= n) {
+		return 0;
+	}
+	this->inSize = (size_t) n;
+	if (WiFiUDP::received) {
+		WiFiUDP::received(*this, this->in, this->inSize);
+	}
+	return (int) n;
+}
+
+int WiFiUDP::available() {
+	return (int) (this->inSize - this->inPosition);
+}
+
+int WiFiUDP::read() {
+	return this->inPosition < this->inSize ? this->in[this->inPosition++] : -1;
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t size) {
+	size_t n = min(size, this->inSize - this->inPosition);
+	memcpy(buffer, this->in + this->inPosition, n);
+	this->inPosition += n;
+	return (int) n;
+}
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// SPIFFS
+FS SPIFFS;
+
+static std::string hostPath(const String& directory, const String& path) {
+	return directory.value + ('/' == path.charAt(0) ? "" : "/") + path.value;
+}
+
+bool FS::exists(const String& path) {
+	struct stat info;
+	return 0u < this->directory.length() && 0 == stat(hostPath(this->directory, path).c_str(), &info);
+}
+
+bool FS::remove(const String& path) {
+	return 0u < this->directory.length() && 0 == unlink(hostPath(this->directory, path).c_str());
+}
+
+File FS::open(const String& path, const char* mode) {
+	if (!this->directory.length()) {
+		File file;
+		file.sink = 'r' != mode[0];
+		return file;
+	}
+	// SPIFFS "r+" creates nothing either, "w" and "a" do
+	char flags[4] = {mode[0], '+' == mode[1] ? '+' : '\0', '\0', '\0'};
+	return File(fopen(hostPath(this->directory, path).c_str(), flags));
+}
+
+size_t File::write(uint8_t byte) {
+	return this->write(&byte, 1u);
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+	if (NULL == this->file) {
+		return this->sink ? size : 0u;
+	}
+	return fwrite(buffer, 1u, size, this->file);
+}
+
+int File::read() {
+	return NULL != this->file ? fgetc(this->file) : -1;
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+	return NULL != this->file ? fread(buffer, 1u, size, this->file) : 0u;
+}
+
+int File::available() {
+	if (NULL == this->file) {
+		return 0;
+	}
+	return (int) (this->size() - this->position());
+}
+
+String File::readStringUntil(char terminator) {
+	String text;
+	int c = this->read();
+	while (0 <= c && terminator != c) {
+		text += (char) c;
+		c = this->read();
+	}
+	return text;
+}
+
+bool File::seek(uint32_t position, SeekMode mode) {
+	int whence = SeekSet == mode ? SEEK_SET : (SeekCur == mode ? SEEK_CUR : SEEK_END);
+	return NULL != this->file && 0 == fseek(this->file, (long) position, whence);
+}
+
+size_t File::position() {
+	return NULL != this->file ? (size_t) ftell(this->file) : 0u;
+}
+
+size_t File::size() {
+	if (NULL == this->file) {
+		return 0u;
+	}
+	struct stat info;
+	fflush(this->file);
+	return 0 == fstat(fileno(this->file), &info) ? (size_t) info.st_size : 0u;
+}
+
+void File::flush() {
+	if (NULL != this->file) {
+		fflush(this->file);
+	}
+}
+
+void File::close() {
+	if (NULL != this->file) {
+		fclose(this->file);
+		this->file = NULL;
+	}
+	this->sink = false;
+}
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// LoRa
+LoRaClass LoRa;
+
+void Radio::receive(const uint8_t* frame, uint16_t size, int rssi, int8_t snr) {
+	if (this->pending) {
+		this->overwritten += 1u;
+	}
+	this->size = min(size, (uint16_t) RADIO_FIFO);
+	memcpy(this->buffer, frame, this->size);
+	this->position = 0u;
+	this->pending = true;
+	this->rssi = rssi;
+	this->snr = snr;
+	this->received += 1u;
+}
+
+Radio* LoRaClass::radio() {
+	return &(NULL != Host::context ? Host::context : &none)->radio;
+}
+
+int LoRaClass::begin(long frequency) {
+	this->radio()->frequency = frequency;
+	return 1;
+}
+
+int LoRaClass::beginPacket(int implicitHeader) {
+	this->radio()->ih = implicitHeader;
+	this->txSize = 0u;
+	return 1;
+}
+
+int LoRaClass::endPacket(bool async) {
+	Radio* radio = this->radio();
+	radio->transmitted += 1u;
+	if (this->transmitted) {
+		this->transmitted(*radio, this->tx, this->txSize);
+	}
+	radio->ih = false;
+	return 1;
+}
+
+int LoRaClass::parsePacket(int size) {
+	Radio* radio = this->radio();
+	if (!radio->pending) {
+		return 0;
+	}
+	radio->pending = false;
+	radio->position = 0u;
+	return radio->size;
+}
+
+int LoRaClass::packetRssi() {
+	return this->radio()->rssi;
+}
+
+float LoRaClass::packetSnr() {
+	return this->radio()->snr * 0.25f;
+}
+
+int8_t LoRaClass::packetSnrRaw() {
+	return this->radio()->snr;
+}
+
+size_t LoRaClass::write(uint8_t byte) {
+	return this->write(&byte, 1u);
+}
+
+size_t LoRaClass::write(const uint8_t* buffer, size_t size) {
+	size_t n = min(size, (size_t) (RADIO_FIFO - this->txSize));
+	memcpy(this->tx + this->txSize, buffer, n);
+	this->txSize += n;
+	return n;
+}
+
+int LoRaClass::available() {
+	Radio* radio = this->radio();
+	return radio->size - radio->position;
+}
+
+int LoRaClass::read() {
+	Radio* radio = this->radio();
+	return radio->position < radio->size ? radio->buffer[radio->position++] : -1;
+}
+
+int LoRaClass::peek() {
+	Radio* radio = this->radio();
+	return radio->position < radio->size ? radio->buffer[radio->position] : -1;
+}
+
+void LoRaClass::setTxPower(int level, int outputPin) { this->radio()->txpw = level; }
+void LoRaClass::setFrequency(long frequency) { this->radio()->frequency = frequency; }
+void LoRaClass::setSpreadingFactor(int sf) { this->radio()->sfac = sf; }
+void LoRaClass::setSignalBandwidth(long sbw) { this->radio()->sbw = sbw; }
+void LoRaClass::setCodingRate4(int denominator) { this->radio()->crat = denominator; }
+void LoRaClass::setPreambleLength(long length) { this->radio()->plength = length; }
+void LoRaClass::setSyncWord(int sw) { this->radio()->sw = sw; }
+void LoRaClass::enableCrc() { this->radio()->crc = true; }
+void LoRaClass::disableCrc() { this->radio()->crc = false; }
+void LoRaClass::enableInvertIQ() { this->radio()->iiq = true; }
+void LoRaClass::disableInvertIQ() { this->radio()->iiq = false; }
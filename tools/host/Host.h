@@ -0,0 +1,54 @@
+/**
+ * Runs the gateway libraries on Linux, many gateways in one process.
+ *
+ * The sources of the gateway are compiled unchanged against the headers of this directory, which stand
+ * for the Arduino core of the ESP8266 and its libraries: Arduino.h (millis, micros, Serial), WString.h,
+ * ESP8266WiFi.h, WiFiUdp.h (nonblocking UDP sockets), FS.h (SPIFFS in a directory), sntp.h and LoRa.h
+ * (a simulated radio). Host.cpp defines them, with what System.cpp would (Data::Packet, the pins).
+ *
+ * A gateway is a Host::Context: the offset of its micros() (when it booted), its MAC address (WAN takes
+ * the EUI from it), its radio and its SystemClock. enter makes it the running one, leave saves its clock
+ * and rewinds the scratch arena as the end of LoRaWanGateway::loop does:
+ *
+ *   Host::enter(&gateway->context);
+ *   gateway->wan->loop();
+ *   Host::leave();
+ */
+
+#include <Arduino.h>
+#include <SystemClock.h>
+#include <LoRa.h>
+
+#ifndef __Host__
+#define __Host__
+
+class Host {
+	public:
+
+	class Context {
+		public:
+		uint64_t offset = 0ull; // us, micros() = Host::now() + offset
+		uint8_t mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x00};
+		Radio radio;
+		SystemClock clock;
+
+		void boot(uint64_t uptime); // us the gateway has been running for, its clock as if it had ticked
+	};
+
+	static Context* context; // the gateway running, NULL between two of them
+	static double speed;     // host time runs that many times faster than the real time
+	static bool manual;      // the host time only moves with set, replays
+	static bool connected;   // WiFi.status()
+
+	static uint64_t now();   // us since the start of the process, times speed, or the one set
+	static void set(uint64_t us);
+	static uint64_t ustime(); // what micros() reads in 64 bits, now() + offset of the running gateway
+
+	static void enter(Context* context);
+	static void leave();
+
+	static bool files(const char* directory); // SPIFFS in that directory, none when it is not set
+	static uint64_t monotonic(); // us of CLOCK_MONOTONIC
+};
+
+#endif
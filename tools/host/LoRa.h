@@ -0,0 +1,88 @@
+/**
+ * The LoRaClass of arduino-LoRa on a simulated SX1276, the radio of the gateway running (Host::context).
+ *
+ * receive puts a frame in the FIFO, the next parsePacket returns it: like the SX1276 there is room
+ * for one, a frame not read yet is overwritten. endPacket counts the transmission and calls transmitted.
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <functional>
+
+#ifndef __LoRa__
+#define __LoRa__
+
+#define RADIO_FIFO 256
+
+class Radio {
+	public:
+	// the FIFO
+	uint8_t buffer[RADIO_FIFO];
+	uint16_t size = 0u;
+	uint16_t position = 0u;
+	bool pending = false;
+	int rssi = -60;
+	int8_t snr = 40; // in 0.25 dB, as the register
+
+	// the settings, as the registers
+	long frequency = 868100000l;
+	int txpw = 17;
+	int sfac = 7;
+	long sbw = 125000l;
+	int crat = 5;
+	long plength = 8l;
+	int sw = 0x12;
+	bool crc = false;
+	bool iiq = false;
+	bool ih = false;
+
+	uint32_t received = 0ul;    // frames put in the FIFO
+	uint32_t overwritten = 0ul; // frames overwritten before parsePacket
+	uint32_t transmitted = 0ul;
+
+	void receive(const uint8_t* frame, uint16_t size, int rssi, int8_t snr);
+};
+
+class LoRaClass {
+	public:
+	// the frame of a transmission, with the settings it went out with
+	std::function<void(Radio& radio, const uint8_t* frame, uint16_t size)> transmitted;
+
+	int begin(long frequency);
+	void end() {}
+	void setPins(int ss, int reset, int dio0) {}
+	void setSPI(SPIClass& spi) {}
+
+	int beginPacket(int implicitHeader = false);
+	int endPacket(bool async = false);
+	int parsePacket(int size = 0);
+	int packetRssi();
+	float packetSnr();
+	int8_t packetSnrRaw();
+	size_t write(uint8_t byte);
+	size_t write(const uint8_t* buffer, size_t size);
+	int available();
+	int read();
+	int peek();
+
+	void setTxPower(int level, int outputPin = 1);
+	void setFrequency(long frequency);
+	void setSpreadingFactor(int sf);
+	void setSignalBandwidth(long sbw);
+	void setCodingRate4(int denominator);
+	void setPreambleLength(long length);
+	void setSyncWord(int sw);
+	void enableCrc();
+	void disableCrc();
+	void enableInvertIQ();
+	void disableInvertIQ();
+
+	protected:
+	uint8_t tx[RADIO_FIFO];
+	uint16_t txSize = 0u;
+	Radio* radio();
+};
+
+extern LoRaClass LoRa;
+
+#endif
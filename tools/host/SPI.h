@@ -0,0 +1,8 @@
+#ifndef __SPI__
+#define __SPI__
+
+class SPIClass {};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,93 @@
+/**
+ * The String of the Arduino core on top of std::string, what the gateway and ArduinoJson use of it.
+ * Numbers are explicit as in the core: String(42), String(id, HEX), String(1.5, 2).
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+#ifndef __WString__
+#define __WString__
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class StringSumHelper;
+
+class String {
+	public:
+	std::string value;
+
+	String(const char* text = "") : value(NULL != text ? text : "") {}
+	String(const std::string& text) : value(text) {}
+	explicit String(char c) : value(1, c) {}
+	explicit String(unsigned char number, unsigned char base = DEC) { this->number(number, base); }
+	explicit String(int number, unsigned char base = DEC) { this->number(number, base); }
+	explicit String(unsigned int number, unsigned char base = DEC) { this->number(number, base); }
+	explicit String(long number, unsigned char base = DEC) { this->number(number, base); }
+	explicit String(unsigned long number, unsigned char base = DEC) { this->number(number, base); }
+	explicit String(long long number, unsigned char base = DEC) { this->number(number, base); }
+	explicit String(unsigned long long number, unsigned char base = DEC) { this->number(number, base); }
+	explicit String(float number, unsigned char decimals = 2) { this->decimal(number, decimals); }
+	explicit String(double number, unsigned char decimals = 2) { this->decimal(number, decimals); }
+
+	const char* c_str() const { return this->value.c_str(); }
+	unsigned int length() const { return this->value.length(); }
+	bool reserve(unsigned int size) { this->value.reserve(size); return true; }
+	char charAt(unsigned int index) const { return index < this->value.length() ? this->value[index] : '\0'; }
+	char operator[](unsigned int index) const { return this->charAt(index); }
+
+	String& operator+=(const String& text) { this->value += text.value; return *this; }
+	String& operator+=(const char* text) { this->value += text; return *this; }
+	String& operator+=(char c) { this->value += c; return *this; }
+	bool concat(const String& text) { this->value += text.value; return true; }
+	bool concat(char c) { this->value += c; return true; }
+
+	bool equals(const String& text) const { return this->value == text.value; }
+	bool equals(const char* text) const { return this->value == text; }
+	bool equalsIgnoreCase(const String& text) const;
+	bool startsWith(const String& text) const { return 0u == this->value.compare(0u, text.value.length(), text.value); }
+	bool endsWith(const String& text) const;
+	int indexOf(char c, unsigned int from = 0u) const;
+	int indexOf(const String& text, unsigned int from = 0u) const;
+	String substring(unsigned int from) const { return this->substring(from, this->value.length()); }
+	String substring(unsigned int from, unsigned int to) const;
+	void toUpperCase();
+	void toLowerCase();
+	void trim();
+	long toInt() const;
+	double toDouble() const;
+
+	bool operator==(const String& text) const { return this->value == text.value; }
+	bool operator==(const char* text) const { return this->value == text; }
+	bool operator!=(const String& text) const { return this->value != text.value; }
+	bool operator!=(const char* text) const { return this->value != text; }
+	bool operator<(const String& text) const { return this->value < text.value; }
+
+	protected:
+	void number(long long number, unsigned char base);
+	void number(unsigned long long number, unsigned char base);
+	void number(int number, unsigned char base) { this->number((long long) number, base); }
+	void number(unsigned int number, unsigned char base) { this->number((unsigned long long) number, base); }
+	void number(long number, unsigned char base) { this->number((long long) number, base); }
+	void number(unsigned long number, unsigned char base) { this->number((unsigned long long) number, base); }
+	void number(unsigned char number, unsigned char base) { this->number((unsigned long long) number, base); }
+	void decimal(double number, unsigned char decimals);
+};
+
+// what "text" + String(...) makes, ArduinoJson takes it as a String
+class StringSumHelper : public String {
+	public:
+	StringSumHelper(const String& text) : String(text) {}
+	StringSumHelper(const char* text) : String(text) {}
+};
+
+StringSumHelper operator+(const String& left, const String& right);
+StringSumHelper operator+(const String& left, const char* right);
+StringSumHelper operator+(const char* left, const String& right);
+StringSumHelper operator+(const String& left, char right);
+
+#endif
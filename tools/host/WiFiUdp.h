@@ -0,0 +1,58 @@
+/**
+ * WiFiUDP on a nonblocking Linux socket.
+ *
+ * begin binds an ephemeral port of every interface whatever the port asked for: thousands of gateways
+ * share the host, the network servers answer the port the datagrams came from. Host names are resolved
+ * once. sent and received see every datagram with the socket it went through, owner is left to the
+ * simulation (which gateway a socket belongs to).
+ *
+ * An offline socket (replays) sends nothing and reads its inbox only, sent and received still see it all.
+ */
+
+#include <Arduino.h>
+#include <functional>
+#include <deque>
+#include <string>
+
+#ifndef __WiFiUdp__
+#define __WiFiUdp__
+
+#define UDP_DATAGRAM 8192
+
+class WiFiUDP {
+	public:
+	static std::function<void(WiFiUDP& udp, const uint8_t* buffer, size_t size)> sent;
+	static std::function<void(WiFiUDP& udp, const uint8_t* buffer, size_t size)> received;
+
+	int fd = -1;
+	void* owner = NULL;
+	uint64_t datagrams = 0ull; // sent
+	uint64_t failed = 0ull;    // not sent: unresolved host, full socket buffer
+	bool offline = false;
+	std::deque<std::string> inbox; // datagrams parsePacket returns first
+
+	virtual ~WiFiUDP();
+	uint8_t begin(uint16_t port);
+	void stop();
+	int beginPacket(const char* host, uint16_t port);
+	size_t write(uint8_t byte);
+	size_t write(const uint8_t* buffer, size_t size);
+	int endPacket();
+	int parsePacket();
+	int available();
+	int read();
+	int read(uint8_t* buffer, size_t size);
+	uint16_t localPort();
+
+	protected:
+	uint8_t out[UDP_DATAGRAM];
+	size_t outSize = 0u;
+	bool resolved = false;
+	uint8_t address[28]; // sockaddr_storage would pull the socket headers in every gateway source
+	uint32_t addressLength = 0ul;
+	uint8_t in[UDP_DATAGRAM];
+	size_t inSize = 0u;
+	size_t inPosition = 0u;
+};
+
+#endif
@@ -0,0 +1,29 @@
+#
+# The gateway libraries built for Linux against the headers of tools/host, with the Histogram of the
+# host tools, included by them:
+#
+#   HOST = ../host
+#   include $(HOST)/host.mk
+#   tool: tool.cpp $(HOST_SOURCES)
+#   	g++ $(HOST_CXXFLAGS) tool.cpp $(HOST_SOURCES) -o $@
+#
+LIBRARIES = $(HOST)/../../libraries
+
+# ArduinoJson takes the String of WString.h, Print and Stream stay out; 6.11 trips the uninitialized
+# warnings of recent compilers
+HOST_CXXFLAGS = -O2 -Wall -Wno-uninitialized -Wno-maybe-uninitialized -std=c++11 \
+	-DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -DARDUINOJSON_ENABLE_ARDUINO_STREAM=0 \
+	-DARDUINOJSON_ENABLE_ARDUINO_PRINT=0 -DARDUINOJSON_ENABLE_PROGMEM=0 \
+	-I$(HOST) -I$(LIBRARIES)/ArduinoJson/src -I$(LIBRARIES)/WAN -I$(LIBRARIES)/RFM -I$(LIBRARIES)/Node \
+	-I$(LIBRARIES)/System -I$(LIBRARIES)/SystemClock -I$(LIBRARIES)/Scratch -I$(LIBRARIES)/Debug \
+	-I$(LIBRARIES)/Base64 -I$(LIBRARIES)/DataStructure -I$(LIBRARIES)/KeyValueMap
+
+HOST_SOURCES = $(HOST)/Host.cpp $(HOST)/Histogram.cpp \
+	$(wildcard $(LIBRARIES)/WAN/*.cpp) \
+	$(LIBRARIES)/RFM/RFM.cpp $(LIBRARIES)/RFM/FrameView.cpp \
+	$(LIBRARIES)/Node/Node.cpp $(LIBRARIES)/Node/Metrics.cpp \
+	$(LIBRARIES)/SystemClock/SystemClock.cpp $(LIBRARIES)/SystemClock/Discipline.cpp \
+	$(LIBRARIES)/Scratch/Scratch.cpp $(LIBRARIES)/Debug/DebugM.cpp $(LIBRARIES)/Base64/Base64M.cpp
+
+HOST_HEADERS = $(wildcard $(HOST)/*.h) $(wildcard $(LIBRARIES)/WAN/*.h) $(wildcard $(LIBRARIES)/RFM/*.h) \
+	$(wildcard $(LIBRARIES)/Node/*.h) $(LIBRARIES)/System/System.h $(wildcard $(LIBRARIES)/SystemClock/*.h)
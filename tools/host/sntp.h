@@ -0,0 +1,8 @@
+#include <stdint.h>
+
+#ifndef __sntp__
+#define __sntp__
+
+uint32_t sntp_get_current_timestamp(); // seconds since 1970 of the host
+
+#endif
@@ -0,0 +1,452 @@
+#include <Relay.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <arpa/inet.h>
+#include <sys/epoll.h>
+#include <algorithm>
+#include <vector>
+
+Relay::Relay() {
+	this->epoll = epoll_create1(0);
+	this->slots = new Slot[RELAY_BATCH];
+	this->outs = new Slot[RELAY_BATCH];
+}
+
+Relay::~Relay() {
+	for (auto& entry : this->gateways) {
+		this->close(entry.second);
+	}
+	if (0 <= this->listen) {
+		::close(this->listen);
+	}
+	::close(this->epoll);
+	delete[] this->slots;
+	delete[] this->outs;
+}
+
+uint64_t Relay::ustime() {
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * 1000000ull + (uint64_t) now.tv_nsec / 1000ull;
+}
+
+uint64_t Relay::eui(const uint8_t* header) {
+	uint64_t eui = 0ull;
+	for (uint8_t i = 4u; i < HEADER_LENGTH; i++) {
+		eui = (eui << 8) | header[i];
+	}
+	return eui;
+}
+
+static bool resolve(const char* host, uint16_t port, sockaddr_storage* address, socklen_t* length) {
+	addrinfo hints;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_DGRAM;
+	char service[6];
+	snprintf(service, sizeof(service), "%u", port);
+	addrinfo* result = NULL;
+	if (getaddrinfo(host, service, &hints, &result) || NULL == result) {
+		return false;
+	}
+	memcpy(address, result->ai_addr, result->ai_addrlen);
+	*length = result->ai_addrlen;
+	freeaddrinfo(result);
+	return true;
+}
+
+bool Relay::server(const char* text) {
+	if (RELAY_SERVERS <= this->length) {
+		return false;
+	}
+	Server& server = this->servers[this->length];
+	char host[sizeof(server.name)] = {0};
+	unsigned port = 0u;
+	char flag[3] = {0};
+	int fields = sscanf(text, "%63[^:]:%u %2s", host, &port, flag);
+	if (fields < 2 || !port || 65535u < port || (3 == fields && strcmp(flag, "up"))) {
+		return false;
+	}
+	if (!resolve(host, (uint16_t) port, &server.address, &server.length)) {
+		return false;
+	}
+	snprintf(server.name, sizeof(server.name), "%s:%u", host, port);
+	server.down = 3 != fields;
+	this->length++;
+	return true;
+}
+
+bool Relay::bind(const char* host, uint16_t port) {
+	sockaddr_storage address;
+	socklen_t length = 0u;
+	if (!resolve(host, port, &address, &length)) {
+		return false;
+	}
+	this->listen = socket(address.ss_family, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+	int size = 4 << 20; // bursts of thousands of gateways while a batch is relayed
+	setsockopt(this->listen, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+	setsockopt(this->listen, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+	if (0 > this->listen || ::bind(this->listen, (sockaddr*) &address, length)) {
+		return false;
+	}
+	epoll_event event;
+	event.events = EPOLLIN;
+	event.data.ptr = NULL;
+	return !epoll_ctl(this->epoll, EPOLL_CTL_ADD, this->listen, &event);
+}
+
+uint16_t Relay::port() const {
+	sockaddr_storage address;
+	socklen_t length = sizeof(address);
+	getsockname(this->listen, (sockaddr*) &address, &length);
+	return ntohs(AF_INET6 == address.ss_family ? ((sockaddr_in6*) &address)->sin6_port : ((sockaddr_in*) &address)->sin_port);
+}
+
+void Relay::run(volatile bool& running, uint32_t stats) {
+	epoll_event events[RELAY_BATCH];
+	uint64_t lstat = ustime() / 1000ull, lforget = lstat;
+	while (running) {
+		int count = epoll_wait(this->epoll, events, RELAY_BATCH, 100);
+		for (int i = 0; i < count; i++) {
+			Link* link = (Link*) events[i].data.ptr;
+			if (NULL == link) {
+				this->fromGateways();
+			} else {
+				this->fromServer(link);
+			}
+		}
+		this->flush();
+
+		uint64_t now = ustime() / 1000ull;
+		if (10000ull <= now - lforget) {
+			lforget = now;
+			this->forget(now);
+		}
+		if ((stats && stats <= now - lstat) || this->dump) {
+			lstat = now;
+			this->dump = false;
+			this->print();
+		}
+	}
+}
+
+/**
+ * A batch of the gateways, the datagrams are sent from the buffers they were received in
+ */
+void Relay::fromGateways() {
+	mmsghdr messages[RELAY_BATCH];
+	iovec vectors[RELAY_BATCH];
+	for (uint8_t i = 0u; i < RELAY_BATCH; i++) {
+		vectors[i].iov_base = this->slots[i].buffer;
+		vectors[i].iov_len = RELAY_DATAGRAM;
+		memset(&messages[i].msg_hdr, 0, sizeof(msghdr));
+		messages[i].msg_hdr.msg_iov = &vectors[i];
+		messages[i].msg_hdr.msg_iovlen = 1;
+		messages[i].msg_hdr.msg_name = &this->slots[i].address;
+		messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+	}
+	int count = recvmmsg(this->listen, messages, RELAY_BATCH, MSG_DONTWAIT, NULL);
+	if (0 >= count) {
+		return;
+	}
+	this->batches++;
+	this->datagrams += (uint64_t) count;
+
+	uint64_t now = ustime();
+	for (int i = 0; i < count; i++) {
+		const uint8_t* buffer = this->slots[i].buffer;
+		size_t size = messages[i].msg_len;
+		uint8_t identifier = HEADER_LENGTH <= size ? buffer[3] : 0xFFu;
+		bool valid = (PUSH_DATA == identifier || PULL_DATA == identifier || TX_ACK == identifier)
+			&& !(messages[i].msg_hdr.msg_flags & MSG_TRUNC);
+		if (!valid) {
+			this->totals.drop++;
+			continue;
+		}
+
+		Gateway* gateway = this->gateway(Relay::eui(buffer), now / 1000ull);
+		if (NULL == gateway) {
+			this->totals.drop++;
+			continue;
+		}
+		Counters& counters = gateway->counters;
+		counters.up += size;
+		uint16_t token = (uint16_t) (buffer[2] << 8 | buffer[1]);
+		if (PUSH_DATA == identifier) {
+			counters.push++;
+			memcpy(&gateway->up, &this->slots[i].address, messages[i].msg_hdr.msg_namelen);
+			gateway->upLength = messages[i].msg_hdr.msg_namelen;
+			gateway->push = token;
+			gateway->pushAcked = false;
+			gateway->sent = now;
+		} else if (PULL_DATA == identifier) {
+			counters.pull++;
+			memcpy(&gateway->down, &this->slots[i].address, messages[i].msg_hdr.msg_namelen);
+			gateway->downLength = messages[i].msg_hdr.msg_namelen;
+			gateway->pull = token;
+			gateway->pullAcked = false;
+		} else {
+			counters.txack++;
+		}
+		this->toServers(gateway, buffer, size, identifier, token);
+	}
+	this->flushUp();
+}
+
+Relay::Gateway* Relay::gateway(uint64_t eui, uint64_t now) {
+	auto found = this->gateways.find(eui);
+	if (this->gateways.end() != found) {
+		found->second->last = now;
+		return found->second;
+	}
+
+	Gateway* gateway = new Gateway();
+	gateway->eui = eui;
+	gateway->last = now;
+	for (uint8_t i = 0u; i < this->length; i++) {
+		Link& link = gateway->links[i];
+		link.gateway = gateway;
+		link.server = i;
+		link.fd = socket(this->servers[i].address.ss_family, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+		epoll_event event;
+		event.events = EPOLLIN;
+		event.data.ptr = &link;
+		// connected: the kernel drops what does not come from the server
+		if (0 > link.fd || connect(link.fd, (sockaddr*) &this->servers[i].address, this->servers[i].length)
+			|| epoll_ctl(this->epoll, EPOLL_CTL_ADD, link.fd, &event)) {
+			this->close(gateway);
+			return NULL; // out of descriptors, the datagram is dropped
+		}
+	}
+	this->gateways[eui] = gateway;
+	return gateway;
+}
+
+void Relay::toServers(Gateway* gateway, const uint8_t* buffer, size_t size, uint8_t identifier, uint16_t token) {
+	// TX_ACK to the server of the PULL_RESP, to all when a forwarder does not reuse its token
+	bool matched = false;
+	for (uint8_t i = 0u; i < this->length && TX_ACK == identifier; i++) {
+		matched = matched || (this->servers[i].down && gateway->links[i].resp == token);
+	}
+	for (uint8_t i = 0u; i < this->length; i++) {
+		Link& link = gateway->links[i];
+		bool to = PUSH_DATA == identifier;
+		if (PULL_DATA == identifier) {
+			to = this->servers[i].down;
+		} else if (TX_ACK == identifier) {
+			to = this->servers[i].down && (!matched || link.resp == token);
+		}
+		if (to) {
+			Up& up = this->ups[this->upLength];
+			up.fd = link.fd;
+			up.order = this->upLength++;
+			up.vector.iov_base = (void*) buffer;
+			up.vector.iov_len = size;
+		}
+	}
+}
+
+void Relay::flushUp() {
+	// by socket, in arrival order for each
+	std::sort(this->ups, this->ups + this->upLength, [](const Up& a, const Up& b) {
+		return a.fd != b.fd ? a.fd < b.fd : a.order < b.order;
+	});
+	mmsghdr messages[RELAY_BATCH];
+	uint16_t i = 0u;
+	while (i < this->upLength) {
+		int fd = this->ups[i].fd;
+		unsigned count = 0u;
+		while (i + count < this->upLength && fd == this->ups[i + count].fd && count < RELAY_BATCH) {
+			memset(&messages[count].msg_hdr, 0, sizeof(msghdr));
+			messages[count].msg_hdr.msg_iov = &this->ups[i + count].vector;
+			messages[count].msg_hdr.msg_iovlen = 1;
+			count++;
+		}
+		int sent = sendmmsg(fd, messages, count, MSG_DONTWAIT);
+		if (sent < (int) count) {
+			this->totals.drop += count - (unsigned) (0 < sent ? sent : 0);
+		}
+		i = (uint16_t) (i + count);
+	}
+	this->upLength = 0u;
+}
+
+/**
+ * A batch of a server, received in place in the datagrams to the gateways
+ */
+void Relay::fromServer(Link* link) {
+	if (RELAY_BATCH == this->outLength) {
+		this->flush();
+	}
+	Gateway* gateway = link->gateway;
+	uint8_t start = this->outLength;
+	unsigned space = RELAY_BATCH - start;
+	mmsghdr messages[RELAY_BATCH];
+	iovec vectors[RELAY_BATCH];
+	for (unsigned i = 0u; i < space; i++) {
+		vectors[i].iov_base = this->outs[start + i].buffer;
+		vectors[i].iov_len = RELAY_DATAGRAM;
+		memset(&messages[i].msg_hdr, 0, sizeof(msghdr));
+		messages[i].msg_hdr.msg_iov = &vectors[i];
+		messages[i].msg_hdr.msg_iovlen = 1;
+	}
+	int count = recvmmsg(link->fd, messages, space, MSG_DONTWAIT, NULL);
+	if (0 >= count) {
+		return;
+	}
+	this->batches++;
+	this->datagrams += (uint64_t) count;
+
+	uint64_t now = ustime();
+	Counters& counters = gateway->counters;
+	for (int i = 0; i < count; i++) {
+		uint8_t* buffer = this->outs[start + i].buffer;
+		size_t size = messages[i].msg_len;
+		uint8_t identifier = 4u <= size ? buffer[3] : 0xFFu;
+		uint16_t token = 4u <= size ? (uint16_t) (buffer[2] << 8 | buffer[1]) : 0u;
+		bool relay = false, down = true;
+		if (PUSH_ACK == identifier) {
+			if (token == gateway->push) {
+				uint32_t sample = (uint32_t) (now - gateway->sent);
+				link->rtt = link->rtt ? (7ul * link->rtt + sample) / 8ul : sample;
+			}
+			relay = token == gateway->push && !gateway->pushAcked; // the first server to answer
+			gateway->pushAcked = gateway->pushAcked || relay;
+			down = false;
+		} else if (PULL_ACK == identifier) {
+			relay = token == gateway->pull && !gateway->pullAcked;
+			gateway->pullAcked = gateway->pullAcked || relay;
+		} else if (PULL_RESP == identifier) {
+			relay = this->servers[link->server].down;
+			link->resp = token;
+		}
+		relay = relay && !(messages[i].msg_hdr.msg_flags & MSG_TRUNC) && (down ? gateway->downLength : gateway->upLength);
+		if (!relay) {
+			counters.drop++;
+			continue;
+		}
+		counters.ack += PULL_RESP == identifier ? 0u : 1u;
+		counters.resp += PULL_RESP == identifier ? 1u : 0u;
+		counters.down += size;
+
+		uint8_t out = this->outLength++;
+		if (out != start + i) {
+			memcpy(this->outs[out].buffer, buffer, size); // after a dropped one
+		}
+		this->outVectors[out].iov_base = this->outs[out].buffer;
+		this->outVectors[out].iov_len = size;
+		msghdr& header = this->outMessages[out].msg_hdr;
+		memset(&header, 0, sizeof(msghdr));
+		header.msg_iov = &this->outVectors[out];
+		header.msg_iovlen = 1;
+		header.msg_name = down ? &gateway->down : &gateway->up;
+		header.msg_namelen = down ? gateway->downLength : gateway->upLength;
+	}
+}
+
+void Relay::flush() {
+	uint8_t sent = 0u;
+	while (sent < this->outLength) {
+		int count = sendmmsg(this->listen, this->outMessages + sent, this->outLength - sent, MSG_DONTWAIT);
+		if (0 >= count) {
+			this->totals.drop += this->outLength - sent; // full socket buffer, the gateways retry
+			break;
+		}
+		sent = (uint8_t) (sent + count);
+	}
+	this->outLength = 0u;
+}
+
+void Relay::forget(uint64_t now) {
+	std::vector<uint64_t> idle;
+	for (auto& entry : this->gateways) {
+		if (RELAY_IDLE <= now - entry.second->last) {
+			idle.push_back(entry.first);
+		}
+	}
+	if (idle.size()) {
+		this->flush(); // the pending datagrams point at the addresses of the gateways
+	}
+	for (uint64_t eui : idle) {
+		Gateway* gateway = this->gateways[eui];
+		this->gateways.erase(eui);
+		Counters& counters = gateway->counters;
+		this->totals.push += counters.push;
+		this->totals.pull += counters.pull;
+		this->totals.txack += counters.txack;
+		this->totals.ack += counters.ack;
+		this->totals.resp += counters.resp;
+		this->totals.drop += counters.drop;
+		this->totals.up += counters.up;
+		this->totals.down += counters.down;
+		this->close(gateway);
+	}
+}
+
+void Relay::close(Gateway* gateway) {
+	for (uint8_t i = 0u; i < RELAY_SERVERS; i++) {
+		if (0 <= gateway->links[i].fd) {
+			epoll_ctl(this->epoll, EPOLL_CTL_DEL, gateway->links[i].fd, NULL);
+			::close(gateway->links[i].fd);
+		}
+	}
+	delete gateway;
+}
+
+static const char* address(const sockaddr_storage& address, socklen_t length, char* text) {
+	if (!length) {
+		return "-";
+	}
+	char host[INET6_ADDRSTRLEN] = {0};
+	uint16_t port = 0u;
+	if (AF_INET6 == address.ss_family) {
+		inet_ntop(AF_INET6, &((sockaddr_in6*) &address)->sin6_addr, host, sizeof(host));
+		port = ntohs(((sockaddr_in6*) &address)->sin6_port);
+	} else {
+		inet_ntop(AF_INET, &((sockaddr_in*) &address)->sin_addr, host, sizeof(host));
+		port = ntohs(((sockaddr_in*) &address)->sin_port);
+	}
+	snprintf(text, INET6_ADDRSTRLEN + 7, "%s:%u", host, port);
+	return text;
+}
+
+void Relay::print() {
+	printf("%-16s %-21s %10s %8s %6s %10s %8s %6s %12s %12s  rtt ms\n",
+		"gateway", "address", "push", "pull", "txack", "ack", "resp", "drop", "bytes up", "bytes down");
+	Counters sum = this->totals;
+	for (auto& entry : this->gateways) {
+		const Gateway* gateway = entry.second;
+		const Counters& counters = gateway->counters;
+		char text[INET6_ADDRSTRLEN + 7];
+		printf("%016llX %-21s %10llu %8llu %6llu %10llu %8llu %6llu %12llu %12llu ",
+			(unsigned long long) gateway->eui, address(gateway->up, gateway->upLength, text),
+			(unsigned long long) counters.push, (unsigned long long) counters.pull, (unsigned long long) counters.txack,
+			(unsigned long long) counters.ack, (unsigned long long) counters.resp, (unsigned long long) counters.drop,
+			(unsigned long long) counters.up, (unsigned long long) counters.down);
+		for (uint8_t i = 0u; i < this->length; i++) {
+			printf(" %.1f", gateway->links[i].rtt / 1000.0);
+		}
+		printf("\n");
+		sum.push += counters.push;
+		sum.pull += counters.pull;
+		sum.txack += counters.txack;
+		sum.ack += counters.ack;
+		sum.resp += counters.resp;
+		sum.drop += counters.drop;
+		sum.up += counters.up;
+		sum.down += counters.down;
+	}
+	printf("%-16s %-21zu %10llu %8llu %6llu %10llu %8llu %6llu %12llu %12llu  %.1f datagrams a recvmmsg\n",
+		"total", this->gateways.size(),
+		(unsigned long long) sum.push, (unsigned long long) sum.pull, (unsigned long long) sum.txack,
+		(unsigned long long) sum.ack, (unsigned long long) sum.resp, (unsigned long long) sum.drop,
+		(unsigned long long) sum.up, (unsigned long long) sum.down,
+		this->batches ? (double) this->datagrams / this->batches : 0.0);
+	fflush(stdout);
+}
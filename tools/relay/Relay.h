@@ -0,0 +1,162 @@
+/**
+ * Semtech UDP relay between gateways and network servers, the native replacement of Proxy.js.
+ *
+ * Gateways send to one socket, the relay learns them by the EUI of their PUSH_DATA, PULL_DATA and
+ * TX_ACK headers. A gateway gets its own connected socket towards every network server, the servers see
+ * one address per gateway and answer it there: PUSH_ACK goes back to the address of the last PUSH_DATA,
+ * PULL_ACK and PULL_RESP to the one of the last PULL_DATA (the packet forwarder of Semtech uses a socket
+ * for each).
+ *
+ *   gateways  --PUSH_DATA-->  [ listen ]  --same buffer-->  [ gateway x server sockets ]  -->  servers
+ *   gateways  <--PULL_RESP--  [ listen ]  <--sendmmsg----  [ epoll, recvmmsg ]          <--  servers
+ *
+ * Every uplink goes to every server, PULL_DATA only to the servers downlinks are admitted from. The
+ * gateway gets the first PUSH_ACK and PULL_ACK of a token, TX_ACK goes to the server of the PULL_RESP.
+ * Datagrams are read and written in batches of RELAY_BATCH, nothing is logged per datagram.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <unordered_map>
+
+#ifndef __Relay__
+#define __Relay__
+
+#define PROTOCOL_VERSION 0x02
+#define PUSH_DATA 0x00
+#define PUSH_ACK  0x01
+#define PULL_DATA 0x02
+#define PULL_RESP 0x03
+#define PULL_ACK  0x04
+#define TX_ACK    0x05
+#define HEADER_LENGTH 12 // version, token, identifier and the gateway EUI
+
+#define RELAY_SERVERS 4
+#define RELAY_BATCH 64       // datagrams per recvmmsg and sendmmsg
+#define RELAY_DATAGRAM 8192  // bytes, a PUSH_DATA of 8 rxpk is about 4 kB
+#define RELAY_IDLE 300000ull // ms, a gateway without datagrams for that long is forgotten
+
+class Relay {
+	public:
+
+	class Server {
+		public:
+		sockaddr_storage address;
+		socklen_t length = 0u;
+		char name[64] = {0};
+		bool down = true; // PULL_DATA and PULL_RESP relayed
+	};
+
+	class Counters {
+		public:
+		uint64_t push = 0ull;  // PUSH_DATA from the gateway
+		uint64_t pull = 0ull;  // PULL_DATA from the gateway
+		uint64_t txack = 0ull; // TX_ACK from the gateway
+		uint64_t ack = 0ull;   // PUSH_ACK and PULL_ACK relayed to the gateway
+		uint64_t resp = 0ull;  // PULL_RESP relayed to the gateway
+		uint64_t drop = 0ull;  // not relayed: failed sends, duplicated ACKs, refused PULL_RESP
+		uint64_t up = 0ull;    // bytes from the gateway
+		uint64_t down = 0ull;  // bytes to the gateway
+	};
+
+	class Gateway;
+
+	// a socket of a gateway towards a server, the epoll data of that socket
+	class Link {
+		public:
+		Gateway* gateway = NULL;
+		uint8_t server = 0u;
+		int fd = -1;
+		uint16_t resp = 0u;      // token of the last PULL_RESP, TX_ACK goes back with it
+		uint32_t rtt = 0ul;      // us, smoothed round trip of the acknowledged PUSH_DATA
+	};
+
+	class Gateway {
+		public:
+		uint64_t eui = 0ull;
+		sockaddr_storage up;   // of the last PUSH_DATA
+		sockaddr_storage down; // of the last PULL_DATA
+		socklen_t upLength = 0u;
+		socklen_t downLength = 0u;
+		uint64_t last = 0ull;  // ms of the last datagram
+		uint16_t push = 0u;    // token of the last PUSH_DATA, its first PUSH_ACK is relayed
+		uint16_t pull = 0u;
+		bool pushAcked = true;
+		bool pullAcked = true;
+		uint64_t sent = 0ull;  // us of the last PUSH_DATA
+		Link links[RELAY_SERVERS];
+		Counters counters;
+	};
+
+	Server servers[RELAY_SERVERS];
+	uint8_t length = 0u;
+	int listen = -1;
+	int epoll = -1;
+	std::unordered_map<uint64_t, Gateway*> gateways;
+	Counters totals; // of the gateways forgotten, and of the datagrams of no gateway in drop
+	uint64_t batches = 0ull; // recvmmsg calls
+	uint64_t datagrams = 0ull; // received
+	volatile bool dump = false; // prints the counters at once, from a signal handler
+
+	Relay();
+	virtual ~Relay();
+
+	/* server:
+	 *   Description:
+	 *     Adds a network server, "host:port" with an optional " up" when its downlinks are refused
+	 *   Returns:
+	 *     false if the host does not resolve, RELAY_SERVERS are there already or the text is wrong
+	 */
+	bool server(const char* text);
+
+	bool bind(const char* host, uint16_t port); // the socket of the gateways
+	uint16_t port() const; // of the socket of the gateways, for the ephemeral ones
+
+	/* run:
+	 *   Description:
+	 *     Relays until running is false, prints the counters of the gateways every stats ms (0 never)
+	 *     and when dump is set
+	 */
+	void run(volatile bool& running, uint32_t stats);
+
+	void print(); // a line per gateway and the totals
+
+	static uint64_t eui(const uint8_t* header);
+	static uint64_t ustime();
+
+	protected:
+	class Slot {
+		public:
+		uint8_t buffer[RELAY_DATAGRAM];
+		sockaddr_storage address;
+	};
+
+	Slot* slots = NULL; // RELAY_BATCH received datagrams
+	Slot* outs = NULL;  // RELAY_BATCH datagrams to the gateways, received there from the servers
+	mmsghdr outMessages[RELAY_BATCH];
+	iovec outVectors[RELAY_BATCH];
+	uint8_t outLength = 0u;
+
+	// datagrams of a received batch to the servers, by socket, the buffers are the received ones
+	class Up {
+		public:
+		int fd;
+		uint16_t order;
+		iovec vector;
+	};
+	Up ups[RELAY_BATCH * RELAY_SERVERS];
+	uint16_t upLength = 0u;
+
+	void fromGateways();
+	void fromServer(Link* link);
+	Gateway* gateway(uint64_t eui, uint64_t now);
+	void toServers(Gateway* gateway, const uint8_t* buffer, size_t size, uint8_t identifier, uint16_t token);
+	void flush();   // to the gateways
+	void flushUp(); // to the servers, a sendmmsg per socket
+	void forget(uint64_t now); // the idle gateways
+	void close(Gateway* gateway);
+};
+
+#endif
@@ -0,0 +1,300 @@
+/*
+ Semtech UDP relay, see Relay.h
+
+   relay [--listen host:port] --server host:port [--server host:port] [--uplink host:port] [--stats seconds]
+
+     --listen  the socket of the gateways, 0.0.0.0:1700 by default
+     --server  a network server, uplinks and downlinks, up to 4 servers
+     --uplink  a network server that gets the uplinks only, no PULL_DATA and its PULL_RESP are dropped
+     --stats   the counters of every gateway every that many seconds, 60 by default, 0 never;
+               SIGUSR1 prints them at once
+
+   relay --bench [--gateways 1000] [--rate 50000] [--seconds 5] [--servers 2]
+
+     load benchmark on loopback: the network servers answer PUSH_ACK and PULL_ACK, the gateways send
+     PUSH_DATA of one rxpk at rate datagrams per second all together, batched with sendmmsg. Reports the
+     datagrams relayed per second, the lost ones and the round trip through the relay.
+*/
+#include <Relay.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+static volatile bool running = true;
+static Relay* relay = NULL;
+
+static void stop(int) {
+	running = false;
+}
+
+static void dump(int) {
+	relay->dump = true;
+}
+
+static void usage() {
+	printf("relay [--listen host:port] --server host:port [--server host:port] [--uplink host:port] [--stats seconds]\n");
+	printf("relay --bench [--gateways 1000] [--rate 50000] [--seconds 5] [--servers 2]\n");
+}
+
+// a network server that acknowledges everything, on 127.0.0.1
+class Acknowledger {
+	public:
+	int fd = -1;
+	uint16_t port = 0u;
+	std::atomic<uint64_t> received{0ull};
+
+	Acknowledger() {
+		this->fd = socket(AF_INET, SOCK_DGRAM, 0);
+		sockaddr_in address;
+		memset(&address, 0, sizeof(address));
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		bind(this->fd, (sockaddr*) &address, sizeof(address));
+		socklen_t length = sizeof(address);
+		getsockname(this->fd, (sockaddr*) &address, &length);
+		this->port = ntohs(address.sin_port);
+		timeval timeout = {0, 100000};
+		setsockopt(this->fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		int size = 4 << 20;
+		setsockopt(this->fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+	}
+
+	~Acknowledger() {
+		close(this->fd);
+	}
+
+	void run() {
+		static thread_local uint8_t buffers[RELAY_BATCH][RELAY_DATAGRAM];
+		uint8_t acks[RELAY_BATCH][4];
+		sockaddr_storage addresses[RELAY_BATCH];
+		mmsghdr messages[RELAY_BATCH];
+		iovec vectors[RELAY_BATCH];
+		iovec ackVectors[RELAY_BATCH];
+		while (running) {
+			for (int i = 0; i < RELAY_BATCH; i++) {
+				vectors[i].iov_base = buffers[i];
+				vectors[i].iov_len = RELAY_DATAGRAM;
+				memset(&messages[i].msg_hdr, 0, sizeof(msghdr));
+				messages[i].msg_hdr.msg_iov = &vectors[i];
+				messages[i].msg_hdr.msg_iovlen = 1;
+				messages[i].msg_hdr.msg_name = &addresses[i];
+				messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+			}
+			int count = recvmmsg(this->fd, messages, RELAY_BATCH, MSG_WAITFORONE, NULL);
+			if (0 >= count) {
+				continue;
+			}
+			this->received += (uint64_t) count;
+			for (int i = 0; i < count; i++) {
+				acks[i][0] = PROTOCOL_VERSION;
+				acks[i][1] = buffers[i][1];
+				acks[i][2] = buffers[i][2];
+				acks[i][3] = PUSH_DATA == buffers[i][3] ? PUSH_ACK : PULL_ACK;
+				ackVectors[i].iov_base = acks[i];
+				ackVectors[i].iov_len = 4u;
+				messages[i].msg_hdr.msg_iov = &ackVectors[i];
+			}
+			sendmmsg(this->fd, messages, count, 0);
+		}
+	}
+};
+
+static int bench(int argc, char** argv) {
+	unsigned gateways = 1000u, rate = 50000u, seconds = 5u, servers = 2u;
+	for (int i = 2; i + 1 < argc; i += 2) {
+		unsigned value = (unsigned) strtoul(argv[i + 1], NULL, 10);
+		if (!strcmp(argv[i], "--gateways")) gateways = value;
+		else if (!strcmp(argv[i], "--rate")) rate = value;
+		else if (!strcmp(argv[i], "--seconds")) seconds = value;
+		else if (!strcmp(argv[i], "--servers")) servers = value;
+		else { usage(); return 1; }
+	}
+	if (!gateways || !rate || !servers || RELAY_SERVERS < servers) {
+		usage();
+		return 1;
+	}
+
+	std::vector<Acknowledger*> acknowledgers;
+	std::vector<std::thread> threads;
+	Relay relay;
+	for (unsigned i = 0u; i < servers; i++) {
+		acknowledgers.push_back(new Acknowledger());
+		char text[32];
+		snprintf(text, sizeof(text), "127.0.0.1:%u", acknowledgers[i]->port);
+		relay.server(text);
+	}
+	if (!relay.bind("127.0.0.1", 0u)) {
+		perror("bind");
+		return 1;
+	}
+	for (unsigned i = 0u; i < servers; i++) {
+		threads.push_back(std::thread(&Acknowledger::run, acknowledgers[i]));
+	}
+	threads.push_back(std::thread([&relay]() { relay.run(running, 0u); }));
+
+	// the gateways, one socket to the relay
+	int fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+	int size = 4 << 20;
+	setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+	sockaddr_in address;
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(relay.port());
+	connect(fd, (sockaddr*) &address, sizeof(address));
+
+	const char* rxpk = "{\"rxpk\":[{\"tmst\":3512348611,\"freq\":868.100000,\"chan\":0,\"rfch\":0,\"stat\":1,\"modu\":\"LORA\","
+		"\"datr\":\"SF7BW125\",\"codr\":\"4/5\",\"rssi\":-35,\"lsnr\":5.25,\"size\":23,\"data\":\"QNobASaAAQABv3Lw5G4f7wYtPqM=\"}]}";
+	size_t length = HEADER_LENGTH + strlen(rxpk);
+	static uint8_t datagrams[RELAY_BATCH][RELAY_DATAGRAM];
+	static uint64_t sentAt[65536];
+	mmsghdr messages[RELAY_BATCH];
+	iovec vectors[RELAY_BATCH];
+	std::vector<uint32_t> rtts;
+	rtts.reserve((size_t) rate * seconds);
+	uint64_t sent = 0ull, acked = 0ull, syscalls = 0ull;
+	uint16_t token = 0u;
+
+	uint64_t start = Relay::ustime(), end = start + seconds * 1000000ull;
+	uint64_t now = start;
+	while (now < end + 500000ull) {
+		now = Relay::ustime();
+		// PUSH_DATA due at rate, in batches
+		uint64_t due = now < end ? (now - start) * rate / 1000000ull : 0ull;
+		while (sent < due) {
+			unsigned count = (unsigned) std::min<uint64_t>(due - sent, RELAY_BATCH);
+			for (unsigned i = 0u; i < count; i++) {
+				uint64_t eui = 0xAA555A0000000000ull + (sent + i) % gateways;
+				uint8_t* datagram = datagrams[i];
+				datagram[0] = PROTOCOL_VERSION;
+				datagram[1] = (uint8_t) token;
+				datagram[2] = (uint8_t) (token >> 8);
+				datagram[3] = (sent + i) < gateways ? PULL_DATA : PUSH_DATA; // a keepalive for each first
+				for (int b = 0; b < 8; b++) {
+					datagram[4 + b] = (uint8_t) (eui >> (56 - 8 * b));
+				}
+				memcpy(datagram + HEADER_LENGTH, rxpk, length - HEADER_LENGTH);
+				sentAt[token++] = now;
+				vectors[i].iov_base = datagram;
+				vectors[i].iov_len = PULL_DATA == datagram[3] ? HEADER_LENGTH : length;
+				memset(&messages[i].msg_hdr, 0, sizeof(msghdr));
+				messages[i].msg_hdr.msg_iov = &vectors[i];
+				messages[i].msg_hdr.msg_iovlen = 1;
+			}
+			int result = sendmmsg(fd, messages, count, 0);
+			syscalls++;
+			if (0 >= result) {
+				break;
+			}
+			sent += (uint64_t) result;
+		}
+
+		// the acknowledgements
+		uint8_t acks[RELAY_BATCH][16];
+		for (int i = 0; i < RELAY_BATCH; i++) {
+			vectors[i].iov_base = acks[i];
+			vectors[i].iov_len = sizeof(acks[i]);
+			memset(&messages[i].msg_hdr, 0, sizeof(msghdr));
+			messages[i].msg_hdr.msg_iov = &vectors[i];
+			messages[i].msg_hdr.msg_iovlen = 1;
+		}
+		int count = recvmmsg(fd, messages, RELAY_BATCH, MSG_DONTWAIT, NULL);
+		uint64_t received = Relay::ustime();
+		for (int i = 0; i < count; i++) {
+			uint16_t ackToken = (uint16_t) (acks[i][2] << 8 | acks[i][1]);
+			rtts.push_back((uint32_t) (received - sentAt[ackToken]));
+		}
+		acked += 0 < count ? (uint64_t) count : 0ull;
+		if (0 >= count && sent >= due) {
+			usleep(50);
+		}
+	}
+	running = false;
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	close(fd);
+
+	uint64_t forwarded = 0ull;
+	for (Acknowledger* acknowledger : acknowledgers) {
+		forwarded += acknowledger->received;
+		delete acknowledger;
+	}
+	std::sort(rtts.begin(), rtts.end());
+	uint32_t p50 = rtts.size() ? rtts[rtts.size() / 2] : 0u;
+	uint32_t p99 = rtts.size() ? rtts[rtts.size() * 99 / 100] : 0u;
+	uint32_t worst = rtts.size() ? rtts.back() : 0u;
+	double duration = (double) seconds;
+	printf("%u gateways, %u servers, %u datagrams/s offered for %u s\n", gateways, servers, rate, seconds);
+	printf("  gateways -> relay    %llu datagrams, %.0f/s, %.1f a sendmmsg\n",
+		(unsigned long long) sent, sent / duration, syscalls ? (double) sent / syscalls : 0.0);
+	printf("  relay -> servers     %llu datagrams, %.0f/s, %.2f %% of the expected %llu\n",
+		(unsigned long long) forwarded, forwarded / duration, sent ? 100.0 * forwarded / (sent * servers) : 0.0,
+		(unsigned long long) (sent * servers));
+	printf("  acks -> gateways     %llu, %.2f %% lost\n", (unsigned long long) acked, sent ? 100.0 * (sent - std::min(acked, sent)) / sent : 0.0);
+	printf("  round trip           p50 %u us, p99 %u us, max %u us\n", p50, p99, worst);
+	printf("  relay                %.1f datagrams a recvmmsg, %zu gateways, %llu dropped\n",
+		relay.batches ? (double) relay.datagrams / relay.batches : 0.0, relay.gateways.size(),
+		(unsigned long long) relay.totals.drop);
+	return forwarded ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+	if (1 < argc && !strcmp(argv[1], "--bench")) {
+		return bench(argc, argv);
+	}
+
+	Relay relay;
+	::relay = &relay;
+	const char* listen = "0.0.0.0:1700";
+	unsigned seconds = 60u;
+	for (int i = 1; i + 1 < argc; i += 2) {
+		const char* value = argv[i + 1];
+		bool ok = true;
+		if (!strcmp(argv[i], "--listen")) {
+			listen = value;
+		} else if (!strcmp(argv[i], "--server")) {
+			ok = relay.server(value);
+		} else if (!strcmp(argv[i], "--uplink")) {
+			char text[80];
+			snprintf(text, sizeof(text), "%s up", value);
+			ok = relay.server(text);
+		} else if (!strcmp(argv[i], "--stats")) {
+			seconds = (unsigned) strtoul(value, NULL, 10);
+		} else {
+			ok = false;
+		}
+		if (!ok) {
+			fprintf(stderr, "bad %s %s\n", argv[i], value);
+			usage();
+			return 1;
+		}
+	}
+	char host[64] = {0};
+	unsigned port = 0u;
+	if (!relay.length || 2 != sscanf(listen, "%63[^:]:%u", host, &port) || !relay.bind(host, (uint16_t) port)) {
+		usage();
+		return 1;
+	}
+
+	signal(SIGINT, stop);
+	signal(SIGTERM, stop);
+	signal(SIGUSR1, dump);
+	printf("relaying %s to", listen);
+	for (uint8_t i = 0u; i < relay.length; i++) {
+		printf(" %s%s", relay.servers[i].name, relay.servers[i].down ? "" : " (uplinks)");
+	}
+	printf("\n");
+	fflush(stdout);
+
+	relay.run(running, seconds * 1000u);
+	relay.print();
+	return 0;
+}
@@ -0,0 +1,451 @@
+#include <Replay.h>
+#include <unistd.h>
+#include <algorithm>
+#include <set>
+
+static int8_t backendOf(WAN* wan, WiFiUDP& udp) {
+	for (uint8_t i = 0u; i < BACKENDS; i++) {
+		if (wan->udps[i] == &udp) {
+			return (int8_t) i;
+		}
+	}
+	return -1;
+}
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// Gateway
+Gateway::Gateway() {
+	this->rfm = new RFM(&this->root, "rfm");
+	this->wan = new WAN(&this->root, "wan");
+	this->wan->rfm = this->rfm;
+}
+
+Gateway::~Gateway() {
+	delete this->wan;
+	delete this->rfm;
+}
+
+void Gateway::setup(uint64_t uptime, const char* capture) {
+	this->context.boot(uptime);
+	Host::enter(&this->context);
+	this->rfm->setup();
+	this->wan->capture.parse(capture);
+	this->wan->setup();
+	if (!capture[0]) {
+		this->wan->capture.mode = Capture::OFF; // whatever the SPIFFS of a replay says
+	}
+	for (uint8_t i = 0u; i < BACKENDS; i++) {
+		this->wan->udps[i]->offline = true;
+	}
+	this->wan->collector->offline = Capture::UDP != this->wan->capture.mode; // a recording to tools/replay --collect
+	Host::leave();
+}
+
+void Gateway::loop() {
+	Host::enter(&this->context);
+	this->wan->loop();
+	Host::leave();
+}
+
+uint64_t Gateway::ustime() const {
+	return Host::now() + this->context.offset;
+}
+
+uint64_t Gateway::wake() const {
+	WAN* wan = this->wan;
+	uint64_t at = std::min((wan->lstat + wan->istat) * 1000ull, (wan->lpull + wan->ipull) * 1000ull);
+	at = this->settle(at);
+	for (uint32_t i = 0ul; i < wan->schedules->length; i++) {
+		uint64_t emission = Discipline::unwrap(wan->schedules->get(i)->tmst, this->context.clock.us);
+		at = std::min(at, Host::manual ? emission : emission - EMIT_ADVANCE);
+	}
+	return at;
+}
+
+uint64_t Gateway::settle(uint64_t at) const {
+	if (!Host::manual) {
+		return at;
+	}
+	uint64_t settled = at;
+	for (uint32_t i = 0ul; i < this->wan->schedules->length; i++) {
+		uint64_t emission = Discipline::unwrap(this->wan->schedules->get(i)->tmst, this->context.clock.us);
+		if (at < emission && emission <= at + EMIT_ADVANCE) {
+			settled = std::max(settled, emission);
+		}
+	}
+	return settled;
+}
+
+void Gateway::advance(uint64_t at) {
+	if (Host::manual) {
+		if (this->ustime() < at) {
+			Host::set(at - this->context.offset);
+		}
+		return;
+	}
+	for (uint64_t now = this->ustime(); now < at; now = this->ustime()) {
+		usleep((useconds_t) ((double) (at - now) / Host::speed));
+	}
+}
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// Replay
+uint64_t Replay::ustime(const std::string& record) {
+	Capture::Record decoded;
+	Capture::decode((const uint8_t*) record.data(), record.size(), &decoded);
+	return decoded.us;
+}
+
+bool Replay::load(const char* path) {
+	FILE* file = fopen(path, "rb");
+	if (NULL == file) {
+		return false;
+	}
+	std::string data;
+	char chunk[4096];
+	for (size_t n = fread(chunk, 1u, sizeof(chunk), file); n; n = fread(chunk, 1u, sizeof(chunk), file)) {
+		data.append(chunk, n);
+	}
+	fclose(file);
+
+	// a SPIFFS segment is a header and its records, a collected file a header and its records per datagram
+	const uint8_t* bytes = (const uint8_t*) data.data();
+	size_t position = 0u;
+	bool found = false;
+	uint32_t last = 0ul;
+	while (position < data.size()) {
+		uint32_t sequence = 0ul;
+		uint8_t backends = 0u;
+		if (Capture::header(bytes + position, data.size() - position, &sequence, &backends, this->eui)) {
+			if (found && last + 1ul < sequence) {
+				this->lost += sequence - last - 1ul;
+			}
+			found = true;
+			last = sequence;
+			this->blocks += 1u;
+			this->backends = std::max(this->backends, backends);
+			position += CAPTURE_HEADER;
+			continue;
+		}
+		Capture::Record record;
+		uint16_t length = found ? Capture::decode(bytes + position, data.size() - position, &record) : 0u;
+		if (!length) {
+			this->damaged += data.size() - position;
+			break;
+		}
+		this->records.push_back(data.substr(position, length));
+		this->inputs[record.kind] += 1u;
+		position += length;
+	}
+	return found;
+}
+
+bool Replay::setup(const char* config, double speed) {
+	if (this->records.empty()) {
+		return false;
+	}
+	std::stable_sort(this->records.begin(), this->records.end(), [](const std::string& a, const std::string& b) {
+		return Replay::ustime(a) < Replay::ustime(b);
+	});
+
+	Host::manual = 0.0 >= speed;
+	Host::speed = Host::manual ? 1.0 : speed;
+	Host::set(0ull);
+	if (NULL != config && !Host::files(config)) {
+		return false;
+	}
+	srand(1u); // the tokens
+
+	uint64_t first = Replay::ustime(this->records.front());
+	this->gateway.setup(first, "");
+	WAN* wan = this->gateway.wan;
+	memcpy(wan->settings.id, this->eui, sizeof(this->eui));
+	if (wan->backends.length < this->backends) {
+		// the servers are not in the capture, the sockets are offline anyway
+		std::string servers;
+		for (uint8_t i = 1u; i < this->backends && i < BACKENDS; i++) {
+			servers += (1u < i ? ", replay" : "replay") + std::to_string(i) + ":1700";
+		}
+		wan->backends.parse(servers.c_str());
+	}
+
+	// stat and pull when the capture has the first ones, an interval after its start otherwise
+	wan->lstat = first / 1000ull;
+	wan->lpull = first / 1000ull;
+	bool stat = false, pull = false;
+	for (const std::string& encoded : this->records) {
+		Capture::Record record;
+		Capture::decode((const uint8_t*) encoded.data(), encoded.size(), &record);
+		if (Capture::UP != record.kind || record.backend || HEADER_LENGTH > record.size) {
+			continue;
+		}
+		if (!pull && PULL_DATA == record.data[3]) {
+			pull = true;
+			wan->lpull = record.us / 1000ull - wan->ipull;
+		} else if (!stat && PUSH_DATA == record.data[3] && NULL != memmem(record.data, record.size, "\"stat\"", 6u)) {
+			stat = true;
+			wan->lstat = record.us / 1000ull - wan->istat;
+		}
+	}
+
+	WiFiUDP::sent = [this](WiFiUDP& udp, const uint8_t* buffer, size_t size) {
+		int8_t backend = backendOf(this->gateway.wan, udp);
+		if (0 <= backend) {
+			Capture::Record record;
+			record.kind = Capture::UP;
+			record.backend = (uint8_t) backend;
+			record.size = (uint16_t) size;
+			record.us = this->gateway.ustime();
+			record.data = buffer;
+			this->output(record);
+		}
+	};
+	LoRa.transmitted = [this](Radio& radio, const uint8_t* frame, uint16_t size) {
+		Capture::Record record;
+		record.kind = Capture::TX;
+		record.size = size;
+		record.us = this->gateway.ustime();
+		record.freq = (uint32_t) radio.frequency;
+		record.rssi = (int16_t) radio.txpw;
+		record.sbw = (uint16_t) (radio.sbw / 1000l);
+		record.sfac = (uint8_t) radio.sfac;
+		record.crat = (uint8_t) radio.crat;
+		record.data = frame;
+		this->output(record);
+	};
+	return true;
+}
+
+void Replay::run(volatile bool& running) {
+	uint64_t start = Host::monotonic();
+	size_t next = 0u;
+	while (running) {
+		// the next frame or datagram to the gateway, the UP and TX of the capture are what it did
+		Capture::Record record;
+		for (; next < this->records.size(); next++) {
+			const std::string& encoded = this->records[next];
+			Capture::decode((const uint8_t*) encoded.data(), encoded.size(), &record);
+			if (Capture::RF == record.kind || Capture::DOWN == record.kind) {
+				break;
+			}
+		}
+		uint64_t at = next < this->records.size() ? this->gateway.settle(record.us) : UINT64_MAX;
+		if (UINT64_MAX == at && !this->gateway.wan->schedules->length) {
+			break;
+		}
+
+		uint64_t wake = this->gateway.wake();
+		if (wake <= at) {
+			this->gateway.advance(wake);
+			this->loop(TIMER);
+			continue;
+		}
+
+		this->gateway.advance(at);
+		if (!Host::manual) {
+			this->lag.add(this->gateway.ustime() - at);
+		}
+		if (Capture::RF == record.kind) {
+			RFM::Settings& settings = this->gateway.rfm->settings;
+			settings.freq.curr = record.freq;
+			settings.sfac = record.sfac;
+			settings.sbw = record.sbw * 1000l;
+			settings.crat = record.crat;
+			this->gateway.context.radio.receive(record.data, record.size, record.rssi, (int8_t) (record.snr / 25));
+			this->loop(FRAME);
+		} else {
+			if (record.backend < BACKENDS) {
+				this->gateway.wan->udps[record.backend]->inbox.push_back(std::string((const char*) record.data, record.size));
+			}
+			this->loop(DATAGRAM);
+		}
+		next++;
+	}
+	this->elapsed = Host::monotonic() - start;
+}
+
+void Replay::loop(Trigger trigger) {
+	uint64_t start = Host::monotonic();
+	this->gateway.loop();
+	this->loops[trigger].add(Host::monotonic() - start);
+}
+
+void Replay::output(const Capture::Record& record) {
+	uint8_t encoded[CAPTURE_RECORD + CAPTURE_RADIO + UDP_DATAGRAM];
+	uint16_t length = Capture::encode(record, encoded);
+	this->transcript.append((const char*) encoded, length);
+	this->outputs[record.kind] += 1u;
+}
+
+bool Replay::write(const char* path) const {
+	FILE* file = fopen(path, "wb");
+	if (NULL == file) {
+		return false;
+	}
+	uint8_t header[CAPTURE_HEADER];
+	Capture::header(header, 0ul, this->gateway.wan->backends.length, this->gateway.wan->settings.id);
+	bool written = CAPTURE_HEADER == fwrite(header, 1u, CAPTURE_HEADER, file)
+		&& this->transcript.size() == fwrite(this->transcript.data(), 1u, this->transcript.size(), file);
+	return 0 == fclose(file) && written;
+}
+
+uint64_t Replay::digest() const {
+	uint64_t hash = 0xCBF29CE484222325ull;
+	for (unsigned char c : this->transcript) {
+		hash = (hash ^ c) * 0x100000001B3ull;
+	}
+	return hash;
+}
+
+// the data of the rxpk of a PUSH_DATA, the bytes of an emission
+static void items(const Capture::Record& record, Capture::Kind kind, std::multiset<std::string>& items) {
+	if (kind != record.kind) {
+		return;
+	}
+	if (Capture::TX == kind) {
+		items.insert(std::string((const char*) record.data, record.size));
+		return;
+	}
+	if (HEADER_LENGTH > record.size || PUSH_DATA != record.data[3]) {
+		return;
+	}
+	std::string json((const char*) record.data + HEADER_LENGTH, record.size - HEADER_LENGTH);
+	for (size_t p = json.find("\"data\":\""); std::string::npos != p; p = json.find("\"data\":\"", p)) {
+		p += 8u;
+		size_t end = json.find('"', p);
+		if (std::string::npos == end) {
+			break;
+		}
+		items.insert(json.substr(p, end - p));
+	}
+}
+
+uint32_t Replay::matched(Capture::Kind kind, uint32_t* total) const {
+	std::multiset<std::string> replayed;
+	const uint8_t* bytes = (const uint8_t*) this->transcript.data();
+	Capture::Record record;
+	for (size_t p = 0u, n = 0u; p < this->transcript.size(); p += n) {
+		n = Capture::decode(bytes + p, this->transcript.size() - p, &record);
+		if (!n) {
+			break;
+		}
+		items(record, kind, replayed);
+	}
+
+	std::multiset<std::string> recorded;
+	for (const std::string& encoded : this->records) {
+		Capture::decode((const uint8_t*) encoded.data(), encoded.size(), &record);
+		items(record, kind, recorded);
+	}
+
+	uint32_t matched = 0ul;
+	for (const std::string& item : recorded) {
+		auto found = replayed.find(item);
+		if (replayed.end() != found) {
+			replayed.erase(found);
+			matched += 1u;
+		}
+	}
+	*total = (uint32_t) recorded.size();
+	return matched;
+}
+
+// //////////////////////////////////////////////////////////////////////////////////////
+// Recording
+bool Recording::run(const char* directory, uint32_t seconds, uint32_t seed) {
+	this->random.seed(seed);
+	srand(seed);
+	Host::manual = true;
+	Host::set(0ull);
+	if (!Host::files(directory)) {
+		return false;
+	}
+	this->gateway.setup(3600ull * 1000000ull, this->capture.c_str()); // booted an hour ago
+	WiFiUDP::sent = [this](WiFiUDP& udp, const uint8_t* buffer, size_t size) {
+		int8_t backend = backendOf(this->gateway.wan, udp);
+		if (0 <= backend && 4u <= size) {
+			this->answer((uint8_t) backend, buffer, size);
+		}
+	};
+
+	std::exponential_distribution<double> interval(this->rate);
+	uint64_t end = this->gateway.ustime() + seconds * 1000000ull;
+	uint64_t frame = this->gateway.ustime() + (uint64_t) (interval(this->random) * 1e6);
+	while (true) {
+		uint64_t at = std::min(frame, this->pending.empty() ? UINT64_MAX : this->pending.front().at);
+		at = this->gateway.settle(at);
+		uint64_t wake = this->gateway.wake();
+		if (end <= std::min(at, wake)) {
+			break;
+		}
+		if (wake <= at) {
+			this->gateway.advance(wake);
+			this->gateway.loop();
+			continue;
+		}
+
+		this->gateway.advance(at);
+		uint64_t now = this->gateway.ustime();
+		if (frame <= now) {
+			this->frame();
+			frame += (uint64_t) (interval(this->random) * 1e6) + 1u;
+		}
+		while (!this->pending.empty() && this->pending.front().at <= now) {
+			Answer& answer = this->pending.front();
+			this->gateway.wan->udps[answer.backend]->inbox.push_back(answer.datagram);
+			this->pending.erase(this->pending.begin());
+		}
+		this->gateway.loop();
+	}
+
+	Host::enter(&this->gateway.context);
+	this->gateway.wan->flushCapture();
+	Host::leave();
+	WiFiUDP::sent = nullptr;
+	return 0ul == this->gateway.wan->capture.dropped;
+}
+
+// a network server acknowledging everything, answering some rxpk in RX1 of EU868
+void Recording::answer(uint8_t backend, const uint8_t* buffer, size_t size) {
+	uint64_t at = this->gateway.ustime() + RECORDING_RTT;
+	uint8_t identifier = buffer[3];
+	char ack[4] = {PROTOCOL_VERSION, (char) buffer[1], (char) buffer[2], PUSH_ACK};
+	std::vector<Answer> answers;
+	if (PUSH_DATA == identifier) {
+		answers.push_back({at, backend, std::string(ack, sizeof(ack))});
+		std::string json((const char*) buffer, size);
+		size_t tmst = json.find("\"tmst\":");
+		std::uniform_real_distribution<double> draw(0.0, 1.0);
+		if (std::string::npos != tmst && this->gateway.wan->backends.backends[backend].down && draw(this->random) < this->downlinks) {
+			uint32_t rx1 = (uint32_t) strtoul(json.c_str() + tmst + 7u, NULL, 10) + 1000000ul;
+			uint16_t token = (uint16_t) this->random();
+			char resp[512] = {PROTOCOL_VERSION, (char) token, (char) (token >> 8), PULL_RESP};
+			int length = snprintf(resp + 4, sizeof(resp) - 4u, "{\"txpk\":{\"imme\":false,\"tmst\":%u,\"freq\":868.3,"
+				"\"rfch\":0,\"powe\":14,\"modu\":\"LORA\",\"datr\":\"SF7BW125\",\"codr\":\"4/5\",\"ipol\":true,"
+				"\"size\":12,\"data\":\"YAEAACYAAQABAgME\"}}", rx1);
+			answers.push_back({at, backend, std::string(resp, 4 + length)});
+		}
+	} else if (PULL_DATA == identifier) {
+		ack[3] = PULL_ACK;
+		answers.push_back({at, backend, std::string(ack, sizeof(ack))});
+	}
+	for (Answer& answer : answers) {
+		this->pending.push_back(answer); // at only grows
+		this->answers += 1u;
+	}
+}
+
+// an unconfirmed uplink of one of the 16 devices around the gateway, at SF7 to SF12
+void Recording::frame() {
+	uint8_t device = (uint8_t) (this->random() % 16u);
+	uint16_t fcnt = this->fcnt[device]++;
+	uint8_t frame[21] = {0x40, device, 0x1B, 0x01, 0x26, 0x00, (uint8_t) fcnt, (uint8_t) (fcnt >> 8), 0x01};
+	for (uint8_t i = 9u; i < sizeof(frame); i++) {
+		frame[i] = (uint8_t) this->random();
+	}
+	this->gateway.rfm->settings.sfac = 7 + (int) (this->random() % 6u);
+	int rssi = -120 + (int) (this->random() % 80u);
+	int8_t snr = (int8_t) ((int) (this->random() % 60u) - 40); // 0.25 dB
+	this->gateway.context.radio.receive(frame, sizeof(frame), rssi, snr);
+	this->frames += 1u;
+}
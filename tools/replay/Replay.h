@@ -0,0 +1,132 @@
+/**
+ * Replay of a capture of the gateway (libraries/WAN/Capture.h) through the WAN and RFM of the firmware
+ * built for the host (tools/host), for the regression tests of their behaviour and of their speed.
+ *
+ * The received frames of the capture go to the simulated radio and its datagrams from the network
+ * servers to the inbox of the sockets, at the ustime they were recorded; the sockets are offline. What
+ * the replayed gateway sends and emits is the transcript, in the capture format: with the host clock set
+ * by the replay (speed 0), the same capture and the same build give the same transcript byte for byte,
+ * its digest is what a regression test compares. The PUSH_DATA and emissions of the capture are matched
+ * against it: the rxpk of the same frames, the same frames emitted.
+ *
+ * Every loop of the gateway is timed on the host clock, by what woke it: a frame, a datagram, a timer
+ * (stat, pull, emission). At a speed (1 is real time) the host clock runs and the replay sleeps between
+ * the records, lag is how late they were handed to the gateway.
+ *
+ * Recording is the other way round: a gateway of random traffic with a network server answering in
+ * RECORDING_RTT, capturing to the SPIFFS of a directory (the input of make check) or to a collector.
+ */
+
+#include <Host.h>
+#include <Histogram.h>
+#include <WAN.h>
+#include <RFM.h>
+#include <Node.h>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef __Replay__
+#define __Replay__
+
+#define REPLAY_TRIGGERS 3
+#define RECORDING_RTT 30000ull // us of the network server of a recording
+
+// the tree of the gateway, logs and commands go nowhere
+class Root : public Node {
+	public:
+	Root() : Node(NULL, "root") {}
+	virtual JsonObject rootIT(JsonObject& root) { return root; }
+	virtual void command(JsonObject& command) {}
+};
+
+class Gateway {
+	public:
+	Host::Context context;
+	Root root;
+	RFM* rfm = NULL;
+	WAN* wan = NULL;
+
+	Gateway();
+	virtual ~Gateway();
+	void setup(uint64_t uptime, const char* capture); // offline sockets, "" for no capture
+	void loop();
+	uint64_t ustime() const; // of the gateway, on the host clock
+
+	/* wake, settle:
+	 *   Description:
+	 *     wake is the ustime of the next stat, pull or emission, an emission at its tmst on a manual
+	 *     clock and EMIT_ADVANCE before it otherwise. On a manual clock, a loop at settle(at) instead of
+	 *     at waits for the emission due in the EMIT_ADVANCE after at: emitDownlinks would spin forever
+	 *     on a clock that does not move (the radio of the ESP8266 is busy emitting anyway)
+	 */
+	uint64_t wake() const;
+	uint64_t settle(uint64_t at) const;
+	void advance(uint64_t at); // sets the manual clock there, sleeps until there otherwise
+};
+
+class Replay {
+	public:
+	enum Trigger : uint8_t { FRAME, DATAGRAM, TIMER };
+
+	Gateway gateway;
+	std::vector<std::string> records; // of the capture, encoded, by ustime
+	uint8_t eui[8] = {0};
+	uint8_t backends = 1u;
+	uint32_t blocks = 0ul;   // headers read
+	uint32_t lost = 0ul;     // datagrams of a collector missing, by their sequence
+	uint64_t damaged = 0ull; // bytes after which a file could not be read
+
+	std::string transcript;  // UP and TX of the replayed gateway, encoded
+	uint64_t inputs[Capture::TX + 1u] = {0ull};  // records of the capture by kind
+	uint64_t outputs[Capture::TX + 1u] = {0ull}; // of the transcript
+	Histogram loops[REPLAY_TRIGGERS]; // us of host clock
+	Histogram lag;                    // us of gateway clock, speed > 0 only
+	uint64_t elapsed = 0ull;          // us of the whole replay on CLOCK_MONOTONIC
+
+	bool load(const char* path); // false if it is no capture
+	bool setup(const char* config, double speed); // config: a copy of the SPIFFS of the gateway, or NULL
+	void run(volatile bool& running);
+	bool write(const char* path) const; // the transcript, with a header
+	uint64_t digest() const; // FNV-1a of the transcript
+
+	/* matched:
+	 *   Description:
+	 *     Of the records of a kind in the capture, UP (rxpk, by their data) or TX (by their bytes), how
+	 *     many the transcript has too
+	 */
+	uint32_t matched(Capture::Kind kind, uint32_t* total) const;
+	static uint64_t ustime(const std::string& record);
+
+	protected:
+	void loop(Trigger trigger);
+	void output(const Capture::Record& record);
+};
+
+class Recording {
+	public:
+	Gateway gateway;
+	std::mt19937_64 random;
+	double rate = 1.0;       // frames per second
+	double downlinks = 0.2;  // of the rxpk answered with a PULL_RESP for RX1
+	String capture = "spiffs"; // or the host:port of tools/replay --collect
+	uint64_t frames = 0ull;
+	uint64_t answers = 0ull; // datagrams of the network server
+	uint16_t fcnt[16] = {0u}; // of the devices around the gateway
+
+	bool run(const char* directory, uint32_t seconds, uint32_t seed);
+
+	protected:
+	class Answer {
+		public:
+		uint64_t at;
+		uint8_t backend;
+		std::string datagram;
+	};
+	std::vector<Answer> pending; // of the network server, by at
+
+	void answer(uint8_t backend, const uint8_t* buffer, size_t size);
+	void frame();
+};
+
+#endif
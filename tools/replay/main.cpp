@@ -0,0 +1,250 @@
+/*
+ Replay of a capture of the gateway, see Replay.h
+
+   replay [--speed 0] [--config dir] [--out file] [--expect digest] [--strict] [--verbose] capture ...
+   replay --record dir [--capture spiffs] [--seconds 120] [--rate 1] [--downlinks 0.2] [--seed 1]
+   replay --collect host:port --out file [--seconds 0]
+
+     capture      /capture0.bin and /capture1.bin of the SPIFFS of the gateway, or a file of --collect
+     --speed      0: as fast as it goes on a clock set by the replay, the transcript is reproducible;
+                  1: real time, 10: ten times faster
+     --config     a directory with the wan/wan.json and rfm/rfm.json of the gateway
+     --out        the transcript, in the capture format
+     --expect     the digest of the transcript, exits 1 when it differs
+     --strict     exits 1 unless every rxpk and emission of the capture is in the transcript
+     --record     a gateway of random traffic with its SPIFFS in dir, with a network server that
+                  acknowledges everything and answers --downlinks of the rxpk
+     --capture    of the recording: "spiffs" or the host:port of a --collect
+     --collect    receives the datagrams of a gateway with capture host:port, until --seconds or ^C
+
+ Prints what the capture holds, the time of the loops of the gateway by what woke it, what the replayed
+ gateway sent and emitted, its digest and how much of the capture it matched.
+*/
+#include <Replay.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/socket.h>
+
+static volatile bool running = true;
+
+static void stop(int) {
+	running = false;
+}
+
+static void usage() {
+	printf("replay [--speed 0] [--config dir] [--out file] [--expect digest] [--strict] [--verbose] capture ...\n");
+	printf("replay --record dir [--capture spiffs] [--seconds 120] [--rate 1] [--downlinks 0.2] [--seed 1]\n");
+	printf("replay --collect host:port --out file [--seconds 0]\n");
+}
+
+static void line(const char* name, const Histogram& histogram) {
+	printf("%-20s %9llu  p50 %8llu  p90 %8llu  p99 %8llu  max %8llu us\n", name, (unsigned long long) histogram.count,
+		(unsigned long long) histogram.percentile(50.0), (unsigned long long) histogram.percentile(90.0),
+		(unsigned long long) histogram.percentile(99.0), (unsigned long long) histogram.max);
+}
+
+static int collect(const char* address, const char* out, uint32_t seconds) {
+	const char* colon = strrchr(address, ':');
+	if (NULL == colon || NULL == out) {
+		usage();
+		return 1;
+	}
+	std::string host(address, colon - address);
+	addrinfo hints;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_DGRAM;
+	hints.ai_flags = AI_PASSIVE;
+	addrinfo* found = NULL;
+	if (0 != getaddrinfo(host.c_str(), colon + 1, &hints, &found)) {
+		printf("cannot resolve %s\n", address);
+		return 1;
+	}
+	int fd = socket(AF_INET, SOCK_DGRAM, 0);
+	bool bound = 0 <= fd && 0 == bind(fd, found->ai_addr, found->ai_addrlen);
+	freeaddrinfo(found);
+	FILE* file = bound ? fopen(out, "wb") : NULL;
+	if (NULL == file) {
+		printf("cannot listen on %s or write %s\n", address, out);
+		return 1;
+	}
+	timeval timeout = {0, 200000};
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+	printf("collecting on %s to %s\n", address, out);
+	fflush(stdout);
+	uint64_t end = seconds ? Host::monotonic() + seconds * 1000000ull : UINT64_MAX;
+	uint64_t datagrams = 0ull, bytes = 0ull, ignored = 0ull;
+	uint8_t buffer[UDP_DATAGRAM];
+	while (running && Host::monotonic() < end) {
+		ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+		uint32_t sequence = 0ul;
+		uint8_t backends = 0u;
+		uint8_t eui[8];
+		if (0 >= n) {
+			continue;
+		}
+		if (!Capture::header(buffer, (size_t) n, &sequence, &backends, eui)) {
+			ignored += 1u;
+			continue;
+		}
+		fwrite(buffer, 1u, (size_t) n, file);
+		fflush(file);
+		datagrams += 1u;
+		bytes += (uint64_t) n;
+	}
+	fclose(file);
+	close(fd);
+	printf("datagrams %llu, %llu bytes, not a capture %llu\n", (unsigned long long) datagrams, (unsigned long long) bytes,
+		(unsigned long long) ignored);
+	return 0;
+}
+
+int main(int argc, char** argv) {
+	double speed = 0.0;
+	const char* config = NULL;
+	const char* out = NULL;
+	const char* expect = NULL;
+	const char* record = NULL;
+	const char* address = NULL;
+	bool strict = false;
+	uint32_t seconds = 0ul;
+	uint32_t seed = 1ul;
+	Recording recording;
+	std::vector<const char*> captures;
+	Serial.quiet = true;
+	for (int i = 1; i < argc; i++) {
+		const char* option = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+		if (!strcmp(option, "--verbose")) {
+			Serial.quiet = false;
+			continue;
+		}
+		if (!strcmp(option, "--strict")) {
+			strict = true;
+			continue;
+		}
+		if (strncmp(option, "--", 2u)) {
+			captures.push_back(option);
+			continue;
+		}
+		if (NULL == value) {
+			usage();
+			return 1;
+		}
+		i++;
+		if (!strcmp(option, "--speed")) {
+			speed = strtod(value, NULL);
+		} else if (!strcmp(option, "--config")) {
+			config = value;
+		} else if (!strcmp(option, "--out")) {
+			out = value;
+		} else if (!strcmp(option, "--expect")) {
+			expect = value;
+		} else if (!strcmp(option, "--record")) {
+			record = value;
+		} else if (!strcmp(option, "--collect")) {
+			address = value;
+		} else if (!strcmp(option, "--capture")) {
+			recording.capture = value;
+		} else if (!strcmp(option, "--seconds")) {
+			seconds = strtoul(value, NULL, 10);
+		} else if (!strcmp(option, "--rate")) {
+			recording.rate = strtod(value, NULL);
+		} else if (!strcmp(option, "--downlinks")) {
+			recording.downlinks = strtod(value, NULL);
+		} else if (!strcmp(option, "--seed")) {
+			seed = strtoul(value, NULL, 10);
+		} else {
+			usage();
+			return 1;
+		}
+	}
+	signal(SIGINT, stop);
+	signal(SIGTERM, stop);
+
+	if (NULL != address) {
+		return collect(address, out, seconds);
+	}
+
+	if (NULL != record) {
+		Capture check;
+		if (!check.parse(recording.capture.c_str()) || Capture::OFF == check.mode) {
+			usage();
+			return 1;
+		}
+		seconds = seconds ? seconds : 120ul;
+		if (!recording.run(record, seconds, seed)) {
+			printf("cannot record to %s: not a directory, or the capture lost records\n", record);
+			return 1;
+		}
+		const Capture& capture = recording.gateway.wan->capture;
+		printf("recorded %u s: frames %llu, network server datagrams %llu, records %u, %u bytes ", seconds,
+			(unsigned long long) recording.frames, (unsigned long long) recording.answers, capture.records, capture.bytes);
+		if (Capture::UDP == capture.mode) {
+			printf("in %u datagrams to %s:%u\n", capture.sequence, capture.host, capture.port);
+		} else {
+			printf("in %s/capture%u.bin and before\n", record, capture.segment);
+		}
+		return 0;
+	}
+
+	Replay replay;
+	for (const char* capture : captures) {
+		if (!replay.load(capture)) {
+			printf("%s is no capture\n", capture);
+			return 1;
+		}
+	}
+	if (!replay.setup(config, speed)) {
+		usage();
+		return 1;
+	}
+
+	const uint8_t* id = replay.eui;
+	printf("capture of %02X%02X%02X%02X%02X%02X%02X%02X: %u blocks, %u records (RF %llu, UP %llu, DOWN %llu, TX %llu), "
+		"%u servers, lost datagrams %u, unreadable bytes %llu\n", id[0], id[1], id[2], id[3], id[4], id[5], id[6], id[7],
+		replay.blocks, (unsigned) replay.records.size(), (unsigned long long) replay.inputs[Capture::RF],
+		(unsigned long long) replay.inputs[Capture::UP], (unsigned long long) replay.inputs[Capture::DOWN],
+		(unsigned long long) replay.inputs[Capture::TX], replay.backends, replay.lost, (unsigned long long) replay.damaged);
+	fflush(stdout);
+
+	replay.run(running);
+
+	uint64_t span = Replay::ustime(replay.records.back()) - Replay::ustime(replay.records.front());
+	printf("replayed %.3f s of capture in %.3f ms%s\n", span / 1e6, replay.elapsed / 1e3,
+		Host::manual ? " (clock set by the replay)" : "");
+	line("loop on a frame", replay.loops[Replay::FRAME]);
+	line("loop on a datagram", replay.loops[Replay::DATAGRAM]);
+	line("loop on a timer", replay.loops[Replay::TIMER]);
+	if (!Host::manual) {
+		line("lag of the records", replay.lag);
+	}
+
+	uint32_t rxpk = 0ul, emissions = 0ul;
+	uint32_t forwarded = replay.matched(Capture::UP, &rxpk);
+	uint32_t emitted = replay.matched(Capture::TX, &emissions);
+	char digest[17];
+	snprintf(digest, sizeof(digest), "%016llx", (unsigned long long) replay.digest());
+	printf("transcript: UP %llu, TX %llu, digest %s\n", (unsigned long long) replay.outputs[Capture::UP],
+		(unsigned long long) replay.outputs[Capture::TX], digest);
+	printf("rxpk of the capture forwarded again %u/%u, emissions emitted again %u/%u\n", forwarded, rxpk, emitted, emissions);
+
+	if (NULL != out && !replay.write(out)) {
+		printf("cannot write %s\n", out);
+		return 1;
+	}
+	if (NULL != expect && strcmp(expect, digest)) {
+		printf("digest %s expected\n", expect);
+		return 1;
+	}
+	if (strict && (forwarded != rxpk || emitted != emissions)) {
+		return 1;
+	}
+	return 0;
+}
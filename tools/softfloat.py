@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""
+Lists the soft-float routines reachable from the packet path.
+
+The ESP8266 has no FPU, every float or double operation is a libgcc call (__adddf3, __muldf3,
+__floatsidf, __ltdf2 ...). The core compiles with -ffunction-sections, so each function of the
+build objects has its own .text.<symbol> / .literal.<symbol> sections and the relocations of those
+sections are its calls. This walks that call graph from the packet path functions and prints the
+shortest chain to every soft-float routine it reaches. Build the sketch (Arduino IDE, verbose
+compilation shows the build folder) and point it there:
+
+    python3 tools/softfloat.py /tmp/arduino_build_123456
+    python3 tools/softfloat.py /tmp/arduino_build_123456 --root 'Fixed::' --objdump xtensa-lx106-elf-objdump
+
+Exits with 1 when a soft-float routine is reachable, 0 otherwise.
+"""
+
+import argparse
+import collections
+import os
+import re
+import subprocess
+import sys
+
+# the packet path: received radio packet to rxpk, PULL_RESP to the radio
+ROOTS = [
+	r"^WAN::onRFMPacket\(",
+	r"^WAN::send\(",
+	r"^WAN::resp\(",
+	r"^WAN::read\(",
+	r"^WAN::Message::RxPk::",
+	r"^WAN::Datarate::",
+	r"^Fixed::",
+	r"^RFM::read\(",
+]
+
+# libgcc soft-float: arithmetic and compares (__adddf3, __ltsf2, __unorddf2, __extendsfdf2),
+# conversions (__floatsidf, __floatundisf, __fixdfsi, __fixunssfdi) and __truncdfsf2
+SOFTFLOAT = r"^__(?:[a-z]+[sd]f\d|float(?:un)?[sd]i[sd]f|fix(?:uns)?[sd]f[sd]i|truncdfsf2)$"
+
+SECTION = re.compile(r"^\.(?:irom0\.text|text|literal)\.(.+)$")
+RECORDS = re.compile(r"^RELOCATION RECORDS FOR \[(.+)\]:$")
+HEADER = re.compile(r"^\s*\d+\s+(\S+)\s+[0-9a-fA-F]{8}")
+
+
+def symbol(name):
+	name = name.split("+")[0].split("-")[0]
+	match = SECTION.match(name)
+	return match.group(1) if match else name
+
+
+def calls(objdump, path, graph):
+	output = subprocess.run([objdump, "-h", "-r", path], stdout=subprocess.PIPE, universal_newlines=True, check=True).stdout
+	caller = None
+	for line in output.splitlines():
+		header = HEADER.match(line)
+		if header and SECTION.match(header.group(1)):
+			graph[symbol(header.group(1))] # functions without relocations are leaves
+			continue
+		match = RECORDS.match(line)
+		if match:
+			section = SECTION.match(match.group(1))
+			caller = section.group(1) if section else None
+			continue
+		fields = line.split()
+		if caller and 3 == len(fields) and re.match(r"^[0-9a-fA-F]+$", fields[0]):
+			callee = symbol(fields[2])
+			if callee != caller:
+				graph[caller].add(callee)
+
+
+def demangle(symbols):
+	output = subprocess.run(["c++filt"], input="\n".join(symbols), stdout=subprocess.PIPE, universal_newlines=True, check=True).stdout
+	return dict(zip(symbols, output.splitlines()))
+
+
+def main():
+	parser = argparse.ArgumentParser(description="soft-float routines reachable from the packet path")
+	parser.add_argument("build", help="folder of the build objects, searched recursively")
+	parser.add_argument("--objdump", default="xtensa-lx106-elf-objdump")
+	parser.add_argument("--root", action="append", help="regex of the demangled entry points, repeatable (default: the packet path)")
+	parser.add_argument("--pattern", default=SOFTFLOAT, help="regex of the routines to look for")
+	args = parser.parse_args()
+
+	graph = collections.defaultdict(set)
+	objects = 0
+	for folder, _, files in os.walk(args.build):
+		for name in files:
+			if name.endswith(".o"):
+				calls(args.objdump, os.path.join(folder, name), graph)
+				objects += 1
+	if not objects:
+		sys.exit("no objects in " + args.build)
+
+	symbols = sorted(set(graph) | set(callee for callees in graph.values() for callee in callees))
+	names = demangle(symbols)
+	roots = [re.compile(root) for root in (args.root or ROOTS)]
+	pattern = re.compile(args.pattern)
+
+	# breadth first, the parent of each symbol gives the shortest chain back to a root
+	parent = {}
+	queue = collections.deque()
+	for s in symbols:
+		if s in graph and any(root.search(names[s]) for root in roots):
+			parent[s] = None
+			queue.append(s)
+	if not queue:
+		sys.exit("no function matches the roots")
+
+	found = []
+	while queue:
+		s = queue.popleft()
+		if pattern.search(s):
+			found.append(s)
+			continue
+		for callee in sorted(graph.get(s, ())):
+			if callee not in parent:
+				parent[callee] = s
+				queue.append(callee)
+
+	for s in found:
+		chain = []
+		while s is not None:
+			chain.append(names.get(s, s))
+			s = parent[s]
+		print("\n    <- ".join(chain))
+		print()
+	print("%d soft-float routines reachable from %d roots, %d objects" % (len(found), sum(1 for s in parent if parent[s] is None), objects))
+	return 1 if found else 0
+
+
+if "__main__" == __name__:
+	sys.exit(main())